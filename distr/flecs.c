@@ -203,8 +203,12 @@ void flecs_name_index_update_name(
 #define FLECS_ENTITY_PAGE_SIZE (1 << FLECS_ENTITY_PAGE_BITS)
 #define FLECS_ENTITY_PAGE_MASK (FLECS_ENTITY_PAGE_SIZE - 1)
 
+/* Pages are aligned to a cache line so that records don't straddle lines */
+#define FLECS_ENTITY_PAGE_ALIGN (64)
+
 typedef struct ecs_entity_index_page_t {
     ecs_record_t records[FLECS_ENTITY_PAGE_SIZE];
+    void *alloc;                     /* Unaligned allocation of page */
 } ecs_entity_index_page_t;
 
 typedef struct ecs_entity_index_t {
@@ -245,6 +249,11 @@ ecs_record_t* flecs_entity_index_try_get_any(
     const ecs_entity_index_t *index,
     uint64_t entity);
 
+/* Prefetch record of entity (may not exist/may not be alive) */
+void flecs_entity_index_prefetch(
+    const ecs_entity_index_t *index,
+    uint64_t entity);
+
 /** Ensure entity exists. */
 ecs_record_t* flecs_entity_index_ensure(
     ecs_entity_index_t *index,
@@ -324,6 +333,7 @@ const uint64_t* flecs_entity_index_ids(
 #define flecs_entities_get(world, entity) flecs_entity_index_get(ecs_eis(world), entity)
 #define flecs_entities_try(world, entity) flecs_entity_index_try_get(ecs_eis(world), entity)
 #define flecs_entities_get_any(world, entity) flecs_entity_index_get_any(ecs_eis(world), entity)
+#define flecs_entities_prefetch(world, entity) flecs_entity_index_prefetch(ecs_eis(world), entity)
 #define flecs_entities_ensure(world, entity) flecs_entity_index_ensure(ecs_eis(world), entity)
 #define flecs_entities_remove(world, entity) flecs_entity_index_remove(ecs_eis(world), entity)
 #define flecs_entities_make_alive(world, entity) flecs_entity_index_make_alive(ecs_eis(world), entity)
@@ -360,7 +370,7 @@ typedef struct ecs_table_cache_list_t {
 
 /** Table cache */
 typedef struct ecs_table_cache_t {
-    ecs_map_t index; /* <table_id, T*> */
+    ecs_map_t index; /* <table_id, T*>, created when cache has >1 tables */
     ecs_table_cache_list_t tables;
 } ecs_table_cache_t;
 
@@ -369,9 +379,11 @@ void ecs_table_cache_init(
     ecs_table_cache_t *cache);
 
 void ecs_table_cache_fini(
+    ecs_world_t *world,
     ecs_table_cache_t *cache);
 
 void ecs_table_cache_insert(
+    ecs_world_t *world,
     ecs_table_cache_t *cache,
     const ecs_table_t *table,
     ecs_table_cache_hdr_t *result);
@@ -382,6 +394,7 @@ void ecs_table_cache_replace(
     ecs_table_cache_hdr_t *elem);
 
 void* ecs_table_cache_remove(
+    ecs_world_t *world,
     ecs_table_cache_t *cache,
     uint64_t table_id,
     ecs_table_cache_hdr_t *elem);
@@ -441,14 +454,25 @@ typedef struct ecs_reachable_cache_t {
     ecs_vec_t ids; /* vec<reachable_elem_t> */
 } ecs_reachable_cache_t;
 
+/* Component index data for pairs that is only used by a subset of the pair
+ * records. Worlds can have millions of pair records, so this data is stored
+ * separately and is only allocated for records that need it. */
+typedef struct ecs_pair_record_ext_t {
+    /* Vector with ordered children */
+    ecs_vec_t ordered_children;
+
+    /* Cache for finding components that are reachable through a relationship */
+    ecs_reachable_cache_t reachable;
+
+    /* Row index for union relationship, created on demand for (R, Union) */
+    struct ecs_union_index_t *union_index;
+} ecs_pair_record_ext_t;
+
 /* Component index data that just applies to pairs */
 typedef struct ecs_pair_record_t {
     /* Name lookup index (currently only used for ChildOf pairs) */
     ecs_hashmap_t *name_index;
 
-    /* Vector with ordered children */
-    ecs_vec_t ordered_children;
-
     /* Lists for all id records that match a pair wildcard. The wildcard id
      * record is at the head of the list. */
     ecs_id_record_elem_t first;   /* (R, *) */
@@ -458,8 +482,8 @@ typedef struct ecs_pair_record_t {
     /* Parent component record. For pair records the parent is the (R, *) record. */
     ecs_component_record_t *parent;
 
-    /* Cache for finding components that are reachable through a relationship */
-    ecs_reachable_cache_t reachable;
+    /* Ordered children, reachable cache & union index, created on demand */
+    ecs_pair_record_ext_t *ext;
 } ecs_pair_record_t;
 
 /* Payload for id index which contains all data structures for an id. */
@@ -555,6 +579,11 @@ ecs_hashmap_t* flecs_component_name_index_get(
     const ecs_world_t *world,
     ecs_component_record_t *cr);
 
+/* Ensure data for pair record that is created on demand */
+ecs_pair_record_ext_t* flecs_pair_record_ext_ensure(
+    ecs_world_t *world,
+    ecs_component_record_t *cr);
+
 /* Init sparse storage */
 void flecs_component_init_sparse(
     ecs_world_t *world,
@@ -630,6 +659,26 @@ typedef struct ecs_graph_edges_t {
     ecs_map_t *hi;                   /* Map for hi edges (map<id, edge_t>) */
 } ecs_graph_edges_t;
 
+/* Element of the hi edge cache. The edges member identifies both the table and
+ * whether the edge is an add or remove edge. */
+typedef struct ecs_graph_edge_cache_elem_t {
+    const ecs_graph_edges_t *edges;
+    ecs_id_t id;
+    ecs_graph_edge_t *edge;
+} ecs_graph_edge_cache_elem_t;
+
+/* World level cache for hi edge lookups. Hi edges (pairs, components with
+ * large ids) are stored in a map per table, which is slow to search when
+ * tables have many outgoing edges, like when a relationship is used with many
+ * targets. The cache is direct mapped, and grows with the number of hi edges
+ * in the world. */
+typedef struct ecs_graph_edge_cache_t {
+    ecs_graph_edge_cache_elem_t *elems;
+    int32_t size;                    /* Number of elements, power of two */
+    int32_t shift;                   /* 64 - log2(size) */
+    int32_t edge_count;              /* Number of hi edges in world */
+} ecs_graph_edge_cache_t;
+
 /* Table graph node */
 typedef struct ecs_graph_node_t {
     /* Outgoing edges */
@@ -715,6 +764,10 @@ ecs_table_t* flecs_find_table_add(
     ecs_id_t id,
     ecs_table_diff_builder_t *diff);
 
+/* Free hi edge cache */
+void flecs_table_edge_cache_fini(
+    ecs_world_t *world);
+
 void flecs_table_hashmap_init(
     ecs_world_t *world,
     ecs_hashmap_t *hm);    
@@ -786,6 +839,12 @@ typedef struct ecs_table_event_t {
      * initializing an event a bit simpler. */
 } ecs_table_event_t;
 
+/** Changed rows for a column of a component with the DirtyRows trait */
+typedef struct ecs_table_dirty_rows_t {
+    int32_t column;                  /* Column index */
+    ecs_vec_t bits;                  /* One bit per row, set if row changed */
+} ecs_table_dirty_rows_t;
+
 /** Infrequently accessed data not stored inline in ecs_table_t */
 typedef struct ecs_table__t {
     uint64_t hash;                   /* Type hash */
@@ -795,13 +854,23 @@ typedef struct ecs_table__t {
     uint16_t generation;             /* Used for table cleanup */
     int16_t record_count;            /* Table record count including wildcards */
 
+    int64_t gc_frame;                /* Frame + 1 in which table GC found table empty */
+    uint16_t gc_version;             /* Table version when table GC found table empty */
+    bool gc_pooled;                  /* Storage freed by table GC, kept for reuse */
+
     int16_t bs_count;
     int16_t bs_offset;
     ecs_bitset_t *bs_columns;        /* Bitset columns */
 
+    int32_t dirty_rows_count;
+    ecs_table_dirty_rows_t *dirty_rows; /* Changed rows per tracked column */
+
     struct ecs_table_record_t *records; /* Array with table records */
     ecs_pair_record_t *childof_r;       /* ChildOf pair data */
 
+    /* Cached plans for instantiating prefab children stored in table */
+    struct ecs_instantiate_plan_t *instantiate_plans;
+
 #ifdef FLECS_DEBUG_INFO
     /* Fields used for debug visualization */
     struct {
@@ -890,6 +959,19 @@ void flecs_table_delete(
     int32_t index,
     bool destruct);
 
+/* Move rows to the end of the table, used for batched deletes. */
+void flecs_table_move_to_end(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    const int32_t *rows,
+    int32_t count);
+
+/* Delete the last count entities from the table. */
+void flecs_table_delete_last(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t count);
+
 /* Move a row from one table to another */
 void flecs_table_move(
     ecs_world_t *world,
@@ -953,7 +1035,22 @@ void flecs_table_swap(
 void flecs_table_mark_dirty(
     ecs_world_t *world,
     ecs_table_t *table,
-    ecs_entity_t component);
+    ecs_entity_t component,
+    int32_t row);
+
+/* Mark rows changed for columns with the DirtyRows trait. If column is -1, 
+ * rows are marked for all tracked columns. */
+void flecs_table_mark_rows_dirty(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t column,
+    int32_t row,
+    int32_t count);
+
+/* Get changed rows for column, NULL if column doesn't track rows. */
+ecs_table_dirty_rows_t* flecs_table_get_dirty_rows(
+    const ecs_table_t *table,
+    int32_t column);
 
 void flecs_table_notify(
     ecs_world_t *world,
@@ -965,6 +1062,20 @@ void flecs_table_delete_entities(
     ecs_world_t *world,
     ecs_table_t *table);
 
+/* Component storage that was detached from a deleted table. The data has not
+ * been destructed yet, and is freed with the world allocator. */
+typedef struct ecs_table_detached_t {
+    ecs_vec_t data;
+    const ecs_type_info_t *ti;
+} ecs_table_detached_t;
+
+/* Same as flecs_table_delete_entities, but instead of invoking destructors the
+ * component storage is appended to a vector<ecs_table_detached_t>. */
+void flecs_table_delete_entities_detached(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    ecs_vec_t *detached);
+
 /* Increase observer count of table */
 void flecs_table_traversable_add(
     ecs_table_t *table,
@@ -1086,6 +1197,106 @@ void flecs_ordered_children_reorder(
     const ecs_entity_t *children,
     int32_t child_count);
 
+#endif
+
+/**
+ * @file storage/union_index.h
+ * @brief Per table row index for union relationships.
+ *
+ * The switch list stores union targets per entity, which is efficient for
+ * looking up or changing the target of a single entity, but requires chasing a
+ * linked list to find all entities for a target. The union index stores for
+ * each table with a union relationship a row bitmap per target, which lets
+ * queries find the rows for a target with word-level bit scans, and return
+ * them as contiguous ranges.
+ *
+ * Bitmaps are stored sparsely as a sorted list of non-zero 64-row words, so
+ * that the memory used by a table is bounded by its row count, regardless of
+ * how many targets are used. Table indices are built lazily, and rebuilt when
+ * the table changed or a target of an entity in the table changed.
+ */
+
+#ifndef FLECS_UNION_INDEX_H
+#define FLECS_UNION_INDEX_H
+
+/* Non-zero word in row bitmap */
+typedef struct ecs_union_word_t {
+    int32_t index;                /* Word index (row / 64) */
+    uint64_t bits;                /* Bits for rows in word */
+} ecs_union_word_t;
+
+/* Row bitmap for union target */
+typedef struct ecs_union_target_t {
+    ecs_entity_t tgt;             /* Union target */
+    ecs_vec_t words;              /* vec<ecs_union_word_t>, sorted by index */
+} ecs_union_target_t;
+
+/* Row index for table */
+typedef struct ecs_union_table_t {
+    const ecs_table_t *table;     /* Table for which index was built */
+    uint16_t table_version;       /* Table version when index was built */
+    int32_t count;                /* Table count when index was built */
+    bool dirty;                   /* Target of entity in table changed */
+    ecs_vec_t targets;            /* vec<ecs_union_target_t> */
+    int32_t init_count;           /* Elements in targets with initialized words */
+    ecs_map_t target_index;       /* map<tgt, index in targets> */
+} ecs_union_table_t;
+
+/* Row index for union relationship */
+typedef struct ecs_union_index_t {
+    ecs_map_t tables;             /* map<table_id, ecs_union_table_t*> */
+} ecs_union_index_t;
+
+/* Free union index of (R, Union) component record. */
+void flecs_union_index_fini(
+    ecs_world_t *world,
+    ecs_component_record_t *cr);
+
+/* Signal that the target of an entity in table changed. */
+void flecs_union_index_invalidate(
+    ecs_component_record_t *cr,
+    const ecs_table_t *table);
+
+/* Remove table from union index (called when table is deleted). */
+void flecs_union_index_remove_table(
+    ecs_world_t *world,
+    ecs_component_record_t *cr,
+    const ecs_table_t *table);
+
+/* Get up to date row index for table. */
+const ecs_union_table_t* flecs_union_index_get(
+    ecs_world_t *world,
+    ecs_component_record_t *cr,
+    ecs_table_t *table);
+
+/* Get row bitmap for target in table, or NULL if no rows have target. */
+const ecs_union_target_t* flecs_union_table_get_target(
+    const ecs_union_table_t *ut,
+    ecs_entity_t tgt);
+
+/* Set iteration state of row bitmap to first row at or after row. */
+void flecs_union_target_seek(
+    const ecs_union_target_t *ut,
+    int32_t row,
+    int32_t *word,
+    int32_t *bit);
+
+/* Find next contiguous range of rows in row bitmap. The word and bit
+ * parameters store the iteration state, and should be initialized to 0. */
+bool flecs_union_target_next_range(
+    const ecs_union_target_t *ut,
+    int32_t *word,
+    int32_t *bit,
+    int32_t *offset,
+    int32_t *count);
+
+/* Set target of entity in union storage. */
+void flecs_union_set(
+    ecs_component_record_t *cr,
+    const ecs_table_t *table,
+    ecs_entity_t entity,
+    ecs_entity_t tgt);
+
 #endif
 
  /**
@@ -1256,6 +1467,14 @@ typedef struct {
     ecs_entity_t cur;
     ecs_entity_t tgt;
     int32_t row;
+
+    /* Union index iteration state */
+    ecs_table_cache_iter_t it;
+    const ecs_union_table_t *ut;
+    const ecs_union_target_t *target;
+    int32_t tgt_index;
+    int32_t word;
+    int32_t bit;
 } ecs_query_union_ctx_t;
 
 /* Sparse context */
@@ -1265,6 +1484,8 @@ typedef struct {
     ecs_sparse_t *sparse;
     ecs_table_range_t range;
     int32_t cur;
+    int32_t dense_cur;        /* Current element in dense array of sparse set */
+    bool dense;               /* Find entities in range with sparse set */
     bool self;
     bool exclusive;
 
@@ -1413,6 +1634,9 @@ typedef struct {
     int32_t block_index;
     ecs_flags64_t block;
     ecs_termset_t prev_set_fields;
+    ecs_termset_t bs_not;    /* Bitsets in bs_columns for not fields */
+    int16_t bs_count;        /* Number of bitsets in bs_columns */
+    int16_t bs_columns[FLECS_TERM_COUNT_MAX]; /* Bitset columns of fields */
     bool optional_not;
     bool has_bitset;
 } ecs_query_toggle_ctx_t;
@@ -2267,6 +2491,44 @@ bool flecs_query_trav(
     const ecs_query_run_ctx_t *ctx);
 
 
+/**
+ * @file query/plan_cache.h
+ * @brief Cache for queries created from expressions.
+ */
+
+#ifndef FLECS_QUERY_PLAN_CACHE_H
+#define FLECS_QUERY_PLAN_CACHE_H
+
+/* Compiled query for an expression */
+typedef struct ecs_query_plan_t {
+    ecs_query_t *query;
+    char *expr;                     /* Normalized expression */
+    ecs_size_t expr_len;
+    uint64_t hash;
+    ecs_entity_t scope;             /* Scope in which names were resolved */
+    struct ecs_query_plan_t *prev;  /* Previous (more recently used) plan */
+    struct ecs_query_plan_t *next;  /* Next (less recently used) plan */
+} ecs_query_plan_t;
+
+/* Least recently used cache of compiled expression queries */
+typedef struct ecs_query_plan_cache_t {
+    ecs_map_t index;                /* map<hash, ecs_query_plan_t*> */
+    ecs_query_plan_t *first;        /* Most recently used */
+    ecs_query_plan_t *last;         /* Least recently used */
+    int32_t count;
+} ecs_query_plan_cache_t;
+
+/* Free all cached queries */
+void flecs_query_plan_cache_fini(
+    ecs_world_t *world);
+
+/* Remove cached queries that reference a deleted entity */
+void flecs_query_plan_cache_on_delete(
+    ecs_world_t *world,
+    ecs_entity_t entity);
+
+#endif
+
 /**
  * @file query/util.h
  * @brief Utility functions
@@ -2483,6 +2745,24 @@ void flecs_notify_on_set_ids(
  */
 
 
+/* Cached path of named entity, created with the default separator. */
+typedef struct ecs_path_cache_elem_t {
+    char *path;
+    ecs_size_t length;
+    uint64_t hash;
+} ecs_path_cache_elem_t;
+
+/* Cache with paths of named entities, enabled with ecs_enable_path_cache(). If
+ * an entity is in the cache, its parents are also in the cache. */
+typedef struct ecs_path_cache_t {
+    ecs_map_t paths;                /* map<entity, ecs_path_cache_elem_t> */
+    ecs_hashmap_t lookup;           /* map<path, entity> */
+} ecs_path_cache_t;
+
+/* Free cached paths. */
+void flecs_path_cache_fini(
+    ecs_world_t *world);
+
 /* Called during bootstrap to register entity name logic with world. */
 void flecs_bootstrap_entity_name(
     ecs_world_t *world);
@@ -2569,6 +2849,34 @@ typedef struct ecs_cmd_t {
     ecs_entity_t system;             /* System that enqueued the command */
 } ecs_cmd_t;
 
+/* Command in the thread safe command queue. The value storage of a slot is
+ * kept when the command is drained, so it can be reused by the next command
+ * that is enqueued in the slot. */
+typedef struct ecs_async_cmd_t {
+    int32_t seq;                     /* Even if slot is free, odd if written */
+    ecs_cmd_kind_t kind;             /* Command kind */
+    ecs_entity_t entity;             /* Entity id */
+    ecs_id_t id;                     /* (Component) id, or event */
+    void *value;                     /* Component value, or event ids */
+    ecs_size_t size;                 /* Size of value */
+    ecs_size_t capacity;             /* Size of value storage */
+} ecs_async_cmd_t;
+
+/* Lock free multi producer, single consumer command queue. Any thread can
+ * enqueue commands, which are drained by the thread that merges the world. 
+ * When the ring buffer is full, commands are appended to an overflow queue
+ * that is protected by a mutex, so producers never have to wait. */
+typedef struct ecs_async_queue_t {
+    ecs_async_cmd_t *slots;          /* Ring buffer with FLECS_ASYNC_QUEUE_SIZE slots */
+    int32_t tail;                    /* Next slot to claim by producers */
+    int32_t head;                    /* Next slot to drain by consumer */
+    int32_t count;                   /* Number of reserved ring buffer slots */
+    int32_t fence;                   /* Used for memory barriers */
+    ecs_vec_t overflow;              /* vector<ecs_async_cmd_t> */
+    int32_t overflow_count;          /* Number of commands in overflow queue */
+    ecs_os_mutex_t lock;             /* Protects overflow queue */
+} ecs_async_queue_t;
+
 /** Callback used to capture commands of a frame */
 typedef void (*ecs_on_commands_action_t)(
     const ecs_stage_t *stage,
@@ -2585,6 +2893,19 @@ void flecs_commands_fini(
     ecs_stage_t *stage,
     ecs_commands_t *cmd);
 
+/* Initialize thread safe command queue. */
+void flecs_async_queue_init(
+    ecs_async_queue_t *queue);
+
+/* Free thread safe command queue, discards commands that weren't drained. */
+void flecs_async_queue_fini(
+    ecs_async_queue_t *queue);
+
+/* Move commands from thread safe command queue to the queue of stage 0. Must be
+ * called from the thread that merges the world. */
+void flecs_async_queue_drain(
+    ecs_world_t *world);
+
 /* Begin deferring, or return whether already deferred. */
 bool flecs_defer_cmd(
     ecs_stage_t *stage);
@@ -2829,6 +3150,10 @@ void flecs_on_delete(
     ecs_entity_t action,
     bool delete_id);
 
+/* Free entities queued by ecs_delete_incremental() without deleting them */
+void flecs_delete_queue_fini(
+    ecs_world_t *world);
+
 /* Remove non-fragmenting components from entity */
 void flecs_entity_remove_non_fragmenting(
     ecs_world_t *world,
@@ -2847,16 +3172,33 @@ void flecs_entity_remove_non_fragmenting(
 
 typedef struct ecs_instantiate_ctx_t {
     ecs_entity_t root_prefab;
-    ecs_entity_t root_instance;
+    const ecs_entity_t *root_instances; /* Root instance for each instance */
 } ecs_instantiate_ctx_t;
 
-/* Instantiate prefab for entity. Called when adding (IsA, prefab). */
+/* Cached plan for instantiating the entities of a prefab child table. Plans are
+ * stored on the prefab child table, and are rebuilt when the OnInstantiate
+ * traits of components change. */
+typedef struct ecs_instantiate_plan_t {
+    ecs_type_t type;             /* Type of instance child table */
+    int16_t *columns;            /* Column in prefab child table, or -1 */
+    int32_t childof_index;       /* Index of (ChildOf, instance) in type */
+    ecs_entity_t slot_of;        /* Prefab for which children are slots */
+    int32_t generation;          /* World instantiate plan generation */
+} ecs_instantiate_plan_t;
+
+/* Instantiate prefab for entities. Called when adding (IsA, prefab). */
 void flecs_instantiate(
     ecs_world_t *world,
     ecs_entity_t base,
-    ecs_entity_t instance,
+    const ecs_entity_t *instances,
+    int32_t count,
     const ecs_instantiate_ctx_t *ctx);
 
+/* Free cached instantiate plans of table. */
+void flecs_instantiate_plans_fini(
+    ecs_world_t *world,
+    ecs_table_t *table);
+
 #endif
 
 /**
@@ -2886,6 +3228,17 @@ typedef struct ecs_event_id_record_t {
     int32_t observer_count;
 } ecs_event_id_record_t;
 
+/* Existing matches of an observer that are yielded incrementally. Entities
+ * are yielded in the order in which they were recorded. The pending map
+ * contains the recorded entities that haven't been yielded yet, which is used
+ * to yield an entity before an event for it is delivered to the observer. */
+typedef struct ecs_observer_yield_t {
+    ecs_vec_t entities;              /* vector<ecs_entity_t> */
+    ecs_map_t pending;               /* map<entity, 0> */
+    int32_t cursor;                  /* Next element in entities to yield */
+    double time_budget;              /* Max time spent per frame (seconds) */
+} ecs_observer_yield_t;
+
 typedef struct ecs_observer_impl_t {
     ecs_observer_t pub;
 
@@ -2903,6 +3256,8 @@ typedef struct ecs_observer_impl_t {
     ecs_query_t *not_query;     /**< Query used to populate observer data when a
                                      term with a not operator triggers. */
 
+    ecs_observer_yield_t *yield; /**< Existing matches that are not yet yielded */
+
     /* Mixins */
     flecs_poly_dtor_t dtor;
 } ecs_observer_impl_t;
@@ -2959,6 +3314,11 @@ ecs_observer_t* flecs_observer_init(
 void flecs_observer_fini(
     ecs_observer_t *observer);
 
+/* Yield existing matches of incremental observers within their time budget
+ * (called at the end of each frame). */
+void flecs_observers_yield_frame(
+    ecs_world_t *world);
+
 /* Emit event. */
 void flecs_emit( 
     ecs_world_t *world,
@@ -3323,6 +3683,13 @@ typedef struct ecs_store_t {
     /* Records cache */
     ecs_vec_t records;
 
+    /* Cache for hi edge lookups */
+    ecs_graph_edge_cache_t edge_cache;
+
+    /* Table GC configuration, and dense index of next table to visit */
+    ecs_table_gc_desc_t table_gc;
+    int32_t table_gc_cursor;
+
     /* Stack of ids being deleted during cleanup action. */
     ecs_vec_t marked_ids;            /* vector<ecs_marked_id_t> */
 
@@ -3332,13 +3699,44 @@ typedef struct ecs_store_t {
     ecs_vec_t deleted_components;    /* vector<ecs_entity_t> */
 } ecs_store_t;
 
+/* Entity queued with ecs_delete_incremental() */
+typedef struct ecs_delete_queue_elem_t {
+    ecs_entity_t entity;
+    bool expanded;                   /* Were children added to the queue */
+} ecs_delete_queue_elem_t;
+
+/* Entities that are deleted incrementally. Subtrees are walked depth first so
+ * that children are deleted before their parent, which means that deleting an
+ * entity never cascades to a large number of other entities. */
+typedef struct ecs_delete_queue_t {
+    ecs_vec_t stack;                 /* vector<ecs_delete_queue_elem_t> */
+    ecs_vec_t leaves;                /* vector<ecs_entity_t> without children */
+} ecs_delete_queue_t;
+
 /* fini actions */
 typedef struct ecs_action_elem_t {
     ecs_fini_action_t action;
     void *ctx;
 } ecs_action_elem_t;
 
+/* Log-linear histogram for frame times. Times below 32us have their own bucket,
+ * larger times are stored in 32 buckets per power of two. */
+#define FLECS_FRAME_HISTOGRAM_SUB_BITS (5)
+#define FLECS_FRAME_HISTOGRAM_SUB (1 << FLECS_FRAME_HISTOGRAM_SUB_BITS)
+#define FLECS_FRAME_HISTOGRAM_BUCKETS (FLECS_FRAME_HISTOGRAM_SUB * 20)
+
+/* Number of frames after which older frame times start to count less */
+#define FLECS_FRAME_HISTOGRAM_WINDOW (512)
+
+typedef struct ecs_frame_histogram_t {
+    uint32_t buckets[FLECS_FRAME_HISTOGRAM_BUCKETS]; /* Frame times in us */
+    uint32_t count;                  /* Number of frames in histogram */
+    uint64_t max;                    /* Max frame time in current window (ns) */
+    uint64_t max_prev;               /* Max frame time in previous window (ns) */
+} ecs_frame_histogram_t;
+
 typedef struct ecs_pipeline_state_t ecs_pipeline_state_t;
+typedef struct ecs_worker_job_t ecs_worker_job_t;
 
 /** The world stores and manages all ECS data. An application can have more than
  * one world, but data is not shared between worlds. */
@@ -3396,9 +3794,25 @@ struct ecs_world_t {
     ecs_hashmap_t aliases;
     ecs_hashmap_t symbols;
 
+    /* -- Queries created from expressions -- */
+    ecs_query_plan_cache_t query_plans;
+
+    /* -- Cached entity paths -- */
+    ecs_path_cache_t path_cache;
+
+    /* -- Incremental delete -- */
+    ecs_delete_queue_t delete_queue;
+
+    /* -- Observers that yield existing matches incrementally -- */
+    ecs_vec_t observer_yield_queue;  /* vector<ecs_observer_t*> */
+
+    /* -- Prefab instantiation -- */
+    int32_t instantiate_plan_generation; /* Invalidates instantiate plans */
+
     /* -- Staging -- */
     ecs_stage_t **stages;            /* Stages */
     int32_t stage_count;             /* Number of stages */
+    ecs_async_queue_t async_queue;   /* Commands enqueued from any thread */
 
     /* -- Component ids -- */
     ecs_vec_t component_ids;         /* World local component ids */
@@ -3419,6 +3833,7 @@ struct ecs_world_t {
     int32_t workers_running;         /* Number of threads running */
     int32_t workers_waiting;         /* Number of workers waiting on sync */
     ecs_pipeline_state_t* pq;        /* Pointer to the pipeline for the workers to execute */
+    ecs_worker_job_t *job;           /* If set, workers run job instead of pipeline */
     bool workers_use_task_api;       /* Workers are short-lived tasks, not long-running threads */
 
     /* -- Exclusive access */
@@ -3429,6 +3844,9 @@ struct ecs_world_t {
     ecs_time_t world_start_time;     /* Timestamp of simulation start */
     ecs_time_t frame_start_time;     /* Timestamp of frame start */
     ecs_ftime_t fps_sleep;           /* Sleep time to prevent fps overshoot */
+    uint64_t frame_deadline;         /* Deadline of last frame for precise pacing (ns) */
+    uint64_t frame_spin_time;        /* Time spun before deadline (ns) */
+    ecs_frame_histogram_t frame_histogram; /* Distribution of frame times */
 
     /* -- Metrics -- */
     ecs_world_info_t info;
@@ -3519,6 +3937,10 @@ void flecs_notify_tables(
     ecs_id_t id,
     ecs_table_event_t *event);
 
+/* Run table GC configured with ecs_set_table_gc(). */
+void flecs_table_gc_run(
+    ecs_world_t *world);
+
 /* Increase table version (used for invalidating ecs_ref_t's). */
 void flecs_increment_table_version(
     ecs_world_t *world,
@@ -3745,6 +4167,21 @@ uint64_t flecs_ito_(
 //// Utilities
 ////////////////////////////////////////////////////////////////////////////////
 
+/* Hint that memory will be read soon. */
+#if defined(__GNUC__) || defined(__clang__)
+#define flecs_prefetch(ptr) __builtin_prefetch(ptr)
+#else
+#define flecs_prefetch(ptr) (void)(ptr)
+#endif
+
+/* Index of lowest set bit in value. Value must not be 0. */
+#if defined(__GNUC__) || defined(__clang__)
+#define flecs_ctz64(value) ((int32_t)__builtin_ctzll(value))
+#else
+int32_t flecs_ctz64(
+    uint64_t value);
+#endif
+
 /* Generate 64bit hash from buffer. */
 uint64_t flecs_hash(
     const void *data,
@@ -4001,6 +4438,9 @@ void flecs_register_id_flag_for_relation(
         }
 
         if (changed) {
+            if (prop == EcsOnInstantiate) {
+                world->instantiate_plan_generation ++;
+            }
             flecs_assert_relation_unused(world, e, prop);
         }
     }
@@ -4687,6 +5127,7 @@ void flecs_bootstrap(
     flecs_bootstrap_trait(world, EcsWith);
     flecs_bootstrap_trait(world, EcsOneOf);
     flecs_bootstrap_trait(world, EcsCanToggle);
+    flecs_bootstrap_trait(world, EcsDirtyRows);
     flecs_bootstrap_trait(world, EcsTrait);
     flecs_bootstrap_trait(world, EcsRelationship);
     flecs_bootstrap_trait(world, EcsTarget);
@@ -4818,6 +5259,15 @@ void flecs_bootstrap(
         .ctx = &toggle_trait
     });
 
+    static ecs_on_trait_ctx_t dirty_rows_trait = { EcsIdDirtyRows, 0 };
+    ecs_observer(world, {
+        .query.terms = {{ .id = EcsDirtyRows }},
+        .query.flags = EcsQueryMatchPrefab|EcsQueryMatchDisabled,
+        .events = {EcsOnAdd},
+        .callback = flecs_register_trait,
+        .ctx = &dirty_rows_trait
+    });
+
     static ecs_on_trait_ctx_t with_trait = { EcsIdWith, 0 };
     ecs_observer(world, {
         .query.terms = {
@@ -5963,7 +6413,7 @@ void flecs_cmd_batch_for_entity(
              * Since those tables are new, we don't have to invoke component 
              * monitors since queries will have correctly matched them. */
             ecs_assert(r->cr != NULL, ECS_INTERNAL_ERROR, NULL);
-            if (ecs_map_count(&r->cr->cache.index)) {
+            if (flecs_table_cache_count(&r->cr->cache)) {
                 flecs_update_component_monitors(world, &added, NULL);
             }
         }
@@ -5980,6 +6430,38 @@ void flecs_cmd_batch_for_entity(
     flecs_table_diff_builder_clear(diff);
 }
 
+/* Prepare a command for flushing. If this is the first command for an entity,
+ * batch the commands for the entity to limit archetype moves. */
+static
+void flecs_cmd_flush_prepare(
+    ecs_world_t *world,
+    ecs_table_diff_builder_t *diff,
+    ecs_cmd_t *cmds,
+    int32_t i,
+    bool is_alive,
+    bool merge_to_world)
+{
+    ecs_cmd_t *cmd = &cmds[i];
+
+    /* A negative index indicates the first command for an entity */
+    if (merge_to_world && (cmd->next_for_entity < 0)) {
+        diff->added_flags = 0;
+        diff->removed_flags = 0;
+
+        /* Batch commands for entity to limit archetype moves */
+        if (is_alive) {
+            flecs_cmd_batch_for_entity(world, diff, cmd->entity, cmds, i);
+        } else {
+            world->info.cmd.discard_count ++;
+        }
+    }
+
+    /* Invalidate entry */
+    if (cmd->entry) {
+        cmd->entry->first = -1;
+    }
+}
+
 /* Leave safe section. Run all deferred commands. */
 bool flecs_defer_end(
     ecs_world_t *world,
@@ -6042,23 +6524,8 @@ bool flecs_defer_end(
                 ecs_entity_t e = cmd->entity;
                 bool is_alive = flecs_entities_is_alive(world, e);
 
-                /* A negative index indicates the first command for an entity */
-                if (merge_to_world && (cmd->next_for_entity < 0)) {
-                    diff.added_flags = 0;
-                    diff.removed_flags = 0;
-
-                    /* Batch commands for entity to limit archetype moves */
-                    if (is_alive) {
-                        flecs_cmd_batch_for_entity(world, &diff, e, cmds, i);
-                    } else {
-                        world->info.cmd.discard_count ++;
-                    }
-                }
-
-                /* Invalidate entry */
-                if (cmd->entry) {
-                    cmd->entry->first = -1;
-                }
+                flecs_cmd_flush_prepare(
+                    world, &diff, cmds, i, is_alive, merge_to_world);
 
                 /* If entity is no longer alive, this could be because the queue
                  * contained both a delete and a subsequent add/remove/set which
@@ -6137,8 +6604,47 @@ bool flecs_defer_end(
                     world->info.cmd.set_count ++;
                     break;
                 case EcsCmdDelete: {
-                    ecs_delete(world, e);
-                    world->info.cmd.delete_count ++;
+                    /* Delete consecutive delete commands in a single batch, so
+                     * that rows are removed per table */
+                    int32_t last = i + 1;
+                    while (last < count && cmds[last].kind == EcsCmdDelete) {
+                        last ++;
+                    }
+
+                    if (last - i == 1) {
+                        ecs_delete(world, e);
+                        world->info.cmd.delete_count ++;
+                        break;
+                    }
+
+                    ecs_allocator_t *a = &world->allocator;
+                    ecs_vec_t batch;
+                    ecs_vec_init_t(a, &batch, ecs_entity_t, last - i);
+                    int32_t first = i;
+                    for (; i < last; i ++) {
+                        ecs_entity_t de = cmds[i].entity;
+                        bool de_alive = flecs_entities_is_alive(world, de);
+                        if (i != first) {
+                            /* Commands consumed by the batch must still
+                             * invalidate their entry and flush the other 
+                             * commands for their entity. */
+                            flecs_cmd_flush_prepare(
+                                world, &diff, cmds, i, de_alive, merge_to_world);
+                            de_alive = flecs_entities_is_alive(world, de);
+                        }
+
+                        if (de_alive) {
+                            ecs_vec_append_t(a, &batch, ecs_entity_t)[0] = de;
+                        } else {
+                            world->info.cmd.discard_count ++;
+                        }
+                    }
+                    i --;
+
+                    int32_t batch_count = ecs_vec_count(&batch);
+                    ecs_delete_many(world, batch_count, ecs_vec_first(&batch));
+                    world->info.cmd.delete_count += batch_count;
+                    ecs_vec_fini_t(a, &batch, ecs_entity_t);
                     break;
                 }
                 case EcsCmdClear:
@@ -6320,6 +6826,365 @@ error:
     return;
 }
 
+static
+int32_t flecs_async_load(
+    const int32_t *ptr)
+{
+    return *(const volatile int32_t*)ptr;
+}
+
+static
+int32_t flecs_async_lap_seq(
+    uint32_t pos)
+{
+    return (int32_t)((pos / FLECS_ASYNC_QUEUE_SIZE) * 2);
+}
+
+void flecs_async_queue_init(
+    ecs_async_queue_t *queue)
+{
+    ecs_assert(!(FLECS_ASYNC_QUEUE_SIZE & (FLECS_ASYNC_QUEUE_SIZE - 1)),
+        ECS_INVALID_PARAMETER, "FLECS_ASYNC_QUEUE_SIZE must be a power of 2");
+    queue->slots = ecs_os_calloc_n(ecs_async_cmd_t, FLECS_ASYNC_QUEUE_SIZE);
+    queue->tail = 0;
+    queue->head = 0;
+    queue->count = 0;
+    queue->fence = 0;
+    ecs_vec_init_t(NULL, &queue->overflow, ecs_async_cmd_t, 0);
+    queue->overflow_count = 0;
+    queue->lock = 0;
+    if (ecs_os_has_threading()) {
+        queue->lock = ecs_os_mutex_new();
+    }
+}
+
+static
+void flecs_async_overflow_fini(
+    ecs_vec_t *overflow)
+{
+    int32_t i, count = ecs_vec_count(overflow);
+    ecs_async_cmd_t *cmds = ecs_vec_first(overflow);
+    for (i = 0; i < count; i ++) {
+        ecs_os_free(cmds[i].value);
+    }
+    ecs_vec_fini_t(NULL, overflow, ecs_async_cmd_t);
+}
+
+void flecs_async_queue_fini(
+    ecs_async_queue_t *queue)
+{
+    int32_t i;
+    for (i = 0; i < FLECS_ASYNC_QUEUE_SIZE; i ++) {
+        ecs_os_free(queue->slots[i].value);
+    }
+    ecs_os_free(queue->slots);
+    queue->slots = NULL;
+
+    flecs_async_overflow_fini(&queue->overflow);
+    if (queue->lock) {
+        ecs_os_mutex_free(queue->lock);
+        queue->lock = 0;
+    }
+}
+
+static
+void flecs_async_cmd_write(
+    ecs_async_cmd_t *cmd,
+    ecs_cmd_kind_t kind,
+    ecs_entity_t entity,
+    ecs_id_t id,
+    ecs_size_t size,
+    const void *value)
+{
+    if (cmd->capacity < size) {
+        cmd->value = ecs_os_realloc(cmd->value, size);
+        cmd->capacity = size;
+    }
+
+    cmd->kind = kind;
+    cmd->entity = entity;
+    cmd->id = id;
+    cmd->size = size;
+    if (size) {
+        ecs_os_memcpy(cmd->value, value, size);
+    }
+}
+
+/* Try to enqueue command in the ring buffer. Returns false if the ring buffer
+ * is full, or if there are commands in the overflow queue. In the latter case
+ * the command must also go to the overflow queue, so that commands from the
+ * same thread are drained in the order in which they were enqueued. */
+static
+bool flecs_async_ring_push(
+    ecs_async_queue_t *queue,
+    ecs_cmd_kind_t kind,
+    ecs_entity_t entity,
+    ecs_id_t id,
+    ecs_size_t size,
+    const void *value)
+{
+    if (flecs_async_load(&queue->overflow_count)) {
+        return false;
+    }
+
+    /* Reserve a slot. Slots are only released after they are drained, so if
+     * no more than FLECS_ASYNC_QUEUE_SIZE slots are reserved, the slot that 
+     * is claimed next is guaranteed to no longer be used by the previous lap. */
+    if (ecs_os_ainc(&queue->count) > FLECS_ASYNC_QUEUE_SIZE) {
+        ecs_os_adec(&queue->count);
+        return false;
+    }
+
+    uint32_t pos = (uint32_t)(ecs_os_ainc(&queue->tail) - 1);
+    ecs_async_cmd_t *cmd = &queue->slots[pos & (FLECS_ASYNC_QUEUE_SIZE - 1)];
+    ecs_assert(flecs_async_load(&cmd->seq) == flecs_async_lap_seq(pos),
+        ECS_INTERNAL_ERROR, NULL);
+
+    flecs_async_cmd_write(cmd, kind, entity, id, size, value);
+
+    /* Publish command. The atomic increment also acts as a full memory barrier,
+     * so command data is visible to the consumer when it observes seq. */
+    ecs_os_ainc(&cmd->seq);
+    return true;
+}
+
+static
+void flecs_async_cmd(
+    ecs_world_t *world,
+    ecs_cmd_kind_t kind,
+    ecs_entity_t entity,
+    ecs_id_t id,
+    ecs_size_t size,
+    const void *value)
+{
+    ecs_async_queue_t *queue = &world->async_queue;
+    if (flecs_async_ring_push(queue, kind, entity, id, size, value)) {
+        return;
+    }
+
+    /* Ring buffer is full, grow the overflow queue */
+    if (queue->lock) {
+        ecs_os_mutex_lock(queue->lock);
+    }
+
+    ecs_async_cmd_t *cmd = ecs_vec_append_t(
+        NULL, &queue->overflow, ecs_async_cmd_t);
+    ecs_os_zeromem(cmd);
+    flecs_async_cmd_write(cmd, kind, entity, id, size, value);
+    ecs_os_ainc(&queue->overflow_count);
+
+    if (queue->lock) {
+        ecs_os_mutex_unlock(queue->lock);
+    }
+}
+
+static
+void flecs_async_cmd_flush(
+    ecs_world_t *world,
+    ecs_world_t *stage,
+    ecs_async_cmd_t *cmd)
+{
+    ecs_entity_t e = cmd->entity;
+
+    switch(cmd->kind) {
+    case EcsCmdAdd:
+        if (ecs_is_alive(world, e)) {
+            ecs_add_id(stage, e, cmd->id);
+        }
+        break;
+    case EcsCmdRemove:
+        if (ecs_is_alive(world, e)) {
+            ecs_remove_id(stage, e, cmd->id);
+        }
+        break;
+    case EcsCmdSet:
+        if (ecs_is_alive(world, e)) {
+            ecs_set_id(stage, e, cmd->id, 
+                flecs_ito(size_t, cmd->size), cmd->value);
+        }
+        break;
+    case EcsCmdDelete:
+        ecs_delete(stage, e);
+        break;
+    case EcsCmdEvent: {
+        ecs_type_t ids = {
+            .array = cmd->value,
+            .count = cmd->size / ECS_SIZEOF(ecs_id_t)
+        };
+        ecs_enqueue(stage, &(ecs_event_desc_t){
+            .event = cmd->id,
+            .ids = ids.count ? &ids : NULL,
+            .entity = e
+        });
+        break;
+    }
+    case EcsCmdNew:
+    case EcsCmdClone:
+    case EcsCmdBulkNew:
+    case EcsCmdEmplace:
+    case EcsCmdEnsure:
+    case EcsCmdModified:
+    case EcsCmdModifiedNoHook:
+    case EcsCmdAddModified:
+    case EcsCmdPath:
+    case EcsCmdClear:
+    case EcsCmdOnDeleteAction:
+    case EcsCmdEnable:
+    case EcsCmdDisable:
+    case EcsCmdSkip:
+    default:
+        ecs_abort(ECS_INTERNAL_ERROR, NULL);
+    }
+}
+
+void flecs_async_queue_drain(
+    ecs_world_t *world)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_async_queue_t *queue = &world->async_queue;
+    ecs_stage_t *stage = world->stages[0];
+    bool deferred = false;
+
+    do {
+        uint32_t pos = (uint32_t)queue->head;
+        ecs_async_cmd_t *cmd = 
+            &queue->slots[pos & (FLECS_ASYNC_QUEUE_SIZE - 1)];
+        if (flecs_async_load(&cmd->seq) != (flecs_async_lap_seq(pos) + 1)) {
+            break;
+        }
+
+        /* Make sure command data isn't read before seq */
+        ecs_os_ainc(&queue->fence);
+
+        if (!deferred) {
+            flecs_defer_begin(world, stage);
+            deferred = true;
+        }
+
+        /* Commands are copied to the stage queue, so slot can be reused */
+        flecs_async_cmd_flush(world, (ecs_world_t*)stage, cmd);
+
+        ecs_os_ainc(&queue->fence);
+        cmd->seq = flecs_async_lap_seq(pos + FLECS_ASYNC_QUEUE_SIZE);
+        queue->head = (int32_t)(pos + 1);
+        ecs_os_adec(&queue->count);
+    } while (true);
+
+    /* Commands in the overflow queue were enqueued after the commands in the 
+     * ring buffer, so only drain them once the ring buffer is empty. */
+    if (flecs_async_load(&queue->overflow_count) && 
+        (queue->head == flecs_async_load(&queue->tail))) 
+    {
+        if (queue->lock) {
+            ecs_os_mutex_lock(queue->lock);
+        }
+
+        ecs_vec_t overflow = queue->overflow;
+        ecs_vec_init_t(NULL, &queue->overflow, ecs_async_cmd_t, 0);
+        queue->overflow_count = 0;
+
+        if (queue->lock) {
+            ecs_os_mutex_unlock(queue->lock);
+        }
+
+        if (!deferred) {
+            flecs_defer_begin(world, stage);
+            deferred = true;
+        }
+
+        int32_t i, count = ecs_vec_count(&overflow);
+        ecs_async_cmd_t *cmds = ecs_vec_first(&overflow);
+        for (i = 0; i < count; i ++) {
+            flecs_async_cmd_flush(world, (ecs_world_t*)stage, &cmds[i]);
+        }
+
+        flecs_async_overflow_fini(&overflow);
+    }
+
+    if (deferred) {
+        flecs_defer_end(world, stage);
+    }
+}
+
+void ecs_async_add_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(entity != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(id != 0, ECS_INVALID_PARAMETER, NULL);
+    world = ECS_CONST_CAST(ecs_world_t*, ecs_get_world(world));
+    flecs_async_cmd(world, EcsCmdAdd, entity, id, 0, NULL);
+error:
+    return;
+}
+
+void ecs_async_remove_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(entity != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(id != 0, ECS_INVALID_PARAMETER, NULL);
+    world = ECS_CONST_CAST(ecs_world_t*, ecs_get_world(world));
+    flecs_async_cmd(world, EcsCmdRemove, entity, id, 0, NULL);
+error:
+    return;
+}
+
+void ecs_async_set_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id,
+    size_t size,
+    const void *ptr)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(entity != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(id != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(size != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(ptr != NULL, ECS_INVALID_PARAMETER, NULL);
+    world = ECS_CONST_CAST(ecs_world_t*, ecs_get_world(world));
+    flecs_async_cmd(world, EcsCmdSet, entity, id, 
+        flecs_uto(ecs_size_t, size), ptr);
+error:
+    return;
+}
+
+void ecs_async_delete(
+    ecs_world_t *world,
+    ecs_entity_t entity)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(entity != 0, ECS_INVALID_PARAMETER, NULL);
+    world = ECS_CONST_CAST(ecs_world_t*, ecs_get_world(world));
+    flecs_async_cmd(world, EcsCmdDelete, entity, 0, 0, NULL);
+error:
+    return;
+}
+
+void ecs_async_enqueue(
+    ecs_world_t *world,
+    const ecs_event_desc_t *desc)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(desc != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(desc->event != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(desc->entity != 0, ECS_INVALID_PARAMETER, 
+        "events enqueued with ecs_async_enqueue must have an entity");
+    ecs_check(!desc->param && !desc->const_param, ECS_INVALID_PARAMETER,
+        "events enqueued with ecs_async_enqueue cannot have a payload");
+    world = ECS_CONST_CAST(ecs_world_t*, ecs_get_world(world));
+
+    int32_t id_count = desc->ids ? desc->ids->count : 0;
+    flecs_async_cmd(world, EcsCmdEvent, desc->entity, desc->event, 
+        id_count * ECS_SIZEOF(ecs_id_t), id_count ? desc->ids->array : NULL);
+error:
+    return;
+}
+
 /**
  * @file component_actions.c
  * @brief Logic executed after adding/removing a component.
@@ -6580,8 +7445,8 @@ void flecs_union_on_add(
                 const ecs_entity_t *entities = ecs_table_entities(table);
                 for (j = 0; j < count; j ++) {
                     ecs_entity_t e = entities[row + j];
-                    flecs_switch_set(
-                        cr->sparse, (uint32_t)e, ecs_pair_second(world, id));
+                    flecs_union_set(
+                        cr, table, e, ecs_pair_second(world, id));
                 }
             }
         }
@@ -6606,7 +7471,7 @@ void flecs_union_on_remove(
                 const ecs_entity_t *entities = ecs_table_entities(table);
                 for (j = 0; j < count; j ++) {
                     ecs_entity_t e = entities[row + j];
-                    flecs_switch_reset(cr->sparse, (uint32_t)e);
+                    flecs_union_set(cr, table, e, 0);
                 }
             }
         }
@@ -6968,7 +7833,7 @@ ecs_iter_t ecs_children(
     }
 
     if (cr->flags & EcsIdOrderedChildren) {
-        ecs_vec_t *v = &cr->pair->ordered_children;
+        ecs_vec_t *v = &cr->pair->ext->ordered_children;
         it.entities = ecs_vec_first_t(v, ecs_entity_t);
         it.count = ecs_vec_count(v);
         it.next = flecs_children_next_ordered;
@@ -7867,7 +8732,7 @@ void flecs_copy_id(
         ecs_os_memcpy(dst_ptr, src_ptr, flecs_utosize(size));
     }
 
-    flecs_table_mark_dirty(world, r->table, id);
+    flecs_table_mark_dirty(world, r->table, id, ECS_RECORD_TO_ROW(r->row));
 
     ecs_table_t *table = r->table;
     ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
@@ -8608,6 +9473,67 @@ error:
     return;
 }
 
+static
+void flecs_delete_entity(
+    ecs_world_t *world,
+    ecs_stage_t *stage,
+    ecs_entity_t entity,
+    ecs_record_t *r)
+{
+    flecs_journal_begin(world, EcsJournalDelete, entity, NULL, NULL);
+
+    ecs_flags32_t row_flags = ECS_RECORD_TO_ROW_FLAGS(r->row);
+    ecs_table_t *table;
+    if (row_flags) {
+        if (world->query_plans.count && 
+            (row_flags & (EcsEntityIsId|EcsEntityIsTarget))) 
+        {
+            /* Evict cached queries that use the entity */
+            flecs_query_plan_cache_on_delete(world, entity);
+        }
+
+        if (row_flags & EcsEntityIsTarget) {
+            flecs_on_delete(world, ecs_pair(EcsFlag, entity), 0, true);
+            flecs_on_delete(world, ecs_pair(EcsWildcard, entity), 0, true);
+            r->cr = NULL;
+        }
+
+        if (row_flags & EcsEntityIsId) {
+            flecs_on_delete(world, entity, 0, true);
+            flecs_on_delete(world, ecs_pair(entity, EcsWildcard), 0, true);
+        }
+
+        if (row_flags & EcsEntityIsTraversable) {
+            flecs_table_traversable_add(r->table, -1);
+        }
+
+        /* Remove non-fragmenting components */
+        flecs_entity_remove_non_fragmenting(world, entity, r);
+
+        /* Merge operations before deleting entity */
+        flecs_defer_end(world, stage);
+        flecs_defer_begin(world, stage);
+    }
+
+    table = r->table;
+
+    if (table) { /* NULL if entity got cleaned up as result of cycle */
+        ecs_table_diff_t diff = {
+            .removed = table->type,
+            .removed_flags = table->flags & EcsTableRemoveEdgeFlags
+        };
+
+        int32_t row = ECS_RECORD_TO_ROW(r->row);
+        flecs_notify_on_remove(
+            world, table, &world->store.root, row, 1, &diff);
+        flecs_table_delete(world, table, row, true);
+    }
+    
+    flecs_entities_remove(world, entity);
+
+    flecs_journal_end();
+}
+
 void ecs_delete(
     ecs_world_t *world,
     ecs_entity_t entity)
@@ -8624,56 +9550,205 @@ void ecs_delete(
 
     ecs_record_t *r = flecs_entities_try(world, entity);
     if (r) {
-        flecs_journal_begin(world, EcsJournalDelete, entity, NULL, NULL);
+        flecs_delete_entity(world, stage, entity, r);
+    }
 
-        ecs_flags32_t row_flags = ECS_RECORD_TO_ROW_FLAGS(r->row);
-        ecs_table_t *table;
-        if (row_flags) {
-            if (row_flags & EcsEntityIsTarget) {
-                flecs_on_delete(world, ecs_pair(EcsFlag, entity), 0, true);
-                flecs_on_delete(world, ecs_pair(EcsWildcard, entity), 0, true);
-                r->cr = NULL;
-            }
+    flecs_defer_end(world, stage);
+error:
+    ecs_os_perf_trace_pop("flecs.delete");
+    return;
+}
 
-            if (row_flags & EcsEntityIsId) {
-                flecs_on_delete(world, entity, 0, true);
-                flecs_on_delete(world, ecs_pair(entity, EcsWildcard), 0, true);
-            }
+/* Rows of a single table that are deleted by ecs_delete_many() */
+typedef struct ecs_delete_table_t {
+    ecs_table_t *table;
+    uint64_t *rows;          /* Bitset with rows to delete */
+    int32_t words;           /* Size of bitset */
+    int32_t count;           /* Number of rows to delete */
+} ecs_delete_table_t;
 
-            if (row_flags & EcsEntityIsTraversable) {
-                flecs_table_traversable_add(r->table, -1);
+/* Mark rows of entities to delete in a bitset per table. Returns false if an
+ * entity must be deleted individually before the other entities. */
+static
+bool flecs_delete_many_collect(
+    ecs_world_t *world,
+    int32_t count,
+    const ecs_entity_t *entities,
+    ecs_vec_t *tables,
+    ecs_map_t *table_map)
+{
+    ecs_allocator_t *a = &world->allocator;
+    ecs_table_t *last_table = NULL;
+    int32_t i, last = -1;
+
+    for (i = 0; i < count; i ++) {
+        ecs_entity_t e = entities[i];
+        ecs_assert(e != 0, ECS_INVALID_PARAMETER, NULL);
+        ecs_record_t *r = flecs_entities_try(world, e);
+        if (!r) {
+            continue;
+        }
+
+        if (ECS_RECORD_TO_ROW_FLAGS(r->row)) {
+            return false;
+        }
+
+        ecs_table_t *table = r->table;
+        if (!table) { /* Entity got cleaned up as result of cycle */
+            flecs_entities_remove(world, e);
+            continue;
+        }
+
+        if (table != last_table) {
+            ecs_map_val_t *elem = ecs_map_ensure(table_map, table->id);
+            if (!elem[0]) {
+                ecs_delete_table_t *dt = ecs_vec_append_t(
+                    a, tables, ecs_delete_table_t);
+                dt->table = table;
+                dt->words = (ecs_table_count(table) + 63) / 64;
+                dt->rows = flecs_calloc_n(a, uint64_t, dt->words);
+                dt->count = 0;
+                elem[0] = flecs_ito(uint64_t, ecs_vec_count(tables));
             }
+            last = flecs_uto(int32_t, elem[0] - 1);
+            last_table = table;
+        }
 
-            /* Remove non-fragmenting components */
-            flecs_entity_remove_non_fragmenting(world, entity, r);
+        ecs_delete_table_t *dt = ecs_vec_get_t(tables, ecs_delete_table_t, last);
+        uint32_t row = flecs_ito(uint32_t, ECS_RECORD_TO_ROW(r->row));
+        uint64_t *word = &dt->rows[row >> 6];
+        uint64_t bit = 1llu << (row & 63);
+        if (!(word[0] & bit)) { /* Skip duplicate entities */
+            word[0] |= bit;
+            dt->count ++;
+        }
+    }
 
-            /* Merge operations before deleting entity */
-            flecs_defer_end(world, stage);
-            flecs_defer_begin(world, stage);
+    return true;
+}
+
+static
+void flecs_delete_many_clear(
+    ecs_world_t *world,
+    ecs_vec_t *tables,
+    ecs_map_t *table_map)
+{
+    ecs_allocator_t *a = &world->allocator;
+    int32_t i, count = ecs_vec_count(tables);
+    ecs_delete_table_t *dts = ecs_vec_first(tables);
+    for (i = 0; i < count; i ++) {
+        flecs_free_n(a, uint64_t, dts[i].words, dts[i].rows);
+    }
+    ecs_vec_clear(tables);
+    ecs_map_clear(table_map);
+}
+
+/* Delete rows of a single table. The rows are moved to the end of the table,
+ * after which OnRemove is emitted for the entire range, and the table is 
+ * truncated. */
+static
+void flecs_delete_table_rows(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    const int32_t *rows,
+    int32_t count)
+{
+    flecs_table_move_to_end(world, table, rows, count);
+
+    ecs_table_diff_t diff = {
+        .removed = table->type,
+        .removed_flags = table->flags & EcsTableRemoveEdgeFlags
+    };
+
+    int32_t row = ecs_table_count(table) - count;
+    flecs_notify_on_remove(
+        world, table, &world->store.root, row, count, &diff);
+    flecs_table_delete_last(world, table, count);
+}
+
+void ecs_delete_many(
+    ecs_world_t *world,
+    int32_t count,
+    const ecs_entity_t *entities)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(count >= 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!count || entities != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_stage_t *stage = flecs_stage_from_world(&world);
+    int32_t i;
+
+    if (flecs_defer_cmd(stage)) {
+        for (i = 0; i < count; i ++) {
+            ecs_check(entities[i] != 0, ECS_INVALID_PARAMETER, NULL);
+            flecs_defer_delete(stage, entities[i]);
         }
+        return;
+    }
 
-        table = r->table;
+    ecs_os_perf_trace_push("flecs.delete_many");
 
-        if (table) { /* NULL if entity got cleaned up as result of cycle */
-            ecs_table_diff_t diff = {
-                .removed = table->type,
-                .removed_flags = table->flags & EcsTableRemoveEdgeFlags
-            };
+    ecs_allocator_t *a = &world->allocator;
+    ecs_vec_t tables;
+    ecs_map_t table_map;
+    ecs_vec_init_t(a, &tables, ecs_delete_table_t, 0);
+    ecs_map_init(&table_map, a);
 
-            int32_t row = ECS_RECORD_TO_ROW(r->row);
-            flecs_notify_on_remove(
-                world, table, &world->store.root, row, 1, &diff);
-            flecs_table_delete(world, table, row, true);
+    if (!flecs_delete_many_collect(
+        world, count, entities, &tables, &table_map)) 
+    {
+        /* Entities that are used in ids or are observed can cause other 
+         * entities to be deleted, or to move to a different row. Delete them
+         * first, one at a time, and then collect the remaining entities. */
+        for (i = 0; i < count; i ++) {
+            ecs_entity_t e = entities[i];
+            ecs_record_t *r = flecs_entities_try(world, e);
+            if (r && ECS_RECORD_TO_ROW_FLAGS(r->row)) {
+                flecs_delete_entity(world, stage, e, r);
+            }
         }
-        
-        flecs_entities_remove(world, entity);
 
-        flecs_journal_end();
+        flecs_delete_many_clear(world, &tables, &table_map);
+        bool collected = flecs_delete_many_collect(
+            world, count, entities, &tables, &table_map);
+        ecs_assert(collected, ECS_INTERNAL_ERROR, NULL);
+        (void)collected;
     }
 
+    /* Reuse storage for the row numbers of each table */
+    ecs_vec_t rows;
+    ecs_vec_init_t(a, &rows, int32_t, 0);
+
+    int32_t t, table_count = ecs_vec_count(&tables);
+    ecs_delete_table_t *dts = ecs_vec_first(&tables);
+    for (t = 0; t < table_count; t ++) {
+        ecs_delete_table_t *dt = &dts[t];
+        int32_t w, words = dt->words;
+
+        ecs_vec_set_count_t(a, &rows, int32_t, dt->count);
+        int32_t *row_array = ecs_vec_first(&rows), row_count = 0;
+        for (w = 0; w < words; w ++) {
+            uint64_t word = dt->rows[w];
+            int32_t b;
+            for (b = 0; word; b ++, word >>= 1) {
+                if (word & 1) {
+                    row_array[row_count ++] = (w << 6) + b;
+                }
+            }
+        }
+
+        ecs_assert(row_count == dt->count, ECS_INTERNAL_ERROR, NULL);
+        flecs_delete_table_rows(world, dt->table, row_array, row_count);
+    }
+
+    ecs_vec_fini_t(a, &rows, int32_t);
+    flecs_delete_many_clear(world, &tables, &table_map);
+    ecs_vec_fini_t(a, &tables, ecs_delete_table_t);
+    ecs_map_fini(&table_map);
+
     flecs_defer_end(world, stage);
+    ecs_os_perf_trace_pop("flecs.delete_many");
 error:
-    ecs_os_perf_trace_pop("flecs.delete");
     return;
 }
 
@@ -8878,6 +9953,96 @@ error:
     return NULL;
 }
 
+/* Number of entities to look ahead when prefetching records */
+#define FLECS_GET_MANY_PREFETCH (16)
+
+/* Number of records resolved before looking up component pointers */
+#define FLECS_GET_MANY_CHUNK (256)
+
+void ecs_get_many_id(
+    const ecs_world_t *world,
+    int32_t count,
+    const ecs_entity_t *entities,
+    ecs_id_t id,
+    const void **out)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(count >= 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!count || entities != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!count || out != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    world = ecs_get_world(world);
+
+    int32_t i;
+    ecs_component_record_t *cr = flecs_components_get(world, id);
+    if (!cr || (cr->flags & (EcsIdIsSparse|EcsIdDontFragment))) {
+        /* Component isn't stored in table columns */
+        for (i = 0; i < count; i ++) {
+            out[i] = ecs_get_id(world, entities[i], id);
+        }
+        return;
+    }
+
+    ecs_table_t *last_table = NULL;
+    const void *column = NULL, *shared = NULL;
+    ecs_size_t size = 0;
+
+    int32_t chunk;
+    for (chunk = 0; chunk < count; chunk += FLECS_GET_MANY_CHUNK) {
+        int32_t end = ECS_MIN(chunk + FLECS_GET_MANY_CHUNK, count);
+
+        /* Resolve records first, while prefetching the records of entities
+         * that are looked up next. This hides most of the latency of the 
+         * entity index for entities that are not in the cache. The output 
+         * array is used as temporary storage for the records. */
+        for (i = chunk; i < end; i ++) {
+            if ((i + FLECS_GET_MANY_PREFETCH) < count) {
+                flecs_entities_prefetch(world, 
+                    entities[i + FLECS_GET_MANY_PREFETCH]);
+            }
+
+            ecs_check(ecs_is_alive(world, entities[i]), 
+                ECS_INVALID_PARAMETER, NULL);
+            ecs_record_t *r = flecs_entities_get(world, entities[i]);
+            flecs_prefetch(r->table);
+            out[i] = r;
+        }
+
+        /* Resolve component pointers. Entities in a batch often share a 
+         * table, so only look up the column when the table changes. */
+        for (i = chunk; i < end; i ++) {
+            const ecs_record_t *r = out[i];
+            ecs_table_t *table = r->table;
+            ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
+
+            if (table != last_table) {
+                const ecs_table_record_t *tr = flecs_component_get_table(
+                    cr, table);
+                column = shared = NULL;
+                if (tr) {
+                    ecs_check(tr->column != -1, ECS_NOT_A_COMPONENT, NULL);
+                    ecs_column_t *c = &table->data.columns[tr->column];
+                    column = c->data;
+                    size = c->ti->size;
+                } else {
+                    /* Same base component for all entities in table */
+                    shared = flecs_get_base_component(
+                        world, table, id, cr, 0);
+                }
+                last_table = table;
+            }
+
+            if (column) {
+                out[i] = ECS_ELEM(column, size, ECS_RECORD_TO_ROW(r->row));
+            } else {
+                out[i] = shared;
+            }
+        }
+    }
+error:
+    return;
+}
+
 void* ecs_get_mut_id(
     const ecs_world_t *world,
     ecs_entity_t entity,
@@ -9166,7 +10331,7 @@ void flecs_modified_id_if(
     flecs_notify_on_set(
         world, table, ECS_RECORD_TO_ROW(r->row), id, invoke_hook);
 
-    flecs_table_mark_dirty(world, table, id);
+    flecs_table_mark_dirty(world, table, id, ECS_RECORD_TO_ROW(r->row));
     flecs_defer_end(world, stage);
 error:
     return;
@@ -9197,7 +10362,7 @@ void ecs_modified_id(
     ecs_table_t *table = r->table;
     flecs_notify_on_set(world, table, ECS_RECORD_TO_ROW(r->row), id, true);
 
-    flecs_table_mark_dirty(world, table, id);
+    flecs_table_mark_dirty(world, table, id, ECS_RECORD_TO_ROW(r->row));
     flecs_defer_end(world, stage);
 error:
     return;
@@ -9260,7 +10425,7 @@ void flecs_set_id_move(
         ecs_os_memcpy(dst.ptr, ptr, flecs_utosize(size));
     }
 
-    flecs_table_mark_dirty(world, r->table, id);
+    flecs_table_mark_dirty(world, r->table, id, ECS_RECORD_TO_ROW(r->row));
 
     if (cmd_kind == EcsCmdSet) {
         ecs_table_t *table = r->table;
@@ -10351,6 +11516,168 @@ ecs_entity_t flecs_get_parent_from_path(
     return parent;
 }
 
+/* Path cache */
+
+static
+void flecs_path_cache_invalidate(
+    ecs_world_t *world,
+    ecs_entity_t e)
+{
+    ecs_path_cache_t *cache = &world->path_cache;
+    ecs_path_cache_elem_t *elem = ecs_map_get_deref(
+        &cache->paths, ecs_path_cache_elem_t, e);
+    if (!elem) {
+        /* If an entity isn't cached, its children aren't cached either */
+        return;
+    }
+
+    flecs_name_index_remove(&cache->lookup, e, elem->hash);
+    ecs_os_free(elem->path);
+    ecs_map_remove_free(&cache->paths, e);
+
+    /* Paths of children contain the path of the entity */
+    ecs_component_record_t *cr = flecs_components_get(world, ecs_childof(e));
+    if (!cr) {
+        return;
+    }
+
+    ecs_table_cache_iter_t it;
+    if (flecs_table_cache_iter(&cr->cache, &it)) {
+        const ecs_table_record_t *tr;
+        while ((tr = flecs_table_cache_next(&it, ecs_table_record_t))) {
+            ecs_table_t *table = tr->hdr.table;
+            if (!(table->flags & EcsTableHasName)) {
+                continue;
+            }
+
+            const ecs_entity_t *entities = ecs_table_entities(table);
+            int32_t i, count = ecs_table_count(table);
+            for (i = 0; i < count; i ++) {
+                flecs_path_cache_invalidate(world, entities[i]);
+            }
+        }
+    }
+}
+
+static
+void flecs_path_cache_invalidate_table(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t offset,
+    int32_t count)
+{
+    if (!(world->flags & EcsWorldPathCache)) {
+        return;
+    }
+
+    const ecs_entity_t *entities = ecs_table_entities(table);
+    int32_t i;
+    for (i = offset; i < (offset + count); i ++) {
+        flecs_path_cache_invalidate(world, entities[i]);
+    }
+}
+
+/* Get cached path for entity. If the path isn't cached yet, add it and the
+ * paths of the parents of the entity to the cache. */
+static
+ecs_path_cache_elem_t* flecs_path_cache_ensure(
+    ecs_world_t *world,
+    ecs_entity_t e)
+{
+    ecs_path_cache_t *cache = &world->path_cache;
+    ecs_path_cache_elem_t *elem = ecs_map_get_deref(
+        &cache->paths, ecs_path_cache_elem_t, e);
+    if (elem) {
+        return elem;
+    }
+
+    if (world->flags & EcsWorldMultiThreaded) {
+        return NULL;
+    }
+
+    ecs_record_t *r = flecs_entities_get(world, e);
+    if (!r || !r->table || !(r->table->flags & EcsTableHasName)) {
+        return NULL;
+    }
+
+    const EcsIdentifier *name = ecs_get_pair(
+        world, e, EcsIdentifier, EcsName);
+    if (!name || !name->value) {
+        return NULL;
+    }
+
+    ecs_path_cache_elem_t *parent_elem = NULL;
+    ecs_entity_t parent = ecs_get_target(world, e, EcsChildOf, 0);
+    if (parent) {
+        /* Paths of entities in flecs.core don't start from the root */
+        if (parent == EcsFlecsCore) {
+            return NULL;
+        }
+
+        parent_elem = flecs_path_cache_ensure(world, parent);
+        if (!parent_elem) {
+            return NULL;
+        }
+    }
+
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    if (parent_elem) {
+        ecs_strbuf_appendstrn(&buf, parent_elem->path, parent_elem->length);
+        ecs_strbuf_appendch(&buf, '.');
+    }
+
+    if (strchr(name->value, '.')) {
+        const char *ptr;
+        for (ptr = name->value; ptr[0]; ptr ++) {
+            if (ptr[0] == '.') {
+                ecs_strbuf_appendch(&buf, '\\');
+            }
+            ecs_strbuf_appendch(&buf, ptr[0]);
+        }
+    } else {
+        ecs_strbuf_appendstrn(&buf, name->value, name->length);
+    }
+
+    ecs_size_t length = ecs_strbuf_written(&buf);
+    char *path = ecs_strbuf_get(&buf);
+    uint64_t hash = flecs_hash(path, length);
+
+    ecs_entity_t existing = flecs_name_index_find(
+        &cache->lookup, path, length, hash);
+    if (existing) {
+        /* Entities can't have the same path, so existing entry is stale */
+        flecs_path_cache_invalidate(world, existing);
+    }
+
+    elem = ecs_map_insert_alloc_t(&cache->paths, ecs_path_cache_elem_t, e);
+    elem->path = path;
+    elem->length = length;
+    elem->hash = hash;
+    flecs_name_index_ensure(&cache->lookup, e, path, length, hash);
+
+    return elem;
+}
+
+void flecs_path_cache_fini(
+    ecs_world_t *world)
+{
+    if (!(world->flags & EcsWorldPathCache)) {
+        return;
+    }
+
+    ecs_path_cache_t *cache = &world->path_cache;
+    ecs_map_iter_t it = ecs_map_iter(&cache->paths);
+    while (ecs_map_next(&it)) {
+        ecs_path_cache_elem_t *elem = ecs_map_ptr(&it);
+        ecs_os_free(elem->path);
+        ecs_os_free(elem);
+    }
+
+    ecs_map_fini(&cache->paths);
+    flecs_name_index_fini(&cache->lookup);
+    world->flags &= ~EcsWorldPathCache;
+}
+
 static
 void flecs_on_set_symbol(
     ecs_iter_t *it) 
@@ -10433,6 +11760,10 @@ void ecs_on_set(EcsIdentifier)(
             cur->index = NULL;
         }
 
+        if ((kind == EcsName) && (world->flags & EcsWorldPathCache)) {
+            flecs_path_cache_invalidate(world, it->entities[i]);
+        }
+
         if (index) {
             uint64_t index_hash = cur->index_hash;
             ecs_entity_t e = it->entities[i];
@@ -10508,6 +11839,8 @@ void flecs_reparent_name_index(
         src = &world->store.root;
     }
 
+    flecs_path_cache_invalidate_table(world, dst, offset, count);
+
     ecs_pair_record_t *src_pair = src->_->childof_r;
     ecs_pair_record_t *dst_pair = dst->_->childof_r;
 
@@ -10543,6 +11876,8 @@ void flecs_unparent_name_index(
         return;
     }
 
+    flecs_path_cache_invalidate_table(world, src, offset, count);
+
     ecs_assert(src->_->childof_r != NULL, ECS_INTERNAL_ERROR, NULL);
     ecs_hashmap_t *src_index = src->_->childof_r->name_index;
 
@@ -10588,6 +11923,29 @@ void ecs_get_path_w_sep_buf(
         sep = ".";
     }
 
+    if ((world->flags & EcsWorldPathCache) && !parent && !prefix && 
+        sep[0] == '.' && !sep[1] && child && ecs_is_alive(world, child)) 
+    {
+        ecs_path_cache_elem_t *elem = flecs_path_cache_ensure(
+            ECS_CONST_CAST(ecs_world_t*, world), child);
+        if (elem) {
+            if (!escape) {
+                ecs_strbuf_appendstrn(buf, elem->path, elem->length);
+            } else {
+                const char *ptr;
+                for (ptr = elem->path; ptr[0]; ptr ++) {
+                    char esc[3];
+                    flecs_chresc(esc, ptr[0], '\"');
+                    ecs_strbuf_appendch(buf, esc[0]);
+                    if (esc[1]) {
+                        ecs_strbuf_appendch(buf, esc[1]);
+                    }
+                }
+            }
+            return;
+        }
+    }
+
     if (!child || parent != child) {
         flecs_path_append(world, parent, child, sep, prefix, buf, escape);
     } else {
@@ -10740,6 +12098,15 @@ ecs_entity_t ecs_lookup_path_w_sep(
         return ecs_lookup_child(world, parent, path);
     }
 
+    bool path_cache = (world->flags & EcsWorldPathCache) && 
+        sep[0] == '.' && !sep[1];
+    if (path_cache && !parent) {
+        e = flecs_name_index_find(&world->path_cache.lookup, path, 0, 0);
+        if (e) {
+            return e;
+        }
+    }
+
 retry:
     cur = parent;
     ptr = path;
@@ -10775,11 +12142,34 @@ tail:
         ecs_os_free(elem);
     }
 
+    if (cur && path_cache) {
+        /* Add path to cache, so the next lookup is a single hash lookup */
+        flecs_path_cache_ensure(ECS_CONST_CAST(ecs_world_t*, world), cur);
+    }
+
     return cur;
 error:
     return 0;
 }
 
+void ecs_enable_path_cache(
+    ecs_world_t *world,
+    bool enable)
+{
+    flecs_poly_assert(world, ecs_world_t);
+
+    if (!enable) {
+        flecs_path_cache_fini(world);
+        return;
+    }
+
+    if (!(world->flags & EcsWorldPathCache)) {
+        ecs_map_init(&world->path_cache.paths, &world->allocator);
+        flecs_name_index_init(&world->path_cache.lookup, &world->allocator);
+        world->flags |= EcsWorldPathCache;
+    }
+}
+
 ecs_entity_t ecs_set_scope(
     ecs_world_t *world,
     ecs_entity_t scope)
@@ -11526,7 +12916,7 @@ error:
 static
 int32_t flecs_child_type_insert(
     ecs_type_t *type,
-    void **component_data,
+    int16_t *columns,
     ecs_id_t id)
 {
     int32_t i, count = type->count;
@@ -11548,11 +12938,11 @@ int32_t flecs_child_type_insert(
     if (to_move) {
         ecs_os_memmove(&type->array[i + 1],
             &type->array[i], to_move * ECS_SIZEOF(ecs_id_t));
-        ecs_os_memmove(&component_data[i + 1],
-            &component_data[i], to_move * ECS_SIZEOF(void*));
+        ecs_os_memmove(&columns[i + 1],
+            &columns[i], to_move * ECS_SIZEOF(int16_t));
     }
 
-    component_data[i] = NULL;
+    columns[i] = -1;
     type->array[i] = id;
     type->count ++;
 
@@ -11560,39 +12950,23 @@ int32_t flecs_child_type_insert(
 }
 
 static
-void flecs_instantiate_children(
+void flecs_instantiate_plan_init(
     ecs_world_t *world,
     ecs_entity_t base,
-    ecs_entity_t instance,
     ecs_table_t *child_table,
-    const ecs_instantiate_ctx_t *ctx)
+    bool is_prefab,
+    ecs_instantiate_plan_t *plan)
 {
-    if (!ecs_table_count(child_table)) {
-        return;
-    }
-
-    ecs_type_t type = child_table->type;
-    ecs_data_t *child_data = &child_table->data;
+    ecs_id_t *ids = child_table->type.array;
+    int32_t i, type_count = child_table->type.count;
 
+    ecs_type_t type = { .array = ecs_os_alloca_n(ecs_id_t, type_count + 1) };
+    int16_t *columns = ecs_os_alloca_n(int16_t, type_count + 1);
     ecs_entity_t slot_of = 0;
-    ecs_entity_t *ids = type.array;
-    int32_t type_count = type.count;
-
-    ecs_record_t *r = flecs_entities_get(world, instance);
-    ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
-    ecs_table_t *table = r->table;
-    ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
-
-    /* Instantiate child table for each instance */
-
-    /* Create component array for creating the table */
-    ecs_table_diff_t diff = { .added = {0}};
-    diff.added.array = ecs_os_alloca_n(ecs_entity_t, type_count + 1);
-    void **component_data = ecs_os_alloca_n(void*, type_count + 1);
 
     /* Copy in component identifiers. Find the base index in the component
      * array, since we'll need this to replace the base with the instance id */
-    int j, i, childof_base_index = -1;
+    int32_t childof_base_index = -1;
     for (i = 0; i < type_count; i ++) {
         ecs_id_t id = ids[i];
 
@@ -11613,7 +12987,7 @@ void flecs_instantiate_children(
         /* If child is a slot, keep track of which parent to add it to, but
          * don't add slot relationship to child of instance. If this is a child
          * of a prefab, keep the SlotOf relationship intact. */
-        if (!(table->flags & EcsTableIsPrefab)) {
+        if (!is_prefab) {
             if (ECS_IS_PAIR(id) && ECS_PAIR_FIRST(id) == EcsSlotOf) {
                 ecs_assert(slot_of == 0, ECS_INTERNAL_ERROR, NULL);
                 slot_of = ecs_pair_second(world, id);
@@ -11626,7 +13000,7 @@ void flecs_instantiate_children(
          * created children point to the instance and not the prefab */ 
         if (ECS_HAS_RELATION(id, EcsChildOf) && 
            (ECS_PAIR_SECOND(id) == (uint32_t)base)) {
-            childof_base_index = diff.added.count;
+            childof_base_index = type.count;
         }
 
         /* If this is a pure override, make sure we have a concrete version of the
@@ -11635,78 +13009,109 @@ void flecs_instantiate_children(
          * that have already been added to the child table type. */
         if (ECS_HAS_ID_FLAG(id, AUTO_OVERRIDE)) {
             ecs_id_t concreteId = id & ~ECS_AUTO_OVERRIDE;
-            flecs_child_type_insert(&diff.added, component_data, concreteId);
+            flecs_child_type_insert(&type, columns, concreteId);
             continue;
         }
 
-        int32_t storage_index = ecs_table_type_to_column_index(child_table, i);
-        if (storage_index != -1) {
-            component_data[diff.added.count] = 
-                child_data->columns[storage_index].data;
-        } else {
-            component_data[diff.added.count] = NULL;
-        }
-
-        diff.added.array[diff.added.count] = id;
-        diff.added.count ++;
-        diff.added_flags |= flecs_id_flags_get(world, id);
+        columns[type.count] = flecs_ito(int16_t, 
+            ecs_table_type_to_column_index(child_table, i));
+        type.array[type.count] = id;
+        type.count ++;
     }
 
     /* Table must contain children of base */
     ecs_assert(childof_base_index != -1, ECS_INTERNAL_ERROR, NULL);
 
     /* If children are added to a prefab, make sure they are prefabs too */
-    if (table->flags & EcsTableIsPrefab) {
-        if (flecs_child_type_insert(
-            &diff.added, component_data, EcsPrefab) != -1) 
-        {
+    if (is_prefab) {
+        if (flecs_child_type_insert(&type, columns, EcsPrefab) != -1) {
             childof_base_index ++;
         }
     }
 
-    /* Instantiate the prefab child table for each new instance */
-    int32_t child_count = ecs_table_count(child_table);
-    ecs_entity_t *child_ids = flecs_walloc_n(world, ecs_entity_t, child_count);
-
-    ecs_table_t *i_table = NULL;
+    plan->type.array = flecs_walloc_n(world, ecs_id_t, type.count);
+    plan->type.count = type.count;
+    ecs_os_memcpy_n(plan->type.array, type.array, ecs_id_t, type.count);
+    plan->columns = flecs_walloc_n(world, int16_t, type.count);
+    ecs_os_memcpy_n(plan->columns, columns, int16_t, type.count);
+    plan->childof_index = childof_base_index;
+    plan->slot_of = slot_of;
+    plan->generation = world->instantiate_plan_generation;
+}
 
-    /* Replace ChildOf element in the component array with instance id */
-    diff.added.array[childof_base_index] = ecs_pair(EcsChildOf, instance);
+static
+void flecs_instantiate_plan_fini(
+    ecs_world_t *world,
+    ecs_instantiate_plan_t *plan)
+{
+    flecs_wfree_n(world, ecs_id_t, plan->type.count, plan->type.array);
+    flecs_wfree_n(world, int16_t, plan->type.count, plan->columns);
+    ecs_os_zeromem(plan);
+}
 
-    /* Find or create table */
-    i_table = flecs_table_find_or_create(world, &diff.added);
+void flecs_instantiate_plans_fini(
+    ecs_world_t *world,
+    ecs_table_t *table)
+{
+    ecs_instantiate_plan_t *plans = table->_->instantiate_plans;
+    if (plans) {
+        if (plans[0].type.array) {
+            flecs_instantiate_plan_fini(world, &plans[0]);
+        }
+        if (plans[1].type.array) {
+            flecs_instantiate_plan_fini(world, &plans[1]);
+        }
+        flecs_wfree_n(world, ecs_instantiate_plan_t, 2, plans);
+        table->_->instantiate_plans = NULL;
+    }
+}
 
-    ecs_assert(i_table != NULL, ECS_INTERNAL_ERROR, NULL);
-    ecs_assert(i_table->type.count == diff.added.count,
-        ECS_INTERNAL_ERROR, NULL);
+/* Get plan for instantiating the entities of a prefab child table. The plan
+ * only depends on the type of the child table, whether the instance is a
+ * prefab and on the OnInstantiate traits of the components in the type. */
+static
+const ecs_instantiate_plan_t* flecs_instantiate_plan_get(
+    ecs_world_t *world,
+    ecs_entity_t base,
+    ecs_table_t *child_table,
+    bool is_prefab)
+{
+    ecs_instantiate_plan_t *plans = child_table->_->instantiate_plans;
+    if (!plans) {
+        plans = child_table->_->instantiate_plans = 
+            flecs_wcalloc_n(world, ecs_instantiate_plan_t, 2);
+    }
 
-    /* The instance is trying to instantiate from a base that is also
-     * its parent. This would cause the hierarchy to instantiate itself
-     * which would cause infinite recursion. */
-    const ecs_entity_t *children = ecs_table_entities(child_table);
+    ecs_instantiate_plan_t *plan = &plans[is_prefab];
+    if (plan->type.array) {
+        if (plan->generation == world->instantiate_plan_generation) {
+            return plan;
+        }
 
-#ifdef FLECS_DEBUG
-    for (j = 0; j < child_count; j ++) {
-        ecs_entity_t child = children[j];        
-        ecs_check(child != instance, ECS_INVALID_PARAMETER, 
-            "cycle detected in IsA relationship");
+        /* OnInstantiate traits changed since plan was created */
+        flecs_instantiate_plan_fini(world, plan);
     }
-#else
-    /* Bit of boilerplate to ensure that we don't get warnings about the
-     * error label not being used. */
-    ecs_check(true, ECS_INVALID_OPERATION, NULL);
-#endif
 
+    flecs_instantiate_plan_init(world, base, child_table, is_prefab, plan);
+
+    return plan;
+}
+
+static
+void flecs_instantiate_child_ids(
+    ecs_world_t *world,
+    const ecs_entity_t *children,
+    int32_t child_count,
+    ecs_entity_t root_prefab,
+    ecs_entity_t root_instance,
+    ecs_entity_t *child_ids)
+{
     /* Attempt to reserve ids for children that have the same offset from
      * the instance as from the base prefab. This ensures stable ids for
      * instance children, even across networked applications. */
-    ecs_instantiate_ctx_t ctx_cur = {base, instance};
-    if (ctx) {
-        ctx_cur = *ctx;
-    }
-
+    int32_t j;
     for (j = 0; j < child_count; j ++) {
-        if ((uint32_t)children[j] < (uint32_t)ctx_cur.root_prefab) {
+        if ((uint32_t)children[j] < (uint32_t)root_prefab) {
             /* Child id is smaller than root prefab id, can't use offset */
             child_ids[j] = flecs_new_id(world);
             continue;
@@ -11714,11 +13119,11 @@ void flecs_instantiate_children(
 
         /* Get prefab offset, ignore lifecycle generation count */
         ecs_entity_t prefab_offset =
-            (uint32_t)children[j] - (uint32_t)ctx_cur.root_prefab;
+            (uint32_t)children[j] - (uint32_t)root_prefab;
         ecs_assert(prefab_offset != 0, ECS_INTERNAL_ERROR, NULL);
 
         /* First check if any entity with the desired id exists */
-        ecs_entity_t instance_child = (uint32_t)ctx_cur.root_instance + prefab_offset;
+        ecs_entity_t instance_child = (uint32_t)root_instance + prefab_offset;
         ecs_entity_t alive_id = flecs_entities_get_alive(world, instance_child);
         if (alive_id && flecs_entities_is_alive(world, alive_id)) {
             /* Alive entity with requested id exists, can't use offset id */
@@ -11727,37 +13132,139 @@ void flecs_instantiate_children(
         }
 
         /* Id is not in use. Make it alive & match the generation of the instance. */
-        instance_child = ctx_cur.root_instance + prefab_offset;
+        instance_child = root_instance + prefab_offset;
         flecs_entities_make_alive(world, instance_child);
         flecs_entities_ensure(world, instance_child);
         ecs_assert(ecs_is_alive(world, instance_child), ECS_INTERNAL_ERROR, NULL);
         child_ids[j] = instance_child;
     }
+}
 
-    /* Create children */
-    int32_t child_row;
-    const ecs_entity_t *i_children = flecs_bulk_new(world, i_table, child_ids,
-        &diff.added, child_count, component_data, false, &child_row, &diff);
+static
+void flecs_instantiate_children(
+    ecs_world_t *world,
+    ecs_entity_t base,
+    const ecs_entity_t *instances,
+    int32_t instance_count,
+    ecs_table_t *child_table,
+    const ecs_instantiate_ctx_t *ctx)
+{
+    int32_t child_count = ecs_table_count(child_table);
+    if (!child_count) {
+        return;
+    }
 
-    /* If children are slots, add slot relationships to parent */
-    if (slot_of) {
+    /* Instances are all created by the same operation, so if one instance is
+     * a prefab, all of them are. */
+    ecs_record_t *r = flecs_entities_get(world, instances[0]);
+    ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_table_t *table = r->table;
+    ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    const ecs_instantiate_plan_t *plan = flecs_instantiate_plan_get(
+        world, base, child_table, (table->flags & EcsTableIsPrefab) != 0);
+    int32_t i, j, k, type_count = plan->type.count;
+    ecs_entity_t slot_of = plan->slot_of;
+
+    /* Create component array for creating the table */
+    ecs_table_diff_t diff = { 
+        .added = {
+            .array = ecs_os_alloca_n(ecs_id_t, type_count),
+            .count = type_count
+        }
+    };
+    ecs_os_memcpy_n(diff.added.array, plan->type.array, ecs_id_t, type_count);
+
+    /* Id flags aren't cached in the plan, as they change when observers for
+     * the components in the type are created. */
+    for (i = 0; i < type_count; i ++) {
+        diff.added_flags |= flecs_id_flags_get(world, plan->type.array[i]);
+    }
+
+    void **component_data = ecs_os_alloca_n(void*, type_count);
+    ecs_data_t *child_data = &child_table->data;
+    for (i = 0; i < type_count; i ++) {
+        int16_t column = plan->columns[i];
+        if (column != -1) {
+            component_data[i] = child_data->columns[column].data;
+        } else {
+            component_data[i] = NULL;
+        }
+    }
+
+    const ecs_entity_t *children = ecs_table_entities(child_table);
+    ecs_entity_t *child_ids = flecs_walloc_n(
+        world, ecs_entity_t, child_count * instance_count);
+
+    ecs_instantiate_ctx_t ctx_cur = {base, instances};
+    if (ctx) {
+        ctx_cur = *ctx;
+    }
+
+    /* Instantiate the prefab child table for each new instance */
+    for (k = 0; k < instance_count; k ++) {
+        ecs_entity_t instance = instances[k];
+        ecs_entity_t *i_children = &child_ids[k * child_count];
+
+        /* The instance is trying to instantiate from a base that is also
+         * its parent. This would cause the hierarchy to instantiate itself
+         * which would cause infinite recursion. */
+#ifdef FLECS_DEBUG
         for (j = 0; j < child_count; j ++) {
-            ecs_entity_t child = children[j];
-            ecs_entity_t i_child = i_children[j];
-            flecs_instantiate_slot(world, base, instance, slot_of,
-                child, i_child);
+            ecs_entity_t child = children[j];        
+            ecs_check(child != instance, ECS_INVALID_PARAMETER, 
+                "cycle detected in IsA relationship");
+        }
+#else
+        /* Bit of boilerplate to ensure that we don't get warnings about the
+         * error label not being used. */
+        ecs_check(true, ECS_INVALID_OPERATION, NULL);
+#endif
+
+        /* Replace ChildOf element in the component array with instance id */
+        diff.added.array[plan->childof_index] = 
+            ecs_pair(EcsChildOf, instance);
+
+        /* Find or create table */
+        ecs_table_t *i_table = flecs_table_find_or_create(world, &diff.added);
+        ecs_assert(i_table != NULL, ECS_INTERNAL_ERROR, NULL);
+        ecs_assert(i_table->type.count == diff.added.count,
+            ECS_INTERNAL_ERROR, NULL);
+
+        flecs_instantiate_child_ids(world, children, child_count, 
+            ctx_cur.root_prefab, ctx_cur.root_instances[k], i_children);
+
+        /* Create children */
+        flecs_bulk_new(world, i_table, i_children, &diff.added, child_count, 
+            component_data, false, NULL, &diff);
+
+        /* If children are slots, add slot relationships to parent */
+        if (slot_of) {
+            for (j = 0; j < child_count; j ++) {
+                flecs_instantiate_slot(world, base, instance, slot_of,
+                    children[j], i_children[j]);
+            }
         }
     }
 
-    /* If prefab child table has children itself, recursively instantiate */
+    /* If prefab child table has children itself, recursively instantiate. The
+     * children of all instances are instantiated together. */
+    ecs_entity_t *i_children = flecs_walloc_n(
+        world, ecs_entity_t, instance_count);
     for (j = 0; j < child_count; j ++) {
-        ecs_entity_t child = children[j];
-        flecs_instantiate(world, child, i_children[j], &ctx_cur);
+        for (k = 0; k < instance_count; k ++) {
+            i_children[k] = child_ids[k * child_count + j];
+        }
+
+        flecs_instantiate(world, children[j], i_children, instance_count, 
+            &ctx_cur);
     }
 
-    flecs_wfree_n(world, ecs_entity_t, child_count, child_ids);
+    flecs_wfree_n(world, ecs_entity_t, instance_count, i_children);
+    flecs_wfree_n(world, ecs_entity_t, child_count * instance_count, child_ids);
+    return;
 error:
-    return;    
+    flecs_wfree_n(world, ecs_entity_t, child_count * instance_count, child_ids);
 }
 
 static
@@ -11773,6 +13280,8 @@ void flecs_instantiate_union(
     const ecs_table_record_t *tr = flecs_component_get_table(
         union_cr, base_table);
     ecs_assert(tr != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_record_t *r = flecs_entities_get(world, instance);
+    ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
     int32_t i = 0, union_count = 0;
     do {
         ecs_id_t id = base_table->type.array[i];
@@ -11783,7 +13292,7 @@ void flecs_instantiate_union(
             ecs_component_record_t *cr = 
                 (ecs_component_record_t*)base_table->_->records[i].hdr.cache;
 
-            flecs_switch_set(cr->sparse, (uint32_t)instance, tgt);
+            flecs_union_set(cr, r->table, instance, tgt);
 
             union_count ++;
         }
@@ -11857,26 +13366,32 @@ void flecs_instantiate_override_dont_fragment(
 void flecs_instantiate(
     ecs_world_t *world,
     ecs_entity_t base,
-    ecs_entity_t instance,
+    const ecs_entity_t *instances,
+    int32_t count,
     const ecs_instantiate_ctx_t *ctx)
 {
     ecs_record_t *record = flecs_entities_get_any(world, base);
     ecs_table_t *base_table = record->table;
     ecs_assert(base_table != NULL, ECS_INTERNAL_ERROR, NULL);
 
-    /* If prefab has union relationships, also set them on instance */
-    if (base_table->flags & EcsTableHasUnion) {
-        flecs_instantiate_union(world, base, base_table, instance);
-    }
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        ecs_entity_t instance = instances[i];
 
-    if (base_table->flags & EcsTableOverrideDontFragment) {
-        flecs_instantiate_override_dont_fragment(
-            world, base_table, instance);
-    }
+        /* If prefab has union relationships, also set them on instance */
+        if (base_table->flags & EcsTableHasUnion) {
+            flecs_instantiate_union(world, base, base_table, instance);
+        }
 
-    /* If base has non-fragmenting components, add to instance */
-    if (record->row & EcsEntityHasDontFragment) {
-        flecs_instantiate_dont_fragment(world, base, instance);
+        if (base_table->flags & EcsTableOverrideDontFragment) {
+            flecs_instantiate_override_dont_fragment(
+                world, base_table, instance);
+        }
+
+        /* If base has non-fragmenting components, add to instance */
+        if (record->row & EcsEntityHasDontFragment) {
+            flecs_instantiate_dont_fragment(world, base, instance);
+        }
     }
 
     if (!(base_table->flags & EcsTableIsPrefab)) {
@@ -11891,7 +13406,7 @@ void flecs_instantiate(
         const ecs_table_record_t *tr;
         while ((tr = flecs_table_cache_next(&it, ecs_table_record_t))) {
             flecs_instantiate_children(
-                world, base, instance, tr->hdr.table, ctx);
+                world, base, instances, count, tr->hdr.table, ctx);
         }
         ecs_os_perf_trace_pop("flecs.instantiate");
     }
@@ -12946,6 +14461,23 @@ uint64_t flecs_ito_(
 }
 #endif
 
+#if !defined(__GNUC__) && !defined(__clang__)
+int32_t flecs_ctz64(
+    uint64_t value)
+{
+    ecs_assert(value != 0, ECS_INTERNAL_ERROR, NULL);
+    int32_t result = 0, shift;
+    for (shift = 32; shift; shift >>= 1) {
+        uint64_t mask = (1ull << shift) - 1;
+        if (!(value & mask)) {
+            value >>= shift;
+            result += shift;
+        }
+    }
+    return result;
+}
+#endif
+
 int32_t flecs_next_pow_of_2(
     int32_t n)
 {
@@ -13712,7 +15244,9 @@ void flecs_emit_propagate(
     /* Propagate to records of traversable relationships */
     ecs_component_record_t *cur = tgt_cr;
     while ((cur = flecs_component_trav_next(cur))) {
-        cur->pair->reachable.generation ++; /* Invalidate cache */
+        if (cur->pair->ext) {
+            cur->pair->ext->reachable.generation ++; /* Invalidate cache */
+        }
 
         /* Get traversed relationship */
         ecs_entity_t trav = ECS_PAIR_FIRST(cur->id);
@@ -13745,7 +15279,12 @@ void flecs_emit_propagate_invalidate_tables(
     /* Invalidate records of traversable relationships */
     ecs_component_record_t *cur = tgt_cr;
     while ((cur = flecs_component_trav_next(cur))) {
-        ecs_reachable_cache_t *rc = &cur->pair->reachable;
+        if (!cur->pair->ext) {
+            /* Cache was never populated, so subtree has nothing cached */
+            continue;
+        }
+
+        ecs_reachable_cache_t *rc = &cur->pair->ext->reachable;
         if (rc->current != rc->generation) {
             /* Subtree is already marked invalid */
             continue;
@@ -14203,7 +15742,8 @@ void flecs_emit_forward_table_up(
     /* If tgt_cr is out of sync but is not the current component record being updated,
      * keep track so that we can update two records for the cost of one. */
     ecs_assert(tgt_cr->pair != NULL, ECS_INTERNAL_ERROR, NULL);
-    ecs_reachable_cache_t *rc = &tgt_cr->pair->reachable;
+    ecs_reachable_cache_t *rc = 
+        &flecs_pair_record_ext_ensure(world, tgt_cr)->reachable;
     bool parent_revalidate = (reachable_ids != &rc->ids) && 
         (rc->current != rc->generation);
     if (parent_revalidate) {
@@ -14244,7 +15784,8 @@ void flecs_emit_forward_table_up(
             t[0] = tgt_table;
 
             ecs_assert(cr->pair != NULL, ECS_INTERNAL_ERROR, NULL);
-            ecs_reachable_cache_t *cr_rc = &cr->pair->reachable;
+            ecs_reachable_cache_t *cr_rc = 
+                &flecs_pair_record_ext_ensure(world, cr)->reachable;
             if (cr_rc->current == cr_rc->generation) {
                 /* Cache hit, use cached ids to prevent traversing the same
                  * hierarchy multiple times. This especially speeds up code 
@@ -14379,7 +15920,8 @@ void flecs_emit_forward(
     ecs_component_record_t *cr)
 {
     ecs_assert(cr->pair != NULL, ECS_INTERNAL_ERROR, NULL);
-    ecs_reachable_cache_t *rc = &cr->pair->reachable;
+    ecs_reachable_cache_t *rc = 
+        &flecs_pair_record_ext_ensure(world, cr)->reachable;
 
     if (rc->current != rc->generation) {
         /* Cache miss, iterate the tree to find ids to forward */
@@ -14697,14 +16239,20 @@ repeat_event:
                              * from being called recursively, in case prefab
                              * children also have IsA relationships. */
                             world->stages[0]->base = tgt;
-                            const ecs_entity_t *instances = 
-                                ecs_table_entities(table);
-                            int32_t e;
 
-                            for (e = 0; e < count; e ++) {
-                                flecs_instantiate(
-                                    world, tgt, instances[offset + e], NULL);
-                            }
+                            /* Copy instances, as instantiating slots can move
+                             * instances to a different table. */
+                            ecs_entity_t *instances = flecs_walloc_n(
+                                world, ecs_entity_t, count);
+                            ecs_os_memcpy_n(instances, 
+                                &ecs_table_entities(table)[offset], 
+                                ecs_entity_t, count);
+
+                            flecs_instantiate(world, tgt, instances, count, 
+                                NULL);
+
+                            flecs_wfree_n(world, ecs_entity_t, count, 
+                                instances);
 
                             world->stages[0]->base = 0;
                         }
@@ -15319,6 +16867,14 @@ bool flecs_ignore_observer(
     return result;
 }
 
+static
+void flecs_observer_yield_flush(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    ecs_table_t *table,
+    int32_t offset,
+    int32_t count);
+
 static
 void flecs_default_uni_observer_run_callback(ecs_iter_t *it) {
     ecs_observer_t *o = it->ctx;
@@ -15361,6 +16917,11 @@ void flecs_uni_observer_invoke(
         return;
     }
 
+    ecs_observer_impl_t *impl = flecs_observer_impl(o);
+    if (impl->yield) {
+        flecs_observer_yield_flush(world, o, table, it->offset, it->count);
+    }
+
     if (ecs_should_log_3()) {
         char *path = ecs_get_path(world, it->system);
         ecs_dbg_3("observer: invoke %s", path);
@@ -15369,7 +16930,6 @@ void flecs_uni_observer_invoke(
 
     ecs_log_push_3();
 
-    ecs_observer_impl_t *impl = flecs_observer_impl(o);
     it->system = o->entity;
     it->ctx = o->ctx;
     it->callback_ctx = o->callback_ctx;
@@ -15501,6 +17061,11 @@ void flecs_multi_observer_invoke(
         return;
     }
 
+    if (impl->yield) {
+        flecs_observer_yield_flush(
+            world, o, it->table, it->offset, it->count);
+    }
+
     ecs_table_t *table = it->table;
     ecs_table_t *prev_table = it->other_table;
     int8_t pivot_term = it->term_index;
@@ -15626,8 +17191,9 @@ void flecs_multi_observer_invoke_no_query(
     user_it.system = o->entity;
     user_it.event = it->event;
 
-    ecs_entity_t old_system = flecs_stage_set_system(
-        world->stages[0], o->entity);
+    /* Existing matches can be yielded from a worker stage */
+    ecs_stage_t *stage = world->stages[ecs_stage_get_id(it->world)];
+    ecs_entity_t old_system = flecs_stage_set_system(stage, o->entity);
     ecs_table_lock(it->world, table);
 
     if (o->run) {
@@ -15638,7 +17204,7 @@ void flecs_multi_observer_invoke_no_query(
     }
 
     ecs_table_unlock(it->world, table);
-    flecs_stage_set_system(world->stages[0], old_system);
+    flecs_stage_set_system(stage, old_system);
 }
 
 /* For convenience, so applications can use a single run callback that uses 
@@ -15674,34 +17240,204 @@ void flecs_multi_observer_builtin_run(ecs_iter_t *it) {
     flecs_multi_observer_invoke(it);
 }
 
+/* Number of recorded entities yielded before checking the time budget */
+#define FLECS_OBSERVER_YIELD_BATCH (256)
+
 static
-void flecs_observer_yield_existing(
+bool flecs_observer_yield_event(
+    ecs_entity_t event,
+    bool yield_on_remove)
+{
+    /* We only yield for OnRemove events if the observer is deleted. */
+    if (event == EcsOnRemove) {
+        return yield_on_remove;
+    } else {
+        return !yield_on_remove;
+    }
+}
+
+/* Invoke observer for existing matches. When parallel is true the iterator
+ * can run on a worker thread, and the event id is incremented atomically. */
+static
+void flecs_observer_yield_iter(
     ecs_world_t *world,
     ecs_observer_t *o,
-    bool yield_on_remove)
+    ecs_iter_t *it,
+    ecs_entity_t event,
+    bool parallel)
 {
     ecs_run_action_t run = o->run;
     if (!run) {
         run = flecs_multi_observer_invoke_no_query;
     }
 
+    it->system = o->entity;
+    it->ctx = o;
+    it->callback = flecs_default_uni_observer_run_callback;
+    it->callback_ctx = o->callback_ctx;
+    it->run_ctx = o->run_ctx;
+    it->event = event;
+    while (o->query ? ecs_query_next(it) : ecs_each_next(it)) {
+        it->event_id = it->ids[0];
+        if (parallel) {
+            it->event_cur = ecs_os_ainc(&world->event_id);
+        } else {
+            it->event_cur = ++ world->event_id;
+        }
+
+        ecs_iter_next_action_t next = it->next;
+        it->next = flecs_default_next_callback;
+        run(it);
+        it->next = next;
+        it->interrupted_by = 0;
+    }
+}
+
+typedef struct ecs_observer_yield_job_t {
+    ecs_observer_t *o;
+    ecs_entity_t event;
+    const ecs_table_range_t *ranges;
+    int32_t range_count;
+    int32_t job_count;
+} ecs_observer_yield_job_t;
+
+/* Yield every job_count'th range, using the stage of the job */
+static
+void flecs_observer_yield_job(
+    void *ptr,
+    int32_t index)
+{
+    ecs_observer_yield_job_t *ctx = ptr;
+    ecs_observer_t *o = ctx->o;
+    ecs_world_t *world = o->world;
+    ecs_world_t *stage = (ecs_world_t*)world->stages[index];
+    ecs_entity_t old_system = flecs_stage_set_system(
+        world->stages[index], o->entity);
+
+    int32_t i;
+    for (i = index; i < ctx->range_count; i += ctx->job_count) {
+        ecs_iter_t it = ecs_query_iter(stage, o->query);
+        ecs_iter_set_var_as_range(&it, 0, &ctx->ranges[i]);
+        flecs_observer_yield_iter(world, o, &it, ctx->event, true);
+    }
+
+    flecs_stage_set_system(world->stages[index], old_system);
+}
+
+/* Matches can be yielded from worker threads if the observer callback is
+ * thread safe, and the world can be put in multithreaded readonly mode. */
+static
+bool flecs_observer_yield_is_parallel(
+    ecs_world_t *world,
+    ecs_observer_t *o)
+{
+    return (flecs_observer_impl(o)->flags & EcsObserverMultiThreaded) &&
+        o->query && (o->query->flags & EcsQueryMatchThis) &&
+        (world->stage_count > 1) && ecs_os_has_parallel_for() &&
+        !(world->flags & EcsWorldReadonly) && !ecs_is_deferred(world);
+}
+
+/* Yield existing matches in table ranges. When parallel is true, the world
+ * must be in readonly mode. */
+static
+void flecs_observer_yield_ranges(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    const ecs_table_range_t *ranges,
+    int32_t count,
+    bool parallel)
+{
+    int32_t i, e;
+    for (e = 0; e < o->event_count; e ++) {
+        ecs_entity_t event = o->events[e];
+        if (!flecs_observer_yield_event(event, false)) {
+            continue;
+        }
+
+        if (parallel) {
+            ecs_observer_yield_job_t ctx = {
+                .o = o,
+                .event = event,
+                .ranges = ranges,
+                .range_count = count,
+                .job_count = world->stage_count
+            };
+
+            if (ctx.job_count > count) {
+                ctx.job_count = count;
+            }
+
+            if (ctx.job_count) {
+                ecs_os_parallel_for(
+                    flecs_observer_yield_job, &ctx, ctx.job_count);
+            }
+        } else {
+            for (i = 0; i < count; i ++) {
+                ecs_iter_t it = ecs_query_iter(world, o->query);
+                ecs_iter_set_var_as_range(&it, 0, &ranges[i]);
+                flecs_observer_yield_iter(world, o, &it, event, false);
+            }
+        }
+    }
+}
+
+/* Yield existing matches from worker threads, one table at a time */
+static
+void flecs_observer_yield_existing_parallel(
+    ecs_world_t *world,
+    ecs_observer_t *o)
+{
+    ecs_allocator_t *a = &world->allocator;
+    ecs_vec_t ranges;
+    ecs_vec_init_t(a, &ranges, ecs_table_range_t, 0);
+
+    /* Results for the same table are returned consecutively. Each job 
+     * evaluates the query for an entire table, which returns all results for
+     * the table. */
+    ecs_iter_t it = ecs_query_iter(world, o->query);
+    ECS_BIT_SET(it.flags, EcsIterNoData);
+    ecs_table_t *last = NULL;
+    while (ecs_query_next(&it)) {
+        if (it.table == last) {
+            continue;
+        }
+
+        last = it.table;
+        ecs_vec_append_t(a, &ranges, ecs_table_range_t)[0] = 
+            (ecs_table_range_t){ 
+                .table = it.table, 
+                .offset = 0,
+                .count = ecs_table_count(it.table) 
+            };
+    }
+
+    ecs_readonly_begin(world, true);
+    flecs_observer_yield_ranges(world, o, ecs_vec_first(&ranges), 
+        ecs_vec_count(&ranges), true);
+    ecs_readonly_end(world);
+
+    ecs_vec_fini_t(a, &ranges, ecs_table_range_t);
+}
+
+static
+void flecs_observer_yield_existing(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    bool yield_on_remove)
+{
+    if (!yield_on_remove && flecs_observer_yield_is_parallel(world, o)) {
+        flecs_observer_yield_existing_parallel(world, o);
+        return;
+    }
+
     ecs_defer_begin(world);
 
     /* If yield existing is enabled, invoke for each thing that matches
      * the event, if the event is iterable. */
     int i, count = o->event_count;
     for (i = 0; i < count; i ++) {
-        ecs_entity_t event = o->events[i];
-
-        /* We only yield for OnRemove events if the observer is deleted. */
-        if (event == EcsOnRemove) {
-            if (!yield_on_remove) {
-                continue;
-            }
-        } else {
-            if (yield_on_remove) {
-                continue;
-            }
+        if (!flecs_observer_yield_event(o->events[i], yield_on_remove)) {
+            continue;
         }
 
         ecs_iter_t it;
@@ -15711,27 +17447,297 @@ void flecs_observer_yield_existing(
             it = ecs_each_id(world, flecs_observer_impl(o)->register_id);
         }
 
-        it.system = o->entity;
-        it.ctx = o;
-        it.callback = flecs_default_uni_observer_run_callback;
-        it.callback_ctx = o->callback_ctx;
-        it.run_ctx = o->run_ctx;
-        it.event = o->events[i];
-        while (o->query ? ecs_query_next(&it) : ecs_each_next(&it)) {
-            it.event_id = it.ids[0];
-            it.event_cur = ++ world->event_id;
+        flecs_observer_yield_iter(world, o, &it, o->events[i], false);
+    }
+
+    ecs_defer_end(world);
+}
+
+/* Record entities that match the observer, which are yielded incrementally */
+static
+void flecs_observer_yield_init(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    double time_budget)
+{
+    ecs_allocator_t *a = &world->allocator;
+    ecs_observer_yield_t *y = flecs_calloc_t(a, ecs_observer_yield_t);
+    ecs_vec_init_t(a, &y->entities, ecs_entity_t, 0);
+    ecs_map_init(&y->pending, a);
+    y->time_budget = time_budget;
+
+    ecs_iter_t it = ecs_query_iter(world, o->query);
+    ECS_BIT_SET(it.flags, EcsIterNoData);
+    while (ecs_query_next(&it)) {
+        int32_t i;
+        for (i = 0; i < it.count; i ++) {
+            /* Queries can return an entity more than once, for example when
+             * matching multiple pairs for a wildcard. */
+            ecs_entity_t e = it.entities[i];
+            if (ecs_map_get(&y->pending, e)) {
+                continue;
+            }
+
+            ecs_map_insert(&y->pending, e, 0);
+            ecs_vec_append_t(a, &y->entities, ecs_entity_t)[0] = e;
+        }
+    }
+
+    int32_t count = ecs_vec_count(&y->entities);
+    if (!count) {
+        ecs_vec_fini_t(a, &y->entities, ecs_entity_t);
+        ecs_map_fini(&y->pending);
+        flecs_free_t(a, ecs_observer_yield_t, y);
+        return;
+    }
+
+    flecs_observer_impl(o)->yield = y;
+    ecs_vec_append_t(a, &world->observer_yield_queue, ecs_observer_t*)[0] = o;
+    world->info.observer_yield_count += count;
+}
 
-            ecs_iter_next_action_t next = it.next;
-            it.next = flecs_default_next_callback;
-            run(&it);
-            it.next = next;
-            it.interrupted_by = 0;
+static
+void flecs_observer_yield_fini(
+    ecs_world_t *world,
+    ecs_observer_t *o)
+{
+    ecs_observer_impl_t *impl = flecs_observer_impl(o);
+    ecs_observer_yield_t *y = impl->yield;
+    ecs_allocator_t *a = &world->allocator;
+
+    world->info.observer_yield_count -= ecs_map_count(&y->pending);
+    ecs_vec_fini_t(a, &y->entities, ecs_entity_t);
+    ecs_map_fini(&y->pending);
+    flecs_free_t(a, ecs_observer_yield_t, y);
+    impl->yield = NULL;
+
+    /* Keep order of remaining observers in queue */
+    ecs_observer_t **queue = ecs_vec_first(&world->observer_yield_queue);
+    int32_t i, count = ecs_vec_count(&world->observer_yield_queue);
+    for (i = 0; i < count; i ++) {
+        if (queue[i] == o) {
+            ecs_vec_remove_ordered_t(
+                &world->observer_yield_queue, ecs_observer_t*, i);
+            break;
+        }
+    }
+}
+
+/* Take range of recorded entities that are stored next to each other in the
+ * same table. Consumes at most max recorded entities, and returns the number of
+ * recorded entities that were consumed. */
+static
+int32_t flecs_observer_yield_next_range(
+    ecs_world_t *world,
+    ecs_observer_yield_t *y,
+    ecs_table_range_t *range,
+    int32_t max)
+{
+    const ecs_entity_t *entities = ecs_vec_first(&y->entities);
+    int32_t i, count = ecs_vec_count(&y->entities);
+    *range = (ecs_table_range_t){0};
+
+    if (count > (y->cursor + max)) {
+        count = y->cursor + max;
+    }
+
+    for (i = y->cursor; i < count; i ++) {
+        ecs_entity_t e = entities[i];
+        if (!ecs_map_get(&y->pending, e)) {
+            /* Entity was yielded before an event for it was delivered */
+            continue;
+        }
+
+        /* Entities that got deleted are skipped */
+        ecs_record_t *r = flecs_entities_try(world, e);
+        ecs_table_t *table = r ? r->table : NULL;
+        if (!table) {
+            ecs_map_remove(&y->pending, e);
+            world->info.observer_yield_count --;
+            continue;
+        }
+
+        int32_t row = ECS_RECORD_TO_ROW(r->row);
+        if (range->table) {
+            if ((table != range->table) || 
+                (row != (range->offset + range->count))) 
+            {
+                break;
+            }
+
+            range->count ++;
+        } else {
+            range->table = table;
+            range->offset = row;
+            range->count = 1;
+        }
+
+        ecs_map_remove(&y->pending, e);
+        world->info.observer_yield_count --;
+    }
+
+    int32_t result = i - y->cursor;
+    y->cursor = i;
+    return result;
+}
+
+/* Yield recorded entities until done or time budget is exceeded. Returns true
+ * if all entities have been yielded, after which the yield state is freed. */
+static
+bool flecs_observer_yield_step(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    ecs_time_t *start,
+    double time_budget_seconds)
+{
+    ecs_observer_yield_t *y = flecs_observer_impl(o)->yield;
+    ecs_allocator_t *a = &world->allocator;
+    bool parallel = flecs_observer_yield_is_parallel(world, o);
+
+    ecs_vec_t ranges;
+    ecs_vec_init_t(a, &ranges, ecs_table_range_t, 0);
+
+    /* Commands are merged after the last batch. This ensures that the observer
+     * isn't deleted by its own callback while still yielding. */
+    if (parallel) {
+        ecs_readonly_begin(world, true);
+    } else {
+        ecs_defer_begin(world);
+    }
+
+    int32_t count = ecs_vec_count(&y->entities);
+    while (y->cursor < count) {
+        int32_t batch = 0;
+        ecs_vec_clear(&ranges);
+        while ((batch < FLECS_OBSERVER_YIELD_BATCH) && (y->cursor < count)) {
+            ecs_table_range_t range;
+            batch += flecs_observer_yield_next_range(world, y, &range,
+                FLECS_OBSERVER_YIELD_BATCH - batch);
+            if (range.table) {
+                ecs_vec_append_t(a, &ranges, ecs_table_range_t)[0] = range;
+            }
+        }
+
+        flecs_observer_yield_ranges(world, o, ecs_vec_first(&ranges), 
+            ecs_vec_count(&ranges), parallel);
+
+        if (ECS_NEQZERO(time_budget_seconds)) {
+            ecs_time_t cur = *start;
+            if (ecs_time_measure(&cur) > time_budget_seconds) {
+                break;
+            }
+        }
+    }
+
+    bool done = y->cursor == count;
+    if (done) {
+        flecs_observer_yield_fini(world, o);
+    }
+
+    ecs_vec_fini_t(a, &ranges, ecs_table_range_t);
+
+    if (parallel) {
+        ecs_readonly_end(world);
+    } else {
+        ecs_defer_end(world);
+    }
+
+    return done;
+}
+
+/* Yield recorded entities in table range before an event for them is delivered
+ * to the observer, so that the observer receives events in order. */
+static
+void flecs_observer_yield_flush(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    ecs_table_t *table,
+    int32_t offset,
+    int32_t count)
+{
+    ecs_observer_yield_t *y = flecs_observer_impl(o)->yield;
+    if (!table || !ecs_map_count(&y->pending)) {
+        return;
+    }
+
+    ecs_defer_begin(world);
+
+    const ecs_entity_t *entities = ecs_table_entities(table);
+    int32_t row, start = -1, end = offset + count;
+    for (row = offset; row <= end; row ++) {
+        if (row < end && ecs_map_get(&y->pending, entities[row])) {
+            ecs_map_remove(&y->pending, entities[row]);
+            world->info.observer_yield_count --;
+            if (start == -1) {
+                start = row;
+            }
+        } else if (start != -1) {
+            ecs_table_range_t range = { 
+                .table = table, 
+                .offset = start, 
+                .count = row - start
+            };
+
+            flecs_observer_yield_ranges(world, o, &range, 1, false);
+            start = -1;
         }
     }
 
     ecs_defer_end(world);
 }
 
+void flecs_observers_yield_frame(
+    ecs_world_t *world)
+{
+    ecs_vec_t *queue = &world->observer_yield_queue;
+    if (!ecs_vec_count(queue) || ecs_is_deferred(world)) {
+        return;
+    }
+
+    ecs_os_perf_trace_push("flecs.observer_yield");
+
+    /* Each observer gets its own time budget */
+    int32_t i = 0;
+    while (i < ecs_vec_count(queue)) {
+        ecs_observer_t *o = ecs_vec_get_t(queue, ecs_observer_t*, i)[0];
+        ecs_time_t start = {0};
+        ecs_time_measure(&start);
+        if (!flecs_observer_yield_step(world, o, &start, 
+            flecs_observer_impl(o)->yield->time_budget)) 
+        {
+            i ++;
+        }
+    }
+
+    ecs_os_perf_trace_pop("flecs.observer_yield");
+}
+
+int32_t ecs_observer_yield_run(
+    ecs_world_t *world,
+    double time_budget_seconds)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(!ecs_is_deferred(world), ECS_INVALID_OPERATION,
+        "cannot yield observer matches while world is deferred");
+
+    ecs_time_t start = {0};
+    if (ECS_NEQZERO(time_budget_seconds)) {
+        ecs_time_measure(&start);
+    }
+
+    ecs_vec_t *queue = &world->observer_yield_queue;
+    while (ecs_vec_count(queue)) {
+        ecs_observer_t *o = ecs_vec_first_t(queue, ecs_observer_t*)[0];
+        if (!flecs_observer_yield_step(world, o, &start, time_budget_seconds)) {
+            break;
+        }
+    }
+
+    return world->info.observer_yield_count;
+error:
+    return 0;
+}
+
 static
 int flecs_uni_observer_init(
     ecs_world_t *world,
@@ -16042,7 +18048,12 @@ ecs_observer_t* flecs_observer_init(
         .ids = ids
     };
 
-    if (desc->events[0] != EcsMonitor) {
+    /* Incremental and parallel yield evaluate the query for table ranges,
+     * which requires an actual query. */
+    bool yield_query = desc->yield_existing && 
+        (ECS_NEQZERO(desc->yield_existing_time_budget) || desc->multi_threaded);
+
+    if (desc->events[0] != EcsMonitor && !yield_query) {
         if (flecs_query_finalize_simple(world, &dummy_query, &query_desc)) {
             /* Flag is set if query increased the keep_alive count of the 
              * queried for component, which prevents deleting the component
@@ -16128,6 +18139,9 @@ ecs_observer_t* flecs_observer_init(
     impl->term_index = desc->term_index_;
     impl->flags |= desc->flags_ | 
         (query->flags & (EcsQueryMatchPrefab|EcsQueryMatchDisabled));
+    if (desc->multi_threaded) {
+        impl->flags |= EcsObserverMultiThreaded;
+    }
 
     ecs_check(!(desc->yield_existing && 
         (desc->flags_ & (EcsObserverYieldOnCreate|EcsObserverYieldOnDelete))), 
@@ -16200,7 +18214,14 @@ ecs_observer_t* flecs_observer_init(
     }
 
     if (impl->flags & EcsObserverYieldOnCreate) {
-        flecs_observer_yield_existing(world, o, false);
+        if (ECS_NEQZERO(desc->yield_existing_time_budget) && 
+            (query->flags & EcsQueryMatchThis)) 
+        {
+            flecs_observer_yield_init(
+                world, o, desc->yield_existing_time_budget);
+        } else {
+            flecs_observer_yield_existing(world, o, false);
+        }
     }
 
     return o;
@@ -16330,6 +18351,17 @@ void flecs_observer_fini(
     flecs_poly_assert(world, ecs_world_t);
     ecs_observer_impl_t *impl = flecs_observer_impl(o);
 
+    if (impl->yield) {
+        if (impl->flags & EcsObserverYieldOnDelete) {
+            /* Yield remaining matches first, so that OnRemove events are never
+             * delivered before the events for the existing matches. */
+            ecs_time_t start = {0};
+            flecs_observer_yield_step(world, o, &start, 0);
+        } else {
+            flecs_observer_yield_fini(world, o);
+        }
+    }
+
     if (impl->flags & EcsObserverYieldOnDelete) {
         flecs_observer_yield_existing(world, o, true);
     }
@@ -16627,7 +18659,7 @@ void flecs_id_mark_for_delete(
                      * component through the deleted entity. */
                     if (!(cur->flags & EcsIdOnDeleteTargetDelete)) {
                         /* Only bother if tables have relationship. */
-                        if (ecs_map_count(&cur->cache.index)) {
+                        if (flecs_table_cache_count(&cur->cache)) {
                             flecs_update_component_monitors(world, NULL, 
                                 &(ecs_type_t){
                                     .array = (ecs_id_t[]){cur->id},
@@ -16726,10 +18758,101 @@ void flecs_remove_from_table(
     flecs_table_diff_builder_fini(world, &diff);
 }
 
+/* Number of rows destructed by a single parallel delete job */
+#define FLECS_DELETE_DTOR_CHUNK (4096)
+
+typedef struct ecs_delete_dtor_ctx_t {
+    ecs_table_detached_t *columns;
+    int32_t column_count;
+    int32_t job_count;
+} ecs_delete_dtor_ctx_t;
+
+/* Destruct every job_count'th chunk of the detached component storage */
+static
+void flecs_on_delete_dtor_job(
+    void *ptr,
+    int32_t index)
+{
+    ecs_delete_dtor_ctx_t *ctx = ptr;
+    int32_t c, chunk = 0;
+    for (c = 0; c < ctx->column_count; c ++) {
+        ecs_table_detached_t *column = &ctx->columns[c];
+        const ecs_type_info_t *ti = column->ti;
+        int32_t row, count = ecs_vec_count(&column->data);
+        for (row = 0; row < count; row += FLECS_DELETE_DTOR_CHUNK, chunk ++) {
+            if ((chunk % ctx->job_count) != index) {
+                continue;
+            }
+
+            int32_t n = count - row;
+            if (n > FLECS_DELETE_DTOR_CHUNK) {
+                n = FLECS_DELETE_DTOR_CHUNK;
+            }
+
+            ti->hooks.dtor(ECS_ELEM(column->data.array, ti->size, row), n, ti);
+        }
+    }
+}
+
+/* Invoke destructors for storage detached from deleted tables, then free it */
+static
+void flecs_on_delete_dtor_detached(
+    ecs_world_t *world,
+    ecs_vec_t *detached)
+{
+    int32_t i, count = ecs_vec_count(detached);
+    if (!count) {
+        return;
+    }
+
+    ecs_table_detached_t *columns = ecs_vec_first(detached);
+    int32_t chunk_count = 0;
+    for (i = 0; i < count; i ++) {
+        int32_t rows = ecs_vec_count(&columns[i].data);
+        chunk_count += (rows + FLECS_DELETE_DTOR_CHUNK - 1) / 
+            FLECS_DELETE_DTOR_CHUNK;
+    }
+
+    ecs_delete_dtor_ctx_t ctx = {
+        .columns = columns,
+        .column_count = count,
+        .job_count = world->stage_count
+    };
+
+    if (ctx.job_count > chunk_count) {
+        ctx.job_count = chunk_count;
+    }
+
+    if (ctx.job_count > 1) {
+        ecs_os_parallel_for(flecs_on_delete_dtor_job, &ctx, ctx.job_count);
+    } else {
+        ctx.job_count = 1;
+        flecs_on_delete_dtor_job(&ctx, 0);
+    }
+
+    for (i = 0; i < count; i ++) {
+        ecs_vec_fini(&world->allocator, &columns[i].data, columns[i].ti->size);
+    }
+
+    ecs_vec_clear(detached);
+}
+
 static
 bool flecs_on_delete_clear_tables(
     ecs_world_t *world)
 {
+    /* When parallel delete is enabled, component storage of deleted tables is
+     * collected while emptying the tables, and destructed at the end. If there
+     * is only one thread, destructing while the storage is still in the cache
+     * is faster, so don't collect. */
+    ecs_vec_t detached = {0};
+    ecs_vec_t *detached_ptr = NULL;
+    if ((world->flags & EcsWorldParallelDelete) && 
+        (world->stage_count > 1) && ecs_os_has_parallel_for()) 
+    {
+        detached_ptr = &detached;
+    }
+
     /* Iterate in reverse order so that DAGs get deleted bottom to top */
     int32_t i, last = ecs_vec_count(&world->store.marked_ids), first = 0;
     ecs_marked_id_t *ids = ecs_vec_first(&world->store.marked_ids);
@@ -16753,7 +18876,12 @@ bool flecs_on_delete_clear_tables(
                         ecs_dbg_3(
                             "#[red]delete#[reset] entities from table %u", 
                             (uint32_t)table->id);
-                        flecs_table_delete_entities(world, table);
+                        if (detached_ptr) {
+                            flecs_table_delete_entities_detached(
+                                world, table, detached_ptr);
+                        } else {
+                            flecs_table_delete_entities(world, table);
+                        }
                     }
                 }
             }
@@ -16781,6 +18909,11 @@ bool flecs_on_delete_clear_tables(
         }
     } while (true);
 
+    if (detached_ptr) {
+        flecs_on_delete_dtor_detached(world, detached_ptr);
+        ecs_vec_fini_t(&world->allocator, detached_ptr, ecs_table_detached_t);
+    }
+
     return true;
 }
 
@@ -16912,6 +19045,13 @@ void flecs_on_delete(
         ecs_dbg_2("#[red]delete#[reset]");
         ecs_log_push_2();
 
+        bool measure_time = ecs_os_has_time() && (world->flags & 
+            (EcsWorldMeasureFrameTime|EcsWorldParallelDelete)) != 0;
+        ecs_time_t t_start = {0};
+        if (measure_time) {
+            ecs_os_get_time(&t_start);
+        }
+
         /* Empty tables with all the to be deleted ids */
         flecs_on_delete_clear_tables(world);
 
@@ -16942,6 +19082,12 @@ void flecs_on_delete(
 
         ecs_vec_clear(&world->store.deleted_components);
 
+        if (measure_time) {
+            ecs_ftime_t delete_time = (ecs_ftime_t)ecs_time_measure(&t_start);
+            world->info.delete_time_total += delete_time;
+            world->info.delete_time_last = delete_time;
+        }
+
         ecs_log_pop_2();
     }
 }
@@ -16963,6 +19109,201 @@ void ecs_delete_with(
     flecs_journal_end();
 }
 
+/* Number of entities without children deleted with one ecs_delete_many() */
+#define FLECS_DELETE_QUEUE_BATCH (256)
+
+static
+void flecs_delete_queue_push(
+    ecs_world_t *world,
+    ecs_entity_t entity)
+{
+    ecs_delete_queue_t *q = &world->delete_queue;
+    ecs_allocator_t *a = &world->allocator;
+
+    if (flecs_components_get(world, ecs_childof(entity))) {
+        ecs_delete_queue_elem_t *elem = ecs_vec_append_t(
+            a, &q->stack, ecs_delete_queue_elem_t);
+        elem->entity = entity;
+        elem->expanded = false;
+    } else {
+        ecs_vec_append_t(a, &q->leaves, ecs_entity_t)[0] = entity;
+    }
+}
+
+/* Queue children of entity */
+static
+void flecs_delete_queue_expand(
+    ecs_world_t *world,
+    ecs_entity_t entity)
+{
+    ecs_component_record_t *cr = flecs_components_get(
+        world, ecs_childof(entity));
+    if (!cr) {
+        return;
+    }
+
+    ecs_table_cache_iter_t it;
+    if (flecs_table_cache_iter(&cr->cache, &it)) {
+        const ecs_table_record_t *tr;
+        while ((tr = flecs_table_cache_next(&it, ecs_table_record_t))) {
+            ecs_table_t *table = tr->hdr.table;
+            const ecs_entity_t *entities = ecs_table_entities(table);
+            int32_t i, count = ecs_table_count(table);
+            for (i = 0; i < count; i ++) {
+                flecs_delete_queue_push(world, entities[i]);
+            }
+        }
+    }
+}
+
+/* Queue root entities that aren't modules or in use as (component) id */
+static
+void flecs_delete_queue_roots(
+    ecs_world_t *world)
+{
+    ecs_component_record_t *cr = flecs_components_get(
+        world, ecs_pair(EcsChildOf, 0));
+    ecs_assert(cr != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_component_record_t *cr_comp = flecs_components_get(
+        world, ecs_id(EcsComponent));
+
+    ecs_table_cache_iter_t it;
+    if (flecs_table_cache_iter(&cr->cache, &it)) {
+        const ecs_table_record_t *tr;
+        while ((tr = flecs_table_cache_next(&it, ecs_table_record_t))) {
+            ecs_table_t *table = tr->hdr.table;
+            if (table->flags & EcsTableHasBuiltins) {
+                continue;
+            }
+
+            if (cr_comp && flecs_component_get_table(cr_comp, table)) {
+                continue;
+            }
+
+            const ecs_entity_t *entities = ecs_table_entities(table);
+            int32_t i, count = ecs_table_count(table);
+            for (i = 0; i < count; i ++) {
+                ecs_record_t *r = flecs_entities_get(world, entities[i]);
+                ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
+                if (ECS_RECORD_TO_ROW_FLAGS(r->row) & EcsEntityIsId) {
+                    continue;
+                }
+
+                flecs_delete_queue_push(world, entities[i]);
+            }
+        }
+    }
+}
+
+static
+int32_t flecs_delete_queue_count(
+    const ecs_world_t *world)
+{
+    return ecs_vec_count(&world->delete_queue.stack) + 
+        ecs_vec_count(&world->delete_queue.leaves);
+}
+
+void flecs_delete_queue_fini(
+    ecs_world_t *world)
+{
+    ecs_delete_queue_t *q = &world->delete_queue;
+    ecs_allocator_t *a = &world->allocator;
+    ecs_vec_fini_t(a, &q->stack, ecs_delete_queue_elem_t);
+    ecs_vec_fini_t(a, &q->leaves, ecs_entity_t);
+    world->info.delete_queue_count = 0;
+}
+
+void ecs_delete_incremental(
+    ecs_world_t *world,
+    ecs_entity_t entity)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(!(world->flags & EcsWorldFini), ECS_INVALID_OPERATION,
+        "cannot queue entities for deletion while world is being deleted");
+
+    if (!entity) {
+        flecs_delete_queue_roots(world);
+    } else if (ecs_is_alive(world, entity)) {
+        flecs_delete_queue_push(world, entity);
+    }
+
+    world->info.delete_queue_count = flecs_delete_queue_count(world);
+error:
+    return;
+}
+
+int32_t ecs_delete_incremental_run(
+    ecs_world_t *world,
+    double time_budget_seconds)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(!ecs_is_deferred(world), ECS_INVALID_OPERATION,
+        "cannot run incremental delete while world is deferred");
+
+    ecs_delete_queue_t *q = &world->delete_queue;
+    ecs_time_t start = {0}, cur = {0};
+    bool time_budget = false;
+
+    if (ECS_NEQZERO(time_budget_seconds)) {
+        ecs_time_measure(&start);
+        time_budget = true;
+    }
+
+    do {
+        int32_t leaf_count = ecs_vec_count(&q->leaves);
+        if (leaf_count) {
+            /* Copy batch, as observers could queue more entities */
+            ecs_entity_t batch[FLECS_DELETE_QUEUE_BATCH];
+            int32_t count = leaf_count;
+            if (count > FLECS_DELETE_QUEUE_BATCH) {
+                count = FLECS_DELETE_QUEUE_BATCH;
+            }
+
+            ecs_entity_t *leaves = ecs_vec_first_t(&q->leaves, ecs_entity_t);
+            ecs_os_memcpy_n(batch, &leaves[leaf_count - count], 
+                ecs_entity_t, count);
+            ecs_vec_set_count_t(NULL, &q->leaves, ecs_entity_t, 
+                leaf_count - count);
+            ecs_delete_many(world, count, batch);
+        } else if (ecs_vec_count(&q->stack)) {
+            ecs_delete_queue_elem_t *elem = ecs_vec_last_t(
+                &q->stack, ecs_delete_queue_elem_t);
+            ecs_entity_t entity = elem->entity;
+            if (!elem->expanded && ecs_is_alive(world, entity)) {
+                /* Delete children first. Children are pushed on top of the
+                 * entity, so it's deleted once they're gone. */
+                elem->expanded = true;
+                flecs_delete_queue_expand(world, entity);
+            } else {
+                ecs_vec_remove_last(&q->stack);
+                ecs_delete(world, entity);
+            }
+        } else {
+            break;
+        }
+
+        if (time_budget) {
+            cur = start;
+            if (ecs_time_measure(&cur) > time_budget_seconds) {
+                break;
+            }
+        }
+    } while (true);
+
+    world->info.delete_queue_count = flecs_delete_queue_count(world);
+    return world->info.delete_queue_count;
+error:
+    return 0;
+}
+
+void ecs_enable_parallel_delete(
+    ecs_world_t *world,
+    bool enable)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ECS_BIT_COND(world->flags, EcsWorldParallelDelete, enable);
+}
+
 void ecs_remove_all(
     ecs_world_t *world,
     ecs_id_t id)
@@ -17492,6 +19833,10 @@ bool ecs_os_has_task_support(void) {
         (ecs_os_api.task_join_ != NULL);
 }
 
+bool ecs_os_has_parallel_for(void) {
+    return ecs_os_api.parallel_for_ != NULL;
+}
+
 bool ecs_os_has_time(void) {
     return 
         (ecs_os_api.get_time_ != NULL) &&
@@ -18222,6 +20567,9 @@ void flecs_stage_merge(
             "mismatching defer_begin/defer_end detected");
         flecs_defer_end(world, stage);
     } else {
+        /* Add commands enqueued from threads without a stage */
+        flecs_async_queue_drain(world);
+
         /* Merge stages. Only merge if the stage has auto_merging turned on, or 
          * if this is a forced merge (like when ecs_merge is called) */
         int32_t i, count = ecs_get_stage_count(world);
@@ -19638,6 +21986,7 @@ const ecs_entity_t EcsUnion =                       FLECS_HI_COMPONENT_ID + 55;
 /* Misc */
 const ecs_entity_t ecs_id(EcsDefaultChildComponent) = FLECS_HI_COMPONENT_ID + 56;
 const ecs_entity_t EcsOrderedChildren =               FLECS_HI_COMPONENT_ID + 57;
+const ecs_entity_t EcsDirtyRows =                     FLECS_HI_COMPONENT_ID + 58;
 
 /* Builtin predicate ids (used by query engine) */
 const ecs_entity_t EcsPredEq =                      FLECS_HI_COMPONENT_ID + 59;
@@ -19730,6 +22079,7 @@ static ecs_entity_t ecs_default_lookup_path[2] = { 0, 0 };
 #ifdef FLECS_ALERTS
 ECS_COMPONENT_DECLARE(EcsAlert);
 ECS_COMPONENT_DECLARE(EcsAlertInstance);
+ECS_COMPONENT_DECLARE(EcsAlertStats);
 ECS_COMPONENT_DECLARE(EcsAlertsActive);
 ECS_TAG_DECLARE(EcsAlertInfo);
 ECS_TAG_DECLARE(EcsAlertWarning);
@@ -20216,6 +22566,7 @@ void flecs_fini_store(ecs_world_t *world) {
     flecs_table_fini(world, &world->store.root);
     flecs_entities_clear(world);
     flecs_hashmap_fini(&world->store.table_map);
+    flecs_table_edge_cache_fini(world);
 
     ecs_assert(ecs_vec_count(&world->store.marked_ids) == 0, 
         ECS_INTERNAL_ERROR, NULL);
@@ -20463,6 +22814,9 @@ ecs_world_t *ecs_mini(void) {
     flecs_name_index_init(&world->symbols, a);
     ecs_vec_init_t(a, &world->fini_actions, ecs_action_elem_t, 0);
     ecs_vec_init_t(a, &world->component_ids, ecs_id_t, 0);
+    ecs_vec_init_t(a, &world->delete_queue.stack, ecs_delete_queue_elem_t, 0);
+    ecs_vec_init_t(a, &world->delete_queue.leaves, ecs_entity_t, 0);
+    ecs_vec_init_t(a, &world->observer_yield_queue, ecs_observer_t*, 0);
 
     world->info.time_scale = 1.0;
     if (ecs_os_has_time()) {
@@ -20470,6 +22824,7 @@ ecs_world_t *ecs_mini(void) {
     }
 
     ecs_set_stage_count(world, 1);
+    flecs_async_queue_init(&world->async_queue);
     ecs_default_lookup_path[0] = EcsFlecsCore;
     ecs_set_lookup_path(world, ecs_default_lookup_path);
     flecs_init_store(world);
@@ -20707,6 +23062,16 @@ int ecs_fini(
 
     world->flags |= EcsWorldQuit;
 
+    /* Queries in the plan cache reference entities that are about to be 
+     * deleted, so release them first */
+    flecs_query_plan_cache_fini(world);
+
+    /* Don't invalidate cached paths one by one while deleting entities */
+    flecs_path_cache_fini(world);
+
+    /* Remaining entities in the incremental delete queue are deleted below */
+    flecs_delete_queue_fini(world);
+
     /* Delete root entities first using regular APIs. This ensures that cleanup
      * policies get a chance to execute. */
     ecs_dbg_1("#[bold]cleanup root entities");
@@ -20765,7 +23130,10 @@ int ecs_fini(
     flecs_name_index_fini(&world->aliases);
     flecs_name_index_fini(&world->symbols);
     ecs_set_stage_count(world, 0);
+    flecs_async_queue_fini(&world->async_queue);
     ecs_vec_fini_t(&world->allocator, &world->component_ids, ecs_id_t);
+    ecs_vec_fini_t(&world->allocator, &world->observer_yield_queue, 
+        ecs_observer_t*);
     ecs_log_pop_1();
 
     flecs_world_allocators_fini(world);
@@ -20841,6 +23209,18 @@ error:
     return;
 }
 
+void ecs_precise_frame_pacing(
+    ecs_world_t *world,
+    bool enable)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(ecs_os_has_time(), ECS_MISSING_OS_API, NULL);
+    ECS_BIT_COND(world->flags, EcsWorldPreciseFramePacing, enable);
+    world->frame_deadline = 0;
+error:
+    return;
+}
+
 void ecs_set_default_query_flags(
     ecs_world_t *world,
     ecs_flags32_t flags)
@@ -21220,6 +23600,144 @@ done:
     return delete_count;
 }
 
+void ecs_set_table_gc(
+    ecs_world_t *world,
+    const ecs_table_gc_desc_t *desc)
+{
+    flecs_poly_assert(world, ecs_world_t);
+
+    if (desc) {
+        ecs_check(desc->clear_frames >= 0, ECS_INVALID_PARAMETER, NULL);
+        ecs_check(desc->delete_frames >= 0, ECS_INVALID_PARAMETER, NULL);
+        world->store.table_gc = *desc;
+    } else {
+        ecs_os_zeromem(&world->store.table_gc);
+    }
+error:
+    return;
+}
+
+void ecs_enable_union_index(
+    ecs_world_t *world,
+    bool enable)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ECS_BIT_COND(world->flags, EcsWorldUnionIndex, enable);
+}
+
+/* Visit one table. Returns true if the table was cleared or deleted. */
+static
+bool flecs_table_gc_visit(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int64_t frame)
+{
+    const ecs_table_gc_desc_t *desc = &world->store.table_gc;
+    ecs_table__t *meta = table->_;
+
+    /* If the table was used since the last visit, it was reused */
+    if (ecs_table_count(table) || (meta->gc_frame && 
+        (meta->gc_version != table->version))) 
+    {
+        if (meta->gc_pooled) {
+            meta->gc_pooled = false;
+            world->info.table_pool_count --;
+            world->info.table_pool_hit_total ++;
+        }
+
+        meta->gc_frame = 0;
+        if (ecs_table_count(table)) {
+            return false;
+        }
+    }
+
+    if (!meta->gc_frame) {
+        meta->gc_frame = frame + 1;
+        meta->gc_version = table->version;
+        return false;
+    }
+
+    int64_t empty_frames = frame - (meta->gc_frame - 1);
+
+    if (desc->delete_frames && (empty_frames >= desc->delete_frames)) {
+        flecs_table_fini(world, table);
+        world->info.table_gc_delete_total ++;
+        return true;
+    }
+
+    if (desc->clear_frames && !meta->gc_pooled && 
+        (empty_frames >= desc->clear_frames)) 
+    {
+        flecs_table_shrink(world, table);
+        meta->gc_pooled = true;
+        world->info.table_pool_count ++;
+        return true;
+    }
+
+    return false;
+}
+
+void flecs_table_gc_run(
+    ecs_world_t *world)
+{
+    const ecs_table_gc_desc_t *desc = &world->store.table_gc;
+    if (!desc->clear_frames && !desc->delete_frames) {
+        return;
+    }
+
+    ecs_os_perf_trace_push("flecs.table_gc");
+
+    ecs_time_t start = {0}, cur = {0};
+    bool time_budget = false;
+    int32_t measure_budget_after = 64;
+    double time_budget_seconds = desc->time_budget_seconds;
+    int64_t frame = world->info.frame_count_total;
+
+    if (ECS_NEQZERO(time_budget_seconds)) {
+        ecs_time_measure(&start);
+        time_budget = true;
+    }
+
+    /* Visit each table at most once, continue where the last run stopped.
+     * Iterate backwards, so that deleting a table (which moves the last table
+     * to the deleted index) doesn't skip tables. */
+    int32_t visit, count = flecs_sparse_count(&world->store.tables);
+    int32_t i = world->store.table_gc_cursor;
+    for (visit = 0; visit < count; visit ++) {
+        int32_t cur_count = flecs_sparse_count(&world->store.tables);
+        if (!cur_count) {
+            break;
+        }
+
+        if ((i < 0) || (i >= cur_count)) {
+            i = cur_count - 1;
+        }
+
+        ecs_table_t *table = flecs_sparse_get_dense_t(&world->store.tables,
+            ecs_table_t, i);
+        i --;
+
+        if (table->id && !table->_->lock) {
+            if (flecs_table_gc_visit(world, table, frame)) {
+                measure_budget_after = 1;
+            }
+        }
+
+        if (time_budget && !(-- measure_budget_after)) {
+            cur = start;
+            if (ecs_time_measure(&cur) > time_budget_seconds) {
+                break;
+            }
+
+            measure_budget_after = 64;
+        }
+    }
+
+    world->store.table_gc_cursor = i;
+
+    ecs_os_perf_trace_pop("flecs.table_gc");
+}
+
 ecs_entities_t ecs_get_entities(
     const ecs_world_t *world)
 {
@@ -21355,9 +23873,18 @@ error:
 
 ECS_COMPONENT_DECLARE(FlecsAlerts);
 
+/* Alert instance bookkeeping, stored in a sparse set indexed by source */
+typedef struct flecs_alert_instance_t {
+    ecs_entity_t source;        /* Entity that triggered the alert */
+    ecs_entity_t instance;      /* Alert instance entity */
+    uint64_t table_id;          /* Table of source at last evaluation */
+    int32_t dirty_state;        /* Dirty state of member column at last evaluation */
+    bool matched;               /* Result of last evaluation */
+} flecs_alert_instance_t;
+
 typedef struct EcsAlert {
     char *message;
-    ecs_map_t instances;        /* Active instances for metric */
+    ecs_sparse_t instances;     /* Instances for metric (flecs_alert_instance_t) */
     ecs_ftime_t retain_period;  /* How long to retain the alert */
     ecs_vec_t severity_filters; /* Severity filters */
     
@@ -21369,6 +23896,10 @@ typedef struct EcsAlert {
     ecs_primitive_kind_t kind;  /* Primitive type kind */
     ecs_ref_t ranges;           /* Reference to ranges component */
     int32_t var_id;             /* Variable from which to obtain data (0 = $this) */
+    EcsMemberRanges prev_ranges; /* Ranges used in last evaluation */
+
+    /* Only reevaluate tables & instances that changed since last evaluation */
+    bool incremental;
 } EcsAlert;
 
 typedef struct EcsAlertTimeout {
@@ -21381,14 +23912,14 @@ ECS_COMPONENT_DECLARE(EcsAlertTimeout);
 static
 ECS_CTOR(EcsAlert, ptr, {
     ecs_os_zeromem(ptr);
-    ecs_map_init(&ptr->instances, NULL);
+    flecs_sparse_init_t(&ptr->instances, NULL, NULL, flecs_alert_instance_t);
     ecs_vec_init_t(NULL, &ptr->severity_filters, ecs_alert_severity_filter_t, 0);
 })
 
 static
 ECS_DTOR(EcsAlert, ptr, {
     ecs_os_free(ptr->message);
-    ecs_map_fini(&ptr->instances);
+    flecs_sparse_fini(&ptr->instances);
     ecs_vec_fini_t(NULL, &ptr->severity_filters, ecs_alert_severity_filter_t);
 })
 
@@ -21398,9 +23929,9 @@ ECS_MOVE(EcsAlert, dst, src, {
     dst->message = src->message;
     src->message = NULL;
 
-    ecs_map_fini(&dst->instances);
+    flecs_sparse_fini(&dst->instances);
     dst->instances = src->instances;
-    src->instances = (ecs_map_t){0};
+    src->instances = (ecs_sparse_t){0};
 
     ecs_vec_fini_t(NULL, &dst->severity_filters, ecs_alert_severity_filter_t);
     dst->severity_filters = src->severity_filters;
@@ -21414,6 +23945,8 @@ ECS_MOVE(EcsAlert, dst, src, {
     dst->kind = src->kind;
     dst->ranges = src->ranges;
     dst->var_id = src->var_id;
+    dst->prev_ranges = src->prev_ranges;
+    dst->incremental = src->incremental;
 })
 
 static
@@ -21540,7 +24073,7 @@ ecs_entity_t flecs_alert_get_severity(
 
 static
 ecs_entity_t flecs_alert_out_of_range_kind(
-    EcsAlert *alert,
+    const EcsAlert *alert,
     const EcsMemberRanges *ranges,
     const void *value_ptr)
 {
@@ -21583,11 +24116,141 @@ ecs_entity_t flecs_alert_out_of_range_kind(
     }
 }
 
+static
+flecs_alert_instance_t* flecs_alert_get_instance(
+    EcsAlert *alert,
+    ecs_entity_t source)
+{
+    flecs_alert_instance_t *inst = flecs_sparse_get_t(
+        &alert->instances, flecs_alert_instance_t, source);
+    if (inst && inst->source != source) {
+        /* Instance was created for a deleted entity with the same index */
+        return NULL;
+    }
+    return inst;
+}
+
+static
+void flecs_alert_add_instance(
+    EcsAlert *alert,
+    ecs_entity_t source,
+    ecs_entity_t instance)
+{
+    flecs_alert_instance_t *inst = flecs_sparse_get_t(
+        &alert->instances, flecs_alert_instance_t, source);
+    if (!inst) {
+        inst = flecs_sparse_insert_t(
+            &alert->instances, flecs_alert_instance_t, source);
+    }
+    ecs_assert(inst != NULL, ECS_INTERNAL_ERROR, NULL);
+    inst->source = source;
+    inst->instance = instance;
+    inst->table_id = 0;
+    inst->dirty_state = -1; /* Force evaluation */
+    inst->matched = false;
+}
+
+static
+void flecs_alert_remove_instance(
+    EcsAlert *alert,
+    ecs_entity_t source,
+    ecs_entity_t instance)
+{
+    flecs_alert_instance_t *inst = flecs_alert_get_instance(alert, source);
+    if (inst && inst->instance == instance) {
+        flecs_sparse_remove_t(&alert->instances, flecs_alert_instance_t, source);
+    }
+}
+
+/* Force evaluation of all alert instances, used when member ranges change */
+static
+void flecs_alert_reset_instances(
+    EcsAlert *alert)
+{
+    int32_t i, count = flecs_sparse_count(&alert->instances);
+    for (i = 0; i < count; i ++) {
+        flecs_alert_instance_t *inst = flecs_sparse_get_dense_t(
+            &alert->instances, flecs_alert_instance_t, i);
+        inst->dirty_state = -1;
+    }
+}
+
+/* Get dirty state of the table column with the monitored member */
+static
+int32_t flecs_alert_dirty_state(
+    ecs_world_t *world,
+    const EcsAlert *alert,
+    ecs_table_t *table)
+{
+    if (!alert->id) {
+        return 0;
+    }
+
+    int32_t column = ecs_table_get_column_index(world, table, alert->id);
+    if (column == -1) {
+        return 0;
+    }
+
+    return flecs_table_get_dirty_state(world, table)[column + 1];
+}
+
+/* An alert can be evaluated incrementally if whether an entity matches only
+ * depends on the table of the entity, and on the value of a member that is
+ * stored in a table column which is monitored by the alert query. */
+static
+bool flecs_alert_is_incremental(
+    const ecs_query_t *q,
+    const EcsAlert *alert)
+{
+    if (q->cache_kind == EcsQueryCacheNone) {
+        return false;
+    }
+
+    if (!(q->flags & EcsQueryIsCacheable) || 
+        !(q->flags & EcsQueryMatchOnlySelf)) 
+    {
+        return false;
+    }
+
+    if (q->var_count > 1) {
+        return false;
+    }
+
+    int32_t i;
+    for (i = 0; i < q->term_count; i ++) {
+        const ecs_term_t *term = &q->terms[i];
+        if (term->flags_ & (EcsTermIsToggle|EcsTermIsSparse|EcsTermDontFragment)) {
+            return false;
+        }
+    }
+
+    if (!alert->id) {
+        return true;
+    }
+
+    if (alert->var_id) {
+        return false;
+    }
+
+    for (i = 0; i < q->term_count; i ++) {
+        const ecs_term_t *term = &q->terms[i];
+        if (term->id != alert->id || term->oper == EcsNot) {
+            continue;
+        }
+        if (q->read_fields & (1llu << term->field_index)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 static
 void MonitorAlerts(ecs_iter_t *it) {
     ecs_world_t *world = it->real_world;
     EcsAlert *alert = ecs_field(it, EcsAlert, 0);
     EcsPoly *poly = ecs_field(it, EcsPoly, 1);
+    EcsAlertStats *stats = ecs_field(it, EcsAlertStats, 2);
 
     int32_t i, count = it->count;
     for (i = 0; i < count; i ++) {
@@ -21601,16 +24264,38 @@ void MonitorAlerts(ecs_iter_t *it) {
 
         flecs_poly_assert(q, ecs_query_t);
 
+        ecs_time_t start = {0};
+        if (stats) {
+            ecs_time_measure(&start);
+        }
+
         ecs_id_t member_id = alert[i].id;
         const EcsMemberRanges *ranges = NULL;
+        bool incremental = alert[i].incremental;
         if (member_id) {
             ranges = ecs_ref_get(world, &alert[i].ranges, EcsMemberRanges);
+            if (ranges && ecs_os_memcmp_t(
+                ranges, &alert[i].prev_ranges, EcsMemberRanges)) 
+            {
+                /* Ranges changed, reevaluate all tables and instances */
+                alert[i].prev_ranges = *ranges;
+                flecs_alert_reset_instances(&alert[i]);
+                incremental = false;
+            }
         }
 
+        int32_t tables_evaluated = 0, tables_skipped = 0;
         ecs_iter_t rit = ecs_query_iter(world, q);
         rit.flags |= EcsIterNoData;
 
         while (ecs_query_next(&rit)) {
+            if (incremental && !ecs_iter_changed(&rit)) {
+                tables_skipped ++;
+                continue;
+            }
+
+            tables_evaluated ++;
+
             ecs_entity_t severity = flecs_alert_get_severity(
                 world, &rit, &alert[i]);
             if (!severity) {
@@ -21657,9 +24342,9 @@ void MonitorAlerts(ecs_iter_t *it) {
                     }
                 }
 
-                ecs_entity_t *aptr = ecs_map_ensure(&alert[i].instances, e);
-                ecs_assert(aptr != NULL, ECS_INTERNAL_ERROR, NULL);
-                if (!aptr[0]) {
+                flecs_alert_instance_t *inst = flecs_alert_get_instance(
+                    &alert[i], e);
+                if (!inst) {
                     /* Alert does not yet exist for entity */
                     ecs_entity_t ai = ecs_new_w_pair(world, EcsChildOf, a);
                     ecs_set(world, ai, EcsAlertInstance, { .message = NULL });
@@ -21676,21 +24361,95 @@ void MonitorAlerts(ecs_iter_t *it) {
                     ecs_defer_suspend(it->world);
                     flecs_alerts_add_alert_to_src(world, e, a, ai);
                     ecs_defer_resume(it->world);
-                    aptr[0] = ai;
+                    flecs_alert_add_instance(&alert[i], e, ai);
                 } else {
                     /* Make sure alert severity is up to date */
                     if (ecs_vec_count(&alert[i].severity_filters) || member_data) {
                         ecs_entity_t cur_severity = ecs_get_target(
-                            world, aptr[0], ecs_id(EcsAlert), 0);
+                            world, inst->instance, ecs_id(EcsAlert), 0);
                         if (cur_severity != src_severity) {
-                            ecs_add_pair(world, aptr[0], ecs_id(EcsAlert), 
-                                src_severity);
+                            ecs_add_pair(world, inst->instance, 
+                                ecs_id(EcsAlert), src_severity);
                         }
                     }
                 }
             }
         }
+
+        if (stats) {
+            double eval_time = ecs_time_measure(&start);
+            stats[i].eval_time = eval_time;
+            stats[i].eval_time_total += eval_time;
+            stats[i].tables_evaluated = tables_evaluated;
+            stats[i].tables_skipped = tables_skipped;
+            stats[i].instances_evaluated = 0;
+            stats[i].instances_skipped = 0;
+            stats[i].incremental = alert[i].incremental;
+        }
+    }
+}
+
+/* Test if alert instance still matches the alert query. */
+static
+bool flecs_alert_instance_match(
+    ecs_world_t *world,
+    const EcsAlert *alert,
+    const ecs_query_t *query,
+    const EcsMemberRanges *ranges,
+    EcsAlertInstance *alert_instance,
+    ecs_script_vars_t *vars,
+    ecs_entity_t e)
+{
+    ecs_iter_t rit = ecs_query_iter(world, query);
+    rit.flags |= EcsIterNoData;
+    ecs_iter_set_var(&rit, 0, e);
+
+    if (!ecs_query_next(&rit)) {
+        return false;
     }
+
+    /* If alert is monitoring member range, test value against range */
+    if (ranges) {
+        ecs_entity_t member_src = e;
+        if (alert->var_id) {
+            member_src = ecs_iter_get_var(&rit, alert->var_id);
+        }
+
+        const void *member_data = ecs_get_id(world, member_src, alert->id);
+        if (!member_data) {
+            ecs_iter_fini(&rit);
+            return false;
+        }
+
+        member_data = ECS_OFFSET(member_data, alert->offset);
+        if (flecs_alert_out_of_range_kind(alert, ranges, member_data) == 0) {
+            ecs_iter_fini(&rit);
+            return false;
+        }
+    }
+
+    bool generate_message = alert->message;
+    if (generate_message) {
+        if (alert_instance->message) {
+            /* If a message was already generated, only regenerate if
+             * query has multiple variables. Variable values could have 
+             * changed, this ensures the message remains up to date. */
+            generate_message = ecs_iter_get_var_count(&rit) > 1;
+        }
+    }
+
+    if (generate_message) {
+        if (alert_instance->message) {
+            ecs_os_free(alert_instance->message);
+        }
+
+        ecs_script_vars_from_iter(&rit, vars, 0);
+        alert_instance->message = ecs_script_string_interpolate(
+            world, alert->message, vars);
+    }
+
+    ecs_iter_fini(&rit);
+    return true;
 }
 
 static
@@ -21725,12 +24484,18 @@ void MonitorAlertInstances(ecs_iter_t *it) {
 
     flecs_poly_assert(query, ecs_query_t);
 
-    ecs_id_t member_id = alert->id;
+    ecs_time_t start = {0};
+    EcsAlertStats *stats = ecs_get_mut(world, parent, EcsAlertStats);
+    if (stats) {
+        ecs_time_measure(&start);
+    }
+
     const EcsMemberRanges *ranges = NULL;
-    if (member_id) {
+    if (alert->id) {
         ranges = ecs_ref_get(world, &alert->ranges, EcsMemberRanges);
     }
 
+    int32_t instances_evaluated = 0, instances_skipped = 0;
     ecs_script_vars_t *vars = ecs_script_vars_init(it->world);
     int32_t i, count = it->count;
     for (i = 0; i < count; i ++) {
@@ -21740,78 +24505,54 @@ void MonitorAlertInstances(ecs_iter_t *it) {
         /* If source of alert is no longer alive, delete alert instance even if
          * the alert has a retain period. */
         if (!ecs_is_alive(world, e)) {
+            flecs_alert_remove_instance(alert, e, ai);
             ecs_delete(world, ai);
             continue;
         }
 
-        /* Check if alert instance still matches query */
-        ecs_iter_t rit = ecs_query_iter(world, query);
-        rit.flags |= EcsIterNoData;
-        ecs_iter_set_var(&rit, 0, e);
-
-        if (ecs_query_next(&rit)) {
-            bool match = true;
-
-            /* If alert is monitoring member range, test value against range */
-            if (ranges) {
-                ecs_entity_t member_src = e;
-                if (alert->var_id) {
-                    member_src = ecs_iter_get_var(&rit, alert->var_id);
-                }
+        /* If the table and monitored member of an incremental alert didn't 
+         * change since the last evaluation, reuse the previous result. */
+        ecs_table_t *table = flecs_entities_get(world, e)->table;
+        flecs_alert_instance_t *inst = NULL;
+        if (alert->incremental) {
+            inst = flecs_alert_get_instance(alert, e);
+        }
 
-                const void *member_data = ecs_get_id(
-                    world, member_src, member_id);
-                if (!member_data) {
-                    match = false;
-                } else {
-                    member_data = ECS_OFFSET(member_data, alert->offset);
-                    if (flecs_alert_out_of_range_kind(
-                        alert, ranges, member_data) == 0) 
-                    {
-                        match = false;
-                    }
-                }
+        bool match;
+        if (inst && inst->table_id == table->id && 
+            inst->dirty_state == flecs_alert_dirty_state(world, alert, table) &&
+            (alert_instance[i].message || !alert->message))
+        {
+            match = inst->matched;
+            instances_skipped ++;
+        } else {
+            /* Check if alert instance still matches query */
+            match = flecs_alert_instance_match(world, alert, query, ranges,
+                &alert_instance[i], vars, e);
+            if (inst) {
+                inst->table_id = table->id;
+                inst->dirty_state = flecs_alert_dirty_state(
+                    world, alert, table);
+                inst->matched = match;
             }
+            instances_evaluated ++;
+        }
 
-            if (match) {
-                /* Only increase alert duration if the alert was active */
-                value[i].value += (double)it->delta_system_time;
-
-                bool generate_message = alert->message;
-                if (generate_message) {
-                    if (alert_instance[i].message) {
-                        /* If a message was already generated, only regenerate if
-                        * query has multiple variables. Variable values could have 
-                        * changed, this ensures the message remains up to date. */
-                        generate_message = ecs_iter_get_var_count(&rit) > 1;
-                    }
-                }
-
-                if (generate_message) {
-                    if (alert_instance[i].message) {
-                        ecs_os_free(alert_instance[i].message);
-                    }
-
-                    ecs_script_vars_from_iter(&rit, vars, 0);
-                    alert_instance[i].message = ecs_script_string_interpolate(
-                        world, alert->message, vars);
-                }
-
-                if (timeout) {
-                    if (ECS_NEQZERO(timeout[i].inactive_time)) {
-                        /* The alert just became active. Remove Disabled tag */
-                        flecs_alerts_add_alert_to_src(world, e, parent, ai);
-                        ecs_remove_id(world, ai, EcsDisabled);
-                    }
-                    timeout[i].inactive_time = 0;
+        if (match) {
+            /* Only increase alert duration if the alert was active */
+            value[i].value += (double)it->delta_system_time;
+
+            if (timeout) {
+                if (ECS_NEQZERO(timeout[i].inactive_time)) {
+                    /* The alert just became active. Remove Disabled tag */
+                    flecs_alerts_add_alert_to_src(world, e, parent, ai);
+                    ecs_remove_id(world, ai, EcsDisabled);
                 }
-
-                /* Alert instance still matches query, keep it alive */
-                ecs_iter_fini(&rit);
-                continue;
+                timeout[i].inactive_time = 0;
             }
 
-            ecs_iter_fini(&rit);
+            /* Alert instance still matches query, keep it alive */
+            continue;
         }
 
         /* Alert instance is no longer active */
@@ -21832,11 +24573,19 @@ void MonitorAlertInstances(ecs_iter_t *it) {
 
         /* Alert instance no longer matches query, remove it */ 
         flecs_alerts_remove_alert_from_src(world, e, parent);
-        ecs_map_remove(&alert->instances, e);
+        flecs_alert_remove_instance(alert, e, ai);
         ecs_delete(world, ai);
     }
 
     ecs_script_vars_fini(vars);
+
+    if (stats) {
+        double eval_time = ecs_time_measure(&start);
+        stats->eval_time += eval_time;
+        stats->eval_time_total += eval_time;
+        stats->instances_evaluated += instances_evaluated;
+        stats->instances_skipped += instances_skipped;
+    }
 }
 
 ecs_entity_t ecs_alert_init(
@@ -21857,6 +24606,10 @@ ecs_entity_t ecs_alert_init(
 
     ecs_query_desc_t private_desc = desc->query;
     private_desc.entity = result;
+    if (desc->incremental && private_desc.cache_kind != EcsQueryCacheNone) {
+        /* Used to only reevaluate tables that changed */
+        private_desc.flags |= EcsQueryDetectChanges;
+    }
 
     ecs_query_t *q = ecs_query_init(world, &private_desc);
     if (!q) {
@@ -21963,10 +24716,18 @@ ecs_entity_t ecs_alert_init(
         alert->kind = pr->kind;
         alert->ranges = ecs_ref_init(world, desc->member, EcsMemberRanges);
         alert->var_id = var_id;
+        alert->prev_ranges = *ecs_get(world, desc->member, EcsMemberRanges);
     }
 
+    alert->incremental = desc->incremental && 
+        flecs_alert_is_incremental(q, alert);
+
     ecs_modified(world, result, EcsAlert);
 
+    ecs_set(world, result, EcsAlertStats, { 
+        .incremental = alert->incremental 
+    });
+
     /* Register alert as metric */
     ecs_add(world, result, EcsMetric);
     ecs_add_pair(world, result, EcsMetric, EcsCounter);
@@ -22070,6 +24831,7 @@ void FlecsAlertsImport(ecs_world_t *world) {
     ecs_set_name_prefix(world, "EcsAlert");
     ECS_COMPONENT_DEFINE(world, EcsAlertInstance);
     ECS_COMPONENT_DEFINE(world, EcsAlertTimeout);
+    ECS_COMPONENT_DEFINE(world, EcsAlertStats);
 
     ECS_TAG_DEFINE(world, EcsAlertInfo);
     ECS_TAG_DEFINE(world, EcsAlertWarning);
@@ -22087,6 +24849,19 @@ void FlecsAlertsImport(ecs_world_t *world) {
         }
     });
 
+    ecs_struct(world, {
+        .entity = ecs_id(EcsAlertStats),
+        .members = {
+            { .name = "eval_time", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds },
+            { .name = "eval_time_total", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds },
+            { .name = "tables_evaluated", .type = ecs_id(ecs_i32_t) },
+            { .name = "tables_skipped", .type = ecs_id(ecs_i32_t) },
+            { .name = "instances_evaluated", .type = ecs_id(ecs_i32_t) },
+            { .name = "instances_skipped", .type = ecs_id(ecs_i32_t) },
+            { .name = "incremental", .type = ecs_id(ecs_bool_t) }
+        }
+    });
+
     ecs_set_hooks(world, EcsAlert, {
         .ctor = ecs_ctor(EcsAlert),
         .dtor = ecs_dtor(EcsAlert),
@@ -22117,7 +24892,8 @@ void FlecsAlertsImport(ecs_world_t *world) {
 
     ECS_SYSTEM(world, MonitorAlerts, EcsPreStore, 
         Alert, 
-        (Poly, Query));
+        (Poly, Query),
+        ?Stats);
 
     ECS_SYSTEM(world, MonitorAlertInstances, EcsOnStore, Instance, 
         flecs.metrics.Source, 
@@ -25688,6 +28464,9 @@ int ecs_log_last_error(void)
 
 #ifdef FLECS_METRICS
 
+#include <ctype.h> // isdigit, isalnum
+#include <math.h> // isinf, used by ecs_os_isinf
+
 /* Public components */
 ECS_COMPONENT_DECLARE(FlecsMetrics);
 ECS_TAG_DECLARE(EcsMetricInstance);
@@ -25708,6 +28487,8 @@ static ECS_COMPONENT_DECLARE(EcsMetricCountTargets);
 static ECS_COMPONENT_DECLARE(EcsMetricMemberInstance);
 static ECS_COMPONENT_DECLARE(EcsMetricIdInstance);
 static ECS_COMPONENT_DECLARE(EcsMetricOneOfInstance);
+static ECS_COMPONENT_DECLARE(EcsMetricLabel);
+static ECS_COMPONENT_DECLARE(EcsMetricExporter);
 
 /** Context for metric */
 typedef struct {
@@ -25786,6 +28567,20 @@ typedef struct {
     ecs_oneof_metric_ctx_t *ctx;
 } EcsMetricOneOfInstance;
 
+/** Labels of metric instance in Prometheus format, cached between scrapes */
+typedef struct {
+    char *value;                     /**< Serialized labels, without braces */
+    ecs_size_t length;               /**< Length of value */
+    ecs_entity_t source;             /**< Source for which value was created */
+} EcsMetricLabel;
+
+/** State reused between Prometheus scrapes */
+typedef struct {
+    ecs_query_t *query;              /**< Query for metric instances */
+    char *buf;                       /**< Output of last scrape */
+    ecs_size_t size;                 /**< Size of output buffer */
+} EcsMetricExporter;
+
 /** Component lifecycle */
 
 static ECS_DTOR(EcsMetricMember, ptr, {
@@ -25830,6 +28625,33 @@ static ECS_MOVE(EcsMetricCountTargets, dst, src, {
     src->ctx = NULL;
 })
 
+static ECS_COPY(EcsMetricLabel, dst, src, {
+    ecs_os_free(dst->value);
+    dst->value = src->value ? ecs_os_strdup(src->value) : NULL;
+    dst->length = src->length;
+    dst->source = src->source;
+})
+
+static ECS_MOVE(EcsMetricLabel, dst, src, {
+    ecs_os_free(dst->value);
+    *dst = *src;
+    src->value = NULL;
+})
+
+static ECS_DTOR(EcsMetricLabel, ptr, {
+    ecs_os_free(ptr->value);
+})
+
+static ECS_MOVE(EcsMetricExporter, dst, src, {
+    ecs_os_free(dst->buf);
+    *dst = *src;
+    src->buf = NULL;
+})
+
+static ECS_DTOR(EcsMetricExporter, ptr, {
+    ecs_os_free(ptr->buf);
+})
+
 /** Observer used for creating new instances of member metric */
 static void flecs_metrics_on_member_metric(ecs_iter_t *it) {
     ecs_world_t *world = it->world;
@@ -25848,6 +28670,7 @@ static void flecs_metrics_on_member_metric(ecs_iter_t *it) {
         ecs_modified(world, m, EcsMetricMemberInstance);
         ecs_set(world, m, EcsMetricValue, { 0 });
         ecs_set(world, m, EcsMetricSource, { e });
+        ecs_add(world, m, EcsMetricLabel);
         ecs_add(world, m, EcsMetricInstance);
         ecs_add_pair(world, m, EcsMetric, ctx->metric.kind);
     }
@@ -25870,6 +28693,7 @@ static void flecs_metrics_on_id_metric(ecs_iter_t *it) {
         ecs_modified(world, m, EcsMetricIdInstance);
         ecs_set(world, m, EcsMetricValue, { 0 });
         ecs_set(world, m, EcsMetricSource, { e });
+        ecs_add(world, m, EcsMetricLabel);
         ecs_add(world, m, EcsMetricInstance);
         ecs_add_pair(world, m, EcsMetric, ctx->metric.kind);
     }
@@ -25896,6 +28720,7 @@ static void flecs_metrics_on_oneof_metric(ecs_iter_t *it) {
         ecs_modified(world, m, EcsMetricOneOfInstance);
         ecs_add_pair(world, m, ctx->metric.metric, ecs_id(EcsMetricValue));
         ecs_set(world, m, EcsMetricSource, { e });
+        ecs_add(world, m, EcsMetricLabel);
         ecs_add(world, m, EcsMetricInstance);
         ecs_add_pair(world, m, EcsMetric, ctx->metric.kind);
     }
@@ -26098,6 +28923,7 @@ static void UpdateCountTargets(ecs_iter_t *it) {
                 EcsMetricSource *source = ecs_ensure(
                     world, mi[0], EcsMetricSource);
                 source->entity = tgt;
+                ecs_add(world, mi[0], EcsMetricLabel);
             }
 
             EcsMetricValue *value = ecs_ensure(world, mi[0], EcsMetricValue);
@@ -26399,6 +29225,8 @@ int flecs_count_ids_metric_init(
 {
     ecs_set(world, metric, EcsMetricCountIds, { .id = desc->id });
     ecs_set(world, metric, EcsMetricValue, { .value = 0 });
+    ecs_add_pair(world, metric, EcsMetric, desc->kind);
+    ecs_add_id(world, metric, EcsMetric);
     return 0;
 }
 
@@ -26511,6 +29339,268 @@ error:
     return 0;
 }
 
+/** Append string, escaped according to the Prometheus text format */
+static
+void flecs_metrics_prom_escape(
+    ecs_strbuf_t *buf,
+    const char *str,
+    bool label)
+{
+    const char *ptr, *start = str;
+    for (ptr = str; *ptr; ptr ++) {
+        char ch = *ptr;
+        if (ch != '\\' && ch != '\n' && (!label || ch != '"')) {
+            continue;
+        }
+
+        ecs_strbuf_appendstrn(buf, start, flecs_ito(int32_t, ptr - start));
+        ecs_strbuf_appendch(buf, '\\');
+        ecs_strbuf_appendch(buf, ch == '\n' ? 'n' : ch);
+        start = ptr + 1;
+    }
+
+    ecs_strbuf_appendstrn(buf, start, flecs_ito(int32_t, ptr - start));
+}
+
+/** Prometheus metric names may only contain [a-zA-Z0-9_:] */
+static
+char* flecs_metrics_prom_name(
+    const ecs_world_t *world,
+    ecs_entity_t metric)
+{
+    char *path = ecs_get_path(world, metric);
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    if (isdigit((unsigned char)path[0])) {
+        ecs_strbuf_appendch(&buf, '_');
+    }
+
+    char *ptr;
+    for (ptr = path; *ptr; ptr ++) {
+        if (!isalnum((unsigned char)*ptr) && *ptr != ':') {
+            *ptr = '_';
+        }
+    }
+
+    ecs_strbuf_appendstr(&buf, path);
+    ecs_os_free(path);
+    return ecs_strbuf_get(&buf);
+}
+
+static
+void flecs_metrics_prom_value(
+    ecs_strbuf_t *buf,
+    double value)
+{
+    if (ecs_os_isinf(value)) {
+        if (value > 0) {
+            ecs_strbuf_appendlit(buf, "+Inf");
+        } else {
+            ecs_strbuf_appendlit(buf, "-Inf");
+        }
+    } else {
+        ecs_strbuf_appendflt(buf, value, 0);
+    }
+}
+
+/** Serialize labels of metric instance. Labels only depend on the source, so
+ * they are only created once per instance instead of for each scrape. */
+static
+bool flecs_metrics_prom_label(
+    const ecs_world_t *world,
+    EcsMetricLabel *label,
+    ecs_entity_t source)
+{
+    if (label->value && label->source == source) {
+        return true;
+    }
+
+    if (!ecs_is_alive(world, source)) {
+        /* Instance will be deleted by ClearMetricInstance */
+        return false;
+    }
+
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    ecs_strbuf_appendlit(&buf, "entity=\"");
+    char *path = ecs_get_path(world, source);
+    flecs_metrics_prom_escape(&buf, path, true);
+    ecs_os_free(path);
+    ecs_strbuf_appendch(&buf, '"');
+
+    ecs_os_free(label->value);
+    label->length = ecs_strbuf_written(&buf);
+    label->value = ecs_strbuf_get(&buf);
+    label->source = source;
+    return true;
+}
+
+static
+void flecs_metrics_prom_sample(
+    ecs_strbuf_t *buf,
+    const char *name,
+    ecs_size_t name_len,
+    const EcsMetricLabel *label,
+    const char *target,
+    double value)
+{
+    ecs_strbuf_appendstrn(buf, name, name_len);
+    if (label) {
+        ecs_strbuf_appendch(buf, '{');
+        ecs_strbuf_appendstrn(buf, label->value, label->length);
+        if (target) {
+            ecs_strbuf_appendlit(buf, ",target=\"");
+            flecs_metrics_prom_escape(buf, target, true);
+            ecs_strbuf_appendch(buf, '"');
+        }
+        ecs_strbuf_appendch(buf, '}');
+    }
+    ecs_strbuf_appendch(buf, ' ');
+    flecs_metrics_prom_value(buf, value);
+    ecs_strbuf_appendch(buf, '\n');
+}
+
+/** Serialize instances of a metric. Values are read directly from the tables
+ * of the instances, which the exporter query groups by metric. */
+static
+void flecs_metrics_prom_instances(
+    ecs_world_t *world,
+    const EcsMetricExporter *exporter,
+    ecs_strbuf_t *buf,
+    ecs_entity_t metric,
+    const char *name,
+    ecs_size_t name_len)
+{
+    const EcsStruct *oneof = NULL;
+    ecs_size_t oneof_size = 0;
+    if (ecs_has(world, metric, EcsMetricOneOf)) {
+        oneof = ecs_get(world, metric, EcsStruct);
+        oneof_size = ecs_get(world, metric, EcsComponent)->size;
+    }
+
+    ecs_iter_t it = ecs_query_iter(world, exporter->query);
+    ecs_iter_set_group(&it, metric);
+    while (ecs_query_next(&it)) {
+        const EcsMetricSource *src = ecs_field(&it, EcsMetricSource, 0);
+        EcsMetricLabel *label = ecs_field(&it, EcsMetricLabel, 1);
+        const EcsMetricValue *value = ecs_field(&it, EcsMetricValue, 2);
+        const void *oneof_value = NULL;
+        if (oneof) {
+            oneof_value = ecs_table_get_id(world, it.table,
+                ecs_pair(metric, ecs_id(EcsMetricValue)), it.offset);
+        }
+
+        if (!value && !oneof_value) {
+            continue;
+        }
+
+        int32_t i, count = it.count;
+        for (i = 0; i < count; i ++) {
+            if (!flecs_metrics_prom_label(world, &label[i], src[i].entity)) {
+                continue;
+            }
+
+            if (value) {
+                flecs_metrics_prom_sample(
+                    buf, name, name_len, &label[i], NULL, value[i].value);
+                continue;
+            }
+
+            const double *v = ECS_ELEM(oneof_value, oneof_size, i);
+            ecs_member_t *members = ecs_vec_first(&oneof->members);
+            int32_t m, member_count = ecs_vec_count(&oneof->members);
+            for (m = 0; m < member_count; m ++) {
+                flecs_metrics_prom_sample(buf, name, name_len, &label[i],
+                    members[m].name, *(double*)ECS_OFFSET(v, members[m].offset));
+            }
+        }
+    }
+}
+
+static
+void flecs_metrics_prom_metric(
+    ecs_world_t *world,
+    const EcsMetricExporter *exporter,
+    ecs_strbuf_t *buf,
+    ecs_entity_t metric)
+{
+    char *name = flecs_metrics_prom_name(world, metric);
+    ecs_size_t name_len = ecs_os_strlen(name);
+
+#ifdef FLECS_DOC
+    const char *brief = ecs_doc_get_brief(world, metric);
+    if (brief) {
+        ecs_strbuf_appendlit(buf, "# HELP ");
+        ecs_strbuf_appendstrn(buf, name, name_len);
+        ecs_strbuf_appendch(buf, ' ');
+        flecs_metrics_prom_escape(buf, brief, false);
+        ecs_strbuf_appendch(buf, '\n');
+    }
+#endif
+
+    ecs_entity_t kind = ecs_get_target(world, metric, EcsMetric, 0);
+    ecs_strbuf_appendlit(buf, "# TYPE ");
+    ecs_strbuf_appendstrn(buf, name, name_len);
+    if (kind == EcsGauge) {
+        ecs_strbuf_appendlit(buf, " gauge\n");
+    } else {
+        ecs_strbuf_appendlit(buf, " counter\n");
+    }
+
+    /* Metrics that count ids without targets store value on metric entity */
+    const EcsMetricValue *value = ecs_get(world, metric, EcsMetricValue);
+    if (value) {
+        flecs_metrics_prom_sample(
+            buf, name, name_len, NULL, NULL, value->value);
+    } else {
+        flecs_metrics_prom_instances(
+            world, exporter, buf, metric, name, name_len);
+    }
+
+    ecs_os_free(name);
+}
+
+const char* ecs_metrics_to_prometheus(
+    ecs_world_t *world)
+{
+    flecs_poly_assert(world, ecs_world_t);
+
+    if (!ecs_id(EcsMetricExporter) || 
+        !ecs_is_alive(world, ecs_id(EcsMetricExporter))) 
+    {
+        /* Metrics module is not imported */
+        return NULL;
+    }
+
+    EcsMetricExporter *exporter = ecs_singleton_get_mut(
+        world, EcsMetricExporter);
+    if (!exporter) {
+        return NULL;
+    }
+
+    /* Reuse buffer of previous scrape, so that it doesn't have to grow */
+    if (!exporter->buf) {
+        exporter->size = ECS_STRBUF_SMALL_STRING_SIZE;
+        exporter->buf = ecs_os_malloc(exporter->size);
+    }
+
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    buf.content = exporter->buf;
+    buf.size = exporter->size;
+
+    ecs_iter_t it = ecs_each_id(world, EcsMetric);
+    while (ecs_each_next(&it)) {
+        int32_t i, count = it.count;
+        for (i = 0; i < count; i ++) {
+            flecs_metrics_prom_metric(world, exporter, &buf, it.entities[i]);
+        }
+    }
+
+    ecs_strbuf_appendch(&buf, '\0');
+    exporter->buf = buf.content;
+    exporter->size = buf.size;
+
+    return exporter->buf;
+}
+
 void FlecsMetricsImport(ecs_world_t *world) {
     ECS_MODULE_DEFINE(world, FlecsMetrics);
 
@@ -26539,10 +29629,14 @@ void FlecsMetricsImport(ecs_world_t *world) {
     ECS_COMPONENT_DEFINE(world, EcsMetricOneOf);
     ECS_COMPONENT_DEFINE(world, EcsMetricCountIds);
     ECS_COMPONENT_DEFINE(world, EcsMetricCountTargets);
+    ECS_COMPONENT_DEFINE(world, EcsMetricLabel);
+    ECS_COMPONENT_DEFINE(world, EcsMetricExporter);
 
     ecs_add_id(world, ecs_id(EcsMetricMemberInstance), EcsPrivate);
     ecs_add_id(world, ecs_id(EcsMetricIdInstance), EcsPrivate);
     ecs_add_id(world, ecs_id(EcsMetricOneOfInstance), EcsPrivate);
+    ecs_add_id(world, ecs_id(EcsMetricLabel), EcsPrivate);
+    ecs_add_id(world, ecs_id(EcsMetricExporter), EcsPrivate);
 
     ecs_struct(world, {
         .entity = ecs_id(EcsMetricValue),
@@ -26582,8 +29676,37 @@ void FlecsMetricsImport(ecs_world_t *world) {
         .move = ecs_move(EcsMetricCountTargets)
     });
 
+    ecs_set_hooks(world, EcsMetricLabel, {
+        .ctor = flecs_default_ctor,
+        .copy = ecs_copy(EcsMetricLabel),
+        .move = ecs_move(EcsMetricLabel),
+        .dtor = ecs_dtor(EcsMetricLabel)
+    });
+
+    ecs_set_hooks(world, EcsMetricExporter, {
+        .ctor = flecs_default_ctor,
+        .move = ecs_move(EcsMetricExporter),
+        .dtor = ecs_dtor(EcsMetricExporter)
+    });
+
     ecs_add_id(world, EcsMetric, EcsOneOf);
 
+    /* Instances are grouped by metric, so that the exporter can iterate the
+     * instances of one metric without searching */
+    ecs_singleton_set(world, EcsMetricExporter, {
+        .query = ecs_query(world, {
+            .entity = ecs_entity(world, { .name = "PrometheusExporter" }),
+            .terms = {
+                { .id = ecs_id(EcsMetricSource), .inout = EcsIn },
+                { .id = ecs_id(EcsMetricLabel) },
+                { .id = ecs_id(EcsMetricValue), .inout = EcsIn,
+                    .oper = EcsOptional }
+            },
+            .cache_kind = EcsQueryCacheAuto,
+            .group_by = EcsChildOf
+        })
+    });
+
 #ifdef FLECS_DOC
     ECS_OBSERVER(world, SetMetricDocName, EcsOnSet, 
         Source);
@@ -26894,6 +30017,8 @@ typedef struct ecs_pipeline_op_t {
     int64_t commands_enqueued;  /* Number of commands enqueued for sync point */
     bool multi_threaded;        /* Whether systems can be ran multi threaded */
     bool immediate;           /* Whether systems are staged or not */
+    bool concurrent;            /* Whether systems run concurrently on workers */
+    bool no_merge;              /* Sync threads after op without merging */
 } ecs_pipeline_op_t;
 
 struct ecs_pipeline_state_t {
@@ -26913,6 +30038,18 @@ struct ecs_pipeline_state_t {
     int32_t cur_i;              /* Index in current result */
     int32_t ran_since_merge;    /* Index in current op */
     bool immediate;           /* Is pipeline in readonly mode */
+
+    /* Members for scheduling independent systems concurrently */
+    bool concurrent;            /* Build concurrent ops from system access */
+    int32_t next_system;        /* Next system to claim in concurrent op */
+};
+
+/** Job that is ran by workers instead of the pipeline schedule. */
+struct ecs_worker_job_t {
+    ecs_query_t *query;         /* Query to iterate */
+    ecs_iter_action_t callback; /* Callback to invoke for each result */
+    ecs_os_parallel_job_t action; /* Invoked once per stage instead of query */
+    void *ctx;                  /* Context passed to callback */
 };
 
 typedef struct EcsPipeline {
@@ -26962,6 +30099,23 @@ void flecs_signal_workers(
 void flecs_wait_for_sync(
     ecs_world_t *world);
 
+/* Are workers ran with the OS API parallel_for instead of worker threads */
+bool flecs_workers_use_parallel_for(
+    const ecs_world_t *world);
+
+/* Run current pipeline ops on all stages with the OS API parallel_for */
+int32_t flecs_workers_run_pipeline_ops(
+    ecs_world_t *world,
+    ecs_ftime_t delta_time);
+
+/* Invoke action once for each stage on the worker threads. The world is in
+ * readonly mode while the action runs, and the action is invoked for stage 0
+ * on the calling thread. */
+void flecs_workers_run(
+    ecs_world_t *world,
+    ecs_os_parallel_job_t action,
+    void *ctx);
+
 #endif
 
 
@@ -27676,7 +30830,8 @@ bool flecs_rest_get_query(
     flecs_set_prev_log(ecs_os_api.log_, try);
     ecs_os_api.log_ = flecs_rest_capture_log;
 
-    ecs_query_t *q = ecs_query(world, { .expr = expr });
+    /* Clients typically poll the same queries, so reuse compiled queries */
+    ecs_query_t *q = ecs_query_plan_cache_get(world, expr);
     if (!q) {
         flecs_rest_reply_set_captured_log(reply);
         if (try) {
@@ -27686,7 +30841,6 @@ bool flecs_rest_get_query(
     } else {
         ecs_iter_t it = ecs_query_iter(world, q);
         flecs_rest_iter_to_reply(req, reply, q, &it);
-        ecs_query_fini(q);
     }
 
     ecs_os_api.log_ = prev_log;
@@ -27786,9 +30940,13 @@ void flecs_world_stats_to_json(
     ecs_strbuf_list_push(reply, "{", ",");
     ECS_GAUGE_APPEND(reply, stats, entities.count, "Alive entity ids in the world");
     ECS_GAUGE_APPEND(reply, stats, entities.not_alive_count, "Not alive entity ids in the world");
+    ECS_GAUGE_APPEND(reply, stats, entities.delete_queue_count, "Entities queued for incremental delete");
 
     ECS_GAUGE_APPEND(reply, stats, performance.fps, "Frames per second");
     ECS_COUNTER_APPEND(reply, stats, performance.frame_time, "Time spent in frame");
+    ECS_GAUGE_APPEND(reply, stats, performance.frame_time_p50, "Median time between frames");
+    ECS_GAUGE_APPEND(reply, stats, performance.frame_time_p99, "99th percentile of time between frames");
+    ECS_GAUGE_APPEND(reply, stats, performance.frame_time_max, "Maximum time between frames");
     ECS_COUNTER_APPEND(reply, stats, performance.system_time, "Time spent on running systems in frame");
     ECS_COUNTER_APPEND(reply, stats, performance.emit_time, "Time spent on notifying observers in frame");
     ECS_COUNTER_APPEND(reply, stats, performance.merge_time, "Time spent on merging commands in frame");
@@ -27817,6 +30975,9 @@ void flecs_world_stats_to_json(
     ECS_GAUGE_APPEND(reply, stats, tables.empty_count, "Empty tables in the world");
     ECS_COUNTER_APPEND(reply, stats, tables.create_count, "Number of new tables created");
     ECS_COUNTER_APPEND(reply, stats, tables.delete_count, "Number of tables deleted");
+    ECS_GAUGE_APPEND(reply, stats, tables.pool_count, "Empty tables with storage freed by table GC");
+    ECS_COUNTER_APPEND(reply, stats, tables.pool_hit_count, "Number of times a table freed by table GC was reused");
+    ECS_COUNTER_APPEND(reply, stats, tables.gc_delete_count, "Number of tables deleted by table GC");
 
     ECS_GAUGE_APPEND(reply, stats, components.tag_count, "Tag ids in use");
     ECS_GAUGE_APPEND(reply, stats, components.component_count, "Component ids in use");
@@ -27828,6 +30989,7 @@ void flecs_world_stats_to_json(
     ECS_GAUGE_APPEND(reply, stats, queries.query_count, "Queries in the world");
     ECS_GAUGE_APPEND(reply, stats, queries.observer_count, "Observers in the world");
     ECS_GAUGE_APPEND(reply, stats, queries.system_count, "Systems in the world");
+    ECS_GAUGE_APPEND(reply, stats, queries.observer_yield_count, "Existing observer matches not yet yielded");
 
     ECS_COUNTER_APPEND(reply, stats, memory.alloc_count, "Allocations by OS API");
     ECS_COUNTER_APPEND(reply, stats, memory.realloc_count, "Reallocs by OS API");
@@ -28038,6 +31200,25 @@ bool flecs_rest_get_stats(
         return false;
     }
 }
+
+static
+bool flecs_rest_get_profiler(
+    const ecs_http_request_t* req,
+    ecs_http_reply_t *reply)
+{
+    bool clear = false;
+    flecs_rest_bool_param(req, "clear", &clear);
+
+    char *json = ecs_profiler_to_chrome_trace();
+    ecs_strbuf_appendstr(&reply->body, json);
+    ecs_os_free(json);
+
+    if (clear) {
+        ecs_profiler_clear();
+    }
+
+    return true;
+}
 #else
 static
 bool flecs_rest_get_stats(
@@ -28050,6 +31231,43 @@ bool flecs_rest_get_stats(
     (void)reply;
     return false;
 }
+
+static
+bool flecs_rest_get_profiler(
+    const ecs_http_request_t* req,
+    ecs_http_reply_t *reply)
+{
+    (void)req;
+    (void)reply;
+    return false;
+}
+#endif
+
+#ifdef FLECS_METRICS
+static
+bool flecs_rest_get_metrics(
+    ecs_world_t *world,
+    ecs_http_reply_t *reply)
+{
+    const char *metrics = ecs_metrics_to_prometheus(world);
+    if (!metrics) {
+        return false;
+    }
+
+    ecs_strbuf_appendstr(&reply->body, metrics);
+    reply->content_type = "text/plain; version=0.0.4; charset=utf-8";
+    return true;
+}
+#else
+static
+bool flecs_rest_get_metrics(
+    ecs_world_t *world,
+    ecs_http_reply_t *reply)
+{
+    (void)world;
+    (void)reply;
+    return false;
+}
 #endif
 
 static
@@ -28463,6 +31681,14 @@ bool flecs_rest_reply(
         } else if (!ecs_os_strncmp(req->path, "stats/", 6)) {
             return flecs_rest_get_stats(world, req, reply);
 
+        /* Profiler endpoint */
+        } else if (!ecs_os_strcmp(req->path, "profiler")) {
+            return flecs_rest_get_profiler(req, reply);
+
+        /* Metrics endpoint (Prometheus text format) */
+        } else if (!ecs_os_strcmp(req->path, "metrics")) {
+            return flecs_rest_get_metrics(world, reply);
+
         /* Tables endpoint */
         } else if (!ecs_os_strncmp(req->path, "tables", 6)) {
             return flecs_rest_get_tables(world, req, reply);
@@ -34538,6 +37764,333 @@ void* ecs_query_get_group_ctx(
     }
 }
 
+/**
+ * @file query/plan_cache.c
+ * @brief Cache for queries created from expressions.
+ *
+ * Applications like the REST API create queries from the same expressions
+ * over and over, which means parsing, validating and compiling the query each
+ * time. The plan cache keeps the most recently used queries around so that
+ * they can be reused for the same expression.
+ */
+
+
+/* Whitespace around these characters doesn't change the query */
+static
+bool flecs_query_plan_is_separator(
+    char ch)
+{
+    return ch == ',' || ch == '(' || ch == ')' || ch == '[' || ch == ']' ||
+        ch == '|' || ch == '\0';
+}
+
+/* Normalize expression so that expressions that only differ in whitespace
+ * share the same plan. Returns the length of the normalized expression. */
+static
+ecs_size_t flecs_query_plan_normalize(
+    const char *expr,
+    char *out)
+{
+    const char *ptr = expr;
+    char *cur = out;
+    char quote = 0;
+
+    while (isspace((unsigned char)*ptr)) {
+        ptr ++;
+    }
+
+    for (; *ptr; ptr ++) {
+        char ch = *ptr;
+        if (quote) {
+            if (ch == '\\' && ptr[1]) {
+                *(cur ++) = ch;
+                ch = *(++ ptr);
+            } else if (ch == quote) {
+                quote = 0;
+            }
+            *(cur ++) = ch;
+            continue;
+        }
+
+        if (ch == '"' || ch == '\'') {
+            quote = ch;
+        } else if (isspace((unsigned char)ch)) {
+            const char *next = ptr + 1;
+            while (isspace((unsigned char)*next)) {
+                next ++;
+            }
+
+            char prev = cur != out ? cur[-1] : '\0';
+            ptr = next - 1;
+            if (!flecs_query_plan_is_separator(prev) &&
+                !flecs_query_plan_is_separator(*next))
+            {
+                *(cur ++) = ' ';
+            }
+            continue;
+        }
+
+        *(cur ++) = ch;
+    }
+
+    *cur = '\0';
+    return flecs_ito(ecs_size_t, cur - out);
+}
+
+static
+void flecs_query_plan_unlink(
+    ecs_query_plan_cache_t *cache,
+    ecs_query_plan_t *plan)
+{
+    if (plan->prev) {
+        plan->prev->next = plan->next;
+    } else {
+        cache->first = plan->next;
+    }
+
+    if (plan->next) {
+        plan->next->prev = plan->prev;
+    } else {
+        cache->last = plan->prev;
+    }
+
+    plan->prev = NULL;
+    plan->next = NULL;
+}
+
+static
+void flecs_query_plan_link_first(
+    ecs_query_plan_cache_t *cache,
+    ecs_query_plan_t *plan)
+{
+    plan->next = cache->first;
+    if (cache->first) {
+        cache->first->prev = plan;
+    } else {
+        cache->last = plan;
+    }
+    cache->first = plan;
+}
+
+static
+void flecs_query_plan_free(
+    ecs_world_t *world,
+    ecs_query_plan_t *plan)
+{
+    ecs_query_plan_cache_t *cache = &world->query_plans;
+    flecs_query_plan_unlink(cache, plan);
+    ecs_map_remove(&cache->index, plan->hash);
+    cache->count --;
+
+    ecs_query_fini(plan->query);
+    flecs_free_n(&world->allocator, char, plan->expr_len + 1, plan->expr);
+    flecs_free_t(&world->allocator, ecs_query_plan_t, plan);
+}
+
+static
+bool flecs_query_plan_ref_is(
+    const ecs_term_ref_t *ref,
+    uint32_t entity)
+{
+    return (ref->id & EcsIsEntity) &&
+        ((uint32_t)ECS_TERM_REF_ID(ref) == entity);
+}
+
+/* Test if query uses entity as component, relationship, target or source */
+static
+bool flecs_query_plan_has_ref(
+    const ecs_query_t *q,
+    ecs_entity_t entity)
+{
+    uint32_t e = (uint32_t)entity;
+    int32_t i, count = q->term_count;
+    for (i = 0; i < count; i ++) {
+        const ecs_term_t *term = &q->terms[i];
+        ecs_id_t id = term->id;
+        if (ECS_IS_PAIR(id)) {
+            if (ECS_PAIR_FIRST(id) == e || ECS_PAIR_SECOND(id) == e) {
+                return true;
+            }
+        } else if ((uint32_t)id == e) {
+            return true;
+        }
+
+        if (flecs_query_plan_ref_is(&term->first, e) ||
+            flecs_query_plan_ref_is(&term->second, e) ||
+            flecs_query_plan_ref_is(&term->src, e) ||
+            (uint32_t)term->trav == e)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Test if entities that were resolved when the query was created are alive */
+static
+bool flecs_query_plan_is_valid(
+    const ecs_world_t *world,
+    const ecs_query_t *q)
+{
+    int32_t i, count = q->term_count;
+    for (i = 0; i < count; i ++) {
+        const ecs_term_t *term = &q->terms[i];
+        const ecs_term_ref_t *refs[] = { &term->first, &term->second, &term->src };
+        int32_t r;
+        for (r = 0; r < 3; r ++) {
+            const ecs_term_ref_t *ref = refs[r];
+            if (!(ref->id & EcsIsEntity)) {
+                continue;
+            }
+
+            ecs_entity_t e = ECS_TERM_REF_ID(ref);
+            if (e && !ecs_is_alive(world, e)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/* Cached queries must not prevent deleting the ids they use, as ids can also
+ * be deleted when a parent or relationship target is deleted. Instead of
+ * keeping ids alive, a cached query is validated before it is returned. */
+static
+void flecs_query_plan_release_ids(
+    ecs_world_t *world,
+    ecs_query_t *q)
+{
+    int32_t i, count = q->term_count;
+    for (i = 0; i < count; i ++) {
+        ecs_term_t *term = &q->terms[i];
+        if (!(term->flags_ & EcsTermKeepAlive)) {
+            continue;
+        }
+
+        ecs_component_record_t *cr = flecs_components_get(world, term->id);
+        if (cr) {
+            if (ecs_os_has_threading()) {
+                int32_t cr_keep_alive = ecs_os_adec(&cr->keep_alive);
+                ecs_assert(cr_keep_alive >= 0, ECS_INTERNAL_ERROR, NULL);
+                (void)cr_keep_alive;
+            } else {
+                cr->keep_alive --;
+                ecs_assert(cr->keep_alive >= 0, ECS_INTERNAL_ERROR, NULL);
+            }
+        }
+
+        term->flags_ &= (ecs_flags16_t)~EcsTermKeepAlive;
+    }
+}
+
+void flecs_query_plan_cache_on_delete(
+    ecs_world_t *world,
+    ecs_entity_t entity)
+{
+    ecs_query_plan_cache_t *cache = &world->query_plans;
+    ecs_query_plan_t *plan = cache->first;
+    while (plan) {
+        ecs_query_plan_t *next = plan->next;
+        if (flecs_query_plan_has_ref(plan->query, entity)) {
+            flecs_query_plan_free(world, plan);
+        }
+        plan = next;
+    }
+}
+
+void flecs_query_plan_cache_fini(
+    ecs_world_t *world)
+{
+    ecs_query_plan_cache_clear(world);
+    ecs_map_fini(&world->query_plans.index);
+}
+
+ecs_query_t* ecs_query_plan_cache_get(
+    ecs_world_t *world,
+    const char *expr)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(expr != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!(world->flags & EcsWorldMultiThreaded),
+        ECS_INVALID_OPERATION,
+            "cannot use query plan cache while running on multiple threads");
+
+    ecs_query_plan_cache_t *cache = &world->query_plans;
+    ecs_map_init_if(&cache->index, &world->allocator);
+
+    /* Normalized expression can't be longer than the input */
+    char small_buf[256];
+    ecs_size_t expr_len = ecs_os_strlen(expr);
+    char *buf = small_buf;
+    if (expr_len >= ECS_SIZEOF(small_buf)) {
+        buf = ecs_os_malloc(expr_len + 1);
+    }
+
+    ecs_size_t len = flecs_query_plan_normalize(expr, buf);
+    ecs_entity_t scope = ecs_get_scope(world);
+    uint64_t hash = flecs_hash(buf, len) ^ scope;
+
+    ecs_query_plan_t *plan = ecs_map_get_deref(
+        &cache->index, ecs_query_plan_t, hash);
+    if (plan) {
+        if (plan->scope == scope && plan->expr_len == len &&
+            !ecs_os_memcmp(plan->expr, buf, len) &&
+            flecs_query_plan_is_valid(world, plan->query))
+        {
+            /* Cache hit, move plan to front of list */
+            flecs_query_plan_unlink(cache, plan);
+            flecs_query_plan_link_first(cache, plan);
+            goto done;
+        }
+
+        /* Hash collision or stale query */
+        flecs_query_plan_free(world, plan);
+    }
+
+    ecs_query_t *q = ecs_query(world, { .expr = buf });
+    if (!q) {
+        plan = NULL;
+        goto done;
+    }
+
+    flecs_query_plan_release_ids(world, q);
+
+    plan = flecs_calloc_t(&world->allocator, ecs_query_plan_t);
+    plan->query = q;
+    plan->expr = flecs_alloc_n(&world->allocator, char, len + 1);
+    ecs_os_memcpy(plan->expr, buf, len + 1);
+    plan->expr_len = len;
+    plan->hash = hash;
+    plan->scope = scope;
+    ecs_map_insert_ptr(&cache->index, hash, plan);
+    flecs_query_plan_link_first(cache, plan);
+    cache->count ++;
+
+    if (cache->count > FLECS_QUERY_PLAN_CACHE_SIZE) {
+        flecs_query_plan_free(world, cache->last);
+    }
+
+done:
+    if (buf != small_buf) {
+        ecs_os_free(buf);
+    }
+    return plan ? plan->query : NULL;
+error:
+    return NULL;
+}
+
+void ecs_query_plan_cache_clear(
+    ecs_world_t *world)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_query_plan_cache_t *cache = &world->query_plans;
+    while (cache->first) {
+        flecs_query_plan_free(world, cache->first);
+    }
+}
+
 /**
  * @file query/util.c
  * @brief Query utilities.
@@ -37377,6 +40930,7 @@ void flecs_component_fini_sparse(
             flecs_wfree_t(world, ecs_sparse_t, cr->sparse);
         } else
         if (cr->flags & EcsIdIsUnion) {
+            flecs_union_index_fini(world, cr);
             flecs_switch_fini(cr->sparse);
             flecs_wfree_t(world, ecs_switch_t, cr->sparse);
         } else {
@@ -37417,6 +40971,8 @@ ecs_component_record_t* flecs_component_new(
     }
 
     ecs_table_cache_init(world, &cr->cache);
+    world->info.component_record_memory += 
+        ECS_SIZEOF(ecs_component_record_t);
 
     cr->id = id;
     cr->refcount = 1;
@@ -37428,9 +40984,7 @@ ecs_component_record_t* flecs_component_new(
     if (is_pair) {
         cr->pair = flecs_bcalloc_w_dbg_info(
             &world->allocators.pair_id_record, "ecs_pair_record_t");
-        cr->pair->reachable.current = -1;
-
-        flecs_ordered_children_init(world, cr);
+        world->info.component_record_memory += ECS_SIZEOF(ecs_pair_record_t);
 
         rel = ECS_PAIR_FIRST(id);
         rel = flecs_entities_get_alive(world, rel);
@@ -37600,6 +41154,7 @@ ecs_component_record_t* flecs_component_new(
         /* Check if we should keep a list of ordered children for parent */
         if (rel == EcsChildOf) {
             if (ecs_has_id(world, tgt, EcsOrderedChildren)) {
+                flecs_ordered_children_init(world, cr);
                 cr->flags |= EcsIdOrderedChildren;
             }
         }
@@ -37722,15 +41277,24 @@ void flecs_component_free(
     world->info.tag_id_count -= cr->type_info == NULL;
 
     /* Unregister the component record from the world & free resources */
-    ecs_table_cache_fini(&cr->cache);
+    ecs_table_cache_fini(world, &cr->cache);
 
     if (cr->pair) {
-        flecs_ordered_children_fini(world, cr);
+        ecs_pair_record_ext_t *ext = cr->pair->ext;
+        if (ext) {
+            ecs_assert(ext->union_index == NULL, ECS_INTERNAL_ERROR, NULL);
+            flecs_ordered_children_fini(world, cr);
+            ecs_vec_fini_t(&world->allocator, &ext->reachable.ids, 
+                ecs_reachable_elem_t);
+            flecs_free_t(&world->allocator, ecs_pair_record_ext_t, ext);
+            world->info.component_record_memory -= 
+                ECS_SIZEOF(ecs_pair_record_ext_t);
+        }
+
         flecs_name_index_free(cr->pair->name_index);
-        ecs_vec_fini_t(&world->allocator, &cr->pair->reachable.ids, 
-            ecs_reachable_elem_t);
         flecs_bfree_w_dbg_info(&world->allocators.pair_id_record, 
                 cr->pair, "ecs_pair_record_t");
+        world->info.component_record_memory -= ECS_SIZEOF(ecs_pair_record_t);
     }
 
     ecs_id_t hash = flecs_component_hash(id);
@@ -37746,6 +41310,8 @@ void flecs_component_free(
 
     flecs_bfree_w_dbg_info(&world->allocators.id_record, 
         cr, "ecs_component_record_t");
+    world->info.component_record_memory -= 
+        ECS_SIZEOF(ecs_component_record_t);
 
     if (ecs_should_log_1()) {
         char *id_str = ecs_id_str(world, id);
@@ -37865,6 +41431,25 @@ ecs_hashmap_t* flecs_component_name_index_ensure(
     return map;
 }
 
+ecs_pair_record_ext_t* flecs_pair_record_ext_ensure(
+    ecs_world_t *world,
+    ecs_component_record_t *cr)
+{
+    ecs_assert(cr->pair != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_pair_record_ext_t *ext = cr->pair->ext;
+    if (!ext) {
+        ext = cr->pair->ext = flecs_calloc_t(
+            &world->allocator, ecs_pair_record_ext_t);
+        ecs_vec_init_t(
+            &world->allocator, &ext->ordered_children, ecs_entity_t, 0);
+        ext->reachable.current = -1;
+        world->info.component_record_memory += 
+            ECS_SIZEOF(ecs_pair_record_ext_t);
+    }
+
+    return ext;
+}
+
 ecs_hashmap_t* flecs_component_name_index_get(
     const ecs_world_t *world,
     ecs_component_record_t *cr)
@@ -38026,6 +41611,27 @@ ecs_id_t flecs_component_get_id(
 }
 
 
+static
+ecs_entity_index_page_t* flecs_entity_index_page_new(
+    ecs_entity_index_t *index)
+{
+    void *alloc = flecs_bcalloc(&index->page_allocator);
+    ecs_assert(alloc != NULL, ECS_OUT_OF_MEMORY, NULL);
+    ecs_entity_index_page_t *page = (ecs_entity_index_page_t*)
+        (((uintptr_t)alloc + FLECS_ENTITY_PAGE_ALIGN - 1) & 
+            ~(uintptr_t)(FLECS_ENTITY_PAGE_ALIGN - 1));
+    page->alloc = alloc;
+    return page;
+}
+
+static
+void flecs_entity_index_page_free(
+    ecs_entity_index_t *index,
+    ecs_entity_index_page_t *page)
+{
+    flecs_bfree(&index->page_allocator, page->alloc);
+}
+
 static
 ecs_entity_index_page_t* flecs_entity_index_ensure_page(
     ecs_entity_index_t *index,
@@ -38041,8 +41647,7 @@ ecs_entity_index_page_t* flecs_entity_index_ensure_page(
         ecs_entity_index_page_t*, page_index);
     ecs_entity_index_page_t *page = *page_ptr;
     if (!page) {
-        page = *page_ptr = flecs_bcalloc(&index->page_allocator);
-        ecs_assert(page != NULL, ECS_OUT_OF_MEMORY, NULL);
+        page = *page_ptr = flecs_entity_index_page_new(index);
     }
 
     return page;
@@ -38058,7 +41663,7 @@ void flecs_entity_index_init(
     ecs_vec_set_count_t(allocator, &index->dense, uint64_t, 1);
     ecs_vec_init_t(allocator, &index->pages, ecs_entity_index_page_t*, 0);
     flecs_ballocator_init(&index->page_allocator,
-        ECS_SIZEOF(ecs_entity_index_page_t));
+        ECS_SIZEOF(ecs_entity_index_page_t) + FLECS_ENTITY_PAGE_ALIGN);
 }
 
 void flecs_entity_index_fini(
@@ -38068,7 +41673,9 @@ void flecs_entity_index_fini(
     int32_t i, count = ecs_vec_count(&index->pages);
     ecs_entity_index_page_t **pages = ecs_vec_first(&index->pages);
     for (i = 0; i < count; i ++) {
-        flecs_bfree(&index->page_allocator, pages[i]);
+        if (pages[i]) {
+            flecs_entity_index_page_free(index, pages[i]);
+        }
     }
     ecs_vec_fini_t(index->allocator, &index->pages, ecs_entity_index_page_t*);
     flecs_ballocator_fini(&index->page_allocator);
@@ -38133,13 +41740,35 @@ ecs_record_t* flecs_entity_index_try_get(
         if (r->dense >= index->alive_count) {
             return NULL;
         }
-        if (ecs_vec_get_t(&index->dense, uint64_t, r->dense)[0] != entity) {
+
+        /* The record stores a copy of the generation in the dense array, so 
+         * the check doesn't have to load another cache line. */
+        if (r->generation != (uint32_t)(entity >> 32)) {
             return NULL;
         }
+
+        ecs_assert(
+            ecs_vec_get_t(&index->dense, uint64_t, r->dense)[0] == entity,
+            ECS_INTERNAL_ERROR, NULL);
     }
     return r;
 }
 
+void flecs_entity_index_prefetch(
+    const ecs_entity_index_t *index,
+    uint64_t entity)
+{
+    uint32_t id = (uint32_t)entity;
+    int32_t page_index = (int32_t)(id >> FLECS_ENTITY_PAGE_BITS);
+    if (page_index < ecs_vec_count(&index->pages)) {
+        ecs_entity_index_page_t *page = ecs_vec_get_t(&index->pages,
+            ecs_entity_index_page_t*, page_index)[0];
+        if (page) {
+            flecs_prefetch(&page->records[id & FLECS_ENTITY_PAGE_MASK]);
+        }
+    }
+}
+
 ecs_record_t* flecs_entity_index_ensure(
     ecs_entity_index_t *index,
     uint64_t entity)
@@ -38176,6 +41805,7 @@ ecs_record_t* flecs_entity_index_ensure(
 
     r_swap->dense = dense;
     r->dense = index->alive_count;
+    r->generation = (uint32_t)(entity >> 32);
     ids[dense] = e_swap;
     ids[index->alive_count ++] = entity;
 
@@ -38209,6 +41839,7 @@ void flecs_entity_index_remove(
     r->dense = i_swap;
     ecs_vec_get_t(&index->dense, uint64_t, dense)[0] = e_swap;
     e_swap_ptr[0] = ECS_GENERATION_INC(entity);
+    r->generation = (uint32_t)(e_swap_ptr[0] >> 32);
     ecs_assert(!flecs_entity_index_is_alive(index, entity),
         ECS_INTERNAL_ERROR, NULL);
 }
@@ -38220,6 +41851,7 @@ void flecs_entity_index_make_alive(
     ecs_record_t *r = flecs_entity_index_try_get_any(index, entity);
     if (r) {
         ecs_vec_get_t(&index->dense, uint64_t, r->dense)[0] = entity;
+        r->generation = (uint32_t)(entity >> 32);
     }
 }
 
@@ -38229,7 +41861,10 @@ uint64_t flecs_entity_index_get_alive(
 {
     ecs_record_t *r = flecs_entity_index_try_get_any(index, entity);
     if (r) {
-        return ecs_vec_get_t(&index->dense, uint64_t, r->dense)[0];
+        ecs_assert(ecs_vec_get_t(&index->dense, uint64_t, r->dense)[0] ==
+            (((uint64_t)r->generation << 32) | (uint32_t)entity),
+                ECS_INTERNAL_ERROR, NULL);
+        return ((uint64_t)r->generation << 32) | (uint32_t)entity;
     } else {
         return 0;
     }
@@ -38367,7 +42002,8 @@ void flecs_entity_index_clear(
     for (i = 0; i < count; i ++) {
         ecs_entity_index_page_t *page = pages[i];
         if (page) {
-            ecs_os_zeromem(page);
+            ecs_os_memset_n(page->records, 0, ecs_record_t, 
+                FLECS_ENTITY_PAGE_SIZE);
         }
     }
 
@@ -38412,7 +42048,7 @@ void flecs_entity_index_shrink(
         }
 
         if (!has_alive) {
-            flecs_bfree(&index->page_allocator, page);
+            flecs_entity_index_page_free(index, page);
             pages[i] = NULL;
         } else {
             max_page_index = i;
@@ -38436,8 +42072,7 @@ void flecs_ordered_children_init(
     ecs_world_t *world,
     ecs_component_record_t *cr)
 {
-    ecs_vec_init_t(
-        &world->allocator, &cr->pair->ordered_children, ecs_entity_t, 0);
+    flecs_pair_record_ext_ensure(world, cr);
 }
 
 void flecs_ordered_children_fini(
@@ -38445,14 +42080,16 @@ void flecs_ordered_children_fini(
     ecs_component_record_t *cr)
 {
     ecs_vec_fini_t(
-        &world->allocator, &cr->pair->ordered_children, ecs_entity_t);
+        &world->allocator, &cr->pair->ext->ordered_children, ecs_entity_t);
 }
 
 void flecs_ordered_children_populate(
     ecs_world_t *world,
     ecs_component_record_t *cr)
 {    
-    ecs_vec_t *v = &cr->pair->ordered_children;
+    flecs_ordered_children_init(world, cr);
+
+    ecs_vec_t *v = &cr->pair->ext->ordered_children;
     ecs_assert(ecs_vec_count(v) == 0, ECS_INTERNAL_ERROR, NULL);
     ecs_assert(ECS_IS_PAIR(cr->id), ECS_INTERNAL_ERROR, NULL);
     ecs_assert(ECS_PAIR_FIRST(cr->id) ==  EcsChildOf, 
@@ -38471,7 +42108,7 @@ void flecs_ordered_children_populate(
 void flecs_ordered_children_clear(
     ecs_component_record_t *cr)
 {    
-    ecs_vec_t *v = &cr->pair->ordered_children;
+    ecs_vec_t *v = &cr->pair->ext->ordered_children;
     ecs_assert(ECS_IS_PAIR(cr->id), ECS_INTERNAL_ERROR, NULL);
     ecs_assert(ECS_PAIR_FIRST(cr->id) ==  EcsChildOf, 
         ECS_INTERNAL_ERROR, NULL);
@@ -38486,9 +42123,10 @@ void flecs_ordered_entities_append(
     ecs_entity_t e)
 {
     ecs_assert(pair != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(pair->ext != NULL, ECS_INTERNAL_ERROR, NULL);
 
     ecs_vec_append_t(
-        &world->allocator, &pair->ordered_children, ecs_entity_t)[0] = e;
+        &world->allocator, &pair->ext->ordered_children, ecs_entity_t)[0] = e;
 }
 
 static
@@ -38497,8 +42135,9 @@ void flecs_ordered_entities_remove(
     ecs_entity_t e)
 {
     ecs_assert(pair != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(pair->ext != NULL, ECS_INTERNAL_ERROR, NULL);
 
-    ecs_vec_t *vec = &pair->ordered_children;
+    ecs_vec_t *vec = &pair->ext->ordered_children;
     int32_t i, count = ecs_vec_count(vec);
     ecs_entity_t *entities = ecs_vec_first_t(vec, ecs_entity_t);
 
@@ -38573,7 +42212,7 @@ void flecs_ordered_children_reorder(
         "ecs_set_child_order is only allowed for parents with the "
         "OrderedChildren trait");
 
-    ecs_vec_t *vec = &cr->pair->ordered_children;
+    ecs_vec_t *vec = &cr->pair->ext->ordered_children;
     ecs_entity_t *parent_children = ecs_vec_first_t(vec, ecs_entity_t);
     int32_t parent_child_count = ecs_vec_count(vec);
     ecs_check(parent_child_count == child_count, ECS_INVALID_PARAMETER,
@@ -39256,6 +42895,33 @@ void flecs_table_init_data(
             flecs_bitset_init(&meta->bs_columns[i]);
         }
     }
+
+    /* Initialize changed rows for components with the DirtyRows trait */
+    int32_t column_count = table->column_count, dirty_count = 0;
+    int16_t *s2t = &table->column_map[table->type.count];
+    for (i = 0; i < column_count; i ++) {
+        ecs_component_record_t *cr = (ecs_component_record_t*)
+            meta->records[s2t[i]].hdr.cache;
+        if (cr->flags & EcsIdDirtyRows) {
+            dirty_count ++;
+        }
+    }
+
+    if (dirty_count) {
+        meta->dirty_rows = flecs_wcalloc_n(
+            world, ecs_table_dirty_rows_t, dirty_count);
+        meta->dirty_rows_count = dirty_count;
+        table->flags |= EcsTableHasDirtyRows;
+
+        int32_t cur = 0;
+        for (i = 0; i < column_count; i ++) {
+            ecs_component_record_t *cr = (ecs_component_record_t*)
+                meta->records[s2t[i]].hdr.cache;
+            if (cr->flags & EcsIdDirtyRows) {
+                meta->dirty_rows[cur ++].column = i;
+            }
+        }
+    }
 }
 
 /* Initialize table flags. Table flags are used in lots of scenarios to quickly
@@ -39371,7 +43037,7 @@ void flecs_table_append_to_records(
         tr->index = flecs_ito(int16_t, column);
         tr->count = 1;
 
-        ecs_table_cache_insert(&cr->cache, table, &tr->hdr);
+        ecs_table_cache_insert(world, &cr->cache, table, &tr->hdr);
     } else {
         tr->count ++;
     }
@@ -39638,7 +43304,7 @@ void flecs_table_init(
         } else {
             /* Other records are not registered yet */
             ecs_assert(cr != NULL, ECS_INTERNAL_ERROR, NULL);
-            ecs_table_cache_insert(&cr->cache, table, &tr->hdr);
+            ecs_table_cache_insert(world, &cr->cache, table, &tr->hdr);
         }
 
         /* Claim component record so it stays alive as long as the table exists */
@@ -39712,8 +43378,13 @@ void flecs_table_records_unregister(
             ECS_INTERNAL_ERROR, NULL);
         (void)id;
 
-        ecs_table_cache_remove(cache, table_id, &tr->hdr);
-        flecs_component_release(world, (ecs_component_record_t*)cache);
+        ecs_component_record_t *cr = (ecs_component_record_t*)cache;
+        if (cr->flags & EcsIdIsUnion) {
+            flecs_union_index_remove_table(world, cr, table);
+        }
+
+        ecs_table_cache_remove(world, cache, table_id, &tr->hdr);
+        flecs_component_release(world, cr);
     }
 
     flecs_wfree_n(world, ecs_table_record_t, count, table->_->records);
@@ -39886,11 +43557,15 @@ void flecs_table_invoke_remove_hooks(
     }
 }
 
-/* Destruct all components and/or delete all entities in table */
+/* Destruct all components and/or delete all entities in table. If detached is
+ * provided, destructors are not invoked here. Instead the caller moves the 
+ * component storage to the detached vector, so that destructors can run after
+ * the table is cleaned up. */
 static
 void flecs_table_dtor_all(
     ecs_world_t *world,
-    ecs_table_t *table)
+    ecs_table_t *table,
+    bool detached)
 {
     int32_t i, c, count = ecs_table_count(table);
     if (!count) {
@@ -39922,9 +43597,11 @@ void flecs_table_dtor_all(
         }
 
         /* Destruct components */
-        for (c = 0; c < column_count; c++) {
-            flecs_table_invoke_dtor(&table->data.columns[c], 0, count);
-        }       
+        if (!detached) {
+            for (c = 0; c < column_count; c++) {
+                flecs_table_invoke_dtor(&table->data.columns[c], 0, count);
+            }
+        }
 
         /* Iterate entities first, then components. This ensures that only one
          * entity is invalidated at a time, which ensures that destructors can
@@ -39961,15 +43638,17 @@ void flecs_table_fini_data(
     ecs_world_t *world,
     ecs_table_t *table,
     bool do_on_remove,
-    bool deallocate)
+    bool deallocate,
+    ecs_vec_t *detached)
 {
     ecs_assert(!table->_->lock, ECS_LOCKED_STORAGE, FLECS_LOCKED_STORAGE_MSG);
+    ecs_assert(!detached || deallocate, ECS_INTERNAL_ERROR, NULL);
 
     if (do_on_remove) {
         flecs_table_notify_on_remove(world, table);        
     }
 
-    flecs_table_dtor_all(world, table);
+    flecs_table_dtor_all(world, table, detached != NULL);
 
     if (deallocate) {
         ecs_column_t *columns = table->data.columns;
@@ -39977,8 +43656,17 @@ void flecs_table_fini_data(
             int32_t c, column_count = table->column_count;
             for (c = 0; c < column_count; c ++) {
                 ecs_column_t *column = &columns[c];
-                ecs_vec_t v = ecs_vec_from_column(column, table, column->ti->size);
-                ecs_vec_fini(&world->allocator, &v, column->ti->size);
+                const ecs_type_info_t *ti = column->ti;
+                ecs_vec_t v = ecs_vec_from_column(column, table, ti->size);
+                if (detached && ti->hooks.dtor && v.count) {
+                    /* Hand storage to caller, which invokes the destructor */
+                    ecs_table_detached_t *elem = ecs_vec_append_t(
+                        &world->allocator, detached, ecs_table_detached_t);
+                    elem->data = v;
+                    elem->ti = ti;
+                } else {
+                    ecs_vec_fini(&world->allocator, &v, ti->size);
+                }
                 column->data = NULL;
             }
 
@@ -40013,6 +43701,12 @@ void flecs_table_fini_data(
         ecs_vec_fini_t(&world->allocator, &v, ecs_entity_t);
         table->data.entities = NULL;
         table->data.size = 0;
+
+        int32_t c, dirty_count = meta->dirty_rows_count;
+        for (c = 0; c < dirty_count; c ++) {
+            ecs_vec_fini_t(&world->allocator, 
+                &meta->dirty_rows[c].bits, uint64_t);
+        }
     }
 
     table->data.count = 0;
@@ -40032,7 +43726,7 @@ void ecs_table_clear_entities(
     ecs_world_t* world,
     ecs_table_t* table)
 {
-    flecs_table_fini_data(world, table, true, false);
+    flecs_table_fini_data(world, table, true, false, NULL);
 }
 
 /* Cleanup, run OnRemove, free allocations */
@@ -40040,7 +43734,18 @@ void flecs_table_delete_entities(
     ecs_world_t *world,
     ecs_table_t *table)
 {
-    flecs_table_fini_data(world, table, true, true);
+    flecs_table_fini_data(world, table, true, true, NULL);
+}
+
+/* Cleanup, run OnRemove, free allocations. Component storage with destructors
+ * is appended to the detached vector instead of being destructed. */
+void flecs_table_delete_entities_detached(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    ecs_vec_t *detached)
+{
+    ecs_assert(detached != NULL, ECS_INTERNAL_ERROR, NULL);
+    flecs_table_fini_data(world, table, true, true, detached);
 }
 
 /* Unset all components in table. This function is called before a table is 
@@ -40061,6 +43766,10 @@ void flecs_table_fini(
 
     flecs_increment_table_version(world, table);
 
+    if (table->_->gc_pooled) {
+        world->info.table_pool_count --;
+    }
+
     bool is_root = table == &world->store.root;
     ecs_assert(!table->_->lock, ECS_LOCKED_STORAGE, FLECS_LOCKED_STORAGE_MSG);
     ecs_assert(is_root || table->id != 0, ECS_INTERNAL_ERROR, NULL);
@@ -40086,7 +43795,7 @@ void flecs_table_fini(
     }
 
     /* Cleanup data, no OnRemove, free allocations */
-    flecs_table_fini_data(world, table, false, true);
+    flecs_table_fini_data(world, table, false, true, NULL);
     flecs_table_clear_edges(world, table);
 
     if (!is_root) {
@@ -40100,6 +43809,9 @@ void flecs_table_fini(
     }
 
     flecs_wfree_n(world, int32_t, table->column_count + 1, table->dirty_state);
+    flecs_wfree_n(world, ecs_table_dirty_rows_t, table->_->dirty_rows_count,
+        table->_->dirty_rows);
+    flecs_instantiate_plans_fini(world, table);
     flecs_wfree_n(world, int16_t, table->column_count + table->type.count, 
         table->column_map);
     flecs_wfree_n(world, int16_t, FLECS_HI_COMPONENT_ID, table->component_map);
@@ -40174,15 +43886,78 @@ void flecs_table_mark_table_dirty(
     }
 }
 
+/* Set a range of bits in a changed rows bitset */
+static
+void flecs_table_dirty_rows_set(
+    ecs_world_t *world,
+    ecs_table_dirty_rows_t *dr,
+    int32_t row,
+    int32_t count)
+{
+    int32_t end = row + count;
+    ecs_vec_set_min_count_zeromem_t(
+        &world->allocator, &dr->bits, uint64_t, (end + 63) / 64);
+    uint64_t *words = ecs_vec_first(&dr->bits);
+
+    while (row < end) {
+        int32_t bit = row & 63;
+        int32_t n = ECS_MIN(64 - bit, end - row);
+        uint64_t mask = n == 64 ? UINT64_MAX : (((1llu << n) - 1) << bit);
+        words[row >> 6] |= mask;
+        row += n;
+    }
+}
+
+void flecs_table_mark_rows_dirty(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t column,
+    int32_t row,
+    int32_t count)
+{
+    if (!(table->flags & EcsTableHasDirtyRows) || !count) {
+        return;
+    }
+
+    ecs_table__t *meta = table->_;
+    int32_t i, dirty_count = meta->dirty_rows_count;
+    for (i = 0; i < dirty_count; i ++) {
+        ecs_table_dirty_rows_t *dr = &meta->dirty_rows[i];
+        if (column == -1 || dr->column == column) {
+            flecs_table_dirty_rows_set(world, dr, row, count);
+        }
+    }
+}
+
+ecs_table_dirty_rows_t* flecs_table_get_dirty_rows(
+    const ecs_table_t *table,
+    int32_t column)
+{
+    if (!(table->flags & EcsTableHasDirtyRows)) {
+        return NULL;
+    }
+
+    ecs_table__t *meta = table->_;
+    int32_t i, dirty_count = meta->dirty_rows_count;
+    for (i = 0; i < dirty_count; i ++) {
+        if (meta->dirty_rows[i].column == column) {
+            return &meta->dirty_rows[i];
+        }
+    }
+
+    return NULL;
+}
+
 /* Mark table component dirty */
 void flecs_table_mark_dirty(
     ecs_world_t *world,
     ecs_table_t *table,
-    ecs_entity_t component)
+    ecs_entity_t component,
+    int32_t row)
 {
     ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
 
-    if (table->dirty_state) {
+    if (table->dirty_state || (table->flags & EcsTableHasDirtyRows)) {
         int32_t column;
         if (component < FLECS_HI_COMPONENT_ID) {
             column = table->component_map[component];
@@ -40205,7 +43980,11 @@ void flecs_table_mark_dirty(
 
         /* Column is offset by 1, 0 is reserved for entity column. */
 
-        table->dirty_state[column] ++;
+        if (table->dirty_state) {
+            table->dirty_state[column] ++;
+        }
+
+        flecs_table_mark_rows_dirty(world, table, column - 1, row, 1);
 
         ecs_assert(!table->_->lock, ECS_LOCKED_STORAGE, 
             FLECS_LOCKED_STORAGE_MSG);
@@ -40503,6 +44282,10 @@ int32_t flecs_table_append(
     flecs_increment_table_column_version(world, table);
     ecs_assert(count >= 0, ECS_INTERNAL_ERROR, NULL);
 
+    if (table->flags & EcsTableHasDirtyRows) {
+        flecs_table_mark_rows_dirty(world, table, -1, count, 1);
+    }
+
     /* Fast path: no switch columns, no lifecycle actions */
     if (!(table->flags & EcsTableIsComplex)) {
         flecs_table_fast_append(world, table);
@@ -40577,6 +44360,39 @@ void flecs_table_fast_delete(
     }
 }
 
+/* Move a component value to another row and destruct the source. If construct 
+ * is true, the destination is uninitialized memory, otherwise it contains a 
+ * value that is replaced. Used by operations that move rows within a table. */
+static
+void flecs_table_move_w_dtor(
+    const ecs_type_info_t *ti,
+    void *dst,
+    void *src,
+    bool construct)
+{
+    ecs_move_t move_dtor;
+    if (construct) {
+        move_dtor = ti->hooks.ctor_move_dtor;
+    } else {
+        move_dtor = ti->hooks.move_dtor;
+
+        /* If neither move nor move_ctor are set, this indicates that 
+         * non-destructive move semantics are not supported for this 
+         * type. In such cases, we set the move_dtor as ctor_move_dtor, 
+         * which indicates a destructive move operation. This adjustment 
+         * ensures compatibility with different language bindings. */
+        if (!ti->hooks.move_ctor && ti->hooks.ctor_move_dtor) {
+            move_dtor = ti->hooks.ctor_move_dtor;
+        }
+    }
+
+    if (move_dtor) {
+        move_dtor(dst, src, 1, ti);
+    } else {
+        ecs_os_memcpy(dst, src, ti->size);
+    }
+}
+
 /* Delete entity from table */
 void flecs_table_delete(
     ecs_world_t *world,
@@ -40610,6 +44426,10 @@ void flecs_table_delete(
             ecs_assert(record_to_move->table != NULL, ECS_INTERNAL_ERROR, NULL);
             ecs_assert(record_to_move->table == table, ECS_INTERNAL_ERROR, NULL);
         }
+
+        if (table->flags & EcsTableHasDirtyRows) {
+            flecs_table_mark_rows_dirty(world, table, -1, row, 1);
+        }
     }     
 
     /* If the table is monitored indicate that there has been a change */
@@ -40660,22 +44480,7 @@ void flecs_table_delete(
                         EcsOnRemove, column, &entity_to_delete, row, 1);
                 }
 
-                ecs_move_t move_dtor = ti->hooks.move_dtor;
-                
-                /* If neither move nor move_ctor are set, this indicates that 
-                 * non-destructive move semantics are not supported for this 
-                 * type. In such cases, we set the move_dtor as ctor_move_dtor, 
-                 * which indicates a destructive move operation. This adjustment 
-                 * ensures compatibility with different language bindings. */
-                if (!ti->hooks.move_ctor && ti->hooks.ctor_move_dtor) {
-                  move_dtor = ti->hooks.ctor_move_dtor;
-                }
-
-                if (move_dtor) {
-                    move_dtor(dst, src, 1, ti);
-                } else {
-                    ecs_os_memcpy(dst, src, size);
-                }
+                flecs_table_move_w_dtor(ti, dst, src, false);
             }
         } else {
             flecs_table_fast_delete(table, row);
@@ -40839,6 +44644,7 @@ int32_t flecs_table_appendn(
     int32_t cur_count = ecs_table_count(table);
     int32_t result = flecs_table_grow_data(
         world, table, to_add, cur_count + to_add, ids);
+    flecs_table_mark_rows_dirty(world, table, -1, cur_count, to_add);
     flecs_table_check_sanity(table);
 
     return result;
@@ -40941,6 +44747,11 @@ void flecs_table_swap(
     record_ptr_1->row = ECS_ROW_TO_RECORD(row_2, flags_1);
     record_ptr_2->row = ECS_ROW_TO_RECORD(row_1, flags_2);
 
+    if (table->flags & EcsTableHasDirtyRows) {
+        flecs_table_mark_rows_dirty(world, table, -1, row_1, 1);
+        flecs_table_mark_rows_dirty(world, table, -1, row_2, 1);
+    }
+
     flecs_table_swap_bitset_columns(table, row_1, row_2);
 
     ecs_column_t *columns = table->data.columns;
@@ -40988,6 +44799,151 @@ void flecs_table_swap(
     flecs_table_check_sanity(table);
 }
 
+/* Move rows to the end of the table. This makes it possible to delete a batch
+ * of rows with a single truncation, and moves at most as many rows as are
+ * deleted. Rows must be sorted and may not contain duplicates. */
+void flecs_table_move_to_end(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    const int32_t *rows,
+    int32_t count)
+{
+    ecs_assert(world != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(!table->_->lock, ECS_LOCKED_STORAGE, FLECS_LOCKED_STORAGE_MSG);
+
+    flecs_table_check_sanity(table);
+
+    int32_t table_count = ecs_table_count(table);
+    ecs_assert(count <= table_count, ECS_INTERNAL_ERROR, NULL);
+    int32_t first = table_count - count;
+
+    /* Rows before the first row of the tail leave a hole that is filled with
+     * a row from the tail that isn't deleted. */
+    int32_t i, hole_count = 0;
+    while (hole_count < count && rows[hole_count] < first) {
+        hole_count ++;
+    }
+
+    if (!hole_count) {
+        return;
+    }
+
+    int32_t *src_rows = flecs_walloc_n(world, int32_t, hole_count);
+    int32_t row = table_count - 1, tail = count - 1;
+    for (i = 0; i < hole_count; row --) {
+        ecs_assert(row >= first, ECS_INTERNAL_ERROR, NULL);
+        if (tail >= hole_count && rows[tail] == row) {
+            tail --;
+            continue;
+        }
+        src_rows[i ++] = row;
+    }
+
+    flecs_table_mark_table_dirty(world, table, 0);
+
+    /* Swap entities & records */
+    ecs_entity_t *entities = table->data.entities;
+    for (i = 0; i < hole_count; i ++) {
+        int32_t row_1 = rows[i], row_2 = src_rows[i];
+        ecs_entity_t e1 = entities[row_1];
+        ecs_entity_t e2 = entities[row_2];
+        ecs_record_t *r1 = flecs_entities_get(world, e1);
+        ecs_record_t *r2 = flecs_entities_get(world, e2);
+        ecs_assert(r1 != NULL, ECS_INTERNAL_ERROR, NULL);
+        ecs_assert(r2 != NULL, ECS_INTERNAL_ERROR, NULL);
+
+        entities[row_1] = e2;
+        entities[row_2] = e1;
+        r1->row = ECS_ROW_TO_RECORD(row_2, ECS_RECORD_TO_ROW_FLAGS(r1->row));
+        r2->row = ECS_ROW_TO_RECORD(row_1, ECS_RECORD_TO_ROW_FLAGS(r2->row));
+
+        flecs_table_swap_bitset_columns(table, row_1, row_2);
+        flecs_table_mark_rows_dirty(world, table, -1, row_1, 1);
+    }
+
+    /* Swap column values one column at a time. Values are swapped with 
+     * destructive moves into uninitialized memory, which unlike a move 
+     * assignment is also supported by types that can only be move constructed.
+     * The deleted values stay alive, as OnRemove observers and remove hooks
+     * are invoked after they have been moved to the end of the table. */
+    ecs_column_t *columns = table->data.columns;
+    int32_t c, column_count = table->column_count;
+    for (c = 0; c < column_count; c ++) {
+        ecs_column_t *column = &columns[c];
+        const ecs_type_info_t *ti = column->ti;
+        ecs_size_t size = ti->size;
+        void *tmp = ecs_os_alloca(size);
+
+        for (i = 0; i < hole_count; i ++) {
+            void *el_1 = ECS_ELEM(column->data, size, rows[i]);
+            void *el_2 = ECS_ELEM(column->data, size, src_rows[i]);
+            flecs_table_move_w_dtor(ti, tmp, el_1, true);
+            flecs_table_move_w_dtor(ti, el_1, el_2, true);
+            flecs_table_move_w_dtor(ti, el_2, tmp, true);
+        }
+    }
+
+    flecs_wfree_n(world, int32_t, hole_count, src_rows);
+
+    flecs_table_check_sanity(table);
+}
+
+/* Delete the last entities from the table. Invokes remove hooks and
+ * destructors, and removes the entities from the entity index. */
+void flecs_table_delete_last(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t count)
+{
+    ecs_assert(world != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(!table->_->lock, ECS_LOCKED_STORAGE, FLECS_LOCKED_STORAGE_MSG);
+    ecs_assert(count <= ecs_table_count(table), ECS_INTERNAL_ERROR, NULL);
+
+    flecs_table_check_sanity(table);
+
+    if (!count) {
+        return;
+    }
+
+    int32_t i, row = ecs_table_count(table) - count;
+    ecs_entity_t *entities = &table->data.entities[row];
+
+    flecs_table_mark_table_dirty(world, table, 0);
+
+    if (table->flags & EcsTableHasDtors) {
+        ecs_column_t *columns = table->data.columns;
+        int32_t column_count = table->column_count;
+        for (i = 0; i < column_count; i ++) {
+            flecs_table_invoke_remove_hooks(world, table, &columns[i], 
+                entities, row, count, true);
+        }
+    }
+
+    /* Update entity index after invoking destructors so that entities can be
+     * safely used in destructor callbacks. */
+    for (i = 0; i < count; i ++) {
+        flecs_entities_remove(world, entities[i]);
+    }
+
+    ecs_table__t *meta = table->_;
+    ecs_bitset_t *bs_columns = meta->bs_columns;
+    int32_t bs_count = meta->bs_count;
+    for (i = 0; i < bs_count; i ++) {
+        ecs_bitset_t *bs = &bs_columns[i];
+        int32_t b;
+        for (b = row; b < bs->count; b ++) {
+            flecs_bitset_set(bs, b, false);
+        }
+        bs->count = row;
+    }
+
+    table->data.count = row;
+
+    flecs_table_check_sanity(table);
+}
+
 static
 void flecs_table_merge_vec(
     ecs_world_t *world,
@@ -41201,6 +45157,7 @@ void flecs_table_merge(
 
     /* Merge table columns */
     flecs_table_merge_data(world, dst_table, src_table, dst_count, src_count);
+    flecs_table_mark_rows_dirty(world, dst_table, -1, dst_count, src_count);
 
     if (src_count) {
         flecs_table_traversable_add(dst_table, src_table->_->traversable_count);
@@ -41621,6 +45578,11 @@ char* ecs_table_str(
  * 
  * A table cache has separate lists for non-empty tables and empty tables. This
  * improves performance as applications don't waste time iterating empty tables.
+ * 
+ * Most caches only ever contain a single table (for example the component
+ * records for (ChildOf, parent) pairs), so the index used for table lookups is
+ * only created once a second table is added to the cache. Until then lookups 
+ * check the first element of the table list.
  */
 
 
@@ -41677,22 +45639,56 @@ void flecs_table_cache_list_insert(
         ECS_INTERNAL_ERROR, NULL);
 }
 
+/* Memory used by the table lookup index. */
+static
+ecs_size_t flecs_table_cache_index_memory(
+    const ecs_table_cache_t *cache)
+{
+    if (!ecs_map_is_init(&cache->index)) {
+        return 0;
+    }
+
+    return cache->index.bucket_count * ECS_SIZEOF(ecs_bucket_t) + 
+        ecs_map_count(&cache->index) * ECS_SIZEOF(ecs_bucket_entry_t);
+}
+
+/* Create lookup index when a second table is added to the cache. */
+static
+void flecs_table_cache_index_init(
+    ecs_world_t *world,
+    ecs_table_cache_t *cache)
+{
+    ecs_map_init_w_params(&cache->index, &world->allocators.ptr);
+
+    ecs_table_cache_hdr_t *cur = cache->tables.first;
+    for (; cur; cur = cur->next) {
+        if (cur->table) {
+            ecs_map_insert_ptr(&cache->index, cur->table->id, cur);
+        }
+    }
+}
+
 void ecs_table_cache_init(
     ecs_world_t *world,
     ecs_table_cache_t *cache)
 {
     ecs_assert(cache != NULL, ECS_INTERNAL_ERROR, NULL);
-    ecs_map_init_w_params(&cache->index, &world->allocators.ptr);
+    (void)world;
+    ecs_os_zeromem(cache);
 }
 
 void ecs_table_cache_fini(
+    ecs_world_t *world,
     ecs_table_cache_t *cache)
 {
     ecs_assert(cache != NULL, ECS_INTERNAL_ERROR, NULL);
+    world->info.component_record_memory -= 
+        flecs_table_cache_index_memory(cache);
     ecs_map_fini(&cache->index);
 }
 
 void ecs_table_cache_insert(
+    ecs_world_t *world,
     ecs_table_cache_t *cache,
     const ecs_table_t *table,
     ecs_table_cache_hdr_t *result)
@@ -41705,12 +45701,21 @@ void ecs_table_cache_insert(
     result->cache = cache;
     result->table = ECS_CONST_CAST(ecs_table_t*, table);
 
+    ecs_size_t memory = flecs_table_cache_index_memory(cache);
+
     flecs_table_cache_list_insert(cache, result);
 
     if (table) {
-        ecs_map_insert_ptr(&cache->index, table->id, result);
+        if (ecs_map_is_init(&cache->index)) {
+            ecs_map_insert_ptr(&cache->index, table->id, result);
+        } else if (cache->tables.count > 1) {
+            flecs_table_cache_index_init(world, cache);
+        }
     }
 
+    world->info.component_record_memory += 
+        flecs_table_cache_index_memory(cache) - memory;
+
     ecs_assert(cache->tables.first != NULL, ECS_INTERNAL_ERROR, NULL);
 }
 
@@ -41719,11 +45724,17 @@ void ecs_table_cache_replace(
     const ecs_table_t *table,
     ecs_table_cache_hdr_t *elem)
 {
-    ecs_table_cache_hdr_t **r = ecs_map_get_ref(
-        &cache->index, ecs_table_cache_hdr_t, table->id);
-    ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_table_cache_hdr_t **r = NULL, *old;
+    if (ecs_map_is_init(&cache->index)) {
+        r = ecs_map_get_ref(&cache->index, ecs_table_cache_hdr_t, table->id);
+        ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
+        old = *r;
+    } else {
+        old = cache->tables.first;
+        ecs_assert(old != NULL, ECS_INTERNAL_ERROR, NULL);
+        ecs_assert(old->table == table, ECS_INTERNAL_ERROR, NULL);
+    }
 
-    ecs_table_cache_hdr_t *old = *r;
     ecs_assert(old != NULL, ECS_INTERNAL_ERROR, NULL);
 
     ecs_table_cache_hdr_t *prev = old->prev, *next = old->next;
@@ -41743,7 +45754,10 @@ void ecs_table_cache_replace(
         cache->tables.last = elem;
     }
 
-    *r = elem;
+    if (r) {
+        *r = elem;
+    }
+
     elem->prev = prev;
     elem->next = next;
 }
@@ -41757,6 +45771,12 @@ void* ecs_table_cache_get(
         if (ecs_map_is_init(&cache->index)) {
             return ecs_map_get_deref(&cache->index, void**, table->id);
         }
+
+        ecs_table_cache_hdr_t *elem = cache->tables.first;
+        if (elem && elem->table == table) {
+            return elem;
+        }
+
         return NULL;
     } else {
         ecs_table_cache_hdr_t *elem = cache->tables.first;
@@ -41766,6 +45786,7 @@ void* ecs_table_cache_get(
 }
 
 void* ecs_table_cache_remove(
+    ecs_world_t *world,
     ecs_table_cache_t *cache,
     uint64_t table_id,
     ecs_table_cache_hdr_t *elem)
@@ -41776,7 +45797,13 @@ void* ecs_table_cache_remove(
     ecs_assert(elem->cache == cache, ECS_INTERNAL_ERROR, NULL);
 
     flecs_table_cache_list_remove(cache, elem);
-    ecs_map_remove(&cache->index, table_id);
+
+    if (ecs_map_is_init(&cache->index)) {
+        ecs_size_t memory = flecs_table_cache_index_memory(cache);
+        ecs_map_remove(&cache->index, table_id);
+        world->info.component_record_memory += 
+            flecs_table_cache_index_memory(cache) - memory;
+    }
 
     return elem;
 }
@@ -42262,6 +46289,145 @@ void flecs_table_diff_free(
     flecs_bfree(&world->allocators.table_diff, diff);
 }
 
+/* Initial and maximum number of elements in hi edge cache */
+#define FLECS_EDGE_CACHE_MIN_SIZE (256)
+#define FLECS_EDGE_CACHE_MAX_SIZE (1 << 18)
+
+/* Returns first element of the bucket for edge. Buckets have two elements, so
+ * that two edges that hash to the same bucket don't keep evicting each other */
+static
+ecs_graph_edge_cache_elem_t* flecs_table_edge_cache_bucket(
+    const ecs_graph_edge_cache_t *cache,
+    const ecs_graph_edges_t *edges,
+    ecs_id_t id)
+{
+    uint64_t hash = (uint64_t)(uintptr_t)edges ^ (id * 0x9E3779B97F4A7C15);
+    hash *= 0x9E3779B97F4A7C15;
+    return &cache->elems[(hash >> cache->shift) & ~(uint64_t)1];
+}
+
+static
+ecs_graph_edge_t* flecs_table_edge_cache_get(
+    const ecs_graph_edge_cache_t *cache,
+    const ecs_graph_edges_t *edges,
+    ecs_id_t id)
+{
+    ecs_graph_edge_cache_elem_t *elem = flecs_table_edge_cache_bucket(
+        cache, edges, id);
+    if (elem[0].edges == edges && elem[0].id == id) {
+        return elem[0].edge;
+    }
+    if (elem[1].edges == edges && elem[1].id == id) {
+        return elem[1].edge;
+    }
+    return NULL;
+}
+
+/* Insert edge in first element of bucket, move previous edge to second */
+static
+void flecs_table_edge_cache_set(
+    ecs_graph_edge_cache_t *cache,
+    const ecs_graph_edges_t *edges,
+    ecs_id_t id,
+    ecs_graph_edge_t *edge)
+{
+    ecs_graph_edge_cache_elem_t *elem = flecs_table_edge_cache_bucket(
+        cache, edges, id);
+    if (elem[0].edge) {
+        elem[1] = elem[0];
+    }
+    elem[0].edges = edges;
+    elem[0].id = id;
+    elem[0].edge = edge;
+}
+
+/* Resize cache so that it can hold all hi edges in the world, until it reaches
+ * the maximum size. */
+static
+void flecs_table_edge_cache_grow(
+    ecs_world_t *world,
+    ecs_graph_edge_cache_t *cache)
+{
+    int32_t size = cache->size, old_size = size;
+    if (!size) {
+        size = FLECS_EDGE_CACHE_MIN_SIZE;
+    }
+
+    while ((size < (cache->edge_count * 2)) && 
+        (size < FLECS_EDGE_CACHE_MAX_SIZE)) 
+    {
+        size *= 2;
+    }
+
+    if (size == old_size) {
+        return;
+    }
+
+    ecs_graph_edge_cache_elem_t *old_elems = cache->elems;
+    cache->elems = flecs_calloc_n(
+        &world->allocator, ecs_graph_edge_cache_elem_t, size);
+    cache->size = size;
+    cache->shift = 64;
+    while (size >>= 1) {
+        cache->shift --;
+    }
+
+    /* Reinsert elements so existing edges don't have to be looked up again */
+    int32_t i;
+    for (i = 0; i < old_size; i ++) {
+        ecs_graph_edge_cache_elem_t *elem = &old_elems[i];
+        if (elem->edge) {
+            flecs_table_edge_cache_set(cache, elem->edges, elem->id, elem->edge);
+        }
+    }
+
+    if (old_elems) {
+        flecs_free_n(&world->allocator, ecs_graph_edge_cache_elem_t, 
+            old_size, old_elems);
+    }
+}
+
+/* Remove edge from cache when it gets deleted */
+static
+void flecs_table_edge_cache_remove(
+    ecs_world_t *world,
+    ecs_graph_edge_t *edge)
+{
+    ecs_graph_edge_cache_t *cache = &world->store.edge_cache;
+    cache->edge_count --;
+
+    ecs_table_t *from = edge->from;
+    if (!cache->size || !from) {
+        return;
+    }
+
+    /* Edge can be either an add or remove edge */
+    ecs_graph_edge_cache_elem_t *elem[2] = {
+        flecs_table_edge_cache_bucket(cache, &from->node.add, edge->id),
+        flecs_table_edge_cache_bucket(cache, &from->node.remove, edge->id)
+    };
+
+    int32_t i, j;
+    for (i = 0; i < 2; i ++) {
+        for (j = 0; j < 2; j ++) {
+            if (elem[i][j].edge == edge) {
+                ecs_os_zeromem(&elem[i][j]);
+            }
+        }
+    }
+}
+
+void flecs_table_edge_cache_fini(
+    ecs_world_t *world)
+{
+    ecs_graph_edge_cache_t *cache = &world->store.edge_cache;
+    if (cache->elems) {
+        flecs_free_n(&world->allocator, ecs_graph_edge_cache_elem_t, 
+            cache->size, cache->elems);
+    }
+    ecs_os_zeromem(cache);
+}
+
 static
 ecs_graph_edge_t* flecs_table_ensure_hi_edge(
     ecs_world_t *world,
@@ -42283,6 +46449,11 @@ ecs_graph_edge_t* flecs_table_ensure_hi_edge(
         edge = &edges->lo[id];
     } else {
         edge = flecs_bcalloc(&world->allocators.graph_edge);
+
+        ecs_graph_edge_cache_t *cache = &world->store.edge_cache;
+        if (++ cache->edge_count > cache->size) {
+            flecs_table_edge_cache_grow(world, cache);
+        }
     }
 
     r[0] = edge;
@@ -42303,7 +46474,20 @@ ecs_graph_edge_t* flecs_table_ensure_edge(
         }
         edge = &edges->lo[id];
     } else {
+        ecs_graph_edge_cache_t *cache = &world->store.edge_cache;
+        if (cache->size) {
+            edge = flecs_table_edge_cache_get(cache, edges, id);
+            if (edge) {
+                return edge;
+            }
+        }
+
         edge = flecs_table_ensure_hi_edge(world, edges, id);
+
+        /* Cache can have been resized by ensure_hi_edge */
+        if (cache->size) {
+            flecs_table_edge_cache_set(cache, edges, id, edge);
+        }
     }
 
     return edge;
@@ -42340,6 +46524,7 @@ void flecs_table_disconnect_edge(
     if (id < FLECS_HI_COMPONENT_ID) {
         ecs_os_memset_t(edge, 0, ecs_graph_edge_t);
     } else {
+        flecs_table_edge_cache_remove(world, edge);
         flecs_bfree(&world->allocators.graph_edge, edge);
     }
 }
@@ -43265,6 +47450,302 @@ ecs_table_t* ecs_table_find(
     return flecs_table_ensure(world, &type, false, NULL);
 }
 
+/**
+ * @file storage/union_index.c
+ * @brief Per table row index for union relationships.
+ */
+
+
+static
+void flecs_union_table_fini(
+    ecs_world_t *world,
+    ecs_union_table_t *ut)
+{
+    /* Also free storage of targets not used by the last build */
+    int32_t i, count = ut->init_count;
+    ecs_union_target_t *targets = ecs_vec_first(&ut->targets);
+    for (i = 0; i < count; i ++) {
+        ecs_vec_fini_t(&world->allocator, &targets[i].words, ecs_union_word_t);
+    }
+
+    ecs_vec_fini_t(&world->allocator, &ut->targets, ecs_union_target_t);
+    ecs_map_fini(&ut->target_index);
+    flecs_free_t(&world->allocator, ecs_union_table_t, ut);
+}
+
+static
+ecs_union_target_t* flecs_union_table_ensure_target(
+    ecs_world_t *world,
+    ecs_union_table_t *ut,
+    ecs_entity_t tgt)
+{
+    ecs_map_val_t *index = ecs_map_ensure(&ut->target_index, tgt);
+    if (index[0]) {
+        return ecs_vec_get_t(&ut->targets, ecs_union_target_t,
+            (int32_t)index[0] - 1);
+    }
+
+    /* Reuse word storage of targets from a previous build */
+    int32_t count = ecs_vec_count(&ut->targets);
+    ecs_union_target_t *result = ecs_vec_append_t(
+        &world->allocator, &ut->targets, ecs_union_target_t);
+    if (count == ut->init_count) {
+        ecs_vec_init_t(&world->allocator, &result->words, ecs_union_word_t, 0);
+        ut->init_count ++;
+    }
+
+    result->tgt = tgt;
+    ecs_vec_clear(&result->words);
+    index[0] = (ecs_map_val_t)(count + 1);
+    return result;
+}
+
+static
+void flecs_union_table_build(
+    ecs_world_t *world,
+    ecs_component_record_t *cr,
+    ecs_union_table_t *ut,
+    ecs_table_t *table)
+{
+    ecs_map_clear(&ut->target_index);
+    ecs_vec_clear(&ut->targets);
+
+    const ecs_entity_t *entities = ecs_table_entities(table);
+    int32_t row, count = ecs_table_count(table);
+    ecs_entity_t prev_tgt = 0;
+    ecs_union_target_t *cur = NULL;
+
+    for (row = 0; row < count; row ++) {
+        ecs_entity_t tgt = flecs_switch_get(cr->sparse, (uint32_t)entities[row]);
+        if (!tgt) {
+            continue;
+        }
+
+        if (tgt != prev_tgt) {
+            cur = flecs_union_table_ensure_target(world, ut, tgt);
+            prev_tgt = tgt;
+        }
+
+        /* Rows are visited in order, so only the last word can be partial. */
+        int32_t word_index = row >> 6;
+        uint64_t bit = 1ull << (row & 63);
+        int32_t word_count = ecs_vec_count(&cur->words);
+        ecs_union_word_t *last = NULL;
+        if (word_count) {
+            last = ecs_vec_get_t(&cur->words, ecs_union_word_t, word_count - 1);
+        }
+
+        if (last && last->index == word_index) {
+            last->bits |= bit;
+        } else {
+            ecs_union_word_t *w = ecs_vec_append_t(
+                &world->allocator, &cur->words, ecs_union_word_t);
+            w->index = word_index;
+            w->bits = bit;
+        }
+    }
+
+    ut->table = table;
+    ut->table_version = table->version;
+    ut->count = count;
+    ut->dirty = false;
+}
+
+void flecs_union_index_fini(
+    ecs_world_t *world,
+    ecs_component_record_t *cr)
+{
+    ecs_pair_record_ext_t *ext = cr->pair->ext;
+    ecs_union_index_t *index = ext ? ext->union_index : NULL;
+    if (!index) {
+        return;
+    }
+
+    ecs_map_iter_t it = ecs_map_iter(&index->tables);
+    while (ecs_map_next(&it)) {
+        flecs_union_table_fini(world, ecs_map_ptr(&it));
+    }
+
+    ecs_map_fini(&index->tables);
+    flecs_free_t(&world->allocator, ecs_union_index_t, index);
+    ext->union_index = NULL;
+}
+
+void flecs_union_index_invalidate(
+    ecs_component_record_t *cr,
+    const ecs_table_t *table)
+{
+    ecs_pair_record_ext_t *ext = cr->pair ? cr->pair->ext : NULL;
+    ecs_union_index_t *index = ext ? ext->union_index : NULL;
+    if (!index) {
+        return;
+    }
+
+    ecs_union_table_t *ut = ecs_map_get_deref(
+        &index->tables, ecs_union_table_t, table->id);
+    if (ut) {
+        ut->dirty = true;
+    }
+}
+
+void flecs_union_index_remove_table(
+    ecs_world_t *world,
+    ecs_component_record_t *cr,
+    const ecs_table_t *table)
+{
+    ecs_pair_record_ext_t *ext = cr->pair ? cr->pair->ext : NULL;
+    ecs_union_index_t *index = ext ? ext->union_index : NULL;
+    if (!index) {
+        return;
+    }
+
+    ecs_union_table_t *ut = ecs_map_get_deref(
+        &index->tables, ecs_union_table_t, table->id);
+    if (ut && ut->table == table) {
+        ecs_map_remove(&index->tables, table->id);
+        flecs_union_table_fini(world, ut);
+    }
+}
+
+const ecs_union_table_t* flecs_union_index_get(
+    ecs_world_t *world,
+    ecs_component_record_t *cr,
+    ecs_table_t *table)
+{
+    ecs_assert(cr->flags & EcsIdIsUnion, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(cr->sparse != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    ecs_pair_record_ext_t *ext = flecs_pair_record_ext_ensure(world, cr);
+    ecs_union_index_t *index = ext->union_index;
+    if (!index) {
+        index = ext->union_index = flecs_calloc_t(
+            &world->allocator, ecs_union_index_t);
+        ecs_map_init(&index->tables, &world->allocator);
+    }
+
+    ecs_union_table_t **ut_ptr = ecs_map_ensure_ref(
+        &index->tables, ecs_union_table_t, table->id);
+    ecs_union_table_t *ut = ut_ptr[0];
+    if (!ut) {
+        ut = ut_ptr[0] = flecs_calloc_t(&world->allocator, ecs_union_table_t);
+        ecs_vec_init_t(&world->allocator, &ut->targets, ecs_union_target_t, 0);
+        ecs_map_init(&ut->target_index, &world->allocator);
+    } else if (!ut->dirty && ut->table == table &&
+        ut->table_version == table->version && 
+        ut->count == ecs_table_count(table))
+    {
+        return ut;
+    }
+
+    flecs_union_table_build(world, cr, ut, table);
+
+    return ut;
+}
+
+const ecs_union_target_t* flecs_union_table_get_target(
+    const ecs_union_table_t *ut,
+    ecs_entity_t tgt)
+{
+    ecs_map_val_t *index = ecs_map_get(&ut->target_index, tgt);
+    if (!index) {
+        return NULL;
+    }
+
+    return ecs_vec_get_t(&ut->targets, ecs_union_target_t,
+        (int32_t)index[0] - 1);
+}
+
+void flecs_union_target_seek(
+    const ecs_union_target_t *ut,
+    int32_t row,
+    int32_t *word,
+    int32_t *bit)
+{
+    const ecs_union_word_t *words = ecs_vec_first(&ut->words);
+    int32_t word_index = row >> 6;
+    int32_t lo = 0, hi = ecs_vec_count(&ut->words);
+
+    /* Find first word with index >= word_index */
+    while (lo < hi) {
+        int32_t mid = lo + (hi - lo) / 2;
+        if (words[mid].index < word_index) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    *word = lo;
+    if (lo < ecs_vec_count(&ut->words) && words[lo].index == word_index) {
+        *bit = row & 63;
+    } else {
+        *bit = 0;
+    }
+}
+
+bool flecs_union_target_next_range(
+    const ecs_union_target_t *ut,
+    int32_t *word,
+    int32_t *bit,
+    int32_t *offset,
+    int32_t *count)
+{
+    const ecs_union_word_t *words = ecs_vec_first(&ut->words);
+    int32_t w = *word, b = *bit, word_count = ecs_vec_count(&ut->words);
+    uint64_t bits = 0;
+
+    /* Find first set bit at or after the current position */
+    for (; w < word_count; w ++, b = 0) {
+        bits = words[w].bits & (UINT64_MAX << b);
+        if (bits) {
+            break;
+        }
+    }
+
+    if (w == word_count) {
+        *word = w;
+        *bit = 0;
+        return false;
+    }
+
+    int32_t start_bit = flecs_ctz64(bits);
+    int32_t start = words[w].index * 64 + start_bit;
+
+    /* Find first unset bit after start. A range can span multiple words if
+     * the words are adjacent and all bits in between are set. */
+    uint64_t unset = ~words[w].bits & (UINT64_MAX << start_bit);
+    while (!unset) {
+        if ((w + 1) == word_count || words[w + 1].index != (words[w].index + 1)) {
+            *offset = start;
+            *count = (words[w].index + 1) * 64 - start;
+            *word = w + 1;
+            *bit = 0;
+            return true;
+        }
+
+        w ++;
+        unset = ~words[w].bits;
+    }
+
+    int32_t end_bit = flecs_ctz64(unset);
+    *offset = start;
+    *count = words[w].index * 64 + end_bit - start;
+    *word = w;
+    *bit = end_bit;
+    return true;
+}
+
+void flecs_union_set(
+    ecs_component_record_t *cr,
+    const ecs_table_t *table,
+    ecs_entity_t entity,
+    ecs_entity_t tgt)
+{
+    if (flecs_switch_set(cr->sparse, (uint32_t)entity, tgt)) {
+        flecs_union_index_invalidate(cr, table);
+    }
+}
+
 /**
  * @file addons/json/deserialize.c
  * @brief Deserialize JSON strings into (component) values.
@@ -43477,6 +47958,16 @@ int flecs_json_serialize_iter_result(
     const ecs_iter_to_json_desc_t *desc,
     ecs_json_ser_ctx_t *ser_ctx);
 
+/* Serialize count rows of iterator result, starting from row */
+int flecs_json_serialize_iter_result_rows(
+    const ecs_world_t *world,
+    const ecs_iter_t *it,
+    ecs_strbuf_t *buf,
+    const ecs_iter_to_json_desc_t *desc,
+    ecs_json_ser_ctx_t *ser_ctx,
+    int32_t row,
+    int32_t count);
+
 void flecs_json_serialize_field(
     const ecs_world_t *world,
     const ecs_iter_t *it,
@@ -43515,6 +48006,7 @@ int flecs_json_serialize_iter_result_table(
     const ecs_iter_t *it, 
     ecs_strbuf_t *buf,
     const ecs_iter_to_json_desc_t *desc,
+    int32_t row,
     int32_t count,
     bool has_this,
     const char *parent_path,
@@ -43526,6 +48018,7 @@ int flecs_json_serialize_iter_result_query(
     ecs_strbuf_t *buf,
     ecs_json_ser_ctx_t *ser_ctx,
     const ecs_iter_to_json_desc_t *desc,
+    int32_t row,
     int32_t count,
     bool has_this,
     const char *parent_path,
@@ -46629,6 +51122,9 @@ void flecs_json_serialize_field(
 
 #ifdef FLECS_JSON
 
+#ifdef FLECS_PIPELINE
+#endif
+
 static
 void flecs_json_serialize_id_str(
     const ecs_world_t *world,
@@ -46895,6 +51391,258 @@ void flecs_iter_free_ser_ctx(
     }
 }
 
+static
+void flecs_json_init_ser_ctx(
+    const ecs_world_t *world,
+    ecs_json_ser_ctx_t *ser_ctx)
+{
+    /* Cache component record for flecs.doc ids */
+    ecs_os_zeromem(ser_ctx);
+#ifdef FLECS_DOC
+    ser_ctx->cr_doc_name = flecs_components_get(world, 
+        ecs_pair_t(EcsDocDescription, EcsName));
+    ser_ctx->cr_doc_color = flecs_components_get(world, 
+        ecs_pair_t(EcsDocDescription, EcsDocColor));
+#else
+    (void)world;
+#endif
+}
+
+#ifdef FLECS_PIPELINE
+
+/* Max number of rows in a chunk of a result that's serialized by a worker */
+#define FLECS_JSON_PARALLEL_CHUNK_SIZE (1024)
+
+/* Rows of a query result that are serialized by a single worker */
+typedef struct ecs_json_chunk_t {
+    int32_t result;             /* Index of result in query iteration */
+    int32_t row;                /* First row in result */
+    int32_t count;              /* Number of rows */
+    int32_t worker;             /* Worker that serialized the chunk */
+    int32_t offset;             /* Offset of chunk in worker output */
+    int32_t length;             /* Length of chunk in worker output */
+} ecs_json_chunk_t;
+
+typedef struct ecs_json_worker_t {
+    ecs_strbuf_t buf;           /* Output of chunks serialized by worker */
+    char *json;                 /* Buffer contents after worker is done */
+    bool error;
+} ecs_json_worker_t;
+
+typedef struct ecs_json_parallel_ctx_t {
+    ecs_world_t *world;
+    ecs_query_t *query;
+    const ecs_iter_to_json_desc_t *desc;
+    ecs_flags32_t iter_flags;   /* Flags to copy to worker iterators */
+    ecs_json_chunk_t *chunks;
+    int32_t chunk_count;
+    int32_t next_chunk;         /* Next chunk to claim by a worker */
+    ecs_json_worker_t *workers;
+} ecs_json_parallel_ctx_t;
+
+static
+bool flecs_json_can_serialize_parallel(
+    const ecs_world_t *world,
+    const ecs_iter_t *it,
+    const ecs_iter_to_json_desc_t *desc)
+{
+    if (!desc || !desc->parallel || desc->dont_serialize_results) {
+        return false;
+    }
+
+    if (ecs_get_stage_count(world) <= 1) {
+        return false;
+    }
+
+    if (world->flags & EcsWorldReadonly || ecs_is_deferred(world)) {
+        return false;
+    }
+
+    /* Workers create their own iterators for the query, which is only 
+     * possible if the iterator is a query iterator that hasn't started yet 
+     * and that has no constraints that only exist on the iterator. */
+    if (it->next != ecs_query_next || !it->query || it->world != world) {
+        return false;
+    }
+
+    if (it->flags & EcsIterIsValid || it->constrained_vars) {
+        return false;
+    }
+
+    if (it->priv_.iter.query.iter_single_group) {
+        return false;
+    }
+
+    return true;
+}
+
+/* Split query results into chunks. Chunks are claimed by workers in order,
+ * which lets each worker iterate the query once while skipping results that
+ * were claimed by other workers. */
+static
+void flecs_json_parallel_chunks(
+    ecs_json_parallel_ctx_t *ctx,
+    ecs_vec_t *chunks)
+{
+    ecs_world_t *world = ctx->world;
+    ecs_iter_t qit = ecs_query_iter(world, ctx->query);
+    ECS_BIT_SET(qit.flags, EcsIterNoData);
+
+    int32_t result = 0;
+    while (ecs_query_next(&qit)) {
+        int32_t row = 0, count = qit.count;
+        do {
+            ecs_json_chunk_t *chunk = ecs_vec_append_t(
+                NULL, chunks, ecs_json_chunk_t);
+            ecs_os_zeromem(chunk);
+            chunk->result = result;
+            chunk->row = row;
+            chunk->count = count - row;
+            if (chunk->count > FLECS_JSON_PARALLEL_CHUNK_SIZE) {
+                chunk->count = FLECS_JSON_PARALLEL_CHUNK_SIZE;
+            }
+            row += chunk->count;
+        } while (row < count);
+
+        result ++;
+    }
+
+    ctx->chunks = ecs_vec_first_t(chunks, ecs_json_chunk_t);
+    ctx->chunk_count = ecs_vec_count(chunks);
+}
+
+static
+void flecs_json_parallel_job(
+    void *ptr,
+    int32_t worker_index)
+{
+    ecs_json_parallel_ctx_t *ctx = ptr;
+    ecs_json_worker_t *worker = &ctx->workers[worker_index];
+    ecs_world_t *stage = ecs_get_stage(ctx->world, worker_index);
+    ecs_strbuf_t *buf = &worker->buf;
+
+    ecs_json_ser_ctx_t ser_ctx;
+    flecs_json_init_ser_ctx(ctx->world, &ser_ctx);
+
+    ecs_iter_t it = ecs_query_iter(stage, ctx->query);
+    it.flags |= ctx->iter_flags;
+
+    bool valid = true;
+    int32_t result = -1, chunk_index;
+    while ((chunk_index = ecs_os_ainc(&ctx->next_chunk) - 1) < 
+        ctx->chunk_count) 
+    {
+        ecs_json_chunk_t *chunk = &ctx->chunks[chunk_index];
+        while (valid && (result < chunk->result)) {
+            valid = ecs_query_next(&it);
+            result ++;
+        }
+
+        if (!valid) {
+            /* Query returned fewer results than when chunks were created */
+            ecs_assert(false, ECS_INTERNAL_ERROR, NULL);
+            worker->error = true;
+            break;
+        }
+
+        chunk->worker = worker_index;
+        chunk->offset = ecs_strbuf_written(buf);
+
+        /* Use same separator as results array. Chunks are joined with a
+         * separator when all workers are done. */
+        ecs_strbuf_list_push(buf, "", ", ");
+        if (flecs_json_serialize_iter_result_rows(ctx->world, &it, buf, 
+            ctx->desc, &ser_ctx, chunk->row, chunk->count)) 
+        {
+            worker->error = true;
+            break;
+        }
+        ecs_strbuf_list_pop(buf, "");
+
+        chunk->length = ecs_strbuf_written(buf) - chunk->offset;
+    }
+
+    if (valid) {
+        ecs_iter_fini(&it);
+    }
+
+    int32_t f, field_count = ctx->query->field_count;
+    for (f = 0; f < field_count; f ++) {
+        ecs_os_free(ser_ctx.value_ctx[f].id_label);
+    }
+
+    worker->json = ecs_strbuf_get(buf);
+}
+
+/* Serialize results on worker threads into a buffer per worker, then append
+ * serialized chunks to the output in the order of the query results. */
+static
+int flecs_json_serialize_results_parallel(
+    ecs_world_t *world,
+    ecs_iter_t *it,
+    ecs_strbuf_t *buf,
+    const ecs_iter_to_json_desc_t *desc)
+{
+    ecs_query_t *q = ECS_CONST_CAST(ecs_query_t*, it->query);
+    int32_t i, worker_count = ecs_get_stage_count(world);
+    int result = 0;
+
+    ecs_json_parallel_ctx_t ctx = {
+        .world = world,
+        .query = q,
+        .desc = desc,
+        .iter_flags = it->flags & EcsIterNoData
+    };
+
+    /* Workers iterate the query, which shouldn't count as evaluations */
+    int32_t eval_count = q->eval_count;
+
+    /* Make sure query caches are up to date before creating chunks */
+    ecs_run_aperiodic(world, 0);
+
+    ecs_iter_fini(it);
+
+    ecs_vec_t chunks;
+    ecs_vec_init_t(NULL, &chunks, ecs_json_chunk_t, 0);
+    flecs_json_parallel_chunks(&ctx, &chunks);
+
+    ctx.workers = ecs_os_calloc_n(ecs_json_worker_t, worker_count);
+
+    flecs_workers_run(world, flecs_json_parallel_job, &ctx);
+
+    q->eval_count = eval_count;
+
+    for (i = 0; i < worker_count; i ++) {
+        if (ctx.workers[i].error) {
+            result = -1;
+            goto done;
+        }
+    }
+
+    for (i = 0; i < ctx.chunk_count; i ++) {
+        ecs_json_chunk_t *chunk = &ctx.chunks[i];
+        if (!chunk->length) {
+            continue;
+        }
+
+        flecs_json_next(buf);
+        ecs_strbuf_appendstrn(buf, 
+            &ctx.workers[chunk->worker].json[chunk->offset], chunk->length);
+    }
+
+done:
+    for (i = 0; i < worker_count; i ++) {
+        ecs_os_free(ctx.workers[i].json);
+    }
+
+    ecs_os_free(ctx.workers);
+    ecs_vec_fini_t(NULL, &chunks, ecs_json_chunk_t);
+
+    return result;
+}
+
+#endif
+
 int ecs_iter_to_json_buf(
     ecs_iter_t *it,
     ecs_strbuf_t *buf,
@@ -46902,15 +51650,8 @@ int ecs_iter_to_json_buf(
 {
     ecs_world_t *world = it->real_world;
 
-    /* Cache component record for flecs.doc ids */
     ecs_json_ser_ctx_t ser_ctx;
-    ecs_os_zeromem(&ser_ctx);
-#ifdef FLECS_DOC
-    ser_ctx.cr_doc_name = flecs_components_get(world, 
-        ecs_pair_t(EcsDocDescription, EcsName));
-    ser_ctx.cr_doc_color = flecs_components_get(world, 
-        ecs_pair_t(EcsDocDescription, EcsDocColor));
-#endif
+    flecs_json_init_ser_ctx(world, &ser_ctx);
 
     flecs_json_object_push(buf);
 
@@ -46950,13 +51691,25 @@ int ecs_iter_to_json_buf(
             ECS_BIT_SET(it->flags, EcsIterNoData);
         }
 
-        ecs_iter_next_action_t next = it->next;
-        while (next(it)) {
-            if (flecs_json_serialize_iter_result(world, it, buf, desc, &ser_ctx)) {
-                ecs_strbuf_reset(buf);
-                flecs_iter_free_ser_ctx(it, &ser_ctx);
-                ecs_iter_fini(it);
-                return -1;
+        bool parallel = false;
+#ifdef FLECS_PIPELINE
+        parallel = flecs_json_can_serialize_parallel(world, it, desc);
+        if (parallel) {
+            if (flecs_json_serialize_results_parallel(world, it, buf, desc)) {
+                goto error;
+            }
+        }
+#endif
+
+        if (!parallel) {
+            ecs_iter_next_action_t next = it->next;
+            while (next(it)) {
+                if (flecs_json_serialize_iter_result(
+                    world, it, buf, desc, &ser_ctx)) 
+                {
+                    ecs_iter_fini(it);
+                    goto error;
+                }
             }
         }
 
@@ -46970,6 +51723,10 @@ int ecs_iter_to_json_buf(
     flecs_json_object_pop(buf);
 
     return 0;
+error:
+    ecs_strbuf_reset(buf);
+    flecs_iter_free_ser_ctx(it, &ser_ctx);
+    return -1;
 }
 
 char* ecs_iter_to_json(
@@ -47398,22 +52155,26 @@ void flecs_json_serialize_iter_this(
     }
 }
 
-int flecs_json_serialize_iter_result(
+int flecs_json_serialize_iter_result_rows(
     const ecs_world_t *world, 
     const ecs_iter_t *it, 
     ecs_strbuf_t *buf,
     const ecs_iter_to_json_desc_t *desc,
-    ecs_json_ser_ctx_t *ser_ctx)
+    ecs_json_ser_ctx_t *ser_ctx,
+    int32_t row,
+    int32_t count)
 {
     char *parent_path = NULL;
     ecs_json_this_data_t this_data = {0};
 
-    int32_t count = it->count;
     bool has_this = true;
-    if (!count) {
+    if (!it->count) {
+        row = 0;
         count = 1; /* Query without this variable */
         has_this = false;
     } else {
+        ecs_assert(row >= 0, ECS_INTERNAL_ERROR, NULL);
+        ecs_assert((row + count) <= it->count, ECS_INTERNAL_ERROR, NULL);
         ecs_table_t *table = it->table;
         if (table) {
             this_data.ids = &ecs_table_entities(table)[it->offset];
@@ -47466,13 +52227,13 @@ int flecs_json_serialize_iter_result(
 
     if (desc && desc->serialize_table) {
         if (flecs_json_serialize_iter_result_table(world, it, buf, 
-            desc, count, has_this, parent_path, &this_data))
+            desc, row, count, has_this, parent_path, &this_data))
         {
             goto error;
         }
     } else {
         if (flecs_json_serialize_iter_result_query(world, it, buf, ser_ctx, 
-            desc, count, has_this, parent_path, &this_data))
+            desc, row, count, has_this, parent_path, &this_data))
         {
             goto error;
         }
@@ -47485,6 +52246,17 @@ error:
     return -1;
 }
 
+int flecs_json_serialize_iter_result(
+    const ecs_world_t *world, 
+    const ecs_iter_t *it, 
+    ecs_strbuf_t *buf,
+    const ecs_iter_to_json_desc_t *desc,
+    ecs_json_ser_ctx_t *ser_ctx)
+{
+    return flecs_json_serialize_iter_result_rows(
+        world, it, buf, desc, ser_ctx, 0, it->count);
+}
+
 #endif
 
 /**
@@ -47715,6 +52487,7 @@ int flecs_json_serialize_iter_result_query(
     ecs_strbuf_t *buf,
     ecs_json_ser_ctx_t *ser_ctx,
     const ecs_iter_to_json_desc_t *desc,
+    int32_t row,
     int32_t count,
     bool has_this,
     const char *parent_path,
@@ -47732,8 +52505,8 @@ int flecs_json_serialize_iter_result_query(
         common_data = ecs_strbuf_get(&common_data_buf);
     }
 
-    int32_t i;
-    for (i = 0; i < count; i ++) {
+    int32_t i, end = row + count;
+    for (i = row; i < end; i ++) {
         flecs_json_next(buf);
         flecs_json_object_push(buf);
 
@@ -48233,6 +53006,7 @@ int flecs_json_serialize_iter_result_table(
     const ecs_iter_t *it, 
     ecs_strbuf_t *buf,
     const ecs_iter_to_json_desc_t *desc,
+    int32_t row,
     int32_t count,
     bool has_this,
     const char *parent_path,
@@ -48264,9 +53038,9 @@ int flecs_json_serialize_iter_result_table(
     ecs_json_value_ser_ctx_t values_ctx[FLECS_JSON_MAX_TABLE_COMPONENTS] = {{0}};
     int32_t component_count = 0;
 
-    int32_t i, end = it->offset + count;
+    int32_t i, end = it->offset + row + count;
     int result = 0;
-    for (i = it->offset; i < end; i ++) {
+    for (i = it->offset + row; i < end; i ++) {
         flecs_json_next(buf);
         flecs_json_object_push(buf);
 
@@ -57053,8 +61827,258 @@ void ecs_meta_type_serialized_init(
  * @brief Builtin implementation for OS API.
  */
 
+/**
+ * @file addons/os_api_impl/os_api_impl.h
+ * @brief Internal functions of the builtin OS API implementation.
+ */
+
+#ifndef FLECS_OS_API_IMPL_PRIVATE_H
+#define FLECS_OS_API_IMPL_PRIVATE_H
 
 #ifdef FLECS_OS_API_IMPL
+
+/* Builtin parallel_for, runs jobs on a persistent thread pool */
+void flecs_os_pool_parallel_for(
+    ecs_os_parallel_job_t job,
+    void *ctx,
+    int32_t count);
+
+/* Test if the builtin parallel_for is set, but creates tasks for each call
+ * because the application provides its own task API */
+bool flecs_os_pool_uses_tasks(void);
+
+#endif
+
+#endif
+
+
+#ifdef FLECS_OS_API_IMPL
+
+/* Persistent thread pool for parallel_for. Threads are created the first time
+ * they're needed and kept around until the OS API is deinitialized, so that
+ * running jobs doesn't require creating and joining threads. */
+typedef struct flecs_os_pool_t {
+    ecs_os_mutex_t lock;           /* Protects job state */
+    ecs_os_cond_t work_cond;       /* Signals threads that work is available */
+    ecs_os_cond_t done_cond;       /* Signals caller that all jobs finished */
+    ecs_os_thread_t *threads;
+    int32_t thread_count;
+    ecs_os_parallel_job_t job;     /* Set while the pool is running jobs */
+    void *ctx;
+    int32_t count;                 /* Number of job invocations */
+    int32_t next;                  /* Next index to claim */
+    int32_t remaining;             /* Invocations that haven't finished */
+    bool quit;
+} flecs_os_pool_t;
+
+typedef struct flecs_os_pool_task_t {
+    ecs_os_parallel_job_t job;
+    void *ctx;
+    int32_t index;
+} flecs_os_pool_task_t;
+
+static flecs_os_pool_t flecs_os_pool;
+
+/* Claim and run jobs until none are left. Must be called with lock held. */
+static
+void flecs_os_pool_run_jobs(
+    flecs_os_pool_t *pool)
+{
+    while (pool->next < pool->count) {
+        int32_t index = pool->next ++;
+        ecs_os_parallel_job_t job = pool->job;
+        void *ctx = pool->ctx;
+
+        ecs_os_mutex_unlock(pool->lock);
+        job(ctx, index);
+        ecs_os_mutex_lock(pool->lock);
+
+        if (!--pool->remaining) {
+            ecs_os_cond_signal(pool->done_cond);
+        }
+    }
+}
+
+static
+void* flecs_os_pool_thread(
+    void *arg)
+{
+    flecs_os_pool_t *pool = arg;
+
+    ecs_os_mutex_lock(pool->lock);
+    while (!pool->quit) {
+        flecs_os_pool_run_jobs(pool);
+        if (!pool->quit) {
+            ecs_os_cond_wait(pool->work_cond, pool->lock);
+        }
+    }
+    ecs_os_mutex_unlock(pool->lock);
+
+    return NULL;
+}
+
+static
+void* flecs_os_pool_task(
+    void *arg)
+{
+    flecs_os_pool_task_t *task = arg;
+    task->job(task->ctx, task->index);
+    return NULL;
+}
+
+static
+void flecs_os_pool_run_inline(
+    ecs_os_parallel_job_t job,
+    void *ctx,
+    int32_t count)
+{
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        job(ctx, i);
+    }
+}
+
+/* Used when the application provides its own task API, so that jobs keep
+ * running on the application's task system. Without task support jobs are
+ * ran on the calling thread. */
+static
+void flecs_os_pool_run_tasks(
+    ecs_os_parallel_job_t job,
+    void *ctx,
+    int32_t count)
+{
+    if (!ecs_os_has_task_support()) {
+        flecs_os_pool_run_inline(job, ctx, count);
+        return;
+    }
+
+    flecs_os_pool_task_t *tasks = ecs_os_malloc_n(
+        flecs_os_pool_task_t, count);
+    ecs_os_thread_t *handles = ecs_os_malloc_n(ecs_os_thread_t, count);
+
+    int32_t i;
+    for (i = 1; i < count; i ++) {
+        tasks[i] = (flecs_os_pool_task_t){ job, ctx, i };
+        handles[i] = ecs_os_task_new(flecs_os_pool_task, &tasks[i]);
+        ecs_assert(handles[i] != 0, ECS_OPERATION_FAILED,
+            "failed to create task");
+    }
+
+    job(ctx, 0);
+
+    for (i = 1; i < count; i ++) {
+        ecs_os_task_join(handles[i]);
+    }
+
+    ecs_os_free(handles);
+    ecs_os_free(tasks);
+}
+
+bool flecs_os_pool_uses_tasks(void) {
+    return (ecs_os_api.parallel_for_ == flecs_os_pool_parallel_for) &&
+        (ecs_os_api.task_new_ != ecs_os_api.thread_new_);
+}
+
+void flecs_os_pool_parallel_for(
+    ecs_os_parallel_job_t job,
+    void *ctx,
+    int32_t count)
+{
+    flecs_os_pool_t *pool = &flecs_os_pool;
+
+    if (count <= 1) {
+        flecs_os_pool_run_inline(job, ctx, count);
+        return;
+    }
+
+    if (!pool->lock || (ecs_os_api.task_new_ != ecs_os_api.thread_new_)) {
+        flecs_os_pool_run_tasks(job, ctx, count);
+        return;
+    }
+
+    ecs_os_mutex_lock(pool->lock);
+
+    if (pool->job) {
+        /* Pool is already running jobs, which happens when parallel_for is
+         * called from inside a job or from another thread. Waiting for the 
+         * pool from inside a job would deadlock, so run on calling thread. */
+        ecs_os_mutex_unlock(pool->lock);
+        flecs_os_pool_run_inline(job, ctx, count);
+        return;
+    }
+
+    /* The calling thread runs the first job, so count - 1 threads is enough */
+    if (pool->thread_count < (count - 1)) {
+        pool->threads = ecs_os_realloc_n(
+            pool->threads, ecs_os_thread_t, count - 1);
+        int32_t i;
+        for (i = pool->thread_count; i < (count - 1); i ++) {
+            pool->threads[i] = ecs_os_thread_new(flecs_os_pool_thread, pool);
+            ecs_assert(pool->threads[i] != 0, ECS_OPERATION_FAILED,
+                "failed to create thread");
+        }
+        pool->thread_count = count - 1;
+    }
+
+    /* Index 0 runs on the calling thread, pool threads claim the rest */
+    pool->job = job;
+    pool->ctx = ctx;
+    pool->count = count;
+    pool->next = 1;
+    pool->remaining = count - 1;
+    ecs_os_cond_broadcast(pool->work_cond);
+
+    ecs_os_mutex_unlock(pool->lock);
+    job(ctx, 0);
+    ecs_os_mutex_lock(pool->lock);
+
+    while (pool->remaining) {
+        ecs_os_cond_wait(pool->done_cond, pool->lock);
+    }
+
+    pool->job = NULL;
+    pool->ctx = NULL;
+
+    ecs_os_mutex_unlock(pool->lock);
+}
+
+static
+void flecs_os_pool_init(void) {
+    flecs_os_pool_t *pool = &flecs_os_pool;
+    ecs_os_zeromem(pool);
+    if (!ecs_os_has_threading()) {
+        return;
+    }
+
+    pool->lock = ecs_os_mutex_new();
+    pool->work_cond = ecs_os_cond_new();
+    pool->done_cond = ecs_os_cond_new();
+}
+
+static
+void flecs_os_pool_fini(void) {
+    flecs_os_pool_t *pool = &flecs_os_pool;
+    if (!pool->lock) {
+        return;
+    }
+
+    ecs_os_mutex_lock(pool->lock);
+    pool->quit = true;
+    ecs_os_cond_broadcast(pool->work_cond);
+    ecs_os_mutex_unlock(pool->lock);
+
+    int32_t i;
+    for (i = 0; i < pool->thread_count; i ++) {
+        ecs_os_thread_join(pool->threads[i]);
+    }
+
+    ecs_os_free(pool->threads);
+    ecs_os_cond_free(pool->done_cond);
+    ecs_os_cond_free(pool->work_cond);
+    ecs_os_mutex_free(pool->lock);
+    ecs_os_zeromem(pool);
+}
+
 #ifdef ECS_TARGET_WINDOWS
 /**
  * @file addons/os_api_impl/posix_impl.inl
@@ -57307,8 +62331,26 @@ uint64_t win_time_now(void) {
     return now;
 }
 
+static
+void win_sleep_until(
+    uint64_t deadline)
+{
+    uint64_t now = win_time_now();
+    if (deadline > now) {
+        uint64_t t = deadline - now;
+        win_sleep((int32_t)(t / 1000000000), (int32_t)(t % 1000000000));
+    }
+}
+
+static
+void win_init(void) {
+    flecs_os_pool_init();
+}
+
 static
 void win_fini(void) {
+    flecs_os_pool_fini();
+
     if (ecs_os_api.flags_ & EcsOsApiHighResolutionTimer) {
         win_enable_high_timer_resolution(false);
     }
@@ -57324,6 +62366,7 @@ void ecs_set_os_api_impl(void) {
     api.thread_self_ = win_thread_self;
     api.task_new_ = win_thread_new;
     api.task_join_ = win_thread_join;
+    api.parallel_for_ = flecs_os_pool_parallel_for;
     api.ainc_ = win_ainc;
     api.adec_ = win_adec;
     api.lainc_ = win_lainc;
@@ -57338,7 +62381,9 @@ void ecs_set_os_api_impl(void) {
     api.cond_broadcast_ = win_cond_broadcast;
     api.cond_wait_ = win_cond_wait;
     api.sleep_ = win_sleep;
+    api.sleep_until_ = win_sleep_until;
     api.now_ = win_time_now;
+    api.init_ = win_init;
     api.fini_ = win_fini;
 
     win_time_setup();
@@ -57357,6 +62402,7 @@ void ecs_set_os_api_impl(void) {
  */
 
 #include "pthread.h"
+#include <errno.h>
 
 #if defined(__APPLE__) && defined(__MACH__)
 #include <mach/mach_time.h>
@@ -57651,6 +62697,32 @@ uint64_t posix_time_now(void) {
     return now;
 }
 
+static
+void posix_sleep_until(
+    uint64_t deadline)
+{
+#if defined(ECS_TARGET_LINUX) && defined(TIMER_ABSTIME)
+    /* Absolute deadlines don't drift when the thread is preempted between
+     * computing the sleep interval and going to sleep. */
+    struct timespec ts;
+    ts.tv_sec = (time_t)(deadline / 1000000000);
+    ts.tv_nsec = (long)(deadline % 1000000000);
+    int res;
+    while ((res = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL))) {
+        if (res != EINTR) {
+            ecs_err("clock_nanosleep failed");
+            break;
+        }
+    }
+#else
+    uint64_t now = posix_time_now();
+    if (deadline > now) {
+        uint64_t t = deadline - now;
+        posix_sleep((int32_t)(t / 1000000000), (int32_t)(t % 1000000000));
+    }
+#endif
+}
+
 void ecs_set_os_api_impl(void) {
     ecs_os_set_api_defaults();
 
@@ -57661,6 +62733,7 @@ void ecs_set_os_api_impl(void) {
     api.thread_self_ = posix_thread_self;
     api.task_new_ = posix_thread_new;
     api.task_join_ = posix_thread_join;
+    api.parallel_for_ = flecs_os_pool_parallel_for;
     api.ainc_ = posix_ainc;
     api.adec_ = posix_adec;
     api.lainc_ = posix_lainc;
@@ -57675,7 +62748,10 @@ void ecs_set_os_api_impl(void) {
     api.cond_broadcast_ = posix_cond_broadcast;
     api.cond_wait_ = posix_cond_wait;
     api.sleep_ = posix_sleep;
+    api.sleep_until_ = posix_sleep_until;
     api.now_ = posix_time_now;
+    api.init_ = flecs_os_pool_init;
+    api.fini_ = flecs_os_pool_fini;
 
     posix_time_setup();
 
@@ -58325,6 +63401,168 @@ const char* flecs_token(
 
 #ifdef FLECS_PIPELINE
 
+/* Initial time to spin before a frame deadline, before it is calibrated */
+#define FLECS_FRAME_SPIN_TIME (200 * 1000)
+
+/* Minimum time to spin before a frame deadline */
+#define FLECS_FRAME_SPIN_TIME_MIN (50 * 1000)
+
+/* Maximum time to spin before a frame deadline. Limits how much CPU time is
+ * burned when the OS oversleeps by a lot, at the cost of frame pacing. */
+#define FLECS_FRAME_SPIN_TIME_MAX (1000 * 1000)
+
+static
+int32_t flecs_frame_histogram_index(
+    uint64_t us)
+{
+    if (us < FLECS_FRAME_HISTOGRAM_SUB) {
+        return (int32_t)us;
+    }
+
+    int32_t msb = 0;
+    uint64_t v = us;
+    while (v >>= 1) {
+        msb ++;
+    }
+
+    int32_t shift = msb - FLECS_FRAME_HISTOGRAM_SUB_BITS;
+    int32_t index = (shift + 1) * FLECS_FRAME_HISTOGRAM_SUB + 
+        (int32_t)((us >> shift) & (FLECS_FRAME_HISTOGRAM_SUB - 1));
+    if (index >= FLECS_FRAME_HISTOGRAM_BUCKETS) {
+        index = FLECS_FRAME_HISTOGRAM_BUCKETS - 1;
+    }
+
+    return index;
+}
+
+/* Returns center of the bucket in seconds */
+static
+double flecs_frame_histogram_value(
+    int32_t index)
+{
+    if (index < FLECS_FRAME_HISTOGRAM_SUB) {
+        return ((double)index + 0.5) / 1000000.0;
+    }
+
+    int32_t shift = index / FLECS_FRAME_HISTOGRAM_SUB - 1;
+    uint64_t sub = (uint64_t)(index % FLECS_FRAME_HISTOGRAM_SUB);
+    uint64_t lo = (FLECS_FRAME_HISTOGRAM_SUB + sub) << shift;
+    uint64_t width = 1ull << shift;
+    return ((double)lo + (double)width / 2.0) / 1000000.0;
+}
+
+/* Add frame time to histogram and update percentiles in world info */
+static
+void flecs_frame_histogram_record(
+    ecs_world_t *world,
+    ecs_ftime_t delta_time)
+{
+    ecs_frame_histogram_t *h = &world->frame_histogram;
+    uint64_t ns = (uint64_t)((double)delta_time * 1000000000.0);
+
+    if (h->count == FLECS_FRAME_HISTOGRAM_WINDOW) {
+        /* Halve counts so that older frames gradually stop contributing */
+        uint32_t i, count = 0;
+        for (i = 0; i < FLECS_FRAME_HISTOGRAM_BUCKETS; i ++) {
+            count += (h->buckets[i] >>= 1);
+        }
+        h->count = count;
+        h->max_prev = h->max;
+        h->max = 0;
+    }
+
+    h->buckets[flecs_frame_histogram_index(ns / 1000)] ++;
+    h->count ++;
+    if (ns > h->max) {
+        h->max = ns;
+    }
+
+    uint64_t max = h->max > h->max_prev ? h->max : h->max_prev;
+    double max_time = (double)max / 1000000000.0;
+    uint32_t p50 = (h->count + 1) / 2, p99 = h->count - h->count / 100;
+    double p50_time = 0, p99_time = 0;
+    uint32_t total = 0;
+    int32_t i;
+    for (i = 0; i < FLECS_FRAME_HISTOGRAM_BUCKETS; i ++) {
+        uint32_t prev = total;
+        total += h->buckets[i];
+        if (prev < p50 && total >= p50) {
+            p50_time = flecs_frame_histogram_value(i);
+        }
+        if (total >= p99) {
+            p99_time = flecs_frame_histogram_value(i);
+            break;
+        }
+    }
+
+    /* Bucket centers can be larger than the actual largest frame time */
+    world->info.frame_time_p50 = (ecs_ftime_t)(p50_time < max_time ? p50_time : max_time);
+    world->info.frame_time_p99 = (ecs_ftime_t)(p99_time < max_time ? p99_time : max_time);
+    world->info.frame_time_max = (ecs_ftime_t)max_time;
+}
+
+/* Wait until the next frame deadline. Sleeps until shortly before the deadline
+ * and spins for the remaining time, since sleeping can overshoot the deadline
+ * by up to a scheduler tick. */
+static
+void flecs_wait_for_deadline(
+    ecs_world_t *world)
+{
+    uint64_t period = (uint64_t)(1000000000.0 / (double)world->info.target_fps);
+    uint64_t now = ecs_os_now();
+    uint64_t deadline = world->frame_deadline + period;
+
+    if (!world->frame_deadline || (now > (deadline + period))) {
+        /* First frame, or more than a frame behind schedule. Don't try to
+         * catch up, start a new schedule from the current time. */
+        world->frame_deadline = now;
+        return;
+    }
+
+    world->frame_deadline = deadline;
+    if (now >= deadline) {
+        return;
+    }
+
+    uint64_t spin = world->frame_spin_time;
+    if (!spin) {
+        spin = FLECS_FRAME_SPIN_TIME;
+    }
+
+    if ((deadline - now) > spin) {
+        uint64_t wake = deadline - spin;
+        if (ecs_os_api.sleep_until_) {
+            ecs_os_sleep_until(wake);
+        } else {
+            ecs_sleepf((double)(wake - now) / 1000000000.0);
+        }
+
+        /* Calibrate spin time so it covers how much the OS oversleeps. Grow
+         * quickly when oversleeping, shrink slowly otherwise. */
+        now = ecs_os_now();
+        uint64_t over = now > wake ? now - wake : 0;
+        uint64_t target = over + over / 2 + FLECS_FRAME_SPIN_TIME_MIN;
+        if (target > spin) {
+            spin = target;
+        } else {
+            spin -= (spin - target) / 16;
+        }
+
+        if (spin > FLECS_FRAME_SPIN_TIME_MAX) {
+            spin = FLECS_FRAME_SPIN_TIME_MAX;
+        }
+        if (spin > (period / 2)) {
+            spin = period / 2;
+        }
+    }
+
+    world->frame_spin_time = spin;
+
+    while (ecs_os_now() < deadline) {
+        /* Spin */
+    }
+}
+
 static
 ecs_ftime_t flecs_insert_sleep(
     ecs_world_t *world,
@@ -58339,6 +63577,15 @@ ecs_ftime_t flecs_insert_sleep(
         return delta_time;
     }
 
+    if (world->flags & EcsWorldPreciseFramePacing) {
+        ecs_os_perf_trace_push("flecs.insert_sleep");
+        flecs_wait_for_deadline(world);
+        ecs_os_perf_trace_pop("flecs.insert_sleep");
+
+        *stop = start;
+        return (ecs_ftime_t)ecs_time_measure(stop);
+    }
+
     ecs_os_perf_trace_push("flecs.insert_sleep");
 
     ecs_ftime_t target_delta_time =
@@ -58383,9 +63630,11 @@ ecs_ftime_t flecs_start_measure_frame(
         (ECS_EQZERO(user_delta_time)))
     {
         ecs_time_t t = world->frame_start_time;
+        bool measured = false;
         do {
             if (world->frame_start_time.nanosec || world->frame_start_time.sec){
                 delta_time = flecs_insert_sleep(world, &t);
+                measured = true;
             } else {
                 ecs_time_measure(&t);
                 if (ECS_NEQZERO(world->info.target_fps)) {
@@ -58408,6 +63657,10 @@ ecs_ftime_t flecs_start_measure_frame(
 
         /* Keep track of total time passed in world */
         world->info.world_time_total_raw += (double)delta_time;
+
+        if (measured) {
+            flecs_frame_histogram_record(world, delta_time);
+        }
     }
 
     return (ecs_ftime_t)delta_time;
@@ -58456,6 +63709,9 @@ ecs_ftime_t ecs_frame_begin(
     world->on_commands_ctx_active = world->on_commands_ctx;
     world->on_commands_ctx = NULL;
 
+    /* Apply commands enqueued from other threads since the last merge */
+    flecs_async_queue_drain(world);
+
     ecs_run_aperiodic(world, 0);
 
     world->flags |= EcsWorldFrameInProgress;
@@ -58481,6 +63737,12 @@ void ecs_frame_end(
         flecs_stage_merge_post_frame(world, world->stages[i]);
     }
 
+    /* Free or delete tables that have been empty for a while */
+    flecs_table_gc_run(world);
+
+    /* Yield existing matches of observers that catch up incrementally */
+    flecs_observers_yield_frame(world);
+
     flecs_stop_measure_frame(world);
 
     /* Reset command handler each frame */
@@ -58745,6 +64007,168 @@ EcsPoly* flecs_pipeline_term_system(
     return poly;
 }
 
+static
+bool flecs_pipeline_term_access(
+    const ecs_term_t *term,
+    bool *read,
+    bool *write)
+{
+    int16_t inout = term->inout;
+    if (inout == EcsInOutNone || inout == EcsInOutFilter) {
+        return false;
+    }
+
+    if (term->oper == EcsNot) {
+        /* Not terms don't access component data. A Not term with Out only 
+         * signals that the component is added with a (deferred) command. */
+        return false;
+    }
+
+    bool from_any = ecs_term_match_0(term);
+    if (inout == EcsInOutDefault) {
+        if (from_any) {
+            return false;
+        }
+
+        bool is_shared = !ecs_term_match_this(term) || 
+            !(term->src.id & EcsSelf);
+        inout = is_shared ? EcsIn : EcsInOut;
+    }
+
+    *read = inout == EcsIn || inout == EcsInOut;
+
+    /* Writes to terms without a source go through the (deferred) stage, and
+     * don't modify the storage while systems are running. */
+    *write = !from_any && (inout == EcsOut || inout == EcsInOut);
+
+    return *read || *write;
+}
+
+static
+bool flecs_pipeline_ids_overlap(
+    ecs_id_t a,
+    ecs_id_t b)
+{
+    if (a == EcsWildcard || b == EcsWildcard) {
+        return true;
+    }
+
+    return ecs_id_match(a, b) || ecs_id_match(b, a);
+}
+
+/* Two systems conflict if one of them writes a component that the other one
+ * reads or writes. */
+static
+bool flecs_pipeline_systems_conflict(
+    const ecs_system_t *a,
+    const ecs_system_t *b)
+{
+    const ecs_query_t *qa = a->query, *qb = b->query;
+    int32_t i, j;
+
+    for (i = 0; i < qa->term_count; i ++) {
+        const ecs_term_t *ta = &qa->terms[i];
+        bool ra = false, wa = false;
+        if (!flecs_pipeline_term_access(ta, &ra, &wa)) {
+            continue;
+        }
+
+        for (j = 0; j < qb->term_count; j ++) {
+            const ecs_term_t *tb = &qb->terms[j];
+            bool rb = false, wb = false;
+            if (!flecs_pipeline_term_access(tb, &rb, &wb)) {
+                continue;
+            }
+
+            if (!wa && !wb) {
+                continue;
+            }
+
+            if (flecs_pipeline_ids_overlap(ta->id, tb->id)) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/* Split ops with multi threaded systems into waves of systems that don't
+ * conflict with each other. The systems in a wave run concurrently, with each
+ * system running on a single worker thread. Threads are synchronized between
+ * waves, but commands are only merged after the last wave. */
+static
+void flecs_pipeline_build_concurrent(
+    ecs_world_t *world,
+    ecs_pipeline_state_t *pq)
+{
+    ecs_allocator_t *a = &world->allocator;
+    int32_t i, op_count = ecs_vec_count(&pq->ops);
+    ecs_system_t **systems = ecs_vec_first_t(&pq->systems, ecs_system_t*);
+
+    ecs_vec_t ops, levels, op_systems;
+    ecs_vec_init_t(a, &ops, ecs_pipeline_op_t, op_count);
+    ecs_vec_init_t(a, &levels, int32_t, 0);
+    ecs_vec_init_t(a, &op_systems, ecs_system_t*, 0);
+
+    for (i = 0; i < op_count; i ++) {
+        ecs_pipeline_op_t *op = ecs_vec_get_t(&pq->ops, ecs_pipeline_op_t, i);
+        if (!op->multi_threaded || op->immediate || (op->count < 2)) {
+            ecs_vec_append_t(a, &ops, ecs_pipeline_op_t)[0] = *op;
+            continue;
+        }
+
+        int32_t j, k, count = op->count, level_count = 0;
+        ecs_vec_set_count_t(a, &levels, int32_t, count);
+        ecs_vec_set_count_t(a, &op_systems, ecs_system_t*, count);
+        int32_t *level = ecs_vec_first_t(&levels, int32_t);
+        ecs_system_t **sys = ecs_vec_first_t(&op_systems, ecs_system_t*);
+        ecs_os_memcpy_n(sys, &systems[op->offset], ecs_system_t*, count);
+
+        /* A system must run after all earlier systems it conflicts with */
+        for (j = 0; j < count; j ++) {
+            level[j] = 0;
+            for (k = 0; k < j; k ++) {
+                if (level[k] >= level[j] && 
+                    flecs_pipeline_systems_conflict(sys[k], sys[j])) 
+                {
+                    level[j] = level[k] + 1;
+                }
+            }
+
+            if (level[j] >= level_count) {
+                level_count = level[j] + 1;
+            }
+        }
+
+        /* Order systems by wave, add op for each wave */
+        int32_t l, offset = op->offset;
+        for (l = 0; l < level_count; l ++) {
+            ecs_pipeline_op_t *wave = ecs_vec_append_t(
+                a, &ops, ecs_pipeline_op_t);
+            *wave = *op;
+            wave->offset = offset;
+            wave->count = 0;
+
+            for (j = 0; j < count; j ++) {
+                if (level[j] == l) {
+                    systems[offset + wave->count] = sys[j];
+                    wave->count ++;
+                }
+            }
+
+            wave->concurrent = wave->count > 1;
+            wave->no_merge = l != (level_count - 1);
+            offset += wave->count;
+        }
+    }
+
+    ecs_vec_fini_t(a, &levels, int32_t);
+    ecs_vec_fini_t(a, &op_systems, ecs_system_t*);
+    ecs_vec_fini_t(a, &pq->ops, ecs_pipeline_op_t);
+    pq->ops = ops;
+}
+
 static
 bool flecs_pipeline_build(
     ecs_world_t *world,
@@ -58845,6 +64269,8 @@ bool flecs_pipeline_build(
                 op->count = 0;
                 op->multi_threaded = false;
                 op->immediate = false;
+                op->concurrent = false;
+                op->no_merge = false;
                 op->time_spent = 0;
                 op->commands_enqueued = 0;
             }
@@ -58869,6 +64295,10 @@ bool flecs_pipeline_build(
     ecs_map_fini(&ws.ids);
     ecs_map_fini(&ws.wildcard_ids);
 
+    if (pq->concurrent) {
+        flecs_pipeline_build_concurrent(world, pq);
+    }
+
     op = ecs_vec_first_t(&pq->ops, ecs_pipeline_op_t);
 
     if (!op) {
@@ -58879,8 +64309,9 @@ bool flecs_pipeline_build(
         ecs_dbg("#[bold]pipeline rebuild");
         ecs_log_push_1();
 
-        ecs_dbg("#[green]schedule#[reset]: threading: %d, staging: %d:", 
-            op->multi_threaded, !op->immediate);
+        ecs_dbg("#[green]schedule#[reset]: threading: %d, staging: %d, "
+            "concurrent: %d:", 
+            op->multi_threaded, !op->immediate, op->concurrent);
         ecs_log_push_1();
 
         int32_t i, count = ecs_vec_count(&pq->systems);
@@ -58915,16 +64346,21 @@ bool flecs_pipeline_build(
 
             ran_since_merge ++;
             if (ran_since_merge == op[op_index].count) {
-                ecs_dbg("#[magenta]merge#[reset]");
+                if (op[op_index].no_merge) {
+                    ecs_dbg("#[magenta]sync#[reset]");
+                } else {
+                    ecs_dbg("#[magenta]merge#[reset]");
+                }
                 ecs_log_pop_1();
                 ran_since_merge = 0;
                 op_index ++;
                 if (op_index < ecs_vec_count(&pq->ops)) {
                     ecs_dbg(
                         "#[green]schedule#[reset]: "
-                        "threading: %d, staging: %d:",
+                        "threading: %d, staging: %d, concurrent: %d:",
                         op[op_index].multi_threaded, 
-                        !op[op_index].immediate);
+                        !op[op_index].immediate,
+                        op[op_index].concurrent);
                 }
                 ecs_log_push_1();
             }
@@ -59029,6 +64465,37 @@ void ecs_run_pipeline(
     }
 }
 
+static
+int32_t flecs_run_pipeline_concurrent_ops(
+    ecs_world_t* world,
+    ecs_stage_t* stage,
+    int32_t stage_index,
+    ecs_ftime_t delta_time)
+{
+    ecs_pipeline_state_t* pq = world->pq;
+    ecs_pipeline_op_t* op = pq->cur_op;
+    ecs_system_t **systems = ecs_vec_first_t(&pq->systems, ecs_system_t*);
+    int32_t i, last = op->offset + op->count - 1;
+
+    if (stage_index == 0) {
+        for (i = pq->cur_i; i <= last; i ++) {
+            systems[i]->last_frame = world->info.frame_count_total + 1;
+        }
+    }
+
+    /* Claim systems until all systems in the op have ran. Systems in a
+     * concurrent op don't access the same components, so each system can run
+     * on a different thread. */
+    while ((i = ecs_os_ainc(&pq->next_system) - 1) < op->count) {
+        ecs_system_t *sys = systems[op->offset + i];
+        flecs_run_system(world, stage, sys->query->entity, sys, 0, 1, 
+            delta_time, NULL);
+        ecs_os_linc(&world->info.systems_ran_frame);
+    }
+
+    return last;
+}
+
 int32_t flecs_run_pipeline_ops(
     ecs_world_t* world,
     ecs_stage_t* stage,
@@ -59042,6 +64509,11 @@ int32_t flecs_run_pipeline_ops(
 
     ecs_assert(!stage_index || op->multi_threaded, ECS_INTERNAL_ERROR, NULL);
 
+    if (op->concurrent) {
+        return flecs_run_pipeline_concurrent_ops(
+            world, stage, stage_index, delta_time);
+    }
+
     int32_t count = ecs_vec_count(&pq->systems);
     ecs_system_t **systems = ecs_vec_first_t(&pq->systems, ecs_system_t*);
     int32_t ran_since_merge = i - op->offset;
@@ -59092,6 +64564,7 @@ void flecs_run_pipeline(
     int32_t stage_index = ecs_stage_get_id(stage->thread_ctx);
     int32_t stage_count = ecs_get_stage_count(world);
     bool multi_threaded = world->worker_cond != 0;
+    bool use_parallel_for = flecs_workers_use_parallel_for(world);
 
     ecs_assert(!stage_index, ECS_INVALID_OPERATION, 
         "cannot run pipeline on stage");
@@ -59102,6 +64575,9 @@ void flecs_run_pipeline(
     // Update the pipeline before waking the workers.
     flecs_pipeline_update(world, pq, true);
 
+    // Ops that aren't followed by a merge keep the world in readonly mode
+    bool readonly = false;
+
     // If there are no operations to execute in the pipeline bail early,
     // no need to wake the workers since they have nothing to do.
     while (pq->cur_op != NULL) {
@@ -59110,21 +64586,34 @@ void flecs_run_pipeline(
             continue;
         }
 
-        bool immediate = pq->cur_op->immediate;
-        bool op_multi_threaded = multi_threaded && pq->cur_op->multi_threaded;
+        ecs_pipeline_op_t *op = pq->cur_op;
+        bool immediate = op->immediate;
+        bool op_multi_threaded = multi_threaded && op->multi_threaded;
 
         pq->immediate = immediate;
 
         if (!immediate) {
-            ecs_readonly_begin(world, multi_threaded);
+            if (!readonly) {
+                ecs_readonly_begin(world, multi_threaded);
+                readonly = true;
+            }
         } else {
+            ecs_assert(!readonly, ECS_INTERNAL_ERROR, NULL);
             flecs_defer_begin(world, stage);
         }
 
         ECS_BIT_COND(world->flags, EcsWorldMultiThreaded, op_multi_threaded);
         ecs_assert(world->workers_waiting == 0, ECS_INTERNAL_ERROR, NULL);
 
-        if (op_multi_threaded) {
+        if (op->concurrent) {
+            pq->next_system = pq->cur_i - op->offset;
+        }
+
+        /* With parallel_for the OS API runs the ops on all stages and
+         * returns when they're done, so there is no need to signal workers. */
+        bool signal_workers = op_multi_threaded && !use_parallel_for;
+
+        if (signal_workers) {
             flecs_signal_workers(world);
         }
 
@@ -59134,33 +64623,42 @@ void flecs_run_pipeline(
             ecs_time_measure(&st);
         }
 
-        const int32_t i = flecs_run_pipeline_ops(
-            world, stage, stage_index, stage_count, delta_time);
+        int32_t i;
+        if (op_multi_threaded && use_parallel_for) {
+            i = flecs_workers_run_pipeline_ops(world, delta_time);
+        } else {
+            i = flecs_run_pipeline_ops(
+                world, stage, stage_index, stage_count, delta_time);
+        }
 
         if (measure_time) {
             /* Don't include merge time in system time */
             world->info.system_time_total += (ecs_ftime_t)ecs_time_measure(&st);
         }
 
-        if (op_multi_threaded) {
+        if (signal_workers) {
             flecs_wait_for_sync(world);
         }
 
         if (!immediate) {
-            ecs_time_t mt = { 0 };
-            if (measure_time) {
-                ecs_time_measure(&mt);
-            }
+            if (!op->no_merge) {
+                ecs_time_t mt = { 0 };
+                if (measure_time) {
+                    ecs_time_measure(&mt);
+                }
 
-            int32_t si;
-            for (si = 0; si < stage_count; si ++) {
-                ecs_stage_t *s = world->stages[si];
-                pq->cur_op->commands_enqueued += ecs_vec_count(&s->cmd->queue);
-            }
+                int32_t si;
+                for (si = 0; si < stage_count; si ++) {
+                    ecs_stage_t *s = world->stages[si];
+                    op->commands_enqueued += ecs_vec_count(&s->cmd->queue);
+                }
+
+                ecs_readonly_end(world);
+                readonly = false;
 
-            ecs_readonly_end(world);
-            if (measure_time) {
-                pq->cur_op->time_spent += ecs_time_measure(&mt);
+                if (measure_time) {
+                    op->time_spent += ecs_time_measure(&mt);
+                }
             }
         } else {
             flecs_defer_end(world, stage);
@@ -59170,8 +64668,15 @@ void flecs_run_pipeline(
          * threads, to avoid race conditions. */
         pq->cur_i = i;
 
-        flecs_pipeline_update(world, pq, false);
+        if (readonly) {
+            /* Nothing was merged, so the schedule can't have changed */
+            flecs_pipeline_next_system(pq);
+        } else {
+            flecs_pipeline_update(world, pq, false);
+        }
     }
+
+    ecs_assert(!readonly, ECS_INTERNAL_ERROR, NULL);
 }
 
 static
@@ -59336,6 +64841,7 @@ ecs_entity_t ecs_pipeline_init(
     ecs_pipeline_state_t *pq = ecs_os_calloc_t(ecs_pipeline_state_t);
     pq->query = query;
     pq->match_count = -1;
+    pq->concurrent = desc->concurrent;
     pq->cr_inactive = flecs_components_ensure(world, EcsEmpty);
     ecs_set(world, result, EcsPipeline, { pq });
 
@@ -59471,6 +64977,39 @@ void flecs_sync_worker(
     ecs_os_mutex_unlock(world->sync_mutex);
 }
 
+/* Run job on stage */
+static
+void flecs_run_worker_job(
+    ecs_world_t *world,
+    ecs_stage_t *stage,
+    int32_t stage_index,
+    int32_t stage_count)
+{
+    ecs_worker_job_t *job = world->job;
+    ecs_assert(job != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    if (job->action) {
+        job->action(job->ctx, stage_index);
+        return;
+    }
+
+    ecs_iter_action_t callback = job->callback;
+    ecs_iter_t wit, qit = ecs_query_iter(stage->thread_ctx, job->query);
+    ecs_iter_t *it = &qit;
+
+    qit.callback = callback;
+    qit.ctx = job->ctx;
+
+    if (stage_count > 1) {
+        wit = ecs_worker_iter(it, stage_index, stage_count);
+        it = &wit;
+    }
+
+    while (ecs_iter_next(it)) {
+        callback(it);
+    }
+}
+
 /* Worker thread */
 static
 void* flecs_worker(void *arg) {
@@ -59497,8 +65036,12 @@ void* flecs_worker(void *arg) {
         ecs_entity_t old_scope = ecs_set_scope((ecs_world_t*)stage, 0);
 
         ecs_dbg_3("worker %d: run", stage->id);
-        flecs_run_pipeline_ops(world, stage, stage->id, world->stage_count, 
-            world->info.delta_time);
+        if (world->job) {
+            flecs_run_worker_job(world, stage, stage->id, world->stage_count);
+        } else {
+            flecs_run_pipeline_ops(world, stage, stage->id, 
+                world->stage_count, world->info.delta_time);
+        }
 
         ecs_set_scope((ecs_world_t*)stage, old_scope);
 
@@ -59516,6 +65059,82 @@ void* flecs_worker(void *arg) {
     return NULL;
 }
 
+/* Context for running pipeline ops with the OS API parallel_for */
+typedef struct ecs_worker_ops_ctx_t {
+    ecs_world_t *world;
+    ecs_ftime_t delta_time;
+    int32_t result;
+} ecs_worker_ops_ctx_t;
+
+/* Run pipeline ops for a single stage with parallel_for */
+static
+void flecs_worker_ops_job(
+    void *ptr,
+    int32_t stage_index)
+{
+    ecs_worker_ops_ctx_t *ctx = ptr;
+    ecs_world_t *world = ctx->world;
+    ecs_stage_t *stage = world->stages[stage_index];
+
+    if (!stage_index) {
+        ctx->result = flecs_run_pipeline_ops(world, stage, 0, 
+            world->stage_count, ctx->delta_time);
+        return;
+    }
+
+    ecs_entity_t old_scope = ecs_set_scope((ecs_world_t*)stage, 0);
+    flecs_run_pipeline_ops(world, stage, stage_index, world->stage_count, 
+        ctx->delta_time);
+    ecs_set_scope((ecs_world_t*)stage, old_scope);
+}
+
+/* Run query job for a single stage with parallel_for */
+static
+void flecs_worker_query_job(
+    void *ptr,
+    int32_t stage_index)
+{
+    ecs_world_t *world = ptr;
+    flecs_run_worker_job(world, world->stages[stage_index], stage_index, 
+        world->stage_count);
+}
+
+bool flecs_workers_use_parallel_for(
+    const ecs_world_t *world)
+{
+    if (!world->workers_use_task_api || !ecs_os_has_parallel_for()) {
+        return false;
+    }
+
+#ifdef FLECS_OS_API_IMPL
+    /* The builtin parallel_for creates tasks for each call if the application
+     * provides its own task API. Workers that are created once per frame are
+     * cheaper in that case, as each frame can run many multithreaded ops. */
+    if (flecs_os_pool_uses_tasks()) {
+        return false;
+    }
+#endif
+
+    return true;
+}
+
+int32_t flecs_workers_run_pipeline_ops(
+    ecs_world_t *world,
+    ecs_ftime_t delta_time)
+{
+    ecs_assert(flecs_workers_use_parallel_for(world), 
+        ECS_INTERNAL_ERROR, NULL);
+
+    ecs_worker_ops_ctx_t ctx = {
+        .world = world,
+        .delta_time = delta_time
+    };
+
+    ecs_os_parallel_for(flecs_worker_ops_job, &ctx, world->stage_count);
+
+    return ctx.result;
+}
+
 /* Start threads */
 void flecs_create_worker_threads(
     ecs_world_t *world)
@@ -59523,6 +65142,11 @@ void flecs_create_worker_threads(
     flecs_poly_assert(world, ecs_world_t);
     int32_t stages = ecs_get_stage_count(world);
 
+    if (flecs_workers_use_parallel_for(world)) {
+        /* Workers run on the threads of the OS API parallel_for */
+        return;
+    }
+
     for (int32_t i = 1; i < stages; i ++) {
         ecs_stage_t *stage = (ecs_stage_t*)ecs_get_stage(world, i);
         ecs_assert(stage != NULL, ECS_INTERNAL_ERROR, NULL);
@@ -59564,7 +65188,7 @@ void flecs_wait_for_workers(
     flecs_poly_assert(world, ecs_world_t);
 
     int32_t stage_count = ecs_get_stage_count(world);
-    if (stage_count <= 1) {
+    if (stage_count <= 1 || flecs_workers_use_parallel_for(world)) {
         return;
     }
 
@@ -59690,7 +65314,7 @@ void flecs_set_threads_internal(
     bool use_task_api)
 {
     ecs_assert(threads <= 1 || (use_task_api 
-        ? ecs_os_has_task_support() 
+        ? (ecs_os_has_task_support() || ecs_os_has_parallel_for())
         : ecs_os_has_threading()), 
             ECS_MISSING_OS_API, NULL);
 
@@ -59748,6 +65372,103 @@ bool ecs_using_task_threads(
     return world->workers_use_task_api;
 }
 
+/* Run job on all stages, and merge enqueued commands after all stages are done */
+static
+void flecs_workers_run_job(
+    ecs_world_t *world,
+    ecs_worker_job_t *job)
+{
+    /* Make sure query caches are up to date before locking the world */
+    ecs_run_aperiodic(world, 0);
+
+    bool use_tasks = ecs_using_task_threads(world);
+    if (use_tasks) {
+        flecs_create_worker_threads(world);
+    }
+
+    flecs_wait_for_workers(world);
+
+    int32_t stage_count = ecs_get_stage_count(world);
+    bool multi_threaded = world->worker_cond != 0;
+
+    world->job = job;
+
+    /* Each stage gets its own command queue, so callbacks can enqueue
+     * operations without synchronization. */
+    ecs_readonly_begin(world, multi_threaded);
+
+    if (multi_threaded && flecs_workers_use_parallel_for(world)) {
+        ecs_os_parallel_for(flecs_worker_query_job, world, stage_count);
+    } else {
+        if (multi_threaded) {
+            flecs_signal_workers(world);
+        }
+
+        flecs_run_worker_job(world, world->stages[0], 0, stage_count);
+
+        if (multi_threaded) {
+            flecs_wait_for_sync(world);
+        }
+    }
+
+    world->job = NULL;
+
+    /* Merge commands enqueued by all stages */
+    ecs_readonly_end(world);
+
+    if (use_tasks) {
+        flecs_join_worker_threads(world);
+    }
+}
+
+void flecs_workers_run(
+    ecs_world_t *world,
+    ecs_os_parallel_job_t action,
+    void *ctx)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_assert(!(world->flags & EcsWorldReadonly), ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(world->job == NULL, ECS_INTERNAL_ERROR, NULL);
+
+    ecs_worker_job_t job = {
+        .action = action,
+        .ctx = ctx
+    };
+
+    flecs_workers_run_job(world, &job);
+}
+
+void ecs_query_parallel_each(
+    ecs_world_t *world,
+    ecs_query_t *query,
+    ecs_iter_action_t callback,
+    void *ctx)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(query != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(callback != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!(world->flags & EcsWorldReadonly), ECS_INVALID_OPERATION, 
+        "cannot run parallel query while world is in readonly mode");
+    ecs_check(!ecs_is_deferred(world), ECS_INVALID_OPERATION, 
+        "cannot run parallel query while world is deferred");
+    ecs_check(world->job == NULL, ECS_INVALID_OPERATION, 
+        "cannot nest parallel queries");
+
+    ecs_os_perf_trace_push("flecs.query_parallel_each");
+
+    ecs_worker_job_t job = {
+        .query = query,
+        .callback = callback,
+        .ctx = ctx
+    };
+
+    flecs_workers_run_job(world, &job);
+
+    ecs_os_perf_trace_pop("flecs.query_parallel_each");
+error:
+    return;
+}
+
 #endif
 
 /**
@@ -67778,6 +73499,15 @@ error:
 #define FLECS_STATS_PRIVATE_H
 
 
+#define ECS_METRIC_FIRST(stats)\
+    ECS_CAST(ecs_metric_t*, ECS_OFFSET(&stats->first_, ECS_SIZEOF(int64_t)))
+
+#define ECS_METRIC_LAST(stats)\
+    ECS_CAST(ecs_metric_t*, ECS_OFFSET(&stats->last_, -ECS_SIZEOF(ecs_metric_t)))
+
+/* Default number of samples stored by compact statistics */
+#define FLECS_STATS_COMPACT_WINDOW (60)
+
 typedef struct {
     /* Statistics API interface */
     void (*copy_last)(void *stats, void *src);
@@ -67788,6 +73518,9 @@ typedef struct {
     void (*set_t)(void *stats, int32_t t);
     void (*fini)(void *stats);
 
+    /* Get pointers to metrics stored by compact statistics (optional) */
+    void (*metrics)(void *stats, ecs_metric_t **out);
+
     /* Size of statistics type */
     ecs_size_t stats_size;
 
@@ -67796,12 +73529,24 @@ typedef struct {
 
     /* Id of component used to query for monitored resources (optional) */
     ecs_id_t query_component_id;
+
+    /* Number of metrics returned by metrics callback */
+    int32_t metric_count;
 } ecs_stats_api_t;
 
 void flecs_stats_api_import(
     ecs_world_t *world,
     ecs_stats_api_t *api);
 
+/* Add time spent collecting statistics to world summary */
+void flecs_stats_overhead_add(
+    ecs_world_t *world,
+    ecs_time_t *start);
+
+/* Get memory used by statistics */
+int64_t flecs_stats_memory(
+    ecs_world_t *world);
+
 void FlecsWorldSummaryImport(
     ecs_world_t *world);
 
@@ -67820,6 +73565,8 @@ void FlecsPipelineMonitorImport(
 #ifdef FLECS_STATS
 
 ECS_COMPONENT_DECLARE(FlecsStats);
+ECS_COMPONENT_DECLARE(EcsStatsSettings);
+ECS_COMPONENT_DECLARE(EcsCompactStats);
 
 ecs_entity_t EcsPeriod1s = 0;
 ecs_entity_t EcsPeriod1m = 0;
@@ -67835,6 +73582,13 @@ typedef struct {
     ecs_query_t *query;
 } ecs_monitor_stats_ctx_t;
 
+typedef struct {
+    ecs_stats_api_t api;
+    ecs_query_t *query;
+    void *stats;                /* Scratch statistics, reused each frame */
+    ecs_metric_t **metrics;     /* Metrics of scratch statistics */
+} ecs_compact_stats_ctx_t;
+
 typedef struct {
     ecs_stats_api_t api;
 } ecs_reduce_stats_ctx_t;
@@ -67844,15 +73598,45 @@ typedef struct {
     int32_t interval;
 } ecs_aggregate_stats_ctx_t;
 
+void flecs_stats_overhead_add(
+    ecs_world_t *world,
+    ecs_time_t *start)
+{
+    if (!ecs_os_has_time()) {
+        return;
+    }
+
+    EcsWorldSummary *summary = ecs_get_mut(world, EcsWorld, EcsWorldSummary);
+    if (summary) {
+        double t = ecs_time_measure(start);
+        summary->stats_time_total += t;
+        summary->stats_time_last += t;
+    }
+}
+
+static
+void flecs_stats_overhead_start(
+    ecs_time_t *start)
+{
+    if (ecs_os_has_time()) {
+        ecs_os_get_time(start);
+    }
+}
+
 static
 void MonitorStats(ecs_iter_t *it) {
     ecs_world_t *world = it->real_world;
     ecs_monitor_stats_ctx_t *ctx = it->ctx;
 
+    ecs_time_t start;
+    flecs_stats_overhead_start(&start);
+
     EcsStatsHeader *hdr = ecs_field_w_size(it, ecs_field_size(it, 0), 0);
 
+    /* Use time elapsed since last run, which can be more than one frame when
+     * the sample interval is larger than 1 */
     ecs_ftime_t elapsed = hdr->elapsed;
-    hdr->elapsed += it->delta_time;
+    hdr->elapsed += it->delta_system_time;
 
     int32_t t_last = (int32_t)(elapsed * 60);
     int32_t t_next = (int32_t)(hdr->elapsed * 60);
@@ -67930,15 +73714,20 @@ void MonitorStats(ecs_iter_t *it) {
         }
     } while (true);
 
-     if (dif > 1) {
+    if (dif > 1) {
         hdr->reduce_count = 0;
     }
+
+    flecs_stats_overhead_add(world, &start);
 }
 
 static
 void ReduceStats(ecs_iter_t *it) {
     ecs_reduce_stats_ctx_t *ctx = it->ctx;
 
+    ecs_time_t start;
+    flecs_stats_overhead_start(&start);
+
     void *dst = ecs_field_w_size(it, ecs_field_size(it, 0), 0);
     void *src = ecs_field_w_size(it, ecs_field_size(it, 1), 1);
 
@@ -67956,6 +73745,8 @@ void ReduceStats(ecs_iter_t *it) {
             ctx->api.reduce(dst_el, src_el);
         }
     }
+
+    flecs_stats_overhead_add(it->real_world, &start);
 }
 
 static
@@ -67963,6 +73754,9 @@ void AggregateStats(ecs_iter_t *it) {
     ecs_aggregate_stats_ctx_t *ctx = it->ctx;
     int32_t interval = ctx->interval;
 
+    ecs_time_t start;
+    flecs_stats_overhead_start(&start);
+
     EcsStatsHeader *dst_hdr = ecs_field_w_size(it, ecs_field_size(it, 0), 0);
     EcsStatsHeader *src_hdr = ecs_field_w_size(it, ecs_field_size(it, 1), 1);
 
@@ -68024,6 +73818,131 @@ void AggregateStats(ecs_iter_t *it) {
     if (dst_hdr->reduce_count >= interval) {
         dst_hdr->reduce_count = 0;
     }
+
+    flecs_stats_overhead_add(it->real_world, &start);
+}
+
+static
+ecs_size_t flecs_compact_stats_size(
+    int32_t metric_count,
+    int32_t window)
+{
+    return ECS_SIZEOF(ecs_compact_stats_t) + 
+        metric_count * ECS_SIZEOF(double) + 
+        window * metric_count * ECS_SIZEOF(ecs_float_t);
+}
+
+static
+ecs_compact_stats_t* flecs_compact_stats_ensure(
+    ecs_map_t *map,
+    ecs_entity_t key,
+    int32_t metric_count,
+    int32_t window)
+{
+    ecs_map_val_t *val = ecs_map_ensure(map, key);
+    ecs_compact_stats_t *result = (ecs_compact_stats_t*)(uintptr_t)*val;
+    if (result && result->window == window) {
+        return result;
+    }
+
+    /* Window size changed, which discards existing samples */
+    ecs_os_free(result);
+
+    /* Store metrics and samples in the same allocation */
+    result = ecs_os_calloc(flecs_compact_stats_size(metric_count, window));
+    result->metric_count = metric_count;
+    result->window = window;
+    result->t = window - 1;
+    result->values = ECS_OFFSET_T(result, ecs_compact_stats_t);
+    result->samples = ECS_OFFSET(result->values, 
+        metric_count * ECS_SIZEOF(double));
+    *val = (ecs_map_val_t)(uintptr_t)result;
+    return result;
+}
+
+static
+void flecs_compact_stats_record(
+    ecs_world_t *world,
+    const ecs_stats_api_t *api,
+    ecs_compact_stats_t *dst,
+    ecs_entity_t res,
+    void *stats,
+    ecs_metric_t **metrics)
+{
+    int32_t m, count = dst->metric_count;
+
+    /* Reuse scratch statistics for all resources. The get callback records
+     * into the position after t, and computes counter deltas from the value
+     * at t, so restore the last value of each counter. */
+    api->set_t(stats, 0);
+    for (m = 0; m < count; m ++) {
+        ecs_metric_t *metric = metrics[m];
+        metric->counter.value[0] = dst->values[m];
+        metric->counter.value[1] = 0;
+        metric->gauge.avg[1] = 0;
+    }
+
+    api->get(world, res, stats);
+
+    int32_t t = dst->t = (dst->t + 1) % dst->window;
+    ecs_float_t *sample = &dst->samples[t * count];
+    for (m = 0; m < count; m ++) {
+        ecs_metric_t *metric = metrics[m];
+        double value = metric->counter.value[1];
+        if (!dst->count && ECS_NEQZERO(value)) {
+            /* Counter doesn't have a previous value yet */
+            sample[m] = 0;
+        } else {
+            sample[m] = metric->gauge.avg[1];
+        }
+        dst->values[m] = value;
+    }
+
+    if (dst->count < dst->window) {
+        dst->count ++;
+    }
+}
+
+static
+void CompactStats(ecs_iter_t *it) {
+    ecs_world_t *world = it->real_world;
+    ecs_compact_stats_ctx_t *ctx = it->ctx;
+
+    ecs_time_t start;
+    flecs_stats_overhead_start(&start);
+
+    EcsCompactStats *compact = ecs_field(it, EcsCompactStats, 0);
+    const EcsStatsSettings *settings = ecs_singleton_get(
+        world, EcsStatsSettings);
+    int32_t window = FLECS_STATS_COMPACT_WINDOW;
+    if (settings && settings->compact_window > 0) {
+        window = settings->compact_window;
+    }
+
+    int32_t metric_count = ctx->api.metric_count;
+    void *stats = ctx->stats;
+    ecs_metric_t **metrics = ctx->metrics;
+
+    if (ctx->query) {
+        ecs_iter_t qit = ecs_query_iter(it->world, ctx->query);
+        while (ecs_query_next(&qit)) {
+            int32_t i;
+            for (i = 0; i < qit.count; i ++) {
+                ecs_entity_t res = qit.entities[i];
+                ecs_compact_stats_t *dst = flecs_compact_stats_ensure(
+                    &compact->stats, res, metric_count, window);
+                flecs_compact_stats_record(
+                    world, &ctx->api, dst, res, stats, metrics);
+            }
+        }
+    } else {
+        ecs_compact_stats_t *dst = flecs_compact_stats_ensure(
+            &compact->stats, EcsWorld, metric_count, window);
+        flecs_compact_stats_record(
+            world, &ctx->api, dst, 0, stats, metrics);
+    }
+
+    flecs_stats_overhead_add(world, &start);
 }
 
 static
@@ -68037,6 +73956,19 @@ void flecs_monitor_ctx_free(
     ecs_os_free(ctx);
 }
 
+static
+void flecs_compact_ctx_free(
+    void *ptr)
+{
+    ecs_compact_stats_ctx_t *ctx = ptr;
+    if (ctx->query) {
+        ecs_query_fini(ctx->query);
+    }
+    ecs_os_free(ctx->metrics);
+    ecs_os_free(ctx->stats);
+    ecs_os_free(ctx);
+}
+
 static
 void flecs_reduce_ctx_free(
     void *ptr)
@@ -68058,13 +73990,21 @@ void flecs_stats_api_import(
     ecs_entity_t kind = api->monitor_component_id;
     ecs_entity_t prev = ecs_set_scope(world, kind);
 
-    ecs_query_t *q = NULL;
+    ecs_query_t *q = NULL, *compact_q = NULL;
     if (api->query_component_id) {
         q = ecs_query(world, {
             .terms = {{ .id = api->query_component_id }},
             .cache_kind = EcsQueryCacheNone,
             .flags = EcsQueryMatchDisabled
         });
+
+        if (api->metrics) {
+            compact_q = ecs_query(world, {
+                .terms = {{ .id = api->query_component_id }},
+                .cache_kind = EcsQueryCacheNone,
+                .flags = EcsQueryMatchDisabled
+            });
+        }
     }
 
     // Called each frame, collects 60 measurements per second
@@ -68175,6 +74115,27 @@ void flecs_stats_api_import(
         });
     }
 
+    // Called each frame when compact statistics are enabled
+    if (api->metrics) {
+        ecs_compact_stats_ctx_t *ctx = ecs_os_calloc_t(ecs_compact_stats_ctx_t);
+        ctx->api = *api;
+        ctx->query = compact_q;
+        ctx->stats = ecs_os_calloc(api->stats_size);
+        ctx->metrics = ecs_os_calloc_n(ecs_metric_t*, api->metric_count);
+        api->metrics(ctx->stats, ctx->metrics);
+
+        ecs_system(world, {
+            .entity = ecs_entity(world, { .name = "MonitorCompact", .add = ecs_ids(ecs_dependson(EcsPreFrame)) }),
+            .query.terms = {{
+                .id = ecs_pair(ecs_id(EcsCompactStats), kind),
+                .src.id = EcsWorld 
+            }},
+            .callback = CompactStats,
+            .ctx = ctx,
+            .ctx_free = flecs_compact_ctx_free
+        });
+    }
+
     ecs_set_scope(world, prev);
 
     ecs_add_pair(world, EcsWorld, kind, EcsPeriod1s);
@@ -68184,6 +74145,165 @@ void flecs_stats_api_import(
     ecs_add_pair(world, EcsWorld, kind, EcsPeriod1w);
 }
 
+static
+void flecs_compact_stats_dtor(
+    EcsCompactStats *ptr)
+{
+    ecs_map_iter_t it = ecs_map_iter(&ptr->stats);
+    while (ecs_map_next(&it)) {
+        ecs_os_free(ecs_map_ptr(&it));
+    }
+    ecs_map_fini(&ptr->stats);
+}
+
+static ECS_CTOR(EcsCompactStats, ptr, {
+    ecs_os_zeromem(ptr);
+    ecs_map_init(&ptr->stats, NULL);
+})
+
+static ECS_COPY(EcsCompactStats, dst, src, {
+    (void)dst;
+    (void)src;
+    ecs_abort(ECS_INVALID_OPERATION, "cannot copy compact stats component");
+})
+
+static ECS_MOVE(EcsCompactStats, dst, src, {
+    flecs_compact_stats_dtor(dst);
+    ecs_os_memcpy_t(dst, src, EcsCompactStats);
+    ecs_os_zeromem(src);
+})
+
+static ECS_DTOR(EcsCompactStats, ptr, {
+    flecs_compact_stats_dtor(ptr);
+})
+
+static
+int64_t flecs_compact_stats_memory(
+    const ecs_world_t *world,
+    ecs_entity_t kind)
+{
+    const EcsCompactStats *ptr = ecs_get_pair(
+        world, EcsWorld, EcsCompactStats, kind);
+    if (!ptr) {
+        return 0;
+    }
+
+    int64_t result = ECS_SIZEOF(EcsCompactStats);
+    ecs_map_iter_t it = ecs_map_iter(&ptr->stats);
+    while (ecs_map_next(&it)) {
+        ecs_compact_stats_t *stats = ecs_map_ptr(&it);
+        result += flecs_compact_stats_size(stats->metric_count, stats->window);
+    }
+
+    return result;
+}
+
+int64_t flecs_stats_memory(
+    ecs_world_t *world)
+{
+    ecs_entity_t periods[] = {
+        EcsPeriod1s, EcsPeriod1m, EcsPeriod1h, EcsPeriod1d, EcsPeriod1w };
+    int64_t result = 0;
+    int32_t p;
+
+    for (p = 0; p < 5; p ++) {
+        ecs_entity_t period = periods[p];
+        if (ecs_has_pair(world, EcsWorld, ecs_id(EcsWorldStats), period)) {
+            result += ECS_SIZEOF(EcsWorldStats);
+        }
+
+        const EcsSystemStats *ss = ecs_get_pair(
+            world, EcsWorld, EcsSystemStats, period);
+        if (ss) {
+            result += ECS_SIZEOF(EcsSystemStats) + 
+                ecs_map_count(&ss->stats) * ECS_SIZEOF(ecs_system_stats_t);
+        }
+
+        const EcsPipelineStats *ps = ecs_get_pair(
+            world, EcsWorld, EcsPipelineStats, period);
+        if (ps) {
+            result += ECS_SIZEOF(EcsPipelineStats);
+            ecs_map_iter_t it = ecs_map_iter(&ps->stats);
+            while (ecs_map_next(&it)) {
+                ecs_pipeline_stats_t *stats = ecs_map_ptr(&it);
+                result += ECS_SIZEOF(ecs_pipeline_stats_t) +
+                    ecs_vec_size(&stats->systems) * ECS_SIZEOF(ecs_entity_t) +
+                    ecs_vec_size(&stats->sync_points) * 
+                        ECS_SIZEOF(ecs_sync_stats_t);
+            }
+        }
+    }
+
+    result += flecs_compact_stats_memory(world, ecs_id(EcsWorldStats));
+    result += flecs_compact_stats_memory(world, ecs_id(EcsSystemStats));
+
+    return result;
+}
+
+static
+void flecs_stats_set_sample_interval(
+    ecs_world_t *world,
+    ecs_entity_t system,
+    int32_t interval)
+{
+    /* Only add rate filter when needed, so that systems by default don't
+     * depend on a tick source. */
+    if (system && ((interval > 1) || ecs_has(world, system, EcsRateFilter))) {
+        ecs_set_rate(world, system, interval, 0);
+    }
+}
+
+static
+void flecs_stats_apply_settings(
+    ecs_world_t *world,
+    const EcsStatsSettings *settings,
+    ecs_entity_t kind)
+{
+    ecs_entity_t periods[] = {
+        EcsPeriod1s, EcsPeriod1m, EcsPeriod1h, EcsPeriod1d, EcsPeriod1w };
+    int32_t interval = settings->sample_interval;
+    if (interval < 1) {
+        interval = 1;
+    }
+
+    ecs_entity_t monitor = ecs_lookup_child(world, kind, "Monitor1s");
+    ecs_entity_t compact = ecs_lookup_child(world, kind, "MonitorCompact");
+    flecs_stats_set_sample_interval(world, monitor, interval);
+    flecs_stats_set_sample_interval(world, compact, interval);
+
+    /* Removing the history tiers frees their memory and prevents the systems
+     * that collect and reduce them from running. */
+    int32_t p;
+    if (settings->compact) {
+        for (p = 0; p < 5; p ++) {
+            ecs_remove_pair(world, EcsWorld, kind, periods[p]);
+        }
+        if (compact) {
+            ecs_add_pair(world, EcsWorld, ecs_id(EcsCompactStats), kind);
+        }
+    } else {
+        ecs_remove_pair(world, EcsWorld, ecs_id(EcsCompactStats), kind);
+        for (p = 0; p < 5; p ++) {
+            ecs_add_pair(world, EcsWorld, kind, periods[p]);
+        }
+    }
+}
+
+static
+void OnSetStatsSettings(ecs_iter_t *it) {
+    EcsStatsSettings *settings = ecs_field(it, EcsStatsSettings, 0);
+
+    int32_t i, count = it->count;
+    for (i = 0; i < count; i ++) {
+        flecs_stats_apply_settings(it->world, &settings[i], 
+            ecs_id(EcsWorldStats));
+        flecs_stats_apply_settings(it->world, &settings[i], 
+            ecs_id(EcsSystemStats));
+        flecs_stats_apply_settings(it->world, &settings[i], 
+            ecs_id(EcsPipelineStats));
+    }
+}
+
 void FlecsStatsImport(
     ecs_world_t *world)
 {
@@ -68210,10 +74330,43 @@ void FlecsStatsImport(
     EcsPeriod1d = ecs_entity(world, { .name = "EcsPeriod1d" });
     EcsPeriod1w = ecs_entity(world, { .name = "EcsPeriod1w" });
 
+    ECS_COMPONENT_DEFINE(world, EcsStatsSettings);
+    ECS_COMPONENT_DEFINE(world, EcsCompactStats);
+
+    ecs_set_hooks(world, EcsCompactStats, {
+        .ctor = ecs_ctor(EcsCompactStats),
+        .copy = ecs_copy(EcsCompactStats),
+        .move = ecs_move(EcsCompactStats),
+        .dtor = ecs_dtor(EcsCompactStats)
+    });
+
+#ifdef FLECS_META
+    ecs_struct(world, {
+        .entity = ecs_id(EcsStatsSettings),
+        .members = {
+            { .name = "sample_interval", .type = ecs_id(ecs_i32_t) },
+            { .name = "compact", .type = ecs_id(ecs_bool_t) },
+            { .name = "compact_window", .type = ecs_id(ecs_i32_t) }
+        }
+    });
+#endif
+
     FlecsWorldSummaryImport(world);
     FlecsWorldMonitorImport(world);
     FlecsSystemMonitorImport(world);
     FlecsPipelineMonitorImport(world);
+
+    ecs_observer(world, {
+        .entity = ecs_entity(world, { .name = "OnSetStatsSettings" }),
+        .events = { EcsOnSet },
+        .query.terms = {{ .id = ecs_id(EcsStatsSettings) }},
+        .callback = OnSetStatsSettings
+    });
+
+    ecs_singleton_set(world, EcsStatsSettings, {
+        .sample_interval = 1,
+        .compact_window = FLECS_STATS_COMPACT_WINDOW
+    });
     
     if (ecs_os_has_time()) {
         ecs_measure_frame_time(world, true);
@@ -68353,6 +74506,294 @@ void FlecsPipelineMonitorImport(
 
 #endif
 
+/**
+ * @file addons/stats/profiler.c
+ * @brief Ring buffer profiler that records zones from perf trace hooks.
+ *
+ * The profiler installs the perf_trace_push_ and perf_trace_pop_ callbacks of
+ * the OS API, and records a timestamped event for each callback in a fixed
+ * size ring buffer. Threads claim slots with an atomic increment, so recording
+ * doesn't require locks. When the buffer is full the oldest events are
+ * overwritten, which keeps the memory footprint constant.
+ */
+
+
+#ifdef FLECS_STATS
+
+/* Default number of events in the ring buffer */
+#define FLECS_PROFILER_DEFAULT_CAPACITY (16 * 1024)
+
+/* Zone names longer than this are truncated */
+#define FLECS_PROFILER_NAME_SIZE (39)
+
+typedef struct flecs_profiler_event_t {
+    uint64_t index;                 /* Index of event, written last */
+    uint64_t time;                  /* Timestamp (ns) */
+    ecs_os_thread_id_t thread;      /* Thread that recorded the event */
+    char name[FLECS_PROFILER_NAME_SIZE];
+    char phase;                     /* 'B' for zone begin, 'E' for zone end */
+} flecs_profiler_event_t;
+
+typedef struct flecs_profiler_t {
+    flecs_profiler_event_t *events;
+    int64_t capacity;               /* Power of two */
+    int64_t head;                   /* Index of next event */
+    int64_t first;                  /* First event not discarded by clear */
+    int32_t recorders;              /* Threads currently recording an event */
+    uint64_t start_time;
+    ecs_os_api_perf_trace_t prev_push;
+    ecs_os_api_perf_trace_t prev_pop;
+} flecs_profiler_t;
+
+static flecs_profiler_t flecs_profiler;
+
+static
+void flecs_profiler_record(
+    const char *name,
+    char phase)
+{
+    flecs_profiler_t *p = &flecs_profiler;
+
+    /* Register as recorder before loading the buffer, so that stop can wait
+     * for threads that still write to the buffer before freeing it. */
+    ecs_os_ainc(&p->recorders);
+    flecs_profiler_event_t *events = p->events;
+    if (!events) {
+        ecs_os_adec(&p->recorders);
+        return;
+    }
+
+    int64_t i = ecs_os_lainc(&p->head) - 1;
+    flecs_profiler_event_t *ev = &events[i & (p->capacity - 1)];
+
+    /* Invalidate slot so it's skipped while it's being written */
+    ev->index = UINT64_MAX;
+    ev->time = ecs_os_now();
+    ev->thread = ecs_os_thread_self();
+    ev->phase = phase;
+
+    int32_t c = 0;
+    if (name) {
+        for (; c < (FLECS_PROFILER_NAME_SIZE - 1) && name[c]; c ++) {
+            ev->name[c] = name[c];
+        }
+    }
+    ev->name[c] = '\0';
+
+    ev->index = (uint64_t)i;
+
+    ecs_os_adec(&p->recorders);
+}
+
+static
+void flecs_profiler_push(
+    const char *file,
+    size_t line,
+    const char *name)
+{
+    flecs_profiler_record(name, 'B');
+    if (flecs_profiler.prev_push) {
+        flecs_profiler.prev_push(file, line, name);
+    }
+}
+
+static
+void flecs_profiler_pop(
+    const char *file,
+    size_t line,
+    const char *name)
+{
+    flecs_profiler_record(name, 'E');
+    if (flecs_profiler.prev_pop) {
+        flecs_profiler.prev_pop(file, line, name);
+    }
+}
+
+void ecs_profiler_start(
+    int32_t capacity)
+{
+    ecs_check(capacity >= 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(flecs_profiler.events == NULL, ECS_INVALID_OPERATION,
+        "profiler is already running");
+
+    if (!capacity) {
+        capacity = FLECS_PROFILER_DEFAULT_CAPACITY;
+    }
+
+    int64_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+
+    flecs_profiler_t *p = &flecs_profiler;
+    p->capacity = size;
+    p->head = 0;
+    p->first = 0;
+    p->start_time = ecs_os_now();
+    p->prev_push = ecs_os_api.perf_trace_push_;
+    p->prev_pop = ecs_os_api.perf_trace_pop_;
+    p->events = ecs_os_calloc_n(flecs_profiler_event_t, (int32_t)size);
+
+    ecs_os_api.perf_trace_push_ = flecs_profiler_push;
+    ecs_os_api.perf_trace_pop_ = flecs_profiler_pop;
+error:
+    return;
+}
+
+void ecs_profiler_stop(void) {
+    flecs_profiler_t *p = &flecs_profiler;
+    if (!p->events) {
+        return;
+    }
+
+    if (ecs_os_api.perf_trace_push_ == flecs_profiler_push) {
+        ecs_os_api.perf_trace_push_ = p->prev_push;
+    }
+    if (ecs_os_api.perf_trace_pop_ == flecs_profiler_pop) {
+        ecs_os_api.perf_trace_pop_ = p->prev_pop;
+    }
+
+    /* Threads that loaded the buffer before it was reset may still be writing
+     * an event, wait for them before freeing the buffer. */
+    flecs_profiler_event_t *events = p->events;
+    p->events = NULL;
+    while (ecs_os_ainc(&p->recorders) != 1) {
+        ecs_os_adec(&p->recorders);
+        ecs_os_sleep(0, 1000);
+    }
+    ecs_os_adec(&p->recorders);
+
+    ecs_os_free(events);
+    ecs_os_zeromem(p);
+}
+
+bool ecs_profiler_is_running(void) {
+    return flecs_profiler.events != NULL;
+}
+
+void ecs_profiler_clear(void) {
+    flecs_profiler.first = flecs_profiler.head;
+}
+
+typedef struct flecs_profiler_thread_t {
+    ecs_os_thread_id_t id;
+    int32_t depth;
+} flecs_profiler_thread_t;
+
+static
+flecs_profiler_thread_t* flecs_profiler_get_thread(
+    ecs_vec_t *threads,
+    ecs_os_thread_id_t id,
+    int32_t *index_out)
+{
+    int32_t i, count = ecs_vec_count(threads);
+    flecs_profiler_thread_t *t = ecs_vec_first(threads);
+    for (i = 0; i < count; i ++) {
+        if (t[i].id == id) {
+            *index_out = i;
+            return &t[i];
+        }
+    }
+
+    flecs_profiler_thread_t *result = ecs_vec_append_t(
+        NULL, threads, flecs_profiler_thread_t);
+    result->id = id;
+    result->depth = 0;
+    *index_out = count;
+    return result;
+}
+
+static
+void flecs_profiler_append_time(
+    ecs_strbuf_t *buf,
+    uint64_t t)
+{
+    /* Chrome trace timestamps are in microseconds */
+    uint64_t ns = t % 1000;
+    ecs_strbuf_appendint(buf, (int64_t)(t / 1000));
+    ecs_strbuf_appendch(buf, '.');
+    ecs_strbuf_appendch(buf, (char)('0' + ns / 100));
+    ecs_strbuf_appendch(buf, (char)('0' + (ns / 10) % 10));
+    ecs_strbuf_appendch(buf, (char)('0' + ns % 10));
+}
+
+char* ecs_profiler_to_chrome_trace(void) {
+    flecs_profiler_t *p = &flecs_profiler;
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    ecs_vec_t threads;
+    ecs_vec_init_t(NULL, &threads, flecs_profiler_thread_t, 0);
+
+    ecs_strbuf_appendlit(&buf, "{\"traceEvents\":");
+    ecs_strbuf_list_push(&buf, "[", ",");
+
+    if (p->events) {
+        int64_t head = p->head;
+        int64_t start = head - p->capacity;
+        if (start < p->first) {
+            start = p->first;
+        }
+        if (start < 0) {
+            start = 0;
+        }
+
+        int64_t i;
+        for (i = start; i < head; i ++) {
+            volatile flecs_profiler_event_t *slot = 
+                &p->events[i & (p->capacity - 1)];
+            if (slot->index != (uint64_t)i) {
+                /* Event is being written or was overwritten */
+                continue;
+            }
+
+            /* Copy the event and check that the slot wasn't reclaimed by a 
+             * writer while copying, in which case the copy may be torn. */
+            flecs_profiler_event_t copy = *slot;
+            if (slot->index != (uint64_t)i) {
+                continue;
+            }
+
+            flecs_profiler_event_t *ev = &copy;
+
+            int32_t tid;
+            flecs_profiler_thread_t *t = flecs_profiler_get_thread(
+                &threads, ev->thread, &tid);
+            if (ev->phase == 'E') {
+                if (!t->depth) {
+                    /* Begin of zone was overwritten */
+                    continue;
+                }
+                t->depth --;
+            } else {
+                t->depth ++;
+            }
+
+            ecs_strbuf_list_next(&buf);
+            ecs_strbuf_appendlit(&buf, "{\"name\":\"");
+            char name[FLECS_PROFILER_NAME_SIZE * 2 + 1];
+            flecs_stresc(name, ECS_SIZEOF(name) - 1, '"', ev->name);
+            name[ECS_SIZEOF(name) - 1] = '\0';
+            ecs_strbuf_appendstr(&buf, name);
+            ecs_strbuf_appendlit(&buf, "\",\"ph\":\"");
+            ecs_strbuf_appendch(&buf, ev->phase);
+            ecs_strbuf_appendlit(&buf, "\",\"ts\":");
+            flecs_profiler_append_time(&buf, ev->time > p->start_time
+                ? ev->time - p->start_time : 0);
+            ecs_strbuf_appendlit(&buf, ",\"pid\":0,\"tid\":");
+            ecs_strbuf_appendint(&buf, tid);
+            ecs_strbuf_appendch(&buf, '}');
+        }
+    }
+
+    ecs_strbuf_list_pop(&buf, "]");
+    ecs_strbuf_appendch(&buf, '}');
+
+    ecs_vec_fini_t(NULL, &threads, flecs_profiler_thread_t);
+
+    return ecs_strbuf_get(&buf);
+}
+
+#endif
+
 /**
  * @file addons/stats.c
  * @brief Stats addon.
@@ -68368,12 +74809,6 @@ void FlecsPipelineMonitorImport(
 #define ECS_COUNTER_RECORD(m, t, value)\
     flecs_counter_record(m, t, (double)(value))
 
-#define ECS_METRIC_FIRST(stats)\
-    ECS_CAST(ecs_metric_t*, ECS_OFFSET(&stats->first_, ECS_SIZEOF(int64_t)))
-
-#define ECS_METRIC_LAST(stats)\
-    ECS_CAST(ecs_metric_t*, ECS_OFFSET(&stats->last_, -ECS_SIZEOF(ecs_metric_t)))
-
 static
 int32_t t_next(
     int32_t t)
@@ -68526,6 +74961,61 @@ error:
     return;
 }
 
+ecs_float_t ecs_compact_stats_sample(
+    const ecs_compact_stats_t *stats,
+    int32_t metric,
+    int32_t age)
+{
+    ecs_check(stats != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(metric >= 0 && metric < stats->metric_count, 
+        ECS_INVALID_PARAMETER, NULL);
+    ecs_check(age >= 0, ECS_INVALID_PARAMETER, NULL);
+
+    if (age >= stats->count) {
+        return 0;
+    }
+
+    int32_t t = (stats->t - age + stats->window) % stats->window;
+    return stats->samples[t * stats->metric_count + metric];
+error:
+    return 0;
+}
+
+ecs_float_t ecs_compact_stats_avg(
+    const ecs_compact_stats_t *stats,
+    int32_t metric)
+{
+    ecs_check(stats != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(metric >= 0 && metric < stats->metric_count, 
+        ECS_INVALID_PARAMETER, NULL);
+
+    if (!stats->count) {
+        return 0;
+    }
+
+    ecs_float_t sum = 0;
+    int32_t i;
+    for (i = 0; i < stats->count; i ++) {
+        sum += stats->samples[i * stats->metric_count + metric];
+    }
+
+    return sum / (ecs_float_t)stats->count;
+error:
+    return 0;
+}
+
+double ecs_compact_stats_value(
+    const ecs_compact_stats_t *stats,
+    int32_t metric)
+{
+    ecs_check(stats != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(metric >= 0 && metric < stats->metric_count, 
+        ECS_INVALID_PARAMETER, NULL);
+    return stats->values[metric];
+error:
+    return 0;
+}
+
 static
 void flecs_stats_reduce(
     ecs_metric_t *dst_cur,
@@ -68623,9 +75113,13 @@ void ecs_world_stats_get(
     } else {
         ECS_GAUGE_RECORD(&s->performance.fps, t, 0);
     }
+    ECS_GAUGE_RECORD(&s->performance.frame_time_p50, t, world->info.frame_time_p50);
+    ECS_GAUGE_RECORD(&s->performance.frame_time_p99, t, world->info.frame_time_p99);
+    ECS_GAUGE_RECORD(&s->performance.frame_time_max, t, world->info.frame_time_max);
 
     ECS_GAUGE_RECORD(&s->entities.count, t, flecs_entities_count(world));
     ECS_GAUGE_RECORD(&s->entities.not_alive_count, t, flecs_entities_not_alive_count(world));
+    ECS_GAUGE_RECORD(&s->entities.delete_queue_count, t, world->info.delete_queue_count);
 
     ECS_GAUGE_RECORD(&s->components.tag_count, t, world->info.tag_id_count);
     ECS_GAUGE_RECORD(&s->components.component_count, t, world->info.component_id_count);
@@ -68639,9 +75133,13 @@ void ecs_world_stats_get(
     if (ecs_is_alive(world, EcsSystem)) {
         ECS_GAUGE_RECORD(&s->queries.system_count, t, ecs_count_id(world, EcsSystem));
     }
+    ECS_GAUGE_RECORD(&s->queries.observer_yield_count, t, world->info.observer_yield_count);
     ECS_COUNTER_RECORD(&s->tables.create_count, t, world->info.table_create_total);
     ECS_COUNTER_RECORD(&s->tables.delete_count, t, world->info.table_delete_total);
     ECS_GAUGE_RECORD(&s->tables.count, t, world->info.table_count);
+    ECS_GAUGE_RECORD(&s->tables.pool_count, t, world->info.table_pool_count);
+    ECS_COUNTER_RECORD(&s->tables.pool_hit_count, t, world->info.table_pool_hit_total);
+    ECS_COUNTER_RECORD(&s->tables.gc_delete_count, t, world->info.table_gc_delete_total);
 
     ECS_COUNTER_RECORD(&s->commands.add_count, t, world->info.cmd.add_count);
     ECS_COUNTER_RECORD(&s->commands.remove_count, t, world->info.cmd.remove_count);
@@ -69068,6 +75566,9 @@ void ecs_world_stats_log(
     ecs_trace("");
     flecs_gauge_print("actual FPS", t, &s->performance.fps);
     flecs_counter_print("frame time", t, &s->performance.frame_time);
+    flecs_gauge_print("frame time p50", t, &s->performance.frame_time_p50);
+    flecs_gauge_print("frame time p99", t, &s->performance.frame_time_p99);
+    flecs_gauge_print("frame time max", t, &s->performance.frame_time_max);
     flecs_counter_print("system time", t, &s->performance.system_time);
     flecs_counter_print("merge time", t, &s->performance.merge_time);
     flecs_counter_print("simulation time elapsed", t, &s->performance.world_time);
@@ -69081,15 +75582,20 @@ void ecs_world_stats_log(
     ecs_trace("");
     flecs_gauge_print("alive entity count", t, &s->entities.count);
     flecs_gauge_print("not alive entity count", t, &s->entities.not_alive_count);
+    flecs_gauge_print("delete queue count", t, &s->entities.delete_queue_count);
     ecs_trace("");
     flecs_gauge_print("query count", t, &s->queries.query_count);
     flecs_gauge_print("observer count", t, &s->queries.observer_count);
     flecs_gauge_print("system count", t, &s->queries.system_count);
+    flecs_gauge_print("observer yield count", t, &s->queries.observer_yield_count);
     ecs_trace("");
     flecs_gauge_print("table count", t, &s->tables.count);
     flecs_gauge_print("empty table count", t, &s->tables.empty_count);
     flecs_counter_print("table create count", t, &s->tables.create_count);
     flecs_counter_print("table delete count", t, &s->tables.delete_count);
+    flecs_gauge_print("table pool count", t, &s->tables.pool_count);
+    flecs_counter_print("table pool hit count", t, &s->tables.pool_hit_count);
+    flecs_counter_print("table gc delete count", t, &s->tables.gc_delete_count);
     ecs_trace("");
     flecs_counter_print("add commands", t, &s->commands.add_count);
     flecs_counter_print("remove commands", t, &s->commands.remove_count);
@@ -69201,6 +75707,24 @@ void flecs_system_stats_repeat_last(
     ecs_system_stats_repeat_last(stats);
 }
 
+static
+void flecs_system_stats_metrics(
+    void *stats,
+    ecs_metric_t **out)
+{
+    ecs_system_stats_t *s = stats;
+    ecs_metric_t *cur = ECS_METRIC_FIRST(s), *last = ECS_METRIC_LAST(s);
+    for (; cur <= last; cur ++) {
+        *(out ++) = cur;
+    }
+
+    cur = ECS_METRIC_FIRST((&s->query));
+    last = ECS_METRIC_LAST((&s->query));
+    for (; cur <= last; cur ++) {
+        *(out ++) = cur;
+    }
+}
+
 void FlecsSystemMonitorImport(
     ecs_world_t *world)
 {
@@ -69220,9 +75744,12 @@ void FlecsSystemMonitorImport(
         .reduce_last = flecs_system_stats_reduce_last,
         .repeat_last = flecs_system_stats_repeat_last,
         .set_t = flecs_system_stats_set_t,
+        .metrics = flecs_system_stats_metrics,
         .stats_size = ECS_SIZEOF(ecs_system_stats_t),
         .monitor_component_id = ecs_id(EcsSystemStats),
-        .query_component_id = EcsSystem
+        .query_component_id = EcsSystem,
+        .metric_count = ECS_STATS_METRIC_INDEX(ecs_system_stats_t, last_) +
+            ECS_STATS_METRIC_INDEX(ecs_query_stats_t, last_)
     };
 
     flecs_stats_api_import(world, &api);
@@ -69289,6 +75816,18 @@ void flecs_world_stats_repeat_last(
     ecs_world_stats_repeat_last(stats);
 }
 
+static
+void flecs_world_stats_metrics(
+    void *stats,
+    ecs_metric_t **out)
+{
+    ecs_world_stats_t *s = stats;
+    ecs_metric_t *cur = ECS_METRIC_FIRST(s), *last = ECS_METRIC_LAST(s);
+    for (; cur <= last; cur ++) {
+        *(out ++) = cur;
+    }
+}
+
 void FlecsWorldMonitorImport(
     ecs_world_t *world) 
 {
@@ -69306,8 +75845,10 @@ void FlecsWorldMonitorImport(
         .repeat_last = flecs_world_stats_repeat_last,
         .set_t = flecs_world_stats_set_t,
         .fini = NULL,
+        .metrics = flecs_world_stats_metrics,
         .stats_size = ECS_SIZEOF(ecs_world_stats_t),
-        .monitor_component_id = ecs_id(EcsWorldStats)
+        .monitor_component_id = ecs_id(EcsWorldStats),
+        .metric_count = ECS_STATS_METRIC_INDEX(ecs_world_stats_t, last_)
     };
 
     flecs_stats_api_import(world, &api);
@@ -69356,6 +75897,17 @@ void flecs_copy_world_summary(
         info->cmd.event_count +
         info->cmd.other_count;
 
+    dst->component_record_count = info->tag_id_count + info->component_id_count;
+    dst->pair_record_count = info->pair_id_count;
+    dst->component_record_memory = info->component_record_memory;
+    if (dst->component_record_count) {
+        dst->component_record_memory_avg = 
+            (double)dst->component_record_memory / 
+            (double)dst->component_record_count;
+    } else {
+        dst->component_record_memory_avg = 0;
+    }
+
     dst->build_info = *ecs_get_build_info();
 }
 
@@ -69366,6 +75918,11 @@ void UpdateWorldSummary(ecs_iter_t *it) {
     int32_t i, count = it->count;
     for (i = 0; i < count; i ++) {
         flecs_copy_world_summary(it->world, &summary[i]);
+
+        /* Runs before the monitor systems, which add the time they spend
+         * collecting statistics in this frame. */
+        summary[i].stats_time_last = 0;
+        summary[i].stats_memory = flecs_stats_memory(it->real_world);
     }
 }
 
@@ -69400,6 +75957,13 @@ void FlecsWorldSummaryImport(
             { .name = "merge_time_last", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds  },
             { .name = "frame_count", .type = ecs_id(ecs_u64_t) },
             { .name = "command_count", .type = ecs_id(ecs_u64_t) },
+            { .name = "stats_time_total", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds },
+            { .name = "stats_time_last", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds },
+            { .name = "stats_memory", .type = ecs_id(ecs_i64_t), .unit = EcsBytes },
+            { .name = "component_record_count", .type = ecs_id(ecs_i32_t) },
+            { .name = "pair_record_count", .type = ecs_id(ecs_i32_t) },
+            { .name = "component_record_memory", .type = ecs_id(ecs_i64_t), .unit = EcsBytes },
+            { .name = "component_record_memory_avg", .type = ecs_id(ecs_f64_t), .unit = EcsBytes },
             { .name = "build_info", .type = build_info }
         }
     });
@@ -71070,6 +77634,7 @@ void flecs_query_mark_fields_dirty(
 
         ecs_entity_t src = it->sources[i];
         ecs_table_t *table;
+        int32_t row = it->offset, count = it->count;
         if (!src) {
             table = it->table;
         } else {
@@ -71078,6 +77643,9 @@ void flecs_query_mark_fields_dirty(
                 continue;
             }
 
+            row = ECS_RECORD_TO_ROW(r->row);
+            count = 1;
+
             if (q->shared_readonly_fields & flecs_ito(uint32_t, 1 << i)) {
                 /* Shared fields that aren't marked explicitly as out/inout 
                  * default to readonly */
@@ -71094,6 +77662,10 @@ void flecs_query_mark_fields_dirty(
         ecs_assert(type_index >= 0, ECS_INTERNAL_ERROR, NULL);
         
         ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
+        if ((table->flags & EcsTableHasDirtyRows) && (tr->column != -1)) {
+            flecs_table_mark_rows_dirty(world, table, tr->column, row, count);
+        }
+
         int32_t *dirty_state = table->dirty_state;
         if (!dirty_state) {
             continue;
@@ -71133,6 +77705,12 @@ void flecs_query_mark_fixed_fields_dirty(
             continue;
         }
 
+        const ecs_table_record_t *tr = it->trs[i];
+        if ((table->flags & EcsTableHasDirtyRows) && tr && tr->column != -1) {
+            flecs_table_mark_rows_dirty(world, table, tr->column, 
+                ECS_RECORD_TO_ROW(r->row), 1);
+        }
+
         int32_t *dirty_state = table->dirty_state;
         if (!dirty_state) {
             continue;
@@ -71275,6 +77853,164 @@ error:
     return false;
 }
 
+/* Get changed rows for iterator field. Returns NULL if field doesn't track
+ * changed rows. */
+static
+ecs_table_dirty_rows_t* flecs_iter_get_dirty_rows(
+    const ecs_iter_t *it,
+    int8_t index,
+    int32_t *row_out)
+{
+    const ecs_table_record_t *tr = it->trs[index];
+    if (!tr || tr->column == -1) {
+        return NULL; /* Not stored in table column */
+    }
+
+    ecs_table_t *table = it->table;
+    int32_t row = it->offset;
+    ecs_entity_t src = it->sources[index];
+    if (src) {
+        ecs_record_t *r = flecs_entities_get(it->real_world, src);
+        if (!r || !(table = r->table)) {
+            return NULL;
+        }
+        row = ECS_RECORD_TO_ROW(r->row);
+    }
+
+    if (!table) {
+        return NULL;
+    }
+
+    *row_out = row;
+    return flecs_table_get_dirty_rows(table, tr->column);
+}
+
+static
+bool flecs_dirty_rows_get(
+    const ecs_table_dirty_rows_t *dr,
+    int32_t row)
+{
+    int32_t word = row >> 6;
+    if (word >= ecs_vec_count(&dr->bits)) {
+        return false;
+    }
+    const uint64_t *words = ecs_vec_first(&dr->bits);
+    return (words[word] >> (row & 63)) & 1;
+}
+
+/* Public API call to find changed rows in the currently iterated result. */
+bool ecs_iter_changed_rows(
+    const ecs_iter_t *it,
+    int8_t index,
+    int32_t *offset,
+    int32_t *count)
+{
+    ecs_check(it != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(offset != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(count != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(ECS_BIT_IS_SET(it->flags, EcsIterIsValid), 
+        ECS_INVALID_PARAMETER, NULL);
+    ecs_check(index >= 0 && index < it->field_count, 
+        ECS_INVALID_PARAMETER, NULL);
+
+    int32_t start = *offset, end = it->count;
+    if (start >= end) {
+        return false;
+    }
+
+    if (!ecs_field_is_set(it, index)) {
+        return false;
+    }
+
+    int32_t row = 0;
+    const ecs_table_dirty_rows_t *dr = flecs_iter_get_dirty_rows(
+        it, index, &row);
+    if (!dr) {
+        /* Component doesn't track rows, report all rows as changed */
+        *count = end - start;
+        return true;
+    }
+
+    if (it->sources[index]) {
+        /* Shared component, all entities changed if source changed */
+        if (!flecs_dirty_rows_get(dr, row)) {
+            return false;
+        }
+        *count = end - start;
+        return true;
+    }
+
+    /* Find first changed row. Skip words without changed rows. */
+    const uint64_t *words = ecs_vec_first(&dr->bits);
+    int32_t word_count = ecs_vec_count(&dr->bits);
+    int32_t cur = row + start, last = row + end;
+    while (cur < last) {
+        int32_t word = cur >> 6;
+        if (word >= word_count) {
+            return false;
+        }
+        if (!(words[word] >> (cur & 63))) {
+            cur = (word + 1) << 6;
+            continue;
+        }
+        if ((words[word] >> (cur & 63)) & 1) {
+            break;
+        }
+        cur ++;
+    }
+
+    if (cur >= last) {
+        return false;
+    }
+
+    /* Find end of range */
+    int32_t range_end = cur + 1;
+    while (range_end < last && flecs_dirty_rows_get(dr, range_end)) {
+        range_end ++;
+    }
+
+    *offset = cur - row;
+    *count = range_end - cur;
+    return true;
+error:
+    return false;
+}
+
+/* Public API call to acknowledge changed rows in the current result. */
+void ecs_iter_clear_changed_rows(
+    const ecs_iter_t *it,
+    int8_t index)
+{
+    ecs_check(it != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(ECS_BIT_IS_SET(it->flags, EcsIterIsValid), 
+        ECS_INVALID_PARAMETER, NULL);
+    ecs_check(index >= 0 && index < it->field_count, 
+        ECS_INVALID_PARAMETER, NULL);
+
+    if (it->sources[index] || !ecs_field_is_set(it, index)) {
+        return;
+    }
+
+    int32_t row = 0;
+    ecs_table_dirty_rows_t *dr = flecs_iter_get_dirty_rows(it, index, &row);
+    if (!dr) {
+        return;
+    }
+
+    uint64_t *words = ecs_vec_first(&dr->bits);
+    int32_t word_count = ecs_vec_count(&dr->bits);
+    int32_t cur = row, last = ECS_MIN(row + it->count, word_count * 64);
+    while (cur < last) {
+        int32_t bit = cur & 63;
+        int32_t n = ECS_MIN(64 - bit, last - cur);
+        uint64_t mask = n == 64 ? UINT64_MAX : (((1llu << n) - 1) << bit);
+        words[cur >> 6] &= ~mask;
+        cur += n;
+    }
+error:
+    return;
+}
+
 /* Public API call for skipping change detection (don't mark fields dirty) */
 void ecs_iter_skip(
     ecs_iter_t *it)
@@ -72791,7 +79527,9 @@ void flecs_query_cache_sort_tables(
 
             /* Something has changed, sort the table. Prefers using 
             * flecs_query_cache_sort_table when available */
+            ecs_os_perf_trace_push("flecs.query.sort");
             flecs_query_cache_sort_table(world, table, column, compare, sort);
+            ecs_os_perf_trace_pop("flecs.query.sort");
             tables_sorted = true;
         }
     } while ((cur = cur->next)); /* Next group */
@@ -77166,7 +83904,8 @@ void flecs_query_self_change_detection(
     ecs_query_iter_t *qit,
     ecs_query_impl_t *impl)
 {
-    if (!it->table->dirty_state) {
+    ecs_table_t *table = it->table;
+    if (!table->dirty_state && !(table->flags & EcsTableHasDirtyRows)) {
         return;
     }
 
@@ -78014,6 +84753,11 @@ bool flecs_query_pred_neq_name(
  */
 
 
+/* When a sparse set has this many times fewer elements than the number of rows
+ * in a table range, entities in the range are found by iterating the sparse 
+ * set instead of testing each row of the range. */
+#define FLECS_QUERY_SPARSE_DENSE_RATIO (16)
+
 static
 bool flecs_query_sparse_init_sparse(
     ecs_query_sparse_ctx_t *op_ctx,
@@ -78054,6 +84798,87 @@ void flecs_query_sparse_init_range(
 
     op_ctx->range = range;
     op_ctx->cur = range.offset - 1; 
+    op_ctx->dense_cur = 0;
+    op_ctx->dense = false;
+}
+
+/* Can consecutive rows be returned as a single result */
+static
+bool flecs_query_sparse_can_batch(
+    const ecs_query_op_t *op,
+    const ecs_query_run_ctx_t *ctx)
+{
+    if (!(op->flags & (EcsQueryIsVar << EcsQuerySrc))) {
+        return false;
+    }
+
+    return ctx->query_vars[op->src.var].kind == EcsVarTable;
+}
+
+/* Find entities in range by iterating the dense array of the sparse set. 
+ * Entities that are stored in consecutive rows of the range are returned as a
+ * single result. */
+static
+bool flecs_query_sparse_next_dense(
+    const ecs_query_op_t *op,
+    const ecs_query_run_ctx_t *ctx,
+    ecs_query_sparse_ctx_t *op_ctx,
+    void **ptr_out)
+{
+    ecs_table_t *table = op_ctx->range.table;
+    int32_t offset = op_ctx->range.offset;
+    int32_t end = op_ctx->range.count + offset;
+    int32_t count = flecs_sparse_count(op_ctx->sparse);
+    const uint64_t *ids = flecs_sparse_ids(op_ctx->sparse);
+
+    ecs_assert(op_ctx->dense_cur <= count, ECS_INVALID_OPERATION, 
+        "sparse iterator invalidated while iterating");
+
+    for (; op_ctx->dense_cur < count; op_ctx->dense_cur ++) {
+        ecs_record_t *r = flecs_entities_get(
+            ctx->world, ids[op_ctx->dense_cur]);
+        if (r->table != table) {
+            continue;
+        }
+
+        int32_t row = ECS_RECORD_TO_ROW(r->row);
+        if (row < offset || row >= end) {
+            continue;
+        }
+
+        int32_t row_count = 1;
+        op_ctx->dense_cur ++;
+
+        if (ptr_out) {
+            *ptr_out = flecs_sparse_get_dense(
+                op_ctx->sparse, 0, op_ctx->dense_cur - 1);
+        } else {
+            /* Add entities in next rows to the result */
+            for (; op_ctx->dense_cur < count; op_ctx->dense_cur ++) {
+                r = flecs_entities_get(ctx->world, ids[op_ctx->dense_cur]);
+                if (r->table != table) {
+                    break;
+                }
+
+                int32_t next_row = ECS_RECORD_TO_ROW(r->row);
+                if (next_row != (row + row_count) || next_row >= end) {
+                    break;
+                }
+
+                row_count ++;
+            }
+        }
+
+        flecs_query_var_narrow_range(
+            op->src.var, table, row, row_count, ctx);
+
+        return true;
+    }
+
+    flecs_query_var_narrow_range(op->src.var, table, 
+        op_ctx->range.offset, op_ctx->range.count, ctx);
+
+    return false;
 }
 
 static
@@ -78064,6 +84889,10 @@ bool flecs_query_sparse_next_entity(
     bool not,
     void **ptr_out)
 {
+    if (op_ctx->dense) {
+        return flecs_query_sparse_next_dense(op, ctx, op_ctx, ptr_out);
+    }
+
     int32_t end = op_ctx->range.count + op_ctx->range.offset;
 
 next:
@@ -78077,7 +84906,8 @@ next:
         return false;
     }
 
-    ecs_entity_t e = ecs_table_entities(op_ctx->range.table)[op_ctx->cur];
+    const ecs_entity_t *entities = ecs_table_entities(op_ctx->range.table);
+    ecs_entity_t e = entities[op_ctx->cur];
     bool result;
 
     if (ptr_out) {
@@ -78097,8 +84927,29 @@ next:
     }
 
     if (op->flags & (EcsQueryIsVar << EcsQuerySrc)) {
+        int32_t row = op_ctx->cur, count = 1;
+
+        /* Add next rows with the same result, unless a pointer to the 
+         * component is returned, which can be different for each row. */
+        if (!ptr_out && flecs_query_sparse_can_batch(op, ctx)) {
+            while ((row + count) < end) {
+                e = entities[row + count];
+                if (flecs_sparse_has(op_ctx->sparse, e) == not) {
+                    break;
+                }
+                count ++;
+            }
+
+            op_ctx->cur += count - 1;
+
+            /* Row after the batch doesn't match, skip it in next call */
+            if ((row + count) < end) {
+                op_ctx->cur ++;
+            }
+        }
+
         flecs_query_var_narrow_range(op->src.var, op_ctx->range.table, 
-            op_ctx->cur, 1, ctx);
+            row, count, ctx);
     }
 
     return true;
@@ -78132,13 +84983,30 @@ next:
     ecs_assert(op_ctx->cur < flecs_sparse_count(op_ctx->sparse), 
         ECS_INVALID_OPERATION, "sparse iterator invalidated while iterating");
 
-    ecs_entity_t e = flecs_sparse_ids(op_ctx->sparse)[op_ctx->cur];
-    ecs_table_range_t range = flecs_range_from_entity(e, ctx);
+    const uint64_t *ids = flecs_sparse_ids(op_ctx->sparse);
+    ecs_table_range_t range = flecs_range_from_entity(ids[op_ctx->cur], ctx);
 
     if (flecs_query_table_filter(range.table, op->other, table_mask)) {
         goto next;
     }
 
+    /* Entities are iterated back to front. If the previous entities are 
+     * stored in the rows before the current entity, add them to the result. */
+    while (op_ctx->cur) {
+        ecs_record_t *r = flecs_entities_get(ctx->world, ids[op_ctx->cur - 1]);
+        if (r->table != range.table) {
+            break;
+        }
+
+        if (ECS_RECORD_TO_ROW(r->row) != (range.offset - 1)) {
+            break;
+        }
+
+        range.offset --;
+        range.count ++;
+        op_ctx->cur --;
+    }
+
     flecs_query_var_set_range(op, op->src.var, 
         range.table, range.offset, range.count, ctx);
     flecs_query_set_vars(op, it->ids[field_index], ctx);
@@ -78314,6 +85182,14 @@ bool flecs_query_sparse_with_id(
         }
 
         flecs_query_sparse_init_range(op, ctx, op_ctx);
+
+        /* If the sparse set is much smaller than the range, it's cheaper to
+         * find the entities of the range in the sparse set. */
+        if (!not && flecs_query_sparse_can_batch(op, ctx)) {
+            int32_t sparse_count = flecs_sparse_count(op_ctx->sparse);
+            op_ctx->dense = (sparse_count * FLECS_QUERY_SPARSE_DENSE_RATIO) < 
+                op_ctx->range.count;
+        }
     }
 
     return flecs_query_sparse_next_entity(op, ctx, op_ctx, not, ptr_out);
@@ -78614,24 +85490,23 @@ bool flecs_query_sparse(
  */
 
 
-typedef struct {
-    ecs_flags64_t mask;
-    bool has_bitset;
-} flecs_query_row_mask_t;
-
+/* Find the bitset columns for the toggle fields of a table. Returns false if
+ * a not field is set for a component that can't be toggled in the table, in
+ * which case no rows can match. */
 static
-flecs_query_row_mask_t flecs_query_get_row_mask(
+bool flecs_query_toggle_resolve(
     ecs_iter_t *it,
     ecs_table_t *table,
-    int32_t block_index,
     ecs_flags64_t and_fields,
     ecs_flags64_t not_fields,
     ecs_query_toggle_ctx_t *op_ctx)
 {
-    ecs_flags64_t mask = UINT64_MAX;
     int32_t i, field_count = it->field_count;
     ecs_flags64_t fields = and_fields | not_fields;
-    bool has_bitset = false;
+    int16_t bs_offset = table->_->bs_offset;
+
+    op_ctx->bs_count = 0;
+    op_ctx->bs_not = 0;
 
     for (i = 0; i < field_count; i ++) {
         uint64_t field_bit = 1llu << i;
@@ -78647,29 +85522,130 @@ flecs_query_row_mask_t flecs_query_get_row_mask(
             ecs_abort(ECS_INTERNAL_ERROR, NULL);
         }
 
-        ecs_id_t id = it->ids[i];
-        ecs_bitset_t *bs = flecs_table_get_toggle(table, id);
-        if (!bs) {
+        int32_t column = flecs_table_get_toggle_column(table, it->ids[i]);
+        if (column == -1) {
             if (not_fields & field_bit) {
                 if (op_ctx->prev_set_fields & field_bit) {
-                    has_bitset = false;
-                    break;
+                    return false;
                 }
             }
             continue;
         }
 
+        if (not_fields & field_bit) {
+            op_ctx->bs_not |= (ecs_termset_t)(1u << op_ctx->bs_count);
+        }
+
+        op_ctx->bs_columns[op_ctx->bs_count ++] = 
+            flecs_ito(int16_t, column - bs_offset);
+    }
+
+    return true;
+}
+
+/* Combine the bitsets of the toggle fields for a block of 64 rows. */
+static
+ecs_flags64_t flecs_query_toggle_block(
+    const ecs_table_t *table,
+    const ecs_query_toggle_ctx_t *op_ctx,
+    int32_t block_index)
+{
+    const ecs_bitset_t *bs_columns = table->_->bs_columns;
+    ecs_flags64_t mask = UINT64_MAX;
+    int32_t i, count = op_ctx->bs_count;
+
+    for (i = 0; i < count; i ++) {
+        const ecs_bitset_t *bs = &bs_columns[op_ctx->bs_columns[i]];
         ecs_assert((64 * block_index) < bs->size, ECS_INTERNAL_ERROR, NULL);
-        ecs_flags64_t block = bs->data[block_index];
 
-        if (not_fields & field_bit) {
-            block = ~block;
+        /* Invert block for not fields without branching */
+        ecs_flags64_t invert = 0 - (ecs_flags64_t)((op_ctx->bs_not >> i) & 1);
+        mask &= bs->data[block_index] ^ invert;
+    }
+
+    return mask;
+}
+
+/* Get the matching rows of a block in the [cur, last) range. */
+static
+ecs_flags64_t flecs_query_toggle_bits(
+    const ecs_table_t *table,
+    ecs_query_toggle_ctx_t *op_ctx,
+    int32_t block_index,
+    int32_t cur,
+    int32_t last)
+{
+    if (block_index != op_ctx->block_index) {
+        op_ctx->block = flecs_query_toggle_block(table, op_ctx, block_index);
+        op_ctx->block_index = block_index;
+    }
+
+    ecs_flags64_t bits = op_ctx->block;
+    int32_t block_first = block_index * 64;
+    if (cur > block_first) {
+        bits &= UINT64_MAX << (cur - block_first);
+    }
+    if ((last - block_first) < 64) {
+        bits &= (1llu << (last - block_first)) - 1;
+    }
+
+    return bits;
+}
+
+static
+void flecs_query_toggle_set_row_mask(
+    ecs_iter_t *it,
+    ecs_table_t *table,
+    int32_t offset,
+    ecs_flags64_t mask)
+{
+    ecs_query_iter_t *qit = &it->priv_.iter.query;
+    qit->row_mask = mask;
+    qit->row_mask_offset = offset;
+    qit->row_mask_table = table;
+}
+
+/* Return the rows of a range without bitset columns in blocks of 64 rows. In
+ * row mask mode results can't be larger than 64 rows, even if all rows match. */
+static
+bool flecs_query_toggle_mask_all(
+    const ecs_query_op_t *op,
+    bool redo,
+    ecs_query_run_ctx_t *ctx,
+    ecs_table_range_t range)
+{
+    ecs_iter_t *it = ctx->it;
+    ecs_query_toggle_ctx_t *op_ctx = flecs_op_ctx(ctx, toggle);
+    ecs_table_t *table = range.table;
+
+    if (!redo) {
+        if (!range.count) {
+            range.count = ecs_table_count(table);
         }
-        mask &= block;
-        has_bitset = true;
+        op_ctx->range = range;
+        op_ctx->cur = range.offset;
+    }
+
+    int32_t last = op_ctx->range.offset + op_ctx->range.count;
+    int32_t row = op_ctx->cur;
+    if (row >= last) {
+        /* Restore range & set fields */
+        if (op->flags & (EcsQueryIsVar << EcsQuerySrc)) {
+            flecs_query_var_narrow_range(op->src.var, 
+                table, op_ctx->range.offset, op_ctx->range.count, ctx);
+        }
+        it->set_fields = op_ctx->prev_set_fields;
+        return false;
     }
 
-    return (flecs_query_row_mask_t){ mask, has_bitset };
+    int32_t cur = ECS_MIN(last, row + 64);
+    if (op->flags & (EcsQueryIsVar << EcsQuerySrc)) {
+        flecs_query_var_narrow_range(op->src.var, table, row, cur - row, ctx);
+    }
+    flecs_query_toggle_set_row_mask(it, table, row, UINT64_MAX);
+    op_ctx->cur = cur;
+
+    return true;
 }
 
 static
@@ -78712,7 +85688,8 @@ bool flecs_query_toggle_cmp(
     bool redo,
     ecs_query_run_ctx_t *ctx,
     ecs_flags64_t and_fields,
-    ecs_flags64_t not_fields)
+    ecs_flags64_t not_fields,
+    bool row_mask)
 {
     ecs_iter_t *it = ctx->it;
     ecs_query_toggle_ctx_t *op_ctx = flecs_op_ctx(ctx, toggle);
@@ -78748,6 +85725,8 @@ bool flecs_query_toggle_cmp(
             /* If any of the toggle fields with a not operator are for fields
              * that are set, without a bitset those fields can't match. */
             return false;
+        } else if (row_mask) {
+            return flecs_query_toggle_mask_all(op, redo, ctx, range);
         } else {
             /* If table doesn't have toggles but query matched toggleable 
              * components, all entities match. */
@@ -78766,107 +85745,84 @@ bool flecs_query_toggle_cmp(
         }
     }
 
-    int32_t i, j;
-    int32_t first, last, block_index, cur;
-    uint64_t block = 0;
     if (!redo) {
         op_ctx->range = range;
-        cur = op_ctx->cur = range.offset;
-        block_index = op_ctx->block_index = -1;
-        first = range.offset;
-        last = range.offset + range.count;
-    } else {
-        if (!op_ctx->has_bitset) {
-            goto done;
-        }
-
-        last = op_ctx->range.offset + op_ctx->range.count;
-        cur = op_ctx->cur;
-        ecs_assert(cur <= last, ECS_INTERNAL_ERROR, NULL);
-        if (cur == last) {
-            goto done;
-        }
-
-        first = cur;
-        block_index = op_ctx->block_index;
-        block = op_ctx->block;
-    }
-
-    /* If end of last iteration is start of new block, compute new block */    
-    int32_t new_block_index = cur / 64, row = first;
-    if (new_block_index != block_index) {
-compute_block:
-        block_index = op_ctx->block_index = new_block_index;
-
-        flecs_query_row_mask_t row_mask = flecs_query_get_row_mask(
-            it, table, block_index, and_fields, not_fields, op_ctx);
+        op_ctx->cur = range.offset;
+        op_ctx->block_index = -1;
+        op_ctx->has_bitset = flecs_query_toggle_resolve(
+                it, table, and_fields, not_fields, op_ctx) && 
+            op_ctx->bs_count;
 
         /* If table doesn't have bitset columns, all columns match */
-        if (!(op_ctx->has_bitset = row_mask.has_bitset)) {
+        if (!op_ctx->has_bitset) {
             if (!not_fields) {
+                if (row_mask) {
+                    return flecs_query_toggle_mask_all(op, false, ctx, range);
+                }
                 return true;
             } else {
                 goto done;
             }
         }
-
-        /* No enabled bits */
-        block = row_mask.mask;
-        if (!block) {
-next_block:
-            new_block_index ++;
-            cur = new_block_index * 64;
-            if (cur >= last) {
-                /* No more rows */
-                goto done;
+    } else {
+        if (!op_ctx->has_bitset) {
+            if (row_mask && !not_fields) {
+                return flecs_query_toggle_mask_all(op, true, ctx, range);
             }
+            goto done;
+        }
+    }
 
-            op_ctx->cur = cur;
-            goto compute_block;
+    int32_t last = op_ctx->range.offset + op_ctx->range.count;
+    int32_t cur = op_ctx->cur, block_index = 0;
+    ecs_flags64_t bits = 0;
+    ecs_assert(cur <= last, ECS_INTERNAL_ERROR, NULL);
+
+    /* Find first block with matching rows */
+    while (cur < last) {
+        block_index = cur / 64;
+        bits = flecs_query_toggle_bits(table, op_ctx, block_index, cur, last);
+        if (bits) {
+            break;
         }
+        cur = (block_index + 1) * 64;
+    }
 
-        op_ctx->block = block;
+    if (!bits) {
+        goto done;
     }
 
-    /* Find first enabled bit (TODO: use faster bitmagic) */
-    int32_t first_bit = cur - (block_index * 64);
-    int32_t last_bit = ECS_MIN(64, last - (block_index * 64));
-    ecs_assert(first_bit >= 0, ECS_INTERNAL_ERROR, NULL);
-    ecs_assert(first_bit < 64, ECS_INTERNAL_ERROR, NULL);
-    ecs_assert(last_bit >= 0, ECS_INTERNAL_ERROR, NULL);
-    ecs_assert(last_bit <= 64, ECS_INTERNAL_ERROR, NULL);
-    ecs_assert(last_bit >= first_bit, ECS_INTERNAL_ERROR, NULL);
+    int32_t row = block_index * 64 + flecs_ctz64(bits);
 
-    for (i = first_bit; i < last_bit; i ++) {
-        uint64_t bit = (1ull << i);
-        bool cond = 0 != (block & bit);
-        if (cond) {
-            /* Find last enabled bit */
-            for (j = i; j < last_bit; j ++) {
-                bit = (1ull << j);
-                cond = !(block & bit);
-                if (cond) {
-                    break;
-                }
+    if (row_mask) {
+        /* Return the remaining rows of the block, and leave skipping the rows
+         * that don't match to the application. */
+        cur = ECS_MIN(last, (block_index + 1) * 64);
+        flecs_query_toggle_set_row_mask(it, table, row, bits >> (row % 64));
+    } else {
+        /* Find end of range, which can continue in the next blocks */
+        ecs_flags64_t unset = ~bits & (UINT64_MAX << (row % 64));
+        while (!unset) {
+            cur = (block_index + 1) * 64;
+            if (cur >= last) {
+                break;
             }
 
-            row = i + (block_index * 64);
-            cur = j + (block_index * 64);
-            break;
+            block_index ++;
+            unset = ~flecs_query_toggle_bits(
+                table, op_ctx, block_index, cur, last);
         }
-    }
 
-    if (i == last_bit) {
-        goto next_block;
+        if (unset) {
+            cur = block_index * 64 + flecs_ctz64(unset);
+        } else {
+            cur = last;
+        }
     }
 
-    ecs_assert(row >= first, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(row >= op_ctx->range.offset, ECS_INTERNAL_ERROR, NULL);
     ecs_assert(cur <= last, ECS_INTERNAL_ERROR, NULL);
-    ecs_assert(cur >= first, ECS_INTERNAL_ERROR, NULL);
-
-    if (!(cur - row)) {
-        goto done;
-    }
+    ecs_assert(cur > row, ECS_INTERNAL_ERROR, NULL);
 
     if (op->flags & (EcsQueryIsVar << EcsQuerySrc)) {
         flecs_query_var_narrow_range(op->src.var, table, row, cur - row, ctx);
@@ -78899,9 +85855,10 @@ bool flecs_query_toggle(
 
     ecs_flags64_t and_fields = op->first.entity;
     ecs_flags64_t not_fields = op->second.entity & op_ctx->prev_set_fields;
+    bool row_mask = (ctx->query->pub.flags & EcsQueryToggleMask) != 0;
 
     return flecs_query_toggle_cmp(
-        op, redo, ctx, and_fields, not_fields);
+        op, redo, ctx, and_fields, not_fields, row_mask);
 }
 
 bool flecs_query_toggle_option(
@@ -78926,7 +85883,7 @@ repeat: {}
     }
 
     bool result = flecs_query_toggle_cmp(
-        op, redo, ctx, and_fields, not_fields);
+        op, redo, ctx, and_fields, not_fields, false);
     if (!result) {
         if (!op_ctx->optional_not) {
             /* Run the not-branch of optional fields */
@@ -78941,6 +85898,40 @@ repeat: {}
 }
 
 
+ecs_flags64_t ecs_iter_get_row_mask(
+    const ecs_iter_t *it)
+{
+    ecs_check(it != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_flags64_t result = UINT64_MAX;
+    if (it->count < 64) {
+        result = (1llu << it->count) - 1;
+    }
+
+    /* Find query iterator, which can be chained by worker/page iterators */
+    const ecs_iter_t *qit_owner = it;
+    while (qit_owner->next != ecs_query_next) {
+        qit_owner = qit_owner->chain_it;
+        if (!qit_owner) {
+            return result;
+        }
+    }
+
+    const ecs_query_iter_t *qit = &qit_owner->priv_.iter.query;
+    if (qit->row_mask_table != it->table) {
+        return result;
+    }
+
+    int32_t shift = it->offset - qit->row_mask_offset;
+    if (shift < 0 || shift >= 64) {
+        return result;
+    }
+
+    return result & (qit->row_mask >> shift);
+error:
+    return 0;
+}
+
 /**
  * @file query/engine/eval_trav.c
  * @brief Transitive/reflexive relationship traversal.
@@ -79236,6 +86227,16 @@ bool flecs_query_trav(
  */
 
 
+/* The union index is built lazily while evaluating queries, which is not safe
+ * when multiple threads are evaluating queries. */
+static
+bool flecs_query_union_use_index(
+    const ecs_query_run_ctx_t *ctx)
+{
+    return (ctx->world->flags & (EcsWorldUnionIndex|EcsWorldMultiThreaded)) ==
+        EcsWorldUnionIndex;
+}
+
 static
 bool flecs_query_union_with_wildcard(
     const ecs_query_op_t *op,
@@ -79384,6 +86385,78 @@ next_row:
     return true;
 }
 
+static
+bool flecs_query_union_with_tgt_w_index(
+    const ecs_query_op_t *op,
+    bool redo,
+    const ecs_query_run_ctx_t *ctx,
+    ecs_entity_t rel,
+    ecs_entity_t tgt)
+{
+    ecs_query_union_ctx_t *op_ctx = flecs_op_ctx(ctx, union_);
+    ecs_iter_t *it = ctx->it;
+    int8_t field_index = op->field_index;
+
+    ecs_table_range_t range;
+    ecs_table_t *table;
+    if (!redo) {
+        range = flecs_query_get_range(op, &op->src, EcsQuerySrc, ctx);
+        table = range.table;
+        if (!range.count) {
+            range.count = ecs_table_count(table);
+        }
+
+        op_ctx->range = range;
+        op_ctx->cr = flecs_components_get(ctx->world, ecs_pair(rel, EcsUnion));
+        if (!op_ctx->cr) {
+            return false;
+        }
+
+        /* Only build index for tables with the union relationship */
+        if (!flecs_component_get_table(op_ctx->cr, table)) {
+            return false;
+        }
+
+        op_ctx->ut = flecs_union_index_get(ctx->world, op_ctx->cr, table);
+        op_ctx->target = flecs_union_table_get_target(op_ctx->ut, tgt);
+        if (!op_ctx->target) {
+            return false;
+        }
+
+        flecs_union_target_seek(
+            op_ctx->target, range.offset, &op_ctx->word, &op_ctx->bit);
+    } else {
+        range = op_ctx->range;
+        table = range.table;
+    }
+
+    int32_t offset, count, end = range.offset + range.count;
+    if (!flecs_union_target_next_range(op_ctx->target, 
+        &op_ctx->word, &op_ctx->bit, &offset, &count) || offset >= end) 
+    {
+        /* Restore range */
+        if (op->flags & (EcsQueryIsVar << EcsQuerySrc)) {
+            flecs_query_var_narrow_range(op->src.var, table, 
+                op_ctx->range.offset, op_ctx->range.count, ctx);
+        }
+        return false;
+    }
+
+    if ((offset + count) > end) {
+        count = end - offset;
+    }
+
+    it->ids[field_index] = ecs_pair(rel, tgt);
+
+    if (op->flags & (EcsQueryIsVar << EcsQuerySrc)) {
+        flecs_query_var_narrow_range(op->src.var, table, offset, count, ctx);
+    }
+
+    flecs_query_set_vars(op, it->ids[field_index], ctx);
+
+    return true;
+}
+
 bool flecs_query_union_with(
     const ecs_query_op_t *op,
     bool redo,
@@ -79396,11 +86469,145 @@ bool flecs_query_union_with(
 
     if (tgt == EcsWildcard) {
         return flecs_query_union_with_wildcard(op, redo, ctx, rel, neq);
+    } else if (!neq && flecs_query_union_use_index(ctx)) {
+        return flecs_query_union_with_tgt_w_index(op, redo, ctx, rel, tgt);
     } else {
         return flecs_query_union_with_tgt(op, redo, ctx, rel, tgt, neq);
     }
 }
 
+/* Return next range of rows with target in table of the current union index
+ * iteration, or move on to the next table. */
+static
+bool flecs_query_union_index_next_range(
+    const ecs_query_op_t *op,
+    const ecs_query_run_ctx_t *ctx)
+{
+    ecs_query_union_ctx_t *op_ctx = flecs_op_ctx(ctx, union_);
+    int32_t offset, count;
+    if (!op_ctx->target || !flecs_union_target_next_range(
+        op_ctx->target, &op_ctx->word, &op_ctx->bit, &offset, &count))
+    {
+        return false;
+    }
+
+    flecs_query_var_set_range(op, op->src.var, 
+        op_ctx->range.table, offset, count, ctx);
+
+    return true;
+}
+
+/* Move to next table with union relationship and build its row index. */
+static
+bool flecs_query_union_index_next_table(
+    const ecs_query_run_ctx_t *ctx)
+{
+    ecs_query_union_ctx_t *op_ctx = flecs_op_ctx(ctx, union_);
+    const ecs_table_record_t *tr = flecs_table_cache_next(
+        &op_ctx->it, ecs_table_record_t);
+    if (!tr) {
+        return false;
+    }
+
+    ecs_table_t *table = tr->hdr.table;
+    op_ctx->range.table = table;
+    op_ctx->ut = flecs_union_index_get(ctx->world, op_ctx->cr, table);
+    op_ctx->target = NULL;
+    op_ctx->tgt_index = 0;
+    op_ctx->word = 0;
+    op_ctx->bit = 0;
+
+    return true;
+}
+
+static
+bool flecs_query_union_select_tgt_w_index(
+    const ecs_query_op_t *op,
+    bool redo,
+    const ecs_query_run_ctx_t *ctx,
+    ecs_entity_t rel,
+    ecs_entity_t tgt)
+{
+    ecs_query_union_ctx_t *op_ctx = flecs_op_ctx(ctx, union_);
+    ecs_iter_t *it = ctx->it;
+    int8_t field_index = op->field_index;
+
+    if (!redo) {
+        op_ctx->cr = flecs_components_get(ctx->world, ecs_pair(rel, EcsUnion));
+        if (!op_ctx->cr) {
+            return false;
+        }
+
+        if (!flecs_table_cache_iter(&op_ctx->cr->cache, &op_ctx->it)) {
+            return false;
+        }
+
+        op_ctx->target = NULL;
+    }
+
+    while (!flecs_query_union_index_next_range(op, ctx)) {
+        if (!flecs_query_union_index_next_table(ctx)) {
+            return false;
+        }
+
+        op_ctx->target = flecs_union_table_get_target(op_ctx->ut, tgt);
+    }
+
+    it->ids[field_index] = ecs_pair(rel, tgt);
+    flecs_query_set_vars(op, it->ids[field_index], ctx);
+
+    return true;
+}
+
+static
+bool flecs_query_union_select_wildcard_w_index(
+    const ecs_query_op_t *op,
+    bool redo,
+    const ecs_query_run_ctx_t *ctx,
+    ecs_entity_t rel)
+{
+    ecs_query_union_ctx_t *op_ctx = flecs_op_ctx(ctx, union_);
+    ecs_iter_t *it = ctx->it;
+    int8_t field_index = op->field_index;
+
+    if (!redo) {
+        op_ctx->cr = flecs_components_get(ctx->world, ecs_pair(rel, EcsUnion));
+        if (!op_ctx->cr) {
+            return false;
+        }
+
+        if (!flecs_table_cache_iter(&op_ctx->cr->cache, &op_ctx->it)) {
+            return false;
+        }
+
+        op_ctx->ut = NULL;
+        op_ctx->target = NULL;
+    }
+
+    while (!flecs_query_union_index_next_range(op, ctx)) {
+        /* Move to next target in table, or next table if all targets in the
+         * current table have been iterated. */
+        while (!op_ctx->ut || 
+            op_ctx->tgt_index == ecs_vec_count(&op_ctx->ut->targets)) 
+        {
+            if (!flecs_query_union_index_next_table(ctx)) {
+                return false;
+            }
+        }
+
+        op_ctx->target = ecs_vec_get_t(&op_ctx->ut->targets, 
+            ecs_union_target_t, op_ctx->tgt_index);
+        op_ctx->tgt_index ++;
+        op_ctx->word = 0;
+        op_ctx->bit = 0;
+    }
+
+    it->ids[field_index] = ecs_pair(rel, op_ctx->target->tgt);
+    flecs_query_set_vars(op, it->ids[field_index], ctx);
+
+    return true;
+}
+
 static
 bool flecs_query_union_select_tgt(
     const ecs_query_op_t *op,
@@ -79498,6 +86705,16 @@ bool flecs_query_union_select(
     ecs_entity_t rel = ECS_PAIR_FIRST(id);
     ecs_entity_t tgt = ecs_pair_second(ctx->world, id);
 
+    if (flecs_query_union_use_index(ctx)) {
+        if (tgt == EcsWildcard) {
+            return flecs_query_union_select_wildcard_w_index(
+                op, redo, ctx, rel);
+        } else {
+            return flecs_query_union_select_tgt_w_index(
+                op, redo, ctx, rel, tgt);
+        }
+    }
+
     if (tgt == EcsWildcard) {
         return flecs_query_union_select_wildcard(op, redo, ctx, rel);
     } else {
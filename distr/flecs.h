@@ -332,6 +332,22 @@
 #define FLECS_QUERY_SCOPE_NESTING_MAX (8)
 #endif
 
+/** @def FLECS_QUERY_PLAN_CACHE_SIZE
+ * Maximum number of queries stored by ecs_query_plan_cache_get(). When the
+ * cache is full, the least recently used query is deleted. */
+#ifndef FLECS_QUERY_PLAN_CACHE_SIZE
+#define FLECS_QUERY_PLAN_CACHE_SIZE (32)
+#endif
+
+/** @def FLECS_ASYNC_QUEUE_SIZE
+ * Number of commands that can be enqueued with the ecs_async_* functions 
+ * before the world is merged without taking a lock. When the queue is full, 
+ * commands are added to a mutex protected overflow queue. Must be a power of 
+ * two. */
+#ifndef FLECS_ASYNC_QUEUE_SIZE
+#define FLECS_ASYNC_QUEUE_SIZE (1024)
+#endif
+
 /** @def FLECS_DAG_DEPTH_MAX
  * Maximum of levels in a DAG (acyclic relationship graph). If a graph with a
  * depth larger than this is encountered, a CYCLE_DETECTED panic is thrown.
@@ -380,6 +396,10 @@ extern "C" {
 #define EcsWorldMeasureSystemTime     (1u << 6)
 #define EcsWorldMultiThreaded         (1u << 7)
 #define EcsWorldFrameInProgress       (1u << 8)
+#define EcsWorldPreciseFramePacing    (1u << 9)
+#define EcsWorldPathCache             (1u << 10)
+#define EcsWorldParallelDelete        (1u << 11)
+#define EcsWorldUnionIndex            (1u << 12)
 
 ////////////////////////////////////////////////////////////////////////////////
 //// OS API flags
@@ -442,6 +462,7 @@ extern "C" {
 #define EcsIdDontFragment              (1u << 24)
 #define EcsIdMatchDontFragment         (1u << 25) /* For (*, T) wildcards */
 #define EcsIdIsUnion                   (1u << 26)
+#define EcsIdDirtyRows                 (1u << 27)
 #define EcsIdOrderedChildren           (1u << 28)
 #define EcsIdEventMask\
     (EcsIdHasOnAdd|EcsIdHasOnRemove|EcsIdHasOnSet|\
@@ -567,6 +588,7 @@ extern "C" {
 #define EcsObserverBypassQuery         (1u << 7u)  /* Don't evaluate query for multi-component observer*/
 #define EcsObserverYieldOnCreate       (1u << 8u)  /* Yield matching entities when creating observer */
 #define EcsObserverYieldOnDelete       (1u << 9u)  /* Yield matching entities when deleting observer */
+#define EcsObserverMultiThreaded       (1u << 10u) /* Observer callback can be invoked from multiple threads */
 #define EcsObserverKeepAlive           (1u << 11u) /* Observer keeps component alive (same value as EcsTermKeepAlive) */
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -605,6 +627,7 @@ extern "C" {
 #define EcsTableHasOrderedChildren     (1u << 28u)
 #define EcsTableEdgeReparent           (1u << 29u)
 #define EcsTableMarkedForDelete        (1u << 30u)
+#define EcsTableHasDirtyRows           (1u << 31u) /* Does table track changed rows */
 
 /* Composite table flags */
 #define EcsTableHasLifecycle     (EcsTableHasCtors | EcsTableHasDtors)
@@ -789,6 +812,7 @@ extern "C" {
 #include <stdarg.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
 
 /* Non-standard but required. If not provided by platform, add manually. */
 #include <stdint.h>
@@ -2497,6 +2521,22 @@ typedef
 void* (*ecs_os_api_task_join_t)(
     ecs_os_thread_t thread);
 
+/** Job invoked by parallel_for, once for each index. */
+typedef
+void (*ecs_os_parallel_job_t)(
+    void *ctx,
+    int32_t index);
+
+/** OS API parallel_for function type.
+ * Runs job for each index in [0, count) and returns when all invocations have
+ * finished. Invocations may run concurrently. Index 0 must be invoked on the
+ * calling thread, other indices may also run on the calling thread. */
+typedef
+void (*ecs_os_api_parallel_for_t)(
+    ecs_os_parallel_job_t job,
+    void *ctx,
+    int32_t count);
+
 /* Atomic increment / decrement */
 /** OS API ainc function type. */
 typedef
@@ -2562,6 +2602,13 @@ void (*ecs_os_api_sleep_t)(
     int32_t sec,
     int32_t nanosec);
 
+/** OS API sleep_until function type.
+ * Sleeps until the provided deadline, which is in nanoseconds and uses the
+ * same clock as the now function. */
+typedef
+void (*ecs_os_api_sleep_until_t)(
+    uint64_t deadline);
+
 /** OS API enable_high_timer_resolution function type. */
 typedef
 void (*ecs_os_api_enable_high_timer_resolution_t)(
@@ -2707,6 +2754,11 @@ typedef struct ecs_os_api_t {
 
     void *log_out_;                                /**< File used for logging output (type is FILE*)
                                                     * (hint, log_ decides where to write) */
+
+    /* Callbacks added after the initial layout are appended at the end, so
+     * that existing fields keep their offsets. */
+    ecs_os_api_parallel_for_t parallel_for_;       /**< parallel_for callback. */
+    ecs_os_api_sleep_until_t sleep_until_;         /**< sleep_until callback. */
 } ecs_os_api_t;
 
 /** Static OS API variable with configured callbacks. */
@@ -2862,6 +2914,7 @@ void ecs_os_set_api_defaults(void);
 /* Tasks */
 #define ecs_os_task_new(callback, param) ecs_os_api.task_new_(callback, param)
 #define ecs_os_task_join(thread) ecs_os_api.task_join_(thread)
+#define ecs_os_parallel_for(job, ctx, count) ecs_os_api.parallel_for_(job, ctx, count)
 
 /* Atomic increment / decrement */
 #define ecs_os_ainc(value) ecs_os_api.ainc_(value)
@@ -2884,6 +2937,7 @@ void ecs_os_set_api_defaults(void);
 
 /* Time */
 #define ecs_os_sleep(sec, nanosec) ecs_os_api.sleep_(sec, nanosec)
+#define ecs_os_sleep_until(deadline) ecs_os_api.sleep_until_(deadline)
 #define ecs_os_now() ecs_os_api.now_()
 #define ecs_os_get_time(time_out) ecs_os_api.get_time_(time_out)
 
@@ -3025,11 +3079,13 @@ void ecs_os_strset(
 #define ecs_os_perf_trace_pop(name)
 #endif
 
+FLECS_API
 void ecs_os_perf_trace_push_(
     const char *file,
     size_t line,
     const char *name);
 
+FLECS_API
 void ecs_os_perf_trace_pop_(
     const char *file,
     size_t line,
@@ -3105,6 +3161,10 @@ bool ecs_os_has_threading(void);
 FLECS_API
 bool ecs_os_has_task_support(void);
 
+/** Is the parallel_for function available? */
+FLECS_API
+bool ecs_os_has_parallel_for(void);
+
 /** Are time functions available? */
 FLECS_API
 bool ecs_os_has_time(void);
@@ -3907,6 +3967,11 @@ typedef struct ecs_query_iter_t {
 
     ecs_query_op_profile_t *profile;
 
+    /* Toggle row mask (EcsQueryToggleMask) */
+    const ecs_table_t *row_mask_table;        /* Table for which mask was computed */
+    ecs_flags64_t row_mask;                   /* Matching rows, starting at row_mask_offset */
+    int32_t row_mask_offset;                  /* Table row of first bit in row_mask */
+
     int16_t op;                               /* Currently iterated query plan operation (index into ops) */
     bool iter_single_group;
 } ecs_query_iter_t;
@@ -4470,12 +4535,15 @@ void* flecs_hashmap_next_(
 extern "C" {
 #endif
 
-/** Record for entity index. */
+/** Record for entity index. 
+ * Fields used by liveliness checks and component lookups are stored first, so
+ * that they are on the same cache line. */
 struct ecs_record_t {
-    ecs_component_record_t *cr;               /**< component record to (*, entity) for target entities */
     ecs_table_t *table;                        /**< Identifies a type (and table) in world */
     uint32_t row;                              /**< Table row of the entity */
-    int32_t dense;                             /**< Index in dense array of entity index */    
+    int32_t dense;                             /**< Index in dense array of entity index */
+    uint32_t generation;                       /**< Upper 32 bits of current entity id */
+    ecs_component_record_t *cr;               /**< component record to (*, entity) for target entities */
 };
 
 /** Header for table cache elements. */
@@ -5034,6 +5102,19 @@ struct ecs_iter_t {
  */
 #define EcsQueryDetectChanges         (1u << 8u)
 
+/** Return rows of toggle fields as row masks.
+ * Can be combined with other query flags on the ecs_query_desc_t::flags field.
+ * 
+ * By default a query with toggle fields returns one result per contiguous range
+ * of enabled rows, which can produce many small results when components are 
+ * toggled frequently. With this flag the query returns at most one result per
+ * block of 64 rows, which starts at the first matching row of the block. The
+ * rows in the result that match can be obtained with ecs_iter_get_row_mask().
+ * 
+ * \ingroup queries
+ */
+#define EcsQueryToggleMask            (1u << 9u)
+
 
 /** Used with ecs_query_init().
  * 
@@ -5130,6 +5211,26 @@ typedef struct ecs_observer_desc_t {
      * #EcsOnAdd `Position` would match all existing instances of `Position`. */
     bool yield_existing;
 
+    /** When set together with yield_existing, existing matches are not
+     * yielded while the observer is created, but incrementally at the end of
+     * each frame, for at most the specified number of seconds per frame. The
+     * entities that match when the observer is created are recorded, and are
+     * yielded in the order in which they were recorded. Entities that no
+     * longer match by the time they are yielded are skipped.
+     *
+     * If an event for an entity that hasn't been yielded yet arrives before
+     * the catch-up is done, the entity is yielded first, so that the observer
+     * never receives an event for an entity before its existing match.
+     * Remaining matches can also be yielded with ecs_observer_yield_run(). */
+    double yield_existing_time_budget;
+
+    /** Callback can be invoked from multiple threads at the same time. When
+     * set together with yield_existing, existing matches are yielded from
+     * worker threads if the world has multiple stages and the OS API provides
+     * parallel_for. Each thread invokes the callback with its own stage, so
+     * the callback must only use the world passed in the iterator. */
+    bool multi_threaded;
+
     /** Callback to invoke on an event, invoked when the observer matches. */
     ecs_iter_action_t callback;
 
@@ -5298,6 +5399,20 @@ typedef struct ecs_world_info_t {
                                        * to remove library prefixes of symbol
                                        * names (such as `Ecs`, `ecs_`) when
                                        * registering them as names. */
+
+    /* Fields added after the initial layout are appended at the end, so that
+     * existing fields keep their offsets. */
+    ecs_ftime_t frame_time_p50;       /**< Median time between frames, over recent frames */
+    ecs_ftime_t frame_time_p99;       /**< 99th percentile of time between frames, over recent frames */
+    ecs_ftime_t frame_time_max;       /**< Maximum time between frames, over recent frames */
+    ecs_ftime_t delete_time_total;    /**< Total time spent in cascading deletes */
+    ecs_ftime_t delete_time_last;     /**< Time spent in last cascading delete */
+    int32_t delete_queue_count;       /**< Number of entities queued by ecs_delete_incremental() */
+    int32_t table_pool_count;         /**< Number of empty tables with storage freed by table GC */
+    int64_t table_pool_hit_total;     /**< Number of times a table with storage freed by table GC was reused */
+    int64_t table_gc_delete_total;    /**< Number of tables deleted by table GC */
+    int64_t component_record_memory;  /**< Memory used by component records, including table lookup indices (bytes) */
+    int32_t observer_yield_count;     /**< Number of existing matches not yet yielded by incremental observers */
 } ecs_world_info_t;
 
 /** Type that contains information about a query group. */
@@ -5572,6 +5687,10 @@ FLECS_API extern const ecs_entity_t EcsOneOf;
 /** Mark a component as toggleable with ecs_enable_id(). */
 FLECS_API extern const ecs_entity_t EcsCanToggle;
 
+/** Track which rows of a component changed. 
+ * See ecs_iter_changed_rows(). */
+FLECS_API extern const ecs_entity_t EcsDirtyRows;
+
 /** Can be added to components to indicate it is a trait. Traits are components
  * and/or tags that are added to other components to modify their behavior.
  */
@@ -5996,6 +6115,27 @@ void ecs_set_target_fps(
     ecs_world_t *world,
     ecs_ftime_t fps);
 
+/** Enable precise frame pacing.
+ * By default ecs_progress() reaches the target FPS by sleeping in small
+ * intervals, which can overshoot the end of the frame by up to a scheduler
+ * tick. With precise frame pacing, frames are scheduled on fixed deadlines.
+ * ecs_progress() sleeps until shortly before the deadline, and spins for the
+ * remaining time. The spin time adapts to how much the OS oversleeps.
+ *
+ * Precise frame pacing reduces jitter in the time between frames at the cost
+ * of some CPU time spent spinning. It only has an effect when a target FPS is
+ * set. The distribution of frame times can be inspected with the
+ * frame_time_p50, frame_time_p99 and frame_time_max members of
+ * ecs_world_info_t.
+ *
+ * @param world The world.
+ * @param enable Whether to enable or disable precise frame pacing.
+ */
+FLECS_API
+void ecs_precise_frame_pacing(
+    ecs_world_t *world,
+    bool enable);
+
 /** Set default query flags. 
  * Set a default value for the ecs_filter_desc_t::flags field. Default flags
  * are applied in addition to the flags provided in the descriptor. For a
@@ -6291,6 +6431,86 @@ FLECS_API
 int32_t ecs_stage_get_id(
     const ecs_world_t *world);
 
+/** Add a (component) id to an entity from any thread.
+ * The ecs_async_* functions enqueue commands in a lock free queue that is 
+ * owned by the world, and can be called from any thread without owning a 
+ * stage. This is useful for threads that are not managed by Flecs, like
+ * network or asset loading threads. 
+ * 
+ * Commands are applied in the order in which they were enqueued when the world
+ * is merged, which happens at the start of each frame and after each sync 
+ * point in ecs_progress(), or when ecs_merge() is called. Commands for 
+ * entities that are no longer alive when the queue is drained are ignored.
+ * 
+ * The lock free queue has a fixed capacity (see FLECS_ASYNC_QUEUE_SIZE). When 
+ * it is full, commands are stored in an overflow queue that is protected by a
+ * mutex until the queue is drained.
+ *
+ * @param world The world.
+ * @param entity The entity.
+ * @param id The id to add.
+ */
+FLECS_API
+void ecs_async_add_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id);
+
+/** Remove a (component) id from an entity from any thread.
+ * See ecs_async_add_id().
+ *
+ * @param world The world.
+ * @param entity The entity.
+ * @param id The id to remove.
+ */
+FLECS_API
+void ecs_async_remove_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id);
+
+/** Set the value of a component from any thread.
+ * See ecs_async_add_id(). The value is copied with memcpy into storage that is
+ * owned by the queue, which means this function can only be used for 
+ * components that can be trivially copied.
+ *
+ * @param world The world.
+ * @param entity The entity.
+ * @param id The id of the component to set.
+ * @param size The size of the pointed-to value.
+ * @param ptr The pointer to the value.
+ */
+FLECS_API
+void ecs_async_set_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id,
+    size_t size,
+    const void *ptr);
+
+/** Delete an entity from any thread.
+ * See ecs_async_add_id().
+ *
+ * @param world The world.
+ * @param entity The entity to delete.
+ */
+FLECS_API
+void ecs_async_delete(
+    ecs_world_t *world,
+    ecs_entity_t entity);
+
+/** Enqueue an event from any thread.
+ * See ecs_async_add_id(). The event must have an entity, and cannot have a
+ * payload. Events are emitted when the queue is drained.
+ *
+ * @param world The world.
+ * @param desc The event descriptor.
+ */
+FLECS_API
+void ecs_async_enqueue(
+    ecs_world_t *world,
+    const ecs_event_desc_t *desc);
+
 /** @} */
 
 /**
@@ -6505,6 +6725,71 @@ int32_t ecs_delete_empty_tables(
     ecs_world_t *world,
     const ecs_delete_empty_tables_desc_t *desc);
 
+/** Used with ecs_set_table_gc(). */
+typedef struct ecs_table_gc_desc_t {
+    /** Free storage of tables that have been empty for this number of frames.
+     * The table itself is kept, so that it can be reused without having to be
+     * created again. */
+    int32_t clear_frames;
+
+    /** Delete tables that have been empty for this number of frames. */
+    int32_t delete_frames;
+
+    /** Amount of time the table GC is allowed to spend per frame. */
+    double time_budget_seconds;
+} ecs_table_gc_desc_t;
+
+/** Configure table garbage collection.
+ * Applications that use lots of relationships can create and delete large 
+ * numbers of tables that are only used for a short amount of time. When table
+ * GC is enabled, a part of the tables is visited at the end of each frame
+ * (see ecs_frame_end()), until the time budget is exceeded. Tables that have 
+ * been empty for clear_frames frames have their storage freed, but are kept
+ * so that they can be reused when entities are added to them. Tables that 
+ * have been empty for delete_frames frames are deleted.
+ *
+ * The number of tables that are kept with freed storage, the number of times
+ * such a table was reused and the number of tables deleted by the table GC are
+ * reported by the table_pool_count, table_pool_hit_total and 
+ * table_gc_delete_total members of ecs_world_info_t.
+ *
+ * Applications should not hold on to pointers of empty tables while the table
+ * GC is enabled. A NULL desc or a desc with zero clear_frames and 
+ * delete_frames disables table GC.
+ *
+ * @param world The world.
+ * @param desc Table GC configuration.
+ */
+FLECS_API
+void ecs_set_table_gc(
+    ecs_world_t *world,
+    const ecs_table_gc_desc_t *desc);
+
+/** Enable or disable the union row index.
+ * Union relationships store the target for each entity in a linked list, which
+ * makes queries like (Movement, Walking) iterate matching entities one by one.
+ * When the union row index is enabled, queries that select entities by union
+ * target instead use a row bitmap per target that is built for each table with
+ * the union relationship. This returns matching entities as contiguous ranges
+ * of table rows, and finds them with word-level bit scans.
+ *
+ * The row bitmaps of a table are built lazily when the table is queried, and
+ * rebuilt after the table or one of its union targets changed. The index is 
+ * not used while the world is in multi threaded readonly mode, in which case
+ * queries fall back to iterating the linked list.
+ *
+ * Enabling the index changes the order in which union query results are
+ * returned, as results are ordered by table and row instead of by when the
+ * target was last set.
+ *
+ * @param world The world.
+ * @param enable Whether to enable or disable the union row index.
+ */
+FLECS_API
+void ecs_enable_union_index(
+    ecs_world_t *world,
+    bool enable);
+
 /** Get world from poly.
  *
  * @param poly A pointer to a poly object.
@@ -6748,6 +7033,11 @@ const ecs_entity_t* ecs_bulk_init(
  * This operation is the same as ecs_new_w_id(), but creates N entities
  * instead of one.
  *
+ * When the id is an (IsA, prefab) pair, this instantiates N copies of the 
+ * prefab. The children of the prefab are created for all instances in a single
+ * pass over the prefab hierarchy, which is faster than instantiating the 
+ * prefab N times with ecs_new_w_pair().
+ *
  * @param world The world.
  * @param id The component id to create the entities with.
  * @param count The number of entities to create.
@@ -6794,6 +7084,33 @@ void ecs_delete(
     ecs_world_t *world,
     ecs_entity_t entity);
 
+/** Delete multiple entities.
+ * This operation has the same effect as calling ecs_delete() for each of the
+ * provided entities, but is faster when many entities are deleted from the
+ * same table. Rows of deleted entities are moved to the end of their table,
+ * after which OnRemove observers and hooks are invoked once for the entire
+ * range and the table is truncated.
+ *
+ * Entities that are used in ids (for example as relationship target) are
+ * deleted one at a time, before the other entities. Entities that are not 
+ * alive are ignored. Deleted entities may be removed from their table in a
+ * different order than the order in which they are provided, which means 
+ * the order of the remaining entities in the table can be different from 
+ * calling ecs_delete() for each entity.
+ *
+ * When called while deferred, the operation enqueues a delete command for 
+ * each entity. Consecutive delete commands are merged with this operation.
+ *
+ * @param world The world.
+ * @param count The number of entities.
+ * @param entities The entities to delete.
+ */
+FLECS_API
+void ecs_delete_many(
+    ecs_world_t *world,
+    int32_t count,
+    const ecs_entity_t *entities);
+
 /** Delete all entities with the specified id.
  * This will delete all entities (tables) that have the specified id. The id
  * may be a wildcard and/or a pair.
@@ -6806,6 +7123,78 @@ void ecs_delete_with(
     ecs_world_t *world,
     ecs_id_t id);
 
+/** Queue entity for incremental deletion.
+ * This operation queues an entity and its children to be deleted by 
+ * ecs_delete_incremental_run(). Deleting an entity with many (nested) children
+ * can take a long time. Deleting the subtree incrementally spreads this cost
+ * out over multiple calls, for example across frames.
+ *
+ * Subtrees are deleted depth first, so that entities are only deleted after
+ * their children have been deleted. Entities without children are deleted in
+ * batches with ecs_delete_many(). Entities remain alive until they are deleted
+ * by ecs_delete_incremental_run(). Entities that are deleted before then are
+ * ignored.
+ *
+ * If entity is 0, all root entities are queued, except for modules and
+ * entities that are used as component, tag or relationship. This can be used
+ * to delete the contents of a world before calling ecs_fini(), which then only
+ * has to delete the remaining entities. If the world is not used by any other
+ * thread, ecs_delete_incremental_run() can be called from a background thread.
+ *
+ * The number of queued entities is reported by the delete_queue_count member
+ * of ecs_world_info_t. Entities that are still queued when the world is
+ * deleted are deleted by ecs_fini().
+ *
+ * @param world The world.
+ * @param entity The entity to delete, or 0 to queue all root entities.
+ */
+FLECS_API
+void ecs_delete_incremental(
+    ecs_world_t *world,
+    ecs_entity_t entity);
+
+/** Delete entities queued by ecs_delete_incremental().
+ * This operation deletes queued entities until the queue is empty or the time
+ * budget is exceeded. A time budget of 0 deletes all queued entities. At least
+ * one batch of entities is processed per call, regardless of the budget.
+ *
+ * The operation cannot be called while the world is deferred.
+ *
+ * @param world The world.
+ * @param time_budget_seconds Amount of time operation is allowed to spend.
+ * @return Number of entities that are still queued, 0 if done.
+ */
+FLECS_API
+int32_t ecs_delete_incremental_run(
+    ecs_world_t *world,
+    double time_budget_seconds);
+
+/** Enable or disable parallel delete.
+ * When parallel delete is enabled, cascading deletes (such as deleting a 
+ * parent with many children, or ecs_delete_with()) first empty all tables that
+ * are deleted. Destructors of the deleted components are then invoked in
+ * parallel with ecs_os_parallel_for(), after which the component storage is 
+ * released in bulk. OnRemove observers and on_remove hooks still run on the 
+ * calling thread, before any destructors are invoked.
+ *
+ * Destructors of components that are deleted while parallel delete is enabled
+ * must be thread safe, and are invoked after the entity has been deleted. 
+ * If the OS API does not provide a parallel_for implementation, or if the 
+ * world has less than two threads (see ecs_set_threads()), destructors run on
+ * the calling thread while tables are emptied, as if parallel delete was not
+ * enabled.
+ *
+ * The time spent in cascading deletes is reported in the delete_time_total 
+ * and delete_time_last members of ecs_world_info_t.
+ *
+ * @param world The world.
+ * @param enable Whether to enable or disable parallel delete.
+ */
+FLECS_API
+void ecs_enable_parallel_delete(
+    ecs_world_t *world,
+    bool enable);
+
 /** Set child order for parent with OrderedChildren.
  * If the parent has the OrderedChildren trait, the order of the children 
  * will be updated to the order in the specified children array. The operation
@@ -7058,6 +7447,32 @@ FLECS_ALWAYS_INLINE const void* ecs_get_id(
     ecs_entity_t entity,
     ecs_id_t id);
 
+/** Get immutable pointers to a component for multiple entities.
+ * This operation is equivalent to calling ecs_get_id() for each entity, but
+ * is faster for large batches of entities that are not in the cache. Entity
+ * records are prefetched ahead of time, and the component column is only 
+ * looked up when the table changes between subsequent entities. Batches in 
+ * which entities from the same table are grouped together benefit the most.
+ * 
+ * The order of the pointers in the output array matches the order of the
+ * entities. Pointers for entities without the component are set to NULL.
+ *
+ * @param world The world.
+ * @param count The number of entities.
+ * @param entities The entities.
+ * @param id The id of the component to get.
+ * @param out Array with count elements that is populated with the pointers.
+ *
+ * @see ecs_get_id()
+ */
+FLECS_API
+void ecs_get_many_id(
+    const ecs_world_t *world,
+    int32_t count,
+    const ecs_entity_t *entities,
+    ecs_id_t id,
+    const void **out);
+
 /** Get a mutable pointer to a component.
  * This operation obtains a mutable pointer to the requested component. The
  * operation accepts the component entity id.
@@ -7854,6 +8269,28 @@ void ecs_get_path_w_sep_buf(
     ecs_strbuf_t *buf,
     bool escape);
 
+/** Enable or disable the path cache.
+ * When the path cache is enabled, the full paths of named entities are stored
+ * the first time they are requested or looked up. Subsequent calls to 
+ * ecs_get_path() copy the cached string instead of walking the parents of the
+ * entity, and ecs_lookup() resolves a cached full path with a single hash 
+ * lookup.
+ *
+ * The cache only applies to paths from the root that use the default separator
+ * and no prefix. Cached paths are invalidated when an entity or one of its 
+ * parents is renamed, reparented or deleted. Paths are not added to the cache
+ * while the world is running systems on multiple threads.
+ *
+ * Disabling the cache frees all cached paths.
+ *
+ * @param world The world.
+ * @param enable Whether to enable or disable the path cache.
+ */
+FLECS_API
+void ecs_enable_path_cache(
+    ecs_world_t *world,
+    bool enable);
+
 /** Find or create entity from path.
  * This operation will find or create an entity from a path, and will create any
  * intermediate entities if required. If the entity already exists, no entities
@@ -8439,6 +8876,49 @@ FLECS_API
 void ecs_query_fini(
     ecs_query_t *query);
 
+/** Get query for expression from the query plan cache.
+ * This operation returns a query for the provided query expression. The first
+ * time an expression is used, a query is created and stored in a cache that
+ * belongs to the world. Subsequent calls with the same expression return the
+ * cached query, which means the expression doesn't need to be parsed, 
+ * validated and compiled again. This is useful for applications that 
+ * repeatedly create short-lived queries from the same expressions, like tools
+ * that poll for data.
+ *
+ * Expressions that only differ in whitespace share the same query. Names in
+ * the expression are resolved relative to the current scope (see 
+ * ecs_set_scope()), which is part of the cache key.
+ *
+ * The cache stores up to FLECS_QUERY_PLAN_CACHE_SIZE queries. When the cache
+ * is full, the least recently used query is deleted. Cached queries are also
+ * deleted when an entity used by the query is deleted.
+ *
+ * The returned query is owned by the cache and must not be deleted with
+ * ecs_query_fini(). Because queries can be evicted, an application should not
+ * store the returned query, and should use it before calling this operation
+ * again or before deleting entities.
+ *
+ * This operation cannot be called while the world is running on multiple
+ * threads.
+ *
+ * @param world The world.
+ * @param expr The query expression.
+ * @return The query, or NULL if the expression is invalid.
+ */
+FLECS_API
+ecs_query_t* ecs_query_plan_cache_get(
+    ecs_world_t *world,
+    const char *expr);
+
+/** Delete all queries in the query plan cache.
+ * See ecs_query_plan_cache_get().
+ *
+ * @param world The world.
+ */
+FLECS_API
+void ecs_query_plan_cache_clear(
+    ecs_world_t *world);
+
 /** Find variable index.
  * This operation looks up the index of a variable in the query. This index can
  * be used in operations like ecs_iter_set_var() and ecs_iter_get_var().
@@ -8936,6 +9416,27 @@ const ecs_observer_t* ecs_observer_get(
     const ecs_world_t *world,
     ecs_entity_t observer);
 
+/** Yield existing matches of incremental observers.
+ * This operation yields the existing matches of observers created with
+ * yield_existing_time_budget that haven't been yielded yet. Observers are
+ * processed in the order in which they were created. The remaining matches of
+ * each observer are also yielded at the end of each frame by ecs_frame_end(),
+ * within the time budget of the observer. This operation can be used when the
+ * application doesn't call ecs_progress(), or to finish yielding early.
+ *
+ * The number of remaining matches is reported by the observer_yield_count
+ * member of ecs_world_info_t. This operation may not be called while the world
+ * is deferred.
+ *
+ * @param world The world.
+ * @param time_budget_seconds Maximum time to spend, or 0 to yield all matches.
+ * @return The number of matches that have not been yielded yet.
+ */
+FLECS_API
+int32_t ecs_observer_yield_run(
+    ecs_world_t *world,
+    double time_budget_seconds);
+
 /** @} */
 
 /**
@@ -9221,6 +9722,87 @@ FLECS_API
 bool ecs_iter_changed(
     ecs_iter_t *it);
 
+/** Get mask with matching rows for current iterator result.
+ * This operation must be used in combination with a query that has the
+ * EcsQueryToggleMask flag. Bit N of the returned mask is set when the entity at
+ * index N in the current result matches the toggle fields of the query. Results
+ * are never larger than 64 rows when the mask is used, and the first row of a
+ * result always matches:
+ *
+ * @code
+ * ecs_flags64_t mask = ecs_iter_get_row_mask(it);
+ * for (int32_t i = 0; i < it->count; i ++) {
+ *   if (mask & (1llu << i)) { ... }
+ * }
+ * @endcode
+ *
+ * If the current result has no rows that were filtered by a toggle field, all
+ * bits for the rows in the result are set.
+ *
+ * @param it The iterator.
+ * @return Mask with matching rows.
+ */
+FLECS_API
+ecs_flags64_t ecs_iter_get_row_mask(
+    const ecs_iter_t *it);
+
+/** Get the next range of changed rows for a field.
+ * This operation returns which entities in the current result have changed
+ * values for a field, for components that have the DirtyRows trait. For 
+ * these components each table keeps a bit per row that is set when the
+ * component is written for the entity with ecs_set(), ecs_modified(), or by a
+ * query with [out] or [inout] terms. Rows are also marked as changed when an
+ * entity is added to the table, or when an entity moves to a different row.
+ *
+ * The offset parameter is the index in the current result from which to start
+ * searching. When the operation returns true, offset and count are set to a 
+ * range of consecutive changed rows. The operation should be invoked in a 
+ * loop like this:
+ *
+ * @code
+ * int32_t offset = 0, count;
+ * while (ecs_iter_changed_rows(it, 0, &offset, &count)) {
+ *   for (int32_t i = offset; i < offset + count; i ++) { ... }
+ *   offset += count;
+ * }
+ * @endcode
+ *
+ * If the component doesn't have the DirtyRows trait, all rows are returned
+ * as changed. If the field is shared, all rows are returned when the shared
+ * component changed.
+ *
+ * Changed rows are not reset automatically, and must be acknowledged with
+ * ecs_iter_clear_changed_rows(). The bits are shared by all queries, which
+ * means that this mechanism is intended for a single consumer per component.
+ * A query that consumes changes should not write the field ([in]), as that
+ * marks all iterated rows as changed.
+ *
+ * @param it The iterator.
+ * @param index The index of the field.
+ * @param offset In: index from which to search, out: first changed row.
+ * @param count Out: number of consecutive changed rows.
+ * @return True if changed rows were found, false if not.
+ */
+FLECS_API
+bool ecs_iter_changed_rows(
+    const ecs_iter_t *it,
+    int8_t index,
+    int32_t *offset,
+    int32_t *count);
+
+/** Acknowledge changed rows for a field.
+ * This operation resets the changed state of the rows in the current result
+ * for a field. Fields with a shared source are not reset. 
+ * See ecs_iter_changed_rows().
+ *
+ * @param it The iterator.
+ * @param index The index of the field.
+ */
+FLECS_API
+void ecs_iter_clear_changed_rows(
+    const ecs_iter_t *it,
+    int8_t index);
+
 /** Convert iterator to string.
  * Prints the contents of an iterator to a string. Useful for debugging and/or
  * testing the output of an iterator.
@@ -10486,6 +11068,20 @@ int ecs_value_move_ctor(
     ecs_remove_id(world, subject, ecs_pair(first, second))
 
 
+#define ecs_async_add(world, entity, T)\
+    ecs_async_add_id(world, entity, ecs_id(T))
+
+#define ecs_async_add_pair(world, subject, first, second)\
+    ecs_async_add_id(world, subject, ecs_pair(first, second))
+
+
+#define ecs_async_remove(world, entity, T)\
+    ecs_async_remove_id(world, entity, ecs_id(T))
+
+#define ecs_async_remove_pair(world, subject, first, second)\
+    ecs_async_remove_id(world, subject, ecs_pair(first, second))
+
+
 #define ecs_auto_override(world, entity, T)\
     ecs_auto_override_id(world, entity, ecs_id(T))
 
@@ -10511,6 +11107,9 @@ int ecs_value_move_ctor(
 #define ecs_set(world, entity, component, ...)\
     ecs_set_id(world, entity, ecs_id(component), sizeof(component), &(component)__VA_ARGS__)
 
+#define ecs_async_set(world, entity, component, ...)\
+    ecs_async_set_id(world, entity, ecs_id(component), sizeof(component), &(component)__VA_ARGS__)
+
 #define ecs_set_pair(world, subject, First, second, ...)\
     ecs_set_id(world, subject,\
         ecs_pair(ecs_id(First), second),\
@@ -10538,6 +11137,9 @@ int ecs_value_move_ctor(
 #define ecs_get(world, entity, T)\
     (ECS_CAST(const T*, ecs_get_id(world, entity, ecs_id(T))))
 
+#define ecs_get_many(world, count, entities, T, out)\
+    ecs_get_many_id(world, count, entities, ecs_id(T), out)
+
 #define ecs_get_pair(world, subject, First, second)\
     (ECS_CAST(const First*, ecs_get_id(world, subject,\
         ecs_pair(ecs_id(First), second))))
@@ -12606,6 +13208,20 @@ typedef struct ecs_pipeline_desc_t {
      * pipeline query works.
     */
     ecs_query_desc_t query;
+
+    /** Run independent systems concurrently.
+     * By default each multi threaded system is ran on all worker threads, and
+     * systems run one after another. When enabled, the pipeline builds a 
+     * dependency graph from the in/out annotations of system terms. Multi
+     * threaded systems between the same two merges that don't write 
+     * components accessed by each other are then distributed across worker
+     * threads, where each system runs on a single thread.
+     *
+     * Systems that conflict still run in the order of the pipeline query. Since
+     * scheduling relies on term annotations, systems that access components
+     * that aren't in their query (for example with ecs_get()) should add
+     * these components to the query with the InOutNone or In annotations. */
+    bool concurrent;
 } ecs_pipeline_desc_t;
 
 /** Create a custom pipeline.
@@ -12734,6 +13350,12 @@ void ecs_set_threads(
  * This function is useful for multithreading world updates using an external
  * asynchronous job system rather than long running threads by providing the APIs
  * to create tasks for your job system and then wait on their conclusion.
+ *
+ * If the OS API provides a parallel_for callback, it is used instead of
+ * task_new and task_join. Tasks are then not created per update, and the 
+ * OS API decides on which threads to run the work. The builtin OS API 
+ * implementation provides a parallel_for that runs on a persistent pool of
+ * threads, unless the application provides its own task_new callback.
  * The operation may be called multiple times to reconfigure the number of task threads
  * used, but never while running a system / pipeline.
  * Calling ecs_set_task_threads() will also end the use of threads setup with
@@ -12756,6 +13378,34 @@ FLECS_API
 bool ecs_using_task_threads(
     ecs_world_t *world);
 
+/** Iterate a query on all worker threads.
+ * This operation runs the provided callback for the results of a query, and
+ * distributes the matched tables and rows across the worker threads created
+ * with ecs_set_threads() or ecs_set_task_threads(), in the same way as a
+ * multi threaded system. The calling thread runs the first share of the
+ * results. The operation returns after all threads are done.
+ *
+ * The callback is invoked with an iterator whose world is the stage of the
+ * thread that runs it. Operations enqueued on it->world are deferred, and
+ * are merged before the function returns. The ctx parameter is passed to the
+ * callback as it->ctx.
+ *
+ * If no worker threads are configured, the query is iterated on the calling
+ * thread. The operation cannot be called while the world is in readonly mode,
+ * which means that it cannot be called from a system.
+ *
+ * @param world The world.
+ * @param query The query to iterate.
+ * @param callback The callback to invoke for each result.
+ * @param ctx User context passed to the callback.
+ */
+FLECS_API
+void ecs_query_parallel_each(
+    ecs_world_t *world,
+    ecs_query_t *query,
+    ecs_iter_action_t callback,
+    void *ctx);
+
 ////////////////////////////////////////////////////////////////////////////////
 //// Module
 ////////////////////////////////////////////////////////////////////////////////
@@ -13124,6 +13774,10 @@ void FlecsSystemImport(
  * 
  * When the addon is imported as module, statistics are tracked for each frame,
  * second, minute, hour, day and week with 60 datapoints per tier.
+ *
+ * Collection can be made cheaper with the EcsStatsSettings component, which
+ * can reduce the sample rate and replace the history tiers with compact
+ * statistics that only store a small window of averages per metric.
  */
 
 #ifdef FLECS_STATS
@@ -13179,6 +13833,7 @@ typedef struct ecs_world_stats_t {
     struct {
         ecs_metric_t count;               /**< Number of entities */
         ecs_metric_t not_alive_count;     /**< Number of not alive (recyclable) entity ids */
+        ecs_metric_t delete_queue_count;  /**< Number of entities queued by ecs_delete_incremental() */
     } entities;
 
     /* Component ids */
@@ -13197,6 +13852,9 @@ typedef struct ecs_world_stats_t {
         ecs_metric_t empty_count;          /**< Number of empty tables */
         ecs_metric_t create_count;         /**< Number of times table has been created */
         ecs_metric_t delete_count;         /**< Number of times table has been deleted */
+        ecs_metric_t pool_count;           /**< Number of empty tables with storage freed by table GC */
+        ecs_metric_t pool_hit_count;       /**< Number of times a table with storage freed by table GC was reused */
+        ecs_metric_t gc_delete_count;      /**< Number of tables deleted by table GC */
     } tables;
 
     /* Queries & events */
@@ -13204,6 +13862,7 @@ typedef struct ecs_world_stats_t {
         ecs_metric_t query_count;          /**< Number of queries */
         ecs_metric_t observer_count;       /**< Number of observers */
         ecs_metric_t system_count;         /**< Number of systems */
+        ecs_metric_t observer_yield_count; /**< Number of existing matches not yet yielded by incremental observers */
     } queries;
 
     /* Commands */
@@ -13243,6 +13902,9 @@ typedef struct ecs_world_stats_t {
         ecs_metric_t rematch_time;         /**< Time spent on rematching. */
         ecs_metric_t fps;                  /**< Frames per second. */
         ecs_metric_t delta_time;           /**< Delta_time. */
+        ecs_metric_t frame_time_p50;       /**< Median time between frames. */
+        ecs_metric_t frame_time_p99;       /**< 99th percentile of time between frames. */
+        ecs_metric_t frame_time_max;       /**< Maximum time between frames. */
     } performance;
 
     struct {
@@ -13335,6 +13997,35 @@ typedef struct ecs_pipeline_stats_t {
     int32_t rebuild_count;       /**< Number of times pipeline has rebuilt */
 } ecs_pipeline_stats_t;
 
+/** Compact statistics for a single resource.
+ * Compact statistics store one value per metric for each sample in a window
+ * of configurable size, instead of the avg/min/max history tiers of regular
+ * statistics. Counters are delta encoded: a sample stores the increase since
+ * the previous sample, and only the last absolute value is kept. Gauges store
+ * the measured value.
+ *
+ * Metrics are stored in the order they appear in the statistics type, see
+ * ECS_STATS_METRIC_INDEX. For systems the metrics of ecs_system_stats_t are
+ * followed by the metrics of ecs_query_stats_t.
+ */
+typedef struct ecs_compact_stats_t {
+    int32_t metric_count;        /**< Number of metrics in a sample */
+    int32_t window;              /**< Number of samples in window */
+    int32_t t;                   /**< Position of last sample in window */
+    int32_t count;               /**< Number of recorded samples */
+    double *values;              /**< Last absolute value of counters */
+    ecs_float_t *samples;        /**< Samples (window * metric_count) */
+} ecs_compact_stats_t;
+
+/** Index of metric in compact statistics.
+ * 
+ * @param T The statistics type (e.g. ecs_world_stats_t).
+ * @param member The metric member (e.g. performance.frame_time).
+ */
+#define ECS_STATS_METRIC_INDEX(T, member)\
+    ((int32_t)((offsetof(T, member) - offsetof(T, first_) - sizeof(int64_t)) /\
+        sizeof(ecs_metric_t)))
+
 /** Get world statistics.
  *
  * @param world The world.
@@ -13523,11 +14214,48 @@ void ecs_metric_copy(
     int32_t dst,
     int32_t src);
 
+/** Get sample from compact statistics.
+ *
+ * @param stats The compact statistics.
+ * @param metric Index of the metric (see ECS_STATS_METRIC_INDEX).
+ * @param age Age of the sample, where 0 is the last sample.
+ * @return The sample value, or 0 if the sample does not exist.
+ */
+FLECS_API
+ecs_float_t ecs_compact_stats_sample(
+    const ecs_compact_stats_t *stats,
+    int32_t metric,
+    int32_t age);
+
+/** Get average of samples in compact statistics.
+ *
+ * @param stats The compact statistics.
+ * @param metric Index of the metric (see ECS_STATS_METRIC_INDEX).
+ * @return Average of the recorded samples.
+ */
+FLECS_API
+ecs_float_t ecs_compact_stats_avg(
+    const ecs_compact_stats_t *stats,
+    int32_t metric);
+
+/** Get last absolute value of counter in compact statistics.
+ *
+ * @param stats The compact statistics.
+ * @param metric Index of the metric (see ECS_STATS_METRIC_INDEX).
+ * @return Absolute value of the counter at the last sample.
+ */
+FLECS_API
+double ecs_compact_stats_value(
+    const ecs_compact_stats_t *stats,
+    int32_t metric);
+
 FLECS_API extern ECS_COMPONENT_DECLARE(FlecsStats);        /**< Flecs stats module. */
 FLECS_API extern ECS_COMPONENT_DECLARE(EcsWorldStats);     /**< Component id for EcsWorldStats. */
 FLECS_API extern ECS_COMPONENT_DECLARE(EcsWorldSummary);   /**< Component id for EcsWorldSummary. */
 FLECS_API extern ECS_COMPONENT_DECLARE(EcsSystemStats);    /**< Component id for EcsSystemStats. */
 FLECS_API extern ECS_COMPONENT_DECLARE(EcsPipelineStats);  /**< Component id for EcsPipelineStats. */
+FLECS_API extern ECS_COMPONENT_DECLARE(EcsStatsSettings);  /**< Component id for EcsStatsSettings. */
+FLECS_API extern ECS_COMPONENT_DECLARE(EcsCompactStats);   /**< Component id for EcsCompactStats. */
 
 FLECS_API extern ecs_entity_t EcsPeriod1s;                 /**< Tag used for metrics collected in last second. */
 FLECS_API extern ecs_entity_t EcsPeriod1m;                 /**< Tag used for metrics collected in last minute. */
@@ -13578,10 +14306,92 @@ typedef struct {
     int64_t frame_count;        /**< Number of frames processed */
     int64_t command_count;      /**< Number of commands processed */
 
+    /* Statistics overhead */
+    double stats_time_total;    /**< Total time spent collecting statistics */
+    double stats_time_last;     /**< Time spent collecting statistics in last frame */
+    int64_t stats_memory;       /**< Memory used by statistics (bytes) */
+
+    /* Component records */
+    int32_t component_record_count;  /**< Number of component records */
+    int32_t pair_record_count;       /**< Number of component records for pairs */
+    int64_t component_record_memory; /**< Memory used by component records (bytes) */
+    double component_record_memory_avg; /**< Average memory used per component record (bytes) */
+
     /* Build info */
     ecs_build_info_t build_info; /**< Build info */
 } EcsWorldSummary;
 
+/** Component with settings for the stats module.
+ * The settings are stored as singleton, and can be modified with 
+ * ecs_singleton_set() to reduce the cost of collecting statistics:
+ *
+ * @code
+ * ecs_singleton_set(world, EcsStatsSettings, {
+ *   .sample_interval = 10, .compact = true, .compact_window = 16
+ * });
+ * @endcode
+ *
+ * In compact mode the history tiers (EcsPeriod1s ... EcsPeriod1w) of world and
+ * system statistics are replaced with EcsCompactStats, and pipeline statistics
+ * are not collected.
+ */
+typedef struct {
+    int32_t sample_interval;    /**< Collect statistics every N frames (default 1) */
+    bool compact;               /**< Collect compact statistics instead of history tiers */
+    int32_t compact_window;     /**< Number of samples in compact statistics (default 60) */
+} EcsStatsSettings;
+
+/** Component that stores compact statistics.
+ * Added to EcsWorld as pair with the statistics kind, for example
+ * (EcsCompactStats, EcsSystemStats). The map is indexed by the monitored 
+ * resource, which is EcsWorld for world statistics.
+ */
+typedef struct {
+    ecs_map_t stats;            /**< map<entity, ecs_compact_stats_t*> */
+} EcsCompactStats;
+
+/** Start the profiler.
+ * The profiler records the zones reported by the perf trace hooks of the OS
+ * API (see ecs_os_perf_trace_push()) for systems, merges, observers, query
+ * rematching and sorting. Events are stored in a fixed size ring buffer
+ * which overwrites the oldest events when it is full. Zones are only reported
+ * when the library is built with FLECS_PERF_TRACE.
+ *
+ * The profiler is global and records events from all threads and worlds.
+ * Previously installed perf trace hooks are still invoked.
+ *
+ * @param capacity Number of events in the ring buffer (0 for default).
+ */
+FLECS_API
+void ecs_profiler_start(
+    int32_t capacity);
+
+/** Stop the profiler.
+ * This restores the previous perf trace hooks and frees recorded events.
+ */
+FLECS_API
+void ecs_profiler_stop(void);
+
+/** Test if the profiler is running.
+ *
+ * @return Whether the profiler is running.
+ */
+FLECS_API
+bool ecs_profiler_is_running(void);
+
+/** Discard recorded profiler events. */
+FLECS_API
+void ecs_profiler_clear(void);
+
+/** Serialize recorded profiler events to Chrome trace JSON.
+ * The result can be loaded in chrome://tracing or Perfetto. Events of zones
+ * that began before the oldest event in the ring buffer are omitted.
+ *
+ * @return JSON string with the recorded events (must be freed).
+ */
+FLECS_API
+char* ecs_profiler_to_chrome_trace(void);
+
 /** Stats module import function.
  * Usage:
  * @code
@@ -13775,6 +14585,29 @@ ecs_entity_t ecs_metric_init(
 #define ecs_metric(world, ...)\
     ecs_metric_init(world, &(ecs_metric_desc_t) __VA_ARGS__ )
 
+/** Serialize metrics to the Prometheus text exposition format.
+ * The output contains a metric family for each metric, with a sample for each
+ * metric instance. Samples are labeled with the path of the metric source. For
+ * metrics that track relationship targets, a sample is added for each target.
+ * Gauge metrics are exported as gauge, all other kinds are exported as counter.
+ * Metric names are created from the metric path, for example a metric called
+ * "metrics.position_y" is exported as "metrics_position_y".
+ *
+ * Values are read directly from the metric instances. Labels are created once
+ * per instance and reused by subsequent calls, which means that renaming the
+ * source of an existing metric instance does not update its label.
+ *
+ * The returned string is owned by the world, and is valid until the next call
+ * to this function or until the world is deleted. The memory of the string is
+ * reused between calls.
+ *
+ * @param world The world.
+ * @return The serialized metrics, or NULL if the module is not imported.
+ */
+FLECS_API
+const char* ecs_metrics_to_prometheus(
+    ecs_world_t *world);
+
 /** Metrics module import function.
  * Usage:
  * @code
@@ -13844,6 +14677,7 @@ FLECS_API extern ECS_COMPONENT_DECLARE(EcsAlert);          /**< Component added
 FLECS_API extern ECS_COMPONENT_DECLARE(EcsAlertInstance);  /**< Component added to alert instance. */
 FLECS_API extern ECS_COMPONENT_DECLARE(EcsAlertsActive);   /**< Component added to alert source which tracks how many active alerts there are. */
 FLECS_API extern ECS_COMPONENT_DECLARE(EcsAlertTimeout);   /**< Component added to alert which tracks how long an alert has been inactive. */
+FLECS_API extern ECS_COMPONENT_DECLARE(EcsAlertStats);     /**< Component added to alert which tracks the cost of evaluating the alert. */
 
 /* Alert severity tags */
 FLECS_API extern ECS_TAG_DECLARE(EcsAlertInfo);            /**< Info alert severity. */
@@ -13864,6 +14698,20 @@ typedef struct EcsAlertsActive {
     ecs_map_t alerts;
 } EcsAlertsActive;
 
+/** Component added to alert that tracks the cost of evaluating the alert.
+ * The counters are reset each time the alert is evaluated. Incremental alerts
+ * skip tables and alert instances that did not change since the last
+ * evaluation. */
+typedef struct EcsAlertStats {
+    double eval_time;            /**< Time spent in last evaluation (seconds) */
+    double eval_time_total;      /**< Total time spent evaluating alert (seconds) */
+    int32_t tables_evaluated;    /**< Tables evaluated in last evaluation */
+    int32_t tables_skipped;      /**< Tables skipped because they didn't change */
+    int32_t instances_evaluated; /**< Alert instances evaluated in last evaluation */
+    int32_t instances_skipped;   /**< Alert instances skipped because their source didn't change */
+    bool incremental;            /**< Whether alert is evaluated incrementally */
+} EcsAlertStats;
+
 /** Alert severity filter. 
  * A severity filter can adjust the severity of an alert based on whether an
  * entity in the alert query has a specific component. For example, a filter
@@ -13935,6 +14783,13 @@ typedef struct ecs_alert_desc_t {
     /** Variable from which to fetch the member (optional). When left to NULL
      * 'id' will be obtained from $this. */
     const char *var;
+
+    /** Only reevaluate tables and alert instances that changed since the last
+     * evaluation (optional). This is only applied to alerts that depend on 
+     * components of the matched entity. Changes to monitored members must be
+     * signaled with ecs_set() or ecs_modified(), as changes made through 
+     * pointers obtained with ecs_get_mut() are not detected. */
+    bool incremental;
 } ecs_alert_desc_t;
 
 /** Create a new alert.
@@ -13958,6 +14813,13 @@ typedef struct ecs_alert_desc_t {
  * which contains a map with active alerts for the entity. This component
  * will be automatically removed once all alerts are cleared for the entity.
  *
+ * When ecs_alert_desc_t::incremental is set and an alert only depends on 
+ * components of the matched entity (no query variables, no up traversal), it is
+ * evaluated incrementally: tables and alert instances that didn't change since 
+ * the last evaluation are skipped. The EcsAlertStats component on the alert 
+ * reports whether an alert is incremental and how much work the last 
+ * evaluation did.
+ *
  * @param world The world.
  * @param desc Alert description.
  * @return The alert entity.
@@ -14344,6 +15206,7 @@ typedef struct ecs_iter_to_json_desc_t {
     bool serialize_alerts;          /**< Serialize active alerts for entity */
     ecs_entity_t serialize_refs;    /**< Serialize references (incoming edges) for relationship */
     bool serialize_matches;         /**< Serialize which queries entity matches with */
+    bool parallel;                  /**< Serialize results on worker threads (see ecs_iter_to_json()) */
     ecs_poly_t *query;            /**< Query object (required for serialize_query_[plan|profile]). */
 } ecs_iter_to_json_desc_t;
 
@@ -14367,6 +15230,7 @@ typedef struct ecs_iter_to_json_desc_t {
     .serialize_alerts =          false, \
     .serialize_refs =            false, \
     .serialize_matches =         false, \
+    .parallel =                  false, \
     .query =                     NULL \
 }
 #else
@@ -14388,6 +15252,7 @@ typedef struct ecs_iter_to_json_desc_t {
     false, \
     false, \
     false, \
+    false, \
     nullptr \
 }
 #endif
@@ -14396,6 +15261,13 @@ typedef struct ecs_iter_to_json_desc_t {
  * This operation will iterate the contents of the iterator and serialize them
  * to JSON. The function accepts iterators from any source.
  *
+ * When desc->parallel is set and the world has worker threads (see 
+ * ecs_set_threads()), the results of a query iterator are serialized on the
+ * worker threads, which produces the same output as serializing the results
+ * on the calling thread. The iterator must be created with ecs_query_iter()
+ * and must not have variables or a group set. Other iterators, or a world
+ * that is in readonly mode or deferred, are serialized on the calling thread.
+ *
  * @param iter The iterator to serialize to JSON.
  * @return A JSON string with the serialized iterator data, or NULL if failed.
  */
@@ -17927,6 +18799,7 @@ static const flecs::entity_t Trait = EcsTrait;
 static const flecs::entity_t Relationship = EcsRelationship;
 static const flecs::entity_t Target = EcsTarget;
 static const flecs::entity_t CanToggle = EcsCanToggle;
+static const flecs::entity_t DirtyRows = EcsDirtyRows;
 
 /* OnInstantiate trait */
 static const flecs::entity_t OnInstantiate = EcsOnInstantiate;
@@ -20627,6 +21500,9 @@ using PipelineStats = EcsPipelineStats;
 /** Component with world summary stats */
 using WorldSummary = EcsWorldSummary;
 
+/** Component with settings for collecting stats */
+using StatsSettings = EcsStatsSettings;
+
 struct stats {
     stats(flecs::world& world);
 };
@@ -20802,6 +21678,7 @@ namespace flecs {
 struct alerts {
     using AlertsActive = EcsAlertsActive;
     using Instance = EcsAlertInstance;
+    using Stats = EcsAlertStats;
 
     struct Alert { };
     struct Info { };
@@ -23489,6 +24366,11 @@ void set_time_scale(ecs_ftime_t mul) const;
  */
 void set_target_fps(ecs_ftime_t target_fps) const;
 
+/** Enable precise frame pacing.
+ * @see ecs_precise_frame_pacing
+ */
+void precise_frame_pacing(bool enable = true) const;
+
 /** Reset simulation clock.
  * @see ecs_reset_clock
  */
@@ -23514,6 +24396,18 @@ void set_task_threads(int32_t task_threads) const;
  */
 bool using_task_threads() const;
 
+/** Iterate a query on all worker threads.
+ * The function is invoked for each matched entity, and has the same signature
+ * as the function passed to query::each(). Operations on the entity are
+ * deferred and merged before the function returns.
+ *
+ * @param q The query to iterate.
+ * @param func The function to invoke for each entity.
+ * @see ecs_query_parallel_each
+ */
+template <typename ... Components, typename Func>
+void parallel_each(const flecs::query<Components...>& q, Func&& func) const;
+
 /** @} */
 
 #   endif
@@ -24289,6 +25183,30 @@ public:
         return ecs_iter_changed(iter_);
     }
 
+    /** Find next range of changed rows for a field.
+     * See ecs_iter_changed_rows().
+     *
+     * @param index The field index.
+     * @param offset Row to start searching from, set to start of range.
+     * @param count Set to number of rows in range.
+     * @return True if a range was found, false if not.
+     */
+    bool changed_rows(int8_t index, int32_t& offset, int32_t& count) const {
+        return ecs_iter_changed_rows(iter_, index, &offset, &count);
+    }
+
+    /** Clear changed rows for a field in the current result.
+     * See ecs_iter_clear_changed_rows(). */
+    void clear_changed_rows(int8_t index) const {
+        ecs_iter_clear_changed_rows(iter_, index);
+    }
+
+    /** Get mask with matching rows for current result.
+     * See ecs_iter_get_row_mask(). */
+    uint64_t row_mask() const {
+        return ecs_iter_get_row_mask(iter_);
+    }
+
     /** Skip current table.
      * This indicates to the query that the data in the current table is not
      * modified. By default, iterating a table with a query will mark the
@@ -31787,6 +32705,11 @@ struct query_builder_i : term_builder_i<Base> {
         return *this;
     }
 
+    Base& toggle_mask() {
+        desc_->flags |= EcsQueryToggleMask;
+        return *this;
+    }
+
     Base& expr(const char *expr) {
         ecs_check(expr_count_ == 0, ECS_INVALID_OPERATION,
             "query_builder::expr() called more than once");
@@ -32683,6 +33606,20 @@ struct observer_builder_i : query_builder_i<Base, Components ...> {
         return *this;
     }
 
+    /** Yield existing matches incrementally, at the end of each frame.
+     * @param time_budget_seconds Max time spent yielding per frame.
+     */
+    Base& yield_existing_time_budget(double time_budget_seconds) {
+        desc_->yield_existing_time_budget = time_budget_seconds;
+        return *this;
+    }
+
+    /** Observer callback can be invoked from multiple threads */
+    Base& multi_threaded(bool value = true) {
+        desc_->multi_threaded = value;
+        return *this;
+    }
+
     /** Set observer flags */
     Base& observer_flags(ecs_flags32_t flags) {
         desc_->flags_ |= flags;
@@ -33474,7 +34411,21 @@ struct pipeline_builder_i : query_builder_i<Base> {
         : query_builder_i<Base>(&desc->query, term_index)
         , desc_(desc) { }
 
+    /** Run independent systems concurrently.
+     * 
+     * @param value If true, systems that don't conflict can run concurrently.
+     * @see ecs_pipeline_desc_t::concurrent
+     */
+    Base& concurrent(bool value = true) {
+        desc_->concurrent = value;
+        return *this;
+    }
+
 private:
+    operator Base&() {
+        return *static_cast<Base*>(this);
+    }
+
     ecs_pipeline_desc_t *desc_;
 };
 
@@ -33564,6 +34515,10 @@ inline void world::set_target_fps(ecs_ftime_t target_fps) const {
     ecs_set_target_fps(world_, target_fps);
 }
 
+inline void world::precise_frame_pacing(bool enable) const {
+    ecs_precise_frame_pacing(world_, enable);
+}
+
 inline void world::reset_clock() const {
     ecs_reset_clock(world_);
 }
@@ -33584,6 +34539,32 @@ inline bool world::using_task_threads() const {
     return ecs_using_task_threads(world_);
 }
 
+namespace _ {
+
+template <typename Func, typename ... Components>
+struct parallel_each_delegate {
+    using Delegate = each_delegate<Func, Components...>;
+
+    static void run(ecs_iter_t *iter) {
+        auto self = static_cast<const Delegate*>(iter->ctx);
+        ecs_assert(self != nullptr, ECS_INTERNAL_ERROR, NULL);
+        self->invoke(iter);
+    }
+};
+
+}
+
+template <typename ... Components, typename Func>
+inline void world::parallel_each(
+    const flecs::query<Components...>& q, Func&& func) const 
+{
+    using Delegate = _::parallel_each_delegate<
+        typename std::decay<Func>::type, Components...>;
+    typename Delegate::Delegate delegate(FLECS_FWD(func));
+    ecs_query_parallel_each(world_, ECS_CONST_CAST(flecs::query_t*, q.c_ptr()),
+        Delegate::run, &delegate);
+}
+
 }
 
 #endif
@@ -34588,6 +35569,15 @@ public:
         return *this;
     }
 
+    /** Only reevaluate tables and instances that changed (optional).
+     * 
+     * @see ecs_alert_desc_t::incremental
+     */
+    Base& incremental(bool value = true) {
+        desc_->incremental = value;
+        return *this;
+    }
+
 protected:
     virtual flecs::world_t* world_v() = 0;
 
@@ -34660,6 +35650,7 @@ inline alerts::alerts(flecs::world& world) {
 
     world.component<AlertsActive>();
     world.component<Instance>();
+    world.component<Stats>();
 
     world.entity<alerts::Alert>("::flecs::alerts::Alert");
     world.entity<alerts::Info>("::flecs::alerts::Info");
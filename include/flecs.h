@@ -330,6 +330,22 @@
 #define FLECS_QUERY_SCOPE_NESTING_MAX (8)
 #endif
 
+/** @def FLECS_QUERY_PLAN_CACHE_SIZE
+ * Maximum number of queries stored by ecs_query_plan_cache_get(). When the
+ * cache is full, the least recently used query is deleted. */
+#ifndef FLECS_QUERY_PLAN_CACHE_SIZE
+#define FLECS_QUERY_PLAN_CACHE_SIZE (32)
+#endif
+
+/** @def FLECS_ASYNC_QUEUE_SIZE
+ * Number of commands that can be enqueued with the ecs_async_* functions 
+ * before the world is merged without taking a lock. When the queue is full, 
+ * commands are added to a mutex protected overflow queue. Must be a power of 
+ * two. */
+#ifndef FLECS_ASYNC_QUEUE_SIZE
+#define FLECS_ASYNC_QUEUE_SIZE (1024)
+#endif
+
 /** @def FLECS_DAG_DEPTH_MAX
  * Maximum of levels in a DAG (acyclic relationship graph). If a graph with a
  * depth larger than this is encountered, a CYCLE_DETECTED panic is thrown.
@@ -1237,6 +1253,19 @@ struct ecs_iter_t {
  */
 #define EcsQueryDetectChanges         (1u << 8u)
 
+/** Return rows of toggle fields as row masks.
+ * Can be combined with other query flags on the ecs_query_desc_t::flags field.
+ * 
+ * By default a query with toggle fields returns one result per contiguous range
+ * of enabled rows, which can produce many small results when components are 
+ * toggled frequently. With this flag the query returns at most one result per
+ * block of 64 rows, which starts at the first matching row of the block. The
+ * rows in the result that match can be obtained with ecs_iter_get_row_mask().
+ * 
+ * \ingroup queries
+ */
+#define EcsQueryToggleMask            (1u << 9u)
+
 
 /** Used with ecs_query_init().
  * 
@@ -1333,6 +1362,26 @@ typedef struct ecs_observer_desc_t {
      * #EcsOnAdd `Position` would match all existing instances of `Position`. */
     bool yield_existing;
 
+    /** When set together with yield_existing, existing matches are not
+     * yielded while the observer is created, but incrementally at the end of
+     * each frame, for at most the specified number of seconds per frame. The
+     * entities that match when the observer is created are recorded, and are
+     * yielded in the order in which they were recorded. Entities that no
+     * longer match by the time they are yielded are skipped.
+     *
+     * If an event for an entity that hasn't been yielded yet arrives before
+     * the catch-up is done, the entity is yielded first, so that the observer
+     * never receives an event for an entity before its existing match.
+     * Remaining matches can also be yielded with ecs_observer_yield_run(). */
+    double yield_existing_time_budget;
+
+    /** Callback can be invoked from multiple threads at the same time. When
+     * set together with yield_existing, existing matches are yielded from
+     * worker threads if the world has multiple stages and the OS API provides
+     * parallel_for. Each thread invokes the callback with its own stage, so
+     * the callback must only use the world passed in the iterator. */
+    bool multi_threaded;
+
     /** Callback to invoke on an event, invoked when the observer matches. */
     ecs_iter_action_t callback;
 
@@ -1501,6 +1550,20 @@ typedef struct ecs_world_info_t {
                                        * to remove library prefixes of symbol
                                        * names (such as `Ecs`, `ecs_`) when
                                        * registering them as names. */
+
+    /* Fields added after the initial layout are appended at the end, so that
+     * existing fields keep their offsets. */
+    ecs_ftime_t frame_time_p50;       /**< Median time between frames, over recent frames */
+    ecs_ftime_t frame_time_p99;       /**< 99th percentile of time between frames, over recent frames */
+    ecs_ftime_t frame_time_max;       /**< Maximum time between frames, over recent frames */
+    ecs_ftime_t delete_time_total;    /**< Total time spent in cascading deletes */
+    ecs_ftime_t delete_time_last;     /**< Time spent in last cascading delete */
+    int32_t delete_queue_count;       /**< Number of entities queued by ecs_delete_incremental() */
+    int32_t table_pool_count;         /**< Number of empty tables with storage freed by table GC */
+    int64_t table_pool_hit_total;     /**< Number of times a table with storage freed by table GC was reused */
+    int64_t table_gc_delete_total;    /**< Number of tables deleted by table GC */
+    int64_t component_record_memory;  /**< Memory used by component records, including table lookup indices (bytes) */
+    int32_t observer_yield_count;     /**< Number of existing matches not yet yielded by incremental observers */
 } ecs_world_info_t;
 
 /** Type that contains information about a query group. */
@@ -1754,6 +1817,10 @@ FLECS_API extern const ecs_entity_t EcsOneOf;
 /** Mark a component as toggleable with ecs_enable_id(). */
 FLECS_API extern const ecs_entity_t EcsCanToggle;
 
+/** Track which rows of a component changed. 
+ * See ecs_iter_changed_rows(). */
+FLECS_API extern const ecs_entity_t EcsDirtyRows;
+
 /** Can be added to components to indicate it is a trait. Traits are components
  * and/or tags that are added to other components to modify their behavior.
  */
@@ -2178,6 +2245,27 @@ void ecs_set_target_fps(
     ecs_world_t *world,
     ecs_ftime_t fps);
 
+/** Enable precise frame pacing.
+ * By default ecs_progress() reaches the target FPS by sleeping in small
+ * intervals, which can overshoot the end of the frame by up to a scheduler
+ * tick. With precise frame pacing, frames are scheduled on fixed deadlines.
+ * ecs_progress() sleeps until shortly before the deadline, and spins for the
+ * remaining time. The spin time adapts to how much the OS oversleeps.
+ *
+ * Precise frame pacing reduces jitter in the time between frames at the cost
+ * of some CPU time spent spinning. It only has an effect when a target FPS is
+ * set. The distribution of frame times can be inspected with the
+ * frame_time_p50, frame_time_p99 and frame_time_max members of
+ * ecs_world_info_t.
+ *
+ * @param world The world.
+ * @param enable Whether to enable or disable precise frame pacing.
+ */
+FLECS_API
+void ecs_precise_frame_pacing(
+    ecs_world_t *world,
+    bool enable);
+
 /** Set default query flags. 
  * Set a default value for the ecs_filter_desc_t::flags field. Default flags
  * are applied in addition to the flags provided in the descriptor. For a
@@ -2473,6 +2561,86 @@ FLECS_API
 int32_t ecs_stage_get_id(
     const ecs_world_t *world);
 
+/** Add a (component) id to an entity from any thread.
+ * The ecs_async_* functions enqueue commands in a lock free queue that is 
+ * owned by the world, and can be called from any thread without owning a 
+ * stage. This is useful for threads that are not managed by Flecs, like
+ * network or asset loading threads. 
+ * 
+ * Commands are applied in the order in which they were enqueued when the world
+ * is merged, which happens at the start of each frame and after each sync 
+ * point in ecs_progress(), or when ecs_merge() is called. Commands for 
+ * entities that are no longer alive when the queue is drained are ignored.
+ * 
+ * The lock free queue has a fixed capacity (see FLECS_ASYNC_QUEUE_SIZE). When 
+ * it is full, commands are stored in an overflow queue that is protected by a
+ * mutex until the queue is drained.
+ *
+ * @param world The world.
+ * @param entity The entity.
+ * @param id The id to add.
+ */
+FLECS_API
+void ecs_async_add_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id);
+
+/** Remove a (component) id from an entity from any thread.
+ * See ecs_async_add_id().
+ *
+ * @param world The world.
+ * @param entity The entity.
+ * @param id The id to remove.
+ */
+FLECS_API
+void ecs_async_remove_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id);
+
+/** Set the value of a component from any thread.
+ * See ecs_async_add_id(). The value is copied with memcpy into storage that is
+ * owned by the queue, which means this function can only be used for 
+ * components that can be trivially copied.
+ *
+ * @param world The world.
+ * @param entity The entity.
+ * @param id The id of the component to set.
+ * @param size The size of the pointed-to value.
+ * @param ptr The pointer to the value.
+ */
+FLECS_API
+void ecs_async_set_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id,
+    size_t size,
+    const void *ptr);
+
+/** Delete an entity from any thread.
+ * See ecs_async_add_id().
+ *
+ * @param world The world.
+ * @param entity The entity to delete.
+ */
+FLECS_API
+void ecs_async_delete(
+    ecs_world_t *world,
+    ecs_entity_t entity);
+
+/** Enqueue an event from any thread.
+ * See ecs_async_add_id(). The event must have an entity, and cannot have a
+ * payload. Events are emitted when the queue is drained.
+ *
+ * @param world The world.
+ * @param desc The event descriptor.
+ */
+FLECS_API
+void ecs_async_enqueue(
+    ecs_world_t *world,
+    const ecs_event_desc_t *desc);
+
 /** @} */
 
 /**
@@ -2687,6 +2855,71 @@ int32_t ecs_delete_empty_tables(
     ecs_world_t *world,
     const ecs_delete_empty_tables_desc_t *desc);
 
+/** Used with ecs_set_table_gc(). */
+typedef struct ecs_table_gc_desc_t {
+    /** Free storage of tables that have been empty for this number of frames.
+     * The table itself is kept, so that it can be reused without having to be
+     * created again. */
+    int32_t clear_frames;
+
+    /** Delete tables that have been empty for this number of frames. */
+    int32_t delete_frames;
+
+    /** Amount of time the table GC is allowed to spend per frame. */
+    double time_budget_seconds;
+} ecs_table_gc_desc_t;
+
+/** Configure table garbage collection.
+ * Applications that use lots of relationships can create and delete large 
+ * numbers of tables that are only used for a short amount of time. When table
+ * GC is enabled, a part of the tables is visited at the end of each frame
+ * (see ecs_frame_end()), until the time budget is exceeded. Tables that have 
+ * been empty for clear_frames frames have their storage freed, but are kept
+ * so that they can be reused when entities are added to them. Tables that 
+ * have been empty for delete_frames frames are deleted.
+ *
+ * The number of tables that are kept with freed storage, the number of times
+ * such a table was reused and the number of tables deleted by the table GC are
+ * reported by the table_pool_count, table_pool_hit_total and 
+ * table_gc_delete_total members of ecs_world_info_t.
+ *
+ * Applications should not hold on to pointers of empty tables while the table
+ * GC is enabled. A NULL desc or a desc with zero clear_frames and 
+ * delete_frames disables table GC.
+ *
+ * @param world The world.
+ * @param desc Table GC configuration.
+ */
+FLECS_API
+void ecs_set_table_gc(
+    ecs_world_t *world,
+    const ecs_table_gc_desc_t *desc);
+
+/** Enable or disable the union row index.
+ * Union relationships store the target for each entity in a linked list, which
+ * makes queries like (Movement, Walking) iterate matching entities one by one.
+ * When the union row index is enabled, queries that select entities by union
+ * target instead use a row bitmap per target that is built for each table with
+ * the union relationship. This returns matching entities as contiguous ranges
+ * of table rows, and finds them with word-level bit scans.
+ *
+ * The row bitmaps of a table are built lazily when the table is queried, and
+ * rebuilt after the table or one of its union targets changed. The index is 
+ * not used while the world is in multi threaded readonly mode, in which case
+ * queries fall back to iterating the linked list.
+ *
+ * Enabling the index changes the order in which union query results are
+ * returned, as results are ordered by table and row instead of by when the
+ * target was last set.
+ *
+ * @param world The world.
+ * @param enable Whether to enable or disable the union row index.
+ */
+FLECS_API
+void ecs_enable_union_index(
+    ecs_world_t *world,
+    bool enable);
+
 /** Get world from poly.
  *
  * @param poly A pointer to a poly object.
@@ -2930,6 +3163,11 @@ const ecs_entity_t* ecs_bulk_init(
  * This operation is the same as ecs_new_w_id(), but creates N entities
  * instead of one.
  *
+ * When the id is an (IsA, prefab) pair, this instantiates N copies of the 
+ * prefab. The children of the prefab are created for all instances in a single
+ * pass over the prefab hierarchy, which is faster than instantiating the 
+ * prefab N times with ecs_new_w_pair().
+ *
  * @param world The world.
  * @param id The component id to create the entities with.
  * @param count The number of entities to create.
@@ -2976,6 +3214,33 @@ void ecs_delete(
     ecs_world_t *world,
     ecs_entity_t entity);
 
+/** Delete multiple entities.
+ * This operation has the same effect as calling ecs_delete() for each of the
+ * provided entities, but is faster when many entities are deleted from the
+ * same table. Rows of deleted entities are moved to the end of their table,
+ * after which OnRemove observers and hooks are invoked once for the entire
+ * range and the table is truncated.
+ *
+ * Entities that are used in ids (for example as relationship target) are
+ * deleted one at a time, before the other entities. Entities that are not 
+ * alive are ignored. Deleted entities may be removed from their table in a
+ * different order than the order in which they are provided, which means 
+ * the order of the remaining entities in the table can be different from 
+ * calling ecs_delete() for each entity.
+ *
+ * When called while deferred, the operation enqueues a delete command for 
+ * each entity. Consecutive delete commands are merged with this operation.
+ *
+ * @param world The world.
+ * @param count The number of entities.
+ * @param entities The entities to delete.
+ */
+FLECS_API
+void ecs_delete_many(
+    ecs_world_t *world,
+    int32_t count,
+    const ecs_entity_t *entities);
+
 /** Delete all entities with the specified id.
  * This will delete all entities (tables) that have the specified id. The id
  * may be a wildcard and/or a pair.
@@ -2988,6 +3253,78 @@ void ecs_delete_with(
     ecs_world_t *world,
     ecs_id_t id);
 
+/** Queue entity for incremental deletion.
+ * This operation queues an entity and its children to be deleted by 
+ * ecs_delete_incremental_run(). Deleting an entity with many (nested) children
+ * can take a long time. Deleting the subtree incrementally spreads this cost
+ * out over multiple calls, for example across frames.
+ *
+ * Subtrees are deleted depth first, so that entities are only deleted after
+ * their children have been deleted. Entities without children are deleted in
+ * batches with ecs_delete_many(). Entities remain alive until they are deleted
+ * by ecs_delete_incremental_run(). Entities that are deleted before then are
+ * ignored.
+ *
+ * If entity is 0, all root entities are queued, except for modules and
+ * entities that are used as component, tag or relationship. This can be used
+ * to delete the contents of a world before calling ecs_fini(), which then only
+ * has to delete the remaining entities. If the world is not used by any other
+ * thread, ecs_delete_incremental_run() can be called from a background thread.
+ *
+ * The number of queued entities is reported by the delete_queue_count member
+ * of ecs_world_info_t. Entities that are still queued when the world is
+ * deleted are deleted by ecs_fini().
+ *
+ * @param world The world.
+ * @param entity The entity to delete, or 0 to queue all root entities.
+ */
+FLECS_API
+void ecs_delete_incremental(
+    ecs_world_t *world,
+    ecs_entity_t entity);
+
+/** Delete entities queued by ecs_delete_incremental().
+ * This operation deletes queued entities until the queue is empty or the time
+ * budget is exceeded. A time budget of 0 deletes all queued entities. At least
+ * one batch of entities is processed per call, regardless of the budget.
+ *
+ * The operation cannot be called while the world is deferred.
+ *
+ * @param world The world.
+ * @param time_budget_seconds Amount of time operation is allowed to spend.
+ * @return Number of entities that are still queued, 0 if done.
+ */
+FLECS_API
+int32_t ecs_delete_incremental_run(
+    ecs_world_t *world,
+    double time_budget_seconds);
+
+/** Enable or disable parallel delete.
+ * When parallel delete is enabled, cascading deletes (such as deleting a 
+ * parent with many children, or ecs_delete_with()) first empty all tables that
+ * are deleted. Destructors of the deleted components are then invoked in
+ * parallel with ecs_os_parallel_for(), after which the component storage is 
+ * released in bulk. OnRemove observers and on_remove hooks still run on the 
+ * calling thread, before any destructors are invoked.
+ *
+ * Destructors of components that are deleted while parallel delete is enabled
+ * must be thread safe, and are invoked after the entity has been deleted. 
+ * If the OS API does not provide a parallel_for implementation, or if the 
+ * world has less than two threads (see ecs_set_threads()), destructors run on
+ * the calling thread while tables are emptied, as if parallel delete was not
+ * enabled.
+ *
+ * The time spent in cascading deletes is reported in the delete_time_total 
+ * and delete_time_last members of ecs_world_info_t.
+ *
+ * @param world The world.
+ * @param enable Whether to enable or disable parallel delete.
+ */
+FLECS_API
+void ecs_enable_parallel_delete(
+    ecs_world_t *world,
+    bool enable);
+
 /** Set child order for parent with OrderedChildren.
  * If the parent has the OrderedChildren trait, the order of the children 
  * will be updated to the order in the specified children array. The operation
@@ -3240,6 +3577,32 @@ FLECS_ALWAYS_INLINE const void* ecs_get_id(
     ecs_entity_t entity,
     ecs_id_t id);
 
+/** Get immutable pointers to a component for multiple entities.
+ * This operation is equivalent to calling ecs_get_id() for each entity, but
+ * is faster for large batches of entities that are not in the cache. Entity
+ * records are prefetched ahead of time, and the component column is only 
+ * looked up when the table changes between subsequent entities. Batches in 
+ * which entities from the same table are grouped together benefit the most.
+ * 
+ * The order of the pointers in the output array matches the order of the
+ * entities. Pointers for entities without the component are set to NULL.
+ *
+ * @param world The world.
+ * @param count The number of entities.
+ * @param entities The entities.
+ * @param id The id of the component to get.
+ * @param out Array with count elements that is populated with the pointers.
+ *
+ * @see ecs_get_id()
+ */
+FLECS_API
+void ecs_get_many_id(
+    const ecs_world_t *world,
+    int32_t count,
+    const ecs_entity_t *entities,
+    ecs_id_t id,
+    const void **out);
+
 /** Get a mutable pointer to a component.
  * This operation obtains a mutable pointer to the requested component. The
  * operation accepts the component entity id.
@@ -4036,6 +4399,28 @@ void ecs_get_path_w_sep_buf(
     ecs_strbuf_t *buf,
     bool escape);
 
+/** Enable or disable the path cache.
+ * When the path cache is enabled, the full paths of named entities are stored
+ * the first time they are requested or looked up. Subsequent calls to 
+ * ecs_get_path() copy the cached string instead of walking the parents of the
+ * entity, and ecs_lookup() resolves a cached full path with a single hash 
+ * lookup.
+ *
+ * The cache only applies to paths from the root that use the default separator
+ * and no prefix. Cached paths are invalidated when an entity or one of its 
+ * parents is renamed, reparented or deleted. Paths are not added to the cache
+ * while the world is running systems on multiple threads.
+ *
+ * Disabling the cache frees all cached paths.
+ *
+ * @param world The world.
+ * @param enable Whether to enable or disable the path cache.
+ */
+FLECS_API
+void ecs_enable_path_cache(
+    ecs_world_t *world,
+    bool enable);
+
 /** Find or create entity from path.
  * This operation will find or create an entity from a path, and will create any
  * intermediate entities if required. If the entity already exists, no entities
@@ -4621,6 +5006,49 @@ FLECS_API
 void ecs_query_fini(
     ecs_query_t *query);
 
+/** Get query for expression from the query plan cache.
+ * This operation returns a query for the provided query expression. The first
+ * time an expression is used, a query is created and stored in a cache that
+ * belongs to the world. Subsequent calls with the same expression return the
+ * cached query, which means the expression doesn't need to be parsed, 
+ * validated and compiled again. This is useful for applications that 
+ * repeatedly create short-lived queries from the same expressions, like tools
+ * that poll for data.
+ *
+ * Expressions that only differ in whitespace share the same query. Names in
+ * the expression are resolved relative to the current scope (see 
+ * ecs_set_scope()), which is part of the cache key.
+ *
+ * The cache stores up to FLECS_QUERY_PLAN_CACHE_SIZE queries. When the cache
+ * is full, the least recently used query is deleted. Cached queries are also
+ * deleted when an entity used by the query is deleted.
+ *
+ * The returned query is owned by the cache and must not be deleted with
+ * ecs_query_fini(). Because queries can be evicted, an application should not
+ * store the returned query, and should use it before calling this operation
+ * again or before deleting entities.
+ *
+ * This operation cannot be called while the world is running on multiple
+ * threads.
+ *
+ * @param world The world.
+ * @param expr The query expression.
+ * @return The query, or NULL if the expression is invalid.
+ */
+FLECS_API
+ecs_query_t* ecs_query_plan_cache_get(
+    ecs_world_t *world,
+    const char *expr);
+
+/** Delete all queries in the query plan cache.
+ * See ecs_query_plan_cache_get().
+ *
+ * @param world The world.
+ */
+FLECS_API
+void ecs_query_plan_cache_clear(
+    ecs_world_t *world);
+
 /** Find variable index.
  * This operation looks up the index of a variable in the query. This index can
  * be used in operations like ecs_iter_set_var() and ecs_iter_get_var().
@@ -5118,6 +5546,27 @@ const ecs_observer_t* ecs_observer_get(
     const ecs_world_t *world,
     ecs_entity_t observer);
 
+/** Yield existing matches of incremental observers.
+ * This operation yields the existing matches of observers created with
+ * yield_existing_time_budget that haven't been yielded yet. Observers are
+ * processed in the order in which they were created. The remaining matches of
+ * each observer are also yielded at the end of each frame by ecs_frame_end(),
+ * within the time budget of the observer. This operation can be used when the
+ * application doesn't call ecs_progress(), or to finish yielding early.
+ *
+ * The number of remaining matches is reported by the observer_yield_count
+ * member of ecs_world_info_t. This operation may not be called while the world
+ * is deferred.
+ *
+ * @param world The world.
+ * @param time_budget_seconds Maximum time to spend, or 0 to yield all matches.
+ * @return The number of matches that have not been yielded yet.
+ */
+FLECS_API
+int32_t ecs_observer_yield_run(
+    ecs_world_t *world,
+    double time_budget_seconds);
+
 /** @} */
 
 /**
@@ -5403,6 +5852,87 @@ FLECS_API
 bool ecs_iter_changed(
     ecs_iter_t *it);
 
+/** Get mask with matching rows for current iterator result.
+ * This operation must be used in combination with a query that has the
+ * EcsQueryToggleMask flag. Bit N of the returned mask is set when the entity at
+ * index N in the current result matches the toggle fields of the query. Results
+ * are never larger than 64 rows when the mask is used, and the first row of a
+ * result always matches:
+ *
+ * @code
+ * ecs_flags64_t mask = ecs_iter_get_row_mask(it);
+ * for (int32_t i = 0; i < it->count; i ++) {
+ *   if (mask & (1llu << i)) { ... }
+ * }
+ * @endcode
+ *
+ * If the current result has no rows that were filtered by a toggle field, all
+ * bits for the rows in the result are set.
+ *
+ * @param it The iterator.
+ * @return Mask with matching rows.
+ */
+FLECS_API
+ecs_flags64_t ecs_iter_get_row_mask(
+    const ecs_iter_t *it);
+
+/** Get the next range of changed rows for a field.
+ * This operation returns which entities in the current result have changed
+ * values for a field, for components that have the DirtyRows trait. For 
+ * these components each table keeps a bit per row that is set when the
+ * component is written for the entity with ecs_set(), ecs_modified(), or by a
+ * query with [out] or [inout] terms. Rows are also marked as changed when an
+ * entity is added to the table, or when an entity moves to a different row.
+ *
+ * The offset parameter is the index in the current result from which to start
+ * searching. When the operation returns true, offset and count are set to a 
+ * range of consecutive changed rows. The operation should be invoked in a 
+ * loop like this:
+ *
+ * @code
+ * int32_t offset = 0, count;
+ * while (ecs_iter_changed_rows(it, 0, &offset, &count)) {
+ *   for (int32_t i = offset; i < offset + count; i ++) { ... }
+ *   offset += count;
+ * }
+ * @endcode
+ *
+ * If the component doesn't have the DirtyRows trait, all rows are returned
+ * as changed. If the field is shared, all rows are returned when the shared
+ * component changed.
+ *
+ * Changed rows are not reset automatically, and must be acknowledged with
+ * ecs_iter_clear_changed_rows(). The bits are shared by all queries, which
+ * means that this mechanism is intended for a single consumer per component.
+ * A query that consumes changes should not write the field ([in]), as that
+ * marks all iterated rows as changed.
+ *
+ * @param it The iterator.
+ * @param index The index of the field.
+ * @param offset In: index from which to search, out: first changed row.
+ * @param count Out: number of consecutive changed rows.
+ * @return True if changed rows were found, false if not.
+ */
+FLECS_API
+bool ecs_iter_changed_rows(
+    const ecs_iter_t *it,
+    int8_t index,
+    int32_t *offset,
+    int32_t *count);
+
+/** Acknowledge changed rows for a field.
+ * This operation resets the changed state of the rows in the current result
+ * for a field. Fields with a shared source are not reset. 
+ * See ecs_iter_changed_rows().
+ *
+ * @param it The iterator.
+ * @param index The index of the field.
+ */
+FLECS_API
+void ecs_iter_clear_changed_rows(
+    const ecs_iter_t *it,
+    int8_t index);
+
 /** Convert iterator to string.
  * Prints the contents of an iterator to a string. Useful for debugging and/or
  * testing the output of an iterator.
@@ -39,6 +39,7 @@ FLECS_API extern ECS_COMPONENT_DECLARE(EcsAlert);          /**< Component added
 FLECS_API extern ECS_COMPONENT_DECLARE(EcsAlertInstance);  /**< Component added to alert instance. */
 FLECS_API extern ECS_COMPONENT_DECLARE(EcsAlertsActive);   /**< Component added to alert source which tracks how many active alerts there are. */
 FLECS_API extern ECS_COMPONENT_DECLARE(EcsAlertTimeout);   /**< Component added to alert which tracks how long an alert has been inactive. */
+FLECS_API extern ECS_COMPONENT_DECLARE(EcsAlertStats);     /**< Component added to alert which tracks the cost of evaluating the alert. */
 
 /* Alert severity tags */
 FLECS_API extern ECS_TAG_DECLARE(EcsAlertInfo);            /**< Info alert severity. */
@@ -59,6 +60,20 @@ typedef struct EcsAlertsActive {
     ecs_map_t alerts;
 } EcsAlertsActive;
 
+/** Component added to alert that tracks the cost of evaluating the alert.
+ * The counters are reset each time the alert is evaluated. Incremental alerts
+ * skip tables and alert instances that did not change since the last
+ * evaluation. */
+typedef struct EcsAlertStats {
+    double eval_time;            /**< Time spent in last evaluation (seconds) */
+    double eval_time_total;      /**< Total time spent evaluating alert (seconds) */
+    int32_t tables_evaluated;    /**< Tables evaluated in last evaluation */
+    int32_t tables_skipped;      /**< Tables skipped because they didn't change */
+    int32_t instances_evaluated; /**< Alert instances evaluated in last evaluation */
+    int32_t instances_skipped;   /**< Alert instances skipped because their source didn't change */
+    bool incremental;            /**< Whether alert is evaluated incrementally */
+} EcsAlertStats;
+
 /** Alert severity filter. 
  * A severity filter can adjust the severity of an alert based on whether an
  * entity in the alert query has a specific component. For example, a filter
@@ -130,6 +145,13 @@ typedef struct ecs_alert_desc_t {
     /** Variable from which to fetch the member (optional). When left to NULL
      * 'id' will be obtained from $this. */
     const char *var;
+
+    /** Only reevaluate tables and alert instances that changed since the last
+     * evaluation (optional). This is only applied to alerts that depend on 
+     * components of the matched entity. Changes to monitored members must be
+     * signaled with ecs_set() or ecs_modified(), as changes made through 
+     * pointers obtained with ecs_get_mut() are not detected. */
+    bool incremental;
 } ecs_alert_desc_t;
 
 /** Create a new alert.
@@ -153,6 +175,13 @@ typedef struct ecs_alert_desc_t {
  * which contains a map with active alerts for the entity. This component
  * will be automatically removed once all alerts are cleared for the entity.
  *
+ * When ecs_alert_desc_t::incremental is set and an alert only depends on 
+ * components of the matched entity (no query variables, no up traversal), it is
+ * evaluated incrementally: tables and alert instances that didn't change since 
+ * the last evaluation are skipped. The EcsAlertStats component on the alert 
+ * reports whether an alert is incremental and how much work the last 
+ * evaluation did.
+ *
  * @param world The world.
  * @param desc Alert description.
  * @return The alert entity.
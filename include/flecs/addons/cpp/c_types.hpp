@@ -132,6 +132,7 @@ static const flecs::entity_t Trait = EcsTrait;
 static const flecs::entity_t Relationship = EcsRelationship;
 static const flecs::entity_t Target = EcsTarget;
 static const flecs::entity_t CanToggle = EcsCanToggle;
+static const flecs::entity_t DirtyRows = EcsDirtyRows;
 
 /* OnInstantiate trait */
 static const flecs::entity_t OnInstantiate = EcsOnInstantiate;
@@ -341,6 +341,30 @@ public:
         return ecs_iter_changed(iter_);
     }
 
+    /** Find next range of changed rows for a field.
+     * See ecs_iter_changed_rows().
+     *
+     * @param index The field index.
+     * @param offset Row to start searching from, set to start of range.
+     * @param count Set to number of rows in range.
+     * @return True if a range was found, false if not.
+     */
+    bool changed_rows(int8_t index, int32_t& offset, int32_t& count) const {
+        return ecs_iter_changed_rows(iter_, index, &offset, &count);
+    }
+
+    /** Clear changed rows for a field in the current result.
+     * See ecs_iter_clear_changed_rows(). */
+    void clear_changed_rows(int8_t index) const {
+        ecs_iter_clear_changed_rows(iter_, index);
+    }
+
+    /** Get mask with matching rows for current result.
+     * See ecs_iter_get_row_mask(). */
+    uint64_t row_mask() const {
+        return ecs_iter_get_row_mask(iter_);
+    }
+
     /** Skip current table.
      * This indicates to the query that the data in the current table is not
      * modified. By default, iterating a table with a query will mark the
@@ -147,6 +147,15 @@ public:
         return *this;
     }
 
+    /** Only reevaluate tables and instances that changed (optional).
+     * 
+     * @see ecs_alert_desc_t::incremental
+     */
+    Base& incremental(bool value = true) {
+        desc_->incremental = value;
+        return *this;
+    }
+
 protected:
     virtual flecs::world_t* world_v() = 0;
 
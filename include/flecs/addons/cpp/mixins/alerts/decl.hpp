@@ -19,6 +19,7 @@ namespace flecs {
 struct alerts {
     using AlertsActive = EcsAlertsActive;
     using Instance = EcsAlertInstance;
+    using Stats = EcsAlertStats;
 
     struct Alert { };
     struct Info { };
@@ -33,6 +33,7 @@ inline alerts::alerts(flecs::world& world) {
 
     world.component<AlertsActive>();
     world.component<Instance>();
+    world.component<Stats>();
 
     world.entity<alerts::Alert>("::flecs::alerts::Alert");
     world.entity<alerts::Info>("::flecs::alerts::Info");
@@ -49,6 +49,20 @@ struct observer_builder_i : query_builder_i<Base, Components ...> {
         return *this;
     }
 
+    /** Yield existing matches incrementally, at the end of each frame.
+     * @param time_budget_seconds Max time spent yielding per frame.
+     */
+    Base& yield_existing_time_budget(double time_budget_seconds) {
+        desc_->yield_existing_time_budget = time_budget_seconds;
+        return *this;
+    }
+
+    /** Observer callback can be invoked from multiple threads */
+    Base& multi_threaded(bool value = true) {
+        desc_->multi_threaded = value;
+        return *this;
+    }
+
     /** Set observer flags */
     Base& observer_flags(ecs_flags32_t flags) {
         desc_->flags_ |= flags;
@@ -19,7 +19,21 @@ struct pipeline_builder_i : query_builder_i<Base> {
         : query_builder_i<Base>(&desc->query, term_index)
         , desc_(desc) { }
 
+    /** Run independent systems concurrently.
+     * 
+     * @param value If true, systems that don't conflict can run concurrently.
+     * @see ecs_pipeline_desc_t::concurrent
+     */
+    Base& concurrent(bool value = true) {
+        desc_->concurrent = value;
+        return *this;
+    }
+
 private:
+    operator Base&() {
+        return *static_cast<Base*>(this);
+    }
+
     ecs_pipeline_desc_t *desc_;
 };
 
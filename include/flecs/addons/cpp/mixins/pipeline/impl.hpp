@@ -65,6 +65,10 @@ inline void world::set_target_fps(ecs_ftime_t target_fps) const {
     ecs_set_target_fps(world_, target_fps);
 }
 
+inline void world::precise_frame_pacing(bool enable) const {
+    ecs_precise_frame_pacing(world_, enable);
+}
+
 inline void world::reset_clock() const {
     ecs_reset_clock(world_);
 }
@@ -85,4 +89,30 @@ inline bool world::using_task_threads() const {
     return ecs_using_task_threads(world_);
 }
 
+namespace _ {
+
+template <typename Func, typename ... Components>
+struct parallel_each_delegate {
+    using Delegate = each_delegate<Func, Components...>;
+
+    static void run(ecs_iter_t *iter) {
+        auto self = static_cast<const Delegate*>(iter->ctx);
+        ecs_assert(self != nullptr, ECS_INTERNAL_ERROR, NULL);
+        self->invoke(iter);
+    }
+};
+
+}
+
+template <typename ... Components, typename Func>
+inline void world::parallel_each(
+    const flecs::query<Components...>& q, Func&& func) const 
+{
+    using Delegate = _::parallel_each_delegate<
+        typename std::decay<Func>::type, Components...>;
+    typename Delegate::Delegate delegate(FLECS_FWD(func));
+    ecs_query_parallel_each(world_, ECS_CONST_CAST(flecs::query_t*, q.c_ptr()),
+        Delegate::run, &delegate);
+}
+
 }
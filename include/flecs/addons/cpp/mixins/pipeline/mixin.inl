@@ -67,6 +67,11 @@ void set_time_scale(ecs_ftime_t mul) const;
  */
 void set_target_fps(ecs_ftime_t target_fps) const;
 
+/** Enable precise frame pacing.
+ * @see ecs_precise_frame_pacing
+ */
+void precise_frame_pacing(bool enable = true) const;
+
 /** Reset simulation clock.
  * @see ecs_reset_clock
  */
@@ -92,4 +97,16 @@ void set_task_threads(int32_t task_threads) const;
  */
 bool using_task_threads() const;
 
+/** Iterate a query on all worker threads.
+ * The function is invoked for each matched entity, and has the same signature
+ * as the function passed to query::each(). Operations on the entity are
+ * deferred and merged before the function returns.
+ *
+ * @param q The query to iterate.
+ * @param func The function to invoke for each entity.
+ * @see ecs_query_parallel_each
+ */
+template <typename ... Components, typename Func>
+void parallel_each(const flecs::query<Components...>& q, Func&& func) const;
+
 /** @} */
@@ -40,6 +40,11 @@ struct query_builder_i : term_builder_i<Base> {
         return *this;
     }
 
+    Base& toggle_mask() {
+        desc_->flags |= EcsQueryToggleMask;
+        return *this;
+    }
+
     Base& expr(const char *expr) {
         ecs_check(expr_count_ == 0, ECS_INVALID_OPERATION,
             "query_builder::expr() called more than once");
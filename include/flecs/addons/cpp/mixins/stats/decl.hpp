@@ -24,6 +24,9 @@ using PipelineStats = EcsPipelineStats;
 /** Component with world summary stats */
 using WorldSummary = EcsWorldSummary;
 
+/** Component with settings for collecting stats */
+using StatsSettings = EcsStatsSettings;
+
 struct stats {
     stats(flecs::world& world);
 };
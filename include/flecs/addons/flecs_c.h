@@ -341,6 +341,20 @@
     ecs_remove_id(world, subject, ecs_pair(first, second))
 
 
+#define ecs_async_add(world, entity, T)\
+    ecs_async_add_id(world, entity, ecs_id(T))
+
+#define ecs_async_add_pair(world, subject, first, second)\
+    ecs_async_add_id(world, subject, ecs_pair(first, second))
+
+
+#define ecs_async_remove(world, entity, T)\
+    ecs_async_remove_id(world, entity, ecs_id(T))
+
+#define ecs_async_remove_pair(world, subject, first, second)\
+    ecs_async_remove_id(world, subject, ecs_pair(first, second))
+
+
 #define ecs_auto_override(world, entity, T)\
     ecs_auto_override_id(world, entity, ecs_id(T))
 
@@ -366,6 +380,9 @@
 #define ecs_set(world, entity, component, ...)\
     ecs_set_id(world, entity, ecs_id(component), sizeof(component), &(component)__VA_ARGS__)
 
+#define ecs_async_set(world, entity, component, ...)\
+    ecs_async_set_id(world, entity, ecs_id(component), sizeof(component), &(component)__VA_ARGS__)
+
 #define ecs_set_pair(world, subject, First, second, ...)\
     ecs_set_id(world, subject,\
         ecs_pair(ecs_id(First), second),\
@@ -393,6 +410,9 @@
 #define ecs_get(world, entity, T)\
     (ECS_CAST(const T*, ecs_get_id(world, entity, ecs_id(T))))
 
+#define ecs_get_many(world, count, entities, T, out)\
+    ecs_get_many_id(world, count, entities, ecs_id(T), out)
+
 #define ecs_get_pair(world, subject, First, second)\
     (ECS_CAST(const First*, ecs_get_id(world, subject,\
         ecs_pair(ecs_id(First), second))))
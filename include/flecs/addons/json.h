@@ -309,6 +309,7 @@ typedef struct ecs_iter_to_json_desc_t {
     bool serialize_alerts;          /**< Serialize active alerts for entity */
     ecs_entity_t serialize_refs;    /**< Serialize references (incoming edges) for relationship */
     bool serialize_matches;         /**< Serialize which queries entity matches with */
+    bool parallel;                  /**< Serialize results on worker threads (see ecs_iter_to_json()) */
     ecs_poly_t *query;            /**< Query object (required for serialize_query_[plan|profile]). */
 } ecs_iter_to_json_desc_t;
 
@@ -332,6 +333,7 @@ typedef struct ecs_iter_to_json_desc_t {
     .serialize_alerts =          false, \
     .serialize_refs =            false, \
     .serialize_matches =         false, \
+    .parallel =                  false, \
     .query =                     NULL \
 }
 #else
@@ -353,6 +355,7 @@ typedef struct ecs_iter_to_json_desc_t {
     false, \
     false, \
     false, \
+    false, \
     nullptr \
 }
 #endif
@@ -361,6 +364,13 @@ typedef struct ecs_iter_to_json_desc_t {
  * This operation will iterate the contents of the iterator and serialize them
  * to JSON. The function accepts iterators from any source.
  *
+ * When desc->parallel is set and the world has worker threads (see 
+ * ecs_set_threads()), the results of a query iterator are serialized on the
+ * worker threads, which produces the same output as serializing the results
+ * on the calling thread. The iterator must be created with ecs_query_iter()
+ * and must not have variables or a group set. Other iterators, or a world
+ * that is in readonly mode or deferred, are serialized on the calling thread.
+ *
  * @param iter The iterator to serialize to JSON.
  * @return A JSON string with the serialized iterator data, or NULL if failed.
  */
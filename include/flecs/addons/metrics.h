@@ -163,6 +163,29 @@ ecs_entity_t ecs_metric_init(
 #define ecs_metric(world, ...)\
     ecs_metric_init(world, &(ecs_metric_desc_t) __VA_ARGS__ )
 
+/** Serialize metrics to the Prometheus text exposition format.
+ * The output contains a metric family for each metric, with a sample for each
+ * metric instance. Samples are labeled with the path of the metric source. For
+ * metrics that track relationship targets, a sample is added for each target.
+ * Gauge metrics are exported as gauge, all other kinds are exported as counter.
+ * Metric names are created from the metric path, for example a metric called
+ * "metrics.position_y" is exported as "metrics_position_y".
+ *
+ * Values are read directly from the metric instances. Labels are created once
+ * per instance and reused by subsequent calls, which means that renaming the
+ * source of an existing metric instance does not update its label.
+ *
+ * The returned string is owned by the world, and is valid until the next call
+ * to this function or until the world is deleted. The memory of the string is
+ * reused between calls.
+ *
+ * @param world The world.
+ * @return The serialized metrics, or NULL if the module is not imported.
+ */
+FLECS_API
+const char* ecs_metrics_to_prometheus(
+    ecs_world_t *world);
+
 /** Metrics module import function.
  * Usage:
  * @code
@@ -113,6 +113,20 @@ typedef struct ecs_pipeline_desc_t {
      * pipeline query works.
     */
     ecs_query_desc_t query;
+
+    /** Run independent systems concurrently.
+     * By default each multi threaded system is ran on all worker threads, and
+     * systems run one after another. When enabled, the pipeline builds a 
+     * dependency graph from the in/out annotations of system terms. Multi
+     * threaded systems between the same two merges that don't write 
+     * components accessed by each other are then distributed across worker
+     * threads, where each system runs on a single thread.
+     *
+     * Systems that conflict still run in the order of the pipeline query. Since
+     * scheduling relies on term annotations, systems that access components
+     * that aren't in their query (for example with ecs_get()) should add
+     * these components to the query with the InOutNone or In annotations. */
+    bool concurrent;
 } ecs_pipeline_desc_t;
 
 /** Create a custom pipeline.
@@ -241,6 +255,12 @@ void ecs_set_threads(
  * This function is useful for multithreading world updates using an external
  * asynchronous job system rather than long running threads by providing the APIs
  * to create tasks for your job system and then wait on their conclusion.
+ *
+ * If the OS API provides a parallel_for callback, it is used instead of
+ * task_new and task_join. Tasks are then not created per update, and the 
+ * OS API decides on which threads to run the work. The builtin OS API 
+ * implementation provides a parallel_for that runs on a persistent pool of
+ * threads, unless the application provides its own task_new callback.
  * The operation may be called multiple times to reconfigure the number of task threads
  * used, but never while running a system / pipeline.
  * Calling ecs_set_task_threads() will also end the use of threads setup with
@@ -263,6 +283,34 @@ FLECS_API
 bool ecs_using_task_threads(
     ecs_world_t *world);
 
+/** Iterate a query on all worker threads.
+ * This operation runs the provided callback for the results of a query, and
+ * distributes the matched tables and rows across the worker threads created
+ * with ecs_set_threads() or ecs_set_task_threads(), in the same way as a
+ * multi threaded system. The calling thread runs the first share of the
+ * results. The operation returns after all threads are done.
+ *
+ * The callback is invoked with an iterator whose world is the stage of the
+ * thread that runs it. Operations enqueued on it->world are deferred, and
+ * are merged before the function returns. The ctx parameter is passed to the
+ * callback as it->ctx.
+ *
+ * If no worker threads are configured, the query is iterated on the calling
+ * thread. The operation cannot be called while the world is in readonly mode,
+ * which means that it cannot be called from a system.
+ *
+ * @param world The world.
+ * @param query The query to iterate.
+ * @param callback The callback to invoke for each result.
+ * @param ctx User context passed to the callback.
+ */
+FLECS_API
+void ecs_query_parallel_each(
+    ecs_world_t *world,
+    ecs_query_t *query,
+    ecs_iter_action_t callback,
+    void *ctx);
+
 ////////////////////////////////////////////////////////////////////////////////
 //// Module
 ////////////////////////////////////////////////////////////////////////////////
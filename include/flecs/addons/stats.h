@@ -10,6 +10,10 @@
  * 
  * When the addon is imported as module, statistics are tracked for each frame,
  * second, minute, hour, day and week with 60 datapoints per tier.
+ *
+ * Collection can be made cheaper with the EcsStatsSettings component, which
+ * can reduce the sample rate and replace the history tiers with compact
+ * statistics that only store a small window of averages per metric.
  */
 
 #ifdef FLECS_STATS
@@ -65,6 +69,7 @@ typedef struct ecs_world_stats_t {
     struct {
         ecs_metric_t count;               /**< Number of entities */
         ecs_metric_t not_alive_count;     /**< Number of not alive (recyclable) entity ids */
+        ecs_metric_t delete_queue_count;  /**< Number of entities queued by ecs_delete_incremental() */
     } entities;
 
     /* Component ids */
@@ -83,6 +88,9 @@ typedef struct ecs_world_stats_t {
         ecs_metric_t empty_count;          /**< Number of empty tables */
         ecs_metric_t create_count;         /**< Number of times table has been created */
         ecs_metric_t delete_count;         /**< Number of times table has been deleted */
+        ecs_metric_t pool_count;           /**< Number of empty tables with storage freed by table GC */
+        ecs_metric_t pool_hit_count;       /**< Number of times a table with storage freed by table GC was reused */
+        ecs_metric_t gc_delete_count;      /**< Number of tables deleted by table GC */
     } tables;
 
     /* Queries & events */
@@ -90,6 +98,7 @@ typedef struct ecs_world_stats_t {
         ecs_metric_t query_count;          /**< Number of queries */
         ecs_metric_t observer_count;       /**< Number of observers */
         ecs_metric_t system_count;         /**< Number of systems */
+        ecs_metric_t observer_yield_count; /**< Number of existing matches not yet yielded by incremental observers */
     } queries;
 
     /* Commands */
@@ -129,6 +138,9 @@ typedef struct ecs_world_stats_t {
         ecs_metric_t rematch_time;         /**< Time spent on rematching. */
         ecs_metric_t fps;                  /**< Frames per second. */
         ecs_metric_t delta_time;           /**< Delta_time. */
+        ecs_metric_t frame_time_p50;       /**< Median time between frames. */
+        ecs_metric_t frame_time_p99;       /**< 99th percentile of time between frames. */
+        ecs_metric_t frame_time_max;       /**< Maximum time between frames. */
     } performance;
 
     struct {
@@ -221,6 +233,35 @@ typedef struct ecs_pipeline_stats_t {
     int32_t rebuild_count;       /**< Number of times pipeline has rebuilt */
 } ecs_pipeline_stats_t;
 
+/** Compact statistics for a single resource.
+ * Compact statistics store one value per metric for each sample in a window
+ * of configurable size, instead of the avg/min/max history tiers of regular
+ * statistics. Counters are delta encoded: a sample stores the increase since
+ * the previous sample, and only the last absolute value is kept. Gauges store
+ * the measured value.
+ *
+ * Metrics are stored in the order they appear in the statistics type, see
+ * ECS_STATS_METRIC_INDEX. For systems the metrics of ecs_system_stats_t are
+ * followed by the metrics of ecs_query_stats_t.
+ */
+typedef struct ecs_compact_stats_t {
+    int32_t metric_count;        /**< Number of metrics in a sample */
+    int32_t window;              /**< Number of samples in window */
+    int32_t t;                   /**< Position of last sample in window */
+    int32_t count;               /**< Number of recorded samples */
+    double *values;              /**< Last absolute value of counters */
+    ecs_float_t *samples;        /**< Samples (window * metric_count) */
+} ecs_compact_stats_t;
+
+/** Index of metric in compact statistics.
+ * 
+ * @param T The statistics type (e.g. ecs_world_stats_t).
+ * @param member The metric member (e.g. performance.frame_time).
+ */
+#define ECS_STATS_METRIC_INDEX(T, member)\
+    ((int32_t)((offsetof(T, member) - offsetof(T, first_) - sizeof(int64_t)) /\
+        sizeof(ecs_metric_t)))
+
 /** Get world statistics.
  *
  * @param world The world.
@@ -409,11 +450,48 @@ void ecs_metric_copy(
     int32_t dst,
     int32_t src);
 
+/** Get sample from compact statistics.
+ *
+ * @param stats The compact statistics.
+ * @param metric Index of the metric (see ECS_STATS_METRIC_INDEX).
+ * @param age Age of the sample, where 0 is the last sample.
+ * @return The sample value, or 0 if the sample does not exist.
+ */
+FLECS_API
+ecs_float_t ecs_compact_stats_sample(
+    const ecs_compact_stats_t *stats,
+    int32_t metric,
+    int32_t age);
+
+/** Get average of samples in compact statistics.
+ *
+ * @param stats The compact statistics.
+ * @param metric Index of the metric (see ECS_STATS_METRIC_INDEX).
+ * @return Average of the recorded samples.
+ */
+FLECS_API
+ecs_float_t ecs_compact_stats_avg(
+    const ecs_compact_stats_t *stats,
+    int32_t metric);
+
+/** Get last absolute value of counter in compact statistics.
+ *
+ * @param stats The compact statistics.
+ * @param metric Index of the metric (see ECS_STATS_METRIC_INDEX).
+ * @return Absolute value of the counter at the last sample.
+ */
+FLECS_API
+double ecs_compact_stats_value(
+    const ecs_compact_stats_t *stats,
+    int32_t metric);
+
 FLECS_API extern ECS_COMPONENT_DECLARE(FlecsStats);        /**< Flecs stats module. */
 FLECS_API extern ECS_COMPONENT_DECLARE(EcsWorldStats);     /**< Component id for EcsWorldStats. */
 FLECS_API extern ECS_COMPONENT_DECLARE(EcsWorldSummary);   /**< Component id for EcsWorldSummary. */
 FLECS_API extern ECS_COMPONENT_DECLARE(EcsSystemStats);    /**< Component id for EcsSystemStats. */
 FLECS_API extern ECS_COMPONENT_DECLARE(EcsPipelineStats);  /**< Component id for EcsPipelineStats. */
+FLECS_API extern ECS_COMPONENT_DECLARE(EcsStatsSettings);  /**< Component id for EcsStatsSettings. */
+FLECS_API extern ECS_COMPONENT_DECLARE(EcsCompactStats);   /**< Component id for EcsCompactStats. */
 
 FLECS_API extern ecs_entity_t EcsPeriod1s;                 /**< Tag used for metrics collected in last second. */
 FLECS_API extern ecs_entity_t EcsPeriod1m;                 /**< Tag used for metrics collected in last minute. */
@@ -464,10 +542,92 @@ typedef struct {
     int64_t frame_count;        /**< Number of frames processed */
     int64_t command_count;      /**< Number of commands processed */
 
+    /* Statistics overhead */
+    double stats_time_total;    /**< Total time spent collecting statistics */
+    double stats_time_last;     /**< Time spent collecting statistics in last frame */
+    int64_t stats_memory;       /**< Memory used by statistics (bytes) */
+
+    /* Component records */
+    int32_t component_record_count;  /**< Number of component records */
+    int32_t pair_record_count;       /**< Number of component records for pairs */
+    int64_t component_record_memory; /**< Memory used by component records (bytes) */
+    double component_record_memory_avg; /**< Average memory used per component record (bytes) */
+
     /* Build info */
     ecs_build_info_t build_info; /**< Build info */
 } EcsWorldSummary;
 
+/** Component with settings for the stats module.
+ * The settings are stored as singleton, and can be modified with 
+ * ecs_singleton_set() to reduce the cost of collecting statistics:
+ *
+ * @code
+ * ecs_singleton_set(world, EcsStatsSettings, {
+ *   .sample_interval = 10, .compact = true, .compact_window = 16
+ * });
+ * @endcode
+ *
+ * In compact mode the history tiers (EcsPeriod1s ... EcsPeriod1w) of world and
+ * system statistics are replaced with EcsCompactStats, and pipeline statistics
+ * are not collected.
+ */
+typedef struct {
+    int32_t sample_interval;    /**< Collect statistics every N frames (default 1) */
+    bool compact;               /**< Collect compact statistics instead of history tiers */
+    int32_t compact_window;     /**< Number of samples in compact statistics (default 60) */
+} EcsStatsSettings;
+
+/** Component that stores compact statistics.
+ * Added to EcsWorld as pair with the statistics kind, for example
+ * (EcsCompactStats, EcsSystemStats). The map is indexed by the monitored 
+ * resource, which is EcsWorld for world statistics.
+ */
+typedef struct {
+    ecs_map_t stats;            /**< map<entity, ecs_compact_stats_t*> */
+} EcsCompactStats;
+
+/** Start the profiler.
+ * The profiler records the zones reported by the perf trace hooks of the OS
+ * API (see ecs_os_perf_trace_push()) for systems, merges, observers, query
+ * rematching and sorting. Events are stored in a fixed size ring buffer
+ * which overwrites the oldest events when it is full. Zones are only reported
+ * when the library is built with FLECS_PERF_TRACE.
+ *
+ * The profiler is global and records events from all threads and worlds.
+ * Previously installed perf trace hooks are still invoked.
+ *
+ * @param capacity Number of events in the ring buffer (0 for default).
+ */
+FLECS_API
+void ecs_profiler_start(
+    int32_t capacity);
+
+/** Stop the profiler.
+ * This restores the previous perf trace hooks and frees recorded events.
+ */
+FLECS_API
+void ecs_profiler_stop(void);
+
+/** Test if the profiler is running.
+ *
+ * @return Whether the profiler is running.
+ */
+FLECS_API
+bool ecs_profiler_is_running(void);
+
+/** Discard recorded profiler events. */
+FLECS_API
+void ecs_profiler_clear(void);
+
+/** Serialize recorded profiler events to Chrome trace JSON.
+ * The result can be loaded in chrome://tracing or Perfetto. Events of zones
+ * that began before the oldest event in the ring buffer are omitted.
+ *
+ * @return JSON string with the recorded events (must be freed).
+ */
+FLECS_API
+char* ecs_profiler_to_chrome_trace(void);
+
 /** Stats module import function.
  * Usage:
  * @code
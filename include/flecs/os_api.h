@@ -123,6 +123,22 @@ typedef
 void* (*ecs_os_api_task_join_t)(
     ecs_os_thread_t thread);
 
+/** Job invoked by parallel_for, once for each index. */
+typedef
+void (*ecs_os_parallel_job_t)(
+    void *ctx,
+    int32_t index);
+
+/** OS API parallel_for function type.
+ * Runs job for each index in [0, count) and returns when all invocations have
+ * finished. Invocations may run concurrently. Index 0 must be invoked on the
+ * calling thread, other indices may also run on the calling thread. */
+typedef
+void (*ecs_os_api_parallel_for_t)(
+    ecs_os_parallel_job_t job,
+    void *ctx,
+    int32_t count);
+
 /* Atomic increment / decrement */
 /** OS API ainc function type. */
 typedef
@@ -188,6 +204,13 @@ void (*ecs_os_api_sleep_t)(
     int32_t sec,
     int32_t nanosec);
 
+/** OS API sleep_until function type.
+ * Sleeps until the provided deadline, which is in nanoseconds and uses the
+ * same clock as the now function. */
+typedef
+void (*ecs_os_api_sleep_until_t)(
+    uint64_t deadline);
+
 /** OS API enable_high_timer_resolution function type. */
 typedef
 void (*ecs_os_api_enable_high_timer_resolution_t)(
@@ -333,6 +356,11 @@ typedef struct ecs_os_api_t {
 
     void *log_out_;                                /**< File used for logging output (type is FILE*)
                                                     * (hint, log_ decides where to write) */
+
+    /* Callbacks added after the initial layout are appended at the end, so
+     * that existing fields keep their offsets. */
+    ecs_os_api_parallel_for_t parallel_for_;       /**< parallel_for callback. */
+    ecs_os_api_sleep_until_t sleep_until_;         /**< sleep_until callback. */
 } ecs_os_api_t;
 
 /** Static OS API variable with configured callbacks. */
@@ -488,6 +516,7 @@ void ecs_os_set_api_defaults(void);
 /* Tasks */
 #define ecs_os_task_new(callback, param) ecs_os_api.task_new_(callback, param)
 #define ecs_os_task_join(thread) ecs_os_api.task_join_(thread)
+#define ecs_os_parallel_for(job, ctx, count) ecs_os_api.parallel_for_(job, ctx, count)
 
 /* Atomic increment / decrement */
 #define ecs_os_ainc(value) ecs_os_api.ainc_(value)
@@ -510,6 +539,7 @@ void ecs_os_set_api_defaults(void);
 
 /* Time */
 #define ecs_os_sleep(sec, nanosec) ecs_os_api.sleep_(sec, nanosec)
+#define ecs_os_sleep_until(deadline) ecs_os_api.sleep_until_(deadline)
 #define ecs_os_now() ecs_os_api.now_()
 #define ecs_os_get_time(time_out) ecs_os_api.get_time_(time_out)
 
@@ -651,11 +681,13 @@ void ecs_os_strset(
 #define ecs_os_perf_trace_pop(name)
 #endif
 
+FLECS_API
 void ecs_os_perf_trace_push_(
     const char *file,
     size_t line,
     const char *name);
 
+FLECS_API
 void ecs_os_perf_trace_pop_(
     const char *file,
     size_t line,
@@ -731,6 +763,10 @@ bool ecs_os_has_threading(void);
 FLECS_API
 bool ecs_os_has_task_support(void);
 
+/** Is the parallel_for function available? */
+FLECS_API
+bool ecs_os_has_parallel_for(void);
+
 /** Are time functions available? */
 FLECS_API
 bool ecs_os_has_time(void);
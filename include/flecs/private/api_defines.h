@@ -172,6 +172,7 @@
 #include <stdarg.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
 
 /* Non-standard but required. If not provided by platform, add manually. */
 #include <stdint.h>
@@ -24,6 +24,10 @@ extern "C" {
 #define EcsWorldMeasureSystemTime     (1u << 6)
 #define EcsWorldMultiThreaded         (1u << 7)
 #define EcsWorldFrameInProgress       (1u << 8)
+#define EcsWorldPreciseFramePacing    (1u << 9)
+#define EcsWorldPathCache             (1u << 10)
+#define EcsWorldParallelDelete        (1u << 11)
+#define EcsWorldUnionIndex            (1u << 12)
 
 ////////////////////////////////////////////////////////////////////////////////
 //// OS API flags
@@ -86,6 +90,7 @@ extern "C" {
 #define EcsIdDontFragment              (1u << 24)
 #define EcsIdMatchDontFragment         (1u << 25) /* For (*, T) wildcards */
 #define EcsIdIsUnion                   (1u << 26)
+#define EcsIdDirtyRows                 (1u << 27)
 #define EcsIdOrderedChildren           (1u << 28)
 #define EcsIdEventMask\
     (EcsIdHasOnAdd|EcsIdHasOnRemove|EcsIdHasOnSet|\
@@ -211,6 +216,7 @@ extern "C" {
 #define EcsObserverBypassQuery         (1u << 7u)  /* Don't evaluate query for multi-component observer*/
 #define EcsObserverYieldOnCreate       (1u << 8u)  /* Yield matching entities when creating observer */
 #define EcsObserverYieldOnDelete       (1u << 9u)  /* Yield matching entities when deleting observer */
+#define EcsObserverMultiThreaded       (1u << 10u) /* Observer callback can be invoked from multiple threads */
 #define EcsObserverKeepAlive           (1u << 11u) /* Observer keeps component alive (same value as EcsTermKeepAlive) */
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -249,6 +255,7 @@ extern "C" {
 #define EcsTableHasOrderedChildren     (1u << 28u)
 #define EcsTableEdgeReparent           (1u << 29u)
 #define EcsTableMarkedForDelete        (1u << 30u)
+#define EcsTableHasDirtyRows           (1u << 31u) /* Does table track changed rows */
 
 /* Composite table flags */
 #define EcsTableHasLifecycle     (EcsTableHasCtors | EcsTableHasDtors)
@@ -14,12 +14,15 @@
 extern "C" {
 #endif
 
-/** Record for entity index. */
+/** Record for entity index. 
+ * Fields used by liveliness checks and component lookups are stored first, so
+ * that they are on the same cache line. */
 struct ecs_record_t {
-    ecs_component_record_t *cr;               /**< component record to (*, entity) for target entities */
     ecs_table_t *table;                        /**< Identifies a type (and table) in world */
     uint32_t row;                              /**< Table row of the entity */
-    int32_t dense;                             /**< Index in dense array of entity index */    
+    int32_t dense;                             /**< Index in dense array of entity index */
+    uint32_t generation;                       /**< Upper 32 bits of current entity id */
+    ecs_component_record_t *cr;               /**< component record to (*, entity) for target entities */
 };
 
 /** Header for table cache elements. */
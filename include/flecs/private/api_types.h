@@ -133,6 +133,11 @@ typedef struct ecs_query_iter_t {
 
     ecs_query_op_profile_t *profile;
 
+    /* Toggle row mask (EcsQueryToggleMask) */
+    const ecs_table_t *row_mask_table;        /* Table for which mask was computed */
+    ecs_flags64_t row_mask;                   /* Matching rows, starting at row_mask_offset */
+    int32_t row_mask_offset;                  /* Table row of first bit in row_mask */
+
     int16_t op;                               /* Currently iterated query plan operation (index into ops) */
     bool iter_single_group;
 } ecs_query_iter_t;
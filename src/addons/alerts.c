@@ -9,9 +9,18 @@
 
 ECS_COMPONENT_DECLARE(FlecsAlerts);
 
+/* Alert instance bookkeeping, stored in a sparse set indexed by source */
+typedef struct flecs_alert_instance_t {
+    ecs_entity_t source;        /* Entity that triggered the alert */
+    ecs_entity_t instance;      /* Alert instance entity */
+    uint64_t table_id;          /* Table of source at last evaluation */
+    int32_t dirty_state;        /* Dirty state of member column at last evaluation */
+    bool matched;               /* Result of last evaluation */
+} flecs_alert_instance_t;
+
 typedef struct EcsAlert {
     char *message;
-    ecs_map_t instances;        /* Active instances for metric */
+    ecs_sparse_t instances;     /* Instances for metric (flecs_alert_instance_t) */
     ecs_ftime_t retain_period;  /* How long to retain the alert */
     ecs_vec_t severity_filters; /* Severity filters */
     
@@ -23,6 +32,10 @@ typedef struct EcsAlert {
     ecs_primitive_kind_t kind;  /* Primitive type kind */
     ecs_ref_t ranges;           /* Reference to ranges component */
     int32_t var_id;             /* Variable from which to obtain data (0 = $this) */
+    EcsMemberRanges prev_ranges; /* Ranges used in last evaluation */
+
+    /* Only reevaluate tables & instances that changed since last evaluation */
+    bool incremental;
 } EcsAlert;
 
 typedef struct EcsAlertTimeout {
@@ -35,14 +48,14 @@ ECS_COMPONENT_DECLARE(EcsAlertTimeout);
 static
 ECS_CTOR(EcsAlert, ptr, {
     ecs_os_zeromem(ptr);
-    ecs_map_init(&ptr->instances, NULL);
+    flecs_sparse_init_t(&ptr->instances, NULL, NULL, flecs_alert_instance_t);
     ecs_vec_init_t(NULL, &ptr->severity_filters, ecs_alert_severity_filter_t, 0);
 })
 
 static
 ECS_DTOR(EcsAlert, ptr, {
     ecs_os_free(ptr->message);
-    ecs_map_fini(&ptr->instances);
+    flecs_sparse_fini(&ptr->instances);
     ecs_vec_fini_t(NULL, &ptr->severity_filters, ecs_alert_severity_filter_t);
 })
 
@@ -52,9 +65,9 @@ ECS_MOVE(EcsAlert, dst, src, {
     dst->message = src->message;
     src->message = NULL;
 
-    ecs_map_fini(&dst->instances);
+    flecs_sparse_fini(&dst->instances);
     dst->instances = src->instances;
-    src->instances = (ecs_map_t){0};
+    src->instances = (ecs_sparse_t){0};
 
     ecs_vec_fini_t(NULL, &dst->severity_filters, ecs_alert_severity_filter_t);
     dst->severity_filters = src->severity_filters;
@@ -68,6 +81,8 @@ ECS_MOVE(EcsAlert, dst, src, {
     dst->kind = src->kind;
     dst->ranges = src->ranges;
     dst->var_id = src->var_id;
+    dst->prev_ranges = src->prev_ranges;
+    dst->incremental = src->incremental;
 })
 
 static
@@ -194,7 +209,7 @@ ecs_entity_t flecs_alert_get_severity(
 
 static
 ecs_entity_t flecs_alert_out_of_range_kind(
-    EcsAlert *alert,
+    const EcsAlert *alert,
     const EcsMemberRanges *ranges,
     const void *value_ptr)
 {
@@ -237,11 +252,141 @@ ecs_entity_t flecs_alert_out_of_range_kind(
     }
 }
 
+static
+flecs_alert_instance_t* flecs_alert_get_instance(
+    EcsAlert *alert,
+    ecs_entity_t source)
+{
+    flecs_alert_instance_t *inst = flecs_sparse_get_t(
+        &alert->instances, flecs_alert_instance_t, source);
+    if (inst && inst->source != source) {
+        /* Instance was created for a deleted entity with the same index */
+        return NULL;
+    }
+    return inst;
+}
+
+static
+void flecs_alert_add_instance(
+    EcsAlert *alert,
+    ecs_entity_t source,
+    ecs_entity_t instance)
+{
+    flecs_alert_instance_t *inst = flecs_sparse_get_t(
+        &alert->instances, flecs_alert_instance_t, source);
+    if (!inst) {
+        inst = flecs_sparse_insert_t(
+            &alert->instances, flecs_alert_instance_t, source);
+    }
+    ecs_assert(inst != NULL, ECS_INTERNAL_ERROR, NULL);
+    inst->source = source;
+    inst->instance = instance;
+    inst->table_id = 0;
+    inst->dirty_state = -1; /* Force evaluation */
+    inst->matched = false;
+}
+
+static
+void flecs_alert_remove_instance(
+    EcsAlert *alert,
+    ecs_entity_t source,
+    ecs_entity_t instance)
+{
+    flecs_alert_instance_t *inst = flecs_alert_get_instance(alert, source);
+    if (inst && inst->instance == instance) {
+        flecs_sparse_remove_t(&alert->instances, flecs_alert_instance_t, source);
+    }
+}
+
+/* Force evaluation of all alert instances, used when member ranges change */
+static
+void flecs_alert_reset_instances(
+    EcsAlert *alert)
+{
+    int32_t i, count = flecs_sparse_count(&alert->instances);
+    for (i = 0; i < count; i ++) {
+        flecs_alert_instance_t *inst = flecs_sparse_get_dense_t(
+            &alert->instances, flecs_alert_instance_t, i);
+        inst->dirty_state = -1;
+    }
+}
+
+/* Get dirty state of the table column with the monitored member */
+static
+int32_t flecs_alert_dirty_state(
+    ecs_world_t *world,
+    const EcsAlert *alert,
+    ecs_table_t *table)
+{
+    if (!alert->id) {
+        return 0;
+    }
+
+    int32_t column = ecs_table_get_column_index(world, table, alert->id);
+    if (column == -1) {
+        return 0;
+    }
+
+    return flecs_table_get_dirty_state(world, table)[column + 1];
+}
+
+/* An alert can be evaluated incrementally if whether an entity matches only
+ * depends on the table of the entity, and on the value of a member that is
+ * stored in a table column which is monitored by the alert query. */
+static
+bool flecs_alert_is_incremental(
+    const ecs_query_t *q,
+    const EcsAlert *alert)
+{
+    if (q->cache_kind == EcsQueryCacheNone) {
+        return false;
+    }
+
+    if (!(q->flags & EcsQueryIsCacheable) || 
+        !(q->flags & EcsQueryMatchOnlySelf)) 
+    {
+        return false;
+    }
+
+    if (q->var_count > 1) {
+        return false;
+    }
+
+    int32_t i;
+    for (i = 0; i < q->term_count; i ++) {
+        const ecs_term_t *term = &q->terms[i];
+        if (term->flags_ & (EcsTermIsToggle|EcsTermIsSparse|EcsTermDontFragment)) {
+            return false;
+        }
+    }
+
+    if (!alert->id) {
+        return true;
+    }
+
+    if (alert->var_id) {
+        return false;
+    }
+
+    for (i = 0; i < q->term_count; i ++) {
+        const ecs_term_t *term = &q->terms[i];
+        if (term->id != alert->id || term->oper == EcsNot) {
+            continue;
+        }
+        if (q->read_fields & (1llu << term->field_index)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 static
 void MonitorAlerts(ecs_iter_t *it) {
     ecs_world_t *world = it->real_world;
     EcsAlert *alert = ecs_field(it, EcsAlert, 0);
     EcsPoly *poly = ecs_field(it, EcsPoly, 1);
+    EcsAlertStats *stats = ecs_field(it, EcsAlertStats, 2);
 
     int32_t i, count = it->count;
     for (i = 0; i < count; i ++) {
@@ -255,16 +400,38 @@ void MonitorAlerts(ecs_iter_t *it) {
 
         flecs_poly_assert(q, ecs_query_t);
 
+        ecs_time_t start = {0};
+        if (stats) {
+            ecs_time_measure(&start);
+        }
+
         ecs_id_t member_id = alert[i].id;
         const EcsMemberRanges *ranges = NULL;
+        bool incremental = alert[i].incremental;
         if (member_id) {
             ranges = ecs_ref_get(world, &alert[i].ranges, EcsMemberRanges);
+            if (ranges && ecs_os_memcmp_t(
+                ranges, &alert[i].prev_ranges, EcsMemberRanges)) 
+            {
+                /* Ranges changed, reevaluate all tables and instances */
+                alert[i].prev_ranges = *ranges;
+                flecs_alert_reset_instances(&alert[i]);
+                incremental = false;
+            }
         }
 
+        int32_t tables_evaluated = 0, tables_skipped = 0;
         ecs_iter_t rit = ecs_query_iter(world, q);
         rit.flags |= EcsIterNoData;
 
         while (ecs_query_next(&rit)) {
+            if (incremental && !ecs_iter_changed(&rit)) {
+                tables_skipped ++;
+                continue;
+            }
+
+            tables_evaluated ++;
+
             ecs_entity_t severity = flecs_alert_get_severity(
                 world, &rit, &alert[i]);
             if (!severity) {
@@ -311,9 +478,9 @@ void MonitorAlerts(ecs_iter_t *it) {
                     }
                 }
 
-                ecs_entity_t *aptr = ecs_map_ensure(&alert[i].instances, e);
-                ecs_assert(aptr != NULL, ECS_INTERNAL_ERROR, NULL);
-                if (!aptr[0]) {
+                flecs_alert_instance_t *inst = flecs_alert_get_instance(
+                    &alert[i], e);
+                if (!inst) {
                     /* Alert does not yet exist for entity */
                     ecs_entity_t ai = ecs_new_w_pair(world, EcsChildOf, a);
                     ecs_set(world, ai, EcsAlertInstance, { .message = NULL });
@@ -330,21 +497,95 @@ void MonitorAlerts(ecs_iter_t *it) {
                     ecs_defer_suspend(it->world);
                     flecs_alerts_add_alert_to_src(world, e, a, ai);
                     ecs_defer_resume(it->world);
-                    aptr[0] = ai;
+                    flecs_alert_add_instance(&alert[i], e, ai);
                 } else {
                     /* Make sure alert severity is up to date */
                     if (ecs_vec_count(&alert[i].severity_filters) || member_data) {
                         ecs_entity_t cur_severity = ecs_get_target(
-                            world, aptr[0], ecs_id(EcsAlert), 0);
+                            world, inst->instance, ecs_id(EcsAlert), 0);
                         if (cur_severity != src_severity) {
-                            ecs_add_pair(world, aptr[0], ecs_id(EcsAlert), 
-                                src_severity);
+                            ecs_add_pair(world, inst->instance, 
+                                ecs_id(EcsAlert), src_severity);
                         }
                     }
                 }
             }
         }
+
+        if (stats) {
+            double eval_time = ecs_time_measure(&start);
+            stats[i].eval_time = eval_time;
+            stats[i].eval_time_total += eval_time;
+            stats[i].tables_evaluated = tables_evaluated;
+            stats[i].tables_skipped = tables_skipped;
+            stats[i].instances_evaluated = 0;
+            stats[i].instances_skipped = 0;
+            stats[i].incremental = alert[i].incremental;
+        }
+    }
+}
+
+/* Test if alert instance still matches the alert query. */
+static
+bool flecs_alert_instance_match(
+    ecs_world_t *world,
+    const EcsAlert *alert,
+    const ecs_query_t *query,
+    const EcsMemberRanges *ranges,
+    EcsAlertInstance *alert_instance,
+    ecs_script_vars_t *vars,
+    ecs_entity_t e)
+{
+    ecs_iter_t rit = ecs_query_iter(world, query);
+    rit.flags |= EcsIterNoData;
+    ecs_iter_set_var(&rit, 0, e);
+
+    if (!ecs_query_next(&rit)) {
+        return false;
+    }
+
+    /* If alert is monitoring member range, test value against range */
+    if (ranges) {
+        ecs_entity_t member_src = e;
+        if (alert->var_id) {
+            member_src = ecs_iter_get_var(&rit, alert->var_id);
+        }
+
+        const void *member_data = ecs_get_id(world, member_src, alert->id);
+        if (!member_data) {
+            ecs_iter_fini(&rit);
+            return false;
+        }
+
+        member_data = ECS_OFFSET(member_data, alert->offset);
+        if (flecs_alert_out_of_range_kind(alert, ranges, member_data) == 0) {
+            ecs_iter_fini(&rit);
+            return false;
+        }
+    }
+
+    bool generate_message = alert->message;
+    if (generate_message) {
+        if (alert_instance->message) {
+            /* If a message was already generated, only regenerate if
+             * query has multiple variables. Variable values could have 
+             * changed, this ensures the message remains up to date. */
+            generate_message = ecs_iter_get_var_count(&rit) > 1;
+        }
     }
+
+    if (generate_message) {
+        if (alert_instance->message) {
+            ecs_os_free(alert_instance->message);
+        }
+
+        ecs_script_vars_from_iter(&rit, vars, 0);
+        alert_instance->message = ecs_script_string_interpolate(
+            world, alert->message, vars);
+    }
+
+    ecs_iter_fini(&rit);
+    return true;
 }
 
 static
@@ -379,12 +620,18 @@ void MonitorAlertInstances(ecs_iter_t *it) {
 
     flecs_poly_assert(query, ecs_query_t);
 
-    ecs_id_t member_id = alert->id;
+    ecs_time_t start = {0};
+    EcsAlertStats *stats = ecs_get_mut(world, parent, EcsAlertStats);
+    if (stats) {
+        ecs_time_measure(&start);
+    }
+
     const EcsMemberRanges *ranges = NULL;
-    if (member_id) {
+    if (alert->id) {
         ranges = ecs_ref_get(world, &alert->ranges, EcsMemberRanges);
     }
 
+    int32_t instances_evaluated = 0, instances_skipped = 0;
     ecs_script_vars_t *vars = ecs_script_vars_init(it->world);
     int32_t i, count = it->count;
     for (i = 0; i < count; i ++) {
@@ -394,78 +641,54 @@ void MonitorAlertInstances(ecs_iter_t *it) {
         /* If source of alert is no longer alive, delete alert instance even if
          * the alert has a retain period. */
         if (!ecs_is_alive(world, e)) {
+            flecs_alert_remove_instance(alert, e, ai);
             ecs_delete(world, ai);
             continue;
         }
 
-        /* Check if alert instance still matches query */
-        ecs_iter_t rit = ecs_query_iter(world, query);
-        rit.flags |= EcsIterNoData;
-        ecs_iter_set_var(&rit, 0, e);
-
-        if (ecs_query_next(&rit)) {
-            bool match = true;
-
-            /* If alert is monitoring member range, test value against range */
-            if (ranges) {
-                ecs_entity_t member_src = e;
-                if (alert->var_id) {
-                    member_src = ecs_iter_get_var(&rit, alert->var_id);
-                }
+        /* If the table and monitored member of an incremental alert didn't 
+         * change since the last evaluation, reuse the previous result. */
+        ecs_table_t *table = flecs_entities_get(world, e)->table;
+        flecs_alert_instance_t *inst = NULL;
+        if (alert->incremental) {
+            inst = flecs_alert_get_instance(alert, e);
+        }
 
-                const void *member_data = ecs_get_id(
-                    world, member_src, member_id);
-                if (!member_data) {
-                    match = false;
-                } else {
-                    member_data = ECS_OFFSET(member_data, alert->offset);
-                    if (flecs_alert_out_of_range_kind(
-                        alert, ranges, member_data) == 0) 
-                    {
-                        match = false;
-                    }
-                }
+        bool match;
+        if (inst && inst->table_id == table->id && 
+            inst->dirty_state == flecs_alert_dirty_state(world, alert, table) &&
+            (alert_instance[i].message || !alert->message))
+        {
+            match = inst->matched;
+            instances_skipped ++;
+        } else {
+            /* Check if alert instance still matches query */
+            match = flecs_alert_instance_match(world, alert, query, ranges,
+                &alert_instance[i], vars, e);
+            if (inst) {
+                inst->table_id = table->id;
+                inst->dirty_state = flecs_alert_dirty_state(
+                    world, alert, table);
+                inst->matched = match;
             }
+            instances_evaluated ++;
+        }
 
-            if (match) {
-                /* Only increase alert duration if the alert was active */
-                value[i].value += (double)it->delta_system_time;
-
-                bool generate_message = alert->message;
-                if (generate_message) {
-                    if (alert_instance[i].message) {
-                        /* If a message was already generated, only regenerate if
-                        * query has multiple variables. Variable values could have 
-                        * changed, this ensures the message remains up to date. */
-                        generate_message = ecs_iter_get_var_count(&rit) > 1;
-                    }
-                }
-
-                if (generate_message) {
-                    if (alert_instance[i].message) {
-                        ecs_os_free(alert_instance[i].message);
-                    }
+        if (match) {
+            /* Only increase alert duration if the alert was active */
+            value[i].value += (double)it->delta_system_time;
 
-                    ecs_script_vars_from_iter(&rit, vars, 0);
-                    alert_instance[i].message = ecs_script_string_interpolate(
-                        world, alert->message, vars);
+            if (timeout) {
+                if (ECS_NEQZERO(timeout[i].inactive_time)) {
+                    /* The alert just became active. Remove Disabled tag */
+                    flecs_alerts_add_alert_to_src(world, e, parent, ai);
+                    ecs_remove_id(world, ai, EcsDisabled);
                 }
-
-                if (timeout) {
-                    if (ECS_NEQZERO(timeout[i].inactive_time)) {
-                        /* The alert just became active. Remove Disabled tag */
-                        flecs_alerts_add_alert_to_src(world, e, parent, ai);
-                        ecs_remove_id(world, ai, EcsDisabled);
-                    }
-                    timeout[i].inactive_time = 0;
-                }
-
-                /* Alert instance still matches query, keep it alive */
-                ecs_iter_fini(&rit);
-                continue;
+                timeout[i].inactive_time = 0;
             }
 
-            ecs_iter_fini(&rit);
+            /* Alert instance still matches query, keep it alive */
+            continue;
         }
 
         /* Alert instance is no longer active */
@@ -486,11 +709,19 @@ void MonitorAlertInstances(ecs_iter_t *it) {
 
         /* Alert instance no longer matches query, remove it */ 
         flecs_alerts_remove_alert_from_src(world, e, parent);
-        ecs_map_remove(&alert->instances, e);
+        flecs_alert_remove_instance(alert, e, ai);
         ecs_delete(world, ai);
     }
 
     ecs_script_vars_fini(vars);
+
+    if (stats) {
+        double eval_time = ecs_time_measure(&start);
+        stats->eval_time += eval_time;
+        stats->eval_time_total += eval_time;
+        stats->instances_evaluated += instances_evaluated;
+        stats->instances_skipped += instances_skipped;
+    }
 }
 
 ecs_entity_t ecs_alert_init(
@@ -511,6 +742,10 @@ ecs_entity_t ecs_alert_init(
 
     ecs_query_desc_t private_desc = desc->query;
     private_desc.entity = result;
+    if (desc->incremental && private_desc.cache_kind != EcsQueryCacheNone) {
+        /* Used to only reevaluate tables that changed */
+        private_desc.flags |= EcsQueryDetectChanges;
+    }
 
     ecs_query_t *q = ecs_query_init(world, &private_desc);
     if (!q) {
@@ -617,10 +852,18 @@ ecs_entity_t ecs_alert_init(
         alert->kind = pr->kind;
         alert->ranges = ecs_ref_init(world, desc->member, EcsMemberRanges);
         alert->var_id = var_id;
+        alert->prev_ranges = *ecs_get(world, desc->member, EcsMemberRanges);
     }
 
+    alert->incremental = desc->incremental && 
+        flecs_alert_is_incremental(q, alert);
+
     ecs_modified(world, result, EcsAlert);
 
+    ecs_set(world, result, EcsAlertStats, { 
+        .incremental = alert->incremental 
+    });
+
     /* Register alert as metric */
     ecs_add(world, result, EcsMetric);
     ecs_add_pair(world, result, EcsMetric, EcsCounter);
@@ -724,6 +967,7 @@ void FlecsAlertsImport(ecs_world_t *world) {
     ecs_set_name_prefix(world, "EcsAlert");
     ECS_COMPONENT_DEFINE(world, EcsAlertInstance);
     ECS_COMPONENT_DEFINE(world, EcsAlertTimeout);
+    ECS_COMPONENT_DEFINE(world, EcsAlertStats);
 
     ECS_TAG_DEFINE(world, EcsAlertInfo);
     ECS_TAG_DEFINE(world, EcsAlertWarning);
@@ -741,6 +985,19 @@ void FlecsAlertsImport(ecs_world_t *world) {
         }
     });
 
+    ecs_struct(world, {
+        .entity = ecs_id(EcsAlertStats),
+        .members = {
+            { .name = "eval_time", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds },
+            { .name = "eval_time_total", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds },
+            { .name = "tables_evaluated", .type = ecs_id(ecs_i32_t) },
+            { .name = "tables_skipped", .type = ecs_id(ecs_i32_t) },
+            { .name = "instances_evaluated", .type = ecs_id(ecs_i32_t) },
+            { .name = "instances_skipped", .type = ecs_id(ecs_i32_t) },
+            { .name = "incremental", .type = ecs_id(ecs_bool_t) }
+        }
+    });
+
     ecs_set_hooks(world, EcsAlert, {
         .ctor = ecs_ctor(EcsAlert),
         .dtor = ecs_dtor(EcsAlert),
@@ -771,7 +1028,8 @@ void FlecsAlertsImport(ecs_world_t *world) {
 
     ECS_SYSTEM(world, MonitorAlerts, EcsPreStore, 
         Alert, 
-        (Poly, Query));
+        (Poly, Query),
+        ?Stats);
 
     ECS_SYSTEM(world, MonitorAlertInstances, EcsOnStore, Instance, 
         flecs.metrics.Source, 
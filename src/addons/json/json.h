@@ -206,6 +206,16 @@ int flecs_json_serialize_iter_result(
     const ecs_iter_to_json_desc_t *desc,
     ecs_json_ser_ctx_t *ser_ctx);
 
+/* Serialize count rows of iterator result, starting from row */
+int flecs_json_serialize_iter_result_rows(
+    const ecs_world_t *world,
+    const ecs_iter_t *it,
+    ecs_strbuf_t *buf,
+    const ecs_iter_to_json_desc_t *desc,
+    ecs_json_ser_ctx_t *ser_ctx,
+    int32_t row,
+    int32_t count);
+
 void flecs_json_serialize_field(
     const ecs_world_t *world,
     const ecs_iter_t *it,
@@ -244,6 +254,7 @@ int flecs_json_serialize_iter_result_table(
     const ecs_iter_t *it, 
     ecs_strbuf_t *buf,
     const ecs_iter_to_json_desc_t *desc,
+    int32_t row,
     int32_t count,
     bool has_this,
     const char *parent_path,
@@ -255,6 +266,7 @@ int flecs_json_serialize_iter_result_query(
     ecs_strbuf_t *buf,
     ecs_json_ser_ctx_t *ser_ctx,
     const ecs_iter_to_json_desc_t *desc,
+    int32_t row,
     int32_t count,
     bool has_this,
     const char *parent_path,
@@ -8,6 +8,10 @@
 
 #ifdef FLECS_JSON
 
+#ifdef FLECS_PIPELINE
+#include "../pipeline/pipeline.h"
+#endif
+
 static
 void flecs_json_serialize_id_str(
     const ecs_world_t *world,
@@ -274,6 +278,258 @@ void flecs_iter_free_ser_ctx(
     }
 }
 
+static
+void flecs_json_init_ser_ctx(
+    const ecs_world_t *world,
+    ecs_json_ser_ctx_t *ser_ctx)
+{
+    /* Cache component record for flecs.doc ids */
+    ecs_os_zeromem(ser_ctx);
+#ifdef FLECS_DOC
+    ser_ctx->cr_doc_name = flecs_components_get(world, 
+        ecs_pair_t(EcsDocDescription, EcsName));
+    ser_ctx->cr_doc_color = flecs_components_get(world, 
+        ecs_pair_t(EcsDocDescription, EcsDocColor));
+#else
+    (void)world;
+#endif
+}
+
+#ifdef FLECS_PIPELINE
+
+/* Max number of rows in a chunk of a result that's serialized by a worker */
+#define FLECS_JSON_PARALLEL_CHUNK_SIZE (1024)
+
+/* Rows of a query result that are serialized by a single worker */
+typedef struct ecs_json_chunk_t {
+    int32_t result;             /* Index of result in query iteration */
+    int32_t row;                /* First row in result */
+    int32_t count;              /* Number of rows */
+    int32_t worker;             /* Worker that serialized the chunk */
+    int32_t offset;             /* Offset of chunk in worker output */
+    int32_t length;             /* Length of chunk in worker output */
+} ecs_json_chunk_t;
+
+typedef struct ecs_json_worker_t {
+    ecs_strbuf_t buf;           /* Output of chunks serialized by worker */
+    char *json;                 /* Buffer contents after worker is done */
+    bool error;
+} ecs_json_worker_t;
+
+typedef struct ecs_json_parallel_ctx_t {
+    ecs_world_t *world;
+    ecs_query_t *query;
+    const ecs_iter_to_json_desc_t *desc;
+    ecs_flags32_t iter_flags;   /* Flags to copy to worker iterators */
+    ecs_json_chunk_t *chunks;
+    int32_t chunk_count;
+    int32_t next_chunk;         /* Next chunk to claim by a worker */
+    ecs_json_worker_t *workers;
+} ecs_json_parallel_ctx_t;
+
+static
+bool flecs_json_can_serialize_parallel(
+    const ecs_world_t *world,
+    const ecs_iter_t *it,
+    const ecs_iter_to_json_desc_t *desc)
+{
+    if (!desc || !desc->parallel || desc->dont_serialize_results) {
+        return false;
+    }
+
+    if (ecs_get_stage_count(world) <= 1) {
+        return false;
+    }
+
+    if (world->flags & EcsWorldReadonly || ecs_is_deferred(world)) {
+        return false;
+    }
+
+    /* Workers create their own iterators for the query, which is only 
+     * possible if the iterator is a query iterator that hasn't started yet 
+     * and that has no constraints that only exist on the iterator. */
+    if (it->next != ecs_query_next || !it->query || it->world != world) {
+        return false;
+    }
+
+    if (it->flags & EcsIterIsValid || it->constrained_vars) {
+        return false;
+    }
+
+    if (it->priv_.iter.query.iter_single_group) {
+        return false;
+    }
+
+    return true;
+}
+
+/* Split query results into chunks. Chunks are claimed by workers in order,
+ * which lets each worker iterate the query once while skipping results that
+ * were claimed by other workers. */
+static
+void flecs_json_parallel_chunks(
+    ecs_json_parallel_ctx_t *ctx,
+    ecs_vec_t *chunks)
+{
+    ecs_world_t *world = ctx->world;
+    ecs_iter_t qit = ecs_query_iter(world, ctx->query);
+    ECS_BIT_SET(qit.flags, EcsIterNoData);
+
+    int32_t result = 0;
+    while (ecs_query_next(&qit)) {
+        int32_t row = 0, count = qit.count;
+        do {
+            ecs_json_chunk_t *chunk = ecs_vec_append_t(
+                NULL, chunks, ecs_json_chunk_t);
+            ecs_os_zeromem(chunk);
+            chunk->result = result;
+            chunk->row = row;
+            chunk->count = count - row;
+            if (chunk->count > FLECS_JSON_PARALLEL_CHUNK_SIZE) {
+                chunk->count = FLECS_JSON_PARALLEL_CHUNK_SIZE;
+            }
+            row += chunk->count;
+        } while (row < count);
+
+        result ++;
+    }
+
+    ctx->chunks = ecs_vec_first_t(chunks, ecs_json_chunk_t);
+    ctx->chunk_count = ecs_vec_count(chunks);
+}
+
+static
+void flecs_json_parallel_job(
+    void *ptr,
+    int32_t worker_index)
+{
+    ecs_json_parallel_ctx_t *ctx = ptr;
+    ecs_json_worker_t *worker = &ctx->workers[worker_index];
+    ecs_world_t *stage = ecs_get_stage(ctx->world, worker_index);
+    ecs_strbuf_t *buf = &worker->buf;
+
+    ecs_json_ser_ctx_t ser_ctx;
+    flecs_json_init_ser_ctx(ctx->world, &ser_ctx);
+
+    ecs_iter_t it = ecs_query_iter(stage, ctx->query);
+    it.flags |= ctx->iter_flags;
+
+    bool valid = true;
+    int32_t result = -1, chunk_index;
+    while ((chunk_index = ecs_os_ainc(&ctx->next_chunk) - 1) < 
+        ctx->chunk_count) 
+    {
+        ecs_json_chunk_t *chunk = &ctx->chunks[chunk_index];
+        while (valid && (result < chunk->result)) {
+            valid = ecs_query_next(&it);
+            result ++;
+        }
+
+        if (!valid) {
+            /* Query returned fewer results than when chunks were created */
+            ecs_assert(false, ECS_INTERNAL_ERROR, NULL);
+            worker->error = true;
+            break;
+        }
+
+        chunk->worker = worker_index;
+        chunk->offset = ecs_strbuf_written(buf);
+
+        /* Use same separator as results array. Chunks are joined with a
+         * separator when all workers are done. */
+        ecs_strbuf_list_push(buf, "", ", ");
+        if (flecs_json_serialize_iter_result_rows(ctx->world, &it, buf, 
+            ctx->desc, &ser_ctx, chunk->row, chunk->count)) 
+        {
+            worker->error = true;
+            break;
+        }
+        ecs_strbuf_list_pop(buf, "");
+
+        chunk->length = ecs_strbuf_written(buf) - chunk->offset;
+    }
+
+    if (valid) {
+        ecs_iter_fini(&it);
+    }
+
+    int32_t f, field_count = ctx->query->field_count;
+    for (f = 0; f < field_count; f ++) {
+        ecs_os_free(ser_ctx.value_ctx[f].id_label);
+    }
+
+    worker->json = ecs_strbuf_get(buf);
+}
+
+/* Serialize results on worker threads into a buffer per worker, then append
+ * serialized chunks to the output in the order of the query results. */
+static
+int flecs_json_serialize_results_parallel(
+    ecs_world_t *world,
+    ecs_iter_t *it,
+    ecs_strbuf_t *buf,
+    const ecs_iter_to_json_desc_t *desc)
+{
+    ecs_query_t *q = ECS_CONST_CAST(ecs_query_t*, it->query);
+    int32_t i, worker_count = ecs_get_stage_count(world);
+    int result = 0;
+
+    ecs_json_parallel_ctx_t ctx = {
+        .world = world,
+        .query = q,
+        .desc = desc,
+        .iter_flags = it->flags & EcsIterNoData
+    };
+
+    /* Workers iterate the query, which shouldn't count as evaluations */
+    int32_t eval_count = q->eval_count;
+
+    /* Make sure query caches are up to date before creating chunks */
+    ecs_run_aperiodic(world, 0);
+
+    ecs_iter_fini(it);
+
+    ecs_vec_t chunks;
+    ecs_vec_init_t(NULL, &chunks, ecs_json_chunk_t, 0);
+    flecs_json_parallel_chunks(&ctx, &chunks);
+
+    ctx.workers = ecs_os_calloc_n(ecs_json_worker_t, worker_count);
+
+    flecs_workers_run(world, flecs_json_parallel_job, &ctx);
+
+    q->eval_count = eval_count;
+
+    for (i = 0; i < worker_count; i ++) {
+        if (ctx.workers[i].error) {
+            result = -1;
+            goto done;
+        }
+    }
+
+    for (i = 0; i < ctx.chunk_count; i ++) {
+        ecs_json_chunk_t *chunk = &ctx.chunks[i];
+        if (!chunk->length) {
+            continue;
+        }
+
+        flecs_json_next(buf);
+        ecs_strbuf_appendstrn(buf, 
+            &ctx.workers[chunk->worker].json[chunk->offset], chunk->length);
+    }
+
+done:
+    for (i = 0; i < worker_count; i ++) {
+        ecs_os_free(ctx.workers[i].json);
+    }
+
+    ecs_os_free(ctx.workers);
+    ecs_vec_fini_t(NULL, &chunks, ecs_json_chunk_t);
+
+    return result;
+}
+
+#endif
+
 int ecs_iter_to_json_buf(
     ecs_iter_t *it,
     ecs_strbuf_t *buf,
@@ -281,15 +537,8 @@ int ecs_iter_to_json_buf(
 {
     ecs_world_t *world = it->real_world;
 
-    /* Cache component record for flecs.doc ids */
     ecs_json_ser_ctx_t ser_ctx;
-    ecs_os_zeromem(&ser_ctx);
-#ifdef FLECS_DOC
-    ser_ctx.cr_doc_name = flecs_components_get(world, 
-        ecs_pair_t(EcsDocDescription, EcsName));
-    ser_ctx.cr_doc_color = flecs_components_get(world, 
-        ecs_pair_t(EcsDocDescription, EcsDocColor));
-#endif
+    flecs_json_init_ser_ctx(world, &ser_ctx);
 
     flecs_json_object_push(buf);
 
@@ -329,13 +578,25 @@ int ecs_iter_to_json_buf(
             ECS_BIT_SET(it->flags, EcsIterNoData);
         }
 
-        ecs_iter_next_action_t next = it->next;
-        while (next(it)) {
-            if (flecs_json_serialize_iter_result(world, it, buf, desc, &ser_ctx)) {
-                ecs_strbuf_reset(buf);
-                flecs_iter_free_ser_ctx(it, &ser_ctx);
-                ecs_iter_fini(it);
-                return -1;
+        bool parallel = false;
+#ifdef FLECS_PIPELINE
+        parallel = flecs_json_can_serialize_parallel(world, it, desc);
+        if (parallel) {
+            if (flecs_json_serialize_results_parallel(world, it, buf, desc)) {
+                goto error;
+            }
+        }
+#endif
+
+        if (!parallel) {
+            ecs_iter_next_action_t next = it->next;
+            while (next(it)) {
+                if (flecs_json_serialize_iter_result(
+                    world, it, buf, desc, &ser_ctx)) 
+                {
+                    ecs_iter_fini(it);
+                    goto error;
+                }
             }
         }
 
@@ -349,6 +610,10 @@ int ecs_iter_to_json_buf(
     flecs_json_object_pop(buf);
 
     return 0;
+error:
+    ecs_strbuf_reset(buf);
+    flecs_iter_free_ser_ctx(it, &ser_ctx);
+    return -1;
 }
 
 char* ecs_iter_to_json(
@@ -409,22 +409,26 @@ void flecs_json_serialize_iter_this(
     }
 }
 
-int flecs_json_serialize_iter_result(
+int flecs_json_serialize_iter_result_rows(
     const ecs_world_t *world, 
     const ecs_iter_t *it, 
     ecs_strbuf_t *buf,
     const ecs_iter_to_json_desc_t *desc,
-    ecs_json_ser_ctx_t *ser_ctx)
+    ecs_json_ser_ctx_t *ser_ctx,
+    int32_t row,
+    int32_t count)
 {
     char *parent_path = NULL;
     ecs_json_this_data_t this_data = {0};
 
-    int32_t count = it->count;
     bool has_this = true;
-    if (!count) {
+    if (!it->count) {
+        row = 0;
         count = 1; /* Query without this variable */
         has_this = false;
     } else {
+        ecs_assert(row >= 0, ECS_INTERNAL_ERROR, NULL);
+        ecs_assert((row + count) <= it->count, ECS_INTERNAL_ERROR, NULL);
         ecs_table_t *table = it->table;
         if (table) {
             this_data.ids = &ecs_table_entities(table)[it->offset];
@@ -477,13 +481,13 @@ int flecs_json_serialize_iter_result(
 
     if (desc && desc->serialize_table) {
         if (flecs_json_serialize_iter_result_table(world, it, buf, 
-            desc, count, has_this, parent_path, &this_data))
+            desc, row, count, has_this, parent_path, &this_data))
         {
             goto error;
         }
     } else {
         if (flecs_json_serialize_iter_result_query(world, it, buf, ser_ctx, 
-            desc, count, has_this, parent_path, &this_data))
+            desc, row, count, has_this, parent_path, &this_data))
         {
             goto error;
         }
@@ -496,4 +500,15 @@ error:
     return -1;
 }
 
+int flecs_json_serialize_iter_result(
+    const ecs_world_t *world, 
+    const ecs_iter_t *it, 
+    ecs_strbuf_t *buf,
+    const ecs_iter_to_json_desc_t *desc,
+    ecs_json_ser_ctx_t *ser_ctx)
+{
+    return flecs_json_serialize_iter_result_rows(
+        world, it, buf, desc, ser_ctx, 0, it->count);
+}
+
 #endif
@@ -227,6 +227,7 @@ int flecs_json_serialize_iter_result_query(
     ecs_strbuf_t *buf,
     ecs_json_ser_ctx_t *ser_ctx,
     const ecs_iter_to_json_desc_t *desc,
+    int32_t row,
     int32_t count,
     bool has_this,
     const char *parent_path,
@@ -244,8 +245,8 @@ int flecs_json_serialize_iter_result_query(
         common_data = ecs_strbuf_get(&common_data_buf);
     }
 
-    int32_t i;
-    for (i = 0; i < count; i ++) {
+    int32_t i, end = row + count;
+    for (i = row; i < end; i ++) {
         flecs_json_next(buf);
         flecs_json_object_push(buf);
 
@@ -448,6 +448,7 @@ int flecs_json_serialize_iter_result_table(
     const ecs_iter_t *it, 
     ecs_strbuf_t *buf,
     const ecs_iter_to_json_desc_t *desc,
+    int32_t row,
     int32_t count,
     bool has_this,
     const char *parent_path,
@@ -479,9 +480,9 @@ int flecs_json_serialize_iter_result_table(
     ecs_json_value_ser_ctx_t values_ctx[FLECS_JSON_MAX_TABLE_COMPONENTS] = {{0}};
     int32_t component_count = 0;
 
-    int32_t i, end = it->offset + count;
+    int32_t i, end = it->offset + row + count;
     int result = 0;
-    for (i = it->offset; i < end; i ++) {
+    for (i = it->offset + row; i < end; i ++) {
         flecs_json_next(buf);
         flecs_json_object_push(buf);
 
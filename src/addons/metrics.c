@@ -7,6 +7,9 @@
 
 #ifdef FLECS_METRICS
 
+#include <ctype.h> // isdigit, isalnum
+#include <math.h> // isinf, used by ecs_os_isinf
+
 /* Public components */
 ECS_COMPONENT_DECLARE(FlecsMetrics);
 ECS_TAG_DECLARE(EcsMetricInstance);
@@ -27,6 +30,8 @@ static ECS_COMPONENT_DECLARE(EcsMetricCountTargets);
 static ECS_COMPONENT_DECLARE(EcsMetricMemberInstance);
 static ECS_COMPONENT_DECLARE(EcsMetricIdInstance);
 static ECS_COMPONENT_DECLARE(EcsMetricOneOfInstance);
+static ECS_COMPONENT_DECLARE(EcsMetricLabel);
+static ECS_COMPONENT_DECLARE(EcsMetricExporter);
 
 /** Context for metric */
 typedef struct {
@@ -105,6 +110,20 @@ typedef struct {
     ecs_oneof_metric_ctx_t *ctx;
 } EcsMetricOneOfInstance;
 
+/** Labels of metric instance in Prometheus format, cached between scrapes */
+typedef struct {
+    char *value;                     /**< Serialized labels, without braces */
+    ecs_size_t length;               /**< Length of value */
+    ecs_entity_t source;             /**< Source for which value was created */
+} EcsMetricLabel;
+
+/** State reused between Prometheus scrapes */
+typedef struct {
+    ecs_query_t *query;              /**< Query for metric instances */
+    char *buf;                       /**< Output of last scrape */
+    ecs_size_t size;                 /**< Size of output buffer */
+} EcsMetricExporter;
+
 /** Component lifecycle */
 
 static ECS_DTOR(EcsMetricMember, ptr, {
@@ -149,6 +168,33 @@ static ECS_MOVE(EcsMetricCountTargets, dst, src, {
     src->ctx = NULL;
 })
 
+static ECS_COPY(EcsMetricLabel, dst, src, {
+    ecs_os_free(dst->value);
+    dst->value = src->value ? ecs_os_strdup(src->value) : NULL;
+    dst->length = src->length;
+    dst->source = src->source;
+})
+
+static ECS_MOVE(EcsMetricLabel, dst, src, {
+    ecs_os_free(dst->value);
+    *dst = *src;
+    src->value = NULL;
+})
+
+static ECS_DTOR(EcsMetricLabel, ptr, {
+    ecs_os_free(ptr->value);
+})
+
+static ECS_MOVE(EcsMetricExporter, dst, src, {
+    ecs_os_free(dst->buf);
+    *dst = *src;
+    src->buf = NULL;
+})
+
+static ECS_DTOR(EcsMetricExporter, ptr, {
+    ecs_os_free(ptr->buf);
+})
+
 /** Observer used for creating new instances of member metric */
 static void flecs_metrics_on_member_metric(ecs_iter_t *it) {
     ecs_world_t *world = it->world;
@@ -167,6 +213,7 @@ static void flecs_metrics_on_member_metric(ecs_iter_t *it) {
         ecs_modified(world, m, EcsMetricMemberInstance);
         ecs_set(world, m, EcsMetricValue, { 0 });
         ecs_set(world, m, EcsMetricSource, { e });
+        ecs_add(world, m, EcsMetricLabel);
         ecs_add(world, m, EcsMetricInstance);
         ecs_add_pair(world, m, EcsMetric, ctx->metric.kind);
     }
@@ -189,6 +236,7 @@ static void flecs_metrics_on_id_metric(ecs_iter_t *it) {
         ecs_modified(world, m, EcsMetricIdInstance);
         ecs_set(world, m, EcsMetricValue, { 0 });
         ecs_set(world, m, EcsMetricSource, { e });
+        ecs_add(world, m, EcsMetricLabel);
         ecs_add(world, m, EcsMetricInstance);
         ecs_add_pair(world, m, EcsMetric, ctx->metric.kind);
     }
@@ -215,6 +263,7 @@ static void flecs_metrics_on_oneof_metric(ecs_iter_t *it) {
         ecs_modified(world, m, EcsMetricOneOfInstance);
         ecs_add_pair(world, m, ctx->metric.metric, ecs_id(EcsMetricValue));
         ecs_set(world, m, EcsMetricSource, { e });
+        ecs_add(world, m, EcsMetricLabel);
         ecs_add(world, m, EcsMetricInstance);
         ecs_add_pair(world, m, EcsMetric, ctx->metric.kind);
     }
@@ -417,6 +466,7 @@ static void UpdateCountTargets(ecs_iter_t *it) {
                 EcsMetricSource *source = ecs_ensure(
                     world, mi[0], EcsMetricSource);
                 source->entity = tgt;
+                ecs_add(world, mi[0], EcsMetricLabel);
             }
 
             EcsMetricValue *value = ecs_ensure(world, mi[0], EcsMetricValue);
@@ -718,6 +768,8 @@ int flecs_count_ids_metric_init(
 {
     ecs_set(world, metric, EcsMetricCountIds, { .id = desc->id });
     ecs_set(world, metric, EcsMetricValue, { .value = 0 });
+    ecs_add_pair(world, metric, EcsMetric, desc->kind);
+    ecs_add_id(world, metric, EcsMetric);
     return 0;
 }
 
@@ -830,6 +882,268 @@ error:
     return 0;
 }
 
+/** Append string, escaped according to the Prometheus text format */
+static
+void flecs_metrics_prom_escape(
+    ecs_strbuf_t *buf,
+    const char *str,
+    bool label)
+{
+    const char *ptr, *start = str;
+    for (ptr = str; *ptr; ptr ++) {
+        char ch = *ptr;
+        if (ch != '\\' && ch != '\n' && (!label || ch != '"')) {
+            continue;
+        }
+
+        ecs_strbuf_appendstrn(buf, start, flecs_ito(int32_t, ptr - start));
+        ecs_strbuf_appendch(buf, '\\');
+        ecs_strbuf_appendch(buf, ch == '\n' ? 'n' : ch);
+        start = ptr + 1;
+    }
+
+    ecs_strbuf_appendstrn(buf, start, flecs_ito(int32_t, ptr - start));
+}
+
+/** Prometheus metric names may only contain [a-zA-Z0-9_:] */
+static
+char* flecs_metrics_prom_name(
+    const ecs_world_t *world,
+    ecs_entity_t metric)
+{
+    char *path = ecs_get_path(world, metric);
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    if (isdigit((unsigned char)path[0])) {
+        ecs_strbuf_appendch(&buf, '_');
+    }
+
+    char *ptr;
+    for (ptr = path; *ptr; ptr ++) {
+        if (!isalnum((unsigned char)*ptr) && *ptr != ':') {
+            *ptr = '_';
+        }
+    }
+
+    ecs_strbuf_appendstr(&buf, path);
+    ecs_os_free(path);
+    return ecs_strbuf_get(&buf);
+}
+
+static
+void flecs_metrics_prom_value(
+    ecs_strbuf_t *buf,
+    double value)
+{
+    if (ecs_os_isinf(value)) {
+        if (value > 0) {
+            ecs_strbuf_appendlit(buf, "+Inf");
+        } else {
+            ecs_strbuf_appendlit(buf, "-Inf");
+        }
+    } else {
+        ecs_strbuf_appendflt(buf, value, 0);
+    }
+}
+
+/** Serialize labels of metric instance. Labels only depend on the source, so
+ * they are only created once per instance instead of for each scrape. */
+static
+bool flecs_metrics_prom_label(
+    const ecs_world_t *world,
+    EcsMetricLabel *label,
+    ecs_entity_t source)
+{
+    if (label->value && label->source == source) {
+        return true;
+    }
+
+    if (!ecs_is_alive(world, source)) {
+        /* Instance will be deleted by ClearMetricInstance */
+        return false;
+    }
+
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    ecs_strbuf_appendlit(&buf, "entity=\"");
+    char *path = ecs_get_path(world, source);
+    flecs_metrics_prom_escape(&buf, path, true);
+    ecs_os_free(path);
+    ecs_strbuf_appendch(&buf, '"');
+
+    ecs_os_free(label->value);
+    label->length = ecs_strbuf_written(&buf);
+    label->value = ecs_strbuf_get(&buf);
+    label->source = source;
+    return true;
+}
+
+static
+void flecs_metrics_prom_sample(
+    ecs_strbuf_t *buf,
+    const char *name,
+    ecs_size_t name_len,
+    const EcsMetricLabel *label,
+    const char *target,
+    double value)
+{
+    ecs_strbuf_appendstrn(buf, name, name_len);
+    if (label) {
+        ecs_strbuf_appendch(buf, '{');
+        ecs_strbuf_appendstrn(buf, label->value, label->length);
+        if (target) {
+            ecs_strbuf_appendlit(buf, ",target=\"");
+            flecs_metrics_prom_escape(buf, target, true);
+            ecs_strbuf_appendch(buf, '"');
+        }
+        ecs_strbuf_appendch(buf, '}');
+    }
+    ecs_strbuf_appendch(buf, ' ');
+    flecs_metrics_prom_value(buf, value);
+    ecs_strbuf_appendch(buf, '\n');
+}
+
+/** Serialize instances of a metric. Values are read directly from the tables
+ * of the instances, which the exporter query groups by metric. */
+static
+void flecs_metrics_prom_instances(
+    ecs_world_t *world,
+    const EcsMetricExporter *exporter,
+    ecs_strbuf_t *buf,
+    ecs_entity_t metric,
+    const char *name,
+    ecs_size_t name_len)
+{
+    const EcsStruct *oneof = NULL;
+    ecs_size_t oneof_size = 0;
+    if (ecs_has(world, metric, EcsMetricOneOf)) {
+        oneof = ecs_get(world, metric, EcsStruct);
+        oneof_size = ecs_get(world, metric, EcsComponent)->size;
+    }
+
+    ecs_iter_t it = ecs_query_iter(world, exporter->query);
+    ecs_iter_set_group(&it, metric);
+    while (ecs_query_next(&it)) {
+        const EcsMetricSource *src = ecs_field(&it, EcsMetricSource, 0);
+        EcsMetricLabel *label = ecs_field(&it, EcsMetricLabel, 1);
+        const EcsMetricValue *value = ecs_field(&it, EcsMetricValue, 2);
+        const void *oneof_value = NULL;
+        if (oneof) {
+            oneof_value = ecs_table_get_id(world, it.table,
+                ecs_pair(metric, ecs_id(EcsMetricValue)), it.offset);
+        }
+
+        if (!value && !oneof_value) {
+            continue;
+        }
+
+        int32_t i, count = it.count;
+        for (i = 0; i < count; i ++) {
+            if (!flecs_metrics_prom_label(world, &label[i], src[i].entity)) {
+                continue;
+            }
+
+            if (value) {
+                flecs_metrics_prom_sample(
+                    buf, name, name_len, &label[i], NULL, value[i].value);
+                continue;
+            }
+
+            const double *v = ECS_ELEM(oneof_value, oneof_size, i);
+            ecs_member_t *members = ecs_vec_first(&oneof->members);
+            int32_t m, member_count = ecs_vec_count(&oneof->members);
+            for (m = 0; m < member_count; m ++) {
+                flecs_metrics_prom_sample(buf, name, name_len, &label[i],
+                    members[m].name, *(double*)ECS_OFFSET(v, members[m].offset));
+            }
+        }
+    }
+}
+
+static
+void flecs_metrics_prom_metric(
+    ecs_world_t *world,
+    const EcsMetricExporter *exporter,
+    ecs_strbuf_t *buf,
+    ecs_entity_t metric)
+{
+    char *name = flecs_metrics_prom_name(world, metric);
+    ecs_size_t name_len = ecs_os_strlen(name);
+
+#ifdef FLECS_DOC
+    const char *brief = ecs_doc_get_brief(world, metric);
+    if (brief) {
+        ecs_strbuf_appendlit(buf, "# HELP ");
+        ecs_strbuf_appendstrn(buf, name, name_len);
+        ecs_strbuf_appendch(buf, ' ');
+        flecs_metrics_prom_escape(buf, brief, false);
+        ecs_strbuf_appendch(buf, '\n');
+    }
+#endif
+
+    ecs_entity_t kind = ecs_get_target(world, metric, EcsMetric, 0);
+    ecs_strbuf_appendlit(buf, "# TYPE ");
+    ecs_strbuf_appendstrn(buf, name, name_len);
+    if (kind == EcsGauge) {
+        ecs_strbuf_appendlit(buf, " gauge\n");
+    } else {
+        ecs_strbuf_appendlit(buf, " counter\n");
+    }
+
+    /* Metrics that count ids without targets store value on metric entity */
+    const EcsMetricValue *value = ecs_get(world, metric, EcsMetricValue);
+    if (value) {
+        flecs_metrics_prom_sample(
+            buf, name, name_len, NULL, NULL, value->value);
+    } else {
+        flecs_metrics_prom_instances(
+            world, exporter, buf, metric, name, name_len);
+    }
+
+    ecs_os_free(name);
+}
+
+const char* ecs_metrics_to_prometheus(
+    ecs_world_t *world)
+{
+    flecs_poly_assert(world, ecs_world_t);
+
+    if (!ecs_id(EcsMetricExporter) || 
+        !ecs_is_alive(world, ecs_id(EcsMetricExporter))) 
+    {
+        /* Metrics module is not imported */
+        return NULL;
+    }
+
+    EcsMetricExporter *exporter = ecs_singleton_get_mut(
+        world, EcsMetricExporter);
+    if (!exporter) {
+        return NULL;
+    }
+
+    /* Reuse buffer of previous scrape, so that it doesn't have to grow */
+    if (!exporter->buf) {
+        exporter->size = ECS_STRBUF_SMALL_STRING_SIZE;
+        exporter->buf = ecs_os_malloc(exporter->size);
+    }
+
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    buf.content = exporter->buf;
+    buf.size = exporter->size;
+
+    ecs_iter_t it = ecs_each_id(world, EcsMetric);
+    while (ecs_each_next(&it)) {
+        int32_t i, count = it.count;
+        for (i = 0; i < count; i ++) {
+            flecs_metrics_prom_metric(world, exporter, &buf, it.entities[i]);
+        }
+    }
+
+    ecs_strbuf_appendch(&buf, '\0');
+    exporter->buf = buf.content;
+    exporter->size = buf.size;
+
+    return exporter->buf;
+}
+
 void FlecsMetricsImport(ecs_world_t *world) {
     ECS_MODULE_DEFINE(world, FlecsMetrics);
 
@@ -858,10 +1172,14 @@ void FlecsMetricsImport(ecs_world_t *world) {
     ECS_COMPONENT_DEFINE(world, EcsMetricOneOf);
     ECS_COMPONENT_DEFINE(world, EcsMetricCountIds);
     ECS_COMPONENT_DEFINE(world, EcsMetricCountTargets);
+    ECS_COMPONENT_DEFINE(world, EcsMetricLabel);
+    ECS_COMPONENT_DEFINE(world, EcsMetricExporter);
 
     ecs_add_id(world, ecs_id(EcsMetricMemberInstance), EcsPrivate);
     ecs_add_id(world, ecs_id(EcsMetricIdInstance), EcsPrivate);
     ecs_add_id(world, ecs_id(EcsMetricOneOfInstance), EcsPrivate);
+    ecs_add_id(world, ecs_id(EcsMetricLabel), EcsPrivate);
+    ecs_add_id(world, ecs_id(EcsMetricExporter), EcsPrivate);
 
     ecs_struct(world, {
         .entity = ecs_id(EcsMetricValue),
@@ -901,8 +1219,37 @@ void FlecsMetricsImport(ecs_world_t *world) {
         .move = ecs_move(EcsMetricCountTargets)
     });
 
+    ecs_set_hooks(world, EcsMetricLabel, {
+        .ctor = flecs_default_ctor,
+        .copy = ecs_copy(EcsMetricLabel),
+        .move = ecs_move(EcsMetricLabel),
+        .dtor = ecs_dtor(EcsMetricLabel)
+    });
+
+    ecs_set_hooks(world, EcsMetricExporter, {
+        .ctor = flecs_default_ctor,
+        .move = ecs_move(EcsMetricExporter),
+        .dtor = ecs_dtor(EcsMetricExporter)
+    });
+
     ecs_add_id(world, EcsMetric, EcsOneOf);
 
+    /* Instances are grouped by metric, so that the exporter can iterate the
+     * instances of one metric without searching */
+    ecs_singleton_set(world, EcsMetricExporter, {
+        .query = ecs_query(world, {
+            .entity = ecs_entity(world, { .name = "PrometheusExporter" }),
+            .terms = {
+                { .id = ecs_id(EcsMetricSource), .inout = EcsIn },
+                { .id = ecs_id(EcsMetricLabel) },
+                { .id = ecs_id(EcsMetricValue), .inout = EcsIn,
+                    .oper = EcsOptional }
+            },
+            .cache_kind = EcsQueryCacheAuto,
+            .group_by = EcsChildOf
+        })
+    });
+
 #ifdef FLECS_DOC
     ECS_OBSERVER(world, SetMetricDocName, EcsOnSet, 
         Source);
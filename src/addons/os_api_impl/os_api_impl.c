@@ -4,8 +4,235 @@
  */
 
 #include "../../private_api.h"
+#include "os_api_impl.h"
 
 #ifdef FLECS_OS_API_IMPL
+
+/* Persistent thread pool for parallel_for. Threads are created the first time
+ * they're needed and kept around until the OS API is deinitialized, so that
+ * running jobs doesn't require creating and joining threads. */
+typedef struct flecs_os_pool_t {
+    ecs_os_mutex_t lock;           /* Protects job state */
+    ecs_os_cond_t work_cond;       /* Signals threads that work is available */
+    ecs_os_cond_t done_cond;       /* Signals caller that all jobs finished */
+    ecs_os_thread_t *threads;
+    int32_t thread_count;
+    ecs_os_parallel_job_t job;     /* Set while the pool is running jobs */
+    void *ctx;
+    int32_t count;                 /* Number of job invocations */
+    int32_t next;                  /* Next index to claim */
+    int32_t remaining;             /* Invocations that haven't finished */
+    bool quit;
+} flecs_os_pool_t;
+
+typedef struct flecs_os_pool_task_t {
+    ecs_os_parallel_job_t job;
+    void *ctx;
+    int32_t index;
+} flecs_os_pool_task_t;
+
+static flecs_os_pool_t flecs_os_pool;
+
+/* Claim and run jobs until none are left. Must be called with lock held. */
+static
+void flecs_os_pool_run_jobs(
+    flecs_os_pool_t *pool)
+{
+    while (pool->next < pool->count) {
+        int32_t index = pool->next ++;
+        ecs_os_parallel_job_t job = pool->job;
+        void *ctx = pool->ctx;
+
+        ecs_os_mutex_unlock(pool->lock);
+        job(ctx, index);
+        ecs_os_mutex_lock(pool->lock);
+
+        if (!--pool->remaining) {
+            ecs_os_cond_signal(pool->done_cond);
+        }
+    }
+}
+
+static
+void* flecs_os_pool_thread(
+    void *arg)
+{
+    flecs_os_pool_t *pool = arg;
+
+    ecs_os_mutex_lock(pool->lock);
+    while (!pool->quit) {
+        flecs_os_pool_run_jobs(pool);
+        if (!pool->quit) {
+            ecs_os_cond_wait(pool->work_cond, pool->lock);
+        }
+    }
+    ecs_os_mutex_unlock(pool->lock);
+
+    return NULL;
+}
+
+static
+void* flecs_os_pool_task(
+    void *arg)
+{
+    flecs_os_pool_task_t *task = arg;
+    task->job(task->ctx, task->index);
+    return NULL;
+}
+
+static
+void flecs_os_pool_run_inline(
+    ecs_os_parallel_job_t job,
+    void *ctx,
+    int32_t count)
+{
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        job(ctx, i);
+    }
+}
+
+/* Used when the application provides its own task API, so that jobs keep
+ * running on the application's task system. Without task support jobs are
+ * ran on the calling thread. */
+static
+void flecs_os_pool_run_tasks(
+    ecs_os_parallel_job_t job,
+    void *ctx,
+    int32_t count)
+{
+    if (!ecs_os_has_task_support()) {
+        flecs_os_pool_run_inline(job, ctx, count);
+        return;
+    }
+
+    flecs_os_pool_task_t *tasks = ecs_os_malloc_n(
+        flecs_os_pool_task_t, count);
+    ecs_os_thread_t *handles = ecs_os_malloc_n(ecs_os_thread_t, count);
+
+    int32_t i;
+    for (i = 1; i < count; i ++) {
+        tasks[i] = (flecs_os_pool_task_t){ job, ctx, i };
+        handles[i] = ecs_os_task_new(flecs_os_pool_task, &tasks[i]);
+        ecs_assert(handles[i] != 0, ECS_OPERATION_FAILED,
+            "failed to create task");
+    }
+
+    job(ctx, 0);
+
+    for (i = 1; i < count; i ++) {
+        ecs_os_task_join(handles[i]);
+    }
+
+    ecs_os_free(handles);
+    ecs_os_free(tasks);
+}
+
+bool flecs_os_pool_uses_tasks(void) {
+    return (ecs_os_api.parallel_for_ == flecs_os_pool_parallel_for) &&
+        (ecs_os_api.task_new_ != ecs_os_api.thread_new_);
+}
+
+void flecs_os_pool_parallel_for(
+    ecs_os_parallel_job_t job,
+    void *ctx,
+    int32_t count)
+{
+    flecs_os_pool_t *pool = &flecs_os_pool;
+
+    if (count <= 1) {
+        flecs_os_pool_run_inline(job, ctx, count);
+        return;
+    }
+
+    if (!pool->lock || (ecs_os_api.task_new_ != ecs_os_api.thread_new_)) {
+        flecs_os_pool_run_tasks(job, ctx, count);
+        return;
+    }
+
+    ecs_os_mutex_lock(pool->lock);
+
+    if (pool->job) {
+        /* Pool is already running jobs, which happens when parallel_for is
+         * called from inside a job or from another thread. Waiting for the 
+         * pool from inside a job would deadlock, so run on calling thread. */
+        ecs_os_mutex_unlock(pool->lock);
+        flecs_os_pool_run_inline(job, ctx, count);
+        return;
+    }
+
+    /* The calling thread runs the first job, so count - 1 threads is enough */
+    if (pool->thread_count < (count - 1)) {
+        pool->threads = ecs_os_realloc_n(
+            pool->threads, ecs_os_thread_t, count - 1);
+        int32_t i;
+        for (i = pool->thread_count; i < (count - 1); i ++) {
+            pool->threads[i] = ecs_os_thread_new(flecs_os_pool_thread, pool);
+            ecs_assert(pool->threads[i] != 0, ECS_OPERATION_FAILED,
+                "failed to create thread");
+        }
+        pool->thread_count = count - 1;
+    }
+
+    /* Index 0 runs on the calling thread, pool threads claim the rest */
+    pool->job = job;
+    pool->ctx = ctx;
+    pool->count = count;
+    pool->next = 1;
+    pool->remaining = count - 1;
+    ecs_os_cond_broadcast(pool->work_cond);
+
+    ecs_os_mutex_unlock(pool->lock);
+    job(ctx, 0);
+    ecs_os_mutex_lock(pool->lock);
+
+    while (pool->remaining) {
+        ecs_os_cond_wait(pool->done_cond, pool->lock);
+    }
+
+    pool->job = NULL;
+    pool->ctx = NULL;
+
+    ecs_os_mutex_unlock(pool->lock);
+}
+
+static
+void flecs_os_pool_init(void) {
+    flecs_os_pool_t *pool = &flecs_os_pool;
+    ecs_os_zeromem(pool);
+    if (!ecs_os_has_threading()) {
+        return;
+    }
+
+    pool->lock = ecs_os_mutex_new();
+    pool->work_cond = ecs_os_cond_new();
+    pool->done_cond = ecs_os_cond_new();
+}
+
+static
+void flecs_os_pool_fini(void) {
+    flecs_os_pool_t *pool = &flecs_os_pool;
+    if (!pool->lock) {
+        return;
+    }
+
+    ecs_os_mutex_lock(pool->lock);
+    pool->quit = true;
+    ecs_os_cond_broadcast(pool->work_cond);
+    ecs_os_mutex_unlock(pool->lock);
+
+    int32_t i;
+    for (i = 0; i < pool->thread_count; i ++) {
+        ecs_os_thread_join(pool->threads[i]);
+    }
+
+    ecs_os_free(pool->threads);
+    ecs_os_cond_free(pool->done_cond);
+    ecs_os_cond_free(pool->work_cond);
+    ecs_os_mutex_free(pool->lock);
+    ecs_os_zeromem(pool);
+}
+
 #ifdef ECS_TARGET_WINDOWS
 #include "windows_impl.inl"
 #else
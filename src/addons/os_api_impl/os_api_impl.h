@@ -0,0 +1,23 @@
+/**
+ * @file addons/os_api_impl/os_api_impl.h
+ * @brief Internal functions of the builtin OS API implementation.
+ */
+
+#ifndef FLECS_OS_API_IMPL_PRIVATE_H
+#define FLECS_OS_API_IMPL_PRIVATE_H
+
+#ifdef FLECS_OS_API_IMPL
+
+/* Builtin parallel_for, runs jobs on a persistent thread pool */
+void flecs_os_pool_parallel_for(
+    ecs_os_parallel_job_t job,
+    void *ctx,
+    int32_t count);
+
+/* Test if the builtin parallel_for is set, but creates tasks for each call
+ * because the application provides its own task API */
+bool flecs_os_pool_uses_tasks(void);
+
+#endif
+
+#endif
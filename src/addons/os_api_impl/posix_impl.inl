@@ -4,6 +4,7 @@
  */
 
 #include "pthread.h"
+#include <errno.h>
 
 #if defined(__APPLE__) && defined(__MACH__)
 #include <mach/mach_time.h>
@@ -298,6 +299,32 @@ uint64_t posix_time_now(void) {
     return now;
 }
 
+static
+void posix_sleep_until(
+    uint64_t deadline)
+{
+#if defined(ECS_TARGET_LINUX) && defined(TIMER_ABSTIME)
+    /* Absolute deadlines don't drift when the thread is preempted between
+     * computing the sleep interval and going to sleep. */
+    struct timespec ts;
+    ts.tv_sec = (time_t)(deadline / 1000000000);
+    ts.tv_nsec = (long)(deadline % 1000000000);
+    int res;
+    while ((res = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL))) {
+        if (res != EINTR) {
+            ecs_err("clock_nanosleep failed");
+            break;
+        }
+    }
+#else
+    uint64_t now = posix_time_now();
+    if (deadline > now) {
+        uint64_t t = deadline - now;
+        posix_sleep((int32_t)(t / 1000000000), (int32_t)(t % 1000000000));
+    }
+#endif
+}
+
 void ecs_set_os_api_impl(void) {
     ecs_os_set_api_defaults();
 
@@ -308,6 +335,7 @@ void ecs_set_os_api_impl(void) {
     api.thread_self_ = posix_thread_self;
     api.task_new_ = posix_thread_new;
     api.task_join_ = posix_thread_join;
+    api.parallel_for_ = flecs_os_pool_parallel_for;
     api.ainc_ = posix_ainc;
     api.adec_ = posix_adec;
     api.lainc_ = posix_lainc;
@@ -322,7 +350,10 @@ void ecs_set_os_api_impl(void) {
     api.cond_broadcast_ = posix_cond_broadcast;
     api.cond_wait_ = posix_cond_wait;
     api.sleep_ = posix_sleep;
+    api.sleep_until_ = posix_sleep_until;
     api.now_ = posix_time_now;
+    api.init_ = flecs_os_pool_init;
+    api.fini_ = flecs_os_pool_fini;
 
     posix_time_setup();
 
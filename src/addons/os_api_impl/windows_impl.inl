@@ -249,8 +249,26 @@ uint64_t win_time_now(void) {
     return now;
 }
 
+static
+void win_sleep_until(
+    uint64_t deadline)
+{
+    uint64_t now = win_time_now();
+    if (deadline > now) {
+        uint64_t t = deadline - now;
+        win_sleep((int32_t)(t / 1000000000), (int32_t)(t % 1000000000));
+    }
+}
+
+static
+void win_init(void) {
+    flecs_os_pool_init();
+}
+
 static
 void win_fini(void) {
+    flecs_os_pool_fini();
+
     if (ecs_os_api.flags_ & EcsOsApiHighResolutionTimer) {
         win_enable_high_timer_resolution(false);
     }
@@ -266,6 +284,7 @@ void ecs_set_os_api_impl(void) {
     api.thread_self_ = win_thread_self;
     api.task_new_ = win_thread_new;
     api.task_join_ = win_thread_join;
+    api.parallel_for_ = flecs_os_pool_parallel_for;
     api.ainc_ = win_ainc;
     api.adec_ = win_adec;
     api.lainc_ = win_lainc;
@@ -280,7 +299,9 @@ void ecs_set_os_api_impl(void) {
     api.cond_broadcast_ = win_cond_broadcast;
     api.cond_wait_ = win_cond_wait;
     api.sleep_ = win_sleep;
+    api.sleep_until_ = win_sleep_until;
     api.now_ = win_time_now;
+    api.init_ = win_init;
     api.fini_ = win_fini;
 
     win_time_setup();
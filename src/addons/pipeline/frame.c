@@ -3,6 +3,168 @@
 #ifdef FLECS_PIPELINE
 #include "pipeline.h"
 
+/* Initial time to spin before a frame deadline, before it is calibrated */
+#define FLECS_FRAME_SPIN_TIME (200 * 1000)
+
+/* Minimum time to spin before a frame deadline */
+#define FLECS_FRAME_SPIN_TIME_MIN (50 * 1000)
+
+/* Maximum time to spin before a frame deadline. Limits how much CPU time is
+ * burned when the OS oversleeps by a lot, at the cost of frame pacing. */
+#define FLECS_FRAME_SPIN_TIME_MAX (1000 * 1000)
+
+static
+int32_t flecs_frame_histogram_index(
+    uint64_t us)
+{
+    if (us < FLECS_FRAME_HISTOGRAM_SUB) {
+        return (int32_t)us;
+    }
+
+    int32_t msb = 0;
+    uint64_t v = us;
+    while (v >>= 1) {
+        msb ++;
+    }
+
+    int32_t shift = msb - FLECS_FRAME_HISTOGRAM_SUB_BITS;
+    int32_t index = (shift + 1) * FLECS_FRAME_HISTOGRAM_SUB + 
+        (int32_t)((us >> shift) & (FLECS_FRAME_HISTOGRAM_SUB - 1));
+    if (index >= FLECS_FRAME_HISTOGRAM_BUCKETS) {
+        index = FLECS_FRAME_HISTOGRAM_BUCKETS - 1;
+    }
+
+    return index;
+}
+
+/* Returns center of the bucket in seconds */
+static
+double flecs_frame_histogram_value(
+    int32_t index)
+{
+    if (index < FLECS_FRAME_HISTOGRAM_SUB) {
+        return ((double)index + 0.5) / 1000000.0;
+    }
+
+    int32_t shift = index / FLECS_FRAME_HISTOGRAM_SUB - 1;
+    uint64_t sub = (uint64_t)(index % FLECS_FRAME_HISTOGRAM_SUB);
+    uint64_t lo = (FLECS_FRAME_HISTOGRAM_SUB + sub) << shift;
+    uint64_t width = 1ull << shift;
+    return ((double)lo + (double)width / 2.0) / 1000000.0;
+}
+
+/* Add frame time to histogram and update percentiles in world info */
+static
+void flecs_frame_histogram_record(
+    ecs_world_t *world,
+    ecs_ftime_t delta_time)
+{
+    ecs_frame_histogram_t *h = &world->frame_histogram;
+    uint64_t ns = (uint64_t)((double)delta_time * 1000000000.0);
+
+    if (h->count == FLECS_FRAME_HISTOGRAM_WINDOW) {
+        /* Halve counts so that older frames gradually stop contributing */
+        uint32_t i, count = 0;
+        for (i = 0; i < FLECS_FRAME_HISTOGRAM_BUCKETS; i ++) {
+            count += (h->buckets[i] >>= 1);
+        }
+        h->count = count;
+        h->max_prev = h->max;
+        h->max = 0;
+    }
+
+    h->buckets[flecs_frame_histogram_index(ns / 1000)] ++;
+    h->count ++;
+    if (ns > h->max) {
+        h->max = ns;
+    }
+
+    uint64_t max = h->max > h->max_prev ? h->max : h->max_prev;
+    double max_time = (double)max / 1000000000.0;
+    uint32_t p50 = (h->count + 1) / 2, p99 = h->count - h->count / 100;
+    double p50_time = 0, p99_time = 0;
+    uint32_t total = 0;
+    int32_t i;
+    for (i = 0; i < FLECS_FRAME_HISTOGRAM_BUCKETS; i ++) {
+        uint32_t prev = total;
+        total += h->buckets[i];
+        if (prev < p50 && total >= p50) {
+            p50_time = flecs_frame_histogram_value(i);
+        }
+        if (total >= p99) {
+            p99_time = flecs_frame_histogram_value(i);
+            break;
+        }
+    }
+
+    /* Bucket centers can be larger than the actual largest frame time */
+    world->info.frame_time_p50 = (ecs_ftime_t)(p50_time < max_time ? p50_time : max_time);
+    world->info.frame_time_p99 = (ecs_ftime_t)(p99_time < max_time ? p99_time : max_time);
+    world->info.frame_time_max = (ecs_ftime_t)max_time;
+}
+
+/* Wait until the next frame deadline. Sleeps until shortly before the deadline
+ * and spins for the remaining time, since sleeping can overshoot the deadline
+ * by up to a scheduler tick. */
+static
+void flecs_wait_for_deadline(
+    ecs_world_t *world)
+{
+    uint64_t period = (uint64_t)(1000000000.0 / (double)world->info.target_fps);
+    uint64_t now = ecs_os_now();
+    uint64_t deadline = world->frame_deadline + period;
+
+    if (!world->frame_deadline || (now > (deadline + period))) {
+        /* First frame, or more than a frame behind schedule. Don't try to
+         * catch up, start a new schedule from the current time. */
+        world->frame_deadline = now;
+        return;
+    }
+
+    world->frame_deadline = deadline;
+    if (now >= deadline) {
+        return;
+    }
+
+    uint64_t spin = world->frame_spin_time;
+    if (!spin) {
+        spin = FLECS_FRAME_SPIN_TIME;
+    }
+
+    if ((deadline - now) > spin) {
+        uint64_t wake = deadline - spin;
+        if (ecs_os_api.sleep_until_) {
+            ecs_os_sleep_until(wake);
+        } else {
+            ecs_sleepf((double)(wake - now) / 1000000000.0);
+        }
+
+        /* Calibrate spin time so it covers how much the OS oversleeps. Grow
+         * quickly when oversleeping, shrink slowly otherwise. */
+        now = ecs_os_now();
+        uint64_t over = now > wake ? now - wake : 0;
+        uint64_t target = over + over / 2 + FLECS_FRAME_SPIN_TIME_MIN;
+        if (target > spin) {
+            spin = target;
+        } else {
+            spin -= (spin - target) / 16;
+        }
+
+        if (spin > FLECS_FRAME_SPIN_TIME_MAX) {
+            spin = FLECS_FRAME_SPIN_TIME_MAX;
+        }
+        if (spin > (period / 2)) {
+            spin = period / 2;
+        }
+    }
+
+    world->frame_spin_time = spin;
+
+    while (ecs_os_now() < deadline) {
+        /* Spin */
+    }
+}
+
 static
 ecs_ftime_t flecs_insert_sleep(
     ecs_world_t *world,
@@ -17,6 +179,15 @@ ecs_ftime_t flecs_insert_sleep(
         return delta_time;
     }
 
+    if (world->flags & EcsWorldPreciseFramePacing) {
+        ecs_os_perf_trace_push("flecs.insert_sleep");
+        flecs_wait_for_deadline(world);
+        ecs_os_perf_trace_pop("flecs.insert_sleep");
+
+        *stop = start;
+        return (ecs_ftime_t)ecs_time_measure(stop);
+    }
+
     ecs_os_perf_trace_push("flecs.insert_sleep");
 
     ecs_ftime_t target_delta_time =
@@ -61,9 +232,11 @@ ecs_ftime_t flecs_start_measure_frame(
         (ECS_EQZERO(user_delta_time)))
     {
         ecs_time_t t = world->frame_start_time;
+        bool measured = false;
         do {
             if (world->frame_start_time.nanosec || world->frame_start_time.sec){
                 delta_time = flecs_insert_sleep(world, &t);
+                measured = true;
             } else {
                 ecs_time_measure(&t);
                 if (ECS_NEQZERO(world->info.target_fps)) {
@@ -86,6 +259,10 @@ ecs_ftime_t flecs_start_measure_frame(
 
         /* Keep track of total time passed in world */
         world->info.world_time_total_raw += (double)delta_time;
+
+        if (measured) {
+            flecs_frame_histogram_record(world, delta_time);
+        }
     }
 
     return (ecs_ftime_t)delta_time;
@@ -134,6 +311,9 @@ ecs_ftime_t ecs_frame_begin(
     world->on_commands_ctx_active = world->on_commands_ctx;
     world->on_commands_ctx = NULL;
 
+    /* Apply commands enqueued from other threads since the last merge */
+    flecs_async_queue_drain(world);
+
     ecs_run_aperiodic(world, 0);
 
     world->flags |= EcsWorldFrameInProgress;
@@ -159,6 +339,12 @@ void ecs_frame_end(
         flecs_stage_merge_post_frame(world, world->stages[i]);
     }
 
+    /* Free or delete tables that have been empty for a while */
+    flecs_table_gc_run(world);
+
+    /* Yield existing matches of observers that catch up incrementally */
+    flecs_observers_yield_frame(world);
+
     flecs_stop_measure_frame(world);
 
     /* Reset command handler each frame */
@@ -251,6 +251,168 @@ EcsPoly* flecs_pipeline_term_system(
     return poly;
 }
 
+static
+bool flecs_pipeline_term_access(
+    const ecs_term_t *term,
+    bool *read,
+    bool *write)
+{
+    int16_t inout = term->inout;
+    if (inout == EcsInOutNone || inout == EcsInOutFilter) {
+        return false;
+    }
+
+    if (term->oper == EcsNot) {
+        /* Not terms don't access component data. A Not term with Out only 
+         * signals that the component is added with a (deferred) command. */
+        return false;
+    }
+
+    bool from_any = ecs_term_match_0(term);
+    if (inout == EcsInOutDefault) {
+        if (from_any) {
+            return false;
+        }
+
+        bool is_shared = !ecs_term_match_this(term) || 
+            !(term->src.id & EcsSelf);
+        inout = is_shared ? EcsIn : EcsInOut;
+    }
+
+    *read = inout == EcsIn || inout == EcsInOut;
+
+    /* Writes to terms without a source go through the (deferred) stage, and
+     * don't modify the storage while systems are running. */
+    *write = !from_any && (inout == EcsOut || inout == EcsInOut);
+
+    return *read || *write;
+}
+
+static
+bool flecs_pipeline_ids_overlap(
+    ecs_id_t a,
+    ecs_id_t b)
+{
+    if (a == EcsWildcard || b == EcsWildcard) {
+        return true;
+    }
+
+    return ecs_id_match(a, b) || ecs_id_match(b, a);
+}
+
+/* Two systems conflict if one of them writes a component that the other one
+ * reads or writes. */
+static
+bool flecs_pipeline_systems_conflict(
+    const ecs_system_t *a,
+    const ecs_system_t *b)
+{
+    const ecs_query_t *qa = a->query, *qb = b->query;
+    int32_t i, j;
+
+    for (i = 0; i < qa->term_count; i ++) {
+        const ecs_term_t *ta = &qa->terms[i];
+        bool ra = false, wa = false;
+        if (!flecs_pipeline_term_access(ta, &ra, &wa)) {
+            continue;
+        }
+
+        for (j = 0; j < qb->term_count; j ++) {
+            const ecs_term_t *tb = &qb->terms[j];
+            bool rb = false, wb = false;
+            if (!flecs_pipeline_term_access(tb, &rb, &wb)) {
+                continue;
+            }
+
+            if (!wa && !wb) {
+                continue;
+            }
+
+            if (flecs_pipeline_ids_overlap(ta->id, tb->id)) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/* Split ops with multi threaded systems into waves of systems that don't
+ * conflict with each other. The systems in a wave run concurrently, with each
+ * system running on a single worker thread. Threads are synchronized between
+ * waves, but commands are only merged after the last wave. */
+static
+void flecs_pipeline_build_concurrent(
+    ecs_world_t *world,
+    ecs_pipeline_state_t *pq)
+{
+    ecs_allocator_t *a = &world->allocator;
+    int32_t i, op_count = ecs_vec_count(&pq->ops);
+    ecs_system_t **systems = ecs_vec_first_t(&pq->systems, ecs_system_t*);
+
+    ecs_vec_t ops, levels, op_systems;
+    ecs_vec_init_t(a, &ops, ecs_pipeline_op_t, op_count);
+    ecs_vec_init_t(a, &levels, int32_t, 0);
+    ecs_vec_init_t(a, &op_systems, ecs_system_t*, 0);
+
+    for (i = 0; i < op_count; i ++) {
+        ecs_pipeline_op_t *op = ecs_vec_get_t(&pq->ops, ecs_pipeline_op_t, i);
+        if (!op->multi_threaded || op->immediate || (op->count < 2)) {
+            ecs_vec_append_t(a, &ops, ecs_pipeline_op_t)[0] = *op;
+            continue;
+        }
+
+        int32_t j, k, count = op->count, level_count = 0;
+        ecs_vec_set_count_t(a, &levels, int32_t, count);
+        ecs_vec_set_count_t(a, &op_systems, ecs_system_t*, count);
+        int32_t *level = ecs_vec_first_t(&levels, int32_t);
+        ecs_system_t **sys = ecs_vec_first_t(&op_systems, ecs_system_t*);
+        ecs_os_memcpy_n(sys, &systems[op->offset], ecs_system_t*, count);
+
+        /* A system must run after all earlier systems it conflicts with */
+        for (j = 0; j < count; j ++) {
+            level[j] = 0;
+            for (k = 0; k < j; k ++) {
+                if (level[k] >= level[j] && 
+                    flecs_pipeline_systems_conflict(sys[k], sys[j])) 
+                {
+                    level[j] = level[k] + 1;
+                }
+            }
+
+            if (level[j] >= level_count) {
+                level_count = level[j] + 1;
+            }
+        }
+
+        /* Order systems by wave, add op for each wave */
+        int32_t l, offset = op->offset;
+        for (l = 0; l < level_count; l ++) {
+            ecs_pipeline_op_t *wave = ecs_vec_append_t(
+                a, &ops, ecs_pipeline_op_t);
+            *wave = *op;
+            wave->offset = offset;
+            wave->count = 0;
+
+            for (j = 0; j < count; j ++) {
+                if (level[j] == l) {
+                    systems[offset + wave->count] = sys[j];
+                    wave->count ++;
+                }
+            }
+
+            wave->concurrent = wave->count > 1;
+            wave->no_merge = l != (level_count - 1);
+            offset += wave->count;
+        }
+    }
+
+    ecs_vec_fini_t(a, &levels, int32_t);
+    ecs_vec_fini_t(a, &op_systems, ecs_system_t*);
+    ecs_vec_fini_t(a, &pq->ops, ecs_pipeline_op_t);
+    pq->ops = ops;
+}
+
 static
 bool flecs_pipeline_build(
     ecs_world_t *world,
@@ -351,6 +513,8 @@ bool flecs_pipeline_build(
                 op->count = 0;
                 op->multi_threaded = false;
                 op->immediate = false;
+                op->concurrent = false;
+                op->no_merge = false;
                 op->time_spent = 0;
                 op->commands_enqueued = 0;
             }
@@ -375,6 +539,10 @@ bool flecs_pipeline_build(
     ecs_map_fini(&ws.ids);
     ecs_map_fini(&ws.wildcard_ids);
 
+    if (pq->concurrent) {
+        flecs_pipeline_build_concurrent(world, pq);
+    }
+
     op = ecs_vec_first_t(&pq->ops, ecs_pipeline_op_t);
 
     if (!op) {
@@ -385,8 +553,9 @@ bool flecs_pipeline_build(
         ecs_dbg("#[bold]pipeline rebuild");
         ecs_log_push_1();
 
-        ecs_dbg("#[green]schedule#[reset]: threading: %d, staging: %d:", 
-            op->multi_threaded, !op->immediate);
+        ecs_dbg("#[green]schedule#[reset]: threading: %d, staging: %d, "
+            "concurrent: %d:", 
+            op->multi_threaded, !op->immediate, op->concurrent);
         ecs_log_push_1();
 
         int32_t i, count = ecs_vec_count(&pq->systems);
@@ -421,16 +590,21 @@ bool flecs_pipeline_build(
 
             ran_since_merge ++;
             if (ran_since_merge == op[op_index].count) {
-                ecs_dbg("#[magenta]merge#[reset]");
+                if (op[op_index].no_merge) {
+                    ecs_dbg("#[magenta]sync#[reset]");
+                } else {
+                    ecs_dbg("#[magenta]merge#[reset]");
+                }
                 ecs_log_pop_1();
                 ran_since_merge = 0;
                 op_index ++;
                 if (op_index < ecs_vec_count(&pq->ops)) {
                     ecs_dbg(
                         "#[green]schedule#[reset]: "
-                        "threading: %d, staging: %d:",
+                        "threading: %d, staging: %d, concurrent: %d:",
                         op[op_index].multi_threaded, 
-                        !op[op_index].immediate);
+                        !op[op_index].immediate,
+                        op[op_index].concurrent);
                 }
                 ecs_log_push_1();
             }
@@ -535,6 +709,37 @@ void ecs_run_pipeline(
     }
 }
 
+static
+int32_t flecs_run_pipeline_concurrent_ops(
+    ecs_world_t* world,
+    ecs_stage_t* stage,
+    int32_t stage_index,
+    ecs_ftime_t delta_time)
+{
+    ecs_pipeline_state_t* pq = world->pq;
+    ecs_pipeline_op_t* op = pq->cur_op;
+    ecs_system_t **systems = ecs_vec_first_t(&pq->systems, ecs_system_t*);
+    int32_t i, last = op->offset + op->count - 1;
+
+    if (stage_index == 0) {
+        for (i = pq->cur_i; i <= last; i ++) {
+            systems[i]->last_frame = world->info.frame_count_total + 1;
+        }
+    }
+
+    /* Claim systems until all systems in the op have ran. Systems in a
+     * concurrent op don't access the same components, so each system can run
+     * on a different thread. */
+    while ((i = ecs_os_ainc(&pq->next_system) - 1) < op->count) {
+        ecs_system_t *sys = systems[op->offset + i];
+        flecs_run_system(world, stage, sys->query->entity, sys, 0, 1, 
+            delta_time, NULL);
+        ecs_os_linc(&world->info.systems_ran_frame);
+    }
+
+    return last;
+}
+
 int32_t flecs_run_pipeline_ops(
     ecs_world_t* world,
     ecs_stage_t* stage,
@@ -548,6 +753,11 @@ int32_t flecs_run_pipeline_ops(
 
     ecs_assert(!stage_index || op->multi_threaded, ECS_INTERNAL_ERROR, NULL);
 
+    if (op->concurrent) {
+        return flecs_run_pipeline_concurrent_ops(
+            world, stage, stage_index, delta_time);
+    }
+
     int32_t count = ecs_vec_count(&pq->systems);
     ecs_system_t **systems = ecs_vec_first_t(&pq->systems, ecs_system_t*);
     int32_t ran_since_merge = i - op->offset;
@@ -598,6 +808,7 @@ void flecs_run_pipeline(
     int32_t stage_index = ecs_stage_get_id(stage->thread_ctx);
     int32_t stage_count = ecs_get_stage_count(world);
     bool multi_threaded = world->worker_cond != 0;
+    bool use_parallel_for = flecs_workers_use_parallel_for(world);
 
     ecs_assert(!stage_index, ECS_INVALID_OPERATION, 
         "cannot run pipeline on stage");
@@ -608,6 +819,9 @@ void flecs_run_pipeline(
     // Update the pipeline before waking the workers.
     flecs_pipeline_update(world, pq, true);
 
+    // Ops that aren't followed by a merge keep the world in readonly mode
+    bool readonly = false;
+
     // If there are no operations to execute in the pipeline bail early,
     // no need to wake the workers since they have nothing to do.
     while (pq->cur_op != NULL) {
@@ -616,21 +830,34 @@ void flecs_run_pipeline(
             continue;
         }
 
-        bool immediate = pq->cur_op->immediate;
-        bool op_multi_threaded = multi_threaded && pq->cur_op->multi_threaded;
+        ecs_pipeline_op_t *op = pq->cur_op;
+        bool immediate = op->immediate;
+        bool op_multi_threaded = multi_threaded && op->multi_threaded;
 
         pq->immediate = immediate;
 
         if (!immediate) {
-            ecs_readonly_begin(world, multi_threaded);
+            if (!readonly) {
+                ecs_readonly_begin(world, multi_threaded);
+                readonly = true;
+            }
         } else {
+            ecs_assert(!readonly, ECS_INTERNAL_ERROR, NULL);
             flecs_defer_begin(world, stage);
         }
 
         ECS_BIT_COND(world->flags, EcsWorldMultiThreaded, op_multi_threaded);
         ecs_assert(world->workers_waiting == 0, ECS_INTERNAL_ERROR, NULL);
 
-        if (op_multi_threaded) {
+        if (op->concurrent) {
+            pq->next_system = pq->cur_i - op->offset;
+        }
+
+        /* With parallel_for the OS API runs the ops on all stages and
+         * returns when they're done, so there is no need to signal workers. */
+        bool signal_workers = op_multi_threaded && !use_parallel_for;
+
+        if (signal_workers) {
             flecs_signal_workers(world);
         }
 
@@ -640,33 +867,42 @@ void flecs_run_pipeline(
             ecs_time_measure(&st);
         }
 
-        const int32_t i = flecs_run_pipeline_ops(
-            world, stage, stage_index, stage_count, delta_time);
+        int32_t i;
+        if (op_multi_threaded && use_parallel_for) {
+            i = flecs_workers_run_pipeline_ops(world, delta_time);
+        } else {
+            i = flecs_run_pipeline_ops(
+                world, stage, stage_index, stage_count, delta_time);
+        }
 
         if (measure_time) {
             /* Don't include merge time in system time */
             world->info.system_time_total += (ecs_ftime_t)ecs_time_measure(&st);
         }
 
-        if (op_multi_threaded) {
+        if (signal_workers) {
             flecs_wait_for_sync(world);
         }
 
         if (!immediate) {
-            ecs_time_t mt = { 0 };
-            if (measure_time) {
-                ecs_time_measure(&mt);
-            }
+            if (!op->no_merge) {
+                ecs_time_t mt = { 0 };
+                if (measure_time) {
+                    ecs_time_measure(&mt);
+                }
 
-            int32_t si;
-            for (si = 0; si < stage_count; si ++) {
-                ecs_stage_t *s = world->stages[si];
-                pq->cur_op->commands_enqueued += ecs_vec_count(&s->cmd->queue);
-            }
+                int32_t si;
+                for (si = 0; si < stage_count; si ++) {
+                    ecs_stage_t *s = world->stages[si];
+                    op->commands_enqueued += ecs_vec_count(&s->cmd->queue);
+                }
+
+                ecs_readonly_end(world);
+                readonly = false;
 
-            ecs_readonly_end(world);
-            if (measure_time) {
-                pq->cur_op->time_spent += ecs_time_measure(&mt);
+                if (measure_time) {
+                    op->time_spent += ecs_time_measure(&mt);
+                }
             }
         } else {
             flecs_defer_end(world, stage);
@@ -676,8 +912,15 @@ void flecs_run_pipeline(
          * threads, to avoid race conditions. */
         pq->cur_i = i;
 
-        flecs_pipeline_update(world, pq, false);
+        if (readonly) {
+            /* Nothing was merged, so the schedule can't have changed */
+            flecs_pipeline_next_system(pq);
+        } else {
+            flecs_pipeline_update(world, pq, false);
+        }
     }
+
+    ecs_assert(!readonly, ECS_INTERNAL_ERROR, NULL);
 }
 
 static
@@ -842,6 +1085,7 @@ ecs_entity_t ecs_pipeline_init(
     ecs_pipeline_state_t *pq = ecs_os_calloc_t(ecs_pipeline_state_t);
     pq->query = query;
     pq->match_count = -1;
+    pq->concurrent = desc->concurrent;
     pq->cr_inactive = flecs_components_ensure(world, EcsEmpty);
     ecs_set(world, result, EcsPipeline, { pq });
 
@@ -17,6 +17,8 @@ typedef struct ecs_pipeline_op_t {
     int64_t commands_enqueued;  /* Number of commands enqueued for sync point */
     bool multi_threaded;        /* Whether systems can be ran multi threaded */
     bool immediate;           /* Whether systems are staged or not */
+    bool concurrent;            /* Whether systems run concurrently on workers */
+    bool no_merge;              /* Sync threads after op without merging */
 } ecs_pipeline_op_t;
 
 struct ecs_pipeline_state_t {
@@ -36,6 +38,18 @@ struct ecs_pipeline_state_t {
     int32_t cur_i;              /* Index in current result */
     int32_t ran_since_merge;    /* Index in current op */
     bool immediate;           /* Is pipeline in readonly mode */
+
+    /* Members for scheduling independent systems concurrently */
+    bool concurrent;            /* Build concurrent ops from system access */
+    int32_t next_system;        /* Next system to claim in concurrent op */
+};
+
+/** Job that is ran by workers instead of the pipeline schedule. */
+struct ecs_worker_job_t {
+    ecs_query_t *query;         /* Query to iterate */
+    ecs_iter_action_t callback; /* Callback to invoke for each result */
+    ecs_os_parallel_job_t action; /* Invoked once per stage instead of query */
+    void *ctx;                  /* Context passed to callback */
 };
 
 typedef struct EcsPipeline {
@@ -85,4 +99,21 @@ void flecs_signal_workers(
 void flecs_wait_for_sync(
     ecs_world_t *world);
 
+/* Are workers ran with the OS API parallel_for instead of worker threads */
+bool flecs_workers_use_parallel_for(
+    const ecs_world_t *world);
+
+/* Run current pipeline ops on all stages with the OS API parallel_for */
+int32_t flecs_workers_run_pipeline_ops(
+    ecs_world_t *world,
+    ecs_ftime_t delta_time);
+
+/* Invoke action once for each stage on the worker threads. The world is in
+ * readonly mode while the action runs, and the action is invoked for stage 0
+ * on the calling thread. */
+void flecs_workers_run(
+    ecs_world_t *world,
+    ecs_os_parallel_job_t action,
+    void *ctx);
+
 #endif
@@ -5,6 +5,7 @@
 
 #include "flecs.h"
 #include "../system/system.h"
+#include "../os_api_impl/os_api_impl.h"
 
 #ifdef FLECS_PIPELINE
 #include "pipeline.h"
@@ -31,6 +32,39 @@ void flecs_sync_worker(
     ecs_os_mutex_unlock(world->sync_mutex);
 }
 
+/* Run job on stage */
+static
+void flecs_run_worker_job(
+    ecs_world_t *world,
+    ecs_stage_t *stage,
+    int32_t stage_index,
+    int32_t stage_count)
+{
+    ecs_worker_job_t *job = world->job;
+    ecs_assert(job != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    if (job->action) {
+        job->action(job->ctx, stage_index);
+        return;
+    }
+
+    ecs_iter_action_t callback = job->callback;
+    ecs_iter_t wit, qit = ecs_query_iter(stage->thread_ctx, job->query);
+    ecs_iter_t *it = &qit;
+
+    qit.callback = callback;
+    qit.ctx = job->ctx;
+
+    if (stage_count > 1) {
+        wit = ecs_worker_iter(it, stage_index, stage_count);
+        it = &wit;
+    }
+
+    while (ecs_iter_next(it)) {
+        callback(it);
+    }
+}
+
 /* Worker thread */
 static
 void* flecs_worker(void *arg) {
@@ -57,8 +91,12 @@ void* flecs_worker(void *arg) {
         ecs_entity_t old_scope = ecs_set_scope((ecs_world_t*)stage, 0);
 
         ecs_dbg_3("worker %d: run", stage->id);
-        flecs_run_pipeline_ops(world, stage, stage->id, world->stage_count, 
-            world->info.delta_time);
+        if (world->job) {
+            flecs_run_worker_job(world, stage, stage->id, world->stage_count);
+        } else {
+            flecs_run_pipeline_ops(world, stage, stage->id, 
+                world->stage_count, world->info.delta_time);
+        }
 
         ecs_set_scope((ecs_world_t*)stage, old_scope);
 
@@ -76,6 +114,82 @@ void* flecs_worker(void *arg) {
     return NULL;
 }
 
+/* Context for running pipeline ops with the OS API parallel_for */
+typedef struct ecs_worker_ops_ctx_t {
+    ecs_world_t *world;
+    ecs_ftime_t delta_time;
+    int32_t result;
+} ecs_worker_ops_ctx_t;
+
+/* Run pipeline ops for a single stage with parallel_for */
+static
+void flecs_worker_ops_job(
+    void *ptr,
+    int32_t stage_index)
+{
+    ecs_worker_ops_ctx_t *ctx = ptr;
+    ecs_world_t *world = ctx->world;
+    ecs_stage_t *stage = world->stages[stage_index];
+
+    if (!stage_index) {
+        ctx->result = flecs_run_pipeline_ops(world, stage, 0, 
+            world->stage_count, ctx->delta_time);
+        return;
+    }
+
+    ecs_entity_t old_scope = ecs_set_scope((ecs_world_t*)stage, 0);
+    flecs_run_pipeline_ops(world, stage, stage_index, world->stage_count, 
+        ctx->delta_time);
+    ecs_set_scope((ecs_world_t*)stage, old_scope);
+}
+
+/* Run query job for a single stage with parallel_for */
+static
+void flecs_worker_query_job(
+    void *ptr,
+    int32_t stage_index)
+{
+    ecs_world_t *world = ptr;
+    flecs_run_worker_job(world, world->stages[stage_index], stage_index, 
+        world->stage_count);
+}
+
+bool flecs_workers_use_parallel_for(
+    const ecs_world_t *world)
+{
+    if (!world->workers_use_task_api || !ecs_os_has_parallel_for()) {
+        return false;
+    }
+
+#ifdef FLECS_OS_API_IMPL
+    /* The builtin parallel_for creates tasks for each call if the application
+     * provides its own task API. Workers that are created once per frame are
+     * cheaper in that case, as each frame can run many multithreaded ops. */
+    if (flecs_os_pool_uses_tasks()) {
+        return false;
+    }
+#endif
+
+    return true;
+}
+
+int32_t flecs_workers_run_pipeline_ops(
+    ecs_world_t *world,
+    ecs_ftime_t delta_time)
+{
+    ecs_assert(flecs_workers_use_parallel_for(world), 
+        ECS_INTERNAL_ERROR, NULL);
+
+    ecs_worker_ops_ctx_t ctx = {
+        .world = world,
+        .delta_time = delta_time
+    };
+
+    ecs_os_parallel_for(flecs_worker_ops_job, &ctx, world->stage_count);
+
+    return ctx.result;
+}
+
 /* Start threads */
 void flecs_create_worker_threads(
     ecs_world_t *world)
@@ -83,6 +197,11 @@ void flecs_create_worker_threads(
     flecs_poly_assert(world, ecs_world_t);
     int32_t stages = ecs_get_stage_count(world);
 
+    if (flecs_workers_use_parallel_for(world)) {
+        /* Workers run on the threads of the OS API parallel_for */
+        return;
+    }
+
     for (int32_t i = 1; i < stages; i ++) {
         ecs_stage_t *stage = (ecs_stage_t*)ecs_get_stage(world, i);
         ecs_assert(stage != NULL, ECS_INTERNAL_ERROR, NULL);
@@ -124,7 +243,7 @@ void flecs_wait_for_workers(
     flecs_poly_assert(world, ecs_world_t);
 
     int32_t stage_count = ecs_get_stage_count(world);
-    if (stage_count <= 1) {
+    if (stage_count <= 1 || flecs_workers_use_parallel_for(world)) {
         return;
     }
 
@@ -250,7 +369,7 @@ void flecs_set_threads_internal(
     bool use_task_api)
 {
     ecs_assert(threads <= 1 || (use_task_api 
-        ? ecs_os_has_task_support() 
+        ? (ecs_os_has_task_support() || ecs_os_has_parallel_for())
         : ecs_os_has_threading()), 
             ECS_MISSING_OS_API, NULL);
 
@@ -308,4 +427,101 @@ bool ecs_using_task_threads(
     return world->workers_use_task_api;
 }
 
+/* Run job on all stages, and merge enqueued commands after all stages are done */
+static
+void flecs_workers_run_job(
+    ecs_world_t *world,
+    ecs_worker_job_t *job)
+{
+    /* Make sure query caches are up to date before locking the world */
+    ecs_run_aperiodic(world, 0);
+
+    bool use_tasks = ecs_using_task_threads(world);
+    if (use_tasks) {
+        flecs_create_worker_threads(world);
+    }
+
+    flecs_wait_for_workers(world);
+
+    int32_t stage_count = ecs_get_stage_count(world);
+    bool multi_threaded = world->worker_cond != 0;
+
+    world->job = job;
+
+    /* Each stage gets its own command queue, so callbacks can enqueue
+     * operations without synchronization. */
+    ecs_readonly_begin(world, multi_threaded);
+
+    if (multi_threaded && flecs_workers_use_parallel_for(world)) {
+        ecs_os_parallel_for(flecs_worker_query_job, world, stage_count);
+    } else {
+        if (multi_threaded) {
+            flecs_signal_workers(world);
+        }
+
+        flecs_run_worker_job(world, world->stages[0], 0, stage_count);
+
+        if (multi_threaded) {
+            flecs_wait_for_sync(world);
+        }
+    }
+
+    world->job = NULL;
+
+    /* Merge commands enqueued by all stages */
+    ecs_readonly_end(world);
+
+    if (use_tasks) {
+        flecs_join_worker_threads(world);
+    }
+}
+
+void flecs_workers_run(
+    ecs_world_t *world,
+    ecs_os_parallel_job_t action,
+    void *ctx)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_assert(!(world->flags & EcsWorldReadonly), ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(world->job == NULL, ECS_INTERNAL_ERROR, NULL);
+
+    ecs_worker_job_t job = {
+        .action = action,
+        .ctx = ctx
+    };
+
+    flecs_workers_run_job(world, &job);
+}
+
+void ecs_query_parallel_each(
+    ecs_world_t *world,
+    ecs_query_t *query,
+    ecs_iter_action_t callback,
+    void *ctx)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(query != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(callback != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!(world->flags & EcsWorldReadonly), ECS_INVALID_OPERATION, 
+        "cannot run parallel query while world is in readonly mode");
+    ecs_check(!ecs_is_deferred(world), ECS_INVALID_OPERATION, 
+        "cannot run parallel query while world is deferred");
+    ecs_check(world->job == NULL, ECS_INVALID_OPERATION, 
+        "cannot nest parallel queries");
+
+    ecs_os_perf_trace_push("flecs.query_parallel_each");
+
+    ecs_worker_job_t job = {
+        .query = query,
+        .callback = callback,
+        .ctx = ctx
+    };
+
+    flecs_workers_run_job(world, &job);
+
+    ecs_os_perf_trace_pop("flecs.query_parallel_each");
+error:
+    return;
+}
+
 #endif
@@ -719,7 +719,8 @@ bool flecs_rest_get_query(
     flecs_set_prev_log(ecs_os_api.log_, try);
     ecs_os_api.log_ = flecs_rest_capture_log;
 
-    ecs_query_t *q = ecs_query(world, { .expr = expr });
+    /* Clients typically poll the same queries, so reuse compiled queries */
+    ecs_query_t *q = ecs_query_plan_cache_get(world, expr);
     if (!q) {
         flecs_rest_reply_set_captured_log(reply);
         if (try) {
@@ -729,7 +730,6 @@ bool flecs_rest_get_query(
     } else {
         ecs_iter_t it = ecs_query_iter(world, q);
         flecs_rest_iter_to_reply(req, reply, q, &it);
-        ecs_query_fini(q);
     }
 
     ecs_os_api.log_ = prev_log;
@@ -829,9 +829,13 @@ void flecs_world_stats_to_json(
     ecs_strbuf_list_push(reply, "{", ",");
     ECS_GAUGE_APPEND(reply, stats, entities.count, "Alive entity ids in the world");
     ECS_GAUGE_APPEND(reply, stats, entities.not_alive_count, "Not alive entity ids in the world");
+    ECS_GAUGE_APPEND(reply, stats, entities.delete_queue_count, "Entities queued for incremental delete");
 
     ECS_GAUGE_APPEND(reply, stats, performance.fps, "Frames per second");
     ECS_COUNTER_APPEND(reply, stats, performance.frame_time, "Time spent in frame");
+    ECS_GAUGE_APPEND(reply, stats, performance.frame_time_p50, "Median time between frames");
+    ECS_GAUGE_APPEND(reply, stats, performance.frame_time_p99, "99th percentile of time between frames");
+    ECS_GAUGE_APPEND(reply, stats, performance.frame_time_max, "Maximum time between frames");
     ECS_COUNTER_APPEND(reply, stats, performance.system_time, "Time spent on running systems in frame");
     ECS_COUNTER_APPEND(reply, stats, performance.emit_time, "Time spent on notifying observers in frame");
     ECS_COUNTER_APPEND(reply, stats, performance.merge_time, "Time spent on merging commands in frame");
@@ -860,6 +864,9 @@ void flecs_world_stats_to_json(
     ECS_GAUGE_APPEND(reply, stats, tables.empty_count, "Empty tables in the world");
     ECS_COUNTER_APPEND(reply, stats, tables.create_count, "Number of new tables created");
     ECS_COUNTER_APPEND(reply, stats, tables.delete_count, "Number of tables deleted");
+    ECS_GAUGE_APPEND(reply, stats, tables.pool_count, "Empty tables with storage freed by table GC");
+    ECS_COUNTER_APPEND(reply, stats, tables.pool_hit_count, "Number of times a table freed by table GC was reused");
+    ECS_COUNTER_APPEND(reply, stats, tables.gc_delete_count, "Number of tables deleted by table GC");
 
     ECS_GAUGE_APPEND(reply, stats, components.tag_count, "Tag ids in use");
     ECS_GAUGE_APPEND(reply, stats, components.component_count, "Component ids in use");
@@ -871,6 +878,7 @@ void flecs_world_stats_to_json(
     ECS_GAUGE_APPEND(reply, stats, queries.query_count, "Queries in the world");
     ECS_GAUGE_APPEND(reply, stats, queries.observer_count, "Observers in the world");
     ECS_GAUGE_APPEND(reply, stats, queries.system_count, "Systems in the world");
+    ECS_GAUGE_APPEND(reply, stats, queries.observer_yield_count, "Existing observer matches not yet yielded");
 
     ECS_COUNTER_APPEND(reply, stats, memory.alloc_count, "Allocations by OS API");
     ECS_COUNTER_APPEND(reply, stats, memory.realloc_count, "Reallocs by OS API");
@@ -1081,6 +1089,25 @@ bool flecs_rest_get_stats(
         return false;
     }
 }
+
+static
+bool flecs_rest_get_profiler(
+    const ecs_http_request_t* req,
+    ecs_http_reply_t *reply)
+{
+    bool clear = false;
+    flecs_rest_bool_param(req, "clear", &clear);
+
+    char *json = ecs_profiler_to_chrome_trace();
+    ecs_strbuf_appendstr(&reply->body, json);
+    ecs_os_free(json);
+
+    if (clear) {
+        ecs_profiler_clear();
+    }
+
+    return true;
+}
 #else
 static
 bool flecs_rest_get_stats(
@@ -1093,6 +1120,43 @@ bool flecs_rest_get_stats(
     (void)reply;
     return false;
 }
+
+static
+bool flecs_rest_get_profiler(
+    const ecs_http_request_t* req,
+    ecs_http_reply_t *reply)
+{
+    (void)req;
+    (void)reply;
+    return false;
+}
+#endif
+
+#ifdef FLECS_METRICS
+static
+bool flecs_rest_get_metrics(
+    ecs_world_t *world,
+    ecs_http_reply_t *reply)
+{
+    const char *metrics = ecs_metrics_to_prometheus(world);
+    if (!metrics) {
+        return false;
+    }
+
+    ecs_strbuf_appendstr(&reply->body, metrics);
+    reply->content_type = "text/plain; version=0.0.4; charset=utf-8";
+    return true;
+}
+#else
+static
+bool flecs_rest_get_metrics(
+    ecs_world_t *world,
+    ecs_http_reply_t *reply)
+{
+    (void)world;
+    (void)reply;
+    return false;
+}
 #endif
 
 static
@@ -1506,6 +1570,14 @@ bool flecs_rest_reply(
         } else if (!ecs_os_strncmp(req->path, "stats/", 6)) {
             return flecs_rest_get_stats(world, req, reply);
 
+        /* Profiler endpoint */
+        } else if (!ecs_os_strcmp(req->path, "profiler")) {
+            return flecs_rest_get_profiler(req, reply);
+
+        /* Metrics endpoint (Prometheus text format) */
+        } else if (!ecs_os_strcmp(req->path, "metrics")) {
+            return flecs_rest_get_metrics(world, reply);
+
         /* Tables endpoint */
         } else if (!ecs_os_strncmp(req->path, "tables", 6)) {
             return flecs_rest_get_tables(world, req, reply);
@@ -9,6 +9,8 @@
 #ifdef FLECS_STATS
 
 ECS_COMPONENT_DECLARE(FlecsStats);
+ECS_COMPONENT_DECLARE(EcsStatsSettings);
+ECS_COMPONENT_DECLARE(EcsCompactStats);
 
 ecs_entity_t EcsPeriod1s = 0;
 ecs_entity_t EcsPeriod1m = 0;
@@ -24,6 +26,13 @@ typedef struct {
     ecs_query_t *query;
 } ecs_monitor_stats_ctx_t;
 
+typedef struct {
+    ecs_stats_api_t api;
+    ecs_query_t *query;
+    void *stats;                /* Scratch statistics, reused each frame */
+    ecs_metric_t **metrics;     /* Metrics of scratch statistics */
+} ecs_compact_stats_ctx_t;
+
 typedef struct {
     ecs_stats_api_t api;
 } ecs_reduce_stats_ctx_t;
@@ -33,15 +42,45 @@ typedef struct {
     int32_t interval;
 } ecs_aggregate_stats_ctx_t;
 
+void flecs_stats_overhead_add(
+    ecs_world_t *world,
+    ecs_time_t *start)
+{
+    if (!ecs_os_has_time()) {
+        return;
+    }
+
+    EcsWorldSummary *summary = ecs_get_mut(world, EcsWorld, EcsWorldSummary);
+    if (summary) {
+        double t = ecs_time_measure(start);
+        summary->stats_time_total += t;
+        summary->stats_time_last += t;
+    }
+}
+
+static
+void flecs_stats_overhead_start(
+    ecs_time_t *start)
+{
+    if (ecs_os_has_time()) {
+        ecs_os_get_time(start);
+    }
+}
+
 static
 void MonitorStats(ecs_iter_t *it) {
     ecs_world_t *world = it->real_world;
     ecs_monitor_stats_ctx_t *ctx = it->ctx;
 
+    ecs_time_t start;
+    flecs_stats_overhead_start(&start);
+
     EcsStatsHeader *hdr = ecs_field_w_size(it, ecs_field_size(it, 0), 0);
 
+    /* Use time elapsed since last run, which can be more than one frame when
+     * the sample interval is larger than 1 */
     ecs_ftime_t elapsed = hdr->elapsed;
-    hdr->elapsed += it->delta_time;
+    hdr->elapsed += it->delta_system_time;
 
     int32_t t_last = (int32_t)(elapsed * 60);
     int32_t t_next = (int32_t)(hdr->elapsed * 60);
@@ -119,15 +158,20 @@ void MonitorStats(ecs_iter_t *it) {
         }
     } while (true);
 
-     if (dif > 1) {
+    if (dif > 1) {
         hdr->reduce_count = 0;
     }
+
+    flecs_stats_overhead_add(world, &start);
 }
 
 static
 void ReduceStats(ecs_iter_t *it) {
     ecs_reduce_stats_ctx_t *ctx = it->ctx;
 
+    ecs_time_t start;
+    flecs_stats_overhead_start(&start);
+
     void *dst = ecs_field_w_size(it, ecs_field_size(it, 0), 0);
     void *src = ecs_field_w_size(it, ecs_field_size(it, 1), 1);
 
@@ -145,6 +189,8 @@ void ReduceStats(ecs_iter_t *it) {
             ctx->api.reduce(dst_el, src_el);
         }
     }
+
+    flecs_stats_overhead_add(it->real_world, &start);
 }
 
 static
@@ -152,6 +198,9 @@ void AggregateStats(ecs_iter_t *it) {
     ecs_aggregate_stats_ctx_t *ctx = it->ctx;
     int32_t interval = ctx->interval;
 
+    ecs_time_t start;
+    flecs_stats_overhead_start(&start);
+
     EcsStatsHeader *dst_hdr = ecs_field_w_size(it, ecs_field_size(it, 0), 0);
     EcsStatsHeader *src_hdr = ecs_field_w_size(it, ecs_field_size(it, 1), 1);
 
@@ -213,6 +262,131 @@ void AggregateStats(ecs_iter_t *it) {
     if (dst_hdr->reduce_count >= interval) {
         dst_hdr->reduce_count = 0;
     }
+
+    flecs_stats_overhead_add(it->real_world, &start);
+}
+
+static
+ecs_size_t flecs_compact_stats_size(
+    int32_t metric_count,
+    int32_t window)
+{
+    return ECS_SIZEOF(ecs_compact_stats_t) + 
+        metric_count * ECS_SIZEOF(double) + 
+        window * metric_count * ECS_SIZEOF(ecs_float_t);
+}
+
+static
+ecs_compact_stats_t* flecs_compact_stats_ensure(
+    ecs_map_t *map,
+    ecs_entity_t key,
+    int32_t metric_count,
+    int32_t window)
+{
+    ecs_map_val_t *val = ecs_map_ensure(map, key);
+    ecs_compact_stats_t *result = (ecs_compact_stats_t*)(uintptr_t)*val;
+    if (result && result->window == window) {
+        return result;
+    }
+
+    /* Window size changed, which discards existing samples */
+    ecs_os_free(result);
+
+    /* Store metrics and samples in the same allocation */
+    result = ecs_os_calloc(flecs_compact_stats_size(metric_count, window));
+    result->metric_count = metric_count;
+    result->window = window;
+    result->t = window - 1;
+    result->values = ECS_OFFSET_T(result, ecs_compact_stats_t);
+    result->samples = ECS_OFFSET(result->values, 
+        metric_count * ECS_SIZEOF(double));
+    *val = (ecs_map_val_t)(uintptr_t)result;
+    return result;
+}
+
+static
+void flecs_compact_stats_record(
+    ecs_world_t *world,
+    const ecs_stats_api_t *api,
+    ecs_compact_stats_t *dst,
+    ecs_entity_t res,
+    void *stats,
+    ecs_metric_t **metrics)
+{
+    int32_t m, count = dst->metric_count;
+
+    /* Reuse scratch statistics for all resources. The get callback records
+     * into the position after t, and computes counter deltas from the value
+     * at t, so restore the last value of each counter. */
+    api->set_t(stats, 0);
+    for (m = 0; m < count; m ++) {
+        ecs_metric_t *metric = metrics[m];
+        metric->counter.value[0] = dst->values[m];
+        metric->counter.value[1] = 0;
+        metric->gauge.avg[1] = 0;
+    }
+
+    api->get(world, res, stats);
+
+    int32_t t = dst->t = (dst->t + 1) % dst->window;
+    ecs_float_t *sample = &dst->samples[t * count];
+    for (m = 0; m < count; m ++) {
+        ecs_metric_t *metric = metrics[m];
+        double value = metric->counter.value[1];
+        if (!dst->count && ECS_NEQZERO(value)) {
+            /* Counter doesn't have a previous value yet */
+            sample[m] = 0;
+        } else {
+            sample[m] = metric->gauge.avg[1];
+        }
+        dst->values[m] = value;
+    }
+
+    if (dst->count < dst->window) {
+        dst->count ++;
+    }
+}
+
+static
+void CompactStats(ecs_iter_t *it) {
+    ecs_world_t *world = it->real_world;
+    ecs_compact_stats_ctx_t *ctx = it->ctx;
+
+    ecs_time_t start;
+    flecs_stats_overhead_start(&start);
+
+    EcsCompactStats *compact = ecs_field(it, EcsCompactStats, 0);
+    const EcsStatsSettings *settings = ecs_singleton_get(
+        world, EcsStatsSettings);
+    int32_t window = FLECS_STATS_COMPACT_WINDOW;
+    if (settings && settings->compact_window > 0) {
+        window = settings->compact_window;
+    }
+
+    int32_t metric_count = ctx->api.metric_count;
+    void *stats = ctx->stats;
+    ecs_metric_t **metrics = ctx->metrics;
+
+    if (ctx->query) {
+        ecs_iter_t qit = ecs_query_iter(it->world, ctx->query);
+        while (ecs_query_next(&qit)) {
+            int32_t i;
+            for (i = 0; i < qit.count; i ++) {
+                ecs_entity_t res = qit.entities[i];
+                ecs_compact_stats_t *dst = flecs_compact_stats_ensure(
+                    &compact->stats, res, metric_count, window);
+                flecs_compact_stats_record(
+                    world, &ctx->api, dst, res, stats, metrics);
+            }
+        }
+    } else {
+        ecs_compact_stats_t *dst = flecs_compact_stats_ensure(
+            &compact->stats, EcsWorld, metric_count, window);
+        flecs_compact_stats_record(
+            world, &ctx->api, dst, 0, stats, metrics);
+    }
+
+    flecs_stats_overhead_add(world, &start);
 }
 
 static
@@ -226,6 +400,19 @@ void flecs_monitor_ctx_free(
     ecs_os_free(ctx);
 }
 
+static
+void flecs_compact_ctx_free(
+    void *ptr)
+{
+    ecs_compact_stats_ctx_t *ctx = ptr;
+    if (ctx->query) {
+        ecs_query_fini(ctx->query);
+    }
+    ecs_os_free(ctx->metrics);
+    ecs_os_free(ctx->stats);
+    ecs_os_free(ctx);
+}
+
 static
 void flecs_reduce_ctx_free(
     void *ptr)
@@ -247,13 +434,21 @@ void flecs_stats_api_import(
     ecs_entity_t kind = api->monitor_component_id;
     ecs_entity_t prev = ecs_set_scope(world, kind);
 
-    ecs_query_t *q = NULL;
+    ecs_query_t *q = NULL, *compact_q = NULL;
     if (api->query_component_id) {
         q = ecs_query(world, {
             .terms = {{ .id = api->query_component_id }},
             .cache_kind = EcsQueryCacheNone,
             .flags = EcsQueryMatchDisabled
         });
+
+        if (api->metrics) {
+            compact_q = ecs_query(world, {
+                .terms = {{ .id = api->query_component_id }},
+                .cache_kind = EcsQueryCacheNone,
+                .flags = EcsQueryMatchDisabled
+            });
+        }
     }
 
     // Called each frame, collects 60 measurements per second
@@ -364,6 +559,27 @@ void flecs_stats_api_import(
         });
     }
 
+    // Called each frame when compact statistics are enabled
+    if (api->metrics) {
+        ecs_compact_stats_ctx_t *ctx = ecs_os_calloc_t(ecs_compact_stats_ctx_t);
+        ctx->api = *api;
+        ctx->query = compact_q;
+        ctx->stats = ecs_os_calloc(api->stats_size);
+        ctx->metrics = ecs_os_calloc_n(ecs_metric_t*, api->metric_count);
+        api->metrics(ctx->stats, ctx->metrics);
+
+        ecs_system(world, {
+            .entity = ecs_entity(world, { .name = "MonitorCompact", .add = ecs_ids(ecs_dependson(EcsPreFrame)) }),
+            .query.terms = {{
+                .id = ecs_pair(ecs_id(EcsCompactStats), kind),
+                .src.id = EcsWorld 
+            }},
+            .callback = CompactStats,
+            .ctx = ctx,
+            .ctx_free = flecs_compact_ctx_free
+        });
+    }
+
     ecs_set_scope(world, prev);
 
     ecs_add_pair(world, EcsWorld, kind, EcsPeriod1s);
@@ -373,6 +589,165 @@ void flecs_stats_api_import(
     ecs_add_pair(world, EcsWorld, kind, EcsPeriod1w);
 }
 
+static
+void flecs_compact_stats_dtor(
+    EcsCompactStats *ptr)
+{
+    ecs_map_iter_t it = ecs_map_iter(&ptr->stats);
+    while (ecs_map_next(&it)) {
+        ecs_os_free(ecs_map_ptr(&it));
+    }
+    ecs_map_fini(&ptr->stats);
+}
+
+static ECS_CTOR(EcsCompactStats, ptr, {
+    ecs_os_zeromem(ptr);
+    ecs_map_init(&ptr->stats, NULL);
+})
+
+static ECS_COPY(EcsCompactStats, dst, src, {
+    (void)dst;
+    (void)src;
+    ecs_abort(ECS_INVALID_OPERATION, "cannot copy compact stats component");
+})
+
+static ECS_MOVE(EcsCompactStats, dst, src, {
+    flecs_compact_stats_dtor(dst);
+    ecs_os_memcpy_t(dst, src, EcsCompactStats);
+    ecs_os_zeromem(src);
+})
+
+static ECS_DTOR(EcsCompactStats, ptr, {
+    flecs_compact_stats_dtor(ptr);
+})
+
+static
+int64_t flecs_compact_stats_memory(
+    const ecs_world_t *world,
+    ecs_entity_t kind)
+{
+    const EcsCompactStats *ptr = ecs_get_pair(
+        world, EcsWorld, EcsCompactStats, kind);
+    if (!ptr) {
+        return 0;
+    }
+
+    int64_t result = ECS_SIZEOF(EcsCompactStats);
+    ecs_map_iter_t it = ecs_map_iter(&ptr->stats);
+    while (ecs_map_next(&it)) {
+        ecs_compact_stats_t *stats = ecs_map_ptr(&it);
+        result += flecs_compact_stats_size(stats->metric_count, stats->window);
+    }
+
+    return result;
+}
+
+int64_t flecs_stats_memory(
+    ecs_world_t *world)
+{
+    ecs_entity_t periods[] = {
+        EcsPeriod1s, EcsPeriod1m, EcsPeriod1h, EcsPeriod1d, EcsPeriod1w };
+    int64_t result = 0;
+    int32_t p;
+
+    for (p = 0; p < 5; p ++) {
+        ecs_entity_t period = periods[p];
+        if (ecs_has_pair(world, EcsWorld, ecs_id(EcsWorldStats), period)) {
+            result += ECS_SIZEOF(EcsWorldStats);
+        }
+
+        const EcsSystemStats *ss = ecs_get_pair(
+            world, EcsWorld, EcsSystemStats, period);
+        if (ss) {
+            result += ECS_SIZEOF(EcsSystemStats) + 
+                ecs_map_count(&ss->stats) * ECS_SIZEOF(ecs_system_stats_t);
+        }
+
+        const EcsPipelineStats *ps = ecs_get_pair(
+            world, EcsWorld, EcsPipelineStats, period);
+        if (ps) {
+            result += ECS_SIZEOF(EcsPipelineStats);
+            ecs_map_iter_t it = ecs_map_iter(&ps->stats);
+            while (ecs_map_next(&it)) {
+                ecs_pipeline_stats_t *stats = ecs_map_ptr(&it);
+                result += ECS_SIZEOF(ecs_pipeline_stats_t) +
+                    ecs_vec_size(&stats->systems) * ECS_SIZEOF(ecs_entity_t) +
+                    ecs_vec_size(&stats->sync_points) * 
+                        ECS_SIZEOF(ecs_sync_stats_t);
+            }
+        }
+    }
+
+    result += flecs_compact_stats_memory(world, ecs_id(EcsWorldStats));
+    result += flecs_compact_stats_memory(world, ecs_id(EcsSystemStats));
+
+    return result;
+}
+
+static
+void flecs_stats_set_sample_interval(
+    ecs_world_t *world,
+    ecs_entity_t system,
+    int32_t interval)
+{
+    /* Only add rate filter when needed, so that systems by default don't
+     * depend on a tick source. */
+    if (system && ((interval > 1) || ecs_has(world, system, EcsRateFilter))) {
+        ecs_set_rate(world, system, interval, 0);
+    }
+}
+
+static
+void flecs_stats_apply_settings(
+    ecs_world_t *world,
+    const EcsStatsSettings *settings,
+    ecs_entity_t kind)
+{
+    ecs_entity_t periods[] = {
+        EcsPeriod1s, EcsPeriod1m, EcsPeriod1h, EcsPeriod1d, EcsPeriod1w };
+    int32_t interval = settings->sample_interval;
+    if (interval < 1) {
+        interval = 1;
+    }
+
+    ecs_entity_t monitor = ecs_lookup_child(world, kind, "Monitor1s");
+    ecs_entity_t compact = ecs_lookup_child(world, kind, "MonitorCompact");
+    flecs_stats_set_sample_interval(world, monitor, interval);
+    flecs_stats_set_sample_interval(world, compact, interval);
+
+    /* Removing the history tiers frees their memory and prevents the systems
+     * that collect and reduce them from running. */
+    int32_t p;
+    if (settings->compact) {
+        for (p = 0; p < 5; p ++) {
+            ecs_remove_pair(world, EcsWorld, kind, periods[p]);
+        }
+        if (compact) {
+            ecs_add_pair(world, EcsWorld, ecs_id(EcsCompactStats), kind);
+        }
+    } else {
+        ecs_remove_pair(world, EcsWorld, ecs_id(EcsCompactStats), kind);
+        for (p = 0; p < 5; p ++) {
+            ecs_add_pair(world, EcsWorld, kind, periods[p]);
+        }
+    }
+}
+
+static
+void OnSetStatsSettings(ecs_iter_t *it) {
+    EcsStatsSettings *settings = ecs_field(it, EcsStatsSettings, 0);
+
+    int32_t i, count = it->count;
+    for (i = 0; i < count; i ++) {
+        flecs_stats_apply_settings(it->world, &settings[i], 
+            ecs_id(EcsWorldStats));
+        flecs_stats_apply_settings(it->world, &settings[i], 
+            ecs_id(EcsSystemStats));
+        flecs_stats_apply_settings(it->world, &settings[i], 
+            ecs_id(EcsPipelineStats));
+    }
+}
+
 void FlecsStatsImport(
     ecs_world_t *world)
 {
@@ -399,10 +774,43 @@ void FlecsStatsImport(
     EcsPeriod1d = ecs_entity(world, { .name = "EcsPeriod1d" });
     EcsPeriod1w = ecs_entity(world, { .name = "EcsPeriod1w" });
 
+    ECS_COMPONENT_DEFINE(world, EcsStatsSettings);
+    ECS_COMPONENT_DEFINE(world, EcsCompactStats);
+
+    ecs_set_hooks(world, EcsCompactStats, {
+        .ctor = ecs_ctor(EcsCompactStats),
+        .copy = ecs_copy(EcsCompactStats),
+        .move = ecs_move(EcsCompactStats),
+        .dtor = ecs_dtor(EcsCompactStats)
+    });
+
+#ifdef FLECS_META
+    ecs_struct(world, {
+        .entity = ecs_id(EcsStatsSettings),
+        .members = {
+            { .name = "sample_interval", .type = ecs_id(ecs_i32_t) },
+            { .name = "compact", .type = ecs_id(ecs_bool_t) },
+            { .name = "compact_window", .type = ecs_id(ecs_i32_t) }
+        }
+    });
+#endif
+
     FlecsWorldSummaryImport(world);
     FlecsWorldMonitorImport(world);
     FlecsSystemMonitorImport(world);
     FlecsPipelineMonitorImport(world);
+
+    ecs_observer(world, {
+        .entity = ecs_entity(world, { .name = "OnSetStatsSettings" }),
+        .events = { EcsOnSet },
+        .query.terms = {{ .id = ecs_id(EcsStatsSettings) }},
+        .callback = OnSetStatsSettings
+    });
+
+    ecs_singleton_set(world, EcsStatsSettings, {
+        .sample_interval = 1,
+        .compact_window = FLECS_STATS_COMPACT_WINDOW
+    });
     
     if (ecs_os_has_time()) {
         ecs_measure_frame_time(world, true);
@@ -0,0 +1,288 @@
+/**
+ * @file addons/stats/profiler.c
+ * @brief Ring buffer profiler that records zones from perf trace hooks.
+ *
+ * The profiler installs the perf_trace_push_ and perf_trace_pop_ callbacks of
+ * the OS API, and records a timestamped event for each callback in a fixed
+ * size ring buffer. Threads claim slots with an atomic increment, so recording
+ * doesn't require locks. When the buffer is full the oldest events are
+ * overwritten, which keeps the memory footprint constant.
+ */
+
+#include "stats.h"
+
+#ifdef FLECS_STATS
+
+/* Default number of events in the ring buffer */
+#define FLECS_PROFILER_DEFAULT_CAPACITY (16 * 1024)
+
+/* Zone names longer than this are truncated */
+#define FLECS_PROFILER_NAME_SIZE (39)
+
+typedef struct flecs_profiler_event_t {
+    uint64_t index;                 /* Index of event, written last */
+    uint64_t time;                  /* Timestamp (ns) */
+    ecs_os_thread_id_t thread;      /* Thread that recorded the event */
+    char name[FLECS_PROFILER_NAME_SIZE];
+    char phase;                     /* 'B' for zone begin, 'E' for zone end */
+} flecs_profiler_event_t;
+
+typedef struct flecs_profiler_t {
+    flecs_profiler_event_t *events;
+    int64_t capacity;               /* Power of two */
+    int64_t head;                   /* Index of next event */
+    int64_t first;                  /* First event not discarded by clear */
+    int32_t recorders;              /* Threads currently recording an event */
+    uint64_t start_time;
+    ecs_os_api_perf_trace_t prev_push;
+    ecs_os_api_perf_trace_t prev_pop;
+} flecs_profiler_t;
+
+static flecs_profiler_t flecs_profiler;
+
+static
+void flecs_profiler_record(
+    const char *name,
+    char phase)
+{
+    flecs_profiler_t *p = &flecs_profiler;
+
+    /* Register as recorder before loading the buffer, so that stop can wait
+     * for threads that still write to the buffer before freeing it. */
+    ecs_os_ainc(&p->recorders);
+    flecs_profiler_event_t *events = p->events;
+    if (!events) {
+        ecs_os_adec(&p->recorders);
+        return;
+    }
+
+    int64_t i = ecs_os_lainc(&p->head) - 1;
+    flecs_profiler_event_t *ev = &events[i & (p->capacity - 1)];
+
+    /* Invalidate slot so it's skipped while it's being written */
+    ev->index = UINT64_MAX;
+    ev->time = ecs_os_now();
+    ev->thread = ecs_os_thread_self();
+    ev->phase = phase;
+
+    int32_t c = 0;
+    if (name) {
+        for (; c < (FLECS_PROFILER_NAME_SIZE - 1) && name[c]; c ++) {
+            ev->name[c] = name[c];
+        }
+    }
+    ev->name[c] = '\0';
+
+    ev->index = (uint64_t)i;
+
+    ecs_os_adec(&p->recorders);
+}
+
+static
+void flecs_profiler_push(
+    const char *file,
+    size_t line,
+    const char *name)
+{
+    flecs_profiler_record(name, 'B');
+    if (flecs_profiler.prev_push) {
+        flecs_profiler.prev_push(file, line, name);
+    }
+}
+
+static
+void flecs_profiler_pop(
+    const char *file,
+    size_t line,
+    const char *name)
+{
+    flecs_profiler_record(name, 'E');
+    if (flecs_profiler.prev_pop) {
+        flecs_profiler.prev_pop(file, line, name);
+    }
+}
+
+void ecs_profiler_start(
+    int32_t capacity)
+{
+    ecs_check(capacity >= 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(flecs_profiler.events == NULL, ECS_INVALID_OPERATION,
+        "profiler is already running");
+
+    if (!capacity) {
+        capacity = FLECS_PROFILER_DEFAULT_CAPACITY;
+    }
+
+    int64_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+
+    flecs_profiler_t *p = &flecs_profiler;
+    p->capacity = size;
+    p->head = 0;
+    p->first = 0;
+    p->start_time = ecs_os_now();
+    p->prev_push = ecs_os_api.perf_trace_push_;
+    p->prev_pop = ecs_os_api.perf_trace_pop_;
+    p->events = ecs_os_calloc_n(flecs_profiler_event_t, (int32_t)size);
+
+    ecs_os_api.perf_trace_push_ = flecs_profiler_push;
+    ecs_os_api.perf_trace_pop_ = flecs_profiler_pop;
+error:
+    return;
+}
+
+void ecs_profiler_stop(void) {
+    flecs_profiler_t *p = &flecs_profiler;
+    if (!p->events) {
+        return;
+    }
+
+    if (ecs_os_api.perf_trace_push_ == flecs_profiler_push) {
+        ecs_os_api.perf_trace_push_ = p->prev_push;
+    }
+    if (ecs_os_api.perf_trace_pop_ == flecs_profiler_pop) {
+        ecs_os_api.perf_trace_pop_ = p->prev_pop;
+    }
+
+    /* Threads that loaded the buffer before it was reset may still be writing
+     * an event, wait for them before freeing the buffer. */
+    flecs_profiler_event_t *events = p->events;
+    p->events = NULL;
+    while (ecs_os_ainc(&p->recorders) != 1) {
+        ecs_os_adec(&p->recorders);
+        ecs_os_sleep(0, 1000);
+    }
+    ecs_os_adec(&p->recorders);
+
+    ecs_os_free(events);
+    ecs_os_zeromem(p);
+}
+
+bool ecs_profiler_is_running(void) {
+    return flecs_profiler.events != NULL;
+}
+
+void ecs_profiler_clear(void) {
+    flecs_profiler.first = flecs_profiler.head;
+}
+
+typedef struct flecs_profiler_thread_t {
+    ecs_os_thread_id_t id;
+    int32_t depth;
+} flecs_profiler_thread_t;
+
+static
+flecs_profiler_thread_t* flecs_profiler_get_thread(
+    ecs_vec_t *threads,
+    ecs_os_thread_id_t id,
+    int32_t *index_out)
+{
+    int32_t i, count = ecs_vec_count(threads);
+    flecs_profiler_thread_t *t = ecs_vec_first(threads);
+    for (i = 0; i < count; i ++) {
+        if (t[i].id == id) {
+            *index_out = i;
+            return &t[i];
+        }
+    }
+
+    flecs_profiler_thread_t *result = ecs_vec_append_t(
+        NULL, threads, flecs_profiler_thread_t);
+    result->id = id;
+    result->depth = 0;
+    *index_out = count;
+    return result;
+}
+
+static
+void flecs_profiler_append_time(
+    ecs_strbuf_t *buf,
+    uint64_t t)
+{
+    /* Chrome trace timestamps are in microseconds */
+    uint64_t ns = t % 1000;
+    ecs_strbuf_appendint(buf, (int64_t)(t / 1000));
+    ecs_strbuf_appendch(buf, '.');
+    ecs_strbuf_appendch(buf, (char)('0' + ns / 100));
+    ecs_strbuf_appendch(buf, (char)('0' + (ns / 10) % 10));
+    ecs_strbuf_appendch(buf, (char)('0' + ns % 10));
+}
+
+char* ecs_profiler_to_chrome_trace(void) {
+    flecs_profiler_t *p = &flecs_profiler;
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    ecs_vec_t threads;
+    ecs_vec_init_t(NULL, &threads, flecs_profiler_thread_t, 0);
+
+    ecs_strbuf_appendlit(&buf, "{\"traceEvents\":");
+    ecs_strbuf_list_push(&buf, "[", ",");
+
+    if (p->events) {
+        int64_t head = p->head;
+        int64_t start = head - p->capacity;
+        if (start < p->first) {
+            start = p->first;
+        }
+        if (start < 0) {
+            start = 0;
+        }
+
+        int64_t i;
+        for (i = start; i < head; i ++) {
+            volatile flecs_profiler_event_t *slot = 
+                &p->events[i & (p->capacity - 1)];
+            if (slot->index != (uint64_t)i) {
+                /* Event is being written or was overwritten */
+                continue;
+            }
+
+            /* Copy the event and check that the slot wasn't reclaimed by a 
+             * writer while copying, in which case the copy may be torn. */
+            flecs_profiler_event_t copy = *slot;
+            if (slot->index != (uint64_t)i) {
+                continue;
+            }
+
+            flecs_profiler_event_t *ev = &copy;
+
+            int32_t tid;
+            flecs_profiler_thread_t *t = flecs_profiler_get_thread(
+                &threads, ev->thread, &tid);
+            if (ev->phase == 'E') {
+                if (!t->depth) {
+                    /* Begin of zone was overwritten */
+                    continue;
+                }
+                t->depth --;
+            } else {
+                t->depth ++;
+            }
+
+            ecs_strbuf_list_next(&buf);
+            ecs_strbuf_appendlit(&buf, "{\"name\":\"");
+            char name[FLECS_PROFILER_NAME_SIZE * 2 + 1];
+            flecs_stresc(name, ECS_SIZEOF(name) - 1, '"', ev->name);
+            name[ECS_SIZEOF(name) - 1] = '\0';
+            ecs_strbuf_appendstr(&buf, name);
+            ecs_strbuf_appendlit(&buf, "\",\"ph\":\"");
+            ecs_strbuf_appendch(&buf, ev->phase);
+            ecs_strbuf_appendlit(&buf, "\",\"ts\":");
+            flecs_profiler_append_time(&buf, ev->time > p->start_time
+                ? ev->time - p->start_time : 0);
+            ecs_strbuf_appendlit(&buf, ",\"pid\":0,\"tid\":");
+            ecs_strbuf_appendint(&buf, tid);
+            ecs_strbuf_appendch(&buf, '}');
+        }
+    }
+
+    ecs_strbuf_list_pop(&buf, "]");
+    ecs_strbuf_appendch(&buf, '}');
+
+    ecs_vec_fini_t(NULL, &threads, flecs_profiler_thread_t);
+
+    return ecs_strbuf_get(&buf);
+}
+
+#endif
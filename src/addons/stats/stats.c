@@ -16,12 +16,6 @@
 #define ECS_COUNTER_RECORD(m, t, value)\
     flecs_counter_record(m, t, (double)(value))
 
-#define ECS_METRIC_FIRST(stats)\
-    ECS_CAST(ecs_metric_t*, ECS_OFFSET(&stats->first_, ECS_SIZEOF(int64_t)))
-
-#define ECS_METRIC_LAST(stats)\
-    ECS_CAST(ecs_metric_t*, ECS_OFFSET(&stats->last_, -ECS_SIZEOF(ecs_metric_t)))
-
 static
 int32_t t_next(
     int32_t t)
@@ -174,6 +168,61 @@ error:
     return;
 }
 
+ecs_float_t ecs_compact_stats_sample(
+    const ecs_compact_stats_t *stats,
+    int32_t metric,
+    int32_t age)
+{
+    ecs_check(stats != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(metric >= 0 && metric < stats->metric_count, 
+        ECS_INVALID_PARAMETER, NULL);
+    ecs_check(age >= 0, ECS_INVALID_PARAMETER, NULL);
+
+    if (age >= stats->count) {
+        return 0;
+    }
+
+    int32_t t = (stats->t - age + stats->window) % stats->window;
+    return stats->samples[t * stats->metric_count + metric];
+error:
+    return 0;
+}
+
+ecs_float_t ecs_compact_stats_avg(
+    const ecs_compact_stats_t *stats,
+    int32_t metric)
+{
+    ecs_check(stats != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(metric >= 0 && metric < stats->metric_count, 
+        ECS_INVALID_PARAMETER, NULL);
+
+    if (!stats->count) {
+        return 0;
+    }
+
+    ecs_float_t sum = 0;
+    int32_t i;
+    for (i = 0; i < stats->count; i ++) {
+        sum += stats->samples[i * stats->metric_count + metric];
+    }
+
+    return sum / (ecs_float_t)stats->count;
+error:
+    return 0;
+}
+
+double ecs_compact_stats_value(
+    const ecs_compact_stats_t *stats,
+    int32_t metric)
+{
+    ecs_check(stats != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(metric >= 0 && metric < stats->metric_count, 
+        ECS_INVALID_PARAMETER, NULL);
+    return stats->values[metric];
+error:
+    return 0;
+}
+
 static
 void flecs_stats_reduce(
     ecs_metric_t *dst_cur,
@@ -271,9 +320,13 @@ void ecs_world_stats_get(
     } else {
         ECS_GAUGE_RECORD(&s->performance.fps, t, 0);
     }
+    ECS_GAUGE_RECORD(&s->performance.frame_time_p50, t, world->info.frame_time_p50);
+    ECS_GAUGE_RECORD(&s->performance.frame_time_p99, t, world->info.frame_time_p99);
+    ECS_GAUGE_RECORD(&s->performance.frame_time_max, t, world->info.frame_time_max);
 
     ECS_GAUGE_RECORD(&s->entities.count, t, flecs_entities_count(world));
     ECS_GAUGE_RECORD(&s->entities.not_alive_count, t, flecs_entities_not_alive_count(world));
+    ECS_GAUGE_RECORD(&s->entities.delete_queue_count, t, world->info.delete_queue_count);
 
     ECS_GAUGE_RECORD(&s->components.tag_count, t, world->info.tag_id_count);
     ECS_GAUGE_RECORD(&s->components.component_count, t, world->info.component_id_count);
@@ -287,9 +340,13 @@ void ecs_world_stats_get(
     if (ecs_is_alive(world, EcsSystem)) {
         ECS_GAUGE_RECORD(&s->queries.system_count, t, ecs_count_id(world, EcsSystem));
     }
+    ECS_GAUGE_RECORD(&s->queries.observer_yield_count, t, world->info.observer_yield_count);
     ECS_COUNTER_RECORD(&s->tables.create_count, t, world->info.table_create_total);
     ECS_COUNTER_RECORD(&s->tables.delete_count, t, world->info.table_delete_total);
     ECS_GAUGE_RECORD(&s->tables.count, t, world->info.table_count);
+    ECS_GAUGE_RECORD(&s->tables.pool_count, t, world->info.table_pool_count);
+    ECS_COUNTER_RECORD(&s->tables.pool_hit_count, t, world->info.table_pool_hit_total);
+    ECS_COUNTER_RECORD(&s->tables.gc_delete_count, t, world->info.table_gc_delete_total);
 
     ECS_COUNTER_RECORD(&s->commands.add_count, t, world->info.cmd.add_count);
     ECS_COUNTER_RECORD(&s->commands.remove_count, t, world->info.cmd.remove_count);
@@ -716,6 +773,9 @@ void ecs_world_stats_log(
     ecs_trace("");
     flecs_gauge_print("actual FPS", t, &s->performance.fps);
     flecs_counter_print("frame time", t, &s->performance.frame_time);
+    flecs_gauge_print("frame time p50", t, &s->performance.frame_time_p50);
+    flecs_gauge_print("frame time p99", t, &s->performance.frame_time_p99);
+    flecs_gauge_print("frame time max", t, &s->performance.frame_time_max);
     flecs_counter_print("system time", t, &s->performance.system_time);
     flecs_counter_print("merge time", t, &s->performance.merge_time);
     flecs_counter_print("simulation time elapsed", t, &s->performance.world_time);
@@ -729,15 +789,20 @@ void ecs_world_stats_log(
     ecs_trace("");
     flecs_gauge_print("alive entity count", t, &s->entities.count);
     flecs_gauge_print("not alive entity count", t, &s->entities.not_alive_count);
+    flecs_gauge_print("delete queue count", t, &s->entities.delete_queue_count);
     ecs_trace("");
     flecs_gauge_print("query count", t, &s->queries.query_count);
     flecs_gauge_print("observer count", t, &s->queries.observer_count);
     flecs_gauge_print("system count", t, &s->queries.system_count);
+    flecs_gauge_print("observer yield count", t, &s->queries.observer_yield_count);
     ecs_trace("");
     flecs_gauge_print("table count", t, &s->tables.count);
     flecs_gauge_print("empty table count", t, &s->tables.empty_count);
     flecs_counter_print("table create count", t, &s->tables.create_count);
     flecs_counter_print("table delete count", t, &s->tables.delete_count);
+    flecs_gauge_print("table pool count", t, &s->tables.pool_count);
+    flecs_counter_print("table pool hit count", t, &s->tables.pool_hit_count);
+    flecs_counter_print("table gc delete count", t, &s->tables.gc_delete_count);
     ecs_trace("");
     flecs_counter_print("add commands", t, &s->commands.add_count);
     flecs_counter_print("remove commands", t, &s->commands.remove_count);
@@ -8,6 +8,15 @@
 
 #include "../../private_api.h"
 
+#define ECS_METRIC_FIRST(stats)\
+    ECS_CAST(ecs_metric_t*, ECS_OFFSET(&stats->first_, ECS_SIZEOF(int64_t)))
+
+#define ECS_METRIC_LAST(stats)\
+    ECS_CAST(ecs_metric_t*, ECS_OFFSET(&stats->last_, -ECS_SIZEOF(ecs_metric_t)))
+
+/* Default number of samples stored by compact statistics */
+#define FLECS_STATS_COMPACT_WINDOW (60)
+
 typedef struct {
     /* Statistics API interface */
     void (*copy_last)(void *stats, void *src);
@@ -18,6 +27,9 @@ typedef struct {
     void (*set_t)(void *stats, int32_t t);
     void (*fini)(void *stats);
 
+    /* Get pointers to metrics stored by compact statistics (optional) */
+    void (*metrics)(void *stats, ecs_metric_t **out);
+
     /* Size of statistics type */
     ecs_size_t stats_size;
 
@@ -26,12 +38,24 @@ typedef struct {
 
     /* Id of component used to query for monitored resources (optional) */
     ecs_id_t query_component_id;
+
+    /* Number of metrics returned by metrics callback */
+    int32_t metric_count;
 } ecs_stats_api_t;
 
 void flecs_stats_api_import(
     ecs_world_t *world,
     ecs_stats_api_t *api);
 
+/* Add time spent collecting statistics to world summary */
+void flecs_stats_overhead_add(
+    ecs_world_t *world,
+    ecs_time_t *start);
+
+/* Get memory used by statistics */
+int64_t flecs_stats_memory(
+    ecs_world_t *world);
+
 void FlecsWorldSummaryImport(
     ecs_world_t *world);
 
@@ -92,6 +92,24 @@ void flecs_system_stats_repeat_last(
     ecs_system_stats_repeat_last(stats);
 }
 
+static
+void flecs_system_stats_metrics(
+    void *stats,
+    ecs_metric_t **out)
+{
+    ecs_system_stats_t *s = stats;
+    ecs_metric_t *cur = ECS_METRIC_FIRST(s), *last = ECS_METRIC_LAST(s);
+    for (; cur <= last; cur ++) {
+        *(out ++) = cur;
+    }
+
+    cur = ECS_METRIC_FIRST((&s->query));
+    last = ECS_METRIC_LAST((&s->query));
+    for (; cur <= last; cur ++) {
+        *(out ++) = cur;
+    }
+}
+
 void FlecsSystemMonitorImport(
     ecs_world_t *world)
 {
@@ -111,9 +129,12 @@ void FlecsSystemMonitorImport(
         .reduce_last = flecs_system_stats_reduce_last,
         .repeat_last = flecs_system_stats_repeat_last,
         .set_t = flecs_system_stats_set_t,
+        .metrics = flecs_system_stats_metrics,
         .stats_size = ECS_SIZEOF(ecs_system_stats_t),
         .monitor_component_id = ecs_id(EcsSystemStats),
-        .query_component_id = EcsSystem
+        .query_component_id = EcsSystem,
+        .metric_count = ECS_STATS_METRIC_INDEX(ecs_system_stats_t, last_) +
+            ECS_STATS_METRIC_INDEX(ecs_query_stats_t, last_)
     };
 
     flecs_stats_api_import(world, &api);
@@ -59,6 +59,18 @@ void flecs_world_stats_repeat_last(
     ecs_world_stats_repeat_last(stats);
 }
 
+static
+void flecs_world_stats_metrics(
+    void *stats,
+    ecs_metric_t **out)
+{
+    ecs_world_stats_t *s = stats;
+    ecs_metric_t *cur = ECS_METRIC_FIRST(s), *last = ECS_METRIC_LAST(s);
+    for (; cur <= last; cur ++) {
+        *(out ++) = cur;
+    }
+}
+
 void FlecsWorldMonitorImport(
     ecs_world_t *world) 
 {
@@ -76,8 +88,10 @@ void FlecsWorldMonitorImport(
         .repeat_last = flecs_world_stats_repeat_last,
         .set_t = flecs_world_stats_set_t,
         .fini = NULL,
+        .metrics = flecs_world_stats_metrics,
         .stats_size = ECS_SIZEOF(ecs_world_stats_t),
-        .monitor_component_id = ecs_id(EcsWorldStats)
+        .monitor_component_id = ecs_id(EcsWorldStats),
+        .metric_count = ECS_STATS_METRIC_INDEX(ecs_world_stats_t, last_)
     };
 
     flecs_stats_api_import(world, &api);
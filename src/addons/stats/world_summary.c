@@ -41,6 +41,17 @@ void flecs_copy_world_summary(
         info->cmd.event_count +
         info->cmd.other_count;
 
+    dst->component_record_count = info->tag_id_count + info->component_id_count;
+    dst->pair_record_count = info->pair_id_count;
+    dst->component_record_memory = info->component_record_memory;
+    if (dst->component_record_count) {
+        dst->component_record_memory_avg = 
+            (double)dst->component_record_memory / 
+            (double)dst->component_record_count;
+    } else {
+        dst->component_record_memory_avg = 0;
+    }
+
     dst->build_info = *ecs_get_build_info();
 }
 
@@ -51,6 +62,11 @@ void UpdateWorldSummary(ecs_iter_t *it) {
     int32_t i, count = it->count;
     for (i = 0; i < count; i ++) {
         flecs_copy_world_summary(it->world, &summary[i]);
+
+        /* Runs before the monitor systems, which add the time they spend
+         * collecting statistics in this frame. */
+        summary[i].stats_time_last = 0;
+        summary[i].stats_memory = flecs_stats_memory(it->real_world);
     }
 }
 
@@ -85,6 +101,13 @@ void FlecsWorldSummaryImport(
             { .name = "merge_time_last", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds  },
             { .name = "frame_count", .type = ecs_id(ecs_u64_t) },
             { .name = "command_count", .type = ecs_id(ecs_u64_t) },
+            { .name = "stats_time_total", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds },
+            { .name = "stats_time_last", .type = ecs_id(ecs_f64_t), .unit = EcsSeconds },
+            { .name = "stats_memory", .type = ecs_id(ecs_i64_t), .unit = EcsBytes },
+            { .name = "component_record_count", .type = ecs_id(ecs_i32_t) },
+            { .name = "pair_record_count", .type = ecs_id(ecs_i32_t) },
+            { .name = "component_record_memory", .type = ecs_id(ecs_i64_t), .unit = EcsBytes },
+            { .name = "component_record_memory_avg", .type = ecs_id(ecs_f64_t), .unit = EcsBytes },
             { .name = "build_info", .type = build_info }
         }
     });
@@ -215,6 +215,9 @@ void flecs_register_id_flag_for_relation(
         }
 
         if (changed) {
+            if (prop == EcsOnInstantiate) {
+                world->instantiate_plan_generation ++;
+            }
             flecs_assert_relation_unused(world, e, prop);
         }
     }
@@ -901,6 +904,7 @@ void flecs_bootstrap(
     flecs_bootstrap_trait(world, EcsWith);
     flecs_bootstrap_trait(world, EcsOneOf);
     flecs_bootstrap_trait(world, EcsCanToggle);
+    flecs_bootstrap_trait(world, EcsDirtyRows);
     flecs_bootstrap_trait(world, EcsTrait);
     flecs_bootstrap_trait(world, EcsRelationship);
     flecs_bootstrap_trait(world, EcsTarget);
@@ -1032,6 +1036,15 @@ void flecs_bootstrap(
         .ctx = &toggle_trait
     });
 
+    static ecs_on_trait_ctx_t dirty_rows_trait = { EcsIdDirtyRows, 0 };
+    ecs_observer(world, {
+        .query.terms = {{ .id = EcsDirtyRows }},
+        .query.flags = EcsQueryMatchPrefab|EcsQueryMatchDisabled,
+        .events = {EcsOnAdd},
+        .callback = flecs_register_trait,
+        .ctx = &dirty_rows_trait
+    });
+
     static ecs_on_trait_ctx_t with_trait = { EcsIdWith, 0 };
     ecs_observer(world, {
         .query.terms = {
@@ -959,7 +959,7 @@ void flecs_cmd_batch_for_entity(
              * Since those tables are new, we don't have to invoke component 
              * monitors since queries will have correctly matched them. */
             ecs_assert(r->cr != NULL, ECS_INTERNAL_ERROR, NULL);
-            if (ecs_map_count(&r->cr->cache.index)) {
+            if (flecs_table_cache_count(&r->cr->cache)) {
                 flecs_update_component_monitors(world, &added, NULL);
             }
         }
@@ -976,6 +976,38 @@ void flecs_cmd_batch_for_entity(
     flecs_table_diff_builder_clear(diff);
 }
 
+/* Prepare a command for flushing. If this is the first command for an entity,
+ * batch the commands for the entity to limit archetype moves. */
+static
+void flecs_cmd_flush_prepare(
+    ecs_world_t *world,
+    ecs_table_diff_builder_t *diff,
+    ecs_cmd_t *cmds,
+    int32_t i,
+    bool is_alive,
+    bool merge_to_world)
+{
+    ecs_cmd_t *cmd = &cmds[i];
+
+    /* A negative index indicates the first command for an entity */
+    if (merge_to_world && (cmd->next_for_entity < 0)) {
+        diff->added_flags = 0;
+        diff->removed_flags = 0;
+
+        /* Batch commands for entity to limit archetype moves */
+        if (is_alive) {
+            flecs_cmd_batch_for_entity(world, diff, cmd->entity, cmds, i);
+        } else {
+            world->info.cmd.discard_count ++;
+        }
+    }
+
+    /* Invalidate entry */
+    if (cmd->entry) {
+        cmd->entry->first = -1;
+    }
+}
+
 /* Leave safe section. Run all deferred commands. */
 bool flecs_defer_end(
     ecs_world_t *world,
@@ -1038,23 +1070,8 @@ bool flecs_defer_end(
                 ecs_entity_t e = cmd->entity;
                 bool is_alive = flecs_entities_is_alive(world, e);
 
-                /* A negative index indicates the first command for an entity */
-                if (merge_to_world && (cmd->next_for_entity < 0)) {
-                    diff.added_flags = 0;
-                    diff.removed_flags = 0;
-
-                    /* Batch commands for entity to limit archetype moves */
-                    if (is_alive) {
-                        flecs_cmd_batch_for_entity(world, &diff, e, cmds, i);
-                    } else {
-                        world->info.cmd.discard_count ++;
-                    }
-                }
-
-                /* Invalidate entry */
-                if (cmd->entry) {
-                    cmd->entry->first = -1;
-                }
+                flecs_cmd_flush_prepare(
+                    world, &diff, cmds, i, is_alive, merge_to_world);
 
                 /* If entity is no longer alive, this could be because the queue
                  * contained both a delete and a subsequent add/remove/set which
@@ -1133,8 +1150,47 @@ bool flecs_defer_end(
                     world->info.cmd.set_count ++;
                     break;
                 case EcsCmdDelete: {
-                    ecs_delete(world, e);
-                    world->info.cmd.delete_count ++;
+                    /* Delete consecutive delete commands in a single batch, so
+                     * that rows are removed per table */
+                    int32_t last = i + 1;
+                    while (last < count && cmds[last].kind == EcsCmdDelete) {
+                        last ++;
+                    }
+
+                    if (last - i == 1) {
+                        ecs_delete(world, e);
+                        world->info.cmd.delete_count ++;
+                        break;
+                    }
+
+                    ecs_allocator_t *a = &world->allocator;
+                    ecs_vec_t batch;
+                    ecs_vec_init_t(a, &batch, ecs_entity_t, last - i);
+                    int32_t first = i;
+                    for (; i < last; i ++) {
+                        ecs_entity_t de = cmds[i].entity;
+                        bool de_alive = flecs_entities_is_alive(world, de);
+                        if (i != first) {
+                            /* Commands consumed by the batch must still
+                             * invalidate their entry and flush the other 
+                             * commands for their entity. */
+                            flecs_cmd_flush_prepare(
+                                world, &diff, cmds, i, de_alive, merge_to_world);
+                            de_alive = flecs_entities_is_alive(world, de);
+                        }
+
+                        if (de_alive) {
+                            ecs_vec_append_t(a, &batch, ecs_entity_t)[0] = de;
+                        } else {
+                            world->info.cmd.discard_count ++;
+                        }
+                    }
+                    i --;
+
+                    int32_t batch_count = ecs_vec_count(&batch);
+                    ecs_delete_many(world, batch_count, ecs_vec_first(&batch));
+                    world->info.cmd.delete_count += batch_count;
+                    ecs_vec_fini_t(a, &batch, ecs_entity_t);
                     break;
                 }
                 case EcsCmdClear:
@@ -1315,3 +1371,362 @@ void ecs_defer_resume(
 error:
     return;
 }
+
+static
+int32_t flecs_async_load(
+    const int32_t *ptr)
+{
+    return *(const volatile int32_t*)ptr;
+}
+
+static
+int32_t flecs_async_lap_seq(
+    uint32_t pos)
+{
+    return (int32_t)((pos / FLECS_ASYNC_QUEUE_SIZE) * 2);
+}
+
+void flecs_async_queue_init(
+    ecs_async_queue_t *queue)
+{
+    ecs_assert(!(FLECS_ASYNC_QUEUE_SIZE & (FLECS_ASYNC_QUEUE_SIZE - 1)),
+        ECS_INVALID_PARAMETER, "FLECS_ASYNC_QUEUE_SIZE must be a power of 2");
+    queue->slots = ecs_os_calloc_n(ecs_async_cmd_t, FLECS_ASYNC_QUEUE_SIZE);
+    queue->tail = 0;
+    queue->head = 0;
+    queue->count = 0;
+    queue->fence = 0;
+    ecs_vec_init_t(NULL, &queue->overflow, ecs_async_cmd_t, 0);
+    queue->overflow_count = 0;
+    queue->lock = 0;
+    if (ecs_os_has_threading()) {
+        queue->lock = ecs_os_mutex_new();
+    }
+}
+
+static
+void flecs_async_overflow_fini(
+    ecs_vec_t *overflow)
+{
+    int32_t i, count = ecs_vec_count(overflow);
+    ecs_async_cmd_t *cmds = ecs_vec_first(overflow);
+    for (i = 0; i < count; i ++) {
+        ecs_os_free(cmds[i].value);
+    }
+    ecs_vec_fini_t(NULL, overflow, ecs_async_cmd_t);
+}
+
+void flecs_async_queue_fini(
+    ecs_async_queue_t *queue)
+{
+    int32_t i;
+    for (i = 0; i < FLECS_ASYNC_QUEUE_SIZE; i ++) {
+        ecs_os_free(queue->slots[i].value);
+    }
+    ecs_os_free(queue->slots);
+    queue->slots = NULL;
+
+    flecs_async_overflow_fini(&queue->overflow);
+    if (queue->lock) {
+        ecs_os_mutex_free(queue->lock);
+        queue->lock = 0;
+    }
+}
+
+static
+void flecs_async_cmd_write(
+    ecs_async_cmd_t *cmd,
+    ecs_cmd_kind_t kind,
+    ecs_entity_t entity,
+    ecs_id_t id,
+    ecs_size_t size,
+    const void *value)
+{
+    if (cmd->capacity < size) {
+        cmd->value = ecs_os_realloc(cmd->value, size);
+        cmd->capacity = size;
+    }
+
+    cmd->kind = kind;
+    cmd->entity = entity;
+    cmd->id = id;
+    cmd->size = size;
+    if (size) {
+        ecs_os_memcpy(cmd->value, value, size);
+    }
+}
+
+/* Try to enqueue command in the ring buffer. Returns false if the ring buffer
+ * is full, or if there are commands in the overflow queue. In the latter case
+ * the command must also go to the overflow queue, so that commands from the
+ * same thread are drained in the order in which they were enqueued. */
+static
+bool flecs_async_ring_push(
+    ecs_async_queue_t *queue,
+    ecs_cmd_kind_t kind,
+    ecs_entity_t entity,
+    ecs_id_t id,
+    ecs_size_t size,
+    const void *value)
+{
+    if (flecs_async_load(&queue->overflow_count)) {
+        return false;
+    }
+
+    /* Reserve a slot. Slots are only released after they are drained, so if
+     * no more than FLECS_ASYNC_QUEUE_SIZE slots are reserved, the slot that 
+     * is claimed next is guaranteed to no longer be used by the previous lap. */
+    if (ecs_os_ainc(&queue->count) > FLECS_ASYNC_QUEUE_SIZE) {
+        ecs_os_adec(&queue->count);
+        return false;
+    }
+
+    uint32_t pos = (uint32_t)(ecs_os_ainc(&queue->tail) - 1);
+    ecs_async_cmd_t *cmd = &queue->slots[pos & (FLECS_ASYNC_QUEUE_SIZE - 1)];
+    ecs_assert(flecs_async_load(&cmd->seq) == flecs_async_lap_seq(pos),
+        ECS_INTERNAL_ERROR, NULL);
+
+    flecs_async_cmd_write(cmd, kind, entity, id, size, value);
+
+    /* Publish command. The atomic increment also acts as a full memory barrier,
+     * so command data is visible to the consumer when it observes seq. */
+    ecs_os_ainc(&cmd->seq);
+    return true;
+}
+
+static
+void flecs_async_cmd(
+    ecs_world_t *world,
+    ecs_cmd_kind_t kind,
+    ecs_entity_t entity,
+    ecs_id_t id,
+    ecs_size_t size,
+    const void *value)
+{
+    ecs_async_queue_t *queue = &world->async_queue;
+    if (flecs_async_ring_push(queue, kind, entity, id, size, value)) {
+        return;
+    }
+
+    /* Ring buffer is full, grow the overflow queue */
+    if (queue->lock) {
+        ecs_os_mutex_lock(queue->lock);
+    }
+
+    ecs_async_cmd_t *cmd = ecs_vec_append_t(
+        NULL, &queue->overflow, ecs_async_cmd_t);
+    ecs_os_zeromem(cmd);
+    flecs_async_cmd_write(cmd, kind, entity, id, size, value);
+    ecs_os_ainc(&queue->overflow_count);
+
+    if (queue->lock) {
+        ecs_os_mutex_unlock(queue->lock);
+    }
+}
+
+static
+void flecs_async_cmd_flush(
+    ecs_world_t *world,
+    ecs_world_t *stage,
+    ecs_async_cmd_t *cmd)
+{
+    ecs_entity_t e = cmd->entity;
+
+    switch(cmd->kind) {
+    case EcsCmdAdd:
+        if (ecs_is_alive(world, e)) {
+            ecs_add_id(stage, e, cmd->id);
+        }
+        break;
+    case EcsCmdRemove:
+        if (ecs_is_alive(world, e)) {
+            ecs_remove_id(stage, e, cmd->id);
+        }
+        break;
+    case EcsCmdSet:
+        if (ecs_is_alive(world, e)) {
+            ecs_set_id(stage, e, cmd->id, 
+                flecs_ito(size_t, cmd->size), cmd->value);
+        }
+        break;
+    case EcsCmdDelete:
+        ecs_delete(stage, e);
+        break;
+    case EcsCmdEvent: {
+        ecs_type_t ids = {
+            .array = cmd->value,
+            .count = cmd->size / ECS_SIZEOF(ecs_id_t)
+        };
+        ecs_enqueue(stage, &(ecs_event_desc_t){
+            .event = cmd->id,
+            .ids = ids.count ? &ids : NULL,
+            .entity = e
+        });
+        break;
+    }
+    case EcsCmdNew:
+    case EcsCmdClone:
+    case EcsCmdBulkNew:
+    case EcsCmdEmplace:
+    case EcsCmdEnsure:
+    case EcsCmdModified:
+    case EcsCmdModifiedNoHook:
+    case EcsCmdAddModified:
+    case EcsCmdPath:
+    case EcsCmdClear:
+    case EcsCmdOnDeleteAction:
+    case EcsCmdEnable:
+    case EcsCmdDisable:
+    case EcsCmdSkip:
+    default:
+        ecs_abort(ECS_INTERNAL_ERROR, NULL);
+    }
+}
+
+void flecs_async_queue_drain(
+    ecs_world_t *world)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_async_queue_t *queue = &world->async_queue;
+    ecs_stage_t *stage = world->stages[0];
+    bool deferred = false;
+
+    do {
+        uint32_t pos = (uint32_t)queue->head;
+        ecs_async_cmd_t *cmd = 
+            &queue->slots[pos & (FLECS_ASYNC_QUEUE_SIZE - 1)];
+        if (flecs_async_load(&cmd->seq) != (flecs_async_lap_seq(pos) + 1)) {
+            break;
+        }
+
+        /* Make sure command data isn't read before seq */
+        ecs_os_ainc(&queue->fence);
+
+        if (!deferred) {
+            flecs_defer_begin(world, stage);
+            deferred = true;
+        }
+
+        /* Commands are copied to the stage queue, so slot can be reused */
+        flecs_async_cmd_flush(world, (ecs_world_t*)stage, cmd);
+
+        ecs_os_ainc(&queue->fence);
+        cmd->seq = flecs_async_lap_seq(pos + FLECS_ASYNC_QUEUE_SIZE);
+        queue->head = (int32_t)(pos + 1);
+        ecs_os_adec(&queue->count);
+    } while (true);
+
+    /* Commands in the overflow queue were enqueued after the commands in the 
+     * ring buffer, so only drain them once the ring buffer is empty. */
+    if (flecs_async_load(&queue->overflow_count) && 
+        (queue->head == flecs_async_load(&queue->tail))) 
+    {
+        if (queue->lock) {
+            ecs_os_mutex_lock(queue->lock);
+        }
+
+        ecs_vec_t overflow = queue->overflow;
+        ecs_vec_init_t(NULL, &queue->overflow, ecs_async_cmd_t, 0);
+        queue->overflow_count = 0;
+
+        if (queue->lock) {
+            ecs_os_mutex_unlock(queue->lock);
+        }
+
+        if (!deferred) {
+            flecs_defer_begin(world, stage);
+            deferred = true;
+        }
+
+        int32_t i, count = ecs_vec_count(&overflow);
+        ecs_async_cmd_t *cmds = ecs_vec_first(&overflow);
+        for (i = 0; i < count; i ++) {
+            flecs_async_cmd_flush(world, (ecs_world_t*)stage, &cmds[i]);
+        }
+
+        flecs_async_overflow_fini(&overflow);
+    }
+
+    if (deferred) {
+        flecs_defer_end(world, stage);
+    }
+}
+
+void ecs_async_add_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(entity != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(id != 0, ECS_INVALID_PARAMETER, NULL);
+    world = ECS_CONST_CAST(ecs_world_t*, ecs_get_world(world));
+    flecs_async_cmd(world, EcsCmdAdd, entity, id, 0, NULL);
+error:
+    return;
+}
+
+void ecs_async_remove_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(entity != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(id != 0, ECS_INVALID_PARAMETER, NULL);
+    world = ECS_CONST_CAST(ecs_world_t*, ecs_get_world(world));
+    flecs_async_cmd(world, EcsCmdRemove, entity, id, 0, NULL);
+error:
+    return;
+}
+
+void ecs_async_set_id(
+    ecs_world_t *world,
+    ecs_entity_t entity,
+    ecs_id_t id,
+    size_t size,
+    const void *ptr)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(entity != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(id != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(size != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(ptr != NULL, ECS_INVALID_PARAMETER, NULL);
+    world = ECS_CONST_CAST(ecs_world_t*, ecs_get_world(world));
+    flecs_async_cmd(world, EcsCmdSet, entity, id, 
+        flecs_uto(ecs_size_t, size), ptr);
+error:
+    return;
+}
+
+void ecs_async_delete(
+    ecs_world_t *world,
+    ecs_entity_t entity)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(entity != 0, ECS_INVALID_PARAMETER, NULL);
+    world = ECS_CONST_CAST(ecs_world_t*, ecs_get_world(world));
+    flecs_async_cmd(world, EcsCmdDelete, entity, 0, 0, NULL);
+error:
+    return;
+}
+
+void ecs_async_enqueue(
+    ecs_world_t *world,
+    const ecs_event_desc_t *desc)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(desc != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(desc->event != 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(desc->entity != 0, ECS_INVALID_PARAMETER, 
+        "events enqueued with ecs_async_enqueue must have an entity");
+    ecs_check(!desc->param && !desc->const_param, ECS_INVALID_PARAMETER,
+        "events enqueued with ecs_async_enqueue cannot have a payload");
+    world = ECS_CONST_CAST(ecs_world_t*, ecs_get_world(world));
+
+    int32_t id_count = desc->ids ? desc->ids->count : 0;
+    flecs_async_cmd(world, EcsCmdEvent, desc->entity, desc->event, 
+        id_count * ECS_SIZEOF(ecs_id_t), id_count ? desc->ids->array : NULL);
+error:
+    return;
+}
@@ -62,6 +62,34 @@ typedef struct ecs_cmd_t {
     ecs_entity_t system;             /* System that enqueued the command */
 } ecs_cmd_t;
 
+/* Command in the thread safe command queue. The value storage of a slot is
+ * kept when the command is drained, so it can be reused by the next command
+ * that is enqueued in the slot. */
+typedef struct ecs_async_cmd_t {
+    int32_t seq;                     /* Even if slot is free, odd if written */
+    ecs_cmd_kind_t kind;             /* Command kind */
+    ecs_entity_t entity;             /* Entity id */
+    ecs_id_t id;                     /* (Component) id, or event */
+    void *value;                     /* Component value, or event ids */
+    ecs_size_t size;                 /* Size of value */
+    ecs_size_t capacity;             /* Size of value storage */
+} ecs_async_cmd_t;
+
+/* Lock free multi producer, single consumer command queue. Any thread can
+ * enqueue commands, which are drained by the thread that merges the world. 
+ * When the ring buffer is full, commands are appended to an overflow queue
+ * that is protected by a mutex, so producers never have to wait. */
+typedef struct ecs_async_queue_t {
+    ecs_async_cmd_t *slots;          /* Ring buffer with FLECS_ASYNC_QUEUE_SIZE slots */
+    int32_t tail;                    /* Next slot to claim by producers */
+    int32_t head;                    /* Next slot to drain by consumer */
+    int32_t count;                   /* Number of reserved ring buffer slots */
+    int32_t fence;                   /* Used for memory barriers */
+    ecs_vec_t overflow;              /* vector<ecs_async_cmd_t> */
+    int32_t overflow_count;          /* Number of commands in overflow queue */
+    ecs_os_mutex_t lock;             /* Protects overflow queue */
+} ecs_async_queue_t;
+
 /** Callback used to capture commands of a frame */
 typedef void (*ecs_on_commands_action_t)(
     const ecs_stage_t *stage,
@@ -78,6 +106,19 @@ void flecs_commands_fini(
     ecs_stage_t *stage,
     ecs_commands_t *cmd);
 
+/* Initialize thread safe command queue. */
+void flecs_async_queue_init(
+    ecs_async_queue_t *queue);
+
+/* Free thread safe command queue, discards commands that weren't drained. */
+void flecs_async_queue_fini(
+    ecs_async_queue_t *queue);
+
+/* Move commands from thread safe command queue to the queue of stage 0. Must be
+ * called from the thread that merges the world. */
+void flecs_async_queue_drain(
+    ecs_world_t *world);
+
 /* Begin deferring, or return whether already deferred. */
 bool flecs_defer_cmd(
     ecs_stage_t *stage);
@@ -259,8 +259,8 @@ void flecs_union_on_add(
                 const ecs_entity_t *entities = ecs_table_entities(table);
                 for (j = 0; j < count; j ++) {
                     ecs_entity_t e = entities[row + j];
-                    flecs_switch_set(
-                        cr->sparse, (uint32_t)e, ecs_pair_second(world, id));
+                    flecs_union_set(
+                        cr, table, e, ecs_pair_second(world, id));
                 }
             }
         }
@@ -285,7 +285,7 @@ void flecs_union_on_remove(
                 const ecs_entity_t *entities = ecs_table_entities(table);
                 for (j = 0; j < count; j ++) {
                     ecs_entity_t e = entities[row + j];
-                    flecs_switch_reset(cr->sparse, (uint32_t)e);
+                    flecs_union_set(cr, table, e, 0);
                 }
             }
         }
@@ -814,7 +814,7 @@ void flecs_copy_id(
         ecs_os_memcpy(dst_ptr, src_ptr, flecs_utosize(size));
     }
 
-    flecs_table_mark_dirty(world, r->table, id);
+    flecs_table_mark_dirty(world, r->table, id, ECS_RECORD_TO_ROW(r->row));
 
     ecs_table_t *table = r->table;
     ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
@@ -1555,6 +1555,67 @@ error:
     return;
 }
 
+static
+void flecs_delete_entity(
+    ecs_world_t *world,
+    ecs_stage_t *stage,
+    ecs_entity_t entity,
+    ecs_record_t *r)
+{
+    flecs_journal_begin(world, EcsJournalDelete, entity, NULL, NULL);
+
+    ecs_flags32_t row_flags = ECS_RECORD_TO_ROW_FLAGS(r->row);
+    ecs_table_t *table;
+    if (row_flags) {
+        if (world->query_plans.count && 
+            (row_flags & (EcsEntityIsId|EcsEntityIsTarget))) 
+        {
+            /* Evict cached queries that use the entity */
+            flecs_query_plan_cache_on_delete(world, entity);
+        }
+
+        if (row_flags & EcsEntityIsTarget) {
+            flecs_on_delete(world, ecs_pair(EcsFlag, entity), 0, true);
+            flecs_on_delete(world, ecs_pair(EcsWildcard, entity), 0, true);
+            r->cr = NULL;
+        }
+
+        if (row_flags & EcsEntityIsId) {
+            flecs_on_delete(world, entity, 0, true);
+            flecs_on_delete(world, ecs_pair(entity, EcsWildcard), 0, true);
+        }
+
+        if (row_flags & EcsEntityIsTraversable) {
+            flecs_table_traversable_add(r->table, -1);
+        }
+
+        /* Remove non-fragmenting components */
+        flecs_entity_remove_non_fragmenting(world, entity, r);
+
+        /* Merge operations before deleting entity */
+        flecs_defer_end(world, stage);
+        flecs_defer_begin(world, stage);
+    }
+
+    table = r->table;
+
+    if (table) { /* NULL if entity got cleaned up as result of cycle */
+        ecs_table_diff_t diff = {
+            .removed = table->type,
+            .removed_flags = table->flags & EcsTableRemoveEdgeFlags
+        };
+
+        int32_t row = ECS_RECORD_TO_ROW(r->row);
+        flecs_notify_on_remove(
+            world, table, &world->store.root, row, 1, &diff);
+        flecs_table_delete(world, table, row, true);
+    }
+    
+    flecs_entities_remove(world, entity);
+
+    flecs_journal_end();
+}
+
 void ecs_delete(
     ecs_world_t *world,
     ecs_entity_t entity)
@@ -1571,56 +1632,205 @@ void ecs_delete(
 
     ecs_record_t *r = flecs_entities_try(world, entity);
     if (r) {
-        flecs_journal_begin(world, EcsJournalDelete, entity, NULL, NULL);
-
-        ecs_flags32_t row_flags = ECS_RECORD_TO_ROW_FLAGS(r->row);
-        ecs_table_t *table;
-        if (row_flags) {
-            if (row_flags & EcsEntityIsTarget) {
-                flecs_on_delete(world, ecs_pair(EcsFlag, entity), 0, true);
-                flecs_on_delete(world, ecs_pair(EcsWildcard, entity), 0, true);
-                r->cr = NULL;
-            }
+        flecs_delete_entity(world, stage, entity, r);
+    }
 
-            if (row_flags & EcsEntityIsId) {
-                flecs_on_delete(world, entity, 0, true);
-                flecs_on_delete(world, ecs_pair(entity, EcsWildcard), 0, true);
-            }
+    flecs_defer_end(world, stage);
+error:
+    ecs_os_perf_trace_pop("flecs.delete");
+    return;
+}
+
+/* Rows of a single table that are deleted by ecs_delete_many() */
+typedef struct ecs_delete_table_t {
+    ecs_table_t *table;
+    uint64_t *rows;          /* Bitset with rows to delete */
+    int32_t words;           /* Size of bitset */
+    int32_t count;           /* Number of rows to delete */
+} ecs_delete_table_t;
 
-            if (row_flags & EcsEntityIsTraversable) {
-                flecs_table_traversable_add(r->table, -1);
+/* Mark rows of entities to delete in a bitset per table. Returns false if an
+ * entity must be deleted individually before the other entities. */
+static
+bool flecs_delete_many_collect(
+    ecs_world_t *world,
+    int32_t count,
+    const ecs_entity_t *entities,
+    ecs_vec_t *tables,
+    ecs_map_t *table_map)
+{
+    ecs_allocator_t *a = &world->allocator;
+    ecs_table_t *last_table = NULL;
+    int32_t i, last = -1;
+
+    for (i = 0; i < count; i ++) {
+        ecs_entity_t e = entities[i];
+        ecs_assert(e != 0, ECS_INVALID_PARAMETER, NULL);
+        ecs_record_t *r = flecs_entities_try(world, e);
+        if (!r) {
+            continue;
+        }
+
+        if (ECS_RECORD_TO_ROW_FLAGS(r->row)) {
+            return false;
+        }
+
+        ecs_table_t *table = r->table;
+        if (!table) { /* Entity got cleaned up as result of cycle */
+            flecs_entities_remove(world, e);
+            continue;
+        }
+
+        if (table != last_table) {
+            ecs_map_val_t *elem = ecs_map_ensure(table_map, table->id);
+            if (!elem[0]) {
+                ecs_delete_table_t *dt = ecs_vec_append_t(
+                    a, tables, ecs_delete_table_t);
+                dt->table = table;
+                dt->words = (ecs_table_count(table) + 63) / 64;
+                dt->rows = flecs_calloc_n(a, uint64_t, dt->words);
+                dt->count = 0;
+                elem[0] = flecs_ito(uint64_t, ecs_vec_count(tables));
             }
+            last = flecs_uto(int32_t, elem[0] - 1);
+            last_table = table;
+        }
 
-            /* Remove non-fragmenting components */
-            flecs_entity_remove_non_fragmenting(world, entity, r);
+        ecs_delete_table_t *dt = ecs_vec_get_t(tables, ecs_delete_table_t, last);
+        uint32_t row = flecs_ito(uint32_t, ECS_RECORD_TO_ROW(r->row));
+        uint64_t *word = &dt->rows[row >> 6];
+        uint64_t bit = 1llu << (row & 63);
+        if (!(word[0] & bit)) { /* Skip duplicate entities */
+            word[0] |= bit;
+            dt->count ++;
+        }
+    }
 
-            /* Merge operations before deleting entity */
-            flecs_defer_end(world, stage);
-            flecs_defer_begin(world, stage);
+    return true;
+}
+
+static
+void flecs_delete_many_clear(
+    ecs_world_t *world,
+    ecs_vec_t *tables,
+    ecs_map_t *table_map)
+{
+    ecs_allocator_t *a = &world->allocator;
+    int32_t i, count = ecs_vec_count(tables);
+    ecs_delete_table_t *dts = ecs_vec_first(tables);
+    for (i = 0; i < count; i ++) {
+        flecs_free_n(a, uint64_t, dts[i].words, dts[i].rows);
+    }
+    ecs_vec_clear(tables);
+    ecs_map_clear(table_map);
+}
+
+/* Delete rows of a single table. The rows are moved to the end of the table,
+ * after which OnRemove is emitted for the entire range, and the table is 
+ * truncated. */
+static
+void flecs_delete_table_rows(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    const int32_t *rows,
+    int32_t count)
+{
+    flecs_table_move_to_end(world, table, rows, count);
+
+    ecs_table_diff_t diff = {
+        .removed = table->type,
+        .removed_flags = table->flags & EcsTableRemoveEdgeFlags
+    };
+
+    int32_t row = ecs_table_count(table) - count;
+    flecs_notify_on_remove(
+        world, table, &world->store.root, row, count, &diff);
+    flecs_table_delete_last(world, table, count);
+}
+
+void ecs_delete_many(
+    ecs_world_t *world,
+    int32_t count,
+    const ecs_entity_t *entities)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(count >= 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!count || entities != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_stage_t *stage = flecs_stage_from_world(&world);
+    int32_t i;
+
+    if (flecs_defer_cmd(stage)) {
+        for (i = 0; i < count; i ++) {
+            ecs_check(entities[i] != 0, ECS_INVALID_PARAMETER, NULL);
+            flecs_defer_delete(stage, entities[i]);
         }
+        return;
+    }
 
-        table = r->table;
+    ecs_os_perf_trace_push("flecs.delete_many");
 
-        if (table) { /* NULL if entity got cleaned up as result of cycle */
-            ecs_table_diff_t diff = {
-                .removed = table->type,
-                .removed_flags = table->flags & EcsTableRemoveEdgeFlags
-            };
+    ecs_allocator_t *a = &world->allocator;
+    ecs_vec_t tables;
+    ecs_map_t table_map;
+    ecs_vec_init_t(a, &tables, ecs_delete_table_t, 0);
+    ecs_map_init(&table_map, a);
 
-            int32_t row = ECS_RECORD_TO_ROW(r->row);
-            flecs_notify_on_remove(
-                world, table, &world->store.root, row, 1, &diff);
-            flecs_table_delete(world, table, row, true);
+    if (!flecs_delete_many_collect(
+        world, count, entities, &tables, &table_map)) 
+    {
+        /* Entities that are used in ids or are observed can cause other 
+         * entities to be deleted, or to move to a different row. Delete them
+         * first, one at a time, and then collect the remaining entities. */
+        for (i = 0; i < count; i ++) {
+            ecs_entity_t e = entities[i];
+            ecs_record_t *r = flecs_entities_try(world, e);
+            if (r && ECS_RECORD_TO_ROW_FLAGS(r->row)) {
+                flecs_delete_entity(world, stage, e, r);
+            }
         }
-        
-        flecs_entities_remove(world, entity);
 
-        flecs_journal_end();
+        flecs_delete_many_clear(world, &tables, &table_map);
+        bool collected = flecs_delete_many_collect(
+            world, count, entities, &tables, &table_map);
+        ecs_assert(collected, ECS_INTERNAL_ERROR, NULL);
+        (void)collected;
+    }
+
+    /* Reuse storage for the row numbers of each table */
+    ecs_vec_t rows;
+    ecs_vec_init_t(a, &rows, int32_t, 0);
+
+    int32_t t, table_count = ecs_vec_count(&tables);
+    ecs_delete_table_t *dts = ecs_vec_first(&tables);
+    for (t = 0; t < table_count; t ++) {
+        ecs_delete_table_t *dt = &dts[t];
+        int32_t w, words = dt->words;
+
+        ecs_vec_set_count_t(a, &rows, int32_t, dt->count);
+        int32_t *row_array = ecs_vec_first(&rows), row_count = 0;
+        for (w = 0; w < words; w ++) {
+            uint64_t word = dt->rows[w];
+            int32_t b;
+            for (b = 0; word; b ++, word >>= 1) {
+                if (word & 1) {
+                    row_array[row_count ++] = (w << 6) + b;
+                }
+            }
+        }
+
+        ecs_assert(row_count == dt->count, ECS_INTERNAL_ERROR, NULL);
+        flecs_delete_table_rows(world, dt->table, row_array, row_count);
     }
 
+    ecs_vec_fini_t(a, &rows, int32_t);
+    flecs_delete_many_clear(world, &tables, &table_map);
+    ecs_vec_fini_t(a, &tables, ecs_delete_table_t);
+    ecs_map_fini(&table_map);
+
     flecs_defer_end(world, stage);
+    ecs_os_perf_trace_pop("flecs.delete_many");
 error:
-    ecs_os_perf_trace_pop("flecs.delete");
     return;
 }
 
@@ -1825,6 +2035,96 @@ error:
     return NULL;
 }
 
+/* Number of entities to look ahead when prefetching records */
+#define FLECS_GET_MANY_PREFETCH (16)
+
+/* Number of records resolved before looking up component pointers */
+#define FLECS_GET_MANY_CHUNK (256)
+
+void ecs_get_many_id(
+    const ecs_world_t *world,
+    int32_t count,
+    const ecs_entity_t *entities,
+    ecs_id_t id,
+    const void **out)
+{
+    ecs_check(world != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(count >= 0, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!count || entities != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!count || out != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    world = ecs_get_world(world);
+
+    int32_t i;
+    ecs_component_record_t *cr = flecs_components_get(world, id);
+    if (!cr || (cr->flags & (EcsIdIsSparse|EcsIdDontFragment))) {
+        /* Component isn't stored in table columns */
+        for (i = 0; i < count; i ++) {
+            out[i] = ecs_get_id(world, entities[i], id);
+        }
+        return;
+    }
+
+    ecs_table_t *last_table = NULL;
+    const void *column = NULL, *shared = NULL;
+    ecs_size_t size = 0;
+
+    int32_t chunk;
+    for (chunk = 0; chunk < count; chunk += FLECS_GET_MANY_CHUNK) {
+        int32_t end = ECS_MIN(chunk + FLECS_GET_MANY_CHUNK, count);
+
+        /* Resolve records first, while prefetching the records of entities
+         * that are looked up next. This hides most of the latency of the 
+         * entity index for entities that are not in the cache. The output 
+         * array is used as temporary storage for the records. */
+        for (i = chunk; i < end; i ++) {
+            if ((i + FLECS_GET_MANY_PREFETCH) < count) {
+                flecs_entities_prefetch(world, 
+                    entities[i + FLECS_GET_MANY_PREFETCH]);
+            }
+
+            ecs_check(ecs_is_alive(world, entities[i]), 
+                ECS_INVALID_PARAMETER, NULL);
+            ecs_record_t *r = flecs_entities_get(world, entities[i]);
+            flecs_prefetch(r->table);
+            out[i] = r;
+        }
+
+        /* Resolve component pointers. Entities in a batch often share a 
+         * table, so only look up the column when the table changes. */
+        for (i = chunk; i < end; i ++) {
+            const ecs_record_t *r = out[i];
+            ecs_table_t *table = r->table;
+            ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
+
+            if (table != last_table) {
+                const ecs_table_record_t *tr = flecs_component_get_table(
+                    cr, table);
+                column = shared = NULL;
+                if (tr) {
+                    ecs_check(tr->column != -1, ECS_NOT_A_COMPONENT, NULL);
+                    ecs_column_t *c = &table->data.columns[tr->column];
+                    column = c->data;
+                    size = c->ti->size;
+                } else {
+                    /* Same base component for all entities in table */
+                    shared = flecs_get_base_component(
+                        world, table, id, cr, 0);
+                }
+                last_table = table;
+            }
+
+            if (column) {
+                out[i] = ECS_ELEM(column, size, ECS_RECORD_TO_ROW(r->row));
+            } else {
+                out[i] = shared;
+            }
+        }
+    }
+error:
+    return;
+}
+
 void* ecs_get_mut_id(
     const ecs_world_t *world,
     ecs_entity_t entity,
@@ -2113,7 +2413,7 @@ void flecs_modified_id_if(
     flecs_notify_on_set(
         world, table, ECS_RECORD_TO_ROW(r->row), id, invoke_hook);
 
-    flecs_table_mark_dirty(world, table, id);
+    flecs_table_mark_dirty(world, table, id, ECS_RECORD_TO_ROW(r->row));
     flecs_defer_end(world, stage);
 error:
     return;
@@ -2144,7 +2444,7 @@ void ecs_modified_id(
     ecs_table_t *table = r->table;
     flecs_notify_on_set(world, table, ECS_RECORD_TO_ROW(r->row), id, true);
 
-    flecs_table_mark_dirty(world, table, id);
+    flecs_table_mark_dirty(world, table, id, ECS_RECORD_TO_ROW(r->row));
     flecs_defer_end(world, stage);
 error:
     return;
@@ -2207,7 +2507,7 @@ void flecs_set_id_move(
         ecs_os_memcpy(dst.ptr, ptr, flecs_utosize(size));
     }
 
-    flecs_table_mark_dirty(world, r->table, id);
+    flecs_table_mark_dirty(world, r->table, id, ECS_RECORD_TO_ROW(r->row));
 
     if (cmd_kind == EcsCmdSet) {
         ecs_table_t *table = r->table;
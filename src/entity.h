@@ -129,6 +129,10 @@ void flecs_on_delete(
     ecs_entity_t action,
     bool delete_id);
 
+/* Free entities queued by ecs_delete_incremental() without deleting them */
+void flecs_delete_queue_fini(
+    ecs_world_t *world);
+
 /* Remove non-fragmenting components from entity */
 void flecs_entity_remove_non_fragmenting(
     ecs_world_t *world,
@@ -303,6 +303,168 @@ ecs_entity_t flecs_get_parent_from_path(
     return parent;
 }
 
+/* Path cache */
+
+static
+void flecs_path_cache_invalidate(
+    ecs_world_t *world,
+    ecs_entity_t e)
+{
+    ecs_path_cache_t *cache = &world->path_cache;
+    ecs_path_cache_elem_t *elem = ecs_map_get_deref(
+        &cache->paths, ecs_path_cache_elem_t, e);
+    if (!elem) {
+        /* If an entity isn't cached, its children aren't cached either */
+        return;
+    }
+
+    flecs_name_index_remove(&cache->lookup, e, elem->hash);
+    ecs_os_free(elem->path);
+    ecs_map_remove_free(&cache->paths, e);
+
+    /* Paths of children contain the path of the entity */
+    ecs_component_record_t *cr = flecs_components_get(world, ecs_childof(e));
+    if (!cr) {
+        return;
+    }
+
+    ecs_table_cache_iter_t it;
+    if (flecs_table_cache_iter(&cr->cache, &it)) {
+        const ecs_table_record_t *tr;
+        while ((tr = flecs_table_cache_next(&it, ecs_table_record_t))) {
+            ecs_table_t *table = tr->hdr.table;
+            if (!(table->flags & EcsTableHasName)) {
+                continue;
+            }
+
+            const ecs_entity_t *entities = ecs_table_entities(table);
+            int32_t i, count = ecs_table_count(table);
+            for (i = 0; i < count; i ++) {
+                flecs_path_cache_invalidate(world, entities[i]);
+            }
+        }
+    }
+}
+
+static
+void flecs_path_cache_invalidate_table(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t offset,
+    int32_t count)
+{
+    if (!(world->flags & EcsWorldPathCache)) {
+        return;
+    }
+
+    const ecs_entity_t *entities = ecs_table_entities(table);
+    int32_t i;
+    for (i = offset; i < (offset + count); i ++) {
+        flecs_path_cache_invalidate(world, entities[i]);
+    }
+}
+
+/* Get cached path for entity. If the path isn't cached yet, add it and the
+ * paths of the parents of the entity to the cache. */
+static
+ecs_path_cache_elem_t* flecs_path_cache_ensure(
+    ecs_world_t *world,
+    ecs_entity_t e)
+{
+    ecs_path_cache_t *cache = &world->path_cache;
+    ecs_path_cache_elem_t *elem = ecs_map_get_deref(
+        &cache->paths, ecs_path_cache_elem_t, e);
+    if (elem) {
+        return elem;
+    }
+
+    if (world->flags & EcsWorldMultiThreaded) {
+        return NULL;
+    }
+
+    ecs_record_t *r = flecs_entities_get(world, e);
+    if (!r || !r->table || !(r->table->flags & EcsTableHasName)) {
+        return NULL;
+    }
+
+    const EcsIdentifier *name = ecs_get_pair(
+        world, e, EcsIdentifier, EcsName);
+    if (!name || !name->value) {
+        return NULL;
+    }
+
+    ecs_path_cache_elem_t *parent_elem = NULL;
+    ecs_entity_t parent = ecs_get_target(world, e, EcsChildOf, 0);
+    if (parent) {
+        /* Paths of entities in flecs.core don't start from the root */
+        if (parent == EcsFlecsCore) {
+            return NULL;
+        }
+
+        parent_elem = flecs_path_cache_ensure(world, parent);
+        if (!parent_elem) {
+            return NULL;
+        }
+    }
+
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    if (parent_elem) {
+        ecs_strbuf_appendstrn(&buf, parent_elem->path, parent_elem->length);
+        ecs_strbuf_appendch(&buf, '.');
+    }
+
+    if (strchr(name->value, '.')) {
+        const char *ptr;
+        for (ptr = name->value; ptr[0]; ptr ++) {
+            if (ptr[0] == '.') {
+                ecs_strbuf_appendch(&buf, '\\');
+            }
+            ecs_strbuf_appendch(&buf, ptr[0]);
+        }
+    } else {
+        ecs_strbuf_appendstrn(&buf, name->value, name->length);
+    }
+
+    ecs_size_t length = ecs_strbuf_written(&buf);
+    char *path = ecs_strbuf_get(&buf);
+    uint64_t hash = flecs_hash(path, length);
+
+    ecs_entity_t existing = flecs_name_index_find(
+        &cache->lookup, path, length, hash);
+    if (existing) {
+        /* Entities can't have the same path, so existing entry is stale */
+        flecs_path_cache_invalidate(world, existing);
+    }
+
+    elem = ecs_map_insert_alloc_t(&cache->paths, ecs_path_cache_elem_t, e);
+    elem->path = path;
+    elem->length = length;
+    elem->hash = hash;
+    flecs_name_index_ensure(&cache->lookup, e, path, length, hash);
+
+    return elem;
+}
+
+void flecs_path_cache_fini(
+    ecs_world_t *world)
+{
+    if (!(world->flags & EcsWorldPathCache)) {
+        return;
+    }
+
+    ecs_path_cache_t *cache = &world->path_cache;
+    ecs_map_iter_t it = ecs_map_iter(&cache->paths);
+    while (ecs_map_next(&it)) {
+        ecs_path_cache_elem_t *elem = ecs_map_ptr(&it);
+        ecs_os_free(elem->path);
+        ecs_os_free(elem);
+    }
+
+    ecs_map_fini(&cache->paths);
+    flecs_name_index_fini(&cache->lookup);
+    world->flags &= ~EcsWorldPathCache;
+}
+
 static
 void flecs_on_set_symbol(
     ecs_iter_t *it) 
@@ -385,6 +547,10 @@ void ecs_on_set(EcsIdentifier)(
             cur->index = NULL;
         }
 
+        if ((kind == EcsName) && (world->flags & EcsWorldPathCache)) {
+            flecs_path_cache_invalidate(world, it->entities[i]);
+        }
+
         if (index) {
             uint64_t index_hash = cur->index_hash;
             ecs_entity_t e = it->entities[i];
@@ -460,6 +626,8 @@ void flecs_reparent_name_index(
         src = &world->store.root;
     }
 
+    flecs_path_cache_invalidate_table(world, dst, offset, count);
+
     ecs_pair_record_t *src_pair = src->_->childof_r;
     ecs_pair_record_t *dst_pair = dst->_->childof_r;
 
@@ -495,6 +663,8 @@ void flecs_unparent_name_index(
         return;
     }
 
+    flecs_path_cache_invalidate_table(world, src, offset, count);
+
     ecs_assert(src->_->childof_r != NULL, ECS_INTERNAL_ERROR, NULL);
     ecs_hashmap_t *src_index = src->_->childof_r->name_index;
 
@@ -540,6 +710,29 @@ void ecs_get_path_w_sep_buf(
         sep = ".";
     }
 
+    if ((world->flags & EcsWorldPathCache) && !parent && !prefix && 
+        sep[0] == '.' && !sep[1] && child && ecs_is_alive(world, child)) 
+    {
+        ecs_path_cache_elem_t *elem = flecs_path_cache_ensure(
+            ECS_CONST_CAST(ecs_world_t*, world), child);
+        if (elem) {
+            if (!escape) {
+                ecs_strbuf_appendstrn(buf, elem->path, elem->length);
+            } else {
+                const char *ptr;
+                for (ptr = elem->path; ptr[0]; ptr ++) {
+                    char esc[3];
+                    flecs_chresc(esc, ptr[0], '\"');
+                    ecs_strbuf_appendch(buf, esc[0]);
+                    if (esc[1]) {
+                        ecs_strbuf_appendch(buf, esc[1]);
+                    }
+                }
+            }
+            return;
+        }
+    }
+
     if (!child || parent != child) {
         flecs_path_append(world, parent, child, sep, prefix, buf, escape);
     } else {
@@ -692,6 +885,15 @@ ecs_entity_t ecs_lookup_path_w_sep(
         return ecs_lookup_child(world, parent, path);
     }
 
+    bool path_cache = (world->flags & EcsWorldPathCache) && 
+        sep[0] == '.' && !sep[1];
+    if (path_cache && !parent) {
+        e = flecs_name_index_find(&world->path_cache.lookup, path, 0, 0);
+        if (e) {
+            return e;
+        }
+    }
+
 retry:
     cur = parent;
     ptr = path;
@@ -727,11 +929,34 @@ tail:
         ecs_os_free(elem);
     }
 
+    if (cur && path_cache) {
+        /* Add path to cache, so the next lookup is a single hash lookup */
+        flecs_path_cache_ensure(ECS_CONST_CAST(ecs_world_t*, world), cur);
+    }
+
     return cur;
 error:
     return 0;
 }
 
+void ecs_enable_path_cache(
+    ecs_world_t *world,
+    bool enable)
+{
+    flecs_poly_assert(world, ecs_world_t);
+
+    if (!enable) {
+        flecs_path_cache_fini(world);
+        return;
+    }
+
+    if (!(world->flags & EcsWorldPathCache)) {
+        ecs_map_init(&world->path_cache.paths, &world->allocator);
+        flecs_name_index_init(&world->path_cache.lookup, &world->allocator);
+        world->flags |= EcsWorldPathCache;
+    }
+}
+
 ecs_entity_t ecs_set_scope(
     ecs_world_t *world,
     ecs_entity_t scope)
@@ -5,6 +5,24 @@
 
 #include "private_api.h"
 
+/* Cached path of named entity, created with the default separator. */
+typedef struct ecs_path_cache_elem_t {
+    char *path;
+    ecs_size_t length;
+    uint64_t hash;
+} ecs_path_cache_elem_t;
+
+/* Cache with paths of named entities, enabled with ecs_enable_path_cache(). If
+ * an entity is in the cache, its parents are also in the cache. */
+typedef struct ecs_path_cache_t {
+    ecs_map_t paths;                /* map<entity, ecs_path_cache_elem_t> */
+    ecs_hashmap_t lookup;           /* map<path, entity> */
+} ecs_path_cache_t;
+
+/* Free cached paths. */
+void flecs_path_cache_fini(
+    ecs_world_t *world);
+
 /* Called during bootstrap to register entity name logic with world. */
 void flecs_bootstrap_entity_name(
     ecs_world_t *world);
@@ -94,7 +94,7 @@ error:
 static
 int32_t flecs_child_type_insert(
     ecs_type_t *type,
-    void **component_data,
+    int16_t *columns,
     ecs_id_t id)
 {
     int32_t i, count = type->count;
@@ -116,11 +116,11 @@ int32_t flecs_child_type_insert(
     if (to_move) {
         ecs_os_memmove(&type->array[i + 1],
             &type->array[i], to_move * ECS_SIZEOF(ecs_id_t));
-        ecs_os_memmove(&component_data[i + 1],
-            &component_data[i], to_move * ECS_SIZEOF(void*));
+        ecs_os_memmove(&columns[i + 1],
+            &columns[i], to_move * ECS_SIZEOF(int16_t));
     }
 
-    component_data[i] = NULL;
+    columns[i] = -1;
     type->array[i] = id;
     type->count ++;
 
@@ -128,39 +128,23 @@ int32_t flecs_child_type_insert(
 }
 
 static
-void flecs_instantiate_children(
+void flecs_instantiate_plan_init(
     ecs_world_t *world,
     ecs_entity_t base,
-    ecs_entity_t instance,
     ecs_table_t *child_table,
-    const ecs_instantiate_ctx_t *ctx)
+    bool is_prefab,
+    ecs_instantiate_plan_t *plan)
 {
-    if (!ecs_table_count(child_table)) {
-        return;
-    }
-
-    ecs_type_t type = child_table->type;
-    ecs_data_t *child_data = &child_table->data;
+    ecs_id_t *ids = child_table->type.array;
+    int32_t i, type_count = child_table->type.count;
 
+    ecs_type_t type = { .array = ecs_os_alloca_n(ecs_id_t, type_count + 1) };
+    int16_t *columns = ecs_os_alloca_n(int16_t, type_count + 1);
     ecs_entity_t slot_of = 0;
-    ecs_entity_t *ids = type.array;
-    int32_t type_count = type.count;
-
-    ecs_record_t *r = flecs_entities_get(world, instance);
-    ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
-    ecs_table_t *table = r->table;
-    ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
-
-    /* Instantiate child table for each instance */
-
-    /* Create component array for creating the table */
-    ecs_table_diff_t diff = { .added = {0}};
-    diff.added.array = ecs_os_alloca_n(ecs_entity_t, type_count + 1);
-    void **component_data = ecs_os_alloca_n(void*, type_count + 1);
 
     /* Copy in component identifiers. Find the base index in the component
      * array, since we'll need this to replace the base with the instance id */
-    int j, i, childof_base_index = -1;
+    int32_t childof_base_index = -1;
     for (i = 0; i < type_count; i ++) {
         ecs_id_t id = ids[i];
 
@@ -181,7 +165,7 @@ void flecs_instantiate_children(
         /* If child is a slot, keep track of which parent to add it to, but
          * don't add slot relationship to child of instance. If this is a child
          * of a prefab, keep the SlotOf relationship intact. */
-        if (!(table->flags & EcsTableIsPrefab)) {
+        if (!is_prefab) {
             if (ECS_IS_PAIR(id) && ECS_PAIR_FIRST(id) == EcsSlotOf) {
                 ecs_assert(slot_of == 0, ECS_INTERNAL_ERROR, NULL);
                 slot_of = ecs_pair_second(world, id);
@@ -194,7 +178,7 @@ void flecs_instantiate_children(
          * created children point to the instance and not the prefab */ 
         if (ECS_HAS_RELATION(id, EcsChildOf) && 
            (ECS_PAIR_SECOND(id) == (uint32_t)base)) {
-            childof_base_index = diff.added.count;
+            childof_base_index = type.count;
         }
 
         /* If this is a pure override, make sure we have a concrete version of the
@@ -203,78 +187,109 @@ void flecs_instantiate_children(
          * that have already been added to the child table type. */
         if (ECS_HAS_ID_FLAG(id, AUTO_OVERRIDE)) {
             ecs_id_t concreteId = id & ~ECS_AUTO_OVERRIDE;
-            flecs_child_type_insert(&diff.added, component_data, concreteId);
+            flecs_child_type_insert(&type, columns, concreteId);
             continue;
         }
 
-        int32_t storage_index = ecs_table_type_to_column_index(child_table, i);
-        if (storage_index != -1) {
-            component_data[diff.added.count] = 
-                child_data->columns[storage_index].data;
-        } else {
-            component_data[diff.added.count] = NULL;
-        }
-
-        diff.added.array[diff.added.count] = id;
-        diff.added.count ++;
-        diff.added_flags |= flecs_id_flags_get(world, id);
+        columns[type.count] = flecs_ito(int16_t, 
+            ecs_table_type_to_column_index(child_table, i));
+        type.array[type.count] = id;
+        type.count ++;
     }
 
     /* Table must contain children of base */
     ecs_assert(childof_base_index != -1, ECS_INTERNAL_ERROR, NULL);
 
     /* If children are added to a prefab, make sure they are prefabs too */
-    if (table->flags & EcsTableIsPrefab) {
-        if (flecs_child_type_insert(
-            &diff.added, component_data, EcsPrefab) != -1) 
-        {
+    if (is_prefab) {
+        if (flecs_child_type_insert(&type, columns, EcsPrefab) != -1) {
             childof_base_index ++;
         }
     }
 
-    /* Instantiate the prefab child table for each new instance */
-    int32_t child_count = ecs_table_count(child_table);
-    ecs_entity_t *child_ids = flecs_walloc_n(world, ecs_entity_t, child_count);
-
-    ecs_table_t *i_table = NULL;
+    plan->type.array = flecs_walloc_n(world, ecs_id_t, type.count);
+    plan->type.count = type.count;
+    ecs_os_memcpy_n(plan->type.array, type.array, ecs_id_t, type.count);
+    plan->columns = flecs_walloc_n(world, int16_t, type.count);
+    ecs_os_memcpy_n(plan->columns, columns, int16_t, type.count);
+    plan->childof_index = childof_base_index;
+    plan->slot_of = slot_of;
+    plan->generation = world->instantiate_plan_generation;
+}
 
-    /* Replace ChildOf element in the component array with instance id */
-    diff.added.array[childof_base_index] = ecs_pair(EcsChildOf, instance);
+static
+void flecs_instantiate_plan_fini(
+    ecs_world_t *world,
+    ecs_instantiate_plan_t *plan)
+{
+    flecs_wfree_n(world, ecs_id_t, plan->type.count, plan->type.array);
+    flecs_wfree_n(world, int16_t, plan->type.count, plan->columns);
+    ecs_os_zeromem(plan);
+}
 
-    /* Find or create table */
-    i_table = flecs_table_find_or_create(world, &diff.added);
+void flecs_instantiate_plans_fini(
+    ecs_world_t *world,
+    ecs_table_t *table)
+{
+    ecs_instantiate_plan_t *plans = table->_->instantiate_plans;
+    if (plans) {
+        if (plans[0].type.array) {
+            flecs_instantiate_plan_fini(world, &plans[0]);
+        }
+        if (plans[1].type.array) {
+            flecs_instantiate_plan_fini(world, &plans[1]);
+        }
+        flecs_wfree_n(world, ecs_instantiate_plan_t, 2, plans);
+        table->_->instantiate_plans = NULL;
+    }
+}
 
-    ecs_assert(i_table != NULL, ECS_INTERNAL_ERROR, NULL);
-    ecs_assert(i_table->type.count == diff.added.count,
-        ECS_INTERNAL_ERROR, NULL);
+/* Get plan for instantiating the entities of a prefab child table. The plan
+ * only depends on the type of the child table, whether the instance is a
+ * prefab and on the OnInstantiate traits of the components in the type. */
+static
+const ecs_instantiate_plan_t* flecs_instantiate_plan_get(
+    ecs_world_t *world,
+    ecs_entity_t base,
+    ecs_table_t *child_table,
+    bool is_prefab)
+{
+    ecs_instantiate_plan_t *plans = child_table->_->instantiate_plans;
+    if (!plans) {
+        plans = child_table->_->instantiate_plans = 
+            flecs_wcalloc_n(world, ecs_instantiate_plan_t, 2);
+    }
 
-    /* The instance is trying to instantiate from a base that is also
-     * its parent. This would cause the hierarchy to instantiate itself
-     * which would cause infinite recursion. */
-    const ecs_entity_t *children = ecs_table_entities(child_table);
+    ecs_instantiate_plan_t *plan = &plans[is_prefab];
+    if (plan->type.array) {
+        if (plan->generation == world->instantiate_plan_generation) {
+            return plan;
+        }
 
-#ifdef FLECS_DEBUG
-    for (j = 0; j < child_count; j ++) {
-        ecs_entity_t child = children[j];        
-        ecs_check(child != instance, ECS_INVALID_PARAMETER, 
-            "cycle detected in IsA relationship");
+        /* OnInstantiate traits changed since plan was created */
+        flecs_instantiate_plan_fini(world, plan);
     }
-#else
-    /* Bit of boilerplate to ensure that we don't get warnings about the
-     * error label not being used. */
-    ecs_check(true, ECS_INVALID_OPERATION, NULL);
-#endif
 
+    flecs_instantiate_plan_init(world, base, child_table, is_prefab, plan);
+
+    return plan;
+}
+
+static
+void flecs_instantiate_child_ids(
+    ecs_world_t *world,
+    const ecs_entity_t *children,
+    int32_t child_count,
+    ecs_entity_t root_prefab,
+    ecs_entity_t root_instance,
+    ecs_entity_t *child_ids)
+{
     /* Attempt to reserve ids for children that have the same offset from
      * the instance as from the base prefab. This ensures stable ids for
      * instance children, even across networked applications. */
-    ecs_instantiate_ctx_t ctx_cur = {base, instance};
-    if (ctx) {
-        ctx_cur = *ctx;
-    }
-
+    int32_t j;
     for (j = 0; j < child_count; j ++) {
-        if ((uint32_t)children[j] < (uint32_t)ctx_cur.root_prefab) {
+        if ((uint32_t)children[j] < (uint32_t)root_prefab) {
             /* Child id is smaller than root prefab id, can't use offset */
             child_ids[j] = flecs_new_id(world);
             continue;
@@ -282,11 +297,11 @@ void flecs_instantiate_children(
 
         /* Get prefab offset, ignore lifecycle generation count */
         ecs_entity_t prefab_offset =
-            (uint32_t)children[j] - (uint32_t)ctx_cur.root_prefab;
+            (uint32_t)children[j] - (uint32_t)root_prefab;
         ecs_assert(prefab_offset != 0, ECS_INTERNAL_ERROR, NULL);
 
         /* First check if any entity with the desired id exists */
-        ecs_entity_t instance_child = (uint32_t)ctx_cur.root_instance + prefab_offset;
+        ecs_entity_t instance_child = (uint32_t)root_instance + prefab_offset;
         ecs_entity_t alive_id = flecs_entities_get_alive(world, instance_child);
         if (alive_id && flecs_entities_is_alive(world, alive_id)) {
             /* Alive entity with requested id exists, can't use offset id */
@@ -295,37 +310,139 @@ void flecs_instantiate_children(
         }
 
         /* Id is not in use. Make it alive & match the generation of the instance. */
-        instance_child = ctx_cur.root_instance + prefab_offset;
+        instance_child = root_instance + prefab_offset;
         flecs_entities_make_alive(world, instance_child);
         flecs_entities_ensure(world, instance_child);
         ecs_assert(ecs_is_alive(world, instance_child), ECS_INTERNAL_ERROR, NULL);
         child_ids[j] = instance_child;
     }
+}
+
+static
+void flecs_instantiate_children(
+    ecs_world_t *world,
+    ecs_entity_t base,
+    const ecs_entity_t *instances,
+    int32_t instance_count,
+    ecs_table_t *child_table,
+    const ecs_instantiate_ctx_t *ctx)
+{
+    int32_t child_count = ecs_table_count(child_table);
+    if (!child_count) {
+        return;
+    }
 
-    /* Create children */
-    int32_t child_row;
-    const ecs_entity_t *i_children = flecs_bulk_new(world, i_table, child_ids,
-        &diff.added, child_count, component_data, false, &child_row, &diff);
+    /* Instances are all created by the same operation, so if one instance is
+     * a prefab, all of them are. */
+    ecs_record_t *r = flecs_entities_get(world, instances[0]);
+    ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_table_t *table = r->table;
+    ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    const ecs_instantiate_plan_t *plan = flecs_instantiate_plan_get(
+        world, base, child_table, (table->flags & EcsTableIsPrefab) != 0);
+    int32_t i, j, k, type_count = plan->type.count;
+    ecs_entity_t slot_of = plan->slot_of;
 
-    /* If children are slots, add slot relationships to parent */
-    if (slot_of) {
+    /* Create component array for creating the table */
+    ecs_table_diff_t diff = { 
+        .added = {
+            .array = ecs_os_alloca_n(ecs_id_t, type_count),
+            .count = type_count
+        }
+    };
+    ecs_os_memcpy_n(diff.added.array, plan->type.array, ecs_id_t, type_count);
+
+    /* Id flags aren't cached in the plan, as they change when observers for
+     * the components in the type are created. */
+    for (i = 0; i < type_count; i ++) {
+        diff.added_flags |= flecs_id_flags_get(world, plan->type.array[i]);
+    }
+
+    void **component_data = ecs_os_alloca_n(void*, type_count);
+    ecs_data_t *child_data = &child_table->data;
+    for (i = 0; i < type_count; i ++) {
+        int16_t column = plan->columns[i];
+        if (column != -1) {
+            component_data[i] = child_data->columns[column].data;
+        } else {
+            component_data[i] = NULL;
+        }
+    }
+
+    const ecs_entity_t *children = ecs_table_entities(child_table);
+    ecs_entity_t *child_ids = flecs_walloc_n(
+        world, ecs_entity_t, child_count * instance_count);
+
+    ecs_instantiate_ctx_t ctx_cur = {base, instances};
+    if (ctx) {
+        ctx_cur = *ctx;
+    }
+
+    /* Instantiate the prefab child table for each new instance */
+    for (k = 0; k < instance_count; k ++) {
+        ecs_entity_t instance = instances[k];
+        ecs_entity_t *i_children = &child_ids[k * child_count];
+
+        /* The instance is trying to instantiate from a base that is also
+         * its parent. This would cause the hierarchy to instantiate itself
+         * which would cause infinite recursion. */
+#ifdef FLECS_DEBUG
         for (j = 0; j < child_count; j ++) {
-            ecs_entity_t child = children[j];
-            ecs_entity_t i_child = i_children[j];
-            flecs_instantiate_slot(world, base, instance, slot_of,
-                child, i_child);
+            ecs_entity_t child = children[j];        
+            ecs_check(child != instance, ECS_INVALID_PARAMETER, 
+                "cycle detected in IsA relationship");
+        }
+#else
+        /* Bit of boilerplate to ensure that we don't get warnings about the
+         * error label not being used. */
+        ecs_check(true, ECS_INVALID_OPERATION, NULL);
+#endif
+
+        /* Replace ChildOf element in the component array with instance id */
+        diff.added.array[plan->childof_index] = 
+            ecs_pair(EcsChildOf, instance);
+
+        /* Find or create table */
+        ecs_table_t *i_table = flecs_table_find_or_create(world, &diff.added);
+        ecs_assert(i_table != NULL, ECS_INTERNAL_ERROR, NULL);
+        ecs_assert(i_table->type.count == diff.added.count,
+            ECS_INTERNAL_ERROR, NULL);
+
+        flecs_instantiate_child_ids(world, children, child_count, 
+            ctx_cur.root_prefab, ctx_cur.root_instances[k], i_children);
+
+        /* Create children */
+        flecs_bulk_new(world, i_table, i_children, &diff.added, child_count, 
+            component_data, false, NULL, &diff);
+
+        /* If children are slots, add slot relationships to parent */
+        if (slot_of) {
+            for (j = 0; j < child_count; j ++) {
+                flecs_instantiate_slot(world, base, instance, slot_of,
+                    children[j], i_children[j]);
+            }
         }
     }
 
-    /* If prefab child table has children itself, recursively instantiate */
+    /* If prefab child table has children itself, recursively instantiate. The
+     * children of all instances are instantiated together. */
+    ecs_entity_t *i_children = flecs_walloc_n(
+        world, ecs_entity_t, instance_count);
     for (j = 0; j < child_count; j ++) {
-        ecs_entity_t child = children[j];
-        flecs_instantiate(world, child, i_children[j], &ctx_cur);
+        for (k = 0; k < instance_count; k ++) {
+            i_children[k] = child_ids[k * child_count + j];
+        }
+
+        flecs_instantiate(world, children[j], i_children, instance_count, 
+            &ctx_cur);
     }
 
-    flecs_wfree_n(world, ecs_entity_t, child_count, child_ids);
+    flecs_wfree_n(world, ecs_entity_t, instance_count, i_children);
+    flecs_wfree_n(world, ecs_entity_t, child_count * instance_count, child_ids);
+    return;
 error:
-    return;    
+    flecs_wfree_n(world, ecs_entity_t, child_count * instance_count, child_ids);
 }
 
 static
@@ -341,6 +458,8 @@ void flecs_instantiate_union(
     const ecs_table_record_t *tr = flecs_component_get_table(
         union_cr, base_table);
     ecs_assert(tr != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_record_t *r = flecs_entities_get(world, instance);
+    ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
     int32_t i = 0, union_count = 0;
     do {
         ecs_id_t id = base_table->type.array[i];
@@ -351,7 +470,7 @@ void flecs_instantiate_union(
             ecs_component_record_t *cr = 
                 (ecs_component_record_t*)base_table->_->records[i].hdr.cache;
 
-            flecs_switch_set(cr->sparse, (uint32_t)instance, tgt);
+            flecs_union_set(cr, r->table, instance, tgt);
 
             union_count ++;
         }
@@ -425,26 +544,32 @@ void flecs_instantiate_override_dont_fragment(
 void flecs_instantiate(
     ecs_world_t *world,
     ecs_entity_t base,
-    ecs_entity_t instance,
+    const ecs_entity_t *instances,
+    int32_t count,
     const ecs_instantiate_ctx_t *ctx)
 {
     ecs_record_t *record = flecs_entities_get_any(world, base);
     ecs_table_t *base_table = record->table;
     ecs_assert(base_table != NULL, ECS_INTERNAL_ERROR, NULL);
 
-    /* If prefab has union relationships, also set them on instance */
-    if (base_table->flags & EcsTableHasUnion) {
-        flecs_instantiate_union(world, base, base_table, instance);
-    }
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        ecs_entity_t instance = instances[i];
 
-    if (base_table->flags & EcsTableOverrideDontFragment) {
-        flecs_instantiate_override_dont_fragment(
-            world, base_table, instance);
-    }
+        /* If prefab has union relationships, also set them on instance */
+        if (base_table->flags & EcsTableHasUnion) {
+            flecs_instantiate_union(world, base, base_table, instance);
+        }
 
-    /* If base has non-fragmenting components, add to instance */
-    if (record->row & EcsEntityHasDontFragment) {
-        flecs_instantiate_dont_fragment(world, base, instance);
+        if (base_table->flags & EcsTableOverrideDontFragment) {
+            flecs_instantiate_override_dont_fragment(
+                world, base_table, instance);
+        }
+
+        /* If base has non-fragmenting components, add to instance */
+        if (record->row & EcsEntityHasDontFragment) {
+            flecs_instantiate_dont_fragment(world, base, instance);
+        }
     }
 
     if (!(base_table->flags & EcsTableIsPrefab)) {
@@ -459,7 +584,7 @@ void flecs_instantiate(
         const ecs_table_record_t *tr;
         while ((tr = flecs_table_cache_next(&it, ecs_table_record_t))) {
             flecs_instantiate_children(
-                world, base, instance, tr->hdr.table, ctx);
+                world, base, instances, count, tr->hdr.table, ctx);
         }
         ecs_os_perf_trace_pop("flecs.instantiate");
     }
@@ -8,14 +8,31 @@
 
 typedef struct ecs_instantiate_ctx_t {
     ecs_entity_t root_prefab;
-    ecs_entity_t root_instance;
+    const ecs_entity_t *root_instances; /* Root instance for each instance */
 } ecs_instantiate_ctx_t;
 
-/* Instantiate prefab for entity. Called when adding (IsA, prefab). */
+/* Cached plan for instantiating the entities of a prefab child table. Plans are
+ * stored on the prefab child table, and are rebuilt when the OnInstantiate
+ * traits of components change. */
+typedef struct ecs_instantiate_plan_t {
+    ecs_type_t type;             /* Type of instance child table */
+    int16_t *columns;            /* Column in prefab child table, or -1 */
+    int32_t childof_index;       /* Index of (ChildOf, instance) in type */
+    ecs_entity_t slot_of;        /* Prefab for which children are slots */
+    int32_t generation;          /* World instantiate plan generation */
+} ecs_instantiate_plan_t;
+
+/* Instantiate prefab for entities. Called when adding (IsA, prefab). */
 void flecs_instantiate(
     ecs_world_t *world,
     ecs_entity_t base,
-    ecs_entity_t instance,
+    const ecs_entity_t *instances,
+    int32_t count,
     const ecs_instantiate_ctx_t *ctx);
 
+/* Free cached instantiate plans of table. */
+void flecs_instantiate_plans_fini(
+    ecs_world_t *world,
+    ecs_table_t *table);
+
 #endif
@@ -42,6 +42,23 @@ uint64_t flecs_ito_(
 }
 #endif
 
+#if !defined(__GNUC__) && !defined(__clang__)
+int32_t flecs_ctz64(
+    uint64_t value)
+{
+    ecs_assert(value != 0, ECS_INTERNAL_ERROR, NULL);
+    int32_t result = 0, shift;
+    for (shift = 32; shift; shift >>= 1) {
+        uint64_t mask = (1ull << shift) - 1;
+        if (!(value & mask)) {
+            value >>= shift;
+            result += shift;
+        }
+    }
+    return result;
+}
+#endif
+
 int32_t flecs_next_pow_of_2(
     int32_t n)
 {
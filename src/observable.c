@@ -345,7 +345,9 @@ void flecs_emit_propagate(
     /* Propagate to records of traversable relationships */
     ecs_component_record_t *cur = tgt_cr;
     while ((cur = flecs_component_trav_next(cur))) {
-        cur->pair->reachable.generation ++; /* Invalidate cache */
+        if (cur->pair->ext) {
+            cur->pair->ext->reachable.generation ++; /* Invalidate cache */
+        }
 
         /* Get traversed relationship */
         ecs_entity_t trav = ECS_PAIR_FIRST(cur->id);
@@ -378,7 +380,12 @@ void flecs_emit_propagate_invalidate_tables(
     /* Invalidate records of traversable relationships */
     ecs_component_record_t *cur = tgt_cr;
     while ((cur = flecs_component_trav_next(cur))) {
-        ecs_reachable_cache_t *rc = &cur->pair->reachable;
+        if (!cur->pair->ext) {
+            /* Cache was never populated, so subtree has nothing cached */
+            continue;
+        }
+
+        ecs_reachable_cache_t *rc = &cur->pair->ext->reachable;
         if (rc->current != rc->generation) {
             /* Subtree is already marked invalid */
             continue;
@@ -836,7 +843,8 @@ void flecs_emit_forward_table_up(
     /* If tgt_cr is out of sync but is not the current component record being updated,
      * keep track so that we can update two records for the cost of one. */
     ecs_assert(tgt_cr->pair != NULL, ECS_INTERNAL_ERROR, NULL);
-    ecs_reachable_cache_t *rc = &tgt_cr->pair->reachable;
+    ecs_reachable_cache_t *rc = 
+        &flecs_pair_record_ext_ensure(world, tgt_cr)->reachable;
     bool parent_revalidate = (reachable_ids != &rc->ids) && 
         (rc->current != rc->generation);
     if (parent_revalidate) {
@@ -877,7 +885,8 @@ void flecs_emit_forward_table_up(
             t[0] = tgt_table;
 
             ecs_assert(cr->pair != NULL, ECS_INTERNAL_ERROR, NULL);
-            ecs_reachable_cache_t *cr_rc = &cr->pair->reachable;
+            ecs_reachable_cache_t *cr_rc = 
+                &flecs_pair_record_ext_ensure(world, cr)->reachable;
             if (cr_rc->current == cr_rc->generation) {
                 /* Cache hit, use cached ids to prevent traversing the same
                  * hierarchy multiple times. This especially speeds up code 
@@ -1012,7 +1021,8 @@ void flecs_emit_forward(
     ecs_component_record_t *cr)
 {
     ecs_assert(cr->pair != NULL, ECS_INTERNAL_ERROR, NULL);
-    ecs_reachable_cache_t *rc = &cr->pair->reachable;
+    ecs_reachable_cache_t *rc = 
+        &flecs_pair_record_ext_ensure(world, cr)->reachable;
 
     if (rc->current != rc->generation) {
         /* Cache miss, iterate the tree to find ids to forward */
@@ -1330,14 +1340,20 @@ repeat_event:
                              * from being called recursively, in case prefab
                              * children also have IsA relationships. */
                             world->stages[0]->base = tgt;
-                            const ecs_entity_t *instances = 
-                                ecs_table_entities(table);
-                            int32_t e;
 
-                            for (e = 0; e < count; e ++) {
-                                flecs_instantiate(
-                                    world, tgt, instances[offset + e], NULL);
-                            }
+                            /* Copy instances, as instantiating slots can move
+                             * instances to a different table. */
+                            ecs_entity_t *instances = flecs_walloc_n(
+                                world, ecs_entity_t, count);
+                            ecs_os_memcpy_n(instances, 
+                                &ecs_table_entities(table)[offset], 
+                                ecs_entity_t, count);
+
+                            flecs_instantiate(world, tgt, instances, count, 
+                                NULL);
+
+                            flecs_wfree_n(world, ecs_entity_t, count, 
+                                instances);
 
                             world->stages[0]->base = 0;
                         }
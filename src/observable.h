@@ -25,6 +25,17 @@ typedef struct ecs_event_id_record_t {
     int32_t observer_count;
 } ecs_event_id_record_t;
 
+/* Existing matches of an observer that are yielded incrementally. Entities
+ * are yielded in the order in which they were recorded. The pending map
+ * contains the recorded entities that haven't been yielded yet, which is used
+ * to yield an entity before an event for it is delivered to the observer. */
+typedef struct ecs_observer_yield_t {
+    ecs_vec_t entities;              /* vector<ecs_entity_t> */
+    ecs_map_t pending;               /* map<entity, 0> */
+    int32_t cursor;                  /* Next element in entities to yield */
+    double time_budget;              /* Max time spent per frame (seconds) */
+} ecs_observer_yield_t;
+
 typedef struct ecs_observer_impl_t {
     ecs_observer_t pub;
 
@@ -42,6 +53,8 @@ typedef struct ecs_observer_impl_t {
     ecs_query_t *not_query;     /**< Query used to populate observer data when a
                                      term with a not operator triggers. */
 
+    ecs_observer_yield_t *yield; /**< Existing matches that are not yet yielded */
+
     /* Mixins */
     flecs_poly_dtor_t dtor;
 } ecs_observer_impl_t;
@@ -98,6 +111,11 @@ ecs_observer_t* flecs_observer_init(
 void flecs_observer_fini(
     ecs_observer_t *observer);
 
+/* Yield existing matches of incremental observers within their time budget
+ * (called at the end of each frame). */
+void flecs_observers_yield_frame(
+    ecs_world_t *world);
+
 /* Emit event. */
 void flecs_emit( 
     ecs_world_t *world,
@@ -289,6 +289,14 @@ bool flecs_ignore_observer(
     return result;
 }
 
+static
+void flecs_observer_yield_flush(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    ecs_table_t *table,
+    int32_t offset,
+    int32_t count);
+
 static
 void flecs_default_uni_observer_run_callback(ecs_iter_t *it) {
     ecs_observer_t *o = it->ctx;
@@ -331,6 +339,11 @@ void flecs_uni_observer_invoke(
         return;
     }
 
+    ecs_observer_impl_t *impl = flecs_observer_impl(o);
+    if (impl->yield) {
+        flecs_observer_yield_flush(world, o, table, it->offset, it->count);
+    }
+
     if (ecs_should_log_3()) {
         char *path = ecs_get_path(world, it->system);
         ecs_dbg_3("observer: invoke %s", path);
@@ -339,7 +352,6 @@ void flecs_uni_observer_invoke(
 
     ecs_log_push_3();
 
-    ecs_observer_impl_t *impl = flecs_observer_impl(o);
     it->system = o->entity;
     it->ctx = o->ctx;
     it->callback_ctx = o->callback_ctx;
@@ -471,6 +483,11 @@ void flecs_multi_observer_invoke(
         return;
     }
 
+    if (impl->yield) {
+        flecs_observer_yield_flush(
+            world, o, it->table, it->offset, it->count);
+    }
+
     ecs_table_t *table = it->table;
     ecs_table_t *prev_table = it->other_table;
     int8_t pivot_term = it->term_index;
@@ -596,8 +613,9 @@ void flecs_multi_observer_invoke_no_query(
     user_it.system = o->entity;
     user_it.event = it->event;
 
-    ecs_entity_t old_system = flecs_stage_set_system(
-        world->stages[0], o->entity);
+    /* Existing matches can be yielded from a worker stage */
+    ecs_stage_t *stage = world->stages[ecs_stage_get_id(it->world)];
+    ecs_entity_t old_system = flecs_stage_set_system(stage, o->entity);
     ecs_table_lock(it->world, table);
 
     if (o->run) {
@@ -608,7 +626,7 @@ void flecs_multi_observer_invoke_no_query(
     }
 
     ecs_table_unlock(it->world, table);
-    flecs_stage_set_system(world->stages[0], old_system);
+    flecs_stage_set_system(stage, old_system);
 }
 
 /* For convenience, so applications can use a single run callback that uses 
@@ -644,34 +662,204 @@ void flecs_multi_observer_builtin_run(ecs_iter_t *it) {
     flecs_multi_observer_invoke(it);
 }
 
+/* Number of recorded entities yielded before checking the time budget */
+#define FLECS_OBSERVER_YIELD_BATCH (256)
+
 static
-void flecs_observer_yield_existing(
+bool flecs_observer_yield_event(
+    ecs_entity_t event,
+    bool yield_on_remove)
+{
+    /* We only yield for OnRemove events if the observer is deleted. */
+    if (event == EcsOnRemove) {
+        return yield_on_remove;
+    } else {
+        return !yield_on_remove;
+    }
+}
+
+/* Invoke observer for existing matches. When parallel is true the iterator
+ * can run on a worker thread, and the event id is incremented atomically. */
+static
+void flecs_observer_yield_iter(
     ecs_world_t *world,
     ecs_observer_t *o,
-    bool yield_on_remove)
+    ecs_iter_t *it,
+    ecs_entity_t event,
+    bool parallel)
 {
     ecs_run_action_t run = o->run;
     if (!run) {
         run = flecs_multi_observer_invoke_no_query;
     }
 
+    it->system = o->entity;
+    it->ctx = o;
+    it->callback = flecs_default_uni_observer_run_callback;
+    it->callback_ctx = o->callback_ctx;
+    it->run_ctx = o->run_ctx;
+    it->event = event;
+    while (o->query ? ecs_query_next(it) : ecs_each_next(it)) {
+        it->event_id = it->ids[0];
+        if (parallel) {
+            it->event_cur = ecs_os_ainc(&world->event_id);
+        } else {
+            it->event_cur = ++ world->event_id;
+        }
+
+        ecs_iter_next_action_t next = it->next;
+        it->next = flecs_default_next_callback;
+        run(it);
+        it->next = next;
+        it->interrupted_by = 0;
+    }
+}
+
+typedef struct ecs_observer_yield_job_t {
+    ecs_observer_t *o;
+    ecs_entity_t event;
+    const ecs_table_range_t *ranges;
+    int32_t range_count;
+    int32_t job_count;
+} ecs_observer_yield_job_t;
+
+/* Yield every job_count'th range, using the stage of the job */
+static
+void flecs_observer_yield_job(
+    void *ptr,
+    int32_t index)
+{
+    ecs_observer_yield_job_t *ctx = ptr;
+    ecs_observer_t *o = ctx->o;
+    ecs_world_t *world = o->world;
+    ecs_world_t *stage = (ecs_world_t*)world->stages[index];
+    ecs_entity_t old_system = flecs_stage_set_system(
+        world->stages[index], o->entity);
+
+    int32_t i;
+    for (i = index; i < ctx->range_count; i += ctx->job_count) {
+        ecs_iter_t it = ecs_query_iter(stage, o->query);
+        ecs_iter_set_var_as_range(&it, 0, &ctx->ranges[i]);
+        flecs_observer_yield_iter(world, o, &it, ctx->event, true);
+    }
+
+    flecs_stage_set_system(world->stages[index], old_system);
+}
+
+/* Matches can be yielded from worker threads if the observer callback is
+ * thread safe, and the world can be put in multithreaded readonly mode. */
+static
+bool flecs_observer_yield_is_parallel(
+    ecs_world_t *world,
+    ecs_observer_t *o)
+{
+    return (flecs_observer_impl(o)->flags & EcsObserverMultiThreaded) &&
+        o->query && (o->query->flags & EcsQueryMatchThis) &&
+        (world->stage_count > 1) && ecs_os_has_parallel_for() &&
+        !(world->flags & EcsWorldReadonly) && !ecs_is_deferred(world);
+}
+
+/* Yield existing matches in table ranges. When parallel is true, the world
+ * must be in readonly mode. */
+static
+void flecs_observer_yield_ranges(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    const ecs_table_range_t *ranges,
+    int32_t count,
+    bool parallel)
+{
+    int32_t i, e;
+    for (e = 0; e < o->event_count; e ++) {
+        ecs_entity_t event = o->events[e];
+        if (!flecs_observer_yield_event(event, false)) {
+            continue;
+        }
+
+        if (parallel) {
+            ecs_observer_yield_job_t ctx = {
+                .o = o,
+                .event = event,
+                .ranges = ranges,
+                .range_count = count,
+                .job_count = world->stage_count
+            };
+
+            if (ctx.job_count > count) {
+                ctx.job_count = count;
+            }
+
+            if (ctx.job_count) {
+                ecs_os_parallel_for(
+                    flecs_observer_yield_job, &ctx, ctx.job_count);
+            }
+        } else {
+            for (i = 0; i < count; i ++) {
+                ecs_iter_t it = ecs_query_iter(world, o->query);
+                ecs_iter_set_var_as_range(&it, 0, &ranges[i]);
+                flecs_observer_yield_iter(world, o, &it, event, false);
+            }
+        }
+    }
+}
+
+/* Yield existing matches from worker threads, one table at a time */
+static
+void flecs_observer_yield_existing_parallel(
+    ecs_world_t *world,
+    ecs_observer_t *o)
+{
+    ecs_allocator_t *a = &world->allocator;
+    ecs_vec_t ranges;
+    ecs_vec_init_t(a, &ranges, ecs_table_range_t, 0);
+
+    /* Results for the same table are returned consecutively. Each job 
+     * evaluates the query for an entire table, which returns all results for
+     * the table. */
+    ecs_iter_t it = ecs_query_iter(world, o->query);
+    ECS_BIT_SET(it.flags, EcsIterNoData);
+    ecs_table_t *last = NULL;
+    while (ecs_query_next(&it)) {
+        if (it.table == last) {
+            continue;
+        }
+
+        last = it.table;
+        ecs_vec_append_t(a, &ranges, ecs_table_range_t)[0] = 
+            (ecs_table_range_t){ 
+                .table = it.table, 
+                .offset = 0,
+                .count = ecs_table_count(it.table) 
+            };
+    }
+
+    ecs_readonly_begin(world, true);
+    flecs_observer_yield_ranges(world, o, ecs_vec_first(&ranges), 
+        ecs_vec_count(&ranges), true);
+    ecs_readonly_end(world);
+
+    ecs_vec_fini_t(a, &ranges, ecs_table_range_t);
+}
+
+static
+void flecs_observer_yield_existing(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    bool yield_on_remove)
+{
+    if (!yield_on_remove && flecs_observer_yield_is_parallel(world, o)) {
+        flecs_observer_yield_existing_parallel(world, o);
+        return;
+    }
+
     ecs_defer_begin(world);
 
     /* If yield existing is enabled, invoke for each thing that matches
      * the event, if the event is iterable. */
     int i, count = o->event_count;
     for (i = 0; i < count; i ++) {
-        ecs_entity_t event = o->events[i];
-
-        /* We only yield for OnRemove events if the observer is deleted. */
-        if (event == EcsOnRemove) {
-            if (!yield_on_remove) {
-                continue;
-            }
-        } else {
-            if (yield_on_remove) {
-                continue;
-            }
+        if (!flecs_observer_yield_event(o->events[i], yield_on_remove)) {
+            continue;
         }
 
         ecs_iter_t it;
@@ -681,27 +869,297 @@ void flecs_observer_yield_existing(
             it = ecs_each_id(world, flecs_observer_impl(o)->register_id);
         }
 
-        it.system = o->entity;
-        it.ctx = o;
-        it.callback = flecs_default_uni_observer_run_callback;
-        it.callback_ctx = o->callback_ctx;
-        it.run_ctx = o->run_ctx;
-        it.event = o->events[i];
-        while (o->query ? ecs_query_next(&it) : ecs_each_next(&it)) {
-            it.event_id = it.ids[0];
-            it.event_cur = ++ world->event_id;
+        flecs_observer_yield_iter(world, o, &it, o->events[i], false);
+    }
+
+    ecs_defer_end(world);
+}
+
+/* Record entities that match the observer, which are yielded incrementally */
+static
+void flecs_observer_yield_init(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    double time_budget)
+{
+    ecs_allocator_t *a = &world->allocator;
+    ecs_observer_yield_t *y = flecs_calloc_t(a, ecs_observer_yield_t);
+    ecs_vec_init_t(a, &y->entities, ecs_entity_t, 0);
+    ecs_map_init(&y->pending, a);
+    y->time_budget = time_budget;
+
+    ecs_iter_t it = ecs_query_iter(world, o->query);
+    ECS_BIT_SET(it.flags, EcsIterNoData);
+    while (ecs_query_next(&it)) {
+        int32_t i;
+        for (i = 0; i < it.count; i ++) {
+            /* Queries can return an entity more than once, for example when
+             * matching multiple pairs for a wildcard. */
+            ecs_entity_t e = it.entities[i];
+            if (ecs_map_get(&y->pending, e)) {
+                continue;
+            }
 
-            ecs_iter_next_action_t next = it.next;
-            it.next = flecs_default_next_callback;
-            run(&it);
-            it.next = next;
-            it.interrupted_by = 0;
+            ecs_map_insert(&y->pending, e, 0);
+            ecs_vec_append_t(a, &y->entities, ecs_entity_t)[0] = e;
+        }
+    }
+
+    int32_t count = ecs_vec_count(&y->entities);
+    if (!count) {
+        ecs_vec_fini_t(a, &y->entities, ecs_entity_t);
+        ecs_map_fini(&y->pending);
+        flecs_free_t(a, ecs_observer_yield_t, y);
+        return;
+    }
+
+    flecs_observer_impl(o)->yield = y;
+    ecs_vec_append_t(a, &world->observer_yield_queue, ecs_observer_t*)[0] = o;
+    world->info.observer_yield_count += count;
+}
+
+static
+void flecs_observer_yield_fini(
+    ecs_world_t *world,
+    ecs_observer_t *o)
+{
+    ecs_observer_impl_t *impl = flecs_observer_impl(o);
+    ecs_observer_yield_t *y = impl->yield;
+    ecs_allocator_t *a = &world->allocator;
+
+    world->info.observer_yield_count -= ecs_map_count(&y->pending);
+    ecs_vec_fini_t(a, &y->entities, ecs_entity_t);
+    ecs_map_fini(&y->pending);
+    flecs_free_t(a, ecs_observer_yield_t, y);
+    impl->yield = NULL;
+
+    /* Keep order of remaining observers in queue */
+    ecs_observer_t **queue = ecs_vec_first(&world->observer_yield_queue);
+    int32_t i, count = ecs_vec_count(&world->observer_yield_queue);
+    for (i = 0; i < count; i ++) {
+        if (queue[i] == o) {
+            ecs_vec_remove_ordered_t(
+                &world->observer_yield_queue, ecs_observer_t*, i);
+            break;
+        }
+    }
+}
+
+/* Take range of recorded entities that are stored next to each other in the
+ * same table. Consumes at most max recorded entities, and returns the number of
+ * recorded entities that were consumed. */
+static
+int32_t flecs_observer_yield_next_range(
+    ecs_world_t *world,
+    ecs_observer_yield_t *y,
+    ecs_table_range_t *range,
+    int32_t max)
+{
+    const ecs_entity_t *entities = ecs_vec_first(&y->entities);
+    int32_t i, count = ecs_vec_count(&y->entities);
+    *range = (ecs_table_range_t){0};
+
+    if (count > (y->cursor + max)) {
+        count = y->cursor + max;
+    }
+
+    for (i = y->cursor; i < count; i ++) {
+        ecs_entity_t e = entities[i];
+        if (!ecs_map_get(&y->pending, e)) {
+            /* Entity was yielded before an event for it was delivered */
+            continue;
+        }
+
+        /* Entities that got deleted are skipped */
+        ecs_record_t *r = flecs_entities_try(world, e);
+        ecs_table_t *table = r ? r->table : NULL;
+        if (!table) {
+            ecs_map_remove(&y->pending, e);
+            world->info.observer_yield_count --;
+            continue;
+        }
+
+        int32_t row = ECS_RECORD_TO_ROW(r->row);
+        if (range->table) {
+            if ((table != range->table) || 
+                (row != (range->offset + range->count))) 
+            {
+                break;
+            }
+
+            range->count ++;
+        } else {
+            range->table = table;
+            range->offset = row;
+            range->count = 1;
+        }
+
+        ecs_map_remove(&y->pending, e);
+        world->info.observer_yield_count --;
+    }
+
+    int32_t result = i - y->cursor;
+    y->cursor = i;
+    return result;
+}
+
+/* Yield recorded entities until done or time budget is exceeded. Returns true
+ * if all entities have been yielded, after which the yield state is freed. */
+static
+bool flecs_observer_yield_step(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    ecs_time_t *start,
+    double time_budget_seconds)
+{
+    ecs_observer_yield_t *y = flecs_observer_impl(o)->yield;
+    ecs_allocator_t *a = &world->allocator;
+    bool parallel = flecs_observer_yield_is_parallel(world, o);
+
+    ecs_vec_t ranges;
+    ecs_vec_init_t(a, &ranges, ecs_table_range_t, 0);
+
+    /* Commands are merged after the last batch. This ensures that the observer
+     * isn't deleted by its own callback while still yielding. */
+    if (parallel) {
+        ecs_readonly_begin(world, true);
+    } else {
+        ecs_defer_begin(world);
+    }
+
+    int32_t count = ecs_vec_count(&y->entities);
+    while (y->cursor < count) {
+        int32_t batch = 0;
+        ecs_vec_clear(&ranges);
+        while ((batch < FLECS_OBSERVER_YIELD_BATCH) && (y->cursor < count)) {
+            ecs_table_range_t range;
+            batch += flecs_observer_yield_next_range(world, y, &range,
+                FLECS_OBSERVER_YIELD_BATCH - batch);
+            if (range.table) {
+                ecs_vec_append_t(a, &ranges, ecs_table_range_t)[0] = range;
+            }
+        }
+
+        flecs_observer_yield_ranges(world, o, ecs_vec_first(&ranges), 
+            ecs_vec_count(&ranges), parallel);
+
+        if (ECS_NEQZERO(time_budget_seconds)) {
+            ecs_time_t cur = *start;
+            if (ecs_time_measure(&cur) > time_budget_seconds) {
+                break;
+            }
+        }
+    }
+
+    bool done = y->cursor == count;
+    if (done) {
+        flecs_observer_yield_fini(world, o);
+    }
+
+    ecs_vec_fini_t(a, &ranges, ecs_table_range_t);
+
+    if (parallel) {
+        ecs_readonly_end(world);
+    } else {
+        ecs_defer_end(world);
+    }
+
+    return done;
+}
+
+/* Yield recorded entities in table range before an event for them is delivered
+ * to the observer, so that the observer receives events in order. */
+static
+void flecs_observer_yield_flush(
+    ecs_world_t *world,
+    ecs_observer_t *o,
+    ecs_table_t *table,
+    int32_t offset,
+    int32_t count)
+{
+    ecs_observer_yield_t *y = flecs_observer_impl(o)->yield;
+    if (!table || !ecs_map_count(&y->pending)) {
+        return;
+    }
+
+    ecs_defer_begin(world);
+
+    const ecs_entity_t *entities = ecs_table_entities(table);
+    int32_t row, start = -1, end = offset + count;
+    for (row = offset; row <= end; row ++) {
+        if (row < end && ecs_map_get(&y->pending, entities[row])) {
+            ecs_map_remove(&y->pending, entities[row]);
+            world->info.observer_yield_count --;
+            if (start == -1) {
+                start = row;
+            }
+        } else if (start != -1) {
+            ecs_table_range_t range = { 
+                .table = table, 
+                .offset = start, 
+                .count = row - start
+            };
+
+            flecs_observer_yield_ranges(world, o, &range, 1, false);
+            start = -1;
         }
     }
 
     ecs_defer_end(world);
 }
 
+void flecs_observers_yield_frame(
+    ecs_world_t *world)
+{
+    ecs_vec_t *queue = &world->observer_yield_queue;
+    if (!ecs_vec_count(queue) || ecs_is_deferred(world)) {
+        return;
+    }
+
+    ecs_os_perf_trace_push("flecs.observer_yield");
+
+    /* Each observer gets its own time budget */
+    int32_t i = 0;
+    while (i < ecs_vec_count(queue)) {
+        ecs_observer_t *o = ecs_vec_get_t(queue, ecs_observer_t*, i)[0];
+        ecs_time_t start = {0};
+        ecs_time_measure(&start);
+        if (!flecs_observer_yield_step(world, o, &start, 
+            flecs_observer_impl(o)->yield->time_budget)) 
+        {
+            i ++;
+        }
+    }
+
+    ecs_os_perf_trace_pop("flecs.observer_yield");
+}
+
+int32_t ecs_observer_yield_run(
+    ecs_world_t *world,
+    double time_budget_seconds)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(!ecs_is_deferred(world), ECS_INVALID_OPERATION,
+        "cannot yield observer matches while world is deferred");
+
+    ecs_time_t start = {0};
+    if (ECS_NEQZERO(time_budget_seconds)) {
+        ecs_time_measure(&start);
+    }
+
+    ecs_vec_t *queue = &world->observer_yield_queue;
+    while (ecs_vec_count(queue)) {
+        ecs_observer_t *o = ecs_vec_first_t(queue, ecs_observer_t*)[0];
+        if (!flecs_observer_yield_step(world, o, &start, time_budget_seconds)) {
+            break;
+        }
+    }
+
+    return world->info.observer_yield_count;
+error:
+    return 0;
+}
+
 static
 int flecs_uni_observer_init(
     ecs_world_t *world,
@@ -1012,7 +1470,12 @@ ecs_observer_t* flecs_observer_init(
         .ids = ids
     };
 
-    if (desc->events[0] != EcsMonitor) {
+    /* Incremental and parallel yield evaluate the query for table ranges,
+     * which requires an actual query. */
+    bool yield_query = desc->yield_existing && 
+        (ECS_NEQZERO(desc->yield_existing_time_budget) || desc->multi_threaded);
+
+    if (desc->events[0] != EcsMonitor && !yield_query) {
         if (flecs_query_finalize_simple(world, &dummy_query, &query_desc)) {
             /* Flag is set if query increased the keep_alive count of the 
              * queried for component, which prevents deleting the component
@@ -1098,6 +1561,9 @@ ecs_observer_t* flecs_observer_init(
     impl->term_index = desc->term_index_;
     impl->flags |= desc->flags_ | 
         (query->flags & (EcsQueryMatchPrefab|EcsQueryMatchDisabled));
+    if (desc->multi_threaded) {
+        impl->flags |= EcsObserverMultiThreaded;
+    }
 
     ecs_check(!(desc->yield_existing && 
         (desc->flags_ & (EcsObserverYieldOnCreate|EcsObserverYieldOnDelete))), 
@@ -1170,7 +1636,14 @@ ecs_observer_t* flecs_observer_init(
     }
 
     if (impl->flags & EcsObserverYieldOnCreate) {
-        flecs_observer_yield_existing(world, o, false);
+        if (ECS_NEQZERO(desc->yield_existing_time_budget) && 
+            (query->flags & EcsQueryMatchThis)) 
+        {
+            flecs_observer_yield_init(
+                world, o, desc->yield_existing_time_budget);
+        } else {
+            flecs_observer_yield_existing(world, o, false);
+        }
     }
 
     return o;
@@ -1300,6 +1773,17 @@ void flecs_observer_fini(
     flecs_poly_assert(world, ecs_world_t);
     ecs_observer_impl_t *impl = flecs_observer_impl(o);
 
+    if (impl->yield) {
+        if (impl->flags & EcsObserverYieldOnDelete) {
+            /* Yield remaining matches first, so that OnRemove events are never
+             * delivered before the events for the existing matches. */
+            ecs_time_t start = {0};
+            flecs_observer_yield_step(world, o, &start, 0);
+        } else {
+            flecs_observer_yield_fini(world, o);
+        }
+    }
+
     if (impl->flags & EcsObserverYieldOnDelete) {
         flecs_observer_yield_existing(world, o, true);
     }
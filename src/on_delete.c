@@ -210,7 +210,7 @@ void flecs_id_mark_for_delete(
                      * component through the deleted entity. */
                     if (!(cur->flags & EcsIdOnDeleteTargetDelete)) {
                         /* Only bother if tables have relationship. */
-                        if (ecs_map_count(&cur->cache.index)) {
+                        if (flecs_table_cache_count(&cur->cache)) {
                             flecs_update_component_monitors(world, NULL, 
                                 &(ecs_type_t){
                                     .array = (ecs_id_t[]){cur->id},
@@ -309,10 +309,101 @@ void flecs_remove_from_table(
     flecs_table_diff_builder_fini(world, &diff);
 }
 
+/* Number of rows destructed by a single parallel delete job */
+#define FLECS_DELETE_DTOR_CHUNK (4096)
+
+typedef struct ecs_delete_dtor_ctx_t {
+    ecs_table_detached_t *columns;
+    int32_t column_count;
+    int32_t job_count;
+} ecs_delete_dtor_ctx_t;
+
+/* Destruct every job_count'th chunk of the detached component storage */
+static
+void flecs_on_delete_dtor_job(
+    void *ptr,
+    int32_t index)
+{
+    ecs_delete_dtor_ctx_t *ctx = ptr;
+    int32_t c, chunk = 0;
+    for (c = 0; c < ctx->column_count; c ++) {
+        ecs_table_detached_t *column = &ctx->columns[c];
+        const ecs_type_info_t *ti = column->ti;
+        int32_t row, count = ecs_vec_count(&column->data);
+        for (row = 0; row < count; row += FLECS_DELETE_DTOR_CHUNK, chunk ++) {
+            if ((chunk % ctx->job_count) != index) {
+                continue;
+            }
+
+            int32_t n = count - row;
+            if (n > FLECS_DELETE_DTOR_CHUNK) {
+                n = FLECS_DELETE_DTOR_CHUNK;
+            }
+
+            ti->hooks.dtor(ECS_ELEM(column->data.array, ti->size, row), n, ti);
+        }
+    }
+}
+
+/* Invoke destructors for storage detached from deleted tables, then free it */
+static
+void flecs_on_delete_dtor_detached(
+    ecs_world_t *world,
+    ecs_vec_t *detached)
+{
+    int32_t i, count = ecs_vec_count(detached);
+    if (!count) {
+        return;
+    }
+
+    ecs_table_detached_t *columns = ecs_vec_first(detached);
+    int32_t chunk_count = 0;
+    for (i = 0; i < count; i ++) {
+        int32_t rows = ecs_vec_count(&columns[i].data);
+        chunk_count += (rows + FLECS_DELETE_DTOR_CHUNK - 1) / 
+            FLECS_DELETE_DTOR_CHUNK;
+    }
+
+    ecs_delete_dtor_ctx_t ctx = {
+        .columns = columns,
+        .column_count = count,
+        .job_count = world->stage_count
+    };
+
+    if (ctx.job_count > chunk_count) {
+        ctx.job_count = chunk_count;
+    }
+
+    if (ctx.job_count > 1) {
+        ecs_os_parallel_for(flecs_on_delete_dtor_job, &ctx, ctx.job_count);
+    } else {
+        ctx.job_count = 1;
+        flecs_on_delete_dtor_job(&ctx, 0);
+    }
+
+    for (i = 0; i < count; i ++) {
+        ecs_vec_fini(&world->allocator, &columns[i].data, columns[i].ti->size);
+    }
+
+    ecs_vec_clear(detached);
+}
+
 static
 bool flecs_on_delete_clear_tables(
     ecs_world_t *world)
 {
+    /* When parallel delete is enabled, component storage of deleted tables is
+     * collected while emptying the tables, and destructed at the end. If there
+     * is only one thread, destructing while the storage is still in the cache
+     * is faster, so don't collect. */
+    ecs_vec_t detached = {0};
+    ecs_vec_t *detached_ptr = NULL;
+    if ((world->flags & EcsWorldParallelDelete) && 
+        (world->stage_count > 1) && ecs_os_has_parallel_for()) 
+    {
+        detached_ptr = &detached;
+    }
+
     /* Iterate in reverse order so that DAGs get deleted bottom to top */
     int32_t i, last = ecs_vec_count(&world->store.marked_ids), first = 0;
     ecs_marked_id_t *ids = ecs_vec_first(&world->store.marked_ids);
@@ -336,7 +427,12 @@ bool flecs_on_delete_clear_tables(
                         ecs_dbg_3(
                             "#[red]delete#[reset] entities from table %u", 
                             (uint32_t)table->id);
-                        flecs_table_delete_entities(world, table);
+                        if (detached_ptr) {
+                            flecs_table_delete_entities_detached(
+                                world, table, detached_ptr);
+                        } else {
+                            flecs_table_delete_entities(world, table);
+                        }
                     }
                 }
             }
@@ -364,6 +460,11 @@ bool flecs_on_delete_clear_tables(
         }
     } while (true);
 
+    if (detached_ptr) {
+        flecs_on_delete_dtor_detached(world, detached_ptr);
+        ecs_vec_fini_t(&world->allocator, detached_ptr, ecs_table_detached_t);
+    }
+
     return true;
 }
 
@@ -495,6 +596,13 @@ void flecs_on_delete(
         ecs_dbg_2("#[red]delete#[reset]");
         ecs_log_push_2();
 
+        bool measure_time = ecs_os_has_time() && (world->flags & 
+            (EcsWorldMeasureFrameTime|EcsWorldParallelDelete)) != 0;
+        ecs_time_t t_start = {0};
+        if (measure_time) {
+            ecs_os_get_time(&t_start);
+        }
+
         /* Empty tables with all the to be deleted ids */
         flecs_on_delete_clear_tables(world);
 
@@ -525,6 +633,12 @@ void flecs_on_delete(
 
         ecs_vec_clear(&world->store.deleted_components);
 
+        if (measure_time) {
+            ecs_ftime_t delete_time = (ecs_ftime_t)ecs_time_measure(&t_start);
+            world->info.delete_time_total += delete_time;
+            world->info.delete_time_last = delete_time;
+        }
+
         ecs_log_pop_2();
     }
 }
@@ -546,6 +660,201 @@ void ecs_delete_with(
     flecs_journal_end();
 }
 
+/* Number of entities without children deleted with one ecs_delete_many() */
+#define FLECS_DELETE_QUEUE_BATCH (256)
+
+static
+void flecs_delete_queue_push(
+    ecs_world_t *world,
+    ecs_entity_t entity)
+{
+    ecs_delete_queue_t *q = &world->delete_queue;
+    ecs_allocator_t *a = &world->allocator;
+
+    if (flecs_components_get(world, ecs_childof(entity))) {
+        ecs_delete_queue_elem_t *elem = ecs_vec_append_t(
+            a, &q->stack, ecs_delete_queue_elem_t);
+        elem->entity = entity;
+        elem->expanded = false;
+    } else {
+        ecs_vec_append_t(a, &q->leaves, ecs_entity_t)[0] = entity;
+    }
+}
+
+/* Queue children of entity */
+static
+void flecs_delete_queue_expand(
+    ecs_world_t *world,
+    ecs_entity_t entity)
+{
+    ecs_component_record_t *cr = flecs_components_get(
+        world, ecs_childof(entity));
+    if (!cr) {
+        return;
+    }
+
+    ecs_table_cache_iter_t it;
+    if (flecs_table_cache_iter(&cr->cache, &it)) {
+        const ecs_table_record_t *tr;
+        while ((tr = flecs_table_cache_next(&it, ecs_table_record_t))) {
+            ecs_table_t *table = tr->hdr.table;
+            const ecs_entity_t *entities = ecs_table_entities(table);
+            int32_t i, count = ecs_table_count(table);
+            for (i = 0; i < count; i ++) {
+                flecs_delete_queue_push(world, entities[i]);
+            }
+        }
+    }
+}
+
+/* Queue root entities that aren't modules or in use as (component) id */
+static
+void flecs_delete_queue_roots(
+    ecs_world_t *world)
+{
+    ecs_component_record_t *cr = flecs_components_get(
+        world, ecs_pair(EcsChildOf, 0));
+    ecs_assert(cr != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_component_record_t *cr_comp = flecs_components_get(
+        world, ecs_id(EcsComponent));
+
+    ecs_table_cache_iter_t it;
+    if (flecs_table_cache_iter(&cr->cache, &it)) {
+        const ecs_table_record_t *tr;
+        while ((tr = flecs_table_cache_next(&it, ecs_table_record_t))) {
+            ecs_table_t *table = tr->hdr.table;
+            if (table->flags & EcsTableHasBuiltins) {
+                continue;
+            }
+
+            if (cr_comp && flecs_component_get_table(cr_comp, table)) {
+                continue;
+            }
+
+            const ecs_entity_t *entities = ecs_table_entities(table);
+            int32_t i, count = ecs_table_count(table);
+            for (i = 0; i < count; i ++) {
+                ecs_record_t *r = flecs_entities_get(world, entities[i]);
+                ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
+                if (ECS_RECORD_TO_ROW_FLAGS(r->row) & EcsEntityIsId) {
+                    continue;
+                }
+
+                flecs_delete_queue_push(world, entities[i]);
+            }
+        }
+    }
+}
+
+static
+int32_t flecs_delete_queue_count(
+    const ecs_world_t *world)
+{
+    return ecs_vec_count(&world->delete_queue.stack) + 
+        ecs_vec_count(&world->delete_queue.leaves);
+}
+
+void flecs_delete_queue_fini(
+    ecs_world_t *world)
+{
+    ecs_delete_queue_t *q = &world->delete_queue;
+    ecs_allocator_t *a = &world->allocator;
+    ecs_vec_fini_t(a, &q->stack, ecs_delete_queue_elem_t);
+    ecs_vec_fini_t(a, &q->leaves, ecs_entity_t);
+    world->info.delete_queue_count = 0;
+}
+
+void ecs_delete_incremental(
+    ecs_world_t *world,
+    ecs_entity_t entity)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(!(world->flags & EcsWorldFini), ECS_INVALID_OPERATION,
+        "cannot queue entities for deletion while world is being deleted");
+
+    if (!entity) {
+        flecs_delete_queue_roots(world);
+    } else if (ecs_is_alive(world, entity)) {
+        flecs_delete_queue_push(world, entity);
+    }
+
+    world->info.delete_queue_count = flecs_delete_queue_count(world);
+error:
+    return;
+}
+
+int32_t ecs_delete_incremental_run(
+    ecs_world_t *world,
+    double time_budget_seconds)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(!ecs_is_deferred(world), ECS_INVALID_OPERATION,
+        "cannot run incremental delete while world is deferred");
+
+    ecs_delete_queue_t *q = &world->delete_queue;
+    ecs_time_t start = {0}, cur = {0};
+    bool time_budget = false;
+
+    if (ECS_NEQZERO(time_budget_seconds)) {
+        ecs_time_measure(&start);
+        time_budget = true;
+    }
+
+    do {
+        int32_t leaf_count = ecs_vec_count(&q->leaves);
+        if (leaf_count) {
+            /* Copy batch, as observers could queue more entities */
+            ecs_entity_t batch[FLECS_DELETE_QUEUE_BATCH];
+            int32_t count = leaf_count;
+            if (count > FLECS_DELETE_QUEUE_BATCH) {
+                count = FLECS_DELETE_QUEUE_BATCH;
+            }
+
+            ecs_entity_t *leaves = ecs_vec_first_t(&q->leaves, ecs_entity_t);
+            ecs_os_memcpy_n(batch, &leaves[leaf_count - count], 
+                ecs_entity_t, count);
+            ecs_vec_set_count_t(NULL, &q->leaves, ecs_entity_t, 
+                leaf_count - count);
+            ecs_delete_many(world, count, batch);
+        } else if (ecs_vec_count(&q->stack)) {
+            ecs_delete_queue_elem_t *elem = ecs_vec_last_t(
+                &q->stack, ecs_delete_queue_elem_t);
+            ecs_entity_t entity = elem->entity;
+            if (!elem->expanded && ecs_is_alive(world, entity)) {
+                /* Delete children first. Children are pushed on top of the
+                 * entity, so it's deleted once they're gone. */
+                elem->expanded = true;
+                flecs_delete_queue_expand(world, entity);
+            } else {
+                ecs_vec_remove_last(&q->stack);
+                ecs_delete(world, entity);
+            }
+        } else {
+            break;
+        }
+
+        if (time_budget) {
+            cur = start;
+            if (ecs_time_measure(&cur) > time_budget_seconds) {
+                break;
+            }
+        }
+    } while (true);
+
+    world->info.delete_queue_count = flecs_delete_queue_count(world);
+    return world->info.delete_queue_count;
+error:
+    return 0;
+}
+
+void ecs_enable_parallel_delete(
+    ecs_world_t *world,
+    bool enable)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ECS_BIT_COND(world->flags, EcsWorldParallelDelete, enable);
+}
+
 void ecs_remove_all(
     ecs_world_t *world,
     ecs_id_t id)
@@ -511,6 +511,10 @@ bool ecs_os_has_task_support(void) {
         (ecs_os_api.task_join_ != NULL);
 }
 
+bool ecs_os_has_parallel_for(void) {
+    return ecs_os_api.parallel_for_ != NULL;
+}
+
 bool ecs_os_has_time(void) {
     return 
         (ecs_os_api.get_time_ != NULL) &&
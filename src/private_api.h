@@ -26,6 +26,7 @@
 #include "storage/table.h"
 #include "storage/sparse_storage.h"
 #include "storage/ordered_children.h"
+#include "storage/union_index.h"
 #include "query/query.h"
 #include "component_actions.h"
 #include "entity_name.h"
@@ -135,6 +136,21 @@ uint64_t flecs_ito_(
 //// Utilities
 ////////////////////////////////////////////////////////////////////////////////
 
+/* Hint that memory will be read soon. */
+#if defined(__GNUC__) || defined(__clang__)
+#define flecs_prefetch(ptr) __builtin_prefetch(ptr)
+#else
+#define flecs_prefetch(ptr) (void)(ptr)
+#endif
+
+/* Index of lowest set bit in value. Value must not be 0. */
+#if defined(__GNUC__) || defined(__clang__)
+#define flecs_ctz64(value) ((int32_t)__builtin_ctzll(value))
+#else
+int32_t flecs_ctz64(
+    uint64_t value);
+#endif
+
 /* Generate 64bit hash from buffer. */
 uint64_t flecs_hash(
     const void *data,
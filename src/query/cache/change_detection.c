@@ -453,6 +453,7 @@ void flecs_query_mark_fields_dirty(
 
         ecs_entity_t src = it->sources[i];
         ecs_table_t *table;
+        int32_t row = it->offset, count = it->count;
         if (!src) {
             table = it->table;
         } else {
@@ -461,6 +462,9 @@ void flecs_query_mark_fields_dirty(
                 continue;
             }
 
+            row = ECS_RECORD_TO_ROW(r->row);
+            count = 1;
+
             if (q->shared_readonly_fields & flecs_ito(uint32_t, 1 << i)) {
                 /* Shared fields that aren't marked explicitly as out/inout 
                  * default to readonly */
@@ -477,6 +481,10 @@ void flecs_query_mark_fields_dirty(
         ecs_assert(type_index >= 0, ECS_INTERNAL_ERROR, NULL);
         
         ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
+        if ((table->flags & EcsTableHasDirtyRows) && (tr->column != -1)) {
+            flecs_table_mark_rows_dirty(world, table, tr->column, row, count);
+        }
+
         int32_t *dirty_state = table->dirty_state;
         if (!dirty_state) {
             continue;
@@ -516,6 +524,12 @@ void flecs_query_mark_fixed_fields_dirty(
             continue;
         }
 
+        const ecs_table_record_t *tr = it->trs[i];
+        if ((table->flags & EcsTableHasDirtyRows) && tr && tr->column != -1) {
+            flecs_table_mark_rows_dirty(world, table, tr->column, 
+                ECS_RECORD_TO_ROW(r->row), 1);
+        }
+
         int32_t *dirty_state = table->dirty_state;
         if (!dirty_state) {
             continue;
@@ -658,6 +672,164 @@ error:
     return false;
 }
 
+/* Get changed rows for iterator field. Returns NULL if field doesn't track
+ * changed rows. */
+static
+ecs_table_dirty_rows_t* flecs_iter_get_dirty_rows(
+    const ecs_iter_t *it,
+    int8_t index,
+    int32_t *row_out)
+{
+    const ecs_table_record_t *tr = it->trs[index];
+    if (!tr || tr->column == -1) {
+        return NULL; /* Not stored in table column */
+    }
+
+    ecs_table_t *table = it->table;
+    int32_t row = it->offset;
+    ecs_entity_t src = it->sources[index];
+    if (src) {
+        ecs_record_t *r = flecs_entities_get(it->real_world, src);
+        if (!r || !(table = r->table)) {
+            return NULL;
+        }
+        row = ECS_RECORD_TO_ROW(r->row);
+    }
+
+    if (!table) {
+        return NULL;
+    }
+
+    *row_out = row;
+    return flecs_table_get_dirty_rows(table, tr->column);
+}
+
+static
+bool flecs_dirty_rows_get(
+    const ecs_table_dirty_rows_t *dr,
+    int32_t row)
+{
+    int32_t word = row >> 6;
+    if (word >= ecs_vec_count(&dr->bits)) {
+        return false;
+    }
+    const uint64_t *words = ecs_vec_first(&dr->bits);
+    return (words[word] >> (row & 63)) & 1;
+}
+
+/* Public API call to find changed rows in the currently iterated result. */
+bool ecs_iter_changed_rows(
+    const ecs_iter_t *it,
+    int8_t index,
+    int32_t *offset,
+    int32_t *count)
+{
+    ecs_check(it != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(offset != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(count != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(ECS_BIT_IS_SET(it->flags, EcsIterIsValid), 
+        ECS_INVALID_PARAMETER, NULL);
+    ecs_check(index >= 0 && index < it->field_count, 
+        ECS_INVALID_PARAMETER, NULL);
+
+    int32_t start = *offset, end = it->count;
+    if (start >= end) {
+        return false;
+    }
+
+    if (!ecs_field_is_set(it, index)) {
+        return false;
+    }
+
+    int32_t row = 0;
+    const ecs_table_dirty_rows_t *dr = flecs_iter_get_dirty_rows(
+        it, index, &row);
+    if (!dr) {
+        /* Component doesn't track rows, report all rows as changed */
+        *count = end - start;
+        return true;
+    }
+
+    if (it->sources[index]) {
+        /* Shared component, all entities changed if source changed */
+        if (!flecs_dirty_rows_get(dr, row)) {
+            return false;
+        }
+        *count = end - start;
+        return true;
+    }
+
+    /* Find first changed row. Skip words without changed rows. */
+    const uint64_t *words = ecs_vec_first(&dr->bits);
+    int32_t word_count = ecs_vec_count(&dr->bits);
+    int32_t cur = row + start, last = row + end;
+    while (cur < last) {
+        int32_t word = cur >> 6;
+        if (word >= word_count) {
+            return false;
+        }
+        if (!(words[word] >> (cur & 63))) {
+            cur = (word + 1) << 6;
+            continue;
+        }
+        if ((words[word] >> (cur & 63)) & 1) {
+            break;
+        }
+        cur ++;
+    }
+
+    if (cur >= last) {
+        return false;
+    }
+
+    /* Find end of range */
+    int32_t range_end = cur + 1;
+    while (range_end < last && flecs_dirty_rows_get(dr, range_end)) {
+        range_end ++;
+    }
+
+    *offset = cur - row;
+    *count = range_end - cur;
+    return true;
+error:
+    return false;
+}
+
+/* Public API call to acknowledge changed rows in the current result. */
+void ecs_iter_clear_changed_rows(
+    const ecs_iter_t *it,
+    int8_t index)
+{
+    ecs_check(it != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(ECS_BIT_IS_SET(it->flags, EcsIterIsValid), 
+        ECS_INVALID_PARAMETER, NULL);
+    ecs_check(index >= 0 && index < it->field_count, 
+        ECS_INVALID_PARAMETER, NULL);
+
+    if (it->sources[index] || !ecs_field_is_set(it, index)) {
+        return;
+    }
+
+    int32_t row = 0;
+    ecs_table_dirty_rows_t *dr = flecs_iter_get_dirty_rows(it, index, &row);
+    if (!dr) {
+        return;
+    }
+
+    uint64_t *words = ecs_vec_first(&dr->bits);
+    int32_t word_count = ecs_vec_count(&dr->bits);
+    int32_t cur = row, last = ECS_MIN(row + it->count, word_count * 64);
+    while (cur < last) {
+        int32_t bit = cur & 63;
+        int32_t n = ECS_MIN(64 - bit, last - cur);
+        uint64_t mask = n == 64 ? UINT64_MAX : (((1llu << n) - 1) << bit);
+        words[cur >> 6] &= ~mask;
+        cur += n;
+    }
+error:
+    return;
+}
+
 /* Public API call for skipping change detection (don't mark fields dirty) */
 void ecs_iter_skip(
     ecs_iter_t *it)
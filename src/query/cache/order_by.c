@@ -304,7 +304,9 @@ void flecs_query_cache_sort_tables(
 
             /* Something has changed, sort the table. Prefers using 
             * flecs_query_cache_sort_table when available */
+            ecs_os_perf_trace_push("flecs.query.sort");
             flecs_query_cache_sort_table(world, table, column, compare, sort);
+            ecs_os_perf_trace_pop("flecs.query.sort");
             tables_sorted = true;
         }
     } while ((cur = cur->next)); /* Next group */
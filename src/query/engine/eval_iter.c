@@ -145,7 +145,8 @@ void flecs_query_self_change_detection(
     ecs_query_iter_t *qit,
     ecs_query_impl_t *impl)
 {
-    if (!it->table->dirty_state) {
+    ecs_table_t *table = it->table;
+    if (!table->dirty_state && !(table->flags & EcsTableHasDirtyRows)) {
         return;
     }
 
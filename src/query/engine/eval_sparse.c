@@ -5,6 +5,11 @@
 
 #include "../../private_api.h"
 
+/* When a sparse set has this many times fewer elements than the number of rows
+ * in a table range, entities in the range are found by iterating the sparse 
+ * set instead of testing each row of the range. */
+#define FLECS_QUERY_SPARSE_DENSE_RATIO (16)
+
 static
 bool flecs_query_sparse_init_sparse(
     ecs_query_sparse_ctx_t *op_ctx,
@@ -45,6 +50,87 @@ void flecs_query_sparse_init_range(
 
     op_ctx->range = range;
     op_ctx->cur = range.offset - 1; 
+    op_ctx->dense_cur = 0;
+    op_ctx->dense = false;
+}
+
+/* Can consecutive rows be returned as a single result */
+static
+bool flecs_query_sparse_can_batch(
+    const ecs_query_op_t *op,
+    const ecs_query_run_ctx_t *ctx)
+{
+    if (!(op->flags & (EcsQueryIsVar << EcsQuerySrc))) {
+        return false;
+    }
+
+    return ctx->query_vars[op->src.var].kind == EcsVarTable;
+}
+
+/* Find entities in range by iterating the dense array of the sparse set. 
+ * Entities that are stored in consecutive rows of the range are returned as a
+ * single result. */
+static
+bool flecs_query_sparse_next_dense(
+    const ecs_query_op_t *op,
+    const ecs_query_run_ctx_t *ctx,
+    ecs_query_sparse_ctx_t *op_ctx,
+    void **ptr_out)
+{
+    ecs_table_t *table = op_ctx->range.table;
+    int32_t offset = op_ctx->range.offset;
+    int32_t end = op_ctx->range.count + offset;
+    int32_t count = flecs_sparse_count(op_ctx->sparse);
+    const uint64_t *ids = flecs_sparse_ids(op_ctx->sparse);
+
+    ecs_assert(op_ctx->dense_cur <= count, ECS_INVALID_OPERATION, 
+        "sparse iterator invalidated while iterating");
+
+    for (; op_ctx->dense_cur < count; op_ctx->dense_cur ++) {
+        ecs_record_t *r = flecs_entities_get(
+            ctx->world, ids[op_ctx->dense_cur]);
+        if (r->table != table) {
+            continue;
+        }
+
+        int32_t row = ECS_RECORD_TO_ROW(r->row);
+        if (row < offset || row >= end) {
+            continue;
+        }
+
+        int32_t row_count = 1;
+        op_ctx->dense_cur ++;
+
+        if (ptr_out) {
+            *ptr_out = flecs_sparse_get_dense(
+                op_ctx->sparse, 0, op_ctx->dense_cur - 1);
+        } else {
+            /* Add entities in next rows to the result */
+            for (; op_ctx->dense_cur < count; op_ctx->dense_cur ++) {
+                r = flecs_entities_get(ctx->world, ids[op_ctx->dense_cur]);
+                if (r->table != table) {
+                    break;
+                }
+
+                int32_t next_row = ECS_RECORD_TO_ROW(r->row);
+                if (next_row != (row + row_count) || next_row >= end) {
+                    break;
+                }
+
+                row_count ++;
+            }
+        }
+
+        flecs_query_var_narrow_range(
+            op->src.var, table, row, row_count, ctx);
+
+        return true;
+    }
+
+    flecs_query_var_narrow_range(op->src.var, table, 
+        op_ctx->range.offset, op_ctx->range.count, ctx);
+
+    return false;
 }
 
 static
@@ -55,6 +141,10 @@ bool flecs_query_sparse_next_entity(
     bool not,
     void **ptr_out)
 {
+    if (op_ctx->dense) {
+        return flecs_query_sparse_next_dense(op, ctx, op_ctx, ptr_out);
+    }
+
     int32_t end = op_ctx->range.count + op_ctx->range.offset;
 
 next:
@@ -68,7 +158,8 @@ next:
         return false;
     }
 
-    ecs_entity_t e = ecs_table_entities(op_ctx->range.table)[op_ctx->cur];
+    const ecs_entity_t *entities = ecs_table_entities(op_ctx->range.table);
+    ecs_entity_t e = entities[op_ctx->cur];
     bool result;
 
     if (ptr_out) {
@@ -88,8 +179,29 @@ next:
     }
 
     if (op->flags & (EcsQueryIsVar << EcsQuerySrc)) {
+        int32_t row = op_ctx->cur, count = 1;
+
+        /* Add next rows with the same result, unless a pointer to the 
+         * component is returned, which can be different for each row. */
+        if (!ptr_out && flecs_query_sparse_can_batch(op, ctx)) {
+            while ((row + count) < end) {
+                e = entities[row + count];
+                if (flecs_sparse_has(op_ctx->sparse, e) == not) {
+                    break;
+                }
+                count ++;
+            }
+
+            op_ctx->cur += count - 1;
+
+            /* Row after the batch doesn't match, skip it in next call */
+            if ((row + count) < end) {
+                op_ctx->cur ++;
+            }
+        }
+
         flecs_query_var_narrow_range(op->src.var, op_ctx->range.table, 
-            op_ctx->cur, 1, ctx);
+            row, count, ctx);
     }
 
     return true;
@@ -123,13 +235,30 @@ next:
     ecs_assert(op_ctx->cur < flecs_sparse_count(op_ctx->sparse), 
         ECS_INVALID_OPERATION, "sparse iterator invalidated while iterating");
 
-    ecs_entity_t e = flecs_sparse_ids(op_ctx->sparse)[op_ctx->cur];
-    ecs_table_range_t range = flecs_range_from_entity(e, ctx);
+    const uint64_t *ids = flecs_sparse_ids(op_ctx->sparse);
+    ecs_table_range_t range = flecs_range_from_entity(ids[op_ctx->cur], ctx);
 
     if (flecs_query_table_filter(range.table, op->other, table_mask)) {
         goto next;
     }
 
+    /* Entities are iterated back to front. If the previous entities are 
+     * stored in the rows before the current entity, add them to the result. */
+    while (op_ctx->cur) {
+        ecs_record_t *r = flecs_entities_get(ctx->world, ids[op_ctx->cur - 1]);
+        if (r->table != range.table) {
+            break;
+        }
+
+        if (ECS_RECORD_TO_ROW(r->row) != (range.offset - 1)) {
+            break;
+        }
+
+        range.offset --;
+        range.count ++;
+        op_ctx->cur --;
+    }
+
     flecs_query_var_set_range(op, op->src.var, 
         range.table, range.offset, range.count, ctx);
     flecs_query_set_vars(op, it->ids[field_index], ctx);
@@ -305,6 +434,14 @@ bool flecs_query_sparse_with_id(
         }
 
         flecs_query_sparse_init_range(op, ctx, op_ctx);
+
+        /* If the sparse set is much smaller than the range, it's cheaper to
+         * find the entities of the range in the sparse set. */
+        if (!not && flecs_query_sparse_can_batch(op, ctx)) {
+            int32_t sparse_count = flecs_sparse_count(op_ctx->sparse);
+            op_ctx->dense = (sparse_count * FLECS_QUERY_SPARSE_DENSE_RATIO) < 
+                op_ctx->range.count;
+        }
     }
 
     return flecs_query_sparse_next_entity(op, ctx, op_ctx, not, ptr_out);
@@ -5,24 +5,23 @@
 
 #include "../../private_api.h"
 
-typedef struct {
-    ecs_flags64_t mask;
-    bool has_bitset;
-} flecs_query_row_mask_t;
-
+/* Find the bitset columns for the toggle fields of a table. Returns false if
+ * a not field is set for a component that can't be toggled in the table, in
+ * which case no rows can match. */
 static
-flecs_query_row_mask_t flecs_query_get_row_mask(
+bool flecs_query_toggle_resolve(
     ecs_iter_t *it,
     ecs_table_t *table,
-    int32_t block_index,
     ecs_flags64_t and_fields,
     ecs_flags64_t not_fields,
     ecs_query_toggle_ctx_t *op_ctx)
 {
-    ecs_flags64_t mask = UINT64_MAX;
     int32_t i, field_count = it->field_count;
     ecs_flags64_t fields = and_fields | not_fields;
-    bool has_bitset = false;
+    int16_t bs_offset = table->_->bs_offset;
+
+    op_ctx->bs_count = 0;
+    op_ctx->bs_not = 0;
 
     for (i = 0; i < field_count; i ++) {
         uint64_t field_bit = 1llu << i;
@@ -38,29 +37,130 @@ flecs_query_row_mask_t flecs_query_get_row_mask(
             ecs_abort(ECS_INTERNAL_ERROR, NULL);
         }
 
-        ecs_id_t id = it->ids[i];
-        ecs_bitset_t *bs = flecs_table_get_toggle(table, id);
-        if (!bs) {
+        int32_t column = flecs_table_get_toggle_column(table, it->ids[i]);
+        if (column == -1) {
             if (not_fields & field_bit) {
                 if (op_ctx->prev_set_fields & field_bit) {
-                    has_bitset = false;
-                    break;
+                    return false;
                 }
             }
             continue;
         }
 
+        if (not_fields & field_bit) {
+            op_ctx->bs_not |= (ecs_termset_t)(1u << op_ctx->bs_count);
+        }
+
+        op_ctx->bs_columns[op_ctx->bs_count ++] = 
+            flecs_ito(int16_t, column - bs_offset);
+    }
+
+    return true;
+}
+
+/* Combine the bitsets of the toggle fields for a block of 64 rows. */
+static
+ecs_flags64_t flecs_query_toggle_block(
+    const ecs_table_t *table,
+    const ecs_query_toggle_ctx_t *op_ctx,
+    int32_t block_index)
+{
+    const ecs_bitset_t *bs_columns = table->_->bs_columns;
+    ecs_flags64_t mask = UINT64_MAX;
+    int32_t i, count = op_ctx->bs_count;
+
+    for (i = 0; i < count; i ++) {
+        const ecs_bitset_t *bs = &bs_columns[op_ctx->bs_columns[i]];
         ecs_assert((64 * block_index) < bs->size, ECS_INTERNAL_ERROR, NULL);
-        ecs_flags64_t block = bs->data[block_index];
 
-        if (not_fields & field_bit) {
-            block = ~block;
+        /* Invert block for not fields without branching */
+        ecs_flags64_t invert = 0 - (ecs_flags64_t)((op_ctx->bs_not >> i) & 1);
+        mask &= bs->data[block_index] ^ invert;
+    }
+
+    return mask;
+}
+
+/* Get the matching rows of a block in the [cur, last) range. */
+static
+ecs_flags64_t flecs_query_toggle_bits(
+    const ecs_table_t *table,
+    ecs_query_toggle_ctx_t *op_ctx,
+    int32_t block_index,
+    int32_t cur,
+    int32_t last)
+{
+    if (block_index != op_ctx->block_index) {
+        op_ctx->block = flecs_query_toggle_block(table, op_ctx, block_index);
+        op_ctx->block_index = block_index;
+    }
+
+    ecs_flags64_t bits = op_ctx->block;
+    int32_t block_first = block_index * 64;
+    if (cur > block_first) {
+        bits &= UINT64_MAX << (cur - block_first);
+    }
+    if ((last - block_first) < 64) {
+        bits &= (1llu << (last - block_first)) - 1;
+    }
+
+    return bits;
+}
+
+static
+void flecs_query_toggle_set_row_mask(
+    ecs_iter_t *it,
+    ecs_table_t *table,
+    int32_t offset,
+    ecs_flags64_t mask)
+{
+    ecs_query_iter_t *qit = &it->priv_.iter.query;
+    qit->row_mask = mask;
+    qit->row_mask_offset = offset;
+    qit->row_mask_table = table;
+}
+
+/* Return the rows of a range without bitset columns in blocks of 64 rows. In
+ * row mask mode results can't be larger than 64 rows, even if all rows match. */
+static
+bool flecs_query_toggle_mask_all(
+    const ecs_query_op_t *op,
+    bool redo,
+    ecs_query_run_ctx_t *ctx,
+    ecs_table_range_t range)
+{
+    ecs_iter_t *it = ctx->it;
+    ecs_query_toggle_ctx_t *op_ctx = flecs_op_ctx(ctx, toggle);
+    ecs_table_t *table = range.table;
+
+    if (!redo) {
+        if (!range.count) {
+            range.count = ecs_table_count(table);
+        }
+        op_ctx->range = range;
+        op_ctx->cur = range.offset;
+    }
+
+    int32_t last = op_ctx->range.offset + op_ctx->range.count;
+    int32_t row = op_ctx->cur;
+    if (row >= last) {
+        /* Restore range & set fields */
+        if (op->flags & (EcsQueryIsVar << EcsQuerySrc)) {
+            flecs_query_var_narrow_range(op->src.var, 
+                table, op_ctx->range.offset, op_ctx->range.count, ctx);
         }
-        mask &= block;
-        has_bitset = true;
+        it->set_fields = op_ctx->prev_set_fields;
+        return false;
     }
 
-    return (flecs_query_row_mask_t){ mask, has_bitset };
+    int32_t cur = ECS_MIN(last, row + 64);
+    if (op->flags & (EcsQueryIsVar << EcsQuerySrc)) {
+        flecs_query_var_narrow_range(op->src.var, table, row, cur - row, ctx);
+    }
+    flecs_query_toggle_set_row_mask(it, table, row, UINT64_MAX);
+    op_ctx->cur = cur;
+
+    return true;
 }
 
 static
@@ -103,7 +203,8 @@ bool flecs_query_toggle_cmp(
     bool redo,
     ecs_query_run_ctx_t *ctx,
     ecs_flags64_t and_fields,
-    ecs_flags64_t not_fields)
+    ecs_flags64_t not_fields,
+    bool row_mask)
 {
     ecs_iter_t *it = ctx->it;
     ecs_query_toggle_ctx_t *op_ctx = flecs_op_ctx(ctx, toggle);
@@ -139,6 +240,8 @@ bool flecs_query_toggle_cmp(
             /* If any of the toggle fields with a not operator are for fields
              * that are set, without a bitset those fields can't match. */
             return false;
+        } else if (row_mask) {
+            return flecs_query_toggle_mask_all(op, redo, ctx, range);
         } else {
             /* If table doesn't have toggles but query matched toggleable 
              * components, all entities match. */
@@ -157,108 +260,85 @@ bool flecs_query_toggle_cmp(
         }
     }
 
-    int32_t i, j;
-    int32_t first, last, block_index, cur;
-    uint64_t block = 0;
     if (!redo) {
         op_ctx->range = range;
-        cur = op_ctx->cur = range.offset;
-        block_index = op_ctx->block_index = -1;
-        first = range.offset;
-        last = range.offset + range.count;
-    } else {
-        if (!op_ctx->has_bitset) {
-            goto done;
-        }
-
-        last = op_ctx->range.offset + op_ctx->range.count;
-        cur = op_ctx->cur;
-        ecs_assert(cur <= last, ECS_INTERNAL_ERROR, NULL);
-        if (cur == last) {
-            goto done;
-        }
-
-        first = cur;
-        block_index = op_ctx->block_index;
-        block = op_ctx->block;
-    }
-
-    /* If end of last iteration is start of new block, compute new block */    
-    int32_t new_block_index = cur / 64, row = first;
-    if (new_block_index != block_index) {
-compute_block:
-        block_index = op_ctx->block_index = new_block_index;
-
-        flecs_query_row_mask_t row_mask = flecs_query_get_row_mask(
-            it, table, block_index, and_fields, not_fields, op_ctx);
+        op_ctx->cur = range.offset;
+        op_ctx->block_index = -1;
+        op_ctx->has_bitset = flecs_query_toggle_resolve(
+                it, table, and_fields, not_fields, op_ctx) && 
+            op_ctx->bs_count;
 
         /* If table doesn't have bitset columns, all columns match */
-        if (!(op_ctx->has_bitset = row_mask.has_bitset)) {
+        if (!op_ctx->has_bitset) {
             if (!not_fields) {
+                if (row_mask) {
+                    return flecs_query_toggle_mask_all(op, false, ctx, range);
+                }
                 return true;
             } else {
                 goto done;
             }
         }
-
-        /* No enabled bits */
-        block = row_mask.mask;
-        if (!block) {
-next_block:
-            new_block_index ++;
-            cur = new_block_index * 64;
-            if (cur >= last) {
-                /* No more rows */
-                goto done;
+    } else {
+        if (!op_ctx->has_bitset) {
+            if (row_mask && !not_fields) {
+                return flecs_query_toggle_mask_all(op, true, ctx, range);
             }
-
-            op_ctx->cur = cur;
-            goto compute_block;
+            goto done;
         }
-
-        op_ctx->block = block;
     }
 
-    /* Find first enabled bit (TODO: use faster bitmagic) */
-    int32_t first_bit = cur - (block_index * 64);
-    int32_t last_bit = ECS_MIN(64, last - (block_index * 64));
-    ecs_assert(first_bit >= 0, ECS_INTERNAL_ERROR, NULL);
-    ecs_assert(first_bit < 64, ECS_INTERNAL_ERROR, NULL);
-    ecs_assert(last_bit >= 0, ECS_INTERNAL_ERROR, NULL);
-    ecs_assert(last_bit <= 64, ECS_INTERNAL_ERROR, NULL);
-    ecs_assert(last_bit >= first_bit, ECS_INTERNAL_ERROR, NULL);
-
-    for (i = first_bit; i < last_bit; i ++) {
-        uint64_t bit = (1ull << i);
-        bool cond = 0 != (block & bit);
-        if (cond) {
-            /* Find last enabled bit */
-            for (j = i; j < last_bit; j ++) {
-                bit = (1ull << j);
-                cond = !(block & bit);
-                if (cond) {
-                    break;
-                }
-            }
+    int32_t last = op_ctx->range.offset + op_ctx->range.count;
+    int32_t cur = op_ctx->cur, block_index = 0;
+    ecs_flags64_t bits = 0;
+    ecs_assert(cur <= last, ECS_INTERNAL_ERROR, NULL);
 
-            row = i + (block_index * 64);
-            cur = j + (block_index * 64);
+    /* Find first block with matching rows */
+    while (cur < last) {
+        block_index = cur / 64;
+        bits = flecs_query_toggle_bits(table, op_ctx, block_index, cur, last);
+        if (bits) {
             break;
         }
+        cur = (block_index + 1) * 64;
     }
 
-    if (i == last_bit) {
-        goto next_block;
+    if (!bits) {
+        goto done;
     }
 
-    ecs_assert(row >= first, ECS_INTERNAL_ERROR, NULL);
-    ecs_assert(cur <= last, ECS_INTERNAL_ERROR, NULL);
-    ecs_assert(cur >= first, ECS_INTERNAL_ERROR, NULL);
+    int32_t row = block_index * 64 + flecs_ctz64(bits);
 
-    if (!(cur - row)) {
-        goto done;
+    if (row_mask) {
+        /* Return the remaining rows of the block, and leave skipping the rows
+         * that don't match to the application. */
+        cur = ECS_MIN(last, (block_index + 1) * 64);
+        flecs_query_toggle_set_row_mask(it, table, row, bits >> (row % 64));
+    } else {
+        /* Find end of range, which can continue in the next blocks */
+        ecs_flags64_t unset = ~bits & (UINT64_MAX << (row % 64));
+        while (!unset) {
+            cur = (block_index + 1) * 64;
+            if (cur >= last) {
+                break;
+            }
+
+            block_index ++;
+            unset = ~flecs_query_toggle_bits(
+                table, op_ctx, block_index, cur, last);
+        }
+
+        if (unset) {
+            cur = block_index * 64 + flecs_ctz64(unset);
+        } else {
+            cur = last;
+        }
     }
 
+    ecs_assert(row >= op_ctx->range.offset, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(cur <= last, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(cur > row, ECS_INTERNAL_ERROR, NULL);
+
     if (op->flags & (EcsQueryIsVar << EcsQuerySrc)) {
         flecs_query_var_narrow_range(op->src.var, table, row, cur - row, ctx);
     }
@@ -290,9 +370,10 @@ bool flecs_query_toggle(
 
     ecs_flags64_t and_fields = op->first.entity;
     ecs_flags64_t not_fields = op->second.entity & op_ctx->prev_set_fields;
+    bool row_mask = (ctx->query->pub.flags & EcsQueryToggleMask) != 0;
 
     return flecs_query_toggle_cmp(
-        op, redo, ctx, and_fields, not_fields);
+        op, redo, ctx, and_fields, not_fields, row_mask);
 }
 
 bool flecs_query_toggle_option(
@@ -317,7 +398,7 @@ repeat: {}
     }
 
     bool result = flecs_query_toggle_cmp(
-        op, redo, ctx, and_fields, not_fields);
+        op, redo, ctx, and_fields, not_fields, false);
     if (!result) {
         if (!op_ctx->optional_not) {
             /* Run the not-branch of optional fields */
@@ -331,3 +412,37 @@ repeat: {}
     return result;
 }
 
+
+ecs_flags64_t ecs_iter_get_row_mask(
+    const ecs_iter_t *it)
+{
+    ecs_check(it != NULL, ECS_INVALID_PARAMETER, NULL);
+
+    ecs_flags64_t result = UINT64_MAX;
+    if (it->count < 64) {
+        result = (1llu << it->count) - 1;
+    }
+
+    /* Find query iterator, which can be chained by worker/page iterators */
+    const ecs_iter_t *qit_owner = it;
+    while (qit_owner->next != ecs_query_next) {
+        qit_owner = qit_owner->chain_it;
+        if (!qit_owner) {
+            return result;
+        }
+    }
+
+    const ecs_query_iter_t *qit = &qit_owner->priv_.iter.query;
+    if (qit->row_mask_table != it->table) {
+        return result;
+    }
+
+    int32_t shift = it->offset - qit->row_mask_offset;
+    if (shift < 0 || shift >= 64) {
+        return result;
+    }
+
+    return result & (qit->row_mask >> shift);
+error:
+    return 0;
+}
@@ -5,6 +5,16 @@
 
 #include "../../private_api.h"
 
+/* The union index is built lazily while evaluating queries, which is not safe
+ * when multiple threads are evaluating queries. */
+static
+bool flecs_query_union_use_index(
+    const ecs_query_run_ctx_t *ctx)
+{
+    return (ctx->world->flags & (EcsWorldUnionIndex|EcsWorldMultiThreaded)) ==
+        EcsWorldUnionIndex;
+}
+
 static
 bool flecs_query_union_with_wildcard(
     const ecs_query_op_t *op,
@@ -153,6 +163,78 @@ next_row:
     return true;
 }
 
+static
+bool flecs_query_union_with_tgt_w_index(
+    const ecs_query_op_t *op,
+    bool redo,
+    const ecs_query_run_ctx_t *ctx,
+    ecs_entity_t rel,
+    ecs_entity_t tgt)
+{
+    ecs_query_union_ctx_t *op_ctx = flecs_op_ctx(ctx, union_);
+    ecs_iter_t *it = ctx->it;
+    int8_t field_index = op->field_index;
+
+    ecs_table_range_t range;
+    ecs_table_t *table;
+    if (!redo) {
+        range = flecs_query_get_range(op, &op->src, EcsQuerySrc, ctx);
+        table = range.table;
+        if (!range.count) {
+            range.count = ecs_table_count(table);
+        }
+
+        op_ctx->range = range;
+        op_ctx->cr = flecs_components_get(ctx->world, ecs_pair(rel, EcsUnion));
+        if (!op_ctx->cr) {
+            return false;
+        }
+
+        /* Only build index for tables with the union relationship */
+        if (!flecs_component_get_table(op_ctx->cr, table)) {
+            return false;
+        }
+
+        op_ctx->ut = flecs_union_index_get(ctx->world, op_ctx->cr, table);
+        op_ctx->target = flecs_union_table_get_target(op_ctx->ut, tgt);
+        if (!op_ctx->target) {
+            return false;
+        }
+
+        flecs_union_target_seek(
+            op_ctx->target, range.offset, &op_ctx->word, &op_ctx->bit);
+    } else {
+        range = op_ctx->range;
+        table = range.table;
+    }
+
+    int32_t offset, count, end = range.offset + range.count;
+    if (!flecs_union_target_next_range(op_ctx->target, 
+        &op_ctx->word, &op_ctx->bit, &offset, &count) || offset >= end) 
+    {
+        /* Restore range */
+        if (op->flags & (EcsQueryIsVar << EcsQuerySrc)) {
+            flecs_query_var_narrow_range(op->src.var, table, 
+                op_ctx->range.offset, op_ctx->range.count, ctx);
+        }
+        return false;
+    }
+
+    if ((offset + count) > end) {
+        count = end - offset;
+    }
+
+    it->ids[field_index] = ecs_pair(rel, tgt);
+
+    if (op->flags & (EcsQueryIsVar << EcsQuerySrc)) {
+        flecs_query_var_narrow_range(op->src.var, table, offset, count, ctx);
+    }
+
+    flecs_query_set_vars(op, it->ids[field_index], ctx);
+
+    return true;
+}
+
 bool flecs_query_union_with(
     const ecs_query_op_t *op,
     bool redo,
@@ -165,11 +247,145 @@ bool flecs_query_union_with(
 
     if (tgt == EcsWildcard) {
         return flecs_query_union_with_wildcard(op, redo, ctx, rel, neq);
+    } else if (!neq && flecs_query_union_use_index(ctx)) {
+        return flecs_query_union_with_tgt_w_index(op, redo, ctx, rel, tgt);
     } else {
         return flecs_query_union_with_tgt(op, redo, ctx, rel, tgt, neq);
     }
 }
 
+/* Return next range of rows with target in table of the current union index
+ * iteration, or move on to the next table. */
+static
+bool flecs_query_union_index_next_range(
+    const ecs_query_op_t *op,
+    const ecs_query_run_ctx_t *ctx)
+{
+    ecs_query_union_ctx_t *op_ctx = flecs_op_ctx(ctx, union_);
+    int32_t offset, count;
+    if (!op_ctx->target || !flecs_union_target_next_range(
+        op_ctx->target, &op_ctx->word, &op_ctx->bit, &offset, &count))
+    {
+        return false;
+    }
+
+    flecs_query_var_set_range(op, op->src.var, 
+        op_ctx->range.table, offset, count, ctx);
+
+    return true;
+}
+
+/* Move to next table with union relationship and build its row index. */
+static
+bool flecs_query_union_index_next_table(
+    const ecs_query_run_ctx_t *ctx)
+{
+    ecs_query_union_ctx_t *op_ctx = flecs_op_ctx(ctx, union_);
+    const ecs_table_record_t *tr = flecs_table_cache_next(
+        &op_ctx->it, ecs_table_record_t);
+    if (!tr) {
+        return false;
+    }
+
+    ecs_table_t *table = tr->hdr.table;
+    op_ctx->range.table = table;
+    op_ctx->ut = flecs_union_index_get(ctx->world, op_ctx->cr, table);
+    op_ctx->target = NULL;
+    op_ctx->tgt_index = 0;
+    op_ctx->word = 0;
+    op_ctx->bit = 0;
+
+    return true;
+}
+
+static
+bool flecs_query_union_select_tgt_w_index(
+    const ecs_query_op_t *op,
+    bool redo,
+    const ecs_query_run_ctx_t *ctx,
+    ecs_entity_t rel,
+    ecs_entity_t tgt)
+{
+    ecs_query_union_ctx_t *op_ctx = flecs_op_ctx(ctx, union_);
+    ecs_iter_t *it = ctx->it;
+    int8_t field_index = op->field_index;
+
+    if (!redo) {
+        op_ctx->cr = flecs_components_get(ctx->world, ecs_pair(rel, EcsUnion));
+        if (!op_ctx->cr) {
+            return false;
+        }
+
+        if (!flecs_table_cache_iter(&op_ctx->cr->cache, &op_ctx->it)) {
+            return false;
+        }
+
+        op_ctx->target = NULL;
+    }
+
+    while (!flecs_query_union_index_next_range(op, ctx)) {
+        if (!flecs_query_union_index_next_table(ctx)) {
+            return false;
+        }
+
+        op_ctx->target = flecs_union_table_get_target(op_ctx->ut, tgt);
+    }
+
+    it->ids[field_index] = ecs_pair(rel, tgt);
+    flecs_query_set_vars(op, it->ids[field_index], ctx);
+
+    return true;
+}
+
+static
+bool flecs_query_union_select_wildcard_w_index(
+    const ecs_query_op_t *op,
+    bool redo,
+    const ecs_query_run_ctx_t *ctx,
+    ecs_entity_t rel)
+{
+    ecs_query_union_ctx_t *op_ctx = flecs_op_ctx(ctx, union_);
+    ecs_iter_t *it = ctx->it;
+    int8_t field_index = op->field_index;
+
+    if (!redo) {
+        op_ctx->cr = flecs_components_get(ctx->world, ecs_pair(rel, EcsUnion));
+        if (!op_ctx->cr) {
+            return false;
+        }
+
+        if (!flecs_table_cache_iter(&op_ctx->cr->cache, &op_ctx->it)) {
+            return false;
+        }
+
+        op_ctx->ut = NULL;
+        op_ctx->target = NULL;
+    }
+
+    while (!flecs_query_union_index_next_range(op, ctx)) {
+        /* Move to next target in table, or next table if all targets in the
+         * current table have been iterated. */
+        while (!op_ctx->ut || 
+            op_ctx->tgt_index == ecs_vec_count(&op_ctx->ut->targets)) 
+        {
+            if (!flecs_query_union_index_next_table(ctx)) {
+                return false;
+            }
+        }
+
+        op_ctx->target = ecs_vec_get_t(&op_ctx->ut->targets, 
+            ecs_union_target_t, op_ctx->tgt_index);
+        op_ctx->tgt_index ++;
+        op_ctx->word = 0;
+        op_ctx->bit = 0;
+    }
+
+    it->ids[field_index] = ecs_pair(rel, op_ctx->target->tgt);
+    flecs_query_set_vars(op, it->ids[field_index], ctx);
+
+    return true;
+}
+
 static
 bool flecs_query_union_select_tgt(
     const ecs_query_op_t *op,
@@ -267,6 +483,16 @@ bool flecs_query_union_select(
     ecs_entity_t rel = ECS_PAIR_FIRST(id);
     ecs_entity_t tgt = ecs_pair_second(ctx->world, id);
 
+    if (flecs_query_union_use_index(ctx)) {
+        if (tgt == EcsWildcard) {
+            return flecs_query_union_select_wildcard_w_index(
+                op, redo, ctx, rel);
+        } else {
+            return flecs_query_union_select_tgt_w_index(
+                op, redo, ctx, rel, tgt);
+        }
+    }
+
     if (tgt == EcsWildcard) {
         return flecs_query_union_select_wildcard(op, redo, ctx, rel);
     } else {
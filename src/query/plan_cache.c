@@ -0,0 +1,327 @@
+/**
+ * @file query/plan_cache.c
+ * @brief Cache for queries created from expressions.
+ *
+ * Applications like the REST API create queries from the same expressions
+ * over and over, which means parsing, validating and compiling the query each
+ * time. The plan cache keeps the most recently used queries around so that
+ * they can be reused for the same expression.
+ */
+
+#include "../private_api.h"
+
+/* Whitespace around these characters doesn't change the query */
+static
+bool flecs_query_plan_is_separator(
+    char ch)
+{
+    return ch == ',' || ch == '(' || ch == ')' || ch == '[' || ch == ']' ||
+        ch == '|' || ch == '\0';
+}
+
+/* Normalize expression so that expressions that only differ in whitespace
+ * share the same plan. Returns the length of the normalized expression. */
+static
+ecs_size_t flecs_query_plan_normalize(
+    const char *expr,
+    char *out)
+{
+    const char *ptr = expr;
+    char *cur = out;
+    char quote = 0;
+
+    while (isspace((unsigned char)*ptr)) {
+        ptr ++;
+    }
+
+    for (; *ptr; ptr ++) {
+        char ch = *ptr;
+        if (quote) {
+            if (ch == '\\' && ptr[1]) {
+                *(cur ++) = ch;
+                ch = *(++ ptr);
+            } else if (ch == quote) {
+                quote = 0;
+            }
+            *(cur ++) = ch;
+            continue;
+        }
+
+        if (ch == '"' || ch == '\'') {
+            quote = ch;
+        } else if (isspace((unsigned char)ch)) {
+            const char *next = ptr + 1;
+            while (isspace((unsigned char)*next)) {
+                next ++;
+            }
+
+            char prev = cur != out ? cur[-1] : '\0';
+            ptr = next - 1;
+            if (!flecs_query_plan_is_separator(prev) &&
+                !flecs_query_plan_is_separator(*next))
+            {
+                *(cur ++) = ' ';
+            }
+            continue;
+        }
+
+        *(cur ++) = ch;
+    }
+
+    *cur = '\0';
+    return flecs_ito(ecs_size_t, cur - out);
+}
+
+static
+void flecs_query_plan_unlink(
+    ecs_query_plan_cache_t *cache,
+    ecs_query_plan_t *plan)
+{
+    if (plan->prev) {
+        plan->prev->next = plan->next;
+    } else {
+        cache->first = plan->next;
+    }
+
+    if (plan->next) {
+        plan->next->prev = plan->prev;
+    } else {
+        cache->last = plan->prev;
+    }
+
+    plan->prev = NULL;
+    plan->next = NULL;
+}
+
+static
+void flecs_query_plan_link_first(
+    ecs_query_plan_cache_t *cache,
+    ecs_query_plan_t *plan)
+{
+    plan->next = cache->first;
+    if (cache->first) {
+        cache->first->prev = plan;
+    } else {
+        cache->last = plan;
+    }
+    cache->first = plan;
+}
+
+static
+void flecs_query_plan_free(
+    ecs_world_t *world,
+    ecs_query_plan_t *plan)
+{
+    ecs_query_plan_cache_t *cache = &world->query_plans;
+    flecs_query_plan_unlink(cache, plan);
+    ecs_map_remove(&cache->index, plan->hash);
+    cache->count --;
+
+    ecs_query_fini(plan->query);
+    flecs_free_n(&world->allocator, char, plan->expr_len + 1, plan->expr);
+    flecs_free_t(&world->allocator, ecs_query_plan_t, plan);
+}
+
+static
+bool flecs_query_plan_ref_is(
+    const ecs_term_ref_t *ref,
+    uint32_t entity)
+{
+    return (ref->id & EcsIsEntity) &&
+        ((uint32_t)ECS_TERM_REF_ID(ref) == entity);
+}
+
+/* Test if query uses entity as component, relationship, target or source */
+static
+bool flecs_query_plan_has_ref(
+    const ecs_query_t *q,
+    ecs_entity_t entity)
+{
+    uint32_t e = (uint32_t)entity;
+    int32_t i, count = q->term_count;
+    for (i = 0; i < count; i ++) {
+        const ecs_term_t *term = &q->terms[i];
+        ecs_id_t id = term->id;
+        if (ECS_IS_PAIR(id)) {
+            if (ECS_PAIR_FIRST(id) == e || ECS_PAIR_SECOND(id) == e) {
+                return true;
+            }
+        } else if ((uint32_t)id == e) {
+            return true;
+        }
+
+        if (flecs_query_plan_ref_is(&term->first, e) ||
+            flecs_query_plan_ref_is(&term->second, e) ||
+            flecs_query_plan_ref_is(&term->src, e) ||
+            (uint32_t)term->trav == e)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Test if entities that were resolved when the query was created are alive */
+static
+bool flecs_query_plan_is_valid(
+    const ecs_world_t *world,
+    const ecs_query_t *q)
+{
+    int32_t i, count = q->term_count;
+    for (i = 0; i < count; i ++) {
+        const ecs_term_t *term = &q->terms[i];
+        const ecs_term_ref_t *refs[] = { &term->first, &term->second, &term->src };
+        int32_t r;
+        for (r = 0; r < 3; r ++) {
+            const ecs_term_ref_t *ref = refs[r];
+            if (!(ref->id & EcsIsEntity)) {
+                continue;
+            }
+
+            ecs_entity_t e = ECS_TERM_REF_ID(ref);
+            if (e && !ecs_is_alive(world, e)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/* Cached queries must not prevent deleting the ids they use, as ids can also
+ * be deleted when a parent or relationship target is deleted. Instead of
+ * keeping ids alive, a cached query is validated before it is returned. */
+static
+void flecs_query_plan_release_ids(
+    ecs_world_t *world,
+    ecs_query_t *q)
+{
+    int32_t i, count = q->term_count;
+    for (i = 0; i < count; i ++) {
+        ecs_term_t *term = &q->terms[i];
+        if (!(term->flags_ & EcsTermKeepAlive)) {
+            continue;
+        }
+
+        ecs_component_record_t *cr = flecs_components_get(world, term->id);
+        if (cr) {
+            if (ecs_os_has_threading()) {
+                int32_t cr_keep_alive = ecs_os_adec(&cr->keep_alive);
+                ecs_assert(cr_keep_alive >= 0, ECS_INTERNAL_ERROR, NULL);
+                (void)cr_keep_alive;
+            } else {
+                cr->keep_alive --;
+                ecs_assert(cr->keep_alive >= 0, ECS_INTERNAL_ERROR, NULL);
+            }
+        }
+
+        term->flags_ &= (ecs_flags16_t)~EcsTermKeepAlive;
+    }
+}
+
+void flecs_query_plan_cache_on_delete(
+    ecs_world_t *world,
+    ecs_entity_t entity)
+{
+    ecs_query_plan_cache_t *cache = &world->query_plans;
+    ecs_query_plan_t *plan = cache->first;
+    while (plan) {
+        ecs_query_plan_t *next = plan->next;
+        if (flecs_query_plan_has_ref(plan->query, entity)) {
+            flecs_query_plan_free(world, plan);
+        }
+        plan = next;
+    }
+}
+
+void flecs_query_plan_cache_fini(
+    ecs_world_t *world)
+{
+    ecs_query_plan_cache_clear(world);
+    ecs_map_fini(&world->query_plans.index);
+}
+
+ecs_query_t* ecs_query_plan_cache_get(
+    ecs_world_t *world,
+    const char *expr)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(expr != NULL, ECS_INVALID_PARAMETER, NULL);
+    ecs_check(!(world->flags & EcsWorldMultiThreaded),
+        ECS_INVALID_OPERATION,
+            "cannot use query plan cache while running on multiple threads");
+
+    ecs_query_plan_cache_t *cache = &world->query_plans;
+    ecs_map_init_if(&cache->index, &world->allocator);
+
+    /* Normalized expression can't be longer than the input */
+    char small_buf[256];
+    ecs_size_t expr_len = ecs_os_strlen(expr);
+    char *buf = small_buf;
+    if (expr_len >= ECS_SIZEOF(small_buf)) {
+        buf = ecs_os_malloc(expr_len + 1);
+    }
+
+    ecs_size_t len = flecs_query_plan_normalize(expr, buf);
+    ecs_entity_t scope = ecs_get_scope(world);
+    uint64_t hash = flecs_hash(buf, len) ^ scope;
+
+    ecs_query_plan_t *plan = ecs_map_get_deref(
+        &cache->index, ecs_query_plan_t, hash);
+    if (plan) {
+        if (plan->scope == scope && plan->expr_len == len &&
+            !ecs_os_memcmp(plan->expr, buf, len) &&
+            flecs_query_plan_is_valid(world, plan->query))
+        {
+            /* Cache hit, move plan to front of list */
+            flecs_query_plan_unlink(cache, plan);
+            flecs_query_plan_link_first(cache, plan);
+            goto done;
+        }
+
+        /* Hash collision or stale query */
+        flecs_query_plan_free(world, plan);
+    }
+
+    ecs_query_t *q = ecs_query(world, { .expr = buf });
+    if (!q) {
+        plan = NULL;
+        goto done;
+    }
+
+    flecs_query_plan_release_ids(world, q);
+
+    plan = flecs_calloc_t(&world->allocator, ecs_query_plan_t);
+    plan->query = q;
+    plan->expr = flecs_alloc_n(&world->allocator, char, len + 1);
+    ecs_os_memcpy(plan->expr, buf, len + 1);
+    plan->expr_len = len;
+    plan->hash = hash;
+    plan->scope = scope;
+    ecs_map_insert_ptr(&cache->index, hash, plan);
+    flecs_query_plan_link_first(cache, plan);
+    cache->count ++;
+
+    if (cache->count > FLECS_QUERY_PLAN_CACHE_SIZE) {
+        flecs_query_plan_free(world, cache->last);
+    }
+
+done:
+    if (buf != small_buf) {
+        ecs_os_free(buf);
+    }
+    return plan ? plan->query : NULL;
+error:
+    return NULL;
+}
+
+void ecs_query_plan_cache_clear(
+    ecs_world_t *world)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_query_plan_cache_t *cache = &world->query_plans;
+    while (cache->first) {
+        flecs_query_plan_free(world, cache->first);
+    }
+}
@@ -0,0 +1,37 @@
+/**
+ * @file query/plan_cache.h
+ * @brief Cache for queries created from expressions.
+ */
+
+#ifndef FLECS_QUERY_PLAN_CACHE_H
+#define FLECS_QUERY_PLAN_CACHE_H
+
+/* Compiled query for an expression */
+typedef struct ecs_query_plan_t {
+    ecs_query_t *query;
+    char *expr;                     /* Normalized expression */
+    ecs_size_t expr_len;
+    uint64_t hash;
+    ecs_entity_t scope;             /* Scope in which names were resolved */
+    struct ecs_query_plan_t *prev;  /* Previous (more recently used) plan */
+    struct ecs_query_plan_t *next;  /* Next (less recently used) plan */
+} ecs_query_plan_t;
+
+/* Least recently used cache of compiled expression queries */
+typedef struct ecs_query_plan_cache_t {
+    ecs_map_t index;                /* map<hash, ecs_query_plan_t*> */
+    ecs_query_plan_t *first;        /* Most recently used */
+    ecs_query_plan_t *last;         /* Least recently used */
+    int32_t count;
+} ecs_query_plan_cache_t;
+
+/* Free all cached queries */
+void flecs_query_plan_cache_fini(
+    ecs_world_t *world);
+
+/* Remove cached queries that reference a deleted entity */
+void flecs_query_plan_cache_on_delete(
+    ecs_world_t *world,
+    ecs_entity_t entity);
+
+#endif
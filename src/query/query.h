@@ -6,6 +6,7 @@
 #include "compiler/compiler.h"
 #include "cache/cache.h"
 #include "engine/engine.h"
+#include "plan_cache.h"
 #include "util.h"
 
 #ifdef FLECS_DEBUG
@@ -156,6 +156,14 @@ typedef struct {
     ecs_entity_t cur;
     ecs_entity_t tgt;
     int32_t row;
+
+    /* Union index iteration state */
+    ecs_table_cache_iter_t it;
+    const ecs_union_table_t *ut;
+    const ecs_union_target_t *target;
+    int32_t tgt_index;
+    int32_t word;
+    int32_t bit;
 } ecs_query_union_ctx_t;
 
 /* Sparse context */
@@ -165,6 +173,8 @@ typedef struct {
     ecs_sparse_t *sparse;
     ecs_table_range_t range;
     int32_t cur;
+    int32_t dense_cur;        /* Current element in dense array of sparse set */
+    bool dense;               /* Find entities in range with sparse set */
     bool self;
     bool exclusive;
 
@@ -313,6 +323,9 @@ typedef struct {
     int32_t block_index;
     ecs_flags64_t block;
     ecs_termset_t prev_set_fields;
+    ecs_termset_t bs_not;    /* Bitsets in bs_columns for not fields */
+    int16_t bs_count;        /* Number of bitsets in bs_columns */
+    int16_t bs_columns[FLECS_TERM_COUNT_MAX]; /* Bitset columns of fields */
     bool optional_not;
     bool has_bitset;
 } ecs_query_toggle_ctx_t;
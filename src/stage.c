@@ -43,6 +43,9 @@ void flecs_stage_merge(
             "mismatching defer_begin/defer_end detected");
         flecs_defer_end(world, stage);
     } else {
+        /* Add commands enqueued from threads without a stage */
+        flecs_async_queue_drain(world);
+
         /* Merge stages. Only merge if the stage has auto_merging turned on, or 
          * if this is a forced merge (like when ecs_merge is called) */
         int32_t i, count = ecs_get_stage_count(world);
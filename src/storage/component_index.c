@@ -238,6 +238,7 @@ void flecs_component_fini_sparse(
             flecs_wfree_t(world, ecs_sparse_t, cr->sparse);
         } else
         if (cr->flags & EcsIdIsUnion) {
+            flecs_union_index_fini(world, cr);
             flecs_switch_fini(cr->sparse);
             flecs_wfree_t(world, ecs_switch_t, cr->sparse);
         } else {
@@ -278,6 +279,8 @@ ecs_component_record_t* flecs_component_new(
     }
 
     ecs_table_cache_init(world, &cr->cache);
+    world->info.component_record_memory += 
+        ECS_SIZEOF(ecs_component_record_t);
 
     cr->id = id;
     cr->refcount = 1;
@@ -289,9 +292,7 @@ ecs_component_record_t* flecs_component_new(
     if (is_pair) {
         cr->pair = flecs_bcalloc_w_dbg_info(
             &world->allocators.pair_id_record, "ecs_pair_record_t");
-        cr->pair->reachable.current = -1;
-
-        flecs_ordered_children_init(world, cr);
+        world->info.component_record_memory += ECS_SIZEOF(ecs_pair_record_t);
 
         rel = ECS_PAIR_FIRST(id);
         rel = flecs_entities_get_alive(world, rel);
@@ -461,6 +462,7 @@ ecs_component_record_t* flecs_component_new(
         /* Check if we should keep a list of ordered children for parent */
         if (rel == EcsChildOf) {
             if (ecs_has_id(world, tgt, EcsOrderedChildren)) {
+                flecs_ordered_children_init(world, cr);
                 cr->flags |= EcsIdOrderedChildren;
             }
         }
@@ -583,15 +585,24 @@ void flecs_component_free(
     world->info.tag_id_count -= cr->type_info == NULL;
 
     /* Unregister the component record from the world & free resources */
-    ecs_table_cache_fini(&cr->cache);
+    ecs_table_cache_fini(world, &cr->cache);
 
     if (cr->pair) {
-        flecs_ordered_children_fini(world, cr);
+        ecs_pair_record_ext_t *ext = cr->pair->ext;
+        if (ext) {
+            ecs_assert(ext->union_index == NULL, ECS_INTERNAL_ERROR, NULL);
+            flecs_ordered_children_fini(world, cr);
+            ecs_vec_fini_t(&world->allocator, &ext->reachable.ids, 
+                ecs_reachable_elem_t);
+            flecs_free_t(&world->allocator, ecs_pair_record_ext_t, ext);
+            world->info.component_record_memory -= 
+                ECS_SIZEOF(ecs_pair_record_ext_t);
+        }
+
         flecs_name_index_free(cr->pair->name_index);
-        ecs_vec_fini_t(&world->allocator, &cr->pair->reachable.ids, 
-            ecs_reachable_elem_t);
         flecs_bfree_w_dbg_info(&world->allocators.pair_id_record, 
                 cr->pair, "ecs_pair_record_t");
+        world->info.component_record_memory -= ECS_SIZEOF(ecs_pair_record_t);
     }
 
     ecs_id_t hash = flecs_component_hash(id);
@@ -607,6 +618,8 @@ void flecs_component_free(
 
     flecs_bfree_w_dbg_info(&world->allocators.id_record, 
         cr, "ecs_component_record_t");
+    world->info.component_record_memory -= 
+        ECS_SIZEOF(ecs_component_record_t);
 
     if (ecs_should_log_1()) {
         char *id_str = ecs_id_str(world, id);
@@ -726,6 +739,25 @@ ecs_hashmap_t* flecs_component_name_index_ensure(
     return map;
 }
 
+ecs_pair_record_ext_t* flecs_pair_record_ext_ensure(
+    ecs_world_t *world,
+    ecs_component_record_t *cr)
+{
+    ecs_assert(cr->pair != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_pair_record_ext_t *ext = cr->pair->ext;
+    if (!ext) {
+        ext = cr->pair->ext = flecs_calloc_t(
+            &world->allocator, ecs_pair_record_ext_t);
+        ecs_vec_init_t(
+            &world->allocator, &ext->ordered_children, ecs_entity_t, 0);
+        ext->reachable.current = -1;
+        world->info.component_record_memory += 
+            ECS_SIZEOF(ecs_pair_record_ext_t);
+    }
+
+    return ext;
+}
+
 ecs_hashmap_t* flecs_component_name_index_get(
     const ecs_world_t *world,
     ecs_component_record_t *cr)
@@ -27,14 +27,25 @@ typedef struct ecs_reachable_cache_t {
     ecs_vec_t ids; /* vec<reachable_elem_t> */
 } ecs_reachable_cache_t;
 
+/* Component index data for pairs that is only used by a subset of the pair
+ * records. Worlds can have millions of pair records, so this data is stored
+ * separately and is only allocated for records that need it. */
+typedef struct ecs_pair_record_ext_t {
+    /* Vector with ordered children */
+    ecs_vec_t ordered_children;
+
+    /* Cache for finding components that are reachable through a relationship */
+    ecs_reachable_cache_t reachable;
+
+    /* Row index for union relationship, created on demand for (R, Union) */
+    struct ecs_union_index_t *union_index;
+} ecs_pair_record_ext_t;
+
 /* Component index data that just applies to pairs */
 typedef struct ecs_pair_record_t {
     /* Name lookup index (currently only used for ChildOf pairs) */
     ecs_hashmap_t *name_index;
 
-    /* Vector with ordered children */
-    ecs_vec_t ordered_children;
-
     /* Lists for all id records that match a pair wildcard. The wildcard id
      * record is at the head of the list. */
     ecs_id_record_elem_t first;   /* (R, *) */
@@ -44,8 +55,8 @@ typedef struct ecs_pair_record_t {
     /* Parent component record. For pair records the parent is the (R, *) record. */
     ecs_component_record_t *parent;
 
-    /* Cache for finding components that are reachable through a relationship */
-    ecs_reachable_cache_t reachable;
+    /* Ordered children, reachable cache & union index, created on demand */
+    ecs_pair_record_ext_t *ext;
 } ecs_pair_record_t;
 
 /* Payload for id index which contains all data structures for an id. */
@@ -141,6 +152,11 @@ ecs_hashmap_t* flecs_component_name_index_get(
     const ecs_world_t *world,
     ecs_component_record_t *cr);
 
+/* Ensure data for pair record that is created on demand */
+ecs_pair_record_ext_t* flecs_pair_record_ext_ensure(
+    ecs_world_t *world,
+    ecs_component_record_t *cr);
+
 /* Init sparse storage */
 void flecs_component_init_sparse(
     ecs_world_t *world,
@@ -1,5 +1,26 @@
 #include "../private_api.h"
 
+static
+ecs_entity_index_page_t* flecs_entity_index_page_new(
+    ecs_entity_index_t *index)
+{
+    void *alloc = flecs_bcalloc(&index->page_allocator);
+    ecs_assert(alloc != NULL, ECS_OUT_OF_MEMORY, NULL);
+    ecs_entity_index_page_t *page = (ecs_entity_index_page_t*)
+        (((uintptr_t)alloc + FLECS_ENTITY_PAGE_ALIGN - 1) & 
+            ~(uintptr_t)(FLECS_ENTITY_PAGE_ALIGN - 1));
+    page->alloc = alloc;
+    return page;
+}
+
+static
+void flecs_entity_index_page_free(
+    ecs_entity_index_t *index,
+    ecs_entity_index_page_t *page)
+{
+    flecs_bfree(&index->page_allocator, page->alloc);
+}
+
 static
 ecs_entity_index_page_t* flecs_entity_index_ensure_page(
     ecs_entity_index_t *index,
@@ -15,8 +36,7 @@ ecs_entity_index_page_t* flecs_entity_index_ensure_page(
         ecs_entity_index_page_t*, page_index);
     ecs_entity_index_page_t *page = *page_ptr;
     if (!page) {
-        page = *page_ptr = flecs_bcalloc(&index->page_allocator);
-        ecs_assert(page != NULL, ECS_OUT_OF_MEMORY, NULL);
+        page = *page_ptr = flecs_entity_index_page_new(index);
     }
 
     return page;
@@ -32,7 +52,7 @@ void flecs_entity_index_init(
     ecs_vec_set_count_t(allocator, &index->dense, uint64_t, 1);
     ecs_vec_init_t(allocator, &index->pages, ecs_entity_index_page_t*, 0);
     flecs_ballocator_init(&index->page_allocator,
-        ECS_SIZEOF(ecs_entity_index_page_t));
+        ECS_SIZEOF(ecs_entity_index_page_t) + FLECS_ENTITY_PAGE_ALIGN);
 }
 
 void flecs_entity_index_fini(
@@ -42,7 +62,9 @@ void flecs_entity_index_fini(
     int32_t i, count = ecs_vec_count(&index->pages);
     ecs_entity_index_page_t **pages = ecs_vec_first(&index->pages);
     for (i = 0; i < count; i ++) {
-        flecs_bfree(&index->page_allocator, pages[i]);
+        if (pages[i]) {
+            flecs_entity_index_page_free(index, pages[i]);
+        }
     }
     ecs_vec_fini_t(index->allocator, &index->pages, ecs_entity_index_page_t*);
     flecs_ballocator_fini(&index->page_allocator);
@@ -107,13 +129,35 @@ ecs_record_t* flecs_entity_index_try_get(
         if (r->dense >= index->alive_count) {
             return NULL;
         }
-        if (ecs_vec_get_t(&index->dense, uint64_t, r->dense)[0] != entity) {
+
+        /* The record stores a copy of the generation in the dense array, so 
+         * the check doesn't have to load another cache line. */
+        if (r->generation != (uint32_t)(entity >> 32)) {
             return NULL;
         }
+
+        ecs_assert(
+            ecs_vec_get_t(&index->dense, uint64_t, r->dense)[0] == entity,
+            ECS_INTERNAL_ERROR, NULL);
     }
     return r;
 }
 
+void flecs_entity_index_prefetch(
+    const ecs_entity_index_t *index,
+    uint64_t entity)
+{
+    uint32_t id = (uint32_t)entity;
+    int32_t page_index = (int32_t)(id >> FLECS_ENTITY_PAGE_BITS);
+    if (page_index < ecs_vec_count(&index->pages)) {
+        ecs_entity_index_page_t *page = ecs_vec_get_t(&index->pages,
+            ecs_entity_index_page_t*, page_index)[0];
+        if (page) {
+            flecs_prefetch(&page->records[id & FLECS_ENTITY_PAGE_MASK]);
+        }
+    }
+}
+
 ecs_record_t* flecs_entity_index_ensure(
     ecs_entity_index_t *index,
     uint64_t entity)
@@ -150,6 +194,7 @@ ecs_record_t* flecs_entity_index_ensure(
 
     r_swap->dense = dense;
     r->dense = index->alive_count;
+    r->generation = (uint32_t)(entity >> 32);
     ids[dense] = e_swap;
     ids[index->alive_count ++] = entity;
 
@@ -183,6 +228,7 @@ void flecs_entity_index_remove(
     r->dense = i_swap;
     ecs_vec_get_t(&index->dense, uint64_t, dense)[0] = e_swap;
     e_swap_ptr[0] = ECS_GENERATION_INC(entity);
+    r->generation = (uint32_t)(e_swap_ptr[0] >> 32);
     ecs_assert(!flecs_entity_index_is_alive(index, entity),
         ECS_INTERNAL_ERROR, NULL);
 }
@@ -194,6 +240,7 @@ void flecs_entity_index_make_alive(
     ecs_record_t *r = flecs_entity_index_try_get_any(index, entity);
     if (r) {
         ecs_vec_get_t(&index->dense, uint64_t, r->dense)[0] = entity;
+        r->generation = (uint32_t)(entity >> 32);
     }
 }
 
@@ -203,7 +250,10 @@ uint64_t flecs_entity_index_get_alive(
 {
     ecs_record_t *r = flecs_entity_index_try_get_any(index, entity);
     if (r) {
-        return ecs_vec_get_t(&index->dense, uint64_t, r->dense)[0];
+        ecs_assert(ecs_vec_get_t(&index->dense, uint64_t, r->dense)[0] ==
+            (((uint64_t)r->generation << 32) | (uint32_t)entity),
+                ECS_INTERNAL_ERROR, NULL);
+        return ((uint64_t)r->generation << 32) | (uint32_t)entity;
     } else {
         return 0;
     }
@@ -341,7 +391,8 @@ void flecs_entity_index_clear(
     for (i = 0; i < count; i ++) {
         ecs_entity_index_page_t *page = pages[i];
         if (page) {
-            ecs_os_zeromem(page);
+            ecs_os_memset_n(page->records, 0, ecs_record_t, 
+                FLECS_ENTITY_PAGE_SIZE);
         }
     }
 
@@ -386,7 +437,7 @@ void flecs_entity_index_shrink(
         }
 
         if (!has_alive) {
-            flecs_bfree(&index->page_allocator, page);
+            flecs_entity_index_page_free(index, page);
             pages[i] = NULL;
         } else {
             max_page_index = i;
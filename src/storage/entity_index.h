@@ -11,8 +11,12 @@
 #define FLECS_ENTITY_PAGE_SIZE (1 << FLECS_ENTITY_PAGE_BITS)
 #define FLECS_ENTITY_PAGE_MASK (FLECS_ENTITY_PAGE_SIZE - 1)
 
+/* Pages are aligned to a cache line so that records don't straddle lines */
+#define FLECS_ENTITY_PAGE_ALIGN (64)
+
 typedef struct ecs_entity_index_page_t {
     ecs_record_t records[FLECS_ENTITY_PAGE_SIZE];
+    void *alloc;                     /* Unaligned allocation of page */
 } ecs_entity_index_page_t;
 
 typedef struct ecs_entity_index_t {
@@ -53,6 +57,11 @@ ecs_record_t* flecs_entity_index_try_get_any(
     const ecs_entity_index_t *index,
     uint64_t entity);
 
+/* Prefetch record of entity (may not exist/may not be alive) */
+void flecs_entity_index_prefetch(
+    const ecs_entity_index_t *index,
+    uint64_t entity);
+
 /** Ensure entity exists. */
 ecs_record_t* flecs_entity_index_ensure(
     ecs_entity_index_t *index,
@@ -132,6 +141,7 @@ const uint64_t* flecs_entity_index_ids(
 #define flecs_entities_get(world, entity) flecs_entity_index_get(ecs_eis(world), entity)
 #define flecs_entities_try(world, entity) flecs_entity_index_try_get(ecs_eis(world), entity)
 #define flecs_entities_get_any(world, entity) flecs_entity_index_get_any(ecs_eis(world), entity)
+#define flecs_entities_prefetch(world, entity) flecs_entity_index_prefetch(ecs_eis(world), entity)
 #define flecs_entities_ensure(world, entity) flecs_entity_index_ensure(ecs_eis(world), entity)
 #define flecs_entities_remove(world, entity) flecs_entity_index_remove(ecs_eis(world), entity)
 #define flecs_entities_make_alive(world, entity) flecs_entity_index_make_alive(ecs_eis(world), entity)
@@ -4,8 +4,7 @@ void flecs_ordered_children_init(
     ecs_world_t *world,
     ecs_component_record_t *cr)
 {
-    ecs_vec_init_t(
-        &world->allocator, &cr->pair->ordered_children, ecs_entity_t, 0);
+    flecs_pair_record_ext_ensure(world, cr);
 }
 
 void flecs_ordered_children_fini(
@@ -13,14 +12,16 @@ void flecs_ordered_children_fini(
     ecs_component_record_t *cr)
 {
     ecs_vec_fini_t(
-        &world->allocator, &cr->pair->ordered_children, ecs_entity_t);
+        &world->allocator, &cr->pair->ext->ordered_children, ecs_entity_t);
 }
 
 void flecs_ordered_children_populate(
     ecs_world_t *world,
     ecs_component_record_t *cr)
 {    
-    ecs_vec_t *v = &cr->pair->ordered_children;
+    flecs_ordered_children_init(world, cr);
+
+    ecs_vec_t *v = &cr->pair->ext->ordered_children;
     ecs_assert(ecs_vec_count(v) == 0, ECS_INTERNAL_ERROR, NULL);
     ecs_assert(ECS_IS_PAIR(cr->id), ECS_INTERNAL_ERROR, NULL);
     ecs_assert(ECS_PAIR_FIRST(cr->id) ==  EcsChildOf, 
@@ -39,7 +40,7 @@ void flecs_ordered_children_populate(
 void flecs_ordered_children_clear(
     ecs_component_record_t *cr)
 {    
-    ecs_vec_t *v = &cr->pair->ordered_children;
+    ecs_vec_t *v = &cr->pair->ext->ordered_children;
     ecs_assert(ECS_IS_PAIR(cr->id), ECS_INTERNAL_ERROR, NULL);
     ecs_assert(ECS_PAIR_FIRST(cr->id) ==  EcsChildOf, 
         ECS_INTERNAL_ERROR, NULL);
@@ -54,9 +55,10 @@ void flecs_ordered_entities_append(
     ecs_entity_t e)
 {
     ecs_assert(pair != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(pair->ext != NULL, ECS_INTERNAL_ERROR, NULL);
 
     ecs_vec_append_t(
-        &world->allocator, &pair->ordered_children, ecs_entity_t)[0] = e;
+        &world->allocator, &pair->ext->ordered_children, ecs_entity_t)[0] = e;
 }
 
 static
@@ -65,8 +67,9 @@ void flecs_ordered_entities_remove(
     ecs_entity_t e)
 {
     ecs_assert(pair != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(pair->ext != NULL, ECS_INTERNAL_ERROR, NULL);
 
-    ecs_vec_t *vec = &pair->ordered_children;
+    ecs_vec_t *vec = &pair->ext->ordered_children;
     int32_t i, count = ecs_vec_count(vec);
     ecs_entity_t *entities = ecs_vec_first_t(vec, ecs_entity_t);
 
@@ -141,7 +144,7 @@ void flecs_ordered_children_reorder(
         "ecs_set_child_order is only allowed for parents with the "
         "OrderedChildren trait");
 
-    ecs_vec_t *vec = &cr->pair->ordered_children;
+    ecs_vec_t *vec = &cr->pair->ext->ordered_children;
     ecs_entity_t *parent_children = ecs_vec_first_t(vec, ecs_entity_t);
     int32_t parent_child_count = ecs_vec_count(vec);
     ecs_check(parent_child_count == child_count, ECS_INVALID_PARAMETER,
@@ -214,6 +214,33 @@ void flecs_table_init_data(
             flecs_bitset_init(&meta->bs_columns[i]);
         }
     }
+
+    /* Initialize changed rows for components with the DirtyRows trait */
+    int32_t column_count = table->column_count, dirty_count = 0;
+    int16_t *s2t = &table->column_map[table->type.count];
+    for (i = 0; i < column_count; i ++) {
+        ecs_component_record_t *cr = (ecs_component_record_t*)
+            meta->records[s2t[i]].hdr.cache;
+        if (cr->flags & EcsIdDirtyRows) {
+            dirty_count ++;
+        }
+    }
+
+    if (dirty_count) {
+        meta->dirty_rows = flecs_wcalloc_n(
+            world, ecs_table_dirty_rows_t, dirty_count);
+        meta->dirty_rows_count = dirty_count;
+        table->flags |= EcsTableHasDirtyRows;
+
+        int32_t cur = 0;
+        for (i = 0; i < column_count; i ++) {
+            ecs_component_record_t *cr = (ecs_component_record_t*)
+                meta->records[s2t[i]].hdr.cache;
+            if (cr->flags & EcsIdDirtyRows) {
+                meta->dirty_rows[cur ++].column = i;
+            }
+        }
+    }
 }
 
 /* Initialize table flags. Table flags are used in lots of scenarios to quickly
@@ -329,7 +356,7 @@ void flecs_table_append_to_records(
         tr->index = flecs_ito(int16_t, column);
         tr->count = 1;
 
-        ecs_table_cache_insert(&cr->cache, table, &tr->hdr);
+        ecs_table_cache_insert(world, &cr->cache, table, &tr->hdr);
     } else {
         tr->count ++;
     }
@@ -596,7 +623,7 @@ void flecs_table_init(
         } else {
             /* Other records are not registered yet */
             ecs_assert(cr != NULL, ECS_INTERNAL_ERROR, NULL);
-            ecs_table_cache_insert(&cr->cache, table, &tr->hdr);
+            ecs_table_cache_insert(world, &cr->cache, table, &tr->hdr);
         }
 
         /* Claim component record so it stays alive as long as the table exists */
@@ -670,8 +697,13 @@ void flecs_table_records_unregister(
             ECS_INTERNAL_ERROR, NULL);
         (void)id;
 
-        ecs_table_cache_remove(cache, table_id, &tr->hdr);
-        flecs_component_release(world, (ecs_component_record_t*)cache);
+        ecs_component_record_t *cr = (ecs_component_record_t*)cache;
+        if (cr->flags & EcsIdIsUnion) {
+            flecs_union_index_remove_table(world, cr, table);
+        }
+
+        ecs_table_cache_remove(world, cache, table_id, &tr->hdr);
+        flecs_component_release(world, cr);
     }
 
     flecs_wfree_n(world, ecs_table_record_t, count, table->_->records);
@@ -844,11 +876,15 @@ void flecs_table_invoke_remove_hooks(
     }
 }
 
-/* Destruct all components and/or delete all entities in table */
+/* Destruct all components and/or delete all entities in table. If detached is
+ * provided, destructors are not invoked here. Instead the caller moves the 
+ * component storage to the detached vector, so that destructors can run after
+ * the table is cleaned up. */
 static
 void flecs_table_dtor_all(
     ecs_world_t *world,
-    ecs_table_t *table)
+    ecs_table_t *table,
+    bool detached)
 {
     int32_t i, c, count = ecs_table_count(table);
     if (!count) {
@@ -880,9 +916,11 @@ void flecs_table_dtor_all(
         }
 
         /* Destruct components */
-        for (c = 0; c < column_count; c++) {
-            flecs_table_invoke_dtor(&table->data.columns[c], 0, count);
-        }       
+        if (!detached) {
+            for (c = 0; c < column_count; c++) {
+                flecs_table_invoke_dtor(&table->data.columns[c], 0, count);
+            }
+        }
 
         /* Iterate entities first, then components. This ensures that only one
          * entity is invalidated at a time, which ensures that destructors can
@@ -919,15 +957,17 @@ void flecs_table_fini_data(
     ecs_world_t *world,
     ecs_table_t *table,
     bool do_on_remove,
-    bool deallocate)
+    bool deallocate,
+    ecs_vec_t *detached)
 {
     ecs_assert(!table->_->lock, ECS_LOCKED_STORAGE, FLECS_LOCKED_STORAGE_MSG);
+    ecs_assert(!detached || deallocate, ECS_INTERNAL_ERROR, NULL);
 
     if (do_on_remove) {
         flecs_table_notify_on_remove(world, table);        
     }
 
-    flecs_table_dtor_all(world, table);
+    flecs_table_dtor_all(world, table, detached != NULL);
 
     if (deallocate) {
         ecs_column_t *columns = table->data.columns;
@@ -935,8 +975,17 @@ void flecs_table_fini_data(
             int32_t c, column_count = table->column_count;
             for (c = 0; c < column_count; c ++) {
                 ecs_column_t *column = &columns[c];
-                ecs_vec_t v = ecs_vec_from_column(column, table, column->ti->size);
-                ecs_vec_fini(&world->allocator, &v, column->ti->size);
+                const ecs_type_info_t *ti = column->ti;
+                ecs_vec_t v = ecs_vec_from_column(column, table, ti->size);
+                if (detached && ti->hooks.dtor && v.count) {
+                    /* Hand storage to caller, which invokes the destructor */
+                    ecs_table_detached_t *elem = ecs_vec_append_t(
+                        &world->allocator, detached, ecs_table_detached_t);
+                    elem->data = v;
+                    elem->ti = ti;
+                } else {
+                    ecs_vec_fini(&world->allocator, &v, ti->size);
+                }
                 column->data = NULL;
             }
 
@@ -971,6 +1020,12 @@ void flecs_table_fini_data(
         ecs_vec_fini_t(&world->allocator, &v, ecs_entity_t);
         table->data.entities = NULL;
         table->data.size = 0;
+
+        int32_t c, dirty_count = meta->dirty_rows_count;
+        for (c = 0; c < dirty_count; c ++) {
+            ecs_vec_fini_t(&world->allocator, 
+                &meta->dirty_rows[c].bits, uint64_t);
+        }
     }
 
     table->data.count = 0;
@@ -990,7 +1045,7 @@ void ecs_table_clear_entities(
     ecs_world_t* world,
     ecs_table_t* table)
 {
-    flecs_table_fini_data(world, table, true, false);
+    flecs_table_fini_data(world, table, true, false, NULL);
 }
 
 /* Cleanup, run OnRemove, free allocations */
@@ -998,7 +1053,18 @@ void flecs_table_delete_entities(
     ecs_world_t *world,
     ecs_table_t *table)
 {
-    flecs_table_fini_data(world, table, true, true);
+    flecs_table_fini_data(world, table, true, true, NULL);
+}
+
+/* Cleanup, run OnRemove, free allocations. Component storage with destructors
+ * is appended to the detached vector instead of being destructed. */
+void flecs_table_delete_entities_detached(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    ecs_vec_t *detached)
+{
+    ecs_assert(detached != NULL, ECS_INTERNAL_ERROR, NULL);
+    flecs_table_fini_data(world, table, true, true, detached);
 }
 
 /* Unset all components in table. This function is called before a table is 
@@ -1019,6 +1085,10 @@ void flecs_table_fini(
 
     flecs_increment_table_version(world, table);
 
+    if (table->_->gc_pooled) {
+        world->info.table_pool_count --;
+    }
+
     bool is_root = table == &world->store.root;
     ecs_assert(!table->_->lock, ECS_LOCKED_STORAGE, FLECS_LOCKED_STORAGE_MSG);
     ecs_assert(is_root || table->id != 0, ECS_INTERNAL_ERROR, NULL);
@@ -1044,7 +1114,7 @@ void flecs_table_fini(
     }
 
     /* Cleanup data, no OnRemove, free allocations */
-    flecs_table_fini_data(world, table, false, true);
+    flecs_table_fini_data(world, table, false, true, NULL);
     flecs_table_clear_edges(world, table);
 
     if (!is_root) {
@@ -1058,6 +1128,9 @@ void flecs_table_fini(
     }
 
     flecs_wfree_n(world, int32_t, table->column_count + 1, table->dirty_state);
+    flecs_wfree_n(world, ecs_table_dirty_rows_t, table->_->dirty_rows_count,
+        table->_->dirty_rows);
+    flecs_instantiate_plans_fini(world, table);
     flecs_wfree_n(world, int16_t, table->column_count + table->type.count, 
         table->column_map);
     flecs_wfree_n(world, int16_t, FLECS_HI_COMPONENT_ID, table->component_map);
@@ -1132,15 +1205,78 @@ void flecs_table_mark_table_dirty(
     }
 }
 
+/* Set a range of bits in a changed rows bitset */
+static
+void flecs_table_dirty_rows_set(
+    ecs_world_t *world,
+    ecs_table_dirty_rows_t *dr,
+    int32_t row,
+    int32_t count)
+{
+    int32_t end = row + count;
+    ecs_vec_set_min_count_zeromem_t(
+        &world->allocator, &dr->bits, uint64_t, (end + 63) / 64);
+    uint64_t *words = ecs_vec_first(&dr->bits);
+
+    while (row < end) {
+        int32_t bit = row & 63;
+        int32_t n = ECS_MIN(64 - bit, end - row);
+        uint64_t mask = n == 64 ? UINT64_MAX : (((1llu << n) - 1) << bit);
+        words[row >> 6] |= mask;
+        row += n;
+    }
+}
+
+void flecs_table_mark_rows_dirty(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t column,
+    int32_t row,
+    int32_t count)
+{
+    if (!(table->flags & EcsTableHasDirtyRows) || !count) {
+        return;
+    }
+
+    ecs_table__t *meta = table->_;
+    int32_t i, dirty_count = meta->dirty_rows_count;
+    for (i = 0; i < dirty_count; i ++) {
+        ecs_table_dirty_rows_t *dr = &meta->dirty_rows[i];
+        if (column == -1 || dr->column == column) {
+            flecs_table_dirty_rows_set(world, dr, row, count);
+        }
+    }
+}
+
+ecs_table_dirty_rows_t* flecs_table_get_dirty_rows(
+    const ecs_table_t *table,
+    int32_t column)
+{
+    if (!(table->flags & EcsTableHasDirtyRows)) {
+        return NULL;
+    }
+
+    ecs_table__t *meta = table->_;
+    int32_t i, dirty_count = meta->dirty_rows_count;
+    for (i = 0; i < dirty_count; i ++) {
+        if (meta->dirty_rows[i].column == column) {
+            return &meta->dirty_rows[i];
+        }
+    }
+
+    return NULL;
+}
+
 /* Mark table component dirty */
 void flecs_table_mark_dirty(
     ecs_world_t *world,
     ecs_table_t *table,
-    ecs_entity_t component)
+    ecs_entity_t component,
+    int32_t row)
 {
     ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
 
-    if (table->dirty_state) {
+    if (table->dirty_state || (table->flags & EcsTableHasDirtyRows)) {
         int32_t column;
         if (component < FLECS_HI_COMPONENT_ID) {
             column = table->component_map[component];
@@ -1163,7 +1299,11 @@ void flecs_table_mark_dirty(
 
         /* Column is offset by 1, 0 is reserved for entity column. */
 
-        table->dirty_state[column] ++;
+        if (table->dirty_state) {
+            table->dirty_state[column] ++;
+        }
+
+        flecs_table_mark_rows_dirty(world, table, column - 1, row, 1);
 
         ecs_assert(!table->_->lock, ECS_LOCKED_STORAGE, 
             FLECS_LOCKED_STORAGE_MSG);
@@ -1461,6 +1601,10 @@ int32_t flecs_table_append(
     flecs_increment_table_column_version(world, table);
     ecs_assert(count >= 0, ECS_INTERNAL_ERROR, NULL);
 
+    if (table->flags & EcsTableHasDirtyRows) {
+        flecs_table_mark_rows_dirty(world, table, -1, count, 1);
+    }
+
     /* Fast path: no switch columns, no lifecycle actions */
     if (!(table->flags & EcsTableIsComplex)) {
         flecs_table_fast_append(world, table);
@@ -1535,6 +1679,39 @@ void flecs_table_fast_delete(
     }
 }
 
+/* Move a component value to another row and destruct the source. If construct 
+ * is true, the destination is uninitialized memory, otherwise it contains a 
+ * value that is replaced. Used by operations that move rows within a table. */
+static
+void flecs_table_move_w_dtor(
+    const ecs_type_info_t *ti,
+    void *dst,
+    void *src,
+    bool construct)
+{
+    ecs_move_t move_dtor;
+    if (construct) {
+        move_dtor = ti->hooks.ctor_move_dtor;
+    } else {
+        move_dtor = ti->hooks.move_dtor;
+
+        /* If neither move nor move_ctor are set, this indicates that 
+         * non-destructive move semantics are not supported for this 
+         * type. In such cases, we set the move_dtor as ctor_move_dtor, 
+         * which indicates a destructive move operation. This adjustment 
+         * ensures compatibility with different language bindings. */
+        if (!ti->hooks.move_ctor && ti->hooks.ctor_move_dtor) {
+            move_dtor = ti->hooks.ctor_move_dtor;
+        }
+    }
+
+    if (move_dtor) {
+        move_dtor(dst, src, 1, ti);
+    } else {
+        ecs_os_memcpy(dst, src, ti->size);
+    }
+}
+
 /* Delete entity from table */
 void flecs_table_delete(
     ecs_world_t *world,
@@ -1568,6 +1745,10 @@ void flecs_table_delete(
             ecs_assert(record_to_move->table != NULL, ECS_INTERNAL_ERROR, NULL);
             ecs_assert(record_to_move->table == table, ECS_INTERNAL_ERROR, NULL);
         }
+
+        if (table->flags & EcsTableHasDirtyRows) {
+            flecs_table_mark_rows_dirty(world, table, -1, row, 1);
+        }
     }     
 
     /* If the table is monitored indicate that there has been a change */
@@ -1618,22 +1799,7 @@ void flecs_table_delete(
                         EcsOnRemove, column, &entity_to_delete, row, 1);
                 }
 
-                ecs_move_t move_dtor = ti->hooks.move_dtor;
-                
-                /* If neither move nor move_ctor are set, this indicates that 
-                 * non-destructive move semantics are not supported for this 
-                 * type. In such cases, we set the move_dtor as ctor_move_dtor, 
-                 * which indicates a destructive move operation. This adjustment 
-                 * ensures compatibility with different language bindings. */
-                if (!ti->hooks.move_ctor && ti->hooks.ctor_move_dtor) {
-                  move_dtor = ti->hooks.ctor_move_dtor;
-                }
-
-                if (move_dtor) {
-                    move_dtor(dst, src, 1, ti);
-                } else {
-                    ecs_os_memcpy(dst, src, size);
-                }
+                flecs_table_move_w_dtor(ti, dst, src, false);
             }
         } else {
             flecs_table_fast_delete(table, row);
@@ -1797,6 +1963,7 @@ int32_t flecs_table_appendn(
     int32_t cur_count = ecs_table_count(table);
     int32_t result = flecs_table_grow_data(
         world, table, to_add, cur_count + to_add, ids);
+    flecs_table_mark_rows_dirty(world, table, -1, cur_count, to_add);
     flecs_table_check_sanity(table);
 
     return result;
@@ -1899,6 +2066,11 @@ void flecs_table_swap(
     record_ptr_1->row = ECS_ROW_TO_RECORD(row_2, flags_1);
     record_ptr_2->row = ECS_ROW_TO_RECORD(row_1, flags_2);
 
+    if (table->flags & EcsTableHasDirtyRows) {
+        flecs_table_mark_rows_dirty(world, table, -1, row_1, 1);
+        flecs_table_mark_rows_dirty(world, table, -1, row_2, 1);
+    }
+
     flecs_table_swap_bitset_columns(table, row_1, row_2);
 
     ecs_column_t *columns = table->data.columns;
@@ -1946,6 +2118,151 @@ void flecs_table_swap(
     flecs_table_check_sanity(table);
 }
 
+/* Move rows to the end of the table. This makes it possible to delete a batch
+ * of rows with a single truncation, and moves at most as many rows as are
+ * deleted. Rows must be sorted and may not contain duplicates. */
+void flecs_table_move_to_end(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    const int32_t *rows,
+    int32_t count)
+{
+    ecs_assert(world != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(!table->_->lock, ECS_LOCKED_STORAGE, FLECS_LOCKED_STORAGE_MSG);
+
+    flecs_table_check_sanity(table);
+
+    int32_t table_count = ecs_table_count(table);
+    ecs_assert(count <= table_count, ECS_INTERNAL_ERROR, NULL);
+    int32_t first = table_count - count;
+
+    /* Rows before the first row of the tail leave a hole that is filled with
+     * a row from the tail that isn't deleted. */
+    int32_t i, hole_count = 0;
+    while (hole_count < count && rows[hole_count] < first) {
+        hole_count ++;
+    }
+
+    if (!hole_count) {
+        return;
+    }
+
+    int32_t *src_rows = flecs_walloc_n(world, int32_t, hole_count);
+    int32_t row = table_count - 1, tail = count - 1;
+    for (i = 0; i < hole_count; row --) {
+        ecs_assert(row >= first, ECS_INTERNAL_ERROR, NULL);
+        if (tail >= hole_count && rows[tail] == row) {
+            tail --;
+            continue;
+        }
+        src_rows[i ++] = row;
+    }
+
+    flecs_table_mark_table_dirty(world, table, 0);
+
+    /* Swap entities & records */
+    ecs_entity_t *entities = table->data.entities;
+    for (i = 0; i < hole_count; i ++) {
+        int32_t row_1 = rows[i], row_2 = src_rows[i];
+        ecs_entity_t e1 = entities[row_1];
+        ecs_entity_t e2 = entities[row_2];
+        ecs_record_t *r1 = flecs_entities_get(world, e1);
+        ecs_record_t *r2 = flecs_entities_get(world, e2);
+        ecs_assert(r1 != NULL, ECS_INTERNAL_ERROR, NULL);
+        ecs_assert(r2 != NULL, ECS_INTERNAL_ERROR, NULL);
+
+        entities[row_1] = e2;
+        entities[row_2] = e1;
+        r1->row = ECS_ROW_TO_RECORD(row_2, ECS_RECORD_TO_ROW_FLAGS(r1->row));
+        r2->row = ECS_ROW_TO_RECORD(row_1, ECS_RECORD_TO_ROW_FLAGS(r2->row));
+
+        flecs_table_swap_bitset_columns(table, row_1, row_2);
+        flecs_table_mark_rows_dirty(world, table, -1, row_1, 1);
+    }
+
+    /* Swap column values one column at a time. Values are swapped with 
+     * destructive moves into uninitialized memory, which unlike a move 
+     * assignment is also supported by types that can only be move constructed.
+     * The deleted values stay alive, as OnRemove observers and remove hooks
+     * are invoked after they have been moved to the end of the table. */
+    ecs_column_t *columns = table->data.columns;
+    int32_t c, column_count = table->column_count;
+    for (c = 0; c < column_count; c ++) {
+        ecs_column_t *column = &columns[c];
+        const ecs_type_info_t *ti = column->ti;
+        ecs_size_t size = ti->size;
+        void *tmp = ecs_os_alloca(size);
+
+        for (i = 0; i < hole_count; i ++) {
+            void *el_1 = ECS_ELEM(column->data, size, rows[i]);
+            void *el_2 = ECS_ELEM(column->data, size, src_rows[i]);
+            flecs_table_move_w_dtor(ti, tmp, el_1, true);
+            flecs_table_move_w_dtor(ti, el_1, el_2, true);
+            flecs_table_move_w_dtor(ti, el_2, tmp, true);
+        }
+    }
+
+    flecs_wfree_n(world, int32_t, hole_count, src_rows);
+
+    flecs_table_check_sanity(table);
+}
+
+/* Delete the last entities from the table. Invokes remove hooks and
+ * destructors, and removes the entities from the entity index. */
+void flecs_table_delete_last(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t count)
+{
+    ecs_assert(world != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(table != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(!table->_->lock, ECS_LOCKED_STORAGE, FLECS_LOCKED_STORAGE_MSG);
+    ecs_assert(count <= ecs_table_count(table), ECS_INTERNAL_ERROR, NULL);
+
+    flecs_table_check_sanity(table);
+
+    if (!count) {
+        return;
+    }
+
+    int32_t i, row = ecs_table_count(table) - count;
+    ecs_entity_t *entities = &table->data.entities[row];
+
+    flecs_table_mark_table_dirty(world, table, 0);
+
+    if (table->flags & EcsTableHasDtors) {
+        ecs_column_t *columns = table->data.columns;
+        int32_t column_count = table->column_count;
+        for (i = 0; i < column_count; i ++) {
+            flecs_table_invoke_remove_hooks(world, table, &columns[i], 
+                entities, row, count, true);
+        }
+    }
+
+    /* Update entity index after invoking destructors so that entities can be
+     * safely used in destructor callbacks. */
+    for (i = 0; i < count; i ++) {
+        flecs_entities_remove(world, entities[i]);
+    }
+
+    ecs_table__t *meta = table->_;
+    ecs_bitset_t *bs_columns = meta->bs_columns;
+    int32_t bs_count = meta->bs_count;
+    for (i = 0; i < bs_count; i ++) {
+        ecs_bitset_t *bs = &bs_columns[i];
+        int32_t b;
+        for (b = row; b < bs->count; b ++) {
+            flecs_bitset_set(bs, b, false);
+        }
+        bs->count = row;
+    }
+
+    table->data.count = row;
+
+    flecs_table_check_sanity(table);
+}
+
 static
 void flecs_table_merge_vec(
     ecs_world_t *world,
@@ -2159,6 +2476,7 @@ void flecs_table_merge(
 
     /* Merge table columns */
     flecs_table_merge_data(world, dst_table, src_table, dst_count, src_count);
+    flecs_table_mark_rows_dirty(world, dst_table, -1, dst_count, src_count);
 
     if (src_count) {
         flecs_table_traversable_add(dst_table, src_table->_->traversable_count);
@@ -72,6 +72,12 @@ typedef struct ecs_table_event_t {
      * initializing an event a bit simpler. */
 } ecs_table_event_t;
 
+/** Changed rows for a column of a component with the DirtyRows trait */
+typedef struct ecs_table_dirty_rows_t {
+    int32_t column;                  /* Column index */
+    ecs_vec_t bits;                  /* One bit per row, set if row changed */
+} ecs_table_dirty_rows_t;
+
 /** Infrequently accessed data not stored inline in ecs_table_t */
 typedef struct ecs_table__t {
     uint64_t hash;                   /* Type hash */
@@ -81,13 +87,23 @@ typedef struct ecs_table__t {
     uint16_t generation;             /* Used for table cleanup */
     int16_t record_count;            /* Table record count including wildcards */
 
+    int64_t gc_frame;                /* Frame + 1 in which table GC found table empty */
+    uint16_t gc_version;             /* Table version when table GC found table empty */
+    bool gc_pooled;                  /* Storage freed by table GC, kept for reuse */
+
     int16_t bs_count;
     int16_t bs_offset;
     ecs_bitset_t *bs_columns;        /* Bitset columns */
 
+    int32_t dirty_rows_count;
+    ecs_table_dirty_rows_t *dirty_rows; /* Changed rows per tracked column */
+
     struct ecs_table_record_t *records; /* Array with table records */
     ecs_pair_record_t *childof_r;       /* ChildOf pair data */
 
+    /* Cached plans for instantiating prefab children stored in table */
+    struct ecs_instantiate_plan_t *instantiate_plans;
+
 #ifdef FLECS_DEBUG_INFO
     /* Fields used for debug visualization */
     struct {
@@ -176,6 +192,19 @@ void flecs_table_delete(
     int32_t index,
     bool destruct);
 
+/* Move rows to the end of the table, used for batched deletes. */
+void flecs_table_move_to_end(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    const int32_t *rows,
+    int32_t count);
+
+/* Delete the last count entities from the table. */
+void flecs_table_delete_last(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t count);
+
 /* Move a row from one table to another */
 void flecs_table_move(
     ecs_world_t *world,
@@ -239,7 +268,22 @@ void flecs_table_swap(
 void flecs_table_mark_dirty(
     ecs_world_t *world,
     ecs_table_t *table,
-    ecs_entity_t component);
+    ecs_entity_t component,
+    int32_t row);
+
+/* Mark rows changed for columns with the DirtyRows trait. If column is -1, 
+ * rows are marked for all tracked columns. */
+void flecs_table_mark_rows_dirty(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int32_t column,
+    int32_t row,
+    int32_t count);
+
+/* Get changed rows for column, NULL if column doesn't track rows. */
+ecs_table_dirty_rows_t* flecs_table_get_dirty_rows(
+    const ecs_table_t *table,
+    int32_t column);
 
 void flecs_table_notify(
     ecs_world_t *world,
@@ -251,6 +295,20 @@ void flecs_table_delete_entities(
     ecs_world_t *world,
     ecs_table_t *table);
 
+/* Component storage that was detached from a deleted table. The data has not
+ * been destructed yet, and is freed with the world allocator. */
+typedef struct ecs_table_detached_t {
+    ecs_vec_t data;
+    const ecs_type_info_t *ti;
+} ecs_table_detached_t;
+
+/* Same as flecs_table_delete_entities, but instead of invoking destructors the
+ * component storage is appended to a vector<ecs_table_detached_t>. */
+void flecs_table_delete_entities_detached(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    ecs_vec_t *detached);
+
 /* Increase observer count of table */
 void flecs_table_traversable_add(
     ecs_table_t *table,
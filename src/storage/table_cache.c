@@ -12,6 +12,11 @@
  * 
  * A table cache has separate lists for non-empty tables and empty tables. This
  * improves performance as applications don't waste time iterating empty tables.
+ * 
+ * Most caches only ever contain a single table (for example the component
+ * records for (ChildOf, parent) pairs), so the index used for table lookups is
+ * only created once a second table is added to the cache. Until then lookups 
+ * check the first element of the table list.
  */
 
 #include "../private_api.h"
@@ -69,22 +74,56 @@ void flecs_table_cache_list_insert(
         ECS_INTERNAL_ERROR, NULL);
 }
 
+/* Memory used by the table lookup index. */
+static
+ecs_size_t flecs_table_cache_index_memory(
+    const ecs_table_cache_t *cache)
+{
+    if (!ecs_map_is_init(&cache->index)) {
+        return 0;
+    }
+
+    return cache->index.bucket_count * ECS_SIZEOF(ecs_bucket_t) + 
+        ecs_map_count(&cache->index) * ECS_SIZEOF(ecs_bucket_entry_t);
+}
+
+/* Create lookup index when a second table is added to the cache. */
+static
+void flecs_table_cache_index_init(
+    ecs_world_t *world,
+    ecs_table_cache_t *cache)
+{
+    ecs_map_init_w_params(&cache->index, &world->allocators.ptr);
+
+    ecs_table_cache_hdr_t *cur = cache->tables.first;
+    for (; cur; cur = cur->next) {
+        if (cur->table) {
+            ecs_map_insert_ptr(&cache->index, cur->table->id, cur);
+        }
+    }
+}
+
 void ecs_table_cache_init(
     ecs_world_t *world,
     ecs_table_cache_t *cache)
 {
     ecs_assert(cache != NULL, ECS_INTERNAL_ERROR, NULL);
-    ecs_map_init_w_params(&cache->index, &world->allocators.ptr);
+    (void)world;
+    ecs_os_zeromem(cache);
 }
 
 void ecs_table_cache_fini(
+    ecs_world_t *world,
     ecs_table_cache_t *cache)
 {
     ecs_assert(cache != NULL, ECS_INTERNAL_ERROR, NULL);
+    world->info.component_record_memory -= 
+        flecs_table_cache_index_memory(cache);
     ecs_map_fini(&cache->index);
 }
 
 void ecs_table_cache_insert(
+    ecs_world_t *world,
     ecs_table_cache_t *cache,
     const ecs_table_t *table,
     ecs_table_cache_hdr_t *result)
@@ -97,12 +136,21 @@ void ecs_table_cache_insert(
     result->cache = cache;
     result->table = ECS_CONST_CAST(ecs_table_t*, table);
 
+    ecs_size_t memory = flecs_table_cache_index_memory(cache);
+
     flecs_table_cache_list_insert(cache, result);
 
     if (table) {
-        ecs_map_insert_ptr(&cache->index, table->id, result);
+        if (ecs_map_is_init(&cache->index)) {
+            ecs_map_insert_ptr(&cache->index, table->id, result);
+        } else if (cache->tables.count > 1) {
+            flecs_table_cache_index_init(world, cache);
+        }
     }
 
+    world->info.component_record_memory += 
+        flecs_table_cache_index_memory(cache) - memory;
+
     ecs_assert(cache->tables.first != NULL, ECS_INTERNAL_ERROR, NULL);
 }
 
@@ -111,11 +159,17 @@ void ecs_table_cache_replace(
     const ecs_table_t *table,
     ecs_table_cache_hdr_t *elem)
 {
-    ecs_table_cache_hdr_t **r = ecs_map_get_ref(
-        &cache->index, ecs_table_cache_hdr_t, table->id);
-    ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
+    ecs_table_cache_hdr_t **r = NULL, *old;
+    if (ecs_map_is_init(&cache->index)) {
+        r = ecs_map_get_ref(&cache->index, ecs_table_cache_hdr_t, table->id);
+        ecs_assert(r != NULL, ECS_INTERNAL_ERROR, NULL);
+        old = *r;
+    } else {
+        old = cache->tables.first;
+        ecs_assert(old != NULL, ECS_INTERNAL_ERROR, NULL);
+        ecs_assert(old->table == table, ECS_INTERNAL_ERROR, NULL);
+    }
 
-    ecs_table_cache_hdr_t *old = *r;
     ecs_assert(old != NULL, ECS_INTERNAL_ERROR, NULL);
 
     ecs_table_cache_hdr_t *prev = old->prev, *next = old->next;
@@ -135,7 +189,10 @@ void ecs_table_cache_replace(
         cache->tables.last = elem;
     }
 
-    *r = elem;
+    if (r) {
+        *r = elem;
+    }
+
     elem->prev = prev;
     elem->next = next;
 }
@@ -149,6 +206,12 @@ void* ecs_table_cache_get(
         if (ecs_map_is_init(&cache->index)) {
             return ecs_map_get_deref(&cache->index, void**, table->id);
         }
+
+        ecs_table_cache_hdr_t *elem = cache->tables.first;
+        if (elem && elem->table == table) {
+            return elem;
+        }
+
         return NULL;
     } else {
         ecs_table_cache_hdr_t *elem = cache->tables.first;
@@ -158,6 +221,7 @@ void* ecs_table_cache_get(
 }
 
 void* ecs_table_cache_remove(
+    ecs_world_t *world,
     ecs_table_cache_t *cache,
     uint64_t table_id,
     ecs_table_cache_hdr_t *elem)
@@ -168,7 +232,13 @@ void* ecs_table_cache_remove(
     ecs_assert(elem->cache == cache, ECS_INTERNAL_ERROR, NULL);
 
     flecs_table_cache_list_remove(cache, elem);
-    ecs_map_remove(&cache->index, table_id);
+
+    if (ecs_map_is_init(&cache->index)) {
+        ecs_size_t memory = flecs_table_cache_index_memory(cache);
+        ecs_map_remove(&cache->index, table_id);
+        world->info.component_record_memory += 
+            flecs_table_cache_index_memory(cache) - memory;
+    }
 
     return elem;
 }
@@ -15,7 +15,7 @@ typedef struct ecs_table_cache_list_t {
 
 /** Table cache */
 typedef struct ecs_table_cache_t {
-    ecs_map_t index; /* <table_id, T*> */
+    ecs_map_t index; /* <table_id, T*>, created when cache has >1 tables */
     ecs_table_cache_list_t tables;
 } ecs_table_cache_t;
 
@@ -24,9 +24,11 @@ void ecs_table_cache_init(
     ecs_table_cache_t *cache);
 
 void ecs_table_cache_fini(
+    ecs_world_t *world,
     ecs_table_cache_t *cache);
 
 void ecs_table_cache_insert(
+    ecs_world_t *world,
     ecs_table_cache_t *cache,
     const ecs_table_t *table,
     ecs_table_cache_hdr_t *result);
@@ -37,6 +39,7 @@ void ecs_table_cache_replace(
     ecs_table_cache_hdr_t *elem);
 
 void* ecs_table_cache_remove(
+    ecs_world_t *world,
     ecs_table_cache_t *cache,
     uint64_t table_id,
     ecs_table_cache_hdr_t *elem);
@@ -415,6 +415,145 @@ void flecs_table_diff_free(
     flecs_bfree(&world->allocators.table_diff, diff);
 }
 
+/* Initial and maximum number of elements in hi edge cache */
+#define FLECS_EDGE_CACHE_MIN_SIZE (256)
+#define FLECS_EDGE_CACHE_MAX_SIZE (1 << 18)
+
+/* Returns first element of the bucket for edge. Buckets have two elements, so
+ * that two edges that hash to the same bucket don't keep evicting each other */
+static
+ecs_graph_edge_cache_elem_t* flecs_table_edge_cache_bucket(
+    const ecs_graph_edge_cache_t *cache,
+    const ecs_graph_edges_t *edges,
+    ecs_id_t id)
+{
+    uint64_t hash = (uint64_t)(uintptr_t)edges ^ (id * 0x9E3779B97F4A7C15);
+    hash *= 0x9E3779B97F4A7C15;
+    return &cache->elems[(hash >> cache->shift) & ~(uint64_t)1];
+}
+
+static
+ecs_graph_edge_t* flecs_table_edge_cache_get(
+    const ecs_graph_edge_cache_t *cache,
+    const ecs_graph_edges_t *edges,
+    ecs_id_t id)
+{
+    ecs_graph_edge_cache_elem_t *elem = flecs_table_edge_cache_bucket(
+        cache, edges, id);
+    if (elem[0].edges == edges && elem[0].id == id) {
+        return elem[0].edge;
+    }
+    if (elem[1].edges == edges && elem[1].id == id) {
+        return elem[1].edge;
+    }
+    return NULL;
+}
+
+/* Insert edge in first element of bucket, move previous edge to second */
+static
+void flecs_table_edge_cache_set(
+    ecs_graph_edge_cache_t *cache,
+    const ecs_graph_edges_t *edges,
+    ecs_id_t id,
+    ecs_graph_edge_t *edge)
+{
+    ecs_graph_edge_cache_elem_t *elem = flecs_table_edge_cache_bucket(
+        cache, edges, id);
+    if (elem[0].edge) {
+        elem[1] = elem[0];
+    }
+    elem[0].edges = edges;
+    elem[0].id = id;
+    elem[0].edge = edge;
+}
+
+/* Resize cache so that it can hold all hi edges in the world, until it reaches
+ * the maximum size. */
+static
+void flecs_table_edge_cache_grow(
+    ecs_world_t *world,
+    ecs_graph_edge_cache_t *cache)
+{
+    int32_t size = cache->size, old_size = size;
+    if (!size) {
+        size = FLECS_EDGE_CACHE_MIN_SIZE;
+    }
+
+    while ((size < (cache->edge_count * 2)) && 
+        (size < FLECS_EDGE_CACHE_MAX_SIZE)) 
+    {
+        size *= 2;
+    }
+
+    if (size == old_size) {
+        return;
+    }
+
+    ecs_graph_edge_cache_elem_t *old_elems = cache->elems;
+    cache->elems = flecs_calloc_n(
+        &world->allocator, ecs_graph_edge_cache_elem_t, size);
+    cache->size = size;
+    cache->shift = 64;
+    while (size >>= 1) {
+        cache->shift --;
+    }
+
+    /* Reinsert elements so existing edges don't have to be looked up again */
+    int32_t i;
+    for (i = 0; i < old_size; i ++) {
+        ecs_graph_edge_cache_elem_t *elem = &old_elems[i];
+        if (elem->edge) {
+            flecs_table_edge_cache_set(cache, elem->edges, elem->id, elem->edge);
+        }
+    }
+
+    if (old_elems) {
+        flecs_free_n(&world->allocator, ecs_graph_edge_cache_elem_t, 
+            old_size, old_elems);
+    }
+}
+
+/* Remove edge from cache when it gets deleted */
+static
+void flecs_table_edge_cache_remove(
+    ecs_world_t *world,
+    ecs_graph_edge_t *edge)
+{
+    ecs_graph_edge_cache_t *cache = &world->store.edge_cache;
+    cache->edge_count --;
+
+    ecs_table_t *from = edge->from;
+    if (!cache->size || !from) {
+        return;
+    }
+
+    /* Edge can be either an add or remove edge */
+    ecs_graph_edge_cache_elem_t *elem[2] = {
+        flecs_table_edge_cache_bucket(cache, &from->node.add, edge->id),
+        flecs_table_edge_cache_bucket(cache, &from->node.remove, edge->id)
+    };
+
+    int32_t i, j;
+    for (i = 0; i < 2; i ++) {
+        for (j = 0; j < 2; j ++) {
+            if (elem[i][j].edge == edge) {
+                ecs_os_zeromem(&elem[i][j]);
+            }
+        }
+    }
+}
+
+void flecs_table_edge_cache_fini(
+    ecs_world_t *world)
+{
+    ecs_graph_edge_cache_t *cache = &world->store.edge_cache;
+    if (cache->elems) {
+        flecs_free_n(&world->allocator, ecs_graph_edge_cache_elem_t, 
+            cache->size, cache->elems);
+    }
+    ecs_os_zeromem(cache);
+}
+
 static
 ecs_graph_edge_t* flecs_table_ensure_hi_edge(
     ecs_world_t *world,
@@ -436,6 +575,11 @@ ecs_graph_edge_t* flecs_table_ensure_hi_edge(
         edge = &edges->lo[id];
     } else {
         edge = flecs_bcalloc(&world->allocators.graph_edge);
+
+        ecs_graph_edge_cache_t *cache = &world->store.edge_cache;
+        if (++ cache->edge_count > cache->size) {
+            flecs_table_edge_cache_grow(world, cache);
+        }
     }
 
     r[0] = edge;
@@ -456,7 +600,20 @@ ecs_graph_edge_t* flecs_table_ensure_edge(
         }
         edge = &edges->lo[id];
     } else {
+        ecs_graph_edge_cache_t *cache = &world->store.edge_cache;
+        if (cache->size) {
+            edge = flecs_table_edge_cache_get(cache, edges, id);
+            if (edge) {
+                return edge;
+            }
+        }
+
         edge = flecs_table_ensure_hi_edge(world, edges, id);
+
+        /* Cache can have been resized by ensure_hi_edge */
+        if (cache->size) {
+            flecs_table_edge_cache_set(cache, edges, id, edge);
+        }
     }
 
     return edge;
@@ -493,6 +650,7 @@ void flecs_table_disconnect_edge(
     if (id < FLECS_HI_COMPONENT_ID) {
         ecs_os_memset_t(edge, 0, ecs_graph_edge_t);
     } else {
+        flecs_table_edge_cache_remove(world, edge);
         flecs_bfree(&world->allocators.graph_edge, edge);
     }
 }
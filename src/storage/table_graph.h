@@ -40,6 +40,26 @@ typedef struct ecs_graph_edges_t {
     ecs_map_t *hi;                   /* Map for hi edges (map<id, edge_t>) */
 } ecs_graph_edges_t;
 
+/* Element of the hi edge cache. The edges member identifies both the table and
+ * whether the edge is an add or remove edge. */
+typedef struct ecs_graph_edge_cache_elem_t {
+    const ecs_graph_edges_t *edges;
+    ecs_id_t id;
+    ecs_graph_edge_t *edge;
+} ecs_graph_edge_cache_elem_t;
+
+/* World level cache for hi edge lookups. Hi edges (pairs, components with
+ * large ids) are stored in a map per table, which is slow to search when
+ * tables have many outgoing edges, like when a relationship is used with many
+ * targets. The cache is direct mapped, and grows with the number of hi edges
+ * in the world. */
+typedef struct ecs_graph_edge_cache_t {
+    ecs_graph_edge_cache_elem_t *elems;
+    int32_t size;                    /* Number of elements, power of two */
+    int32_t shift;                   /* 64 - log2(size) */
+    int32_t edge_count;              /* Number of hi edges in world */
+} ecs_graph_edge_cache_t;
+
 /* Table graph node */
 typedef struct ecs_graph_node_t {
     /* Outgoing edges */
@@ -125,6 +145,10 @@ ecs_table_t* flecs_find_table_add(
     ecs_id_t id,
     ecs_table_diff_builder_t *diff);
 
+/* Free hi edge cache */
+void flecs_table_edge_cache_fini(
+    ecs_world_t *world);
+
 void flecs_table_hashmap_init(
     ecs_world_t *world,
     ecs_hashmap_t *hm);    
@@ -0,0 +1,296 @@
+/**
+ * @file storage/union_index.c
+ * @brief Per table row index for union relationships.
+ */
+
+#include "../private_api.h"
+
+static
+void flecs_union_table_fini(
+    ecs_world_t *world,
+    ecs_union_table_t *ut)
+{
+    /* Also free storage of targets not used by the last build */
+    int32_t i, count = ut->init_count;
+    ecs_union_target_t *targets = ecs_vec_first(&ut->targets);
+    for (i = 0; i < count; i ++) {
+        ecs_vec_fini_t(&world->allocator, &targets[i].words, ecs_union_word_t);
+    }
+
+    ecs_vec_fini_t(&world->allocator, &ut->targets, ecs_union_target_t);
+    ecs_map_fini(&ut->target_index);
+    flecs_free_t(&world->allocator, ecs_union_table_t, ut);
+}
+
+static
+ecs_union_target_t* flecs_union_table_ensure_target(
+    ecs_world_t *world,
+    ecs_union_table_t *ut,
+    ecs_entity_t tgt)
+{
+    ecs_map_val_t *index = ecs_map_ensure(&ut->target_index, tgt);
+    if (index[0]) {
+        return ecs_vec_get_t(&ut->targets, ecs_union_target_t,
+            (int32_t)index[0] - 1);
+    }
+
+    /* Reuse word storage of targets from a previous build */
+    int32_t count = ecs_vec_count(&ut->targets);
+    ecs_union_target_t *result = ecs_vec_append_t(
+        &world->allocator, &ut->targets, ecs_union_target_t);
+    if (count == ut->init_count) {
+        ecs_vec_init_t(&world->allocator, &result->words, ecs_union_word_t, 0);
+        ut->init_count ++;
+    }
+
+    result->tgt = tgt;
+    ecs_vec_clear(&result->words);
+    index[0] = (ecs_map_val_t)(count + 1);
+    return result;
+}
+
+static
+void flecs_union_table_build(
+    ecs_world_t *world,
+    ecs_component_record_t *cr,
+    ecs_union_table_t *ut,
+    ecs_table_t *table)
+{
+    ecs_map_clear(&ut->target_index);
+    ecs_vec_clear(&ut->targets);
+
+    const ecs_entity_t *entities = ecs_table_entities(table);
+    int32_t row, count = ecs_table_count(table);
+    ecs_entity_t prev_tgt = 0;
+    ecs_union_target_t *cur = NULL;
+
+    for (row = 0; row < count; row ++) {
+        ecs_entity_t tgt = flecs_switch_get(cr->sparse, (uint32_t)entities[row]);
+        if (!tgt) {
+            continue;
+        }
+
+        if (tgt != prev_tgt) {
+            cur = flecs_union_table_ensure_target(world, ut, tgt);
+            prev_tgt = tgt;
+        }
+
+        /* Rows are visited in order, so only the last word can be partial. */
+        int32_t word_index = row >> 6;
+        uint64_t bit = 1ull << (row & 63);
+        int32_t word_count = ecs_vec_count(&cur->words);
+        ecs_union_word_t *last = NULL;
+        if (word_count) {
+            last = ecs_vec_get_t(&cur->words, ecs_union_word_t, word_count - 1);
+        }
+
+        if (last && last->index == word_index) {
+            last->bits |= bit;
+        } else {
+            ecs_union_word_t *w = ecs_vec_append_t(
+                &world->allocator, &cur->words, ecs_union_word_t);
+            w->index = word_index;
+            w->bits = bit;
+        }
+    }
+
+    ut->table = table;
+    ut->table_version = table->version;
+    ut->count = count;
+    ut->dirty = false;
+}
+
+void flecs_union_index_fini(
+    ecs_world_t *world,
+    ecs_component_record_t *cr)
+{
+    ecs_pair_record_ext_t *ext = cr->pair->ext;
+    ecs_union_index_t *index = ext ? ext->union_index : NULL;
+    if (!index) {
+        return;
+    }
+
+    ecs_map_iter_t it = ecs_map_iter(&index->tables);
+    while (ecs_map_next(&it)) {
+        flecs_union_table_fini(world, ecs_map_ptr(&it));
+    }
+
+    ecs_map_fini(&index->tables);
+    flecs_free_t(&world->allocator, ecs_union_index_t, index);
+    ext->union_index = NULL;
+}
+
+void flecs_union_index_invalidate(
+    ecs_component_record_t *cr,
+    const ecs_table_t *table)
+{
+    ecs_pair_record_ext_t *ext = cr->pair ? cr->pair->ext : NULL;
+    ecs_union_index_t *index = ext ? ext->union_index : NULL;
+    if (!index) {
+        return;
+    }
+
+    ecs_union_table_t *ut = ecs_map_get_deref(
+        &index->tables, ecs_union_table_t, table->id);
+    if (ut) {
+        ut->dirty = true;
+    }
+}
+
+void flecs_union_index_remove_table(
+    ecs_world_t *world,
+    ecs_component_record_t *cr,
+    const ecs_table_t *table)
+{
+    ecs_pair_record_ext_t *ext = cr->pair ? cr->pair->ext : NULL;
+    ecs_union_index_t *index = ext ? ext->union_index : NULL;
+    if (!index) {
+        return;
+    }
+
+    ecs_union_table_t *ut = ecs_map_get_deref(
+        &index->tables, ecs_union_table_t, table->id);
+    if (ut && ut->table == table) {
+        ecs_map_remove(&index->tables, table->id);
+        flecs_union_table_fini(world, ut);
+    }
+}
+
+const ecs_union_table_t* flecs_union_index_get(
+    ecs_world_t *world,
+    ecs_component_record_t *cr,
+    ecs_table_t *table)
+{
+    ecs_assert(cr->flags & EcsIdIsUnion, ECS_INTERNAL_ERROR, NULL);
+    ecs_assert(cr->sparse != NULL, ECS_INTERNAL_ERROR, NULL);
+
+    ecs_pair_record_ext_t *ext = flecs_pair_record_ext_ensure(world, cr);
+    ecs_union_index_t *index = ext->union_index;
+    if (!index) {
+        index = ext->union_index = flecs_calloc_t(
+            &world->allocator, ecs_union_index_t);
+        ecs_map_init(&index->tables, &world->allocator);
+    }
+
+    ecs_union_table_t **ut_ptr = ecs_map_ensure_ref(
+        &index->tables, ecs_union_table_t, table->id);
+    ecs_union_table_t *ut = ut_ptr[0];
+    if (!ut) {
+        ut = ut_ptr[0] = flecs_calloc_t(&world->allocator, ecs_union_table_t);
+        ecs_vec_init_t(&world->allocator, &ut->targets, ecs_union_target_t, 0);
+        ecs_map_init(&ut->target_index, &world->allocator);
+    } else if (!ut->dirty && ut->table == table &&
+        ut->table_version == table->version && 
+        ut->count == ecs_table_count(table))
+    {
+        return ut;
+    }
+
+    flecs_union_table_build(world, cr, ut, table);
+
+    return ut;
+}
+
+const ecs_union_target_t* flecs_union_table_get_target(
+    const ecs_union_table_t *ut,
+    ecs_entity_t tgt)
+{
+    ecs_map_val_t *index = ecs_map_get(&ut->target_index, tgt);
+    if (!index) {
+        return NULL;
+    }
+
+    return ecs_vec_get_t(&ut->targets, ecs_union_target_t,
+        (int32_t)index[0] - 1);
+}
+
+void flecs_union_target_seek(
+    const ecs_union_target_t *ut,
+    int32_t row,
+    int32_t *word,
+    int32_t *bit)
+{
+    const ecs_union_word_t *words = ecs_vec_first(&ut->words);
+    int32_t word_index = row >> 6;
+    int32_t lo = 0, hi = ecs_vec_count(&ut->words);
+
+    /* Find first word with index >= word_index */
+    while (lo < hi) {
+        int32_t mid = lo + (hi - lo) / 2;
+        if (words[mid].index < word_index) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    *word = lo;
+    if (lo < ecs_vec_count(&ut->words) && words[lo].index == word_index) {
+        *bit = row & 63;
+    } else {
+        *bit = 0;
+    }
+}
+
+bool flecs_union_target_next_range(
+    const ecs_union_target_t *ut,
+    int32_t *word,
+    int32_t *bit,
+    int32_t *offset,
+    int32_t *count)
+{
+    const ecs_union_word_t *words = ecs_vec_first(&ut->words);
+    int32_t w = *word, b = *bit, word_count = ecs_vec_count(&ut->words);
+    uint64_t bits = 0;
+
+    /* Find first set bit at or after the current position */
+    for (; w < word_count; w ++, b = 0) {
+        bits = words[w].bits & (UINT64_MAX << b);
+        if (bits) {
+            break;
+        }
+    }
+
+    if (w == word_count) {
+        *word = w;
+        *bit = 0;
+        return false;
+    }
+
+    int32_t start_bit = flecs_ctz64(bits);
+    int32_t start = words[w].index * 64 + start_bit;
+
+    /* Find first unset bit after start. A range can span multiple words if
+     * the words are adjacent and all bits in between are set. */
+    uint64_t unset = ~words[w].bits & (UINT64_MAX << start_bit);
+    while (!unset) {
+        if ((w + 1) == word_count || words[w + 1].index != (words[w].index + 1)) {
+            *offset = start;
+            *count = (words[w].index + 1) * 64 - start;
+            *word = w + 1;
+            *bit = 0;
+            return true;
+        }
+
+        w ++;
+        unset = ~words[w].bits;
+    }
+
+    int32_t end_bit = flecs_ctz64(unset);
+    *offset = start;
+    *count = words[w].index * 64 + end_bit - start;
+    *word = w;
+    *bit = end_bit;
+    return true;
+}
+
+void flecs_union_set(
+    ecs_component_record_t *cr,
+    const ecs_table_t *table,
+    ecs_entity_t entity,
+    ecs_entity_t tgt)
+{
+    if (flecs_switch_set(cr->sparse, (uint32_t)entity, tgt)) {
+        flecs_union_index_invalidate(cr, table);
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ * @file storage/union_index.h
+ * @brief Per table row index for union relationships.
+ *
+ * The switch list stores union targets per entity, which is efficient for
+ * looking up or changing the target of a single entity, but requires chasing a
+ * linked list to find all entities for a target. The union index stores for
+ * each table with a union relationship a row bitmap per target, which lets
+ * queries find the rows for a target with word-level bit scans, and return
+ * them as contiguous ranges.
+ *
+ * Bitmaps are stored sparsely as a sorted list of non-zero 64-row words, so
+ * that the memory used by a table is bounded by its row count, regardless of
+ * how many targets are used. Table indices are built lazily, and rebuilt when
+ * the table changed or a target of an entity in the table changed.
+ */
+
+#ifndef FLECS_UNION_INDEX_H
+#define FLECS_UNION_INDEX_H
+
+/* Non-zero word in row bitmap */
+typedef struct ecs_union_word_t {
+    int32_t index;                /* Word index (row / 64) */
+    uint64_t bits;                /* Bits for rows in word */
+} ecs_union_word_t;
+
+/* Row bitmap for union target */
+typedef struct ecs_union_target_t {
+    ecs_entity_t tgt;             /* Union target */
+    ecs_vec_t words;              /* vec<ecs_union_word_t>, sorted by index */
+} ecs_union_target_t;
+
+/* Row index for table */
+typedef struct ecs_union_table_t {
+    const ecs_table_t *table;     /* Table for which index was built */
+    uint16_t table_version;       /* Table version when index was built */
+    int32_t count;                /* Table count when index was built */
+    bool dirty;                   /* Target of entity in table changed */
+    ecs_vec_t targets;            /* vec<ecs_union_target_t> */
+    int32_t init_count;           /* Elements in targets with initialized words */
+    ecs_map_t target_index;       /* map<tgt, index in targets> */
+} ecs_union_table_t;
+
+/* Row index for union relationship */
+typedef struct ecs_union_index_t {
+    ecs_map_t tables;             /* map<table_id, ecs_union_table_t*> */
+} ecs_union_index_t;
+
+/* Free union index of (R, Union) component record. */
+void flecs_union_index_fini(
+    ecs_world_t *world,
+    ecs_component_record_t *cr);
+
+/* Signal that the target of an entity in table changed. */
+void flecs_union_index_invalidate(
+    ecs_component_record_t *cr,
+    const ecs_table_t *table);
+
+/* Remove table from union index (called when table is deleted). */
+void flecs_union_index_remove_table(
+    ecs_world_t *world,
+    ecs_component_record_t *cr,
+    const ecs_table_t *table);
+
+/* Get up to date row index for table. */
+const ecs_union_table_t* flecs_union_index_get(
+    ecs_world_t *world,
+    ecs_component_record_t *cr,
+    ecs_table_t *table);
+
+/* Get row bitmap for target in table, or NULL if no rows have target. */
+const ecs_union_target_t* flecs_union_table_get_target(
+    const ecs_union_table_t *ut,
+    ecs_entity_t tgt);
+
+/* Set iteration state of row bitmap to first row at or after row. */
+void flecs_union_target_seek(
+    const ecs_union_target_t *ut,
+    int32_t row,
+    int32_t *word,
+    int32_t *bit);
+
+/* Find next contiguous range of rows in row bitmap. The word and bit
+ * parameters store the iteration state, and should be initialized to 0. */
+bool flecs_union_target_next_range(
+    const ecs_union_target_t *ut,
+    int32_t *word,
+    int32_t *bit,
+    int32_t *offset,
+    int32_t *count);
+
+/* Set target of entity in union storage. */
+void flecs_union_set(
+    ecs_component_record_t *cr,
+    const ecs_table_t *table,
+    ecs_entity_t entity,
+    ecs_entity_t tgt);
+
+#endif
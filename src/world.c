@@ -101,6 +101,7 @@ const ecs_entity_t EcsUnion =                       FLECS_HI_COMPONENT_ID + 55;
 /* Misc */
 const ecs_entity_t ecs_id(EcsDefaultChildComponent) = FLECS_HI_COMPONENT_ID + 56;
 const ecs_entity_t EcsOrderedChildren =               FLECS_HI_COMPONENT_ID + 57;
+const ecs_entity_t EcsDirtyRows =                     FLECS_HI_COMPONENT_ID + 58;
 
 /* Builtin predicate ids (used by query engine) */
 const ecs_entity_t EcsPredEq =                      FLECS_HI_COMPONENT_ID + 59;
@@ -193,6 +194,7 @@ static ecs_entity_t ecs_default_lookup_path[2] = { 0, 0 };
 #ifdef FLECS_ALERTS
 ECS_COMPONENT_DECLARE(EcsAlert);
 ECS_COMPONENT_DECLARE(EcsAlertInstance);
+ECS_COMPONENT_DECLARE(EcsAlertStats);
 ECS_COMPONENT_DECLARE(EcsAlertsActive);
 ECS_TAG_DECLARE(EcsAlertInfo);
 ECS_TAG_DECLARE(EcsAlertWarning);
@@ -679,6 +681,7 @@ void flecs_fini_store(ecs_world_t *world) {
     flecs_table_fini(world, &world->store.root);
     flecs_entities_clear(world);
     flecs_hashmap_fini(&world->store.table_map);
+    flecs_table_edge_cache_fini(world);
 
     ecs_assert(ecs_vec_count(&world->store.marked_ids) == 0, 
         ECS_INTERNAL_ERROR, NULL);
@@ -926,6 +929,9 @@ ecs_world_t *ecs_mini(void) {
     flecs_name_index_init(&world->symbols, a);
     ecs_vec_init_t(a, &world->fini_actions, ecs_action_elem_t, 0);
     ecs_vec_init_t(a, &world->component_ids, ecs_id_t, 0);
+    ecs_vec_init_t(a, &world->delete_queue.stack, ecs_delete_queue_elem_t, 0);
+    ecs_vec_init_t(a, &world->delete_queue.leaves, ecs_entity_t, 0);
+    ecs_vec_init_t(a, &world->observer_yield_queue, ecs_observer_t*, 0);
 
     world->info.time_scale = 1.0;
     if (ecs_os_has_time()) {
@@ -933,6 +939,7 @@ ecs_world_t *ecs_mini(void) {
     }
 
     ecs_set_stage_count(world, 1);
+    flecs_async_queue_init(&world->async_queue);
     ecs_default_lookup_path[0] = EcsFlecsCore;
     ecs_set_lookup_path(world, ecs_default_lookup_path);
     flecs_init_store(world);
@@ -1170,6 +1177,16 @@ int ecs_fini(
 
     world->flags |= EcsWorldQuit;
 
+    /* Queries in the plan cache reference entities that are about to be 
+     * deleted, so release them first */
+    flecs_query_plan_cache_fini(world);
+
+    /* Don't invalidate cached paths one by one while deleting entities */
+    flecs_path_cache_fini(world);
+
+    /* Remaining entities in the incremental delete queue are deleted below */
+    flecs_delete_queue_fini(world);
+
     /* Delete root entities first using regular APIs. This ensures that cleanup
      * policies get a chance to execute. */
     ecs_dbg_1("#[bold]cleanup root entities");
@@ -1228,7 +1245,10 @@ int ecs_fini(
     flecs_name_index_fini(&world->aliases);
     flecs_name_index_fini(&world->symbols);
     ecs_set_stage_count(world, 0);
+    flecs_async_queue_fini(&world->async_queue);
     ecs_vec_fini_t(&world->allocator, &world->component_ids, ecs_id_t);
+    ecs_vec_fini_t(&world->allocator, &world->observer_yield_queue, 
+        ecs_observer_t*);
     ecs_log_pop_1();
 
     flecs_world_allocators_fini(world);
@@ -1304,6 +1324,18 @@ error:
     return;
 }
 
+void ecs_precise_frame_pacing(
+    ecs_world_t *world,
+    bool enable)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ecs_check(ecs_os_has_time(), ECS_MISSING_OS_API, NULL);
+    ECS_BIT_COND(world->flags, EcsWorldPreciseFramePacing, enable);
+    world->frame_deadline = 0;
+error:
+    return;
+}
+
 void ecs_set_default_query_flags(
     ecs_world_t *world,
     ecs_flags32_t flags)
@@ -1683,6 +1715,144 @@ done:
     return delete_count;
 }
 
+void ecs_set_table_gc(
+    ecs_world_t *world,
+    const ecs_table_gc_desc_t *desc)
+{
+    flecs_poly_assert(world, ecs_world_t);
+
+    if (desc) {
+        ecs_check(desc->clear_frames >= 0, ECS_INVALID_PARAMETER, NULL);
+        ecs_check(desc->delete_frames >= 0, ECS_INVALID_PARAMETER, NULL);
+        world->store.table_gc = *desc;
+    } else {
+        ecs_os_zeromem(&world->store.table_gc);
+    }
+error:
+    return;
+}
+
+void ecs_enable_union_index(
+    ecs_world_t *world,
+    bool enable)
+{
+    flecs_poly_assert(world, ecs_world_t);
+    ECS_BIT_COND(world->flags, EcsWorldUnionIndex, enable);
+}
+
+/* Visit one table. Returns true if the table was cleared or deleted. */
+static
+bool flecs_table_gc_visit(
+    ecs_world_t *world,
+    ecs_table_t *table,
+    int64_t frame)
+{
+    const ecs_table_gc_desc_t *desc = &world->store.table_gc;
+    ecs_table__t *meta = table->_;
+
+    /* If the table was used since the last visit, it was reused */
+    if (ecs_table_count(table) || (meta->gc_frame && 
+        (meta->gc_version != table->version))) 
+    {
+        if (meta->gc_pooled) {
+            meta->gc_pooled = false;
+            world->info.table_pool_count --;
+            world->info.table_pool_hit_total ++;
+        }
+
+        meta->gc_frame = 0;
+        if (ecs_table_count(table)) {
+            return false;
+        }
+    }
+
+    if (!meta->gc_frame) {
+        meta->gc_frame = frame + 1;
+        meta->gc_version = table->version;
+        return false;
+    }
+
+    int64_t empty_frames = frame - (meta->gc_frame - 1);
+
+    if (desc->delete_frames && (empty_frames >= desc->delete_frames)) {
+        flecs_table_fini(world, table);
+        world->info.table_gc_delete_total ++;
+        return true;
+    }
+
+    if (desc->clear_frames && !meta->gc_pooled && 
+        (empty_frames >= desc->clear_frames)) 
+    {
+        flecs_table_shrink(world, table);
+        meta->gc_pooled = true;
+        world->info.table_pool_count ++;
+        return true;
+    }
+
+    return false;
+}
+
+void flecs_table_gc_run(
+    ecs_world_t *world)
+{
+    const ecs_table_gc_desc_t *desc = &world->store.table_gc;
+    if (!desc->clear_frames && !desc->delete_frames) {
+        return;
+    }
+
+    ecs_os_perf_trace_push("flecs.table_gc");
+
+    ecs_time_t start = {0}, cur = {0};
+    bool time_budget = false;
+    int32_t measure_budget_after = 64;
+    double time_budget_seconds = desc->time_budget_seconds;
+    int64_t frame = world->info.frame_count_total;
+
+    if (ECS_NEQZERO(time_budget_seconds)) {
+        ecs_time_measure(&start);
+        time_budget = true;
+    }
+
+    /* Visit each table at most once, continue where the last run stopped.
+     * Iterate backwards, so that deleting a table (which moves the last table
+     * to the deleted index) doesn't skip tables. */
+    int32_t visit, count = flecs_sparse_count(&world->store.tables);
+    int32_t i = world->store.table_gc_cursor;
+    for (visit = 0; visit < count; visit ++) {
+        int32_t cur_count = flecs_sparse_count(&world->store.tables);
+        if (!cur_count) {
+            break;
+        }
+
+        if ((i < 0) || (i >= cur_count)) {
+            i = cur_count - 1;
+        }
+
+        ecs_table_t *table = flecs_sparse_get_dense_t(&world->store.tables,
+            ecs_table_t, i);
+        i --;
+
+        if (table->id && !table->_->lock) {
+            if (flecs_table_gc_visit(world, table, frame)) {
+                measure_budget_after = 1;
+            }
+        }
+
+        if (time_budget && !(-- measure_budget_after)) {
+            cur = start;
+            if (ecs_time_measure(&cur) > time_budget_seconds) {
+                break;
+            }
+
+            measure_budget_after = 64;
+        }
+    }
+
+    world->store.table_gc_cursor = i;
+
+    ecs_os_perf_trace_pop("flecs.table_gc");
+}
+
 ecs_entities_t ecs_get_entities(
     const ecs_world_t *world)
 {
@@ -66,6 +66,13 @@ typedef struct ecs_store_t {
     /* Records cache */
     ecs_vec_t records;
 
+    /* Cache for hi edge lookups */
+    ecs_graph_edge_cache_t edge_cache;
+
+    /* Table GC configuration, and dense index of next table to visit */
+    ecs_table_gc_desc_t table_gc;
+    int32_t table_gc_cursor;
+
     /* Stack of ids being deleted during cleanup action. */
     ecs_vec_t marked_ids;            /* vector<ecs_marked_id_t> */
 
@@ -75,13 +82,44 @@ typedef struct ecs_store_t {
     ecs_vec_t deleted_components;    /* vector<ecs_entity_t> */
 } ecs_store_t;
 
+/* Entity queued with ecs_delete_incremental() */
+typedef struct ecs_delete_queue_elem_t {
+    ecs_entity_t entity;
+    bool expanded;                   /* Were children added to the queue */
+} ecs_delete_queue_elem_t;
+
+/* Entities that are deleted incrementally. Subtrees are walked depth first so
+ * that children are deleted before their parent, which means that deleting an
+ * entity never cascades to a large number of other entities. */
+typedef struct ecs_delete_queue_t {
+    ecs_vec_t stack;                 /* vector<ecs_delete_queue_elem_t> */
+    ecs_vec_t leaves;                /* vector<ecs_entity_t> without children */
+} ecs_delete_queue_t;
+
 /* fini actions */
 typedef struct ecs_action_elem_t {
     ecs_fini_action_t action;
     void *ctx;
 } ecs_action_elem_t;
 
+/* Log-linear histogram for frame times. Times below 32us have their own bucket,
+ * larger times are stored in 32 buckets per power of two. */
+#define FLECS_FRAME_HISTOGRAM_SUB_BITS (5)
+#define FLECS_FRAME_HISTOGRAM_SUB (1 << FLECS_FRAME_HISTOGRAM_SUB_BITS)
+#define FLECS_FRAME_HISTOGRAM_BUCKETS (FLECS_FRAME_HISTOGRAM_SUB * 20)
+
+/* Number of frames after which older frame times start to count less */
+#define FLECS_FRAME_HISTOGRAM_WINDOW (512)
+
+typedef struct ecs_frame_histogram_t {
+    uint32_t buckets[FLECS_FRAME_HISTOGRAM_BUCKETS]; /* Frame times in us */
+    uint32_t count;                  /* Number of frames in histogram */
+    uint64_t max;                    /* Max frame time in current window (ns) */
+    uint64_t max_prev;               /* Max frame time in previous window (ns) */
+} ecs_frame_histogram_t;
+
 typedef struct ecs_pipeline_state_t ecs_pipeline_state_t;
+typedef struct ecs_worker_job_t ecs_worker_job_t;
 
 /** The world stores and manages all ECS data. An application can have more than
  * one world, but data is not shared between worlds. */
@@ -139,9 +177,25 @@ struct ecs_world_t {
     ecs_hashmap_t aliases;
     ecs_hashmap_t symbols;
 
+    /* -- Queries created from expressions -- */
+    ecs_query_plan_cache_t query_plans;
+
+    /* -- Cached entity paths -- */
+    ecs_path_cache_t path_cache;
+
+    /* -- Incremental delete -- */
+    ecs_delete_queue_t delete_queue;
+
+    /* -- Observers that yield existing matches incrementally -- */
+    ecs_vec_t observer_yield_queue;  /* vector<ecs_observer_t*> */
+
+    /* -- Prefab instantiation -- */
+    int32_t instantiate_plan_generation; /* Invalidates instantiate plans */
+
     /* -- Staging -- */
     ecs_stage_t **stages;            /* Stages */
     int32_t stage_count;             /* Number of stages */
+    ecs_async_queue_t async_queue;   /* Commands enqueued from any thread */
 
     /* -- Component ids -- */
     ecs_vec_t component_ids;         /* World local component ids */
@@ -162,6 +216,7 @@ struct ecs_world_t {
     int32_t workers_running;         /* Number of threads running */
     int32_t workers_waiting;         /* Number of workers waiting on sync */
     ecs_pipeline_state_t* pq;        /* Pointer to the pipeline for the workers to execute */
+    ecs_worker_job_t *job;           /* If set, workers run job instead of pipeline */
     bool workers_use_task_api;       /* Workers are short-lived tasks, not long-running threads */
 
     /* -- Exclusive access */
@@ -172,6 +227,9 @@ struct ecs_world_t {
     ecs_time_t world_start_time;     /* Timestamp of simulation start */
     ecs_time_t frame_start_time;     /* Timestamp of frame start */
     ecs_ftime_t fps_sleep;           /* Sleep time to prevent fps overshoot */
+    uint64_t frame_deadline;         /* Deadline of last frame for precise pacing (ns) */
+    uint64_t frame_spin_time;        /* Time spun before deadline (ns) */
+    ecs_frame_histogram_t frame_histogram; /* Distribution of frame times */
 
     /* -- Metrics -- */
     ecs_world_info_t info;
@@ -262,6 +320,10 @@ void flecs_notify_tables(
     ecs_id_t id,
     ecs_table_event_t *event);
 
+/* Run table GC configured with ecs_set_table_gc(). */
+void flecs_table_gc_run(
+    ecs_world_t *world);
+
 /* Increase table version (used for invalidating ecs_ref_t's). */
 void flecs_increment_table_version(
     ecs_world_t *world,
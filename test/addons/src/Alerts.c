@@ -2585,3 +2585,310 @@ void Alerts_alert_counts(void) {
 
     ecs_fini(world);
 }
+
+void Alerts_incremental_skip_unchanged(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_IMPORT(world, FlecsAlerts);
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, Tag);
+
+    ecs_entity_t e1 = ecs_entity(world, { .name = "e1" });
+    ecs_entity_t e2 = ecs_entity(world, { .name = "e2" });
+    ecs_add(world, e1, Position);
+    ecs_add(world, e2, Position);
+    ecs_add(world, e2, Tag);
+
+    ecs_entity_t alert = ecs_alert(world, {
+        .entity = ecs_entity(world, { .name = "position_without_velocity" }),
+        .query.expr = "Position, !Velocity",
+        .incremental = true
+    });
+    test_assert(alert != 0);
+
+    ecs_progress(world, 1.0);
+
+    test_int(ecs_count(world, EcsAlertInstance), 2);
+    {
+        const EcsAlertStats *stats = ecs_get(world, alert, EcsAlertStats);
+        test_assert(stats != NULL);
+        test_bool(stats->incremental, true);
+        /* Sources move to a table with AlertsActive, which is evaluated in 
+         * the same pass. */
+        test_int(stats->tables_evaluated, 4);
+        test_int(stats->tables_skipped, 0);
+        test_int(stats->instances_evaluated, 2);
+        test_int(stats->instances_skipped, 0);
+        test_assert(stats->eval_time_total >= stats->eval_time);
+    }
+
+    ecs_progress(world, 1.0);
+
+    test_int(ecs_count(world, EcsAlertInstance), 2);
+    {
+        const EcsAlertStats *stats = ecs_get(world, alert, EcsAlertStats);
+        test_assert(stats != NULL);
+        test_int(stats->tables_evaluated, 0);
+        test_int(stats->tables_skipped, 2);
+        test_int(stats->instances_evaluated, 0);
+        test_int(stats->instances_skipped, 2);
+    }
+
+    ecs_add(world, e1, Velocity);
+
+    ecs_progress(world, 1.0);
+
+    test_assert(!ecs_has(world, e1, EcsAlertsActive));
+    test_assert(ecs_has(world, e2, EcsAlertsActive));
+    test_int(ecs_count(world, EcsAlertInstance), 1);
+    {
+        const EcsAlertStats *stats = ecs_get(world, alert, EcsAlertStats);
+        test_assert(stats != NULL);
+        test_int(stats->tables_evaluated, 0); /* Table of e1 is empty */
+        test_int(stats->tables_skipped, 1);
+        test_int(stats->instances_evaluated, 1);
+        test_int(stats->instances_skipped, 1);
+    }
+
+    ecs_fini(world);
+}
+
+void Alerts_incremental_member_change(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_IMPORT(world, FlecsAlerts);
+
+    ECS_COMPONENT(world, Mass);
+
+    ecs_struct(world, {
+        .entity = ecs_id(Mass),
+        .members = {{ "value", ecs_id(ecs_f32_t), .error_range = { 0, 100 }}}
+    });
+
+    ecs_entity_t e1 = ecs_entity(world, { .name = "e1" });
+    ecs_set(world, e1, Mass, {50});
+
+    ecs_entity_t member = ecs_lookup(world, "Mass.value");
+    test_assert(member != 0);
+
+    ecs_entity_t alert = ecs_alert(world, {
+        .entity = ecs_entity(world, { .name = "high_mass" }),
+        .query.expr = "Mass",
+        .member = member,
+        .incremental = true
+    });
+    test_assert(alert != 0);
+
+    ecs_progress(world, 1.0);
+
+    test_assert(!ecs_has(world, e1, EcsAlertsActive));
+    test_int(ecs_count(world, EcsAlertInstance), 0);
+
+    ecs_set(world, e1, Mass, {150});
+
+    ecs_progress(world, 1.0);
+
+    test_assert(ecs_has(world, e1, EcsAlertsActive));
+    test_int(ecs_count(world, EcsAlertInstance), 1);
+    {
+        const EcsAlertStats *stats = ecs_get(world, alert, EcsAlertStats);
+        test_assert(stats != NULL);
+        test_bool(stats->incremental, true);
+        test_int(stats->tables_evaluated, 2); /* Source moved to new table */
+        test_int(stats->instances_evaluated, 1);
+    }
+
+    ecs_progress(world, 1.0);
+
+    test_assert(ecs_has(world, e1, EcsAlertsActive));
+    test_int(ecs_count(world, EcsAlertInstance), 1);
+    {
+        const EcsAlertStats *stats = ecs_get(world, alert, EcsAlertStats);
+        test_assert(stats != NULL);
+        test_int(stats->tables_evaluated, 0);
+        test_int(stats->tables_skipped, 1);
+        test_int(stats->instances_evaluated, 0);
+        test_int(stats->instances_skipped, 1);
+    }
+
+    ecs_set(world, e1, Mass, {25});
+
+    ecs_progress(world, 1.0);
+
+    test_assert(!ecs_has(world, e1, EcsAlertsActive));
+    test_int(ecs_count(world, EcsAlertInstance), 0);
+
+    ecs_fini(world);
+}
+
+void Alerts_incremental_range_change(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_IMPORT(world, FlecsAlerts);
+
+    ECS_COMPONENT(world, Mass);
+
+    ecs_struct(world, {
+        .entity = ecs_id(Mass),
+        .members = {{ "value", ecs_id(ecs_f32_t), .error_range = { 0, 100 }}}
+    });
+
+    ecs_entity_t e1 = ecs_entity(world, { .name = "e1" });
+    ecs_set(world, e1, Mass, {50});
+
+    ecs_entity_t member = ecs_lookup(world, "Mass.value");
+    test_assert(member != 0);
+
+    ecs_entity_t alert = ecs_alert(world, {
+        .entity = ecs_entity(world, { .name = "high_mass" }),
+        .query.expr = "Mass",
+        .member = member,
+        .incremental = true
+    });
+    test_assert(alert != 0);
+
+    ecs_progress(world, 1.0);
+
+    test_assert(!ecs_has(world, e1, EcsAlertsActive));
+    test_int(ecs_count(world, EcsAlertInstance), 0);
+
+    ecs_set(world, member, EcsMemberRanges, {
+        .error = { 0, 25 }
+    });
+
+    ecs_progress(world, 1.0);
+
+    test_assert(ecs_has(world, e1, EcsAlertsActive));
+    test_int(ecs_count(world, EcsAlertInstance), 1);
+
+    ecs_set(world, member, EcsMemberRanges, {
+        .error = { 0, 100 }
+    });
+
+    ecs_progress(world, 1.0);
+
+    test_assert(!ecs_has(world, e1, EcsAlertsActive));
+    test_int(ecs_count(world, EcsAlertInstance), 0);
+
+    ecs_fini(world);
+}
+
+void Alerts_incremental_recycled_source(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_IMPORT(world, FlecsAlerts);
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t e1 = ecs_new(world);
+    ecs_add(world, e1, Position);
+
+    ecs_entity_t alert = ecs_alert(world, {
+        .entity = ecs_entity(world, { .name = "position_without_velocity" }),
+        .query.expr = "Position, !Velocity",
+        .incremental = true
+    });
+    test_assert(alert != 0);
+
+    ecs_progress(world, 1.0);
+
+    test_assert(ecs_has(world, e1, EcsAlertsActive));
+    test_int(ecs_count(world, EcsAlertInstance), 1);
+
+    /* Recycle id of e1 before the alert instance of e1 is cleaned up */
+    ecs_delete(world, e1);
+    ecs_entity_t e2 = ecs_new(world);
+    test_assert((uint32_t)e2 == (uint32_t)e1);
+    ecs_add(world, e2, Position);
+
+    ecs_progress(world, 1.0);
+
+    test_assert(ecs_has(world, e2, EcsAlertsActive));
+    test_int(ecs_count(world, EcsAlertInstance), 1);
+    {
+        ecs_entity_t ai = ecs_get_alert(world, e2, alert);
+        test_assert(ai != 0);
+        const EcsMetricSource *source = ecs_get(world, ai, EcsMetricSource);
+        test_assert(source != NULL);
+        test_uint(source->entity, e2);
+    }
+
+    ecs_fini(world);
+}
+
+void Alerts_not_incremental_w_var(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_IMPORT(world, FlecsAlerts);
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t p = ecs_entity(world, { .name = "p" });
+    ecs_entity_t e1 = ecs_entity(world, { .name = "e1", .parent = p });
+    ecs_add(world, e1, Position);
+
+    ecs_entity_t alert = ecs_alert(world, {
+        .entity = ecs_entity(world, { .name = "parent_without_position" }),
+        .query.expr = "Position, (ChildOf, $parent), !Position($parent)",
+        .incremental = true
+    });
+    test_assert(alert != 0);
+
+    ecs_progress(world, 1.0);
+
+    test_assert(ecs_has(world, e1, EcsAlertsActive));
+    test_int(ecs_count(world, EcsAlertInstance), 1);
+    {
+        const EcsAlertStats *stats = ecs_get(world, alert, EcsAlertStats);
+        test_assert(stats != NULL);
+        test_bool(stats->incremental, false);
+        test_int(stats->tables_skipped, 0);
+        test_int(stats->instances_evaluated, 1);
+        test_int(stats->instances_skipped, 0);
+    }
+
+    /* Changing the parent doesn't change the table of e1 */
+    ecs_add(world, p, Position);
+
+    ecs_progress(world, 1.0);
+
+    test_assert(!ecs_has(world, e1, EcsAlertsActive));
+    test_int(ecs_count(world, EcsAlertInstance), 0);
+
+    ecs_fini(world);
+}
+
+void Alerts_not_incremental_by_default(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_IMPORT(world, FlecsAlerts);
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t e1 = ecs_entity(world, { .name = "e1" });
+    ecs_add(world, e1, Position);
+
+    ecs_entity_t alert = ecs_alert(world, {
+        .entity = ecs_entity(world, { .name = "position_without_velocity" }),
+        .query.expr = "Position, !Velocity"
+    });
+    test_assert(alert != 0);
+
+    ecs_progress(world, 1.0);
+    ecs_progress(world, 1.0);
+
+    test_int(ecs_count(world, EcsAlertInstance), 1);
+    {
+        const EcsAlertStats *stats = ecs_get(world, alert, EcsAlertStats);
+        test_assert(stats != NULL);
+        test_bool(stats->incremental, false);
+        test_assert(stats->tables_evaluated != 0);
+        test_int(stats->tables_skipped, 0);
+    }
+
+    ecs_fini(world);
+}
@@ -2419,3 +2419,352 @@ void Metrics_pair_member_counter_increment(void) {
 
     ecs_fini(world);
 }
+
+void Metrics_prometheus_gauge(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_IMPORT(world, FlecsMetrics);
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_struct(world, {
+        .entity = ecs_id(Position),
+        .members = {
+            { "x", ecs_id(ecs_f32_t) },
+            { "y", ecs_id(ecs_f32_t) },
+        }
+    });
+
+    ecs_entity_t m = ecs_metric(world, {
+        .entity = ecs_entity(world, { .name = "metrics.position_y" }),
+        .member = ecs_lookup(world, "Position.y"),
+        .kind = EcsGauge
+    });
+    test_assert(m != 0);
+
+    ecs_entity_t e1 = ecs_entity(world, { .name = "e1" });
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_entity_t e2 = ecs_entity(world, { .name = "e2" });
+    ecs_set(world, e2, Position, {20, 30.5});
+
+    ecs_progress(world, 0);
+
+    test_str(ecs_metrics_to_prometheus(world),
+        "# TYPE metrics_position_y gauge\n"
+        "metrics_position_y{entity=\"e1\"} 20\n"
+        "metrics_position_y{entity=\"e2\"} 30.5\n");
+
+    ecs_set(world, e1, Position, {10, 25});
+
+    ecs_progress(world, 0);
+
+    test_str(ecs_metrics_to_prometheus(world),
+        "# TYPE metrics_position_y gauge\n"
+        "metrics_position_y{entity=\"e1\"} 25\n"
+        "metrics_position_y{entity=\"e2\"} 30.5\n");
+
+    ecs_fini(world);
+}
+
+void Metrics_prometheus_counter(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_IMPORT(world, FlecsMetrics);
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_struct(world, {
+        .entity = ecs_id(Position),
+        .members = {
+            { "x", ecs_id(ecs_f32_t) },
+            { "y", ecs_id(ecs_f32_t) },
+        }
+    });
+
+    ecs_entity_t m = ecs_metric(world, {
+        .entity = ecs_entity(world, { .name = "metrics.position_y" }),
+        .member = ecs_lookup(world, "Position.y"),
+        .kind = EcsCounterIncrement
+    });
+    test_assert(m != 0);
+
+    ecs_entity_t e1 = ecs_entity(world, { .name = "e1" });
+    ecs_set(world, e1, Position, {10, 20});
+
+    ecs_progress(world, 1);
+    ecs_progress(world, 1);
+
+    test_str(ecs_metrics_to_prometheus(world),
+        "# TYPE metrics_position_y counter\n"
+        "metrics_position_y{entity=\"e1\"} 40\n");
+
+    ecs_fini(world);
+}
+
+void Metrics_prometheus_oneof(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_IMPORT(world, FlecsMetrics);
+
+    ECS_ENTITY(world, Color, OneOf, Exclusive);
+    ECS_ENTITY(world, Red,   (ChildOf, Color));
+    ECS_ENTITY(world, Green, (ChildOf, Color));
+    ECS_ENTITY(world, Blue,  (ChildOf, Color));
+
+    ecs_entity_t m = ecs_metric(world, {
+        .entity = ecs_entity(world, { .name = "metrics.color" }),
+        .id = ecs_pair(Color, EcsWildcard),
+        .targets = true,
+        .kind = EcsGauge
+    });
+    test_assert(m != 0);
+
+    ecs_entity_t e1 = ecs_entity(world, { .name = "e1" });
+    ecs_add_pair(world, e1, Color, Red);
+    ecs_entity_t e2 = ecs_entity(world, { .name = "e2" });
+    ecs_add_pair(world, e2, Color, Blue);
+
+    ecs_progress(world, 0);
+
+    test_str(ecs_metrics_to_prometheus(world),
+        "# TYPE metrics_color gauge\n"
+        "metrics_color{entity=\"e1\",target=\"red\"} 1\n"
+        "metrics_color{entity=\"e1\",target=\"green\"} 0\n"
+        "metrics_color{entity=\"e1\",target=\"blue\"} 0\n"
+        "metrics_color{entity=\"e2\",target=\"red\"} 0\n"
+        "metrics_color{entity=\"e2\",target=\"green\"} 0\n"
+        "metrics_color{entity=\"e2\",target=\"blue\"} 1\n");
+
+    ecs_fini(world);
+}
+
+void Metrics_prometheus_id_count(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_IMPORT(world, FlecsMetrics);
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t m = ecs_metric(world, {
+        .entity = ecs_entity(world, { .name = "metrics.position" }),
+        .id = ecs_id(Position),
+        .kind = EcsCounterId
+    });
+    test_assert(m != 0);
+
+    ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_progress(world, 1);
+
+    test_str(ecs_metrics_to_prometheus(world),
+        "# TYPE metrics_position counter\n"
+        "metrics_position 2\n");
+
+    ecs_fini(world);
+}
+
+void Metrics_prometheus_id_target_count(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_IMPORT(world, FlecsMetrics);
+
+    ECS_TAG(world, Color);
+    ECS_TAG(world, Red);
+    ECS_TAG(world, Green);
+
+    ecs_entity_t m = ecs_metric(world, {
+        .entity = ecs_entity(world, { .name = "metrics.color" }),
+        .id = ecs_pair(Color, EcsWildcard),
+        .targets = true,
+        .kind = EcsCounterId
+    });
+    test_assert(m != 0);
+
+    ecs_entity_t e1 = ecs_new(world);
+    ecs_add_pair(world, e1, Color, Red);
+    ecs_entity_t e2 = ecs_new(world);
+    ecs_add_pair(world, e2, Color, Red);
+    ecs_add_pair(world, e2, Color, Green);
+
+    ecs_progress(world, 1);
+
+    test_str(ecs_metrics_to_prometheus(world),
+        "# TYPE metrics_color counter\n"
+        "metrics_color{entity=\"Green\"} 1\n"
+        "metrics_color{entity=\"Red\"} 2\n");
+
+    ecs_fini(world);
+}
+
+void Metrics_prometheus_brief(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_IMPORT(world, FlecsMetrics);
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t m = ecs_metric(world, {
+        .entity = ecs_entity(world, { .name = "metrics.position" }),
+        .id = ecs_id(Position),
+        .kind = EcsCounterId,
+        .brief = "Number of entities\nwith \"Position\" \\ component"
+    });
+    test_assert(m != 0);
+
+    ecs_progress(world, 1);
+
+    test_str(ecs_metrics_to_prometheus(world),
+        "# HELP metrics_position Number of entities\\n"
+            "with \"Position\" \\\\ component\n"
+        "# TYPE metrics_position counter\n"
+        "metrics_position 0\n");
+
+    ecs_fini(world);
+}
+
+void Metrics_prometheus_escape_label(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_IMPORT(world, FlecsMetrics);
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t m = ecs_metric(world, {
+        .entity = ecs_entity(world, { .name = "metrics.position" }),
+        .id = ecs_id(Position),
+        .kind = EcsGauge
+    });
+    test_assert(m != 0);
+
+    ecs_entity_t e1 = ecs_new(world);
+    ecs_set_name(world, e1, "foo\"bar\\");
+    ecs_set(world, e1, Position, {10, 20});
+
+    ecs_progress(world, 0);
+
+    test_str(ecs_metrics_to_prometheus(world),
+        "# TYPE metrics_position gauge\n"
+        "metrics_position{entity=\"foo\\\"bar\\\\\"} 1\n");
+
+    ecs_fini(world);
+}
+
+void Metrics_prometheus_name(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_IMPORT(world, FlecsMetrics);
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t m = ecs_metric(world, {
+        .entity = ecs_entity(world, { .name = "game.metrics.position-count" }),
+        .id = ecs_id(Position),
+        .kind = EcsCounterId
+    });
+    test_assert(m != 0);
+
+    ecs_progress(world, 1);
+
+    test_str(ecs_metrics_to_prometheus(world),
+        "# TYPE game_metrics_position_count counter\n"
+        "game_metrics_position_count 0\n");
+
+    ecs_fini(world);
+}
+
+void Metrics_prometheus_new_instance(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_IMPORT(world, FlecsMetrics);
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_struct(world, {
+        .entity = ecs_id(Position),
+        .members = {
+            { "x", ecs_id(ecs_f32_t) },
+            { "y", ecs_id(ecs_f32_t) },
+        }
+    });
+
+    ecs_entity_t m = ecs_metric(world, {
+        .entity = ecs_entity(world, { .name = "metrics.position_y" }),
+        .member = ecs_lookup(world, "Position.y"),
+        .kind = EcsGauge
+    });
+    test_assert(m != 0);
+
+    ecs_entity_t e1 = ecs_entity(world, { .name = "e1" });
+    ecs_set(world, e1, Position, {10, 20});
+
+    ecs_progress(world, 0);
+
+    test_str(ecs_metrics_to_prometheus(world),
+        "# TYPE metrics_position_y gauge\n"
+        "metrics_position_y{entity=\"e1\"} 20\n");
+
+    ecs_entity_t e2 = ecs_entity(world, { .name = "e2" });
+    ecs_set(world, e2, Position, {20, 30});
+
+    ecs_progress(world, 0);
+
+    test_str(ecs_metrics_to_prometheus(world),
+        "# TYPE metrics_position_y gauge\n"
+        "metrics_position_y{entity=\"e1\"} 20\n"
+        "metrics_position_y{entity=\"e2\"} 30\n");
+
+    ecs_fini(world);
+}
+
+void Metrics_prometheus_delete_source(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_IMPORT(world, FlecsMetrics);
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_struct(world, {
+        .entity = ecs_id(Position),
+        .members = {
+            { "x", ecs_id(ecs_f32_t) },
+            { "y", ecs_id(ecs_f32_t) },
+        }
+    });
+
+    ecs_entity_t m = ecs_metric(world, {
+        .entity = ecs_entity(world, { .name = "metrics.position_y" }),
+        .member = ecs_lookup(world, "Position.y"),
+        .kind = EcsGauge
+    });
+    test_assert(m != 0);
+
+    ecs_entity_t e1 = ecs_entity(world, { .name = "e1" });
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_entity_t e2 = ecs_entity(world, { .name = "e2" });
+    ecs_set(world, e2, Position, {20, 30});
+
+    ecs_progress(world, 0);
+
+    test_str(ecs_metrics_to_prometheus(world),
+        "# TYPE metrics_position_y gauge\n"
+        "metrics_position_y{entity=\"e1\"} 20\n"
+        "metrics_position_y{entity=\"e2\"} 30\n");
+
+    ecs_delete(world, e1);
+
+    ecs_progress(world, 0);
+
+    test_str(ecs_metrics_to_prometheus(world),
+        "# TYPE metrics_position_y gauge\n"
+        "metrics_position_y{entity=\"e2\"} 30\n");
+
+    ecs_fini(world);
+}
+
+void Metrics_prometheus_no_metrics(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_IMPORT(world, FlecsMetrics);
+
+    test_str(ecs_metrics_to_prometheus(world), "");
+
+    ecs_fini(world);
+}
+
+void Metrics_prometheus_not_imported(void) {
+    ecs_world_t *world = ecs_mini();
+
+    test_assert(ecs_metrics_to_prometheus(world) == NULL);
+
+    ecs_fini(world);
+}
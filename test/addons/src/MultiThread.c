@@ -1394,3 +1394,140 @@ void MultiThread_run_single_thread_on_main(void) {
 
     ecs_fini(world);
 }
+
+static int32_t parallel_invoked = 0;
+
+static void ParallelInc(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    int32_t *step = it->ctx;
+
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        p[i].x += *step;
+    }
+
+    ecs_os_ainc(&parallel_invoked);
+}
+
+void MultiThread_parallel_each(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT_DEFINE(world, Position);
+
+    int i, ENTITIES = 100;
+    ecs_entity_t *handles = ecs_os_alloca(sizeof(ecs_entity_t) * ENTITIES);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_insert(world, ecs_value(Position, {0, 0}));
+    }
+
+    set_worker_kind(world, 4);
+
+    ecs_query_t *q = ecs_query(world, { .terms = {{ ecs_id(Position) }}});
+    int32_t step = 2;
+    ecs_query_parallel_each(world, q, ParallelInc, &step);
+    test_int(parallel_invoked, 4);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        test_int(ecs_get(world, handles[i], Position)->x, 2);
+    }
+
+    ecs_query_parallel_each(world, q, ParallelInc, &step);
+    test_int(parallel_invoked, 8);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        test_int(ecs_get(world, handles[i], Position)->x, 4);
+    }
+
+    ecs_query_fini(q);
+    ecs_fini(world);
+}
+
+void MultiThread_parallel_each_no_threads(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT_DEFINE(world, Position);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {0, 0}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {0, 0}));
+
+    ecs_query_t *q = ecs_query(world, { .terms = {{ ecs_id(Position) }}});
+    int32_t step = 1;
+    ecs_query_parallel_each(world, q, ParallelInc, &step);
+    test_int(parallel_invoked, 1);
+
+    test_int(ecs_get(world, e1, Position)->x, 1);
+    test_int(ecs_get(world, e2, Position)->x, 1);
+
+    ecs_query_fini(q);
+    ecs_fini(world);
+}
+
+static void ParallelAddTag(ecs_iter_t *it) {
+    test_assert(ecs_is_deferred(it->world));
+
+    int i;
+    for (i = 0; i < it->count; i ++) {
+        ecs_add(it->world, it->entities[i], Tag);
+    }
+}
+
+void MultiThread_parallel_each_deferred_add(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT_DEFINE(world, Position);
+    ECS_TAG_DEFINE(world, Tag);
+
+    int i, ENTITIES = 100;
+    ecs_entity_t *handles = ecs_os_alloca(sizeof(ecs_entity_t) * ENTITIES);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_insert(world, ecs_value(Position, {0, 0}));
+    }
+
+    set_worker_kind(world, 4);
+
+    ecs_query_t *q = ecs_query(world, { 
+        .terms = {{ ecs_id(Position) }, { Tag, .oper = EcsNot }}
+    });
+
+    ecs_query_parallel_each(world, q, ParallelAddTag, NULL);
+    test_assert(!ecs_is_deferred(world));
+
+    for (i = 0; i < ENTITIES; i ++) {
+        test_assert(ecs_has(world, handles[i], Tag));
+    }
+
+    test_int(ecs_query_count(q).entities, 0);
+
+    ecs_query_fini(q);
+    ecs_fini(world);
+}
+
+void MultiThread_parallel_each_after_progress(void) {
+    ecs_world_t *world = init_world();
+
+    int i, ENTITIES = 10;
+    ecs_entity_t *handles = ecs_os_alloca(sizeof(ecs_entity_t) * ENTITIES);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        handles[i] = ecs_insert(world, ecs_value(Position, {0, 0}));
+    }
+
+    set_worker_kind(world, 3);
+
+    ecs_progress(world, 0);
+
+    ecs_query_t *q = ecs_query(world, { .terms = {{ ecs_id(Position) }}});
+    int32_t step = 10;
+    ecs_query_parallel_each(world, q, ParallelInc, &step);
+
+    ecs_progress(world, 0);
+
+    for (i = 0; i < ENTITIES; i ++) {
+        test_int(ecs_get(world, handles[i], Position)->x, 12);
+    }
+
+    ecs_query_fini(q);
+    ecs_fini(world);
+}
@@ -3369,3 +3369,590 @@ void Pipeline_empty_pipeline_after_disable_phase(void) {
 
     ecs_fini(world);
 }
+
+static
+ecs_entity_t concurrent_pipeline(ecs_world_t *world) {
+    return ecs_pipeline(world, {
+        .query.terms = {
+            { .id = EcsSystem },
+            { .id = EcsPhase, .src.id = EcsCascade, .trav = EcsDependsOn },
+            { .id = EcsDisabled, .src.id = EcsUp, .trav = EcsDependsOn, .oper = EcsNot },
+            { .id = EcsDisabled, .src.id = EcsUp, .trav = EcsChildOf, .oper = EcsNot }
+        },
+        .concurrent = true
+    });
+}
+
+static int32_t c_write_pos_invoked = 0;
+static int32_t c_write_vel_invoked = 0;
+static int32_t c_write_mass_invoked = 0;
+static int32_t c_read_pos_invoked = 0;
+
+static void ConcurrentWritePos(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    for (int i = 0; i < it->count; i ++) {
+        p[i].x ++;
+    }
+    ecs_os_ainc(&c_write_pos_invoked);
+}
+
+static void ConcurrentWriteVel(ecs_iter_t *it) {
+    Velocity *v = ecs_field(it, Velocity, 0);
+    for (int i = 0; i < it->count; i ++) {
+        v[i].x ++;
+    }
+    ecs_os_ainc(&c_write_vel_invoked);
+}
+
+static void ConcurrentWriteMass(ecs_iter_t *it) {
+    Mass *m = ecs_field(it, Mass, 0);
+    for (int i = 0; i < it->count; i ++) {
+        m[i] ++;
+    }
+    ecs_os_ainc(&c_write_mass_invoked);
+}
+
+static void ConcurrentReadPos(ecs_iter_t *it) {
+    const Position *p = ecs_field(it, Position, 0);
+    const int32_t *frame = it->ctx;
+    for (int i = 0; i < it->count; i ++) {
+        test_int(p[i].x, *frame);
+    }
+    ecs_os_ainc(&c_read_pos_invoked);
+}
+
+static void concurrent_systems(
+    ecs_world_t *world,
+    int32_t threads,
+    bool concurrent)
+{
+    ECS_COMPONENT_DEFINE(world, Position);
+    ECS_COMPONENT_DEFINE(world, Velocity);
+    ECS_COMPONENT(world, Mass);
+
+    if (concurrent) {
+        ecs_set_pipeline(world, concurrent_pipeline(world));
+    }
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = ConcurrentWritePos,
+        .multi_threaded = true
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Velocity) }},
+        .callback = ConcurrentWriteVel,
+        .multi_threaded = true
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Mass), .inout = EcsOut }},
+        .callback = ConcurrentWriteMass,
+        .multi_threaded = true
+    });
+
+    for (int i = 0; i < 100; i ++) {
+        ecs_entity_t e = ecs_new(world);
+        ecs_set(world, e, Position, {0, 0});
+        ecs_set(world, e, Velocity, {0, 0});
+        ecs_set(world, e, Mass, {0});
+    }
+
+    if (threads) {
+        ecs_set_threads(world, threads);
+    }
+
+    ecs_progress(world, 0);
+    ecs_progress(world, 0);
+
+    ecs_iter_t it = ecs_each(world, Position);
+    while (ecs_each_next(&it)) {
+        for (int i = 0; i < it.count; i ++) {
+            ecs_entity_t e = it.entities[i];
+            test_int(ecs_get(world, e, Position)->x, 2);
+            test_int(ecs_get(world, e, Velocity)->x, 2);
+            test_int(*ecs_get(world, e, Mass), 2);
+        }
+    }
+}
+
+void Pipeline_concurrent_independent_systems(void) {
+    ecs_world_t *world = ecs_init();
+
+    concurrent_systems(world, 4, true);
+
+    /* Each system runs on a single thread */
+    test_int(c_write_pos_invoked, 2);
+    test_int(c_write_vel_invoked, 2);
+    test_int(c_write_mass_invoked, 2);
+
+    ecs_fini(world);
+}
+
+void Pipeline_concurrent_independent_systems_no_threads(void) {
+    ecs_world_t *world = ecs_init();
+
+    concurrent_systems(world, 0, true);
+
+    test_int(c_write_pos_invoked, 2);
+    test_int(c_write_vel_invoked, 2);
+    test_int(c_write_mass_invoked, 2);
+
+    ecs_fini(world);
+}
+
+void Pipeline_concurrent_disabled(void) {
+    ecs_world_t *world = ecs_init();
+
+    concurrent_systems(world, 4, false);
+
+    /* Each system runs on all threads */
+    test_int(c_write_pos_invoked, 8);
+    test_int(c_write_vel_invoked, 8);
+    test_int(c_write_mass_invoked, 8);
+
+    ecs_fini(world);
+}
+
+void Pipeline_concurrent_conflicting_systems(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT_DEFINE(world, Position);
+    ECS_COMPONENT_DEFINE(world, Velocity);
+
+    ecs_set_pipeline(world, concurrent_pipeline(world));
+
+    int32_t frame = 0;
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = ConcurrentWritePos,
+        .multi_threaded = true
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Position), .inout = EcsIn }},
+        .callback = ConcurrentReadPos,
+        .ctx = &frame,
+        .multi_threaded = true
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Velocity) }},
+        .callback = ConcurrentWriteVel,
+        .multi_threaded = true
+    });
+
+    for (int i = 0; i < 100; i ++) {
+        ecs_entity_t e = ecs_new(world);
+        ecs_set(world, e, Position, {0, 0});
+        ecs_set(world, e, Velocity, {0, 0});
+    }
+
+    ecs_set_threads(world, 4);
+
+    frame = 1;
+    ecs_progress(world, 0);
+
+    /* ConcurrentWritePos and ConcurrentWriteVel run concurrently, ConcurrentReadPos runs 
+     * after ConcurrentWritePos on all threads. */
+    test_int(c_write_pos_invoked, 1);
+    test_int(c_write_vel_invoked, 1);
+    test_int(c_read_pos_invoked, 4);
+
+    frame = 2;
+    ecs_progress(world, 0);
+
+    test_int(c_write_pos_invoked, 2);
+    test_int(c_write_vel_invoked, 2);
+    test_int(c_read_pos_invoked, 8);
+
+    ecs_fini(world);
+}
+
+static void ConcurrentAddTagA(ecs_iter_t *it) {
+    for (int i = 0; i < it->count; i ++) {
+        ecs_add(it->world, it->entities[i], TagA);
+    }
+    ecs_os_ainc(&c_write_pos_invoked);
+}
+
+static void ConcurrentCheckNoTagA(ecs_iter_t *it) {
+    for (int i = 0; i < it->count; i ++) {
+        test_assert(!ecs_has(it->world, it->entities[i], TagA));
+    }
+    ecs_os_ainc(&c_read_pos_invoked);
+}
+
+void Pipeline_concurrent_merge_after_last_wave(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT_DEFINE(world, Position);
+    ECS_COMPONENT_DEFINE(world, Velocity);
+    ECS_TAG_DEFINE(world, TagA);
+
+    ecs_set_pipeline(world, concurrent_pipeline(world));
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = ConcurrentAddTagA,
+        .multi_threaded = true
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Velocity) }},
+        .callback = ConcurrentWriteVel,
+        .multi_threaded = true
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Position), .inout = EcsIn }},
+        .callback = ConcurrentCheckNoTagA,
+        .multi_threaded = true
+    });
+
+    ecs_entity_t e[10];
+    for (int i = 0; i < 10; i ++) {
+        e[i] = ecs_new(world);
+        ecs_set(world, e[i], Position, {0, 0});
+        ecs_set(world, e[i], Velocity, {0, 0});
+    }
+
+    ecs_set_threads(world, 2);
+
+    const ecs_world_info_t *info = ecs_get_world_info(world);
+    int64_t merge_count = info->merge_count_total;
+
+    ecs_progress(world, 0);
+
+    test_int(c_write_pos_invoked, 1);
+    test_int(c_write_vel_invoked, 1);
+    test_int(c_read_pos_invoked, 2);
+    test_int(info->merge_count_total, merge_count + 1);
+
+    for (int i = 0; i < 10; i ++) {
+        test_assert(ecs_has(world, e[i], TagA));
+    }
+
+    ecs_fini(world);
+}
+
+static int parallel_for_invoked;
+static int32_t parallel_for_count;
+
+static
+void test_parallel_for(
+    ecs_os_parallel_job_t job,
+    void *ctx,
+    int32_t count)
+{
+    parallel_for_invoked ++;
+    parallel_for_count = count;
+
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        job(ctx, i);
+    }
+}
+
+static int32_t stage_invoked[4];
+
+static
+void CountStages(ecs_iter_t *it) {
+    int32_t stage_id = ecs_stage_get_id(it->world);
+    test_assert(stage_id >= 0 && stage_id < 4);
+    stage_invoked[stage_id] += it->count;
+}
+
+void Pipeline_task_threads_w_parallel_for(void) {
+    ecs_os_set_api_defaults();
+    ecs_os_api_t os_api = ecs_os_get_api();
+    os_api.parallel_for_ = test_parallel_for;
+    ecs_os_set_api(&os_api);
+
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = CountStages,
+        .multi_threaded = true
+    });
+
+    int i;
+    for (i = 0; i < 8; i ++) {
+        ecs_insert(world, ecs_value(Position, {10, 20}));
+    }
+
+    ecs_set_task_threads(world, 4);
+
+    ecs_progress(world, 0);
+    test_int(parallel_for_invoked, 1);
+    test_int(parallel_for_count, 4);
+    test_int(stage_invoked[0], 2);
+    test_int(stage_invoked[1], 2);
+    test_int(stage_invoked[2], 2);
+    test_int(stage_invoked[3], 2);
+
+    ecs_progress(world, 0);
+    test_int(parallel_for_invoked, 2);
+    test_int(stage_invoked[0], 4);
+    test_int(stage_invoked[1], 4);
+    test_int(stage_invoked[2], 4);
+    test_int(stage_invoked[3], 4);
+
+    ecs_fini(world);
+}
+
+void Pipeline_task_threads_w_parallel_for_no_multi_threaded(void) {
+    ecs_os_set_api_defaults();
+    ecs_os_api_t os_api = ecs_os_get_api();
+    os_api.parallel_for_ = test_parallel_for;
+    ecs_os_set_api(&os_api);
+
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = CountStages
+    });
+
+    int i;
+    for (i = 0; i < 8; i ++) {
+        ecs_insert(world, ecs_value(Position, {10, 20}));
+    }
+
+    ecs_set_task_threads(world, 4);
+
+    ecs_progress(world, 0);
+    test_int(parallel_for_invoked, 0);
+    test_int(stage_invoked[0], 8);
+    test_int(stage_invoked[1], 0);
+    test_int(stage_invoked[2], 0);
+    test_int(stage_invoked[3], 0);
+
+    ecs_fini(world);
+}
+
+void Pipeline_parallel_each_w_parallel_for(void) {
+    ecs_os_set_api_defaults();
+    ecs_os_api_t os_api = ecs_os_get_api();
+    os_api.parallel_for_ = test_parallel_for;
+    ecs_os_set_api(&os_api);
+
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    int i;
+    for (i = 0; i < 8; i ++) {
+        ecs_insert(world, ecs_value(Position, {10, 20}));
+    }
+
+    ecs_set_task_threads(world, 4);
+
+    ecs_query_t *q = ecs_query(world, { .terms = {{ ecs_id(Position) }} });
+    ecs_query_parallel_each(world, q, CountStages, NULL);
+
+    test_int(parallel_for_invoked, 1);
+    test_int(parallel_for_count, 4);
+    test_int(stage_invoked[0], 2);
+    test_int(stage_invoked[1], 2);
+    test_int(stage_invoked[2], 2);
+    test_int(stage_invoked[3], 2);
+
+    ecs_query_fini(q);
+    ecs_fini(world);
+}
+
+static ecs_os_api_thread_new_t test_thread_new_fn;
+static int32_t threads_created;
+
+static
+ecs_os_thread_t test_thread_new(
+    ecs_os_thread_callback_t callback,
+    void *param)
+{
+    ecs_os_ainc(&threads_created);
+    return test_thread_new_fn(callback, param);
+}
+
+void Pipeline_task_threads_reuse_threads(void) {
+    ecs_os_set_api_defaults();
+    ecs_os_api_t os_api = ecs_os_get_api();
+    test_assert(os_api.parallel_for_ != NULL);
+    test_thread_new_fn = os_api.thread_new_;
+    os_api.thread_new_ = test_thread_new;
+    os_api.task_new_ = test_thread_new;
+    ecs_os_set_api(&os_api);
+
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = CountStages,
+        .multi_threaded = true
+    });
+
+    int i;
+    for (i = 0; i < 8; i ++) {
+        ecs_insert(world, ecs_value(Position, {10, 20}));
+    }
+
+    ecs_set_task_threads(world, 4);
+
+    for (i = 0; i < 10; i ++) {
+        ecs_progress(world, 0);
+    }
+
+    /* Threads of the builtin pool are created once and reused */
+    test_int(threads_created, 3);
+    test_int(stage_invoked[0], 20);
+    test_int(stage_invoked[1], 20);
+    test_int(stage_invoked[2], 20);
+    test_int(stage_invoked[3], 20);
+
+    ecs_fini(world);
+}
+
+void Pipeline_task_threads_w_custom_task_new(void) {
+    ecs_os_set_api_defaults();
+    ecs_os_api_t os_api = ecs_os_get_api();
+    test_thread_new_fn = os_api.task_new_;
+    os_api.task_new_ = test_thread_new;
+    ecs_os_set_api(&os_api);
+
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = CountStages,
+        .multi_threaded = true
+    });
+
+    int i;
+    for (i = 0; i < 8; i ++) {
+        ecs_insert(world, ecs_value(Position, {10, 20}));
+    }
+
+    ecs_set_task_threads(world, 4);
+
+    for (i = 0; i < 10; i ++) {
+        ecs_progress(world, 0);
+    }
+
+    /* Workers are created with the application task API for each frame */
+    test_int(threads_created, 30);
+    test_int(stage_invoked[0], 20);
+    test_int(stage_invoked[1], 20);
+    test_int(stage_invoked[2], 20);
+    test_int(stage_invoked[3], 20);
+
+    ecs_fini(world);
+}
+
+static int32_t nested_parallel_for_invoked;
+
+static
+void NestedParallelForInner(void *ctx, int32_t index) {
+    ecs_os_ainc(&nested_parallel_for_invoked);
+}
+
+static
+void NestedParallelForOuter(void *ctx, int32_t index) {
+    ecs_os_parallel_for(NestedParallelForInner, ctx, 4);
+}
+
+void Pipeline_nested_parallel_for(void) {
+    ecs_os_set_api_defaults();
+
+    ecs_world_t *world = ecs_init();
+    test_assert(ecs_os_has_parallel_for());
+
+    /* Parallel for that is called from a job runs inline instead of waiting
+     * for the pool that is running the outer parallel for */
+    ecs_os_parallel_for(NestedParallelForOuter, NULL, 4);
+    test_int(nested_parallel_for_invoked, 16);
+
+    ecs_os_parallel_for(NestedParallelForOuter, NULL, 4);
+    test_int(nested_parallel_for_invoked, 32);
+
+    ecs_fini(world);
+}
+
+static
+void SingleThreadedSystem(ecs_iter_t *it) { }
+
+void Pipeline_task_threads_w_custom_task_new_multiple_ops(void) {
+    ecs_os_set_api_defaults();
+    ecs_os_api_t os_api = ecs_os_get_api();
+    test_thread_new_fn = os_api.task_new_;
+    os_api.task_new_ = test_thread_new;
+    ecs_os_set_api(&os_api);
+
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = CountStages,
+        .multi_threaded = true
+    });
+
+    /* Single threaded system splits up the pipeline in multiple ops */
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = SingleThreadedSystem
+    });
+
+    ecs_system(world, {
+        .entity = ecs_entity(world, { .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ ecs_id(Position) }},
+        .callback = CountStages,
+        .multi_threaded = true
+    });
+
+    int i;
+    for (i = 0; i < 8; i ++) {
+        ecs_insert(world, ecs_value(Position, {10, 20}));
+    }
+
+    ecs_set_task_threads(world, 4);
+
+    for (i = 0; i < 10; i ++) {
+        ecs_progress(world, 0);
+    }
+
+    /* Tasks are created once per frame, not for each multithreaded op */
+    test_int(threads_created, 30);
+    test_int(stage_invoked[0], 40);
+    test_int(stage_invoked[1], 40);
+    test_int(stage_invoked[2], 40);
+    test_int(stage_invoked[3], 40);
+
+    ecs_fini(world);
+}
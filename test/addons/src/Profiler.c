@@ -0,0 +1,290 @@
+#include <addons.h>
+
+/* Get trace with timestamps replaced by 0, so output can be compared */
+static
+char* profiler_trace(void) {
+    char *json = ecs_profiler_to_chrome_trace();
+    test_assert(json != NULL);
+
+    char *src = json, *dst = json;
+    while (*src) {
+        if (!ecs_os_strncmp(src, "\"ts\":", 5)) {
+            ecs_os_memcpy(dst, "\"ts\":0", 6);
+            dst += 6;
+            src += 5;
+            while ((*src >= '0' && *src <= '9') || *src == '.') {
+                src ++;
+            }
+        } else {
+            *(dst ++) = *(src ++);
+        }
+    }
+    *dst = '\0';
+
+    return json;
+}
+
+static int push_invoked = 0;
+static int pop_invoked = 0;
+
+static
+void profiler_push(
+    const char *file,
+    size_t line,
+    const char *name)
+{
+    (void)file;
+    (void)line;
+    test_str(name, "Foo");
+    push_invoked ++;
+}
+
+static
+void profiler_pop(
+    const char *file,
+    size_t line,
+    const char *name)
+{
+    (void)file;
+    (void)line;
+    test_str(name, "Foo");
+    pop_invoked ++;
+}
+
+void Profiler_start_stop(void) {
+    ecs_world_t *world = ecs_mini();
+
+    test_bool(ecs_profiler_is_running(), false);
+
+    ecs_profiler_start(0);
+    test_bool(ecs_profiler_is_running(), true);
+
+    ecs_profiler_stop();
+    test_bool(ecs_profiler_is_running(), false);
+
+    ecs_fini(world);
+}
+
+void Profiler_record_zone(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_profiler_start(0);
+
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Foo");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Foo");
+
+    char *json = profiler_trace();
+    test_str(json, "{\"traceEvents\":["
+        "{\"name\":\"Foo\",\"ph\":\"B\",\"ts\":0,\"pid\":0,\"tid\":0},"
+        "{\"name\":\"Foo\",\"ph\":\"E\",\"ts\":0,\"pid\":0,\"tid\":0}]}");
+    ecs_os_free(json);
+
+    ecs_profiler_stop();
+
+    ecs_fini(world);
+}
+
+void Profiler_nested_zones(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_profiler_start(0);
+
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Foo");
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Bar");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Bar");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Foo");
+
+    char *json = profiler_trace();
+    test_str(json, "{\"traceEvents\":["
+        "{\"name\":\"Foo\",\"ph\":\"B\",\"ts\":0,\"pid\":0,\"tid\":0},"
+        "{\"name\":\"Bar\",\"ph\":\"B\",\"ts\":0,\"pid\":0,\"tid\":0},"
+        "{\"name\":\"Bar\",\"ph\":\"E\",\"ts\":0,\"pid\":0,\"tid\":0},"
+        "{\"name\":\"Foo\",\"ph\":\"E\",\"ts\":0,\"pid\":0,\"tid\":0}]}");
+    ecs_os_free(json);
+
+    ecs_profiler_stop();
+
+    ecs_fini(world);
+}
+
+void Profiler_clear(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_profiler_start(0);
+
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Foo");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Foo");
+
+    ecs_profiler_clear();
+
+    char *json = profiler_trace();
+    test_str(json, "{\"traceEvents\":[]}");
+    ecs_os_free(json);
+
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Bar");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Bar");
+
+    json = profiler_trace();
+    test_str(json, "{\"traceEvents\":["
+        "{\"name\":\"Bar\",\"ph\":\"B\",\"ts\":0,\"pid\":0,\"tid\":0},"
+        "{\"name\":\"Bar\",\"ph\":\"E\",\"ts\":0,\"pid\":0,\"tid\":0}]}");
+    ecs_os_free(json);
+
+    ecs_profiler_stop();
+
+    ecs_fini(world);
+}
+
+void Profiler_wrap_around(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_profiler_start(4);
+
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Foo");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Foo");
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Bar");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Bar");
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Hello");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Hello");
+
+    char *json = profiler_trace();
+    test_str(json, "{\"traceEvents\":["
+        "{\"name\":\"Bar\",\"ph\":\"B\",\"ts\":0,\"pid\":0,\"tid\":0},"
+        "{\"name\":\"Bar\",\"ph\":\"E\",\"ts\":0,\"pid\":0,\"tid\":0},"
+        "{\"name\":\"Hello\",\"ph\":\"B\",\"ts\":0,\"pid\":0,\"tid\":0},"
+        "{\"name\":\"Hello\",\"ph\":\"E\",\"ts\":0,\"pid\":0,\"tid\":0}]}");
+    ecs_os_free(json);
+
+    ecs_profiler_stop();
+
+    ecs_fini(world);
+}
+
+void Profiler_skip_orphan_end(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_profiler_start(4);
+
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Foo");
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Bar");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Bar");
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Hello");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Hello");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Foo");
+
+    /* Begin events of Foo and Bar were overwritten */
+    char *json = profiler_trace();
+    test_str(json, "{\"traceEvents\":["
+        "{\"name\":\"Hello\",\"ph\":\"B\",\"ts\":0,\"pid\":0,\"tid\":0},"
+        "{\"name\":\"Hello\",\"ph\":\"E\",\"ts\":0,\"pid\":0,\"tid\":0}]}");
+    ecs_os_free(json);
+
+    ecs_profiler_stop();
+
+    ecs_fini(world);
+}
+
+void Profiler_escape_name(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_profiler_start(0);
+
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Foo\"Bar");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Foo\"Bar");
+
+    char *json = profiler_trace();
+    test_str(json, "{\"traceEvents\":["
+        "{\"name\":\"Foo\\\"Bar\",\"ph\":\"B\",\"ts\":0,\"pid\":0,\"tid\":0},"
+        "{\"name\":\"Foo\\\"Bar\",\"ph\":\"E\",\"ts\":0,\"pid\":0,\"tid\":0}]}");
+    ecs_os_free(json);
+
+    ecs_profiler_stop();
+
+    ecs_fini(world);
+}
+
+void Profiler_truncate_name(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_profiler_start(0);
+
+    const char *name =
+        "abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz";
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, name);
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, name);
+
+    char *json = profiler_trace();
+    test_str(json, "{\"traceEvents\":["
+        "{\"name\":\"abcdefghijklmnopqrstuvwxyz0123456789ab\",\"ph\":\"B\",\"ts\":0,\"pid\":0,\"tid\":0},"
+        "{\"name\":\"abcdefghijklmnopqrstuvwxyz0123456789ab\",\"ph\":\"E\",\"ts\":0,\"pid\":0,\"tid\":0}]}");
+    ecs_os_free(json);
+
+    ecs_profiler_stop();
+
+    ecs_fini(world);
+}
+
+void Profiler_not_running(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Foo");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Foo");
+
+    char *json = profiler_trace();
+    test_str(json, "{\"traceEvents\":[]}");
+    ecs_os_free(json);
+
+    ecs_fini(world);
+}
+
+void Profiler_chain_hooks(void) {
+    ecs_os_set_api_defaults();
+    ecs_os_api_t os_api = ecs_os_get_api();
+    os_api.perf_trace_push_ = profiler_push;
+    os_api.perf_trace_pop_ = profiler_pop;
+    ecs_os_set_api(&os_api);
+
+    ecs_world_t *world = ecs_mini();
+
+    ecs_profiler_start(0);
+
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Foo");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Foo");
+
+    test_int(push_invoked, 1);
+    test_int(pop_invoked, 1);
+
+    char *json = profiler_trace();
+    test_str(json, "{\"traceEvents\":["
+        "{\"name\":\"Foo\",\"ph\":\"B\",\"ts\":0,\"pid\":0,\"tid\":0},"
+        "{\"name\":\"Foo\",\"ph\":\"E\",\"ts\":0,\"pid\":0,\"tid\":0}]}");
+    ecs_os_free(json);
+
+    ecs_profiler_stop();
+
+    ecs_fini(world);
+}
+
+void Profiler_restore_hooks_on_stop(void) {
+    ecs_os_set_api_defaults();
+    ecs_os_api_t os_api = ecs_os_get_api();
+    os_api.perf_trace_push_ = profiler_push;
+    os_api.perf_trace_pop_ = profiler_pop;
+    ecs_os_set_api(&os_api);
+
+    ecs_world_t *world = ecs_mini();
+
+    ecs_profiler_start(0);
+    ecs_profiler_stop();
+
+    test_assert(ecs_os_get_api().perf_trace_push_ == profiler_push);
+    test_assert(ecs_os_get_api().perf_trace_pop_ == profiler_pop);
+
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Foo");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Foo");
+
+    test_int(push_invoked, 1);
+    test_int(pop_invoked, 1);
+
+    ecs_fini(world);
+}
@@ -686,3 +686,83 @@ void Rest_request_small_buffer_plus_one(void) {
 
     ecs_fini(world);
 }
+
+void Rest_get_profiler(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_http_server_t *srv = ecs_rest_server_init(world, NULL);
+    test_assert(srv != NULL);
+
+    ecs_profiler_start(0);
+
+    ecs_os_perf_trace_push_(__FILE__, __LINE__, "Foo");
+    ecs_os_perf_trace_pop_(__FILE__, __LINE__, "Foo");
+
+    {
+        ecs_http_reply_t reply = ECS_HTTP_REPLY_INIT;
+        test_int(0, ecs_http_server_request(srv, "GET",
+            "/profiler?clear=true", NULL, &reply));
+        test_int(reply.code, 200);
+
+        char *reply_str = ecs_strbuf_get(&reply.body);
+        test_assert(reply_str != NULL);
+        test_assert(strstr(reply_str, "{\"traceEvents\":[") == reply_str);
+        test_assert(strstr(reply_str, "\"name\":\"Foo\",\"ph\":\"B\"") != NULL);
+        test_assert(strstr(reply_str, "\"name\":\"Foo\",\"ph\":\"E\"") != NULL);
+        ecs_os_free(reply_str);
+    }
+
+    {
+        ecs_http_reply_t reply = ECS_HTTP_REPLY_INIT;
+        test_int(0, ecs_http_server_request(srv, "GET",
+            "/profiler", NULL, &reply));
+        test_int(reply.code, 200);
+
+        char *reply_str = ecs_strbuf_get(&reply.body);
+        test_str(reply_str, "{\"traceEvents\":[]}");
+        ecs_os_free(reply_str);
+    }
+
+    ecs_profiler_stop();
+
+    ecs_rest_server_fini(srv);
+
+    ecs_fini(world);
+}
+
+void Rest_get_metrics(void) {
+    ecs_world_t *world = ecs_init();
+    ECS_IMPORT(world, FlecsMetrics);
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_metric(world, {
+        .entity = ecs_entity(world, { .name = "metrics.position" }),
+        .id = ecs_id(Position),
+        .kind = EcsGauge
+    });
+
+    ecs_entity_t e1 = ecs_entity(world, { .name = "e1" });
+    ecs_set(world, e1, Position, {10, 20});
+
+    ecs_progress(world, 0);
+
+    ecs_http_server_t *srv = ecs_rest_server_init(world, NULL);
+    test_assert(srv != NULL);
+
+    ecs_http_reply_t reply = ECS_HTTP_REPLY_INIT;
+    const char *req = "GET /metrics HTTP/1.1\r\n\r\n";
+    test_int(0, ecs_http_server_http_request(srv, req, 0, &reply));
+    test_int(reply.code, 200);
+    test_str(reply.content_type, "text/plain; version=0.0.4; charset=utf-8");
+
+    char *reply_str = ecs_strbuf_get(&reply.body);
+    test_str(reply_str,
+        "# TYPE metrics_position gauge\n"
+        "metrics_position{entity=\"e1\"} 1\n");
+    ecs_os_free(reply_str);
+
+    ecs_rest_server_fini(srv);
+
+    ecs_fini(world);
+}
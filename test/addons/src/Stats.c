@@ -283,3 +283,376 @@ void Stats_progress_stats_systems_w_empty_table_flag(void) {
 
     ecs_fini(world);
 }
+
+void Stats_get_world_stats_frame_time_percentiles(void) {
+    ecs_world_t *world = ecs_init();
+
+    ecs_measure_frame_time(world, true);
+
+    int32_t i;
+    for (i = 0; i < 10; i ++) {
+        ecs_progress(world, 0);
+    }
+
+    const ecs_world_info_t *info = ecs_get_world_info(world);
+    test_assert(info->frame_time_max > 0);
+
+    ecs_world_stats_t stats = {0};
+    ecs_world_stats_get(world, &stats);
+
+    int32_t t = stats.t;
+    test_flt(stats.performance.frame_time_p50.gauge.avg[t], 
+        (ecs_float_t)info->frame_time_p50);
+    test_flt(stats.performance.frame_time_p99.gauge.avg[t], 
+        (ecs_float_t)info->frame_time_p99);
+    test_flt(stats.performance.frame_time_max.gauge.avg[t], 
+        (ecs_float_t)info->frame_time_max);
+
+    ecs_fini(world);
+}
+
+void Stats_stats_settings_default(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_IMPORT(world, FlecsStats);
+
+    const EcsStatsSettings *s = ecs_singleton_get(world, EcsStatsSettings);
+    test_assert(s != NULL);
+    test_int(s->sample_interval, 1);
+    test_bool(s->compact, false);
+    test_int(s->compact_window, 60);
+
+    test_assert(ecs_has_pair(world, EcsWorld, ecs_id(EcsWorldStats), EcsPeriod1s));
+    test_assert(ecs_has_pair(world, EcsWorld, ecs_id(EcsSystemStats), EcsPeriod1w));
+    test_assert(!ecs_has_pair(world, EcsWorld, ecs_id(EcsCompactStats), ecs_id(EcsWorldStats)));
+
+    ecs_entity_t monitor = ecs_lookup(world, "flecs.stats.WorldStats.Monitor1s");
+    test_assert(monitor != 0);
+    test_assert(!ecs_has(world, monitor, EcsRateFilter));
+
+    ecs_fini(world);
+}
+
+void Stats_sample_interval(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_IMPORT(world, FlecsStats);
+
+    ecs_singleton_set(world, EcsStatsSettings, { 
+        .sample_interval = 10, .compact_window = 60 });
+
+    ecs_entity_t monitor = ecs_lookup(world, "flecs.stats.WorldStats.Monitor1s");
+    test_assert(monitor != 0);
+    test_assert(ecs_has(world, monitor, EcsRateFilter));
+    test_int(ecs_get(world, monitor, EcsRateFilter)->rate, 10);
+
+    for (int i = 0; i < 20; i ++) {
+        ecs_progress(world, 1.0 / 60.0);
+    }
+
+    /* Skipped frames are backfilled, so the window advances for each frame */
+    const EcsWorldStats *stats = ecs_get_pair(
+        world, EcsWorld, EcsWorldStats, EcsPeriod1s);
+    test_assert(stats != NULL);
+    test_int(stats->stats.t, 20);
+    test_flt(stats->stats.frame.frame_count.counter.value[20], 19);
+
+    ecs_fini(world);
+}
+
+void Stats_compact_world_stats(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_IMPORT(world, FlecsStats);
+
+    ecs_singleton_set(world, EcsStatsSettings, { 
+        .sample_interval = 1, .compact = true, .compact_window = 60 });
+
+    test_assert(!ecs_has_pair(world, EcsWorld, ecs_id(EcsWorldStats), EcsPeriod1s));
+    test_assert(!ecs_has_pair(world, EcsWorld, ecs_id(EcsWorldStats), EcsPeriod1w));
+    test_assert(!ecs_has_pair(world, EcsWorld, ecs_id(EcsPipelineStats), EcsPeriod1s));
+    test_assert(ecs_has_pair(world, EcsWorld, ecs_id(EcsCompactStats), ecs_id(EcsWorldStats)));
+    test_assert(ecs_has_pair(world, EcsWorld, ecs_id(EcsCompactStats), ecs_id(EcsSystemStats)));
+    test_assert(!ecs_has_pair(world, EcsWorld, ecs_id(EcsCompactStats), ecs_id(EcsPipelineStats)));
+
+    for (int i = 0; i < 3; i ++) {
+        ecs_progress(world, 1.0 / 60.0);
+    }
+
+    const EcsCompactStats *compact = ecs_get_pair(
+        world, EcsWorld, EcsCompactStats, ecs_id(EcsWorldStats));
+    test_assert(compact != NULL);
+
+    ecs_compact_stats_t *stats = ecs_map_get_deref(
+        &compact->stats, ecs_compact_stats_t, EcsWorld);
+    test_assert(stats != NULL);
+    test_int(stats->count, 3);
+    test_int(stats->window, 60);
+    test_int(stats->metric_count, 
+        ECS_STATS_METRIC_INDEX(ecs_world_stats_t, last_));
+
+    int32_t frame_count = ECS_STATS_METRIC_INDEX(
+        ecs_world_stats_t, frame.frame_count);
+    /* Frame count is incremented at the end of the frame */
+    test_flt(ecs_compact_stats_value(stats, frame_count), 2);
+    test_flt(ecs_compact_stats_sample(stats, frame_count, 0), 1);
+    test_flt(ecs_compact_stats_sample(stats, frame_count, 1), 1);
+    test_flt(ecs_compact_stats_sample(stats, frame_count, 2), 0);
+    test_flt(ecs_compact_stats_sample(stats, frame_count, 3), 0);
+
+    int32_t world_time = ECS_STATS_METRIC_INDEX(
+        ecs_world_stats_t, performance.world_time);
+    test_flt(ecs_compact_stats_sample(stats, world_time, 0), 1.0 / 60.0);
+
+    ecs_fini(world);
+}
+
+static void Dummy(ecs_iter_t *it) { }
+
+void Stats_compact_system_stats(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_IMPORT(world, FlecsStats);
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t system = ecs_system(world, {
+        .entity = ecs_entity(world, { 
+            .name = "Dummy", .add = ecs_ids(ecs_dependson(EcsOnUpdate)) }),
+        .query.terms = {{ Foo }},
+        .callback = Dummy
+    });
+
+    ecs_new_w(world, Foo);
+    ecs_new_w(world, Foo);
+
+    ecs_singleton_set(world, EcsStatsSettings, { 
+        .sample_interval = 1, .compact = true, .compact_window = 60 });
+
+    test_assert(!ecs_has_pair(world, EcsWorld, ecs_id(EcsSystemStats), EcsPeriod1s));
+
+    ecs_progress(world, 1.0 / 60.0);
+    ecs_progress(world, 1.0 / 60.0);
+
+    const EcsCompactStats *compact = ecs_get_pair(
+        world, EcsWorld, EcsCompactStats, ecs_id(EcsSystemStats));
+    test_assert(compact != NULL);
+
+    ecs_compact_stats_t *stats = ecs_map_get_deref(
+        &compact->stats, ecs_compact_stats_t, system);
+    test_assert(stats != NULL);
+    test_int(stats->count, 2);
+    test_int(stats->metric_count, 4);
+
+    int32_t entity_count = 1 + ECS_STATS_METRIC_INDEX(
+        ecs_query_stats_t, matched_entity_count);
+    test_flt(ecs_compact_stats_sample(stats, entity_count, 0), 2);
+    test_flt(ecs_compact_stats_sample(stats, entity_count, 1), 2);
+    test_flt(ecs_compact_stats_avg(stats, entity_count), 2);
+
+    ecs_fini(world);
+}
+
+void Stats_compact_window(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_IMPORT(world, FlecsStats);
+
+    ecs_singleton_set(world, EcsStatsSettings, { 
+        .sample_interval = 1, .compact = true, .compact_window = 4 });
+
+    for (int i = 0; i < 10; i ++) {
+        ecs_progress(world, 1.0 / 60.0);
+    }
+
+    const EcsCompactStats *compact = ecs_get_pair(
+        world, EcsWorld, EcsCompactStats, ecs_id(EcsWorldStats));
+    ecs_compact_stats_t *stats = ecs_map_get_deref(
+        &compact->stats, ecs_compact_stats_t, EcsWorld);
+    test_assert(stats != NULL);
+    test_int(stats->count, 4);
+    test_int(stats->window, 4);
+
+    int32_t frame_count = ECS_STATS_METRIC_INDEX(
+        ecs_world_stats_t, frame.frame_count);
+    test_flt(ecs_compact_stats_value(stats, frame_count), 9);
+    test_flt(ecs_compact_stats_sample(stats, frame_count, 0), 1);
+    test_flt(ecs_compact_stats_sample(stats, frame_count, 3), 1);
+    test_flt(ecs_compact_stats_sample(stats, frame_count, 4), 0);
+    test_flt(ecs_compact_stats_avg(stats, frame_count), 1);
+
+    ecs_fini(world);
+}
+
+void Stats_compact_window_change(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_IMPORT(world, FlecsStats);
+
+    ecs_singleton_set(world, EcsStatsSettings, { 
+        .sample_interval = 1, .compact = true, .compact_window = 4 });
+
+    for (int i = 0; i < 10; i ++) {
+        ecs_progress(world, 1.0 / 60.0);
+    }
+
+    ecs_singleton_set(world, EcsStatsSettings, { 
+        .sample_interval = 1, .compact = true, .compact_window = 8 });
+
+    ecs_progress(world, 1.0 / 60.0);
+
+    const EcsCompactStats *compact = ecs_get_pair(
+        world, EcsWorld, EcsCompactStats, ecs_id(EcsWorldStats));
+    ecs_compact_stats_t *stats = ecs_map_get_deref(
+        &compact->stats, ecs_compact_stats_t, EcsWorld);
+    test_assert(stats != NULL);
+    test_int(stats->count, 1);
+    test_int(stats->window, 8);
+
+    int32_t frame_count = ECS_STATS_METRIC_INDEX(
+        ecs_world_stats_t, frame.frame_count);
+    test_flt(ecs_compact_stats_value(stats, frame_count), 10);
+
+    ecs_fini(world);
+}
+
+void Stats_compact_disable(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_IMPORT(world, FlecsStats);
+
+    ecs_singleton_set(world, EcsStatsSettings, { 
+        .sample_interval = 1, .compact = true, .compact_window = 4 });
+
+    ecs_progress(world, 1.0 / 60.0);
+
+    ecs_singleton_set(world, EcsStatsSettings, { 
+        .sample_interval = 1, .compact = false, .compact_window = 4 });
+
+    test_assert(ecs_has_pair(world, EcsWorld, ecs_id(EcsWorldStats), EcsPeriod1s));
+    test_assert(ecs_has_pair(world, EcsWorld, ecs_id(EcsSystemStats), EcsPeriod1m));
+    test_assert(ecs_has_pair(world, EcsWorld, ecs_id(EcsPipelineStats), EcsPeriod1w));
+    test_assert(!ecs_has_pair(world, EcsWorld, ecs_id(EcsCompactStats), ecs_id(EcsWorldStats)));
+    test_assert(!ecs_has_pair(world, EcsWorld, ecs_id(EcsCompactStats), ecs_id(EcsSystemStats)));
+
+    for (int i = 0; i < 60; i ++) {
+        ecs_progress(world, 1.0 / 60.0);
+    }
+
+    const EcsWorldStats *stats = ecs_get_pair(
+        world, EcsWorld, EcsWorldStats, EcsPeriod1s);
+    test_assert(stats != NULL);
+    int32_t t = stats->stats.t;
+    test_flt(stats->stats.frame.frame_count.counter.value[t], 60);
+
+    ecs_fini(world);
+}
+
+void Stats_compact_w_sample_interval(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_IMPORT(world, FlecsStats);
+
+    ecs_singleton_set(world, EcsStatsSettings, { 
+        .sample_interval = 2, .compact = true, .compact_window = 60 });
+
+    for (int i = 0; i < 6; i ++) {
+        ecs_progress(world, 1.0 / 60.0);
+    }
+
+    const EcsCompactStats *compact = ecs_get_pair(
+        world, EcsWorld, EcsCompactStats, ecs_id(EcsWorldStats));
+    ecs_compact_stats_t *stats = ecs_map_get_deref(
+        &compact->stats, ecs_compact_stats_t, EcsWorld);
+    test_assert(stats != NULL);
+    test_int(stats->count, 3);
+
+    int32_t frame_count = ECS_STATS_METRIC_INDEX(
+        ecs_world_stats_t, frame.frame_count);
+    test_flt(ecs_compact_stats_value(stats, frame_count), 5);
+    test_flt(ecs_compact_stats_sample(stats, frame_count, 0), 2);
+    test_flt(ecs_compact_stats_sample(stats, frame_count, 1), 2);
+
+    ecs_fini(world);
+}
+
+void Stats_stats_overhead(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_IMPORT(world, FlecsStats);
+
+    for (int i = 0; i < 10; i ++) {
+        ecs_progress(world, 1.0 / 60.0);
+    }
+
+    const EcsWorldSummary *summary = ecs_get(
+        world, EcsWorld, EcsWorldSummary);
+    test_assert(summary != NULL);
+    test_assert(summary->stats_time_total > 0);
+    test_assert(summary->stats_time_last > 0);
+    test_assert(summary->stats_time_last <= summary->stats_time_total);
+    test_assert(summary->stats_memory > 0);
+
+    ecs_fini(world);
+}
+
+void Stats_compact_stats_memory(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_IMPORT(world, FlecsStats);
+
+    ecs_progress(world, 1.0 / 60.0);
+    ecs_progress(world, 1.0 / 60.0);
+
+    int64_t memory = ecs_get(world, EcsWorld, EcsWorldSummary)->stats_memory;
+    test_assert(memory > 0);
+
+    ecs_singleton_set(world, EcsStatsSettings, { 
+        .sample_interval = 1, .compact = true, .compact_window = 60 });
+
+    ecs_progress(world, 1.0 / 60.0);
+    ecs_progress(world, 1.0 / 60.0);
+
+    int64_t compact_memory = 
+        ecs_get(world, EcsWorld, EcsWorldSummary)->stats_memory;
+    test_assert(compact_memory > 0);
+    test_assert(compact_memory * 10 < memory);
+
+    ecs_fini(world);
+}
+
+void Stats_component_record_memory(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_IMPORT(world, FlecsStats);
+    ECS_TAG(world, Rel);
+
+    ecs_progress(world, 0);
+
+    const EcsWorldSummary *summary = ecs_get(
+        world, EcsWorld, EcsWorldSummary);
+    int32_t count = summary->component_record_count;
+    int32_t pair_count = summary->pair_record_count;
+    int64_t memory = summary->component_record_memory;
+    test_assert(count > 0);
+    test_assert(pair_count > 0);
+    test_assert(pair_count < count);
+    test_assert(memory > 0);
+    test_assert(summary->component_record_memory_avg > 0);
+    test_assert(summary->component_record_memory_avg < (double)memory);
+
+    for (int i = 0; i < 10; i ++) {
+        ecs_new_w_pair(world, Rel, ecs_new(world));
+    }
+
+    ecs_progress(world, 0);
+
+    summary = ecs_get(world, EcsWorld, EcsWorldSummary);
+    test_assert(summary->component_record_count > count);
+    test_assert(summary->pair_record_count > pair_count);
+    test_assert(summary->component_record_memory > memory);
+    test_int(summary->component_record_memory, 
+        ecs_get_world_info(world)->component_record_memory);
+
+    ecs_fini(world);
+}
@@ -110,6 +110,18 @@ void Pipeline_run_w_empty_query(void);
 void Pipeline_run_w_0_src_query(void);
 void Pipeline_inout_none_after_write(void);
 void Pipeline_empty_pipeline_after_disable_phase(void);
+void Pipeline_concurrent_independent_systems(void);
+void Pipeline_concurrent_independent_systems_no_threads(void);
+void Pipeline_concurrent_disabled(void);
+void Pipeline_concurrent_conflicting_systems(void);
+void Pipeline_concurrent_merge_after_last_wave(void);
+void Pipeline_task_threads_w_parallel_for(void);
+void Pipeline_task_threads_w_parallel_for_no_multi_threaded(void);
+void Pipeline_parallel_each_w_parallel_for(void);
+void Pipeline_task_threads_reuse_threads(void);
+void Pipeline_task_threads_w_custom_task_new(void);
+void Pipeline_nested_parallel_for(void);
+void Pipeline_task_threads_w_custom_task_new_multiple_ops(void);
 
 // Testsuite 'SystemMisc'
 void SystemMisc_invalid_not_without_id(void);
@@ -326,6 +338,18 @@ void Stats_get_pipeline_stats_w_task_system(void);
 void Stats_get_not_alive_entity_count(void);
 void Stats_progress_stats_systems(void);
 void Stats_progress_stats_systems_w_empty_table_flag(void);
+void Stats_get_world_stats_frame_time_percentiles(void);
+void Stats_stats_settings_default(void);
+void Stats_sample_interval(void);
+void Stats_compact_world_stats(void);
+void Stats_compact_system_stats(void);
+void Stats_compact_window(void);
+void Stats_compact_window_change(void);
+void Stats_compact_disable(void);
+void Stats_compact_w_sample_interval(void);
+void Stats_stats_overhead(void);
+void Stats_compact_stats_memory(void);
+void Stats_component_record_memory(void);
 
 // Testsuite 'Run'
 void Run_setup(void);
@@ -387,6 +411,10 @@ void MultiThread_bulk_new_in_no_readonly_w_multithread(void);
 void MultiThread_bulk_new_in_no_readonly_w_multithread_2(void);
 void MultiThread_run_first_worker_on_main(void);
 void MultiThread_run_single_thread_on_main(void);
+void MultiThread_parallel_each(void);
+void MultiThread_parallel_each_no_threads(void);
+void MultiThread_parallel_each_deferred_add(void);
+void MultiThread_parallel_each_after_progress(void);
 
 // Testsuite 'MultiThreadStaging'
 void MultiThreadStaging_setup(void);
@@ -463,6 +491,8 @@ void Rest_get_pipeline_stats_after_delete_system(void);
 void Rest_request_world_summary_before_monitor_sys_run(void);
 void Rest_escape_backslash(void);
 void Rest_request_small_buffer_plus_one(void);
+void Rest_get_profiler(void);
+void Rest_get_metrics(void);
 
 // Testsuite 'Metrics'
 void Metrics_member_gauge_1_entity(void);
@@ -502,6 +532,18 @@ void Metrics_pair_member_tgt_type(void);
 void Metrics_pair_dotmember_rel_type(void);
 void Metrics_pair_dotmember_tgt_type(void);
 void Metrics_pair_member_counter_increment(void);
+void Metrics_prometheus_gauge(void);
+void Metrics_prometheus_counter(void);
+void Metrics_prometheus_oneof(void);
+void Metrics_prometheus_id_count(void);
+void Metrics_prometheus_id_target_count(void);
+void Metrics_prometheus_brief(void);
+void Metrics_prometheus_escape_label(void);
+void Metrics_prometheus_name(void);
+void Metrics_prometheus_new_instance(void);
+void Metrics_prometheus_delete_source(void);
+void Metrics_prometheus_no_metrics(void);
+void Metrics_prometheus_not_imported(void);
 
 // Testsuite 'Alerts'
 void Alerts_one_active_alert(void);
@@ -540,6 +582,25 @@ void Alerts_member_range_from_var(void);
 void Alerts_member_range_from_var_after_remove(void);
 void Alerts_retained_alert_w_dead_source(void);
 void Alerts_alert_counts(void);
+void Alerts_incremental_skip_unchanged(void);
+void Alerts_incremental_member_change(void);
+void Alerts_incremental_range_change(void);
+void Alerts_incremental_recycled_source(void);
+void Alerts_not_incremental_w_var(void);
+void Alerts_not_incremental_by_default(void);
+
+// Testsuite 'Profiler'
+void Profiler_start_stop(void);
+void Profiler_record_zone(void);
+void Profiler_nested_zones(void);
+void Profiler_clear(void);
+void Profiler_wrap_around(void);
+void Profiler_skip_orphan_end(void);
+void Profiler_escape_name(void);
+void Profiler_truncate_name(void);
+void Profiler_not_running(void);
+void Profiler_chain_hooks(void);
+void Profiler_restore_hooks_on_stop(void);
 
 bake_test_case Doc_testcases[] = {
     {
@@ -940,6 +1001,54 @@ bake_test_case Pipeline_testcases[] = {
     {
         "empty_pipeline_after_disable_phase",
         Pipeline_empty_pipeline_after_disable_phase
+    },
+    {
+        "concurrent_independent_systems",
+        Pipeline_concurrent_independent_systems
+    },
+    {
+        "concurrent_independent_systems_no_threads",
+        Pipeline_concurrent_independent_systems_no_threads
+    },
+    {
+        "concurrent_disabled",
+        Pipeline_concurrent_disabled
+    },
+    {
+        "concurrent_conflicting_systems",
+        Pipeline_concurrent_conflicting_systems
+    },
+    {
+        "concurrent_merge_after_last_wave",
+        Pipeline_concurrent_merge_after_last_wave
+    },
+    {
+        "task_threads_w_parallel_for",
+        Pipeline_task_threads_w_parallel_for
+    },
+    {
+        "task_threads_w_parallel_for_no_multi_threaded",
+        Pipeline_task_threads_w_parallel_for_no_multi_threaded
+    },
+    {
+        "parallel_each_w_parallel_for",
+        Pipeline_parallel_each_w_parallel_for
+    },
+    {
+        "task_threads_reuse_threads",
+        Pipeline_task_threads_reuse_threads
+    },
+    {
+        "task_threads_w_custom_task_new",
+        Pipeline_task_threads_w_custom_task_new
+    },
+    {
+        "nested_parallel_for",
+        Pipeline_nested_parallel_for
+    },
+    {
+        "task_threads_w_custom_task_new_multiple_ops",
+        Pipeline_task_threads_w_custom_task_new_multiple_ops
     }
 };
 
@@ -1741,6 +1850,54 @@ bake_test_case Stats_testcases[] = {
     {
         "progress_stats_systems_w_empty_table_flag",
         Stats_progress_stats_systems_w_empty_table_flag
+    },
+    {
+        "get_world_stats_frame_time_percentiles",
+        Stats_get_world_stats_frame_time_percentiles
+    },
+    {
+        "stats_settings_default",
+        Stats_stats_settings_default
+    },
+    {
+        "sample_interval",
+        Stats_sample_interval
+    },
+    {
+        "compact_world_stats",
+        Stats_compact_world_stats
+    },
+    {
+        "compact_system_stats",
+        Stats_compact_system_stats
+    },
+    {
+        "compact_window",
+        Stats_compact_window
+    },
+    {
+        "compact_window_change",
+        Stats_compact_window_change
+    },
+    {
+        "compact_disable",
+        Stats_compact_disable
+    },
+    {
+        "compact_w_sample_interval",
+        Stats_compact_w_sample_interval
+    },
+    {
+        "stats_overhead",
+        Stats_stats_overhead
+    },
+    {
+        "compact_stats_memory",
+        Stats_compact_stats_memory
+    },
+    {
+        "component_record_memory",
+        Stats_component_record_memory
     }
 };
 
@@ -1967,6 +2124,22 @@ bake_test_case MultiThread_testcases[] = {
     {
         "run_single_thread_on_main",
         MultiThread_run_single_thread_on_main
+    },
+    {
+        "parallel_each",
+        MultiThread_parallel_each
+    },
+    {
+        "parallel_each_no_threads",
+        MultiThread_parallel_each_no_threads
+    },
+    {
+        "parallel_each_deferred_add",
+        MultiThread_parallel_each_deferred_add
+    },
+    {
+        "parallel_each_after_progress",
+        MultiThread_parallel_each_after_progress
     }
 };
 
@@ -2238,6 +2411,14 @@ bake_test_case Rest_testcases[] = {
     {
         "request_small_buffer_plus_one",
         Rest_request_small_buffer_plus_one
+    },
+    {
+        "get_profiler",
+        Rest_get_profiler
+    },
+    {
+        "get_metrics",
+        Rest_get_metrics
     }
 };
 
@@ -2389,6 +2570,54 @@ bake_test_case Metrics_testcases[] = {
     {
         "pair_member_counter_increment",
         Metrics_pair_member_counter_increment
+    },
+    {
+        "prometheus_gauge",
+        Metrics_prometheus_gauge
+    },
+    {
+        "prometheus_counter",
+        Metrics_prometheus_counter
+    },
+    {
+        "prometheus_oneof",
+        Metrics_prometheus_oneof
+    },
+    {
+        "prometheus_id_count",
+        Metrics_prometheus_id_count
+    },
+    {
+        "prometheus_id_target_count",
+        Metrics_prometheus_id_target_count
+    },
+    {
+        "prometheus_brief",
+        Metrics_prometheus_brief
+    },
+    {
+        "prometheus_escape_label",
+        Metrics_prometheus_escape_label
+    },
+    {
+        "prometheus_name",
+        Metrics_prometheus_name
+    },
+    {
+        "prometheus_new_instance",
+        Metrics_prometheus_new_instance
+    },
+    {
+        "prometheus_delete_source",
+        Metrics_prometheus_delete_source
+    },
+    {
+        "prometheus_no_metrics",
+        Metrics_prometheus_no_metrics
+    },
+    {
+        "prometheus_not_imported",
+        Metrics_prometheus_not_imported
     }
 };
 
@@ -2536,6 +2765,77 @@ bake_test_case Alerts_testcases[] = {
     {
         "alert_counts",
         Alerts_alert_counts
+    },
+    {
+        "incremental_skip_unchanged",
+        Alerts_incremental_skip_unchanged
+    },
+    {
+        "incremental_member_change",
+        Alerts_incremental_member_change
+    },
+    {
+        "incremental_range_change",
+        Alerts_incremental_range_change
+    },
+    {
+        "incremental_recycled_source",
+        Alerts_incremental_recycled_source
+    },
+    {
+        "not_incremental_w_var",
+        Alerts_not_incremental_w_var
+    },
+    {
+        "not_incremental_by_default",
+        Alerts_not_incremental_by_default
+    }
+};
+
+bake_test_case Profiler_testcases[] = {
+    {
+        "start_stop",
+        Profiler_start_stop
+    },
+    {
+        "record_zone",
+        Profiler_record_zone
+    },
+    {
+        "nested_zones",
+        Profiler_nested_zones
+    },
+    {
+        "clear",
+        Profiler_clear
+    },
+    {
+        "wrap_around",
+        Profiler_wrap_around
+    },
+    {
+        "skip_orphan_end",
+        Profiler_skip_orphan_end
+    },
+    {
+        "escape_name",
+        Profiler_escape_name
+    },
+    {
+        "truncate_name",
+        Profiler_truncate_name
+    },
+    {
+        "not_running",
+        Profiler_not_running
+    },
+    {
+        "chain_hooks",
+        Profiler_chain_hooks
+    },
+    {
+        "restore_hooks_on_stop",
+        Profiler_restore_hooks_on_stop
     }
 };
 
@@ -2560,7 +2860,7 @@ static bake_test_suite suites[] = {
         "Pipeline",
         NULL,
         NULL,
-        87,
+        99,
         Pipeline_testcases
     },
     {
@@ -2637,7 +2937,7 @@ static bake_test_suite suites[] = {
         "Stats",
         NULL,
         NULL,
-        13,
+        25,
         Stats_testcases
     },
     {
@@ -2651,7 +2951,7 @@ static bake_test_suite suites[] = {
         "MultiThread",
         MultiThread_setup,
         NULL,
-        50,
+        54,
         MultiThread_testcases,
         1,
         MultiThread_params
@@ -2690,25 +2990,32 @@ static bake_test_suite suites[] = {
         "Rest",
         NULL,
         NULL,
-        21,
+        23,
         Rest_testcases
     },
     {
         "Metrics",
         NULL,
         NULL,
-        37,
+        49,
         Metrics_testcases
     },
     {
         "Alerts",
         NULL,
         NULL,
-        36,
+        42,
         Alerts_testcases
+    },
+    {
+        "Profiler",
+        NULL,
+        NULL,
+        11,
+        Profiler_testcases
     }
 };
 
 int main(int argc, char *argv[]) {
-    return bake_test_run("addons", argc, argv, suites, 22);
+    return bake_test_run("addons", argc, argv, suites, 23);
 }
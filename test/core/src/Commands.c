@@ -4864,3 +4864,327 @@ void Commands_enable_component_from_stage(void) {
 
     ecs_fini(world);
 }
+
+void Commands_async_add(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, TagA);
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_async_add(world, e, TagA);
+    test_assert(!ecs_has(world, e, TagA));
+
+    ecs_frame_begin(world, 1);
+    test_assert(ecs_has(world, e, TagA));
+    ecs_frame_end(world);
+
+    ecs_fini(world);
+}
+
+void Commands_async_remove(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, TagA);
+
+    ecs_entity_t e = ecs_new_w(world, TagA);
+
+    ecs_async_remove(world, e, TagA);
+    test_assert(ecs_has(world, e, TagA));
+
+    ecs_frame_begin(world, 1);
+    test_assert(!ecs_has(world, e, TagA));
+    ecs_frame_end(world);
+
+    ecs_fini(world);
+}
+
+void Commands_async_set(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_async_set(world, e, Position, {10, 20});
+    test_assert(!ecs_has(world, e, Position));
+
+    ecs_frame_begin(world, 1);
+    const Position *p = ecs_get(world, e, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+    ecs_frame_end(world);
+
+    ecs_fini(world);
+}
+
+void Commands_async_delete(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_async_delete(world, e);
+    test_assert(ecs_is_alive(world, e));
+
+    ecs_frame_begin(world, 1);
+    test_assert(!ecs_is_alive(world, e));
+    ecs_frame_end(world);
+
+    ecs_fini(world);
+}
+
+static int async_event_invoked = 0;
+
+static void AsyncEvent(ecs_iter_t *it) {
+    test_int(it->count, 1);
+    async_event_invoked ++;
+}
+
+void Commands_async_enqueue(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, Evt);
+
+    ecs_observer(world, {
+        .query.terms = {{ TagA }},
+        .events = { Evt },
+        .callback = AsyncEvent
+    });
+
+    ecs_entity_t e = ecs_new_w(world, TagA);
+
+    ecs_async_enqueue(world, &(ecs_event_desc_t){
+        .event = Evt,
+        .ids = &(ecs_type_t){ .array = (ecs_id_t[]){ TagA }, .count = 1 },
+        .entity = e
+    });
+
+    test_int(async_event_invoked, 0);
+
+    ecs_frame_begin(world, 1);
+    test_int(async_event_invoked, 1);
+    ecs_frame_end(world);
+
+    ecs_fini(world);
+}
+
+void Commands_async_order(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, TagA);
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_async_set(world, e, Position, {10, 20});
+    ecs_async_add(world, e, TagA);
+    ecs_async_set(world, e, Position, {30, 40});
+    ecs_async_remove(world, e, TagA);
+
+    ecs_frame_begin(world, 1);
+    const Position *p = ecs_get(world, e, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 30);
+    test_int(p->y, 40);
+    test_assert(!ecs_has(world, e, TagA));
+    ecs_frame_end(world);
+
+    ecs_fini(world);
+}
+
+void Commands_async_not_alive(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, TagA);
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_async_set(world, e, Position, {10, 20});
+    ecs_async_add(world, e, TagA);
+    ecs_delete(world, e);
+
+    ecs_frame_begin(world, 1);
+    test_assert(!ecs_is_alive(world, e));
+    ecs_frame_end(world);
+
+    ecs_fini(world);
+}
+
+void Commands_async_in_readonly(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, TagA);
+
+    ecs_entity_t e = ecs_new(world);
+
+    ecs_readonly_begin(world, false);
+    ecs_async_add(world, e, TagA);
+    test_assert(!ecs_has(world, e, TagA));
+    ecs_readonly_end(world);
+
+    test_assert(ecs_has(world, e, TagA));
+
+    ecs_fini(world);
+}
+
+void Commands_async_wrap_queue(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_new(world);
+
+    for (int f = 0; f < 3; f ++) {
+        for (int i = 0; i < FLECS_ASYNC_QUEUE_SIZE - 1; i ++) {
+            ecs_async_set(world, e, Position, {(float)i, (float)f});
+        }
+
+        ecs_frame_begin(world, 1);
+        const Position *p = ecs_get(world, e, Position);
+        test_assert(p != NULL);
+        test_int(p->x, FLECS_ASYNC_QUEUE_SIZE - 2);
+        test_int(p->y, f);
+        ecs_frame_end(world);
+    }
+
+    ecs_fini(world);
+}
+
+#define ASYNC_THREAD_COUNT (4)
+#define ASYNC_SET_COUNT (FLECS_ASYNC_QUEUE_SIZE * 2)
+
+typedef struct {
+    ecs_world_t *world;
+    ecs_entity_t e;
+    ecs_entity_t component;
+} async_thread_ctx_t;
+
+static
+void* async_set_thread(void *arg) {
+    async_thread_ctx_t *ctx = arg;
+    for (int i = 1; i <= ASYNC_SET_COUNT; i ++) {
+        Position p = {(float)i, 0};
+        ecs_async_set_id(ctx->world, ctx->e, ctx->component, 
+            sizeof(Position), &p);
+    }
+    return NULL;
+}
+
+void Commands_async_from_threads(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    async_thread_ctx_t ctx[ASYNC_THREAD_COUNT];
+    ecs_os_thread_t thr[ASYNC_THREAD_COUNT];
+
+    for (int i = 0; i < ASYNC_THREAD_COUNT; i ++) {
+        ctx[i].world = world;
+        ctx[i].e = ecs_insert(world, ecs_value(Position, {0, 0}));
+        ctx[i].component = ecs_id(Position);
+    }
+
+    for (int i = 0; i < ASYNC_THREAD_COUNT; i ++) {
+        thr[i] = ecs_os_thread_new(async_set_thread, &ctx[i]);
+    }
+
+    /* Keep draining the queue while threads are enqueueing commands. Values
+     * for each entity must be applied in order. */
+    bool done;
+    do {
+        ecs_frame_begin(world, 1);
+
+        done = true;
+        for (int i = 0; i < ASYNC_THREAD_COUNT; i ++) {
+            const Position *p = ecs_get(world, ctx[i].e, Position);
+            test_assert(p != NULL);
+            if (p->x != ASYNC_SET_COUNT) {
+                done = false;
+            }
+        }
+
+        ecs_frame_end(world);
+    } while (!done);
+
+    for (int i = 0; i < ASYNC_THREAD_COUNT; i ++) {
+        ecs_os_thread_join(thr[i]);
+    }
+
+    ecs_fini(world);
+}
+
+void Commands_async_fini_w_pending(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_new(world);
+    ecs_async_set(world, e, Position, {10, 20});
+
+    ecs_fini(world);
+
+    test_assert(true); /* no leaks */
+}
+
+void Commands_async_overflow(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, TagA);
+
+    ecs_entity_t e = ecs_new(world);
+
+    /* Enqueue more commands than fit in the queue without draining it */
+    for (int i = 0; i < FLECS_ASYNC_QUEUE_SIZE * 3; i ++) {
+        ecs_async_set(world, e, Position, {(float)i, 0});
+    }
+
+    /* Commands after the overflow must be applied after overflowed commands */
+    ecs_async_add(world, e, TagA);
+    ecs_async_remove(world, e, TagA);
+    ecs_async_set(world, e, Position, {-1, 0});
+
+    ecs_frame_begin(world, 1);
+    const Position *p = ecs_get(world, e, Position);
+    test_assert(p != NULL);
+    test_int(p->x, -1);
+    test_assert(!ecs_has(world, e, TagA));
+    ecs_frame_end(world);
+
+    /* Queue must be usable after the overflow was drained */
+    for (int i = 0; i < FLECS_ASYNC_QUEUE_SIZE + 1; i ++) {
+        ecs_async_set(world, e, Position, {(float)i, 1});
+    }
+
+    ecs_async_add(world, e, TagA);
+
+    ecs_frame_begin(world, 1);
+    p = ecs_get(world, e, Position);
+    test_assert(p != NULL);
+    test_int(p->x, FLECS_ASYNC_QUEUE_SIZE);
+    test_int(p->y, 1);
+    test_assert(ecs_has(world, e, TagA));
+    ecs_frame_end(world);
+
+    ecs_fini(world);
+}
+
+void Commands_async_fini_w_overflow(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_new(world);
+
+    for (int i = 0; i < FLECS_ASYNC_QUEUE_SIZE * 2; i ++) {
+        ecs_async_set(world, e, Position, {(float)i, 0});
+    }
+
+    /* Pending commands must be cleaned up */
+    ecs_fini(world);
+
+    test_assert(true);
+}
@@ -755,3 +755,420 @@ void Delete_wrap_generation_count(void) {
 
     ecs_fini(world);
 }
+
+void Delete_delete_many(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e[10], del[5];
+    for (int i = 0; i < 10; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, i * 2}));
+        if (i % 2) {
+            del[i / 2] = e[i];
+        }
+    }
+
+    ecs_delete_many(world, 5, del);
+
+    test_int(ecs_count(world, Position), 5);
+
+    for (int i = 0; i < 10; i ++) {
+        if (i % 2) {
+            test_assert(!ecs_is_alive(world, e[i]));
+        } else {
+            test_assert(ecs_is_alive(world, e[i]));
+            const Position *p = ecs_get(world, e[i], Position);
+            test_assert(p != NULL);
+            test_int(p->x, i);
+            test_int(p->y, i * 2);
+        }
+    }
+
+    ecs_fini(world);
+}
+
+void Delete_delete_many_w_tables(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t e[8];
+    for (int i = 0; i < 8; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+        if (i < 4) {
+            ecs_set(world, e[i], Velocity, {i, 0});
+        }
+    }
+
+    ecs_entity_t del[] = { e[7], e[0], e[5], e[2] };
+    ecs_delete_many(world, 4, del);
+
+    test_int(ecs_count(world, Position), 4);
+    test_int(ecs_count(world, Velocity), 2);
+
+    test_assert(!ecs_is_alive(world, e[0]));
+    test_assert(!ecs_is_alive(world, e[2]));
+    test_assert(!ecs_is_alive(world, e[5]));
+    test_assert(!ecs_is_alive(world, e[7]));
+
+    int alive[] = {1, 3, 4, 6};
+    for (int i = 0; i < 4; i ++) {
+        ecs_entity_t ent = e[alive[i]];
+        test_assert(ecs_is_alive(world, ent));
+        const Position *p = ecs_get(world, ent, Position);
+        test_assert(p != NULL);
+        test_int(p->x, alive[i]);
+        if (alive[i] < 4) {
+            const Velocity *v = ecs_get(world, ent, Velocity);
+            test_assert(v != NULL);
+            test_int(v->x, alive[i]);
+        }
+    }
+
+    ecs_fini(world);
+}
+
+void Delete_delete_many_w_not_alive(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {20, 30}));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Position, {30, 40}));
+    ecs_entity_t e4 = ecs_insert(world, ecs_value(Position, {40, 50}));
+    ecs_delete(world, e2);
+
+    ecs_entity_t del[] = { e1, e2, e3, e1 };
+    ecs_delete_many(world, 4, del);
+
+    test_assert(!ecs_is_alive(world, e1));
+    test_assert(!ecs_is_alive(world, e2));
+    test_assert(!ecs_is_alive(world, e3));
+    test_assert(ecs_is_alive(world, e4));
+    test_int(ecs_count(world, Position), 1);
+
+    const Position *p = ecs_get(world, e4, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 40);
+    test_int(p->y, 50);
+
+    ecs_fini(world);
+}
+
+static int delete_many_on_remove_count;
+static int delete_many_on_remove_invoked;
+static int delete_many_on_remove_sum;
+
+static
+void DeleteManyOnRemove(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    delete_many_on_remove_invoked ++;
+    for (int i = 0; i < it->count; i ++) {
+        test_assert(ecs_is_alive(it->world, it->entities[i]));
+        delete_many_on_remove_count ++;
+        delete_many_on_remove_sum += p[i].x;
+    }
+}
+
+void Delete_delete_many_w_on_remove(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ECS_OBSERVER(world, DeleteManyOnRemove, EcsOnRemove, Position);
+
+    ecs_entity_t e[6];
+    for (int i = 0; i < 6; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i + 1, 0}));
+    }
+
+    ecs_entity_t del[] = { e[0], e[2], e[4] };
+    ecs_delete_many(world, 3, del);
+
+    test_int(delete_many_on_remove_invoked, 1);
+    test_int(delete_many_on_remove_count, 3);
+    test_int(delete_many_on_remove_sum, 1 + 3 + 5);
+
+    test_int(ecs_count(world, Position), 3);
+    test_int(ecs_get(world, e[1], Position)->x, 2);
+    test_int(ecs_get(world, e[3], Position)->x, 4);
+    test_int(ecs_get(world, e[5], Position)->x, 6);
+
+    ecs_fini(world);
+}
+
+static int delete_many_hook_count;
+static int delete_many_hook_sum;
+
+static
+void DeleteManyHook(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    for (int i = 0; i < it->count; i ++) {
+        delete_many_hook_count ++;
+        delete_many_hook_sum += p[i].x;
+    }
+}
+
+void Delete_delete_many_w_on_remove_hook(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_set_hooks(world, Position, {
+        .on_remove = DeleteManyHook
+    });
+
+    ecs_entity_t e[6];
+    for (int i = 0; i < 6; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i + 1, 0}));
+    }
+
+    ecs_entity_t del[] = { e[1], e[0], e[3] };
+    ecs_delete_many(world, 3, del);
+
+    test_int(delete_many_hook_count, 3);
+    test_int(delete_many_hook_sum, 1 + 2 + 4);
+
+    test_int(ecs_count(world, Position), 3);
+    test_int(ecs_get(world, e[2], Position)->x, 3);
+    test_int(ecs_get(world, e[4], Position)->x, 5);
+    test_int(ecs_get(world, e[5], Position)->x, 6);
+
+    ecs_fini(world);
+}
+
+void Delete_delete_many_w_parent(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t p1 = ecs_insert(world, ecs_value(Position, {1, 0}));
+    ecs_entity_t p2 = ecs_insert(world, ecs_value(Position, {2, 0}));
+    ecs_entity_t p3 = ecs_insert(world, ecs_value(Position, {3, 0}));
+    ecs_entity_t c1 = ecs_new_w_pair(world, EcsChildOf, p1);
+    ecs_entity_t c2 = ecs_new_w_pair(world, EcsChildOf, p1);
+
+    ecs_entity_t del[] = { p2, p1, c2 };
+    ecs_delete_many(world, 3, del);
+
+    test_assert(!ecs_is_alive(world, p1));
+    test_assert(!ecs_is_alive(world, p2));
+    test_assert(ecs_is_alive(world, p3));
+    test_assert(!ecs_is_alive(world, c1));
+    test_assert(!ecs_is_alive(world, c2));
+
+    test_int(ecs_get(world, p3, Position)->x, 3);
+
+    ecs_fini(world);
+}
+
+void Delete_delete_many_w_toggle(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ecs_add_id(world, ecs_id(Position), EcsCanToggle);
+
+    ecs_entity_t e[6];
+    for (int i = 0; i < 6; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+        ecs_enable_component(world, e[i], Position, i % 2);
+    }
+
+    ecs_entity_t del[] = { e[0], e[1], e[2] };
+    ecs_delete_many(world, 3, del);
+
+    for (int i = 3; i < 6; i ++) {
+        test_assert(ecs_is_alive(world, e[i]));
+        test_bool(ecs_is_enabled(world, e[i], Position), i % 2);
+        test_int(ecs_get(world, e[i], Position)->x, i);
+    }
+
+    ecs_fini(world);
+}
+
+void Delete_delete_many_deferred(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ECS_OBSERVER(world, DeleteManyOnRemove, EcsOnRemove, Position);
+
+    ecs_entity_t e[6];
+    for (int i = 0; i < 6; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i + 1, 0}));
+    }
+
+    ecs_entity_t del[] = { e[5], e[0], e[3] };
+
+    ecs_defer_begin(world);
+    ecs_delete_many(world, 3, del);
+    test_assert(ecs_is_alive(world, e[0]));
+    test_assert(ecs_is_alive(world, e[3]));
+    test_assert(ecs_is_alive(world, e[5]));
+    ecs_defer_end(world);
+
+    test_assert(!ecs_is_alive(world, e[0]));
+    test_assert(!ecs_is_alive(world, e[3]));
+    test_assert(!ecs_is_alive(world, e[5]));
+    test_int(ecs_count(world, Position), 3);
+
+    test_int(delete_many_on_remove_invoked, 1);
+    test_int(delete_many_on_remove_count, 3);
+    test_int(delete_many_on_remove_sum, 1 + 4 + 6);
+
+    ecs_fini(world);
+}
+
+void Delete_delete_deferred_batch(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ECS_OBSERVER(world, DeleteManyOnRemove, EcsOnRemove, Position);
+
+    ecs_entity_t e[6];
+    for (int i = 0; i < 6; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i + 1, 0}));
+    }
+
+    ecs_defer_begin(world);
+    ecs_delete(world, e[1]);
+    ecs_delete(world, e[2]);
+    ecs_delete(world, e[1]);
+    ecs_delete(world, e[4]);
+    ecs_defer_end(world);
+
+    test_assert(ecs_is_alive(world, e[0]));
+    test_assert(!ecs_is_alive(world, e[1]));
+    test_assert(!ecs_is_alive(world, e[2]));
+    test_assert(ecs_is_alive(world, e[3]));
+    test_assert(!ecs_is_alive(world, e[4]));
+    test_assert(ecs_is_alive(world, e[5]));
+
+    test_int(delete_many_on_remove_invoked, 1);
+    test_int(delete_many_on_remove_count, 3);
+    test_int(delete_many_on_remove_sum, 2 + 3 + 5);
+
+    ecs_fini(world);
+}
+
+void Delete_delete_many_empty(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_insert(world, ecs_value(Position, {10, 20}));
+
+    ecs_delete_many(world, 0, NULL);
+
+    test_assert(ecs_is_alive(world, e));
+    test_int(ecs_count(world, Position), 1);
+
+    ecs_fini(world);
+}
+
+static int delete_many_dtor_invoked;
+static int delete_many_ctor_move_dtor_invoked;
+
+static
+void DeleteManyDtor(void *ptr, int32_t count, const ecs_type_info_t *ti) {
+    delete_many_dtor_invoked += count;
+}
+
+static
+void DeleteManyCtorMoveDtor(
+    void *dst, 
+    void *src, 
+    int32_t count, 
+    const ecs_type_info_t *ti) 
+{
+    delete_many_ctor_move_dtor_invoked += count;
+    ecs_os_memcpy(dst, src, ti->size * count);
+}
+
+void Delete_delete_many_w_ctor_move_dtor(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_set_hooks(world, Position, {
+        .dtor = DeleteManyDtor,
+        .ctor_move_dtor = DeleteManyCtorMoveDtor
+    });
+
+    ecs_entity_t e[6];
+    for (int i = 0; i < 6; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i + 1, 0}));
+    }
+
+    delete_many_dtor_invoked = 0;
+    delete_many_ctor_move_dtor_invoked = 0;
+
+    ecs_entity_t del[] = { e[0], e[2], e[5] };
+    ecs_delete_many(world, 3, del);
+
+    /* Rows 0 and 2 are swapped with rows from the tail using destructive 
+     * moves, after which the deleted values in the tail are destructed. */
+    test_int(delete_many_ctor_move_dtor_invoked, 6);
+    test_int(delete_many_dtor_invoked, 3);
+
+    test_int(ecs_count(world, Position), 3);
+    test_int(ecs_get(world, e[1], Position)->x, 2);
+    test_int(ecs_get(world, e[3], Position)->x, 4);
+    test_int(ecs_get(world, e[4], Position)->x, 5);
+
+    ecs_fini(world);
+}
+
+void Delete_delete_deferred_batch_w_cmd_after(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    ECS_OBSERVER(world, DeleteManyOnRemove, EcsOnRemove, Position);
+
+    ecs_entity_t e[4];
+    for (int i = 0; i < 4; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i + 1, 0}));
+    }
+
+    ecs_defer_begin(world);
+    ecs_delete(world, e[1]);
+    ecs_delete(world, e[2]);
+    ecs_add(world, e[2], Foo);
+    ecs_set(world, e[2], Position, {10, 20});
+    ecs_defer_end(world);
+
+    test_assert(ecs_is_alive(world, e[0]));
+    test_assert(!ecs_is_alive(world, e[1]));
+    test_assert(!ecs_is_alive(world, e[2]));
+    test_assert(ecs_is_alive(world, e[3]));
+    test_int(ecs_count(world, Foo), 0);
+
+    /* Set for a component the entity already has is applied in place */
+    test_int(delete_many_on_remove_count, 2);
+    test_int(delete_many_on_remove_sum, 2 + 10);
+
+    /* Commands for recycled ids must not use entries of deleted entities */
+    ecs_entity_t r1 = ecs_new(world);
+    ecs_entity_t r2 = ecs_new(world);
+    test_assert((uint32_t)r1 == (uint32_t)e[1] || (uint32_t)r1 == (uint32_t)e[2]);
+    test_assert((uint32_t)r2 == (uint32_t)e[1] || (uint32_t)r2 == (uint32_t)e[2]);
+
+    ecs_defer_begin(world);
+    ecs_add(world, r1, Foo);
+    ecs_set(world, r2, Position, {30, 40});
+    ecs_set(world, r1, Position, {50, 60});
+    ecs_defer_end(world);
+
+    test_assert(ecs_has(world, r1, Foo));
+    test_assert(!ecs_has(world, r2, Foo));
+    test_int(ecs_get(world, r1, Position)->x, 50);
+    test_int(ecs_get(world, r2, Position)->x, 30);
+
+    ecs_fini(world);
+}
@@ -281,3 +281,176 @@ void Get_component_get_wildcard(void) {
 
     ecs_fini(world);
 }
+
+void Get_component_get_many(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, TagA);
+
+    ecs_entity_t e[6];
+    for (int i = 0; i < 6; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, i * 2}));
+        if (i % 2) {
+            ecs_add(world, e[i], TagA);
+        }
+    }
+
+    const Position *p[6];
+    ecs_get_many(world, 6, e, Position, (const void**)p);
+
+    for (int i = 0; i < 6; i ++) {
+        test_assert(p[i] == ecs_get(world, e[i], Position));
+        test_int(p[i]->x, i);
+        test_int(p[i]->y, i * 2);
+    }
+
+    ecs_fini(world);
+}
+
+void Get_component_get_many_w_missing(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t e[4];
+    e[0] = ecs_insert(world, ecs_value(Position, {10, 20}));
+    e[1] = ecs_insert(world, ecs_value(Velocity, {1, 2}));
+    e[2] = ecs_new(world);
+    e[3] = ecs_insert(world, ecs_value(Position, {30, 40}));
+
+    const Position *p[4];
+    ecs_get_many(world, 4, e, Position, (const void**)p);
+
+    test_assert(p[0] != NULL);
+    test_int(p[0]->x, 10);
+    test_assert(p[1] == NULL);
+    test_assert(p[2] == NULL);
+    test_assert(p[3] != NULL);
+    test_int(p[3]->x, 30);
+
+    ecs_fini(world);
+}
+
+void Get_component_get_many_w_pair(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Tgt);
+    ECS_TAG(world, TagA);
+
+    ecs_entity_t e[4];
+    for (int i = 0; i < 4; i ++) {
+        e[i] = ecs_insert(world, ecs_value_pair(Position, Tgt, {i, i}));
+        if (i > 1) {
+            ecs_add(world, e[i], TagA);
+        }
+    }
+
+    const Position *p[4];
+    ecs_get_many_id(world, 4, e, ecs_pair(ecs_id(Position), Tgt), 
+        (const void**)p);
+
+    for (int i = 0; i < 4; i ++) {
+        test_assert(p[i] == ecs_get_pair(world, e[i], Position, Tgt));
+        test_int(p[i]->x, i);
+    }
+
+    ecs_fini(world);
+}
+
+void Get_component_get_many_w_base(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ecs_add_pair(world, ecs_id(Position), EcsOnInstantiate, EcsInherit);
+
+    ecs_entity_t base = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e[3];
+    e[0] = ecs_new_w_pair(world, EcsIsA, base);
+    e[1] = ecs_insert(world, ecs_value(Position, {30, 40}));
+    e[2] = ecs_new_w_pair(world, EcsIsA, base);
+
+    const Position *p[3];
+    ecs_get_many(world, 3, e, Position, (const void**)p);
+
+    test_assert(p[0] == ecs_get(world, base, Position));
+    test_assert(p[1] == ecs_get(world, e[1], Position));
+    test_assert(p[2] == ecs_get(world, base, Position));
+
+    ecs_fini(world);
+}
+
+void Get_component_get_many_sparse(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ecs_add_id(world, ecs_id(Position), EcsSparse);
+
+    ecs_entity_t e[3];
+    e[0] = ecs_insert(world, ecs_value(Position, {10, 20}));
+    e[1] = ecs_new(world);
+    e[2] = ecs_insert(world, ecs_value(Position, {30, 40}));
+
+    const Position *p[3];
+    ecs_get_many(world, 3, e, Position, (const void**)p);
+
+    test_assert(p[0] == ecs_get(world, e[0], Position));
+    test_assert(p[1] == NULL);
+    test_assert(p[2] == ecs_get(world, e[2], Position));
+    test_int(p[2]->x, 30);
+
+    ecs_fini(world);
+}
+
+void Get_component_get_many_large_batch(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+
+    int32_t count = 1000;
+    ecs_entity_t *e = ecs_os_malloc_n(ecs_entity_t, count);
+    const Position **p = ecs_os_malloc_n(const Position*, count);
+    for (int i = 0; i < count; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+        if (i % 3 == 1) {
+            ecs_add(world, e[i], TagA);
+        } else if (i % 3 == 2) {
+            ecs_add(world, e[i], TagB);
+        }
+    }
+
+    /* Lookup in reverse order */
+    for (int i = 0; i < count / 2; i ++) {
+        ecs_entity_t tmp = e[i];
+        e[i] = e[count - i - 1];
+        e[count - i - 1] = tmp;
+    }
+
+    ecs_get_many(world, count, e, Position, (const void**)p);
+
+    for (int i = 0; i < count; i ++) {
+        test_assert(p[i] != NULL);
+        test_int(p[i]->x, count - i - 1);
+    }
+
+    ecs_os_free(e);
+    ecs_os_free(p);
+
+    ecs_fini(world);
+}
+
+void Get_component_get_many_empty(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_get_many(world, 0, NULL, Position, NULL);
+
+    test_assert(true);
+
+    ecs_fini(world);
+}
@@ -1963,3 +1963,294 @@ void Hierarchies_recreated_parent_w_named_children(void) {
 
     ecs_fini(world);
 }
+
+void Hierarchies_path_cache_get_path(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    ecs_entity_t parent = ecs_entity(world, { .name = "parent" });
+    ecs_entity_t child = ecs_entity(world, { .name = "parent.child" });
+    ecs_entity_t grandchild = ecs_entity(world, { 
+        .name = "grandchild", .parent = child });
+
+    for (int i = 0; i < 2; i ++) {
+        char *path = ecs_get_path(world, parent);
+        test_str(path, "parent");
+        ecs_os_free(path);
+
+        path = ecs_get_path(world, child);
+        test_str(path, "parent.child");
+        ecs_os_free(path);
+
+        path = ecs_get_path(world, grandchild);
+        test_str(path, "parent.child.grandchild");
+        ecs_os_free(path);
+
+        path = ecs_get_path_w_sep(world, 0, grandchild, "::", NULL);
+        test_str(path, "parent::child::grandchild");
+        ecs_os_free(path);
+
+        path = ecs_get_path_w_sep(world, 0, grandchild, ".", "::");
+        test_str(path, "::parent.child.grandchild");
+        ecs_os_free(path);
+
+        path = ecs_get_path_w_sep(world, parent, grandchild, ".", NULL);
+        test_str(path, "child.grandchild");
+        ecs_os_free(path);
+    }
+
+    ecs_fini(world);
+}
+
+void Hierarchies_path_cache_get_path_escape(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t parent = ecs_entity(world, { .name = "pa\\.rent" });
+    ecs_entity_t child = ecs_entity(world, { 
+        .name = "ch\"ild", .parent = parent });
+
+    char *expect = ecs_get_path(world, child);
+    test_str(expect, "pa\\.rent.ch\"ild");
+
+    ecs_strbuf_t buf = ECS_STRBUF_INIT;
+    ecs_get_path_w_sep_buf(world, 0, child, ".", NULL, &buf, true);
+    char *expect_esc = ecs_strbuf_get(&buf);
+
+    ecs_enable_path_cache(world, true);
+
+    for (int i = 0; i < 2; i ++) {
+        char *path = ecs_get_path(world, child);
+        test_str(path, expect);
+        ecs_os_free(path);
+
+        ecs_get_path_w_sep_buf(world, 0, child, ".", NULL, &buf, true);
+        path = ecs_strbuf_get(&buf);
+        test_str(path, expect_esc);
+        ecs_os_free(path);
+    }
+
+    test_assert(ecs_lookup(world, expect) == child);
+
+    ecs_os_free(expect);
+    ecs_os_free(expect_esc);
+
+    ecs_fini(world);
+}
+
+void Hierarchies_path_cache_lookup(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    ecs_entity_t parent = ecs_entity(world, { .name = "parent" });
+    ecs_entity_t child = ecs_entity(world, { .name = "parent.child" });
+    ecs_entity_t grandchild = ecs_entity(world, { 
+        .name = "parent.child.grandchild" });
+
+    for (int i = 0; i < 2; i ++) {
+        test_assert(ecs_lookup(world, "parent") == parent);
+        test_assert(ecs_lookup(world, "parent.child") == child);
+        test_assert(ecs_lookup(world, "parent.child.grandchild") == grandchild);
+        test_assert(ecs_lookup(world, "parent.child.foo") == 0);
+        test_assert(ecs_lookup_path_w_sep(
+            world, 0, "parent::child", "::", NULL, false) == child);
+        test_assert(ecs_lookup_from(world, parent, "child") == child);
+    }
+
+    ecs_fini(world);
+}
+
+void Hierarchies_path_cache_rename_parent(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    ecs_entity_t parent = ecs_entity(world, { .name = "parent" });
+    ecs_entity_t child = ecs_entity(world, { .name = "parent.child" });
+    ecs_entity_t grandchild = ecs_entity(world, { 
+        .name = "parent.child.grandchild" });
+
+    char *path = ecs_get_path(world, grandchild);
+    test_str(path, "parent.child.grandchild");
+    ecs_os_free(path);
+
+    ecs_set_name(world, parent, "foo");
+
+    path = ecs_get_path(world, grandchild);
+    test_str(path, "foo.child.grandchild");
+    ecs_os_free(path);
+
+    path = ecs_get_path(world, child);
+    test_str(path, "foo.child");
+    ecs_os_free(path);
+
+    test_assert(ecs_lookup(world, "parent.child.grandchild") == 0);
+    test_assert(ecs_lookup(world, "parent.child") == 0);
+    test_assert(ecs_lookup(world, "foo.child.grandchild") == grandchild);
+
+    ecs_set_name(world, child, "bar");
+
+    test_assert(ecs_lookup(world, "foo.child.grandchild") == 0);
+    test_assert(ecs_lookup(world, "foo.bar.grandchild") == grandchild);
+
+    path = ecs_get_path(world, grandchild);
+    test_str(path, "foo.bar.grandchild");
+    ecs_os_free(path);
+
+    ecs_fini(world);
+}
+
+void Hierarchies_path_cache_reparent(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    ecs_entity_t p1 = ecs_entity(world, { .name = "p1" });
+    ecs_entity_t p2 = ecs_entity(world, { .name = "p2" });
+    ecs_entity_t child = ecs_entity(world, { .name = "p1.child" });
+    ecs_entity_t grandchild = ecs_entity(world, { 
+        .name = "p1.child.grandchild" });
+
+    test_assert(ecs_lookup(world, "p1.child.grandchild") == grandchild);
+
+    ecs_add_pair(world, child, EcsChildOf, p2);
+
+    test_assert(ecs_lookup(world, "p1.child.grandchild") == 0);
+    test_assert(ecs_lookup(world, "p2.child.grandchild") == grandchild);
+
+    char *path = ecs_get_path(world, grandchild);
+    test_str(path, "p2.child.grandchild");
+    ecs_os_free(path);
+
+    test_assert(p1 != 0);
+
+    ecs_fini(world);
+}
+
+void Hierarchies_path_cache_remove_parent(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    ecs_entity_t parent = ecs_entity(world, { .name = "parent" });
+    ecs_entity_t child = ecs_entity(world, { .name = "parent.child" });
+
+    test_assert(ecs_lookup(world, "parent.child") == child);
+
+    ecs_remove_pair(world, child, EcsChildOf, parent);
+
+    test_assert(ecs_lookup(world, "parent.child") == 0);
+    test_assert(ecs_lookup(world, "child") == child);
+
+    char *path = ecs_get_path(world, child);
+    test_str(path, "child");
+    ecs_os_free(path);
+
+    ecs_fini(world);
+}
+
+void Hierarchies_path_cache_delete(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    ecs_entity_t parent = ecs_entity(world, { .name = "parent" });
+    ecs_entity_t child = ecs_entity(world, { .name = "parent.child" });
+
+    test_assert(ecs_lookup(world, "parent.child") == child);
+
+    ecs_delete(world, parent);
+    test_assert(!ecs_is_alive(world, child));
+
+    test_assert(ecs_lookup(world, "parent.child") == 0);
+    test_assert(ecs_lookup(world, "parent") == 0);
+
+    /* Recycle ids */
+    ecs_entity_t p2 = ecs_new(world);
+    ecs_entity_t c2 = ecs_new(world);
+    test_assert((uint32_t)p2 == (uint32_t)child || 
+        (uint32_t)p2 == (uint32_t)parent);
+    test_assert((uint32_t)c2 == (uint32_t)child || 
+        (uint32_t)c2 == (uint32_t)parent);
+
+    ecs_set_name(world, p2, "foo");
+    ecs_add_pair(world, c2, EcsChildOf, p2);
+    ecs_set_name(world, c2, "bar");
+
+    char *path = ecs_get_path(world, c2);
+    test_str(path, "foo.bar");
+    ecs_os_free(path);
+
+    test_assert(ecs_lookup(world, "foo.bar") == c2);
+    test_assert(ecs_lookup(world, "parent.child") == 0);
+
+    ecs_fini(world);
+}
+
+void Hierarchies_path_cache_disable(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    ecs_entity_t child = ecs_entity(world, { .name = "parent.child" });
+    test_assert(ecs_lookup(world, "parent.child") == child);
+
+    ecs_enable_path_cache(world, false);
+
+    ecs_set_name(world, child, "foo");
+    test_assert(ecs_lookup(world, "parent.child") == 0);
+    test_assert(ecs_lookup(world, "parent.foo") == child);
+
+    ecs_enable_path_cache(world, true);
+    test_assert(ecs_lookup(world, "parent.foo") == child);
+    test_assert(ecs_lookup(world, "parent.foo") == child);
+
+    char *path = ecs_get_path(world, child);
+    test_str(path, "parent.foo");
+    ecs_os_free(path);
+
+    ecs_fini(world);
+}
+
+void Hierarchies_path_cache_core_entity(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    for (int i = 0; i < 2; i ++) {
+        char *path = ecs_get_path(world, EcsChildOf);
+        test_str(path, "ChildOf");
+        ecs_os_free(path);
+
+        path = ecs_get_path(world, ecs_id(EcsComponent));
+        test_str(path, "Component");
+        ecs_os_free(path);
+
+        test_assert(ecs_lookup(world, "ChildOf") == EcsChildOf);
+        test_assert(ecs_lookup(world, "flecs.core.ChildOf") == EcsChildOf);
+    }
+
+    ecs_fini(world);
+}
+
+void Hierarchies_path_cache_relative_lookup(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_enable_path_cache(world, true);
+
+    ecs_entity_t foo = ecs_entity(world, { .name = "foo" });
+    ecs_entity_t parent = ecs_entity(world, { .name = "parent" });
+    ecs_entity_t child = ecs_entity(world, { .name = "parent.foo" });
+
+    test_assert(ecs_lookup(world, "foo") == foo);
+    test_assert(ecs_lookup(world, "parent.foo") == child);
+
+    ecs_set_scope(world, parent);
+    test_assert(ecs_lookup(world, "foo") == child);
+    ecs_set_scope(world, 0);
+
+    test_assert(ecs_lookup(world, "foo") == foo);
+
+    ecs_fini(world);
+}
@@ -2971,9 +2971,10 @@ void Observer_unset_on_fini_1(void) {
     test_int(ctx.term_count, 1);
     test_null(ctx.param);
 
-    test_int(ctx.e[0], e3);
+    /* Deletes are batched per table */
+    test_int(ctx.e[0], e1);
     test_int(ctx.e[1], e2);
-    test_int(ctx.e[2], e1);
+    test_int(ctx.e[2], e3);
 
     test_int(ctx.c[0][0], ecs_id(Position));
     test_int(ctx.s[0][0], 0);      
@@ -3014,9 +3015,10 @@ void Observer_unset_on_fini_2(void) {
     test_int(ctx.term_count, 2);
     test_null(ctx.param);
 
-    test_int(ctx.e[0], e3);
+    /* Deletes are batched per table */
+    test_int(ctx.e[0], e1);
     test_int(ctx.e[1], e2);
-    test_int(ctx.e[2], e1);
+    test_int(ctx.e[2], e3);
 
     test_int(ctx.c[0][0], ecs_id(Position));
     test_int(ctx.s[0][0], 0); 
@@ -3066,9 +3068,10 @@ void Observer_unset_on_fini_3(void) {
     test_int(ctx.term_count, 3);
     test_null(ctx.param);
 
-    test_int(ctx.e[0], e3);
+    /* Deletes are batched per table */
+    test_int(ctx.e[0], e1);
     test_int(ctx.e[1], e2);
-    test_int(ctx.e[2], e1);
+    test_int(ctx.e[2], e3);
 
     test_int(ctx.c[0][0], ecs_id(Position));
     test_int(ctx.s[0][0], 0); 
@@ -10383,3 +10386,626 @@ void Observer_create_multi_observer_after_in_use_w_delete_component(void) {
 
     ecs_fini(world);
 }
+
+typedef struct {
+    ecs_entity_t event;
+    ecs_entity_t entity;
+} yield_log_elem_t;
+
+typedef struct {
+    yield_log_elem_t elems[64];
+    int32_t count;
+} yield_log_t;
+
+static
+void YieldLog(ecs_iter_t *it) {
+    yield_log_t *log = it->ctx;
+    int32_t i;
+    for (i = 0; i < it->count; i ++) {
+        test_assert(log->count < 64);
+        log->elems[log->count].event = it->event;
+        log->elems[log->count].entity = it->entities[i];
+        log->count ++;
+    }
+}
+
+void Observer_yield_existing_incremental(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+    ecs_entity_t e2 = ecs_new_w(world, Position);
+    ecs_entity_t e3 = ecs_new_w(world, Position);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = Observer,
+        .ctx = &ctx,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1
+    });
+
+    test_int(ctx.invoked, 0);
+    test_int(ecs_get_world_info(world)->observer_yield_count, 3);
+
+    test_int(ecs_observer_yield_run(world, 0), 0);
+    test_int(ecs_get_world_info(world)->observer_yield_count, 0);
+
+    test_int(ctx.invoked, 1);
+    test_int(ctx.count, 3);
+    test_int(ctx.e[0], e1);
+    test_int(ctx.e[1], e2);
+    test_int(ctx.e[2], e3);
+    test_int(ctx.event, EcsOnAdd);
+
+    test_int(ecs_observer_yield_run(world, 0), 0);
+    test_int(ctx.invoked, 1);
+
+    ecs_fini(world);
+}
+
+void Observer_yield_existing_incremental_frame_end(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_new_w(world, Position);
+    ecs_new_w(world, Position);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = Observer,
+        .ctx = &ctx,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1
+    });
+
+    test_int(ctx.invoked, 0);
+
+    ecs_frame_begin(world, 1);
+    test_int(ctx.invoked, 0);
+    ecs_frame_end(world);
+
+    test_int(ctx.count, 2);
+    test_int(ecs_get_world_info(world)->observer_yield_count, 0);
+
+    ecs_fini(world);
+}
+
+void Observer_yield_existing_incremental_time_budget(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_bulk_init(world, &(ecs_bulk_desc_t){
+        .count = 1000,
+        .ids = { ecs_id(Position) }
+    });
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = Observer,
+        .ctx = &ctx,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1
+    });
+
+    test_int(ctx.count, 0);
+
+    /* At least one batch is yielded, even if the time budget is exceeded */
+    test_int(ecs_observer_yield_run(world, 0.000000001), 1000 - 256);
+    test_int(ctx.count, 256);
+
+    test_int(ecs_observer_yield_run(world, 0), 0);
+    test_int(ctx.count, 1000);
+
+    ecs_fini(world);
+}
+
+void Observer_yield_existing_incremental_event_order(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+    ecs_entity_t e2 = ecs_new_w(world, Position);
+    ecs_entity_t e3 = ecs_new_w(world, Position);
+
+    yield_log_t log = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd, EcsOnRemove },
+        .callback = YieldLog,
+        .ctx = &log,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1
+    });
+
+    test_int(log.count, 0);
+
+    ecs_remove(world, e2, Position);
+    test_int(log.count, 2);
+    test_int(log.elems[0].event, EcsOnAdd);
+    test_uint(log.elems[0].entity, e2);
+    test_int(log.elems[1].event, EcsOnRemove);
+    test_uint(log.elems[1].entity, e2);
+    test_int(ecs_get_world_info(world)->observer_yield_count, 2);
+
+    test_int(ecs_observer_yield_run(world, 0), 0);
+    test_int(log.count, 4);
+    test_int(log.elems[2].event, EcsOnAdd);
+    test_uint(log.elems[2].entity, e1);
+    test_int(log.elems[3].event, EcsOnAdd);
+    test_uint(log.elems[3].entity, e3);
+
+    ecs_fini(world);
+}
+
+void Observer_yield_existing_incremental_event_order_deferred(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+    ecs_entity_t e2 = ecs_new_w(world, Position);
+
+    yield_log_t log = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnSet },
+        .callback = YieldLog,
+        .ctx = &log,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1
+    });
+
+    ecs_defer_begin(world);
+    ecs_set(world, e1, Position, {10, 20});
+    test_int(log.count, 0);
+    ecs_defer_end(world);
+
+    test_int(log.count, 2);
+    test_int(log.elems[0].event, EcsOnSet);
+    test_uint(log.elems[0].entity, e1);
+    test_int(log.elems[1].event, EcsOnSet);
+    test_uint(log.elems[1].entity, e1);
+
+    test_int(ecs_observer_yield_run(world, 0), 0);
+    test_int(log.count, 3);
+    test_uint(log.elems[2].entity, e2);
+
+    ecs_fini(world);
+}
+
+void Observer_yield_existing_incremental_new_entity(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+
+    yield_log_t log = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = YieldLog,
+        .ctx = &log,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1
+    });
+
+    ecs_entity_t e2 = ecs_new_w(world, Position);
+    test_int(log.count, 1);
+    test_uint(log.elems[0].entity, e2);
+
+    test_int(ecs_observer_yield_run(world, 0), 0);
+    test_int(log.count, 2);
+    test_uint(log.elems[1].entity, e1);
+
+    ecs_fini(world);
+}
+
+void Observer_yield_existing_incremental_deleted_entity(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+    ecs_entity_t e2 = ecs_new_w(world, Position);
+
+    yield_log_t log = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = YieldLog,
+        .ctx = &log,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1
+    });
+
+    ecs_delete(world, e1);
+    test_int(log.count, 0);
+
+    /* Recycled id must not be yielded as existing match */
+    ecs_entity_t e3 = ecs_new_w(world, Position);
+    test_assert((uint32_t)e3 == (uint32_t)e1);
+    test_int(log.count, 1);
+    test_uint(log.elems[0].entity, e3);
+
+    test_int(ecs_observer_yield_run(world, 0), 0);
+    test_int(log.count, 2);
+    test_uint(log.elems[1].entity, e2);
+
+    ecs_fini(world);
+}
+
+void Observer_yield_existing_incremental_moved_entity(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+    ecs_entity_t e2 = ecs_new_w(world, Position);
+
+    yield_log_t log = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = YieldLog,
+        .ctx = &log,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1
+    });
+
+    ecs_add(world, e1, Velocity);
+    test_int(log.count, 0);
+
+    test_int(ecs_observer_yield_run(world, 0), 0);
+    test_int(log.count, 2);
+    test_uint(log.elems[0].entity, e1);
+    test_uint(log.elems[1].entity, e2);
+
+    ecs_fini(world);
+}
+
+void Observer_yield_existing_incremental_multi(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t e1 = ecs_insert(world, 
+        ecs_value(Position, {1, 2}), ecs_value(Velocity, {1, 1}));
+    ecs_entity_t e2 = ecs_insert(world, 
+        ecs_value(Position, {3, 4}), ecs_value(Velocity, {1, 1}));
+    ecs_new_w(world, Position);
+
+    yield_log_t log = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }, { ecs_id(Velocity) }},
+        .events = { EcsOnSet },
+        .callback = YieldLog,
+        .ctx = &log,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1
+    });
+
+    test_int(log.count, 0);
+    test_int(ecs_get_world_info(world)->observer_yield_count, 2);
+
+    ecs_set(world, e2, Velocity, {2, 2});
+    test_int(log.count, 2);
+    test_uint(log.elems[0].entity, e2);
+    test_uint(log.elems[1].entity, e2);
+
+    test_int(ecs_observer_yield_run(world, 0), 0);
+    test_int(log.count, 3);
+    test_uint(log.elems[2].entity, e1);
+
+    ecs_fini(world);
+}
+
+void Observer_yield_existing_incremental_delete_observer(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_new_w(world, Position);
+    ecs_new_w(world, Position);
+
+    Probe ctx = {0};
+    ecs_entity_t o = ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = Observer,
+        .ctx = &ctx,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1
+    });
+
+    test_int(ecs_get_world_info(world)->observer_yield_count, 2);
+
+    ecs_delete(world, o);
+    test_int(ecs_get_world_info(world)->observer_yield_count, 0);
+    test_int(ecs_observer_yield_run(world, 0), 0);
+    test_int(ctx.invoked, 0);
+
+    ecs_fini(world);
+}
+
+void Observer_yield_existing_incremental_delete_observer_w_remove(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+
+    yield_log_t log = {0};
+    ecs_entity_t o = ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd, EcsOnRemove },
+        .callback = YieldLog,
+        .ctx = &log,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1
+    });
+
+    test_int(log.count, 0);
+
+    ecs_delete(world, o);
+    test_int(log.count, 2);
+    test_int(log.elems[0].event, EcsOnAdd);
+    test_uint(log.elems[0].entity, e1);
+    test_int(log.elems[1].event, EcsOnRemove);
+    test_uint(log.elems[1].entity, e1);
+    test_int(ecs_get_world_info(world)->observer_yield_count, 0);
+
+    ecs_fini(world);
+}
+
+void Observer_yield_existing_incremental_no_matches(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    Probe ctx = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = Observer,
+        .ctx = &ctx,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1
+    });
+
+    test_int(ecs_get_world_info(world)->observer_yield_count, 0);
+    test_int(ecs_observer_yield_run(world, 0), 0);
+    test_int(ctx.invoked, 0);
+
+    ecs_fini(world);
+}
+
+static
+void test_yield_parallel_for(
+    ecs_os_parallel_job_t job,
+    void *ctx,
+    int32_t count)
+{
+    int32_t i;
+    for (i = count - 1; i >= 0; i --) {
+        job(ctx, i);
+    }
+}
+
+static int32_t yield_stage_invoked[2];
+
+static
+void YieldStage(ecs_iter_t *it) {
+    int32_t stage_id = ecs_stage_get_id(it->world);
+    test_assert(stage_id >= 0 && stage_id < 2);
+    test_assert(it->world != it->real_world || stage_id == 0);
+    yield_stage_invoked[stage_id] += it->count;
+
+    ecs_id_t tag = (ecs_id_t)(uintptr_t)it->ctx;
+    int32_t i;
+    for (i = 0; i < it->count; i ++) {
+        ecs_add_id(it->world, it->entities[i], tag);
+    }
+}
+
+void Observer_yield_existing_multi_threaded(void) {
+    ecs_os_set_api_defaults();
+    ecs_os_api_t os_api = ecs_os_get_api();
+    os_api.parallel_for_ = test_yield_parallel_for;
+    ecs_os_set_api(&os_api);
+
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, Yielded);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+    ecs_entity_t e2 = ecs_new_w(world, Position);
+    ecs_add(world, e2, Velocity);
+
+    ecs_set_stage_count(world, 2);
+
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = YieldStage,
+        .ctx = (void*)(uintptr_t)Yielded,
+        .yield_existing = true,
+        .multi_threaded = true
+    });
+
+    test_int(yield_stage_invoked[0], 1);
+    test_int(yield_stage_invoked[1], 1);
+    test_assert(ecs_has(world, e1, Yielded));
+    test_assert(ecs_has(world, e2, Yielded));
+
+    ecs_fini(world);
+}
+
+void Observer_yield_existing_incremental_multi_threaded(void) {
+    ecs_os_set_api_defaults();
+    ecs_os_api_t os_api = ecs_os_get_api();
+    os_api.parallel_for_ = test_yield_parallel_for;
+    ecs_os_set_api(&os_api);
+
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, Yielded);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+    ecs_entity_t e2 = ecs_new_w(world, Position);
+    ecs_add(world, e2, Velocity);
+
+    ecs_set_stage_count(world, 2);
+
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = YieldStage,
+        .ctx = (void*)(uintptr_t)Yielded,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1,
+        .multi_threaded = true
+    });
+
+    test_int(yield_stage_invoked[0], 0);
+    test_int(yield_stage_invoked[1], 0);
+
+    test_int(ecs_observer_yield_run(world, 0), 0);
+    test_int(yield_stage_invoked[0], 1);
+    test_int(yield_stage_invoked[1], 1);
+    test_assert(ecs_has(world, e1, Yielded));
+    test_assert(ecs_has(world, e2, Yielded));
+
+    ecs_fini(world);
+}
+
+void Observer_yield_existing_multi_threaded_no_parallel_for(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Yielded);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+
+    ecs_set_stage_count(world, 2);
+
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = YieldStage,
+        .ctx = (void*)(uintptr_t)Yielded,
+        .yield_existing = true,
+        .multi_threaded = true
+    });
+
+    test_int(yield_stage_invoked[0], 1);
+    test_int(yield_stage_invoked[1], 0);
+    test_assert(ecs_has(world, e1, Yielded));
+
+    ecs_fini(world);
+}
+
+void Observer_yield_existing_incremental_deleted_middle_entity(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+    ecs_entity_t e2 = ecs_new_w(world, Position);
+    ecs_entity_t e3 = ecs_new_w(world, Position);
+
+    yield_log_t log = {0};
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnAdd },
+        .callback = YieldLog,
+        .ctx = &log,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1
+    });
+
+    test_int(ecs_get_world_info(world)->observer_yield_count, 3);
+
+    /* Deleted entity is recorded between entities that are still alive */
+    ecs_delete(world, e2);
+    test_int(log.count, 0);
+
+    test_int(ecs_observer_yield_run(world, 0), 0);
+    test_int(ecs_get_world_info(world)->observer_yield_count, 0);
+    test_int(log.count, 2);
+    test_uint(log.elems[0].entity, e1);
+    test_uint(log.elems[1].entity, e3);
+
+    ecs_fini(world);
+}
+
+static int32_t yield_run_invoked;
+
+static
+void YieldRun(ecs_iter_t *it) {
+    ecs_os_ainc(&yield_run_invoked);
+    while (ecs_iter_next(it)) {
+        it->callback(it);
+    }
+}
+
+void Observer_yield_existing_incremental_multi_threaded_w_run(void) {
+    ecs_os_set_api_defaults();
+    ecs_os_api_t os_api = ecs_os_get_api();
+    os_api.parallel_for_ = test_yield_parallel_for;
+    ecs_os_set_api(&os_api);
+
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, Mass);
+    ECS_TAG(world, Yielded);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+    ecs_add(world, e1, Velocity);
+    ecs_entity_t e2 = ecs_new_w(world, Position);
+    ecs_add(world, e2, Velocity);
+    ecs_add(world, e2, Mass);
+
+    ecs_set_stage_count(world, 2);
+
+    /* Multi-term observer with run callback must be invoked the same way as 
+     * when matches are yielded on the main thread */
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }, { ecs_id(Velocity) }},
+        .events = { EcsOnAdd },
+        .callback = YieldStage,
+        .run = YieldRun,
+        .ctx = (void*)(uintptr_t)Yielded,
+        .yield_existing = true,
+        .yield_existing_time_budget = 1,
+        .multi_threaded = true
+    });
+
+    test_int(ecs_observer_yield_run(world, 0), 0);
+    test_int(yield_run_invoked, 2);
+    test_int(yield_stage_invoked[0], 1);
+    test_int(yield_stage_invoked[1], 1);
+    test_assert(ecs_has(world, e1, Yielded));
+    test_assert(ecs_has(world, e2, Yielded));
+
+    ecs_fini(world);
+}
@@ -3427,3 +3427,477 @@ void OnDelete_empty_after_remove(void) {
 
     ecs_fini(world);
 }
+
+static int32_t parallel_dtor_invoked = 0;
+static int32_t parallel_on_remove_invoked = 0;
+
+static void parallel_dtor(void *ptr, int32_t count, const ecs_type_info_t *ti) {
+    Position *p = ptr;
+    int32_t i;
+    for (i = 0; i < count; i ++) {
+        test_int(p[i].x, 10);
+        test_int(p[i].y, 20);
+        p[i].x = 0; /* Detect access after destruction */
+        ecs_os_ainc(&parallel_dtor_invoked);
+    }
+}
+
+static void parallel_on_remove(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    int32_t i;
+    for (i = 0; i < it->count; i ++) {
+        test_assert(ecs_is_alive(it->world, it->entities[i]));
+        test_int(p[i].x, 10);
+        test_int(p[i].y, 20);
+        parallel_on_remove_invoked ++;
+    }
+}
+
+void OnDelete_parallel_delete_children_w_dtor(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_set_hooks(world, Position, {
+        .dtor = parallel_dtor
+    });
+
+    ecs_enable_parallel_delete(world, true);
+    parallel_dtor_invoked = 0;
+
+    ecs_entity_t parent = ecs_new(world);
+    ecs_entity_t first = 0, last = 0;
+    int32_t i;
+    for (i = 0; i < 10000; i ++) {
+        ecs_entity_t e = ecs_new_w_pair(world, EcsChildOf, parent);
+        ecs_set(world, e, Position, {10, 20});
+        if (!first) first = e;
+        last = e;
+    }
+
+    ecs_delete(world, parent);
+    test_int(parallel_dtor_invoked, 10000);
+
+    test_assert(!ecs_is_alive(world, parent));
+    test_assert(!ecs_is_alive(world, first));
+    test_assert(!ecs_is_alive(world, last));
+    test_int(0, ecs_count(world, Position));
+
+    const ecs_world_info_t *info = ecs_get_world_info(world);
+    test_assert(info->delete_time_total > 0);
+    test_assert(info->delete_time_last > 0);
+    test_assert(info->delete_time_last <= info->delete_time_total);
+
+    ecs_fini(world);
+}
+
+void OnDelete_parallel_delete_children_w_threads(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_set_hooks(world, Position, {
+        .dtor = parallel_dtor
+    });
+
+    ecs_set_stage_count(world, 4);
+    ecs_enable_parallel_delete(world, true);
+    parallel_dtor_invoked = 0;
+
+    ecs_entity_t parent = ecs_new(world);
+    ecs_entity_t child = 0;
+    int32_t i;
+    for (i = 0; i < 20000; i ++) {
+        ecs_entity_t e = ecs_new_w_pair(world, EcsChildOf, parent);
+        ecs_set(world, e, Position, {10, 20});
+        child = e;
+    }
+
+    ecs_delete(world, parent);
+    test_int(parallel_dtor_invoked, 20000);
+
+    test_assert(!ecs_is_alive(world, parent));
+    test_assert(!ecs_is_alive(world, child));
+    test_int(0, ecs_count(world, Position));
+
+    /* Table storage can be reused after delete */
+    ecs_entity_t e = ecs_new_w_pair(world, EcsChildOf, ecs_new(world));
+    ecs_set(world, e, Position, {10, 20});
+    test_int(1, ecs_count(world, Position));
+
+    ecs_fini(world);
+
+    test_int(parallel_dtor_invoked, 20001);
+}
+
+void OnDelete_parallel_delete_on_remove_before_dtor(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    ecs_set_hooks(world, Position, {
+        .dtor = parallel_dtor,
+        .on_remove = parallel_on_remove
+    });
+
+    ecs_set_stage_count(world, 2);
+    ecs_enable_parallel_delete(world, true);
+    parallel_dtor_invoked = 0;
+    parallel_on_remove_invoked = 0;
+
+    ecs_entity_t parent = ecs_new(world);
+    int32_t i;
+    for (i = 0; i < 100; i ++) {
+        ecs_entity_t e = ecs_new_w_pair(world, EcsChildOf, parent);
+        ecs_set(world, e, Position, {10, 20});
+        if (i % 2) {
+            ecs_add(world, e, Foo);
+        }
+    }
+
+    ecs_delete(world, parent);
+    test_int(parallel_on_remove_invoked, 100);
+    test_int(parallel_dtor_invoked, 100);
+    test_int(0, ecs_count(world, Position));
+
+    ecs_fini(world);
+}
+
+static int32_t parallel_observer_invoked = 0;
+
+static void parallel_observer(ecs_iter_t *it) {
+    Position *p = ecs_field(it, Position, 0);
+    int32_t i;
+    for (i = 0; i < it->count; i ++) {
+        test_int(p[i].x, 10);
+        test_int(p[i].y, 20);
+        parallel_observer_invoked ++;
+    }
+}
+
+void OnDelete_parallel_delete_w_observer(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_set_hooks(world, Position, {
+        .dtor = parallel_dtor
+    });
+
+    ecs_observer(world, {
+        .query.terms = {{ ecs_id(Position) }},
+        .events = { EcsOnRemove },
+        .callback = parallel_observer
+    });
+
+    ecs_enable_parallel_delete(world, true);
+    parallel_dtor_invoked = 0;
+    parallel_observer_invoked = 0;
+
+    ecs_entity_t parent = ecs_new(world);
+    int32_t i;
+    for (i = 0; i < 100; i ++) {
+        ecs_entity_t e = ecs_new_w_pair(world, EcsChildOf, parent);
+        ecs_set(world, e, Position, {10, 20});
+    }
+
+    ecs_delete(world, parent);
+    test_int(parallel_observer_invoked, 100);
+    test_int(parallel_dtor_invoked, 100);
+
+    ecs_fini(world);
+}
+
+void OnDelete_parallel_delete_delete_with(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+    ECS_TAG(world, Bar);
+
+    ecs_set_hooks(world, Position, {
+        .dtor = parallel_dtor
+    });
+
+    ecs_enable_parallel_delete(world, true);
+    parallel_dtor_invoked = 0;
+
+    ecs_entity_t e1 = ecs_new_w(world, Foo);
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_entity_t e2 = ecs_new_w(world, Foo);
+    ecs_set(world, e2, Position, {10, 20});
+    ecs_add(world, e2, Bar);
+    ecs_entity_t e3 = ecs_new_w(world, Bar);
+    ecs_set(world, e3, Position, {10, 20});
+
+    ecs_delete_with(world, Foo);
+    test_int(parallel_dtor_invoked, 2);
+
+    test_assert(!ecs_is_alive(world, e1));
+    test_assert(!ecs_is_alive(world, e2));
+    test_assert(ecs_is_alive(world, e3));
+
+    const Position *p = ecs_get(world, e3, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 10);
+    test_int(p->y, 20);
+
+    ecs_fini(world);
+
+    test_int(parallel_dtor_invoked, 3);
+}
+
+void OnDelete_parallel_delete_nested_hierarchy(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+    ECS_TAG(world, Foo);
+
+    ecs_set_hooks(world, Position, {
+        .dtor = parallel_dtor
+    });
+
+    ecs_set_stage_count(world, 2);
+    ecs_enable_parallel_delete(world, true);
+    parallel_dtor_invoked = 0;
+
+    ecs_entity_t root = ecs_new(world);
+    ecs_entity_t keep = ecs_new(world);
+    ecs_set(world, keep, Position, {10, 20});
+
+    int32_t i, j, k, count = 0;
+    for (i = 0; i < 10; i ++) {
+        ecs_entity_t c = ecs_new_w_pair(world, EcsChildOf, root);
+        ecs_set(world, c, Position, {10, 20});
+        count ++;
+        for (j = 0; j < 10; j ++) {
+            ecs_entity_t gc = ecs_new_w_pair(world, EcsChildOf, c);
+            ecs_set(world, gc, Velocity, {1, 2});
+            if (j % 2) {
+                ecs_set(world, gc, Position, {10, 20});
+                count ++;
+            }
+            for (k = 0; k < 10; k ++) {
+                ecs_entity_t ggc = ecs_new_w_pair(world, EcsChildOf, gc);
+                ecs_set(world, ggc, Position, {10, 20});
+                ecs_add(world, ggc, Foo);
+                count ++;
+            }
+        }
+    }
+
+    ecs_delete(world, root);
+    test_int(parallel_dtor_invoked, count);
+    test_int(1, ecs_count(world, Position));
+    test_int(0, ecs_count(world, Velocity));
+    test_int(0, ecs_count(world, Foo));
+    test_assert(ecs_is_alive(world, keep));
+
+    ecs_fini(world);
+
+    test_int(parallel_dtor_invoked, count + 1);
+}
+
+void OnDelete_delete_incremental_subtree(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t root = ecs_new(world);
+    ecs_entity_t keep = ecs_new(world);
+    ecs_entity_t child = 0, grandchild = 0;
+    int32_t i, j;
+    for (i = 0; i < 10; i ++) {
+        child = ecs_new_w_pair(world, EcsChildOf, root);
+        for (j = 0; j < 10; j ++) {
+            grandchild = ecs_new_w_pair(world, EcsChildOf, child);
+            ecs_set(world, grandchild, Position, {10, 20});
+        }
+    }
+
+    ecs_delete_incremental(world, root);
+    test_assert(ecs_is_alive(world, root));
+    test_assert(ecs_is_alive(world, child));
+    test_assert(ecs_is_alive(world, grandchild));
+    test_int(ecs_get_world_info(world)->delete_queue_count, 1);
+
+    test_int(ecs_delete_incremental_run(world, 0), 0);
+    test_int(ecs_get_world_info(world)->delete_queue_count, 0);
+
+    test_assert(!ecs_is_alive(world, root));
+    test_assert(!ecs_is_alive(world, child));
+    test_assert(!ecs_is_alive(world, grandchild));
+    test_assert(ecs_is_alive(world, keep));
+    test_int(0, ecs_count(world, Position));
+
+    ecs_fini(world);
+}
+
+void OnDelete_delete_incremental_w_budget(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t root = ecs_new(world), child = 0;
+    int32_t i, j;
+    for (i = 0; i < 10; i ++) {
+        child = ecs_new_w_pair(world, EcsChildOf, root);
+        for (j = 0; j < 1000; j ++) {
+            ecs_entity_t gc = ecs_new_w_pair(world, EcsChildOf, child);
+            ecs_set(world, gc, Position, {10, 20});
+        }
+    }
+
+    ecs_delete_incremental(world, root);
+
+    /* Budget is exceeded after the first batch, so each run only makes a small
+     * amount of progress */
+    int32_t steps = 0, count;
+    while ((count = ecs_delete_incremental_run(world, 0.000000001))) {
+        test_int(count, ecs_get_world_info(world)->delete_queue_count);
+        test_assert(ecs_is_alive(world, root));
+        steps ++;
+    }
+
+    test_assert(steps > 10);
+    test_assert(!ecs_is_alive(world, root));
+    test_int(0, ecs_count(world, Position));
+    test_assert(!ecs_is_alive(world, child));
+
+    ecs_fini(world);
+}
+
+static int32_t incremental_deleted = 0;
+
+static void incremental_on_remove(ecs_iter_t *it) {
+    int32_t i;
+    for (i = 0; i < it->count; i ++) {
+        test_int(ecs_count_id(it->world, ecs_childof(it->entities[i])), 0);
+        incremental_deleted ++;
+    }
+}
+
+void OnDelete_delete_incremental_children_before_parent(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_observer(world, {
+        .query.terms = {{ Foo }},
+        .events = { EcsOnRemove },
+        .callback = incremental_on_remove
+    });
+
+    incremental_deleted = 0;
+
+    ecs_entity_t root = ecs_new_w(world, Foo);
+    int32_t i, j, k, count = 1;
+    for (i = 0; i < 5; i ++) {
+        ecs_entity_t c = ecs_new_w_pair(world, EcsChildOf, root);
+        ecs_add(world, c, Foo);
+        count ++;
+        for (j = 0; j < 5; j ++) {
+            ecs_entity_t gc = ecs_new_w_pair(world, EcsChildOf, c);
+            ecs_add(world, gc, Foo);
+            count ++;
+            for (k = 0; k < 5; k ++) {
+                ecs_entity_t ggc = ecs_new_w_pair(world, EcsChildOf, gc);
+                ecs_add(world, ggc, Foo);
+                count ++;
+            }
+        }
+    }
+
+    ecs_delete_incremental(world, root);
+    while (ecs_delete_incremental_run(world, 0.000000001)) { }
+
+    test_int(incremental_deleted, count);
+    test_assert(!ecs_is_alive(world, root));
+    test_int(0, ecs_count(world, Foo));
+
+    ecs_fini(world);
+}
+
+void OnDelete_delete_incremental_deleted_before_run(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t root = ecs_new(world);
+    ecs_entity_t child = ecs_new_w_pair(world, EcsChildOf, root);
+    ecs_entity_t leaf = ecs_new(world);
+
+    ecs_delete_incremental(world, root);
+    ecs_delete_incremental(world, leaf);
+    test_int(ecs_get_world_info(world)->delete_queue_count, 2);
+
+    ecs_delete(world, root);
+    ecs_delete(world, leaf);
+    test_assert(!ecs_is_alive(world, child));
+
+    /* Recycle ids, make sure they aren't deleted */
+    ecs_entity_t e1 = ecs_new(world);
+    ecs_entity_t e2 = ecs_new(world);
+    ecs_entity_t e3 = ecs_new(world);
+
+    test_int(ecs_delete_incremental_run(world, 0), 0);
+    test_assert(ecs_is_alive(world, e1));
+    test_assert(ecs_is_alive(world, e2));
+    test_assert(ecs_is_alive(world, e3));
+
+    ecs_fini(world);
+}
+
+void OnDelete_delete_incremental_world(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t root = ecs_new_w(world, Foo);
+    ecs_entity_t child = ecs_new_w_pair(world, EcsChildOf, root);
+    ecs_set(world, child, Position, {10, 20});
+    ecs_entity_t e = ecs_new(world);
+    ecs_set(world, e, Position, {10, 20});
+
+    ecs_delete_incremental(world, 0);
+    test_int(ecs_get_world_info(world)->delete_queue_count, 2);
+    test_int(ecs_delete_incremental_run(world, 0), 0);
+
+    test_assert(!ecs_is_alive(world, root));
+    test_assert(!ecs_is_alive(world, child));
+    test_assert(!ecs_is_alive(world, e));
+
+    /* Entities used as component or tag are not deleted */
+    test_assert(ecs_is_alive(world, ecs_id(Position)));
+    test_assert(ecs_is_alive(world, Foo));
+    test_assert(ecs_is_alive(world, EcsFlecsCore));
+
+    ecs_fini(world);
+}
+
+void OnDelete_delete_incremental_fini_w_queued(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_set_hooks(world, Position, {
+        .dtor = parallel_dtor
+    });
+
+    parallel_dtor_invoked = 0;
+
+    ecs_entity_t root = ecs_new(world);
+    int32_t i;
+    for (i = 0; i < 10; i ++) {
+        ecs_entity_t child = ecs_new_w_pair(world, EcsChildOf, root);
+        ecs_set(world, child, Position, {10, 20});
+    }
+
+    ecs_delete_incremental(world, root);
+    ecs_delete_incremental_run(world, 0.000000001);
+
+    ecs_fini(world);
+
+    test_int(parallel_dtor_invoked, 10);
+}
@@ -3218,3 +3218,75 @@ void Pairs_force_target_on_target(void) {
     ecs_fini(world);
 }
 
+
+void Pairs_add_remove_pair_many_targets(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Rel);
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t targets[2000];
+    int32_t i;
+    for (i = 0; i < 2000; i ++) {
+        targets[i] = ecs_new(world);
+    }
+
+    ecs_entity_t e = ecs_new_w(world, Foo);
+    ecs_table_t *table = ecs_get_table(world, e);
+
+    int32_t r;
+    for (r = 0; r < 2; r ++) {
+        for (i = 0; i < 2000; i ++) {
+            ecs_add_pair(world, e, Rel, targets[i]);
+            test_assert(ecs_has_pair(world, e, Rel, targets[i]));
+            test_assert(ecs_has(world, e, Foo));
+            test_int(ecs_get_type(world, e)->count, 2);
+
+            ecs_remove_pair(world, e, Rel, targets[i]);
+            test_assert(!ecs_has_pair(world, e, Rel, targets[i]));
+            test_assert(ecs_get_table(world, e) == table);
+        }
+    }
+
+    ecs_fini(world);
+}
+
+void Pairs_add_pair_many_targets_after_table_delete(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Rel);
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t targets[1000];
+    int32_t i;
+    for (i = 0; i < 1000; i ++) {
+        targets[i] = ecs_new(world);
+    }
+
+    ecs_entity_t e = ecs_new_w(world, Foo);
+    for (i = 0; i < 1000; i ++) {
+        ecs_add_pair(world, e, Rel, targets[i]);
+        ecs_remove_pair(world, e, Rel, targets[i]);
+    }
+
+    /* Deleting targets deletes tables and their edges */
+    for (i = 0; i < 1000; i += 2) {
+        ecs_delete(world, targets[i]);
+        targets[i] = ecs_new(world);
+    }
+
+    for (i = 0; i < 1000; i ++) {
+        ecs_add_pair(world, e, Rel, targets[i]);
+        test_assert(ecs_has_pair(world, e, Rel, targets[i]));
+        test_assert(ecs_has(world, e, Foo));
+        test_int(ecs_get_type(world, e)->count, 2);
+        test_assert(ecs_get_type(world, e)->array[1] == 
+            ecs_pair(Rel, targets[i]));
+
+        ecs_remove_pair(world, e, Rel, targets[i]);
+        test_assert(!ecs_has_pair(world, e, Rel, targets[i]));
+        test_int(ecs_get_type(world, e)->count, 1);
+    }
+
+    ecs_fini(world);
+}
@@ -5668,3 +5668,200 @@ void Prefab_instantiate_w_non_fragmenting_pair_tag_while_defer_suspended(void) {
 
     ecs_fini(world);
 }
+
+void Prefab_bulk_instantiate_w_children(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t p = ecs_new_w_id(world, EcsPrefab);
+    ecs_entity_t c1 = ecs_entity(world, { .name = "c1", .parent = p });
+    ecs_set(world, c1, Position, {10, 20});
+    ecs_entity_t c2 = ecs_entity(world, { .name = "c2", .parent = p });
+    ecs_set(world, c2, Velocity, {1, 2});
+
+    const ecs_entity_t *ids = ecs_bulk_new_w_id(world, ecs_isa(p), 3);
+    test_assert(ids != NULL);
+
+    ecs_entity_t instances[3];
+    ecs_os_memcpy_n(instances, ids, ecs_entity_t, 3);
+
+    for (int i = 0; i < 3; i ++) {
+        ecs_entity_t inst = instances[i];
+        test_assert(ecs_has_pair(world, inst, EcsIsA, p));
+
+        ecs_entity_t i_c1 = ecs_lookup_child(world, inst, "c1");
+        test_assert(i_c1 != 0);
+        test_assert(i_c1 != c1);
+        test_assert(ecs_has_pair(world, i_c1, EcsChildOf, inst));
+        const Position *pos = ecs_get(world, i_c1, Position);
+        test_assert(pos != NULL);
+        test_int(pos->x, 10); test_int(pos->y, 20);
+
+        ecs_entity_t i_c2 = ecs_lookup_child(world, inst, "c2");
+        test_assert(i_c2 != 0);
+        test_assert(i_c2 != c2);
+        test_assert(ecs_has_pair(world, i_c2, EcsChildOf, inst));
+        const Velocity *vel = ecs_get(world, i_c2, Velocity);
+        test_assert(vel != NULL);
+        test_int(vel->x, 1); test_int(vel->y, 2);
+    }
+
+    ecs_fini(world);
+}
+
+void Prefab_bulk_instantiate_w_grandchildren(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t p = ecs_new_w_id(world, EcsPrefab);
+    ecs_entity_t c = ecs_entity(world, { .name = "c", .parent = p });
+    ecs_entity_t gc = ecs_entity(world, { .name = "gc", .parent = c });
+    ecs_set(world, gc, Position, {10, 20});
+
+    const ecs_entity_t *ids = ecs_bulk_new_w_id(world, ecs_isa(p), 4);
+    test_assert(ids != NULL);
+
+    ecs_entity_t instances[4];
+    ecs_os_memcpy_n(instances, ids, ecs_entity_t, 4);
+
+    for (int i = 0; i < 4; i ++) {
+        ecs_entity_t inst = instances[i];
+        ecs_entity_t i_c = ecs_lookup_child(world, inst, "c");
+        test_assert(i_c != 0);
+        test_assert(ecs_has_pair(world, i_c, EcsChildOf, inst));
+
+        ecs_entity_t i_gc = ecs_lookup_child(world, i_c, "gc");
+        test_assert(i_gc != 0);
+        test_assert(i_gc != gc);
+        test_assert(ecs_has_pair(world, i_gc, EcsChildOf, i_c));
+
+        const Position *pos = ecs_get(world, i_gc, Position);
+        test_assert(pos != NULL);
+        test_int(pos->x, 10); test_int(pos->y, 20);
+    }
+
+    ecs_fini(world);
+}
+
+void Prefab_bulk_instantiate_w_slots(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t base = ecs_entity(world, { .name = "Base", .add = ecs_ids( EcsPrefab ) });
+    ecs_entity_t base_slot = ecs_entity(world, { .name = "Base.Slot", .add = ecs_ids( EcsPrefab ) });
+    ecs_add_pair(world, base_slot, EcsSlotOf, base);
+
+    const ecs_entity_t *ids = ecs_bulk_new_w_id(world, ecs_isa(base), 3);
+    test_assert(ids != NULL);
+
+    ecs_entity_t instances[3];
+    ecs_os_memcpy_n(instances, ids, ecs_entity_t, 3);
+
+    for (int i = 0; i < 3; i ++) {
+        ecs_entity_t inst = instances[i];
+        ecs_entity_t slot = ecs_get_target(world, inst, base_slot, 0);
+        test_assert(slot != 0);
+        test_str(ecs_get_name(world, slot), "Slot");
+        test_assert(ecs_has_pair(world, slot, EcsChildOf, inst));
+        test_assert(!ecs_has_pair(world, slot, EcsSlotOf, EcsWildcard));
+    }
+
+    test_assert(ecs_get_table(world, instances[0]) == 
+        ecs_get_table(world, instances[1]));
+    test_assert(ecs_get_table(world, instances[0]) == 
+        ecs_get_table(world, instances[2]));
+
+    ecs_fini(world);
+}
+
+void Prefab_instantiate_after_child_type_changed(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t p = ecs_new_w_id(world, EcsPrefab);
+    ecs_entity_t c = ecs_entity(world, { .name = "c", .parent = p });
+    ecs_set(world, c, Position, {10, 20});
+
+    ecs_entity_t inst_1 = ecs_new_w_pair(world, EcsIsA, p);
+    ecs_entity_t c_1 = ecs_lookup_child(world, inst_1, "c");
+    test_assert(c_1 != 0);
+    test_assert(ecs_has(world, c_1, Position));
+    test_assert(!ecs_has(world, c_1, Velocity));
+
+    ecs_set(world, c, Velocity, {1, 2});
+
+    ecs_entity_t inst_2 = ecs_new_w_pair(world, EcsIsA, p);
+    ecs_entity_t c_2 = ecs_lookup_child(world, inst_2, "c");
+    test_assert(c_2 != 0);
+    test_assert(ecs_has(world, c_2, Position));
+    test_assert(ecs_has(world, c_2, Velocity));
+    const Velocity *v = ecs_get(world, c_2, Velocity);
+    test_assert(v != NULL);
+    test_int(v->x, 1); test_int(v->y, 2);
+
+    ecs_remove(world, c, Position);
+
+    ecs_entity_t inst_3 = ecs_new_w_pair(world, EcsIsA, p);
+    ecs_entity_t c_3 = ecs_lookup_child(world, inst_3, "c");
+    test_assert(c_3 != 0);
+    test_assert(!ecs_has(world, c_3, Position));
+    test_assert(ecs_has(world, c_3, Velocity));
+
+    ecs_fini(world);
+}
+
+void Prefab_instantiate_prefab_and_instance_from_same_prefab(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t p = ecs_new_w_id(world, EcsPrefab);
+    ecs_entity_t c = ecs_entity(world, { .name = "c", .parent = p });
+    ecs_set(world, c, Position, {10, 20});
+
+    ecs_entity_t inst = ecs_new_w_pair(world, EcsIsA, p);
+    ecs_entity_t inst_c = ecs_lookup_child(world, inst, "c");
+    test_assert(inst_c != 0);
+    test_assert(!ecs_has_id(world, inst_c, EcsPrefab));
+
+    ecs_entity_t derived = ecs_new_w_id(world, EcsPrefab);
+    ecs_add_pair(world, derived, EcsIsA, p);
+    ecs_entity_t derived_c = ecs_lookup_child(world, derived, "c");
+    test_assert(derived_c != 0);
+    test_assert(ecs_has_id(world, derived_c, EcsPrefab));
+
+    inst = ecs_new_w_pair(world, EcsIsA, p);
+    inst_c = ecs_lookup_child(world, inst, "c");
+    test_assert(inst_c != 0);
+    test_assert(!ecs_has_id(world, inst_c, EcsPrefab));
+
+    ecs_fini(world);
+}
+
+void Prefab_instantiate_after_observer_created(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t p = ecs_new_w_id(world, EcsPrefab);
+    ecs_entity_t c = ecs_entity(world, { .name = "c", .parent = p });
+    ecs_set(world, c, Position, {10, 20});
+
+    ecs_entity_t inst_1 = ecs_new_w_pair(world, EcsIsA, p);
+    test_assert(ecs_lookup_child(world, inst_1, "c") != 0);
+
+    ECS_OBSERVER(world, PrefabReactiveTest, EcsOnAdd, Position);
+    test_int(invoked, 0);
+
+    ecs_entity_t inst_2 = ecs_new_w_pair(world, EcsIsA, p);
+    ecs_entity_t c_2 = ecs_lookup_child(world, inst_2, "c");
+    test_assert(c_2 != 0);
+    test_assert(ecs_has(world, c_2, Position));
+    test_int(invoked, 1);
+
+    ecs_fini(world);
+}
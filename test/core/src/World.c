@@ -2049,3 +2049,366 @@ void World_init_create_delete_random_2_entities_shrink_fini(void) {
 
     ecs_fini(world);
 }
+
+void World_control_fps_precise(void) {
+    test_is_flaky();
+
+    ecs_world_t *world = ecs_init();
+
+    double start, now = 0;
+    ecs_set_target_fps(world, 20);
+    ecs_precise_frame_pacing(world, true);
+
+    const ecs_world_info_t *stats = ecs_get_world_info(world);
+
+    /* Run for one second */
+    int count = 0;
+    do {    
+        ecs_progress(world, 0);
+        if (!count) {
+            start = stats->delta_time;
+        }
+
+        now += stats->delta_time;
+        count ++;
+    } while ((now - start) < 1.0);
+
+    test_assert(count >= 15);
+    test_assert(count < 25);
+
+    ecs_fini(world);
+}
+
+void World_control_fps_precise_busy_app(void) {
+    test_is_flaky();
+
+    ecs_world_t *world = ecs_init();
+
+    double start, now = 0;
+    ecs_set_target_fps(world, 20);
+    ecs_precise_frame_pacing(world, true);
+
+    const ecs_world_info_t *stats = ecs_get_world_info(world);
+
+    /* Run for one second */
+    int count = 0;
+    do {    
+        ecs_progress(world, 0);
+        if (!count) {
+            start = stats->delta_time;
+        }
+
+        now += stats->delta_time;
+        count ++;
+
+        busy_wait(0.014);
+    } while ((now - start) < 1.0);
+
+    test_assert(count >= 15);
+    test_assert(count < 25);
+
+    ecs_fini(world);
+}
+
+void World_frame_time_percentiles(void) {
+    test_is_flaky();
+
+    ecs_world_t *world = ecs_init();
+
+    ecs_set_target_fps(world, 100);
+    ecs_precise_frame_pacing(world, true);
+
+    const ecs_world_info_t *info = ecs_get_world_info(world);
+    test_assert(info->frame_time_p50 == 0);
+    test_assert(info->frame_time_p99 == 0);
+    test_assert(info->frame_time_max == 0);
+
+    int32_t i;
+    for (i = 0; i < 20; i ++) {
+        ecs_progress(world, 0);
+    }
+
+    test_assert(info->frame_time_p50 > 0.005);
+    test_assert(info->frame_time_p50 < 0.02);
+    test_assert(info->frame_time_p50 <= info->frame_time_p99);
+    test_assert(info->frame_time_p99 <= info->frame_time_max);
+
+    ecs_fini(world);
+}
+
+void World_frame_time_percentiles_w_delta_time(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_IMPORT(world, FlecsPipeline);
+
+    const ecs_world_info_t *info = ecs_get_world_info(world);
+
+    /* Frame time isn't measured when delta time is provided */
+    int32_t i;
+    for (i = 0; i < 10; i ++) {
+        ecs_progress(world, 1);
+    }
+
+    test_assert(info->frame_time_p50 == 0);
+    test_assert(info->frame_time_p99 == 0);
+    test_assert(info->frame_time_max == 0);
+
+    ecs_fini(world);
+}
+
+void World_frame_time_percentiles_busy_frame(void) {
+    test_is_flaky();
+
+    ecs_world_t *world = ecs_init();
+
+    ecs_measure_frame_time(world, true);
+
+    const ecs_world_info_t *info = ecs_get_world_info(world);
+
+    int32_t i;
+    for (i = 0; i < 100; i ++) {
+        ecs_progress(world, 0);
+        if (i == 50) {
+            busy_wait(0.05);
+        }
+    }
+
+    /* A single slow frame shows up in max, but not in p50 */
+    test_assert(info->frame_time_max >= 0.05);
+    test_assert(info->frame_time_p50 < 0.05);
+
+    ecs_fini(world);
+}
+
+void World_table_gc_delete_after_frames(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_TAG(world, Foo);
+    ECS_TAG(world, Bar);
+
+    const ecs_world_info_t *info = ecs_get_world_info(world);
+
+    ecs_set_table_gc(world, &(ecs_table_gc_desc_t){
+        .delete_frames = 3
+    });
+
+    ecs_entity_t e = ecs_new_w(world, Foo);
+    ecs_add(world, e, Bar);
+    ecs_remove(world, e, Bar);
+
+    int64_t deleted = info->table_gc_delete_total;
+    ecs_progress(world, 0); /* Table is found empty */
+    ecs_progress(world, 0);
+    ecs_progress(world, 0);
+    test_assert(info->table_gc_delete_total == deleted);
+    ecs_progress(world, 0); /* Table has been empty for 3 frames */
+    test_assert(info->table_gc_delete_total > deleted);
+
+    /* Table was deleted, so adding Bar creates it again */
+    int64_t created = info->table_create_total;
+    ecs_add(world, e, Bar);
+    test_assert(info->table_create_total == created + 1);
+    test_assert(ecs_has(world, e, Foo));
+    test_assert(ecs_has(world, e, Bar));
+
+    ecs_fini(world);
+}
+
+void World_table_gc_clear_and_reuse(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    const ecs_world_info_t *info = ecs_get_world_info(world);
+
+    ecs_set_table_gc(world, &(ecs_table_gc_desc_t){
+        .clear_frames = 2,
+        .delete_frames = 100
+    });
+
+    ecs_entity_t e = ecs_new_w(world, Foo);
+    ecs_set(world, e, Position, {10, 20});
+    ecs_table_t *table = ecs_get_table(world, e);
+    ecs_remove(world, e, Position);
+
+    int32_t pool_count = info->table_pool_count;
+    ecs_progress(world, 0);
+    ecs_progress(world, 0);
+    ecs_progress(world, 0);
+    test_assert(info->table_pool_count > pool_count);
+    test_int(info->table_pool_hit_total, 0);
+
+    /* Table storage was freed, but table wasn't deleted */
+    pool_count = info->table_pool_count;
+    int64_t created = info->table_create_total;
+    ecs_set(world, e, Position, {30, 40});
+    test_assert(ecs_get_table(world, e) == table);
+    test_assert(info->table_create_total == created);
+
+    const Position *p = ecs_get(world, e, Position);
+    test_assert(p != NULL);
+    test_int(p->x, 30);
+    test_int(p->y, 40);
+
+    ecs_progress(world, 0);
+    test_int(info->table_pool_hit_total, 1);
+    test_int(info->table_pool_count, pool_count - 1);
+
+    ecs_fini(world);
+}
+
+void World_table_gc_reset_when_used(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_TAG(world, Foo);
+    ECS_TAG(world, Bar);
+
+    const ecs_world_info_t *info = ecs_get_world_info(world);
+
+    ecs_set_table_gc(world, &(ecs_table_gc_desc_t){
+        .delete_frames = 3
+    });
+
+    ecs_entity_t e = ecs_new_w(world, Foo);
+    ecs_add(world, e, Bar);
+    ecs_table_t *table = ecs_get_table(world, e);
+    ecs_remove(world, e, Bar);
+
+    ecs_progress(world, 0);
+    ecs_progress(world, 0);
+    ecs_progress(world, 0);
+
+    /* Table is used in between frames, which resets the empty count */
+    ecs_add(world, e, Bar);
+    test_assert(ecs_get_table(world, e) == table);
+    ecs_remove(world, e, Bar);
+
+    int64_t created = info->table_create_total;
+    ecs_progress(world, 0);
+    ecs_progress(world, 0);
+    ecs_progress(world, 0);
+
+    ecs_add(world, e, Bar);
+    test_assert(ecs_get_table(world, e) == table);
+    test_assert(info->table_create_total == created);
+
+    ecs_fini(world);
+}
+
+void World_table_gc_w_time_budget(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_TAG(world, Rel);
+
+    const ecs_world_info_t *info = ecs_get_world_info(world);
+
+    ecs_entity_t e = ecs_new(world);
+    int32_t i;
+    for (i = 0; i < 1000; i ++) {
+        ecs_entity_t tgt = ecs_new(world);
+        ecs_add_pair(world, e, Rel, tgt);
+        ecs_remove_pair(world, e, Rel, tgt);
+    }
+
+    ecs_set_table_gc(world, &(ecs_table_gc_desc_t){
+        .delete_frames = 1,
+        .time_budget_seconds = 0.000000001
+    });
+
+    int64_t deleted = info->table_gc_delete_total;
+    int32_t frames = 0;
+    while ((info->table_gc_delete_total - deleted) < 1000) {
+        ecs_progress(world, 0);
+        frames ++;
+        test_assert(frames < 10000);
+    }
+
+    test_assert(frames > 2);
+
+    ecs_fini(world);
+}
+
+void World_table_gc_disable(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_TAG(world, Foo);
+    ECS_TAG(world, Bar);
+
+    const ecs_world_info_t *info = ecs_get_world_info(world);
+
+    ecs_set_table_gc(world, &(ecs_table_gc_desc_t){
+        .delete_frames = 1
+    });
+    ecs_set_table_gc(world, NULL);
+
+    ecs_entity_t e = ecs_new_w(world, Foo);
+    ecs_add(world, e, Bar);
+    ecs_remove(world, e, Bar);
+
+    ecs_progress(world, 0);
+    ecs_progress(world, 0);
+    ecs_progress(world, 0);
+    test_int(info->table_gc_delete_total, 0);
+    test_int(info->table_pool_count, 0);
+
+    ecs_fini(world);
+}
+
+void World_component_record_memory(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Rel);
+
+    const ecs_world_info_t *info = ecs_get_world_info(world);
+    int64_t memory = info->component_record_memory;
+    test_assert(memory > 0);
+
+    ecs_entity_t tgt = ecs_new(world);
+    ecs_entity_t e = ecs_new_w_pair(world, Rel, tgt);
+    int64_t pair_memory = info->component_record_memory;
+    test_assert(pair_memory > memory);
+
+    ecs_delete(world, tgt);
+    test_assert(ecs_is_alive(world, e));
+    test_assert(info->component_record_memory < pair_memory);
+
+    ecs_fini(world);
+}
+
+void World_component_record_memory_single_table(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Rel);
+    ECS_TAG(world, Foo);
+    ECS_TAG(world, Bar);
+
+    const ecs_world_info_t *info = ecs_get_world_info(world);
+
+    ecs_entity_t tgt_a = ecs_new(world);
+    ecs_entity_t tgt_b = ecs_new(world);
+    ecs_entity_t e1 = ecs_new_w_pair(world, Rel, tgt_a);
+    ecs_entity_t e2 = ecs_new_w_pair(world, Rel, tgt_b);
+    int64_t single_table = info->component_record_memory;
+
+    /* Second table for (Rel, tgt_a) creates table lookup index */
+    ecs_add(world, e1, Foo);
+    int64_t two_tables = info->component_record_memory;
+    test_assert(two_tables > single_table);
+
+    ecs_add(world, e1, Bar);
+    test_assert(ecs_has(world, e1, Foo));
+    test_assert(ecs_has(world, e1, Bar));
+    test_assert(ecs_has_pair(world, e1, Rel, tgt_a));
+    test_assert(ecs_has_pair(world, e2, Rel, tgt_b));
+
+    ecs_query_t *q = ecs_query(world, { .expr = "(Rel, $x)" });
+    test_int(2, ecs_query_count(q).entities);
+    ecs_query_fini(q);
+
+    ecs_remove_pair(world, e1, Rel, tgt_a);
+    test_assert(!ecs_has_pair(world, e1, Rel, tgt_a));
+    test_assert(ecs_has(world, e1, Foo));
+
+    ecs_fini(world);
+}
@@ -774,6 +774,16 @@ void Hierarchies_lookup_after_delete_from_root(void);
 void Hierarchies_lookup_after_delete_from_parent(void);
 void Hierarchies_defer_batch_remove_name_w_add_childof(void);
 void Hierarchies_defer_batch_remove_childof_w_add_name(void);
+void Hierarchies_path_cache_get_path(void);
+void Hierarchies_path_cache_get_path_escape(void);
+void Hierarchies_path_cache_lookup(void);
+void Hierarchies_path_cache_rename_parent(void);
+void Hierarchies_path_cache_reparent(void);
+void Hierarchies_path_cache_remove_parent(void);
+void Hierarchies_path_cache_delete(void);
+void Hierarchies_path_cache_disable(void);
+void Hierarchies_path_cache_core_entity(void);
+void Hierarchies_path_cache_relative_lookup(void);
 
 // Testsuite 'OrderedChildren'
 void OrderedChildren_iter_no_children(void);
@@ -849,6 +859,13 @@ void Get_component_ensure_equal_get(void);
 void Get_component_get_tag(void);
 void Get_component_get_pair_tag(void);
 void Get_component_get_wildcard(void);
+void Get_component_get_many(void);
+void Get_component_get_many_w_missing(void);
+void Get_component_get_many_w_pair(void);
+void Get_component_get_many_w_base(void);
+void Get_component_get_many_sparse(void);
+void Get_component_get_many_large_batch(void);
+void Get_component_get_many_empty(void);
 
 // Testsuite 'Reference'
 void Reference_setup(void);
@@ -909,6 +926,18 @@ void Delete_move_w_dtor_move(void);
 void Delete_move_w_dtor_no_move(void);
 void Delete_move_w_no_dtor_move(void);
 void Delete_wrap_generation_count(void);
+void Delete_delete_many(void);
+void Delete_delete_many_w_tables(void);
+void Delete_delete_many_w_not_alive(void);
+void Delete_delete_many_w_on_remove(void);
+void Delete_delete_many_w_on_remove_hook(void);
+void Delete_delete_many_w_parent(void);
+void Delete_delete_many_w_toggle(void);
+void Delete_delete_many_deferred(void);
+void Delete_delete_deferred_batch(void);
+void Delete_delete_many_empty(void);
+void Delete_delete_many_w_ctor_move_dtor(void);
+void Delete_delete_deferred_batch_w_cmd_after(void);
 
 // Testsuite 'OnDelete'
 void OnDelete_flags(void);
@@ -1038,6 +1067,18 @@ void OnDelete_delete_with_1(void);
 void OnDelete_delete_with_2(void);
 void OnDelete_delete_with_3(void);
 void OnDelete_empty_after_remove(void);
+void OnDelete_parallel_delete_children_w_dtor(void);
+void OnDelete_parallel_delete_children_w_threads(void);
+void OnDelete_parallel_delete_on_remove_before_dtor(void);
+void OnDelete_parallel_delete_w_observer(void);
+void OnDelete_parallel_delete_delete_with(void);
+void OnDelete_parallel_delete_nested_hierarchy(void);
+void OnDelete_delete_incremental_subtree(void);
+void OnDelete_delete_incremental_w_budget(void);
+void OnDelete_delete_incremental_children_before_parent(void);
+void OnDelete_delete_incremental_deleted_before_run(void);
+void OnDelete_delete_incremental_world(void);
+void OnDelete_delete_incremental_fini_w_queued(void);
 
 // Testsuite 'Set'
 void Set_set_empty(void);
@@ -1433,6 +1474,8 @@ void Pairs_force_relationship_on_relationship(void);
 void Pairs_force_target_on_component(void);
 void Pairs_force_target_on_relationship(void);
 void Pairs_force_target_on_target(void);
+void Pairs_add_remove_pair_many_targets(void);
+void Pairs_add_pair_many_targets_after_table_delete(void);
 
 // Testsuite 'Trigger'
 void Trigger_on_add_trigger_before_table(void);
@@ -1805,6 +1848,23 @@ void Observer_cache_test_13(void);
 void Observer_cache_test_14(void);
 void Observer_cache_test_15(void);
 void Observer_cache_test_16(void);
+void Observer_yield_existing_incremental(void);
+void Observer_yield_existing_incremental_frame_end(void);
+void Observer_yield_existing_incremental_time_budget(void);
+void Observer_yield_existing_incremental_event_order(void);
+void Observer_yield_existing_incremental_event_order_deferred(void);
+void Observer_yield_existing_incremental_new_entity(void);
+void Observer_yield_existing_incremental_deleted_entity(void);
+void Observer_yield_existing_incremental_moved_entity(void);
+void Observer_yield_existing_incremental_multi(void);
+void Observer_yield_existing_incremental_delete_observer(void);
+void Observer_yield_existing_incremental_delete_observer_w_remove(void);
+void Observer_yield_existing_incremental_no_matches(void);
+void Observer_yield_existing_multi_threaded(void);
+void Observer_yield_existing_incremental_multi_threaded(void);
+void Observer_yield_existing_multi_threaded_no_parallel_for(void);
+void Observer_yield_existing_incremental_deleted_middle_entity(void);
+void Observer_yield_existing_incremental_multi_threaded_w_run(void);
 
 // Testsuite 'ObserverOnSet'
 void ObserverOnSet_set_1_of_1(void);
@@ -2092,6 +2152,12 @@ void Prefab_instantiate_w_non_fragmenting_component_while_defer_suspended(void);
 void Prefab_instantiate_w_non_fragmenting_tag_while_defer_suspended(void);
 void Prefab_instantiate_w_non_fragmenting_pair_while_defer_suspended(void);
 void Prefab_instantiate_w_non_fragmenting_pair_tag_while_defer_suspended(void);
+void Prefab_bulk_instantiate_w_children(void);
+void Prefab_bulk_instantiate_w_grandchildren(void);
+void Prefab_bulk_instantiate_w_slots(void);
+void Prefab_instantiate_after_child_type_changed(void);
+void Prefab_instantiate_prefab_and_instance_from_same_prefab(void);
+void Prefab_instantiate_after_observer_created(void);
 
 // Testsuite 'World'
 void World_setup(void);
@@ -2170,6 +2236,18 @@ void World_init_shrink_twice_fini(void);
 void World_init_create_delete_entities_shrink_fini(void);
 void World_init_create_delete_random_1_entities_shrink_fini(void);
 void World_init_create_delete_random_2_entities_shrink_fini(void);
+void World_control_fps_precise(void);
+void World_control_fps_precise_busy_app(void);
+void World_frame_time_percentiles(void);
+void World_frame_time_percentiles_w_delta_time(void);
+void World_frame_time_percentiles_busy_frame(void);
+void World_table_gc_delete_after_frames(void);
+void World_table_gc_clear_and_reuse(void);
+void World_table_gc_reset_when_used(void);
+void World_table_gc_w_time_budget(void);
+void World_table_gc_disable(void);
+void World_component_record_memory(void);
+void World_component_record_memory_single_table(void);
 
 // Testsuite 'ExclusiveAccess'
 void ExclusiveAccess_self(void);
@@ -2486,6 +2564,19 @@ void Commands_batch_w_two_named_entities_one_reparent(void);
 void Commands_batch_w_two_named_entities_one_reparent_w_remove(void);
 void Commands_batch_new_w_parent_w_name(void);
 void Commands_enable_component_from_stage(void);
+void Commands_async_add(void);
+void Commands_async_remove(void);
+void Commands_async_set(void);
+void Commands_async_delete(void);
+void Commands_async_enqueue(void);
+void Commands_async_order(void);
+void Commands_async_not_alive(void);
+void Commands_async_in_readonly(void);
+void Commands_async_wrap_queue(void);
+void Commands_async_from_threads(void);
+void Commands_async_fini_w_pending(void);
+void Commands_async_overflow(void);
+void Commands_async_fini_w_overflow(void);
 
 // Testsuite 'SingleThreadStaging'
 void SingleThreadStaging_setup(void);
@@ -5638,6 +5729,46 @@ bake_test_case Hierarchies_testcases[] = {
     {
         "defer_batch_remove_childof_w_add_name",
         Hierarchies_defer_batch_remove_childof_w_add_name
+    },
+    {
+        "path_cache_get_path",
+        Hierarchies_path_cache_get_path
+    },
+    {
+        "path_cache_get_path_escape",
+        Hierarchies_path_cache_get_path_escape
+    },
+    {
+        "path_cache_lookup",
+        Hierarchies_path_cache_lookup
+    },
+    {
+        "path_cache_rename_parent",
+        Hierarchies_path_cache_rename_parent
+    },
+    {
+        "path_cache_reparent",
+        Hierarchies_path_cache_reparent
+    },
+    {
+        "path_cache_remove_parent",
+        Hierarchies_path_cache_remove_parent
+    },
+    {
+        "path_cache_delete",
+        Hierarchies_path_cache_delete
+    },
+    {
+        "path_cache_disable",
+        Hierarchies_path_cache_disable
+    },
+    {
+        "path_cache_core_entity",
+        Hierarchies_path_cache_core_entity
+    },
+    {
+        "path_cache_relative_lookup",
+        Hierarchies_path_cache_relative_lookup
     }
 };
 
@@ -5914,6 +6045,34 @@ bake_test_case Get_component_testcases[] = {
     {
         "get_wildcard",
         Get_component_get_wildcard
+    },
+    {
+        "get_many",
+        Get_component_get_many
+    },
+    {
+        "get_many_w_missing",
+        Get_component_get_many_w_missing
+    },
+    {
+        "get_many_w_pair",
+        Get_component_get_many_w_pair
+    },
+    {
+        "get_many_w_base",
+        Get_component_get_many_w_base
+    },
+    {
+        "get_many_sparse",
+        Get_component_get_many_sparse
+    },
+    {
+        "get_many_large_batch",
+        Get_component_get_many_large_batch
+    },
+    {
+        "get_many_empty",
+        Get_component_get_many_empty
     }
 };
 
@@ -6136,6 +6295,54 @@ bake_test_case Delete_testcases[] = {
     {
         "wrap_generation_count",
         Delete_wrap_generation_count
+    },
+    {
+        "delete_many",
+        Delete_delete_many
+    },
+    {
+        "delete_many_w_tables",
+        Delete_delete_many_w_tables
+    },
+    {
+        "delete_many_w_not_alive",
+        Delete_delete_many_w_not_alive
+    },
+    {
+        "delete_many_w_on_remove",
+        Delete_delete_many_w_on_remove
+    },
+    {
+        "delete_many_w_on_remove_hook",
+        Delete_delete_many_w_on_remove_hook
+    },
+    {
+        "delete_many_w_parent",
+        Delete_delete_many_w_parent
+    },
+    {
+        "delete_many_w_toggle",
+        Delete_delete_many_w_toggle
+    },
+    {
+        "delete_many_deferred",
+        Delete_delete_many_deferred
+    },
+    {
+        "delete_deferred_batch",
+        Delete_delete_deferred_batch
+    },
+    {
+        "delete_many_empty",
+        Delete_delete_many_empty
+    },
+    {
+        "delete_many_w_ctor_move_dtor",
+        Delete_delete_many_w_ctor_move_dtor
+    },
+    {
+        "delete_deferred_batch_w_cmd_after",
+        Delete_delete_deferred_batch_w_cmd_after
     }
 };
 
@@ -6647,6 +6854,54 @@ bake_test_case OnDelete_testcases[] = {
     {
         "empty_after_remove",
         OnDelete_empty_after_remove
+    },
+    {
+        "parallel_delete_children_w_dtor",
+        OnDelete_parallel_delete_children_w_dtor
+    },
+    {
+        "parallel_delete_children_w_threads",
+        OnDelete_parallel_delete_children_w_threads
+    },
+    {
+        "parallel_delete_on_remove_before_dtor",
+        OnDelete_parallel_delete_on_remove_before_dtor
+    },
+    {
+        "parallel_delete_w_observer",
+        OnDelete_parallel_delete_w_observer
+    },
+    {
+        "parallel_delete_delete_with",
+        OnDelete_parallel_delete_delete_with
+    },
+    {
+        "parallel_delete_nested_hierarchy",
+        OnDelete_parallel_delete_nested_hierarchy
+    },
+    {
+        "delete_incremental_subtree",
+        OnDelete_delete_incremental_subtree
+    },
+    {
+        "delete_incremental_w_budget",
+        OnDelete_delete_incremental_w_budget
+    },
+    {
+        "delete_incremental_children_before_parent",
+        OnDelete_delete_incremental_children_before_parent
+    },
+    {
+        "delete_incremental_deleted_before_run",
+        OnDelete_delete_incremental_deleted_before_run
+    },
+    {
+        "delete_incremental_world",
+        OnDelete_delete_incremental_world
+    },
+    {
+        "delete_incremental_fini_w_queued",
+        OnDelete_delete_incremental_fini_w_queued
     }
 };
 
@@ -8184,6 +8439,14 @@ bake_test_case Pairs_testcases[] = {
     {
         "force_target_on_target",
         Pairs_force_target_on_target
+    },
+    {
+        "add_remove_pair_many_targets",
+        Pairs_add_remove_pair_many_targets
+    },
+    {
+        "add_pair_many_targets_after_table_delete",
+        Pairs_add_pair_many_targets_after_table_delete
     }
 };
 
@@ -9662,6 +9925,74 @@ bake_test_case Observer_testcases[] = {
     {
         "cache_test_16",
         Observer_cache_test_16
+    },
+    {
+        "yield_existing_incremental",
+        Observer_yield_existing_incremental
+    },
+    {
+        "yield_existing_incremental_frame_end",
+        Observer_yield_existing_incremental_frame_end
+    },
+    {
+        "yield_existing_incremental_time_budget",
+        Observer_yield_existing_incremental_time_budget
+    },
+    {
+        "yield_existing_incremental_event_order",
+        Observer_yield_existing_incremental_event_order
+    },
+    {
+        "yield_existing_incremental_event_order_deferred",
+        Observer_yield_existing_incremental_event_order_deferred
+    },
+    {
+        "yield_existing_incremental_new_entity",
+        Observer_yield_existing_incremental_new_entity
+    },
+    {
+        "yield_existing_incremental_deleted_entity",
+        Observer_yield_existing_incremental_deleted_entity
+    },
+    {
+        "yield_existing_incremental_moved_entity",
+        Observer_yield_existing_incremental_moved_entity
+    },
+    {
+        "yield_existing_incremental_multi",
+        Observer_yield_existing_incremental_multi
+    },
+    {
+        "yield_existing_incremental_delete_observer",
+        Observer_yield_existing_incremental_delete_observer
+    },
+    {
+        "yield_existing_incremental_delete_observer_w_remove",
+        Observer_yield_existing_incremental_delete_observer_w_remove
+    },
+    {
+        "yield_existing_incremental_no_matches",
+        Observer_yield_existing_incremental_no_matches
+    },
+    {
+        "yield_existing_multi_threaded",
+        Observer_yield_existing_multi_threaded
+    },
+    {
+        "yield_existing_incremental_multi_threaded",
+        Observer_yield_existing_incremental_multi_threaded
+    },
+    {
+        "yield_existing_multi_threaded_no_parallel_for",
+        Observer_yield_existing_multi_threaded_no_parallel_for
+    },
+    {
+        "yield_existing_incremental_deleted_middle_entity",
+        Observer_yield_existing_incremental_deleted_middle_entity
+    },
+    {
+        "yield_existing_incremental_multi_threaded_w_run",
+        Observer_yield_existing_incremental_multi_threaded_w_run
     }
 };
 
@@ -10772,6 +11103,30 @@ bake_test_case Prefab_testcases[] = {
     {
         "instantiate_w_non_fragmenting_pair_tag_while_defer_suspended",
         Prefab_instantiate_w_non_fragmenting_pair_tag_while_defer_suspended
+    },
+    {
+        "bulk_instantiate_w_children",
+        Prefab_bulk_instantiate_w_children
+    },
+    {
+        "bulk_instantiate_w_grandchildren",
+        Prefab_bulk_instantiate_w_grandchildren
+    },
+    {
+        "bulk_instantiate_w_slots",
+        Prefab_bulk_instantiate_w_slots
+    },
+    {
+        "instantiate_after_child_type_changed",
+        Prefab_instantiate_after_child_type_changed
+    },
+    {
+        "instantiate_prefab_and_instance_from_same_prefab",
+        Prefab_instantiate_prefab_and_instance_from_same_prefab
+    },
+    {
+        "instantiate_after_observer_created",
+        Prefab_instantiate_after_observer_created
     }
 };
 
@@ -11075,6 +11430,54 @@ bake_test_case World_testcases[] = {
     {
         "init_create_delete_random_2_entities_shrink_fini",
         World_init_create_delete_random_2_entities_shrink_fini
+    },
+    {
+        "control_fps_precise",
+        World_control_fps_precise
+    },
+    {
+        "control_fps_precise_busy_app",
+        World_control_fps_precise_busy_app
+    },
+    {
+        "frame_time_percentiles",
+        World_frame_time_percentiles
+    },
+    {
+        "frame_time_percentiles_w_delta_time",
+        World_frame_time_percentiles_w_delta_time
+    },
+    {
+        "frame_time_percentiles_busy_frame",
+        World_frame_time_percentiles_busy_frame
+    },
+    {
+        "table_gc_delete_after_frames",
+        World_table_gc_delete_after_frames
+    },
+    {
+        "table_gc_clear_and_reuse",
+        World_table_gc_clear_and_reuse
+    },
+    {
+        "table_gc_reset_when_used",
+        World_table_gc_reset_when_used
+    },
+    {
+        "table_gc_w_time_budget",
+        World_table_gc_w_time_budget
+    },
+    {
+        "table_gc_disable",
+        World_table_gc_disable
+    },
+    {
+        "component_record_memory",
+        World_component_record_memory
+    },
+    {
+        "component_record_memory_single_table",
+        World_component_record_memory_single_table
     }
 };
 
@@ -12315,6 +12718,58 @@ bake_test_case Commands_testcases[] = {
     {
         "enable_component_from_stage",
         Commands_enable_component_from_stage
+    },
+    {
+        "async_add",
+        Commands_async_add
+    },
+    {
+        "async_remove",
+        Commands_async_remove
+    },
+    {
+        "async_set",
+        Commands_async_set
+    },
+    {
+        "async_delete",
+        Commands_async_delete
+    },
+    {
+        "async_enqueue",
+        Commands_async_enqueue
+    },
+    {
+        "async_order",
+        Commands_async_order
+    },
+    {
+        "async_not_alive",
+        Commands_async_not_alive
+    },
+    {
+        "async_in_readonly",
+        Commands_async_in_readonly
+    },
+    {
+        "async_wrap_queue",
+        Commands_async_wrap_queue
+    },
+    {
+        "async_from_threads",
+        Commands_async_from_threads
+    },
+    {
+        "async_fini_w_pending",
+        Commands_async_fini_w_pending
+    },
+    {
+        "async_overflow",
+        Commands_async_overflow
+    },
+    {
+        "async_fini_w_overflow",
+        Commands_async_fini_w_overflow
     }
 };
 
@@ -13042,7 +13497,7 @@ static bake_test_suite suites[] = {
         "Hierarchies",
         Hierarchies_setup,
         NULL,
-        108,
+        118,
         Hierarchies_testcases
     },
     {
@@ -13070,7 +13525,7 @@ static bake_test_suite suites[] = {
         "Get_component",
         Get_component_setup,
         NULL,
-        14,
+        21,
         Get_component_testcases
     },
     {
@@ -13084,14 +13539,14 @@ static bake_test_suite suites[] = {
         "Delete",
         Delete_setup,
         NULL,
-        32,
+        44,
         Delete_testcases
     },
     {
         "OnDelete",
         NULL,
         NULL,
-        127,
+        139,
         OnDelete_testcases
     },
     {
@@ -13140,7 +13595,7 @@ static bake_test_suite suites[] = {
         "Pairs",
         NULL,
         NULL,
-        125,
+        127,
         Pairs_testcases
     },
     {
@@ -13154,7 +13609,7 @@ static bake_test_suite suites[] = {
         "Observer",
         NULL,
         NULL,
-        248,
+        265,
         Observer_testcases
     },
     {
@@ -13196,14 +13651,14 @@ static bake_test_suite suites[] = {
         "Prefab",
         Prefab_setup,
         NULL,
-        171,
+        177,
         Prefab_testcases
     },
     {
         "World",
         World_setup,
         NULL,
-        75,
+        87,
         World_testcases
     },
     {
@@ -13231,7 +13686,7 @@ static bake_test_suite suites[] = {
         "Commands",
         NULL,
         NULL,
-        159,
+        172,
         Commands_testcases
     },
     {
@@ -1601,3 +1601,31 @@ void Observer_fixed_src_w_run(void) {
     
     test_assert(matched == 0);
 }
+
+void Observer_yield_existing_incremental(void) {
+    flecs::world world;
+
+    struct Tag0 { };
+
+    auto e1 = world.entity().add<Tag0>();
+    auto e2 = world.entity().add<Tag0>();
+
+    int32_t count = 0;
+
+    world.observer<Tag0>()
+        .event(flecs::OnAdd)
+        .yield_existing()
+        .yield_existing_time_budget(1.0)
+        .each([&](flecs::entity e, Tag0) {
+            if (e == e1) count ++;
+            if (e == e2) count += 2;
+        });
+
+    test_int(count, 0);
+    test_int(world.get_info()->observer_yield_count, 2);
+
+    world.progress();
+
+    test_int(count, 3);
+    test_int(world.get_info()->observer_yield_count, 0);
+}
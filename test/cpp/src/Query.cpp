@@ -3856,3 +3856,43 @@ void Query_copy_operators(void) {
 
     test_assert(copyAssign.c_ptr() == defaultInit.c_ptr());
 }
+
+void Query_toggle_mask(void) {
+    flecs::world world;
+
+    world.component<Position>().add(flecs::CanToggle);
+
+    flecs::entity e[100];
+    for (int i = 0; i < 100; i ++) {
+        e[i] = world.entity().set<Position>({static_cast<float>(i), 0});
+        if (i % 2) {
+            e[i].disable<Position>();
+        } else {
+            e[i].enable<Position>();
+        }
+    }
+
+    auto q = world.query_builder<const Position>()
+        .toggle_mask()
+        .build();
+
+    int32_t count = 0, results = 0;
+    q.run([&](flecs::iter& it) {
+        while (it.next()) {
+            auto p = it.field<const Position>(0);
+            uint64_t mask = it.row_mask();
+            test_assert(it.count() <= 64);
+            for (auto i : it) {
+                if (mask & (1llu << i)) {
+                    test_int(p[i].x, count * 2);
+                    test_assert(it.entity(i) == e[count * 2]);
+                    count ++;
+                }
+            }
+            results ++;
+        }
+    });
+
+    test_int(count, 50);
+    test_int(results, 2);
+}
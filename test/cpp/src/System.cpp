@@ -2357,3 +2357,46 @@ void System_run_w_0_src_query(void) {
     world.progress();
     test_int(count, 1);
 }
+
+void System_custom_pipeline_concurrent(void) {
+    flecs::world world;
+
+    world.component<Position>();
+    world.component<Velocity>();
+
+    flecs::entity pip = world.pipeline()
+        .with(flecs::System)
+        .with(flecs::Phase).cascade(flecs::DependsOn)
+        .concurrent()
+        .build();
+
+    int32_t p_count = 0, v_count = 0;
+
+    world.system<Position>()
+        .multi_threaded()
+        .run([&](flecs::iter& it) {
+            while (it.next()) {
+                ecs_os_ainc(&p_count);
+            }
+        });
+
+    world.system<Velocity>()
+        .multi_threaded()
+        .run([&](flecs::iter& it) {
+            while (it.next()) {
+                ecs_os_ainc(&v_count);
+            }
+        });
+
+    for (int i = 0; i < 10; i ++) {
+        world.entity().set<Position>({0, 0}).set<Velocity>({0, 0});
+    }
+
+    world.set_pipeline(pip);
+    world.set_threads(4);
+
+    world.progress();
+
+    test_int(p_count, 1);
+    test_int(v_count, 1);
+}
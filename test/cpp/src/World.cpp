@@ -2160,3 +2160,49 @@ void World_exclusive_access_other_mutate(void) {
 
     test_assert(false); // should not get here
 }
+
+void World_parallel_each(void) {
+    flecs::world ecs;
+
+    ecs.component<Tag>();
+
+    ecs.set_threads(4);
+
+    flecs::entity entities[100];
+    for (int i = 0; i < 100; i ++) {
+        entities[i] = ecs.entity().set<Position>({static_cast<float>(i), 0});
+    }
+
+    flecs::query<Position> q = ecs.query<Position>();
+
+    ecs.parallel_each(q, [](flecs::entity e, Position& p) {
+        p.y = p.x * 2;
+        e.add<Tag>();
+    });
+
+    for (int i = 0; i < 100; i ++) {
+        const Position& p = entities[i].get<Position>();
+        test_int(p.x, i);
+        test_int(p.y, i * 2);
+        test_assert(entities[i].has<Tag>());
+    }
+}
+
+void World_parallel_each_no_threads(void) {
+    flecs::world ecs;
+
+    flecs::entity e1 = ecs.entity().set<Position>({10, 20});
+    flecs::entity e2 = ecs.entity().set<Position>({30, 40});
+
+    flecs::query<Position> q = ecs.query<Position>();
+
+    int32_t count = 0;
+    ecs.parallel_each(q, [&](Position& p) {
+        p.x ++;
+        count ++;
+    });
+
+    test_int(count, 2);
+    test_int(e1.get<Position>().x, 11);
+    test_int(e2.get<Position>().x, 31);
+}
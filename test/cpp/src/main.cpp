@@ -591,6 +591,7 @@ void System_register_twice_w_run(void);
 void System_register_twice_w_run_each(void);
 void System_register_twice_w_each_run(void);
 void System_run_w_0_src_query(void);
+void System_custom_pipeline_concurrent(void);
 
 // Testsuite 'Event'
 void Event_evt_1_id_entity(void);
@@ -768,6 +769,7 @@ void Query_iter_targets_field_out_of_range(void);
 void Query_iter_targets_field_not_a_pair(void);
 void Query_iter_targets_field_not_set(void);
 void Query_copy_operators(void);
+void Query_toggle_mask(void);
 
 // Testsuite 'QueryBuilder'
 void QueryBuilder_setup(void);
@@ -1036,6 +1038,7 @@ void Observer_trigger_on_set_in_on_add_implicit_registration(void);
 void Observer_trigger_on_set_in_on_add_implicit_registration_namespaced(void);
 void Observer_fixed_src_w_each(void);
 void Observer_fixed_src_w_run(void);
+void Observer_yield_existing_incremental(void);
 
 // Testsuite 'ComponentLifecycle'
 void ComponentLifecycle_ctor_on_add(void);
@@ -1364,6 +1367,8 @@ void World_fini_copy_move_assign(void);
 void World_world_init_fini_log_all(void);
 void World_exclusive_access_self_mutate(void);
 void World_exclusive_access_other_mutate(void);
+void World_parallel_each(void);
+void World_parallel_each_no_threads(void);
 
 // Testsuite 'Singleton'
 void Singleton_set_get_singleton(void);
@@ -3879,6 +3884,10 @@ bake_test_case System_testcases[] = {
     {
         "run_w_0_src_query",
         System_run_w_0_src_query
+    },
+    {
+        "custom_pipeline_concurrent",
+        System_custom_pipeline_concurrent
     }
 };
 
@@ -4572,6 +4581,10 @@ bake_test_case Query_testcases[] = {
     {
         "copy_operators",
         Query_copy_operators
+    },
+    {
+        "toggle_mask",
+        Query_toggle_mask
     }
 };
 
@@ -5625,6 +5638,10 @@ bake_test_case Observer_testcases[] = {
     {
         "fixed_src_w_run",
         Observer_fixed_src_w_run
+    },
+    {
+        "yield_existing_incremental",
+        Observer_yield_existing_incremental
     }
 };
 
@@ -6907,6 +6924,14 @@ bake_test_case World_testcases[] = {
     {
         "exclusive_access_other_mutate",
         World_exclusive_access_other_mutate
+    },
+    {
+        "parallel_each",
+        World_parallel_each
+    },
+    {
+        "parallel_each_no_threads",
+        World_parallel_each_no_threads
     }
 };
 
@@ -7824,7 +7849,7 @@ static bake_test_suite suites[] = {
         "System",
         NULL,
         NULL,
-        74,
+        75,
         System_testcases
     },
     {
@@ -7845,7 +7870,7 @@ static bake_test_suite suites[] = {
         "Query",
         NULL,
         NULL,
-        136,
+        137,
         Query_testcases
     },
     {
@@ -7868,7 +7893,7 @@ static bake_test_suite suites[] = {
         "Observer",
         NULL,
         NULL,
-        63,
+        64,
         Observer_testcases
     },
     {
@@ -7910,7 +7935,7 @@ static bake_test_suite suites[] = {
         "World",
         NULL,
         NULL,
-        119,
+        121,
         World_testcases
     },
     {
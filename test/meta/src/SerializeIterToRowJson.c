@@ -2858,3 +2858,242 @@ void SerializeIterToRowJson_serialize_entity_w_flecs_core_parent(void) {
 
     ecs_fini(world);
 }
+
+static
+void parallel_populate(
+    ecs_world_t *world,
+    ecs_entity_t ecs_id(Position),
+    int32_t count)
+{
+    ECS_TAG(world, TagA);
+    ECS_TAG(world, TagB);
+
+    ecs_entity_t parent = ecs_entity(world, { .name = "parent" });
+
+    for (int i = 0; i < count; i ++) {
+        char name[32];
+        ecs_os_snprintf(name, 32, "e%d", i);
+        ecs_entity_t e = ecs_entity(world, { 
+            .name = name, .parent = (i % 3) ? parent : 0 });
+        ecs_set(world, e, Position, {i, i * 2});
+        if (i % 2) {
+            ecs_add(world, e, TagA);
+        }
+        if (i % 5) {
+            ecs_add(world, e, TagB);
+        }
+    }
+}
+
+static
+char* parallel_to_json(
+    ecs_world_t *world,
+    ecs_query_t *q,
+    ecs_iter_to_json_desc_t *desc,
+    bool parallel)
+{
+    desc->parallel = parallel;
+    ecs_iter_t it = ecs_query_iter(world, q);
+    char *json = ecs_iter_to_json(&it, desc);
+    test_assert(json != NULL);
+    return json;
+}
+
+void SerializeIterToRowJson_serialize_parallel(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_struct(world, {
+        .entity = ecs_id(Position),
+        .members = {
+            { "x", ecs_id(ecs_i32_t) },
+            { "y", ecs_id(ecs_i32_t) }
+        }
+    });
+
+    parallel_populate(world, ecs_id(Position), 10000);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position, ?TagA"
+    });
+
+    test_assert(q != NULL);
+
+    ecs_iter_to_json_desc_t desc = ECS_ITER_TO_JSON_INIT;
+    desc.serialize_entity_ids = true;
+    char *expect = parallel_to_json(world, q, &desc, false);
+    int32_t eval_count = q->eval_count;
+
+    ecs_set_threads(world, 4);
+
+    char *json = parallel_to_json(world, q, &desc, true);
+    test_str(json, expect);
+    test_int(q->eval_count, eval_count + 1);
+
+    ecs_os_free(json);
+    ecs_os_free(expect);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void SerializeIterToRowJson_serialize_parallel_table(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_struct(world, {
+        .entity = ecs_id(Position),
+        .members = {
+            { "x", ecs_id(ecs_i32_t) },
+            { "y", ecs_id(ecs_i32_t) }
+        }
+    });
+
+    parallel_populate(world, ecs_id(Position), 5000);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position"
+    });
+
+    test_assert(q != NULL);
+
+    ecs_iter_to_json_desc_t desc = ECS_ITER_TO_JSON_INIT;
+    desc.serialize_table = true;
+    char *expect = parallel_to_json(world, q, &desc, false);
+
+    ecs_set_threads(world, 3);
+
+    char *json = parallel_to_json(world, q, &desc, true);
+    test_str(json, expect);
+
+    ecs_os_free(json);
+    ecs_os_free(expect);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void SerializeIterToRowJson_serialize_parallel_no_this(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_struct(world, {
+        .entity = ecs_id(Position),
+        .members = {
+            { "x", ecs_id(ecs_i32_t) },
+            { "y", ecs_id(ecs_i32_t) }
+        }
+    });
+
+    parallel_populate(world, ecs_id(Position), 10);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position(parent.e1), TagA($x), Position($x)"
+    });
+
+    test_assert(q != NULL);
+
+    ecs_iter_to_json_desc_t desc = ECS_ITER_TO_JSON_INIT;
+    char *expect = parallel_to_json(world, q, &desc, false);
+
+    ecs_set_threads(world, 4);
+
+    char *json = parallel_to_json(world, q, &desc, true);
+    test_str(json, expect);
+
+    ecs_os_free(json);
+    ecs_os_free(expect);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void SerializeIterToRowJson_serialize_parallel_no_threads(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_struct(world, {
+        .entity = ecs_id(Position),
+        .members = {
+            { "x", ecs_id(ecs_i32_t) },
+            { "y", ecs_id(ecs_i32_t) }
+        }
+    });
+
+    parallel_populate(world, ecs_id(Position), 3000);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position"
+    });
+
+    test_assert(q != NULL);
+
+    ecs_iter_to_json_desc_t desc = ECS_ITER_TO_JSON_INIT;
+    char *expect = parallel_to_json(world, q, &desc, false);
+    char *json = parallel_to_json(world, q, &desc, true);
+    test_str(json, expect);
+
+    ecs_os_free(json);
+    ecs_os_free(expect);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void SerializeIterToRowJson_serialize_parallel_w_var(void) {
+    ecs_world_t *world = ecs_init();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_struct(world, {
+        .entity = ecs_id(Position),
+        .members = {
+            { "x", ecs_id(ecs_i32_t) },
+            { "y", ecs_id(ecs_i32_t) }
+        }
+    });
+
+    parallel_populate(world, ecs_id(Position), 3000);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position, ChildOf($this, $p)"
+    });
+
+    test_assert(q != NULL);
+
+    ecs_entity_t parent = ecs_lookup(world, "parent");
+    test_assert(parent != 0);
+
+    int32_t p_var = ecs_query_find_var(q, "p");
+    test_assert(p_var != -1);
+
+    ecs_iter_to_json_desc_t desc = ECS_ITER_TO_JSON_INIT;
+    ecs_iter_t it = ecs_query_iter(world, q);
+    ecs_iter_set_var(&it, p_var, parent);
+    char *expect = ecs_iter_to_json(&it, &desc);
+    test_assert(expect != NULL);
+
+    ecs_set_threads(world, 4);
+
+    /* Iterator with variable is serialized on calling thread */
+    desc.parallel = true;
+    it = ecs_query_iter(world, q);
+    ecs_iter_set_var(&it, p_var, parent);
+    char *json = ecs_iter_to_json(&it, &desc);
+    test_str(json, expect);
+
+    ecs_os_free(json);
+    ecs_os_free(expect);
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
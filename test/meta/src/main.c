@@ -881,6 +881,11 @@ void SerializeIterToRowJson_serialize_w_field_info_pair_w_not_component(void);
 void SerializeIterToRowJson_serialize_w_field_info_w_or(void);
 void SerializeIterToRowJson_serialize_recycled_id(void);
 void SerializeIterToRowJson_serialize_entity_w_flecs_core_parent(void);
+void SerializeIterToRowJson_serialize_parallel(void);
+void SerializeIterToRowJson_serialize_parallel_table(void);
+void SerializeIterToRowJson_serialize_parallel_no_this(void);
+void SerializeIterToRowJson_serialize_parallel_no_threads(void);
+void SerializeIterToRowJson_serialize_parallel_w_var(void);
 
 // Testsuite 'SerializeTypeInfoToJson'
 void SerializeTypeInfoToJson_bool(void);
@@ -4501,6 +4506,26 @@ bake_test_case SerializeIterToRowJson_testcases[] = {
     {
         "serialize_entity_w_flecs_core_parent",
         SerializeIterToRowJson_serialize_entity_w_flecs_core_parent
+    },
+    {
+        "serialize_parallel",
+        SerializeIterToRowJson_serialize_parallel
+    },
+    {
+        "serialize_parallel_table",
+        SerializeIterToRowJson_serialize_parallel_table
+    },
+    {
+        "serialize_parallel_no_this",
+        SerializeIterToRowJson_serialize_parallel_no_this
+    },
+    {
+        "serialize_parallel_no_threads",
+        SerializeIterToRowJson_serialize_parallel_no_threads
+    },
+    {
+        "serialize_parallel_w_var",
+        SerializeIterToRowJson_serialize_parallel_w_var
     }
 };
 
@@ -5404,7 +5429,7 @@ static bake_test_suite suites[] = {
         "SerializeIterToRowJson",
         NULL,
         NULL,
-        60,
+        65,
         SerializeIterToRowJson_testcases
     },
     {
@@ -3444,3 +3444,376 @@ void ChangeDetection_detect_w_cascade_desc(void) {
 
     ecs_fini(world);
 }
+
+void ChangeDetection_changed_rows_after_set(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ecs_add_id(world, ecs_id(Position), EcsDirtyRows);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {1, 2}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {3, 4}));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Position, {5, 6}));
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "[in] Position",
+        .cache_kind = EcsQueryCacheAuto,
+        .flags = EcsQueryDetectChanges
+    });
+    test_assert(q != NULL);
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        test_bool(true, ecs_query_next(&it));
+        test_int(it.count, 3);
+        int32_t offset = 0, count = 0;
+        test_bool(true, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        test_int(offset, 0);
+        test_int(count, 3);
+        offset += count;
+        test_bool(false, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        ecs_iter_clear_changed_rows(&it, 0);
+        test_bool(false, ecs_query_next(&it));
+    }
+
+    ecs_set(world, e2, Position, {30, 40});
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        test_bool(true, ecs_query_next(&it));
+        test_int(it.count, 3);
+        int32_t offset = 0, count = 0;
+        test_bool(true, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        test_int(offset, 1);
+        test_int(count, 1);
+        test_uint(it.entities[offset], e2);
+        offset += count;
+        test_bool(false, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        ecs_iter_clear_changed_rows(&it, 0);
+        test_bool(false, ecs_query_next(&it));
+    }
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        test_bool(true, ecs_query_next(&it));
+        int32_t offset = 0, count = 0;
+        test_bool(false, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        test_bool(false, ecs_query_next(&it));
+    }
+
+    ecs_set(world, e1, Position, {10, 20});
+    ecs_modified(world, e3, Position);
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        test_bool(true, ecs_query_next(&it));
+        int32_t offset = 0, count = 0;
+        test_bool(true, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        test_int(offset, 0);
+        test_int(count, 1);
+        test_uint(it.entities[offset], e1);
+        offset += count;
+        test_bool(true, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        test_int(offset, 2);
+        test_int(count, 1);
+        test_uint(it.entities[offset], e3);
+        offset += count;
+        test_bool(false, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        ecs_iter_clear_changed_rows(&it, 0);
+        test_bool(false, ecs_query_next(&it));
+    }
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void ChangeDetection_changed_rows_after_query_write(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+    ecs_add_id(world, ecs_id(Position), EcsDirtyRows);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {1, 2}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {3, 4}));
+    ecs_add(world, e2, Foo);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "[in] Position",
+        .cache_kind = EcsQueryCacheAuto,
+        .flags = EcsQueryDetectChanges
+    });
+    test_assert(q != NULL);
+
+    ecs_query_t *q_write = ecs_query(world, {
+        .expr = "[out] Position, Foo",
+        .cache_kind = EcsQueryCacheAuto
+    });
+    test_assert(q_write != NULL);
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        while (ecs_query_next(&it)) {
+            ecs_iter_clear_changed_rows(&it, 0);
+        }
+    }
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q_write);
+        while (ecs_query_next(&it)) { }
+    }
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        test_bool(true, ecs_query_next(&it));
+        test_uint(it.entities[0], e1);
+        int32_t offset = 0, count = 0;
+        test_bool(false, ecs_iter_changed_rows(&it, 0, &offset, &count));
+
+        test_bool(true, ecs_query_next(&it));
+        test_uint(it.entities[0], e2);
+        offset = 0;
+        test_bool(true, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        test_int(offset, 0);
+        test_int(count, 1);
+        test_bool(false, ecs_query_next(&it));
+    }
+
+    ecs_query_fini(q);
+    ecs_query_fini(q_write);
+
+    ecs_fini(world);
+}
+
+void ChangeDetection_changed_rows_after_delete(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ecs_add_id(world, ecs_id(Position), EcsDirtyRows);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {1, 2}));
+    ecs_insert(world, ecs_value(Position, {3, 4}));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Position, {5, 6}));
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "[in] Position",
+        .cache_kind = EcsQueryCacheAuto,
+        .flags = EcsQueryDetectChanges
+    });
+    test_assert(q != NULL);
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        while (ecs_query_next(&it)) {
+            ecs_iter_clear_changed_rows(&it, 0);
+        }
+    }
+
+    ecs_delete(world, e1);
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        test_bool(true, ecs_query_next(&it));
+        test_int(it.count, 2);
+        int32_t offset = 0, count = 0;
+        test_bool(true, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        test_int(offset, 0);
+        test_int(count, 1);
+        test_uint(it.entities[offset], e3);
+        offset += count;
+        test_bool(false, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        test_bool(false, ecs_query_next(&it));
+    }
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void ChangeDetection_changed_rows_after_new(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ecs_add_id(world, ecs_id(Position), EcsDirtyRows);
+
+    ecs_insert(world, ecs_value(Position, {1, 2}));
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "[in] Position",
+        .cache_kind = EcsQueryCacheAuto,
+        .flags = EcsQueryDetectChanges
+    });
+    test_assert(q != NULL);
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        while (ecs_query_next(&it)) {
+            ecs_iter_clear_changed_rows(&it, 0);
+        }
+    }
+
+    ecs_entity_t e2 = ecs_new_w(world, Position);
+    ecs_entity_t e3 = ecs_new_w(world, Position);
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        test_bool(true, ecs_query_next(&it));
+        test_int(it.count, 3);
+        int32_t offset = 0, count = 0;
+        test_bool(true, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        test_int(offset, 1);
+        test_int(count, 2);
+        test_uint(it.entities[1], e2);
+        test_uint(it.entities[2], e3);
+        test_bool(false, ecs_query_next(&it));
+    }
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void ChangeDetection_changed_rows_many(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ecs_add_id(world, ecs_id(Position), EcsDirtyRows);
+
+    ecs_entity_t entities[200];
+    for (int i = 0; i < 200; i ++) {
+        entities[i] = ecs_insert(world, ecs_value(Position, {i, i}));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "[in] Position",
+        .cache_kind = EcsQueryCacheAuto,
+        .flags = EcsQueryDetectChanges
+    });
+    test_assert(q != NULL);
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        while (ecs_query_next(&it)) {
+            ecs_iter_clear_changed_rows(&it, 0);
+        }
+    }
+
+    for (int i = 60; i < 70; i ++) {
+        ecs_modified(world, entities[i], Position);
+    }
+    ecs_modified(world, entities[150], Position);
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        test_bool(true, ecs_query_next(&it));
+        test_int(it.count, 200);
+        int32_t offset = 0, count = 0;
+        test_bool(true, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        test_int(offset, 60);
+        test_int(count, 10);
+        offset += count;
+        test_bool(true, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        test_int(offset, 150);
+        test_int(count, 1);
+        offset += count;
+        test_bool(false, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        test_bool(false, ecs_query_next(&it));
+    }
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void ChangeDetection_changed_rows_no_trait(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_insert(world, ecs_value(Position, {1, 2}));
+    ecs_insert(world, ecs_value(Position, {3, 4}));
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "[in] Position",
+        .cache_kind = EcsQueryCacheAuto,
+        .flags = EcsQueryDetectChanges
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    ecs_iter_clear_changed_rows(&it, 0);
+    int32_t offset = 0, count = 0;
+    test_bool(true, ecs_iter_changed_rows(&it, 0, &offset, &count));
+    test_int(offset, 0);
+    test_int(count, 2);
+    offset += count;
+    test_bool(false, ecs_iter_changed_rows(&it, 0, &offset, &count));
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void ChangeDetection_changed_rows_shared(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+    ecs_add_pair(world, ecs_id(Position), EcsOnInstantiate, EcsInherit);
+    ecs_add_id(world, ecs_id(Position), EcsDirtyRows);
+
+    ecs_entity_t base = ecs_insert(world, ecs_value(Position, {1, 2}));
+    ecs_entity_t e1 = ecs_new_w_pair(world, EcsIsA, base);
+    ecs_entity_t e2 = ecs_new_w_pair(world, EcsIsA, base);
+    ecs_add(world, e1, Foo);
+    ecs_add(world, e2, Foo);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "[in] Position(self|up IsA), Foo",
+        .cache_kind = EcsQueryCacheAuto,
+        .flags = EcsQueryDetectChanges
+    });
+    test_assert(q != NULL);
+
+    ecs_table_t *base_table = ecs_get_table(world, base);
+    {
+        /* Clear the row of the base entity */
+        ecs_query_t *qb = ecs_query(world, { .expr = "[in] Position" });
+        ecs_iter_t it = ecs_query_iter(world, qb);
+        while (ecs_query_next(&it)) {
+            if (it.table == base_table) {
+                ecs_iter_clear_changed_rows(&it, 0);
+            }
+        }
+        ecs_query_fini(qb);
+    }
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        test_bool(true, ecs_query_next(&it));
+        test_int(it.count, 2);
+        test_uint(it.sources[0], base);
+        int32_t offset = 0, count = 0;
+        test_bool(false, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        test_bool(false, ecs_query_next(&it));
+    }
+
+    ecs_modified(world, base, Position);
+
+    {
+        ecs_iter_t it = ecs_query_iter(world, q);
+        test_bool(true, ecs_query_next(&it));
+        int32_t offset = 0, count = 0;
+        test_bool(true, ecs_iter_changed_rows(&it, 0, &offset, &count));
+        test_int(offset, 0);
+        test_int(count, 2);
+        test_bool(false, ecs_query_next(&it));
+    }
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
@@ -244,30 +244,24 @@ void DontFragment_1_this_sparse(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e3, it.entities[0]);
+    test_int(3, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
+    test_uint(e3, it.entities[2]);
     {
         Position *p = ecs_field_at(&it, Position, 0, 0);
         test_assert(p != NULL);
-        test_int(p->x, 50); test_int(p->y, 60);
+        test_int(p->x, 10); test_int(p->y, 20);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e2, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 0, 0);
+        Position *p = ecs_field_at(&it, Position, 0, 1);
         test_assert(p != NULL);
         test_int(p->x, 30); test_int(p->y, 40);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e1, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 0, 0);
+        Position *p = ecs_field_at(&it, Position, 0, 2);
         test_assert(p != NULL);
-        test_int(p->x, 10); test_int(p->y, 20);
+        test_int(p->x, 50); test_int(p->y, 60);
     }
 
     test_bool(false, ecs_query_next(&it));
@@ -298,30 +292,24 @@ void DontFragment_1_this_sparse_simple(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e3, it.entities[0]);
+    test_int(3, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
+    test_uint(e3, it.entities[2]);
     {
         Position *p = ecs_field_at(&it, Position, 0, 0);
         test_assert(p != NULL);
-        test_int(p->x, 50); test_int(p->y, 60);
+        test_int(p->x, 10); test_int(p->y, 20);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e2, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 0, 0);
+        Position *p = ecs_field_at(&it, Position, 0, 1);
         test_assert(p != NULL);
         test_int(p->x, 30); test_int(p->y, 40);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e1, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 0, 0);
+        Position *p = ecs_field_at(&it, Position, 0, 2);
         test_assert(p != NULL);
-        test_int(p->x, 10); test_int(p->y, 20);
+        test_int(p->x, 50); test_int(p->y, 60);
     }
 
     test_bool(false, ecs_query_next(&it));
@@ -352,16 +340,10 @@ void DontFragment_1_this_sparse_none(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e3, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e2, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(3, it.count);
     test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
+    test_uint(e3, it.entities[2]);
 
     test_bool(false, ecs_query_next(&it));
 
@@ -393,28 +375,22 @@ void DontFragment_1_this_sparse_written(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(3, it.count);
     test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
+    test_uint(e3, it.entities[2]);
     {
         Position *p = ecs_field_at(&it, Position, 1, 0);
         test_assert(p != NULL);
         test_int(p->x, 10); test_int(p->y, 20);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e2, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 1, 0);
+        Position *p = ecs_field_at(&it, Position, 1, 1);
         test_assert(p != NULL);
         test_int(p->x, 30); test_int(p->y, 40);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e3, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 1, 0);
+        Position *p = ecs_field_at(&it, Position, 1, 2);
         test_assert(p != NULL);
         test_int(p->x, 50); test_int(p->y, 60);
     }
@@ -449,19 +425,16 @@ void DontFragment_1_this_sparse_written_partial(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
     {
         Position *p = ecs_field_at(&it, Position, 1, 0);
         test_assert(p != NULL);
         test_int(p->x, 10); test_int(p->y, 20);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e2, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 1, 0);
+        Position *p = ecs_field_at(&it, Position, 1, 1);
         test_assert(p != NULL);
         test_int(p->x, 30); test_int(p->y, 40);
     }
@@ -496,16 +469,10 @@ void DontFragment_1_this_sparse_written_none(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(3, it.count);
     test_uint(e1, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e2, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e3, it.entities[0]);
+    test_uint(e2, it.entities[1]);
+    test_uint(e3, it.entities[2]);
 
     test_bool(false, ecs_query_next(&it));
 
@@ -539,11 +506,11 @@ void DontFragment_1_var_sparse(void) {
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
-    test_uint(e3, ecs_iter_get_var(&it, x_var));
+    test_uint(e1, ecs_iter_get_var(&it, x_var));
     {
         Position *p = ecs_field_at(&it, Position, 0, 0);
         test_assert(p != NULL);
-        test_int(p->x, 50); test_int(p->y, 60);
+        test_int(p->x, 10); test_int(p->y, 20);
     }
 
     test_bool(true, ecs_query_next(&it));
@@ -557,11 +524,11 @@ void DontFragment_1_var_sparse(void) {
 
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
-    test_uint(e1, ecs_iter_get_var(&it, x_var));
+    test_uint(e3, ecs_iter_get_var(&it, x_var));
     {
         Position *p = ecs_field_at(&it, Position, 0, 0);
         test_assert(p != NULL);
-        test_int(p->x, 10); test_int(p->y, 20);
+        test_int(p->x, 50); test_int(p->y, 60);
     }
 
     test_bool(false, ecs_query_next(&it));
@@ -596,7 +563,7 @@ void DontFragment_1_var_sparse_none(void) {
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
-    test_uint(e3, ecs_iter_get_var(&it, x_var));
+    test_uint(e1, ecs_iter_get_var(&it, x_var));
 
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
@@ -604,7 +571,7 @@ void DontFragment_1_var_sparse_none(void) {
 
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
-    test_uint(e1, ecs_iter_get_var(&it, x_var));
+    test_uint(e3, ecs_iter_get_var(&it, x_var));
 
     test_bool(false, ecs_query_next(&it));
 
@@ -746,45 +713,39 @@ void DontFragment_2_sparse_simple(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e3, it.entities[0]);
+    test_int(3, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
+    test_uint(e3, it.entities[2]);
     {
         Position *p = ecs_field_at(&it, Position, 0, 0);
         test_assert(p != NULL);
-        test_int(p->x, 50); test_int(p->y, 60);
+        test_int(p->x, 10); test_int(p->y, 20);
     }
     {
         Velocity *v = ecs_field_at(&it, Velocity, 1, 0);
         test_assert(v != NULL);
-        test_int(v->x, 5); test_int(v->y, 6);
+        test_int(v->x, 1); test_int(v->y, 2);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e2, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 0, 0);
+        Position *p = ecs_field_at(&it, Position, 0, 1);
         test_assert(p != NULL);
         test_int(p->x, 30); test_int(p->y, 40);
     }
     {
-        Velocity *v = ecs_field_at(&it, Velocity, 1, 0);
+        Velocity *v = ecs_field_at(&it, Velocity, 1, 1);
         test_assert(v != NULL);
         test_int(v->x, 3); test_int(v->y, 4);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e1, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 0, 0);
+        Position *p = ecs_field_at(&it, Position, 0, 2);
         test_assert(p != NULL);
-        test_int(p->x, 10); test_int(p->y, 20);
+        test_int(p->x, 50); test_int(p->y, 60);
     }
     {
-        Velocity *v = ecs_field_at(&it, Velocity, 1, 0);
+        Velocity *v = ecs_field_at(&it, Velocity, 1, 2);
         test_assert(v != NULL);
-        test_int(v->x, 1); test_int(v->y, 2);
+        test_int(v->x, 5); test_int(v->y, 6);
     }
 
     test_bool(false, ecs_query_next(&it));
@@ -824,45 +785,39 @@ void DontFragment_2_sparse(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e3, it.entities[0]);
+    test_int(3, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
+    test_uint(e3, it.entities[2]);
     {
         Position *p = ecs_field_at(&it, Position, 0, 0);
         test_assert(p != NULL);
-        test_int(p->x, 50); test_int(p->y, 60);
+        test_int(p->x, 10); test_int(p->y, 20);
     }
     {
         Velocity *v = ecs_field_at(&it, Velocity, 1, 0);
         test_assert(v != NULL);
-        test_int(v->x, 5); test_int(v->y, 6);
+        test_int(v->x, 1); test_int(v->y, 2);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e2, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 0, 0);
+        Position *p = ecs_field_at(&it, Position, 0, 1);
         test_assert(p != NULL);
         test_int(p->x, 30); test_int(p->y, 40);
     }
     {
-        Velocity *v = ecs_field_at(&it, Velocity, 1, 0);
+        Velocity *v = ecs_field_at(&it, Velocity, 1, 1);
         test_assert(v != NULL);
         test_int(v->x, 3); test_int(v->y, 4);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e1, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 0, 0);
+        Position *p = ecs_field_at(&it, Position, 0, 2);
         test_assert(p != NULL);
-        test_int(p->x, 10); test_int(p->y, 20);
+        test_int(p->x, 50); test_int(p->y, 60);
     }
     {
-        Velocity *v = ecs_field_at(&it, Velocity, 1, 0);
+        Velocity *v = ecs_field_at(&it, Velocity, 1, 2);
         test_assert(v != NULL);
-        test_int(v->x, 1); test_int(v->y, 2);
+        test_int(v->x, 5); test_int(v->y, 6);
     }
 
     test_bool(false, ecs_query_next(&it));
@@ -899,96 +854,33 @@ void DontFragment_2_sparse_and_regular(void) {
         ecs_value(Position, {50, 60}),
         ecs_value(Velocity, {5,  6}));
 
-    
-
     ecs_iter_t it = ecs_query_iter(world, q);
-
-    if (cache_kind == EcsQueryCacheDefault) {
-        test_bool(true, ecs_query_next(&it));
-        test_int(1, it.count);
-        test_uint(e3, it.entities[0]);
-        {
-            Position *p = ecs_field_at(&it, Position, 0, 0);
-            test_assert(p != NULL);
-            test_int(p->x, 50); test_int(p->y, 60);
-        }
-        {
-            Velocity *v = ecs_field(&it, Velocity, 1);
-            test_assert(v != NULL);
-            test_int(v->x, 5); test_int(v->y, 6);
-        }
-
-        test_bool(true, ecs_query_next(&it));
-        test_int(1, it.count);
-        test_uint(e2, it.entities[0]);
-        {
-            Position *p = ecs_field_at(&it, Position, 0, 0);
-            test_assert(p != NULL);
-            test_int(p->x, 30); test_int(p->y, 40);
-        }
-        {
-            Velocity *v = ecs_field(&it, Velocity, 1);
-            test_assert(v != NULL);
-            test_int(v->x, 3); test_int(v->y, 4);
-        }
-
-        test_bool(true, ecs_query_next(&it));
-        test_int(1, it.count);
-        test_uint(e1, it.entities[0]);
-        {
-            Position *p = ecs_field_at(&it, Position, 0, 0);
-            test_assert(p != NULL);
-            test_int(p->x, 10); test_int(p->y, 20);
-        }
-        {
-            Velocity *v = ecs_field(&it, Velocity, 1);
-            test_assert(v != NULL);
-            test_int(v->x, 1); test_int(v->y, 2);
-        }
-    } else {
-        // Different ordering, same results
-
-        test_bool(true, ecs_query_next(&it));
-        test_int(1, it.count);
-        test_uint(e1, it.entities[0]);
-        {
-            Position *p = ecs_field_at(&it, Position, 0, 0);
-            test_assert(p != NULL);
-            test_int(p->x, 10); test_int(p->y, 20);
-        }
-        {
-            Velocity *v = ecs_field(&it, Velocity, 1);
-            test_assert(v != NULL);
-            test_int(v->x, 1); test_int(v->y, 2);
-        }
-
-        test_bool(true, ecs_query_next(&it));
-        test_int(1, it.count);
-        test_uint(e2, it.entities[0]);
-        {
-            Position *p = ecs_field_at(&it, Position, 0, 0);
-            test_assert(p != NULL);
-            test_int(p->x, 30); test_int(p->y, 40);
-        }
-        {
-            Velocity *v = ecs_field(&it, Velocity, 1);
-            test_assert(v != NULL);
-            test_int(v->x, 3); test_int(v->y, 4);
-        }
-
-        test_bool(true, ecs_query_next(&it));
-        test_int(1, it.count);
-        test_uint(e3, it.entities[0]);
-        {
-            Position *p = ecs_field_at(&it, Position, 0, 0);
-            test_assert(p != NULL);
-            test_int(p->x, 50); test_int(p->y, 60);
-        }
-        {
-            Velocity *v = ecs_field(&it, Velocity, 1);
-            test_assert(v != NULL);
-            test_int(v->x, 5); test_int(v->y, 6);
-        }
+    test_bool(true, ecs_query_next(&it));
+    test_int(3, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
+    test_uint(e3, it.entities[2]);
+    {
+        Position *p = ecs_field_at(&it, Position, 0, 0);
+        test_assert(p != NULL);
+        test_int(p->x, 10); test_int(p->y, 20);
+    }
+    {
+        Position *p = ecs_field_at(&it, Position, 0, 1);
+        test_assert(p != NULL);
+        test_int(p->x, 30); test_int(p->y, 40);
+    }
+    {
+        Position *p = ecs_field_at(&it, Position, 0, 2);
+        test_assert(p != NULL);
+        test_int(p->x, 50); test_int(p->y, 60);
+    }
+    {
+        Velocity *v = ecs_field(&it, Velocity, 1);
+        test_assert(v != NULL);
+        test_int(v[0].x, 1); test_int(v[0].y, 2);
+        test_int(v[1].x, 3); test_int(v[1].y, 4);
+        test_int(v[2].x, 5); test_int(v[2].y, 6);
     }
 
     test_bool(false, ecs_query_next(&it));
@@ -1027,43 +919,29 @@ void DontFragment_2_regular_and_sparse(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(3, it.count);
     test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
+    test_uint(e3, it.entities[2]);
     {
         Position *p = ecs_field(&it, Position, 0);
         test_assert(p != NULL);
         test_int(p[0].x, 10); test_int(p[0].y, 20);
+        test_int(p[1].x, 30); test_int(p[1].y, 40);
+        test_int(p[2].x, 50); test_int(p[2].y, 60);
     }
     {
         Velocity *v = ecs_field_at(&it, Velocity, 1, 0);
         test_assert(v != NULL);
         test_int(v->x, 1); test_int(v->y, 2);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e2, it.entities[0]);
     {
-        Position *p = ecs_field(&it, Position, 0);
-        test_assert(p != NULL);
-        test_int(p[0].x, 30); test_int(p[0].y, 40);
-    }
-    {
-        Velocity *v = ecs_field_at(&it, Velocity, 1, 0);
+        Velocity *v = ecs_field_at(&it, Velocity, 1, 1);
         test_assert(v != NULL);
         test_int(v->x, 3); test_int(v->y, 4);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e3, it.entities[0]);
     {
-        Position *p = ecs_field(&it, Position, 0);
-        test_assert(p != NULL);
-        test_int(p[0].x, 50); test_int(p[0].y, 60);
-    }
-    {
-        Velocity *v = ecs_field_at(&it, Velocity, 1, 0);
+        Velocity *v = ecs_field_at(&it, Velocity, 1, 2);
         test_assert(v != NULL);
         test_int(v->x, 5); test_int(v->y, 6);
     }
@@ -1099,21 +977,18 @@ void DontFragment_1_sparse_self(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e2, it.entities[0]);
+    test_int(2, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
     {
         Position *p = ecs_field_at(&it, Position, 0, 0);
         test_assert(p != NULL);
-        test_int(p->x, 30); test_int(p->y, 40);
+        test_int(p->x, 10); test_int(p->y, 20);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e1, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 0, 0);
+        Position *p = ecs_field_at(&it, Position, 0, 1);
         test_assert(p != NULL);
-        test_int(p->x, 10); test_int(p->y, 20);
+        test_int(p->x, 30); test_int(p->y, 40);
     }
 
     test_bool(false, ecs_query_next(&it));
@@ -1206,30 +1081,26 @@ void DontFragment_1_sparse_self_up(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e2, it.entities[0]);
+    test_int(2, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
     test_uint(ecs_id(Position), ecs_field_id(&it, 0));
     test_uint(0, ecs_field_src(&it, 0));
     {
         Position *p = ecs_field_at(&it, Position, 0, 0);
         test_assert(p != NULL);
-        test_int(p->x, 30); test_int(p->y, 40);
+        test_int(p->x, 10); test_int(p->y, 20);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e1, it.entities[0]);
-    test_uint(ecs_id(Position), ecs_field_id(&it, 0));
-    test_uint(0, ecs_field_src(&it, 0));
     {
-        Position *p = ecs_field_at(&it, Position, 0, 0);
+        Position *p = ecs_field_at(&it, Position, 0, 1);
         test_assert(p != NULL);
-        test_int(p->x, 10); test_int(p->y, 20);
+        test_int(p->x, 30); test_int(p->y, 40);
     }
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(e3, it.entities[0]);
+    test_uint(e4, it.entities[1]);
     test_uint(ecs_id(Position), ecs_field_id(&it, 0));
     test_uint(base, ecs_field_src(&it, 0));
     {
@@ -1237,14 +1108,8 @@ void DontFragment_1_sparse_self_up(void) {
         test_assert(p != NULL);
         test_int(p->x, 1); test_int(p->y, 2);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e4, it.entities[0]);
-    test_uint(ecs_id(Position), ecs_field_id(&it, 0));
-    test_uint(base, ecs_field_src(&it, 0));
     {
-        Position *p = ecs_field_at(&it, Position, 0, 0);
+        Position *p = ecs_field_at(&it, Position, 0, 1);
         test_assert(p != NULL);
         test_int(p->x, 1); test_int(p->y, 2);
     }
@@ -1282,18 +1147,16 @@ void DontFragment_1_sparse_written_self(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
     {
         Position *p = ecs_field_at(&it, Position, 1, 0);
         test_assert(p != NULL);
         test_int(p->x, 10); test_int(p->y, 20);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_uint(e2, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 1, 0);
+        Position *p = ecs_field_at(&it, Position, 1, 1);
         test_assert(p != NULL);
         test_int(p->x, 30); test_int(p->y, 40);
     }
@@ -1382,35 +1245,31 @@ void DontFragment_1_sparse_written_self_up(void) {
     ecs_iter_t it = ecs_query_iter(world, q);
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
     {
         Position *p = ecs_field_at(&it, Position, 1, 0);
         test_assert(p != NULL);
         test_int(p->x, 10); test_int(p->y, 20);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_uint(e2, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 1, 0);
+        Position *p = ecs_field_at(&it, Position, 1, 1);
         test_assert(p != NULL);
         test_int(p->x, 30); test_int(p->y, 40);
     }
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(e3, it.entities[0]);
+    test_uint(e4, it.entities[1]);
     {
         Position *p = ecs_field_at(&it, Position, 1, 0);
         test_assert(p != NULL);
         test_int(p->x, 1); test_int(p->y, 2);
     }
-
-    test_bool(true, ecs_query_next(&it));
-    test_uint(e4, it.entities[0]);
     {
-        Position *p = ecs_field_at(&it, Position, 1, 0);
+        Position *p = ecs_field_at(&it, Position, 1, 1);
         test_assert(p != NULL);
         test_int(p->x, 1); test_int(p->y, 2);
     }
@@ -1563,14 +1422,9 @@ void DontFragment_1_this_sparse_written_not(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e2, it.entities[0]);
-    test_bool(true, ecs_field_is_set(&it, 0));
-    test_bool(false, ecs_field_is_set(&it, 1));
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e3, it.entities[0]);
+    test_int(2, it.count);
+    test_uint(e2, it.entities[0]);
+    test_uint(e3, it.entities[1]);
     test_bool(true, ecs_field_is_set(&it, 0));
     test_bool(false, ecs_field_is_set(&it, 1));
 
@@ -2289,28 +2143,18 @@ void DontFragment_1_this_sparse_second_wildcard(void) {
     test_uint(e3, it.entities[0]);
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(ecs_pair(Rel, TgtB), ecs_field_id(&it, 0));
-    test_uint(0, ecs_field_src(&it, 0));
-    test_uint(e3, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(ecs_pair(Rel, TgtB), ecs_field_id(&it, 0));
     test_uint(0, ecs_field_src(&it, 0));
     test_uint(e2, it.entities[0]);
+    test_uint(e3, it.entities[1]);
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 0));
-    test_uint(0, ecs_field_src(&it, 0));
-    test_uint(e2, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 0));
     test_uint(0, ecs_field_src(&it, 0));
     test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
 
     test_bool(false, ecs_query_next(&it));
 
@@ -2358,26 +2202,26 @@ void DontFragment_1_var_sparse_second_wildcard(void) {
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
     test_uint(ecs_pair(Rel, TgtB), ecs_field_id(&it, 0));
-    test_uint(e3, ecs_field_src(&it, 0));
-    test_uint(e3, ecs_iter_get_var(&it, x_var));
+    test_uint(e2, ecs_field_src(&it, 0));
+    test_uint(e2, ecs_iter_get_var(&it, x_var));
 
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
     test_uint(ecs_pair(Rel, TgtB), ecs_field_id(&it, 0));
-    test_uint(e2, ecs_field_src(&it, 0));
-    test_uint(e2, ecs_iter_get_var(&it, x_var));
+    test_uint(e3, ecs_field_src(&it, 0));
+    test_uint(e3, ecs_iter_get_var(&it, x_var));
 
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
     test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 0));
-    test_uint(e2, ecs_field_src(&it, 0));
-    test_uint(e2, ecs_iter_get_var(&it, x_var));
+    test_uint(e1, ecs_field_src(&it, 0));
+    test_uint(e1, ecs_iter_get_var(&it, x_var));
 
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
     test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 0));
-    test_uint(e1, ecs_field_src(&it, 0));
-    test_uint(e1, ecs_iter_get_var(&it, x_var));
+    test_uint(e2, ecs_field_src(&it, 0));
+    test_uint(e2, ecs_iter_get_var(&it, x_var));
 
     test_bool(false, ecs_query_next(&it));
 
@@ -2424,36 +2268,22 @@ void DontFragment_1_this_sparse_written_second_wildcard(void) {
     test_uint(e3, it.entities[0]);
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(Foo, ecs_field_id(&it, 0));
     test_uint(ecs_pair(Rel, TgtB), ecs_field_id(&it, 1));
     test_uint(0, ecs_field_src(&it, 0));
     test_uint(0, ecs_field_src(&it, 1));
     test_uint(e2, it.entities[0]);
+    test_uint(e3, it.entities[1]);
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(Foo, ecs_field_id(&it, 0));
-    test_uint(ecs_pair(Rel, TgtB), ecs_field_id(&it, 1));
-    test_uint(0, ecs_field_src(&it, 0));
-    test_uint(0, ecs_field_src(&it, 1));
-    test_uint(e3, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(Foo, ecs_field_id(&it, 0));
     test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 1));
     test_uint(0, ecs_field_src(&it, 0));
     test_uint(0, ecs_field_src(&it, 1));
     test_uint(e1, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(Foo, ecs_field_id(&it, 0));
-    test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 1));
-    test_uint(0, ecs_field_src(&it, 0));
-    test_uint(0, ecs_field_src(&it, 1));
-    test_uint(e2, it.entities[0]);
+    test_uint(e2, it.entities[1]);
 
     test_bool(false, ecs_query_next(&it));
 
@@ -2671,28 +2501,18 @@ void DontFragment_1_this_sparse_first_wildcard(void) {
     test_uint(e3, it.entities[0]);
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(ecs_pair(RelB, Tgt), ecs_field_id(&it, 0));
-    test_uint(0, ecs_field_src(&it, 0));
-    test_uint(e3, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(ecs_pair(RelB, Tgt), ecs_field_id(&it, 0));
     test_uint(0, ecs_field_src(&it, 0));
     test_uint(e2, it.entities[0]);
+    test_uint(e3, it.entities[1]);
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(ecs_pair(RelA, Tgt), ecs_field_id(&it, 0));
-    test_uint(0, ecs_field_src(&it, 0));
-    test_uint(e2, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(ecs_pair(RelA, Tgt), ecs_field_id(&it, 0));
     test_uint(0, ecs_field_src(&it, 0));
     test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
 
     test_bool(false, ecs_query_next(&it));
 
@@ -2744,26 +2564,26 @@ void DontFragment_1_var_sparse_first_wildcard(void) {
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
     test_uint(ecs_pair(RelB, Tgt), ecs_field_id(&it, 0));
-    test_uint(e3, ecs_field_src(&it, 0));
-    test_uint(e3, ecs_iter_get_var(&it, x_var));
+    test_uint(e2, ecs_field_src(&it, 0));
+    test_uint(e2, ecs_iter_get_var(&it, x_var));
 
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
     test_uint(ecs_pair(RelB, Tgt), ecs_field_id(&it, 0));
-    test_uint(e2, ecs_field_src(&it, 0));
-    test_uint(e2, ecs_iter_get_var(&it, x_var));
+    test_uint(e3, ecs_field_src(&it, 0));
+    test_uint(e3, ecs_iter_get_var(&it, x_var));
 
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
     test_uint(ecs_pair(RelA, Tgt), ecs_field_id(&it, 0));
-    test_uint(e2, ecs_field_src(&it, 0));
-    test_uint(e2, ecs_iter_get_var(&it, x_var));
+    test_uint(e1, ecs_field_src(&it, 0));
+    test_uint(e1, ecs_iter_get_var(&it, x_var));
 
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
     test_uint(ecs_pair(RelA, Tgt), ecs_field_id(&it, 0));
-    test_uint(e1, ecs_field_src(&it, 0));
-    test_uint(e1, ecs_iter_get_var(&it, x_var));
+    test_uint(e2, ecs_field_src(&it, 0));
+    test_uint(e2, ecs_iter_get_var(&it, x_var));
 
     test_bool(false, ecs_query_next(&it));
 
@@ -2812,36 +2632,22 @@ void DontFragment_1_this_sparse_written_first_wildcard(void) {
     test_uint(e3, it.entities[0]);
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(Foo, ecs_field_id(&it, 0));
     test_uint(ecs_pair(RelB, Tgt), ecs_field_id(&it, 1));
     test_uint(0, ecs_field_src(&it, 0));
     test_uint(0, ecs_field_src(&it, 1));
     test_uint(e2, it.entities[0]);
+    test_uint(e3, it.entities[1]);
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(Foo, ecs_field_id(&it, 0));
-    test_uint(ecs_pair(RelB, Tgt), ecs_field_id(&it, 1));
-    test_uint(0, ecs_field_src(&it, 0));
-    test_uint(0, ecs_field_src(&it, 1));
-    test_uint(e3, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(Foo, ecs_field_id(&it, 0));
     test_uint(ecs_pair(RelA, Tgt), ecs_field_id(&it, 1));
     test_uint(0, ecs_field_src(&it, 0));
     test_uint(0, ecs_field_src(&it, 1));
     test_uint(e1, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(Foo, ecs_field_id(&it, 0));
-    test_uint(ecs_pair(RelA, Tgt), ecs_field_id(&it, 1));
-    test_uint(0, ecs_field_src(&it, 0));
-    test_uint(0, ecs_field_src(&it, 1));
-    test_uint(e2, it.entities[0]);
+    test_uint(e2, it.entities[1]);
 
     test_bool(false, ecs_query_next(&it));
 
@@ -3024,36 +2830,22 @@ void DontFragment_1_this_sparse_first_wildcard_simple(void) {
     test_uint(e3, it.entities[0]);
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(Foo, ecs_field_id(&it, 0));
     test_uint(ecs_pair(RelB, Tgt), ecs_field_id(&it, 1));
     test_uint(0, ecs_field_src(&it, 0));
     test_uint(0, ecs_field_src(&it, 1));
     test_uint(e2, it.entities[0]);
+    test_uint(e3, it.entities[1]);
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(Foo, ecs_field_id(&it, 0));
-    test_uint(ecs_pair(RelB, Tgt), ecs_field_id(&it, 1));
-    test_uint(0, ecs_field_src(&it, 0));
-    test_uint(0, ecs_field_src(&it, 1));
-    test_uint(e3, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(Foo, ecs_field_id(&it, 0));
     test_uint(ecs_pair(RelA, Tgt), ecs_field_id(&it, 1));
     test_uint(0, ecs_field_src(&it, 0));
     test_uint(0, ecs_field_src(&it, 1));
     test_uint(e1, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(Foo, ecs_field_id(&it, 0));
-    test_uint(ecs_pair(RelA, Tgt), ecs_field_id(&it, 1));
-    test_uint(0, ecs_field_src(&it, 0));
-    test_uint(0, ecs_field_src(&it, 1));
-    test_uint(e2, it.entities[0]);
+    test_uint(e2, it.entities[1]);
 
     test_bool(false, ecs_query_next(&it));
 
@@ -3312,16 +3104,11 @@ void DontFragment_1_this_exclusive(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 0));
-    test_uint(0, ecs_field_src(&it, 0));
-    test_uint(e2, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 0));
     test_uint(0, ecs_field_src(&it, 0));
     test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
 
     test_bool(false, ecs_query_next(&it));
 
@@ -3367,16 +3154,11 @@ void DontFragment_1_this_exclusive_second_wildcard(void) {
     test_uint(e3, it.entities[0]);
 
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 0));
-    test_uint(0, ecs_field_src(&it, 0));
-    test_uint(e2, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 0));
     test_uint(0, ecs_field_src(&it, 0));
     test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
 
     test_bool(false, ecs_query_next(&it));
 
@@ -3415,14 +3197,14 @@ void DontFragment_1_var_exclusive(void) {
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
     test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 0));
-    test_uint(e2, ecs_field_src(&it, 0));
-    test_uint(e2, ecs_iter_get_var(&it, x_var));
+    test_uint(e1, ecs_field_src(&it, 0));
+    test_uint(e1, ecs_iter_get_var(&it, x_var));
 
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
     test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 0));
-    test_uint(e1, ecs_field_src(&it, 0));
-    test_uint(e1, ecs_iter_get_var(&it, x_var));
+    test_uint(e2, ecs_field_src(&it, 0));
+    test_uint(e2, ecs_iter_get_var(&it, x_var));
 
     test_bool(false, ecs_query_next(&it));
 
@@ -3473,14 +3255,14 @@ void DontFragment_1_var_exclusive_second_wildcard(void) {
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
     test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 0));
-    test_uint(e2, ecs_field_src(&it, 0));
-    test_uint(e2, ecs_iter_get_var(&it, x_var));
+    test_uint(e1, ecs_field_src(&it, 0));
+    test_uint(e1, ecs_iter_get_var(&it, x_var));
 
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
     test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 0));
-    test_uint(e1, ecs_field_src(&it, 0));
-    test_uint(e1, ecs_iter_get_var(&it, x_var));
+    test_uint(e2, ecs_field_src(&it, 0));
+    test_uint(e2, ecs_iter_get_var(&it, x_var));
 
     test_bool(false, ecs_query_next(&it));
 
@@ -3522,20 +3304,13 @@ void DontFragment_1_this_written_exclusive(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
+    test_int(2, it.count);
     test_uint(Foo, ecs_field_id(&it, 0));
     test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 1));
     test_uint(0, ecs_field_src(&it, 0));
     test_uint(0, ecs_field_src(&it, 1));
     test_uint(e1, it.entities[0]);
-
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(Foo, ecs_field_id(&it, 0));
-    test_uint(ecs_pair(Rel, TgtA), ecs_field_id(&it, 1));
-    test_uint(0, ecs_field_src(&it, 0));
-    test_uint(0, ecs_field_src(&it, 1));
-    test_uint(e2, it.entities[0]);
+    test_uint(e2, it.entities[1]);
 
     test_bool(false, ecs_query_next(&it));
 
@@ -3774,14 +3549,12 @@ void DontFragment_this_wildcard_wildcard_pair(void) {
     while (ecs_query_next(&it)) {
         for (int i = 0; i < it.count; i ++) {
             if (it.entities[i] == e1) {
-                test_int(1, it.count);
                 test_uint(0, ecs_field_src(&it, 0));
                 e1_found ++;
             }
 
             if (it.entities[i] == e2) {
                 test_assert(!e2_found);
-                test_int(1, it.count);
                 test_uint(0, ecs_field_src(&it, 0));
                 test_uint(ecs_pair(RelY, TgtB), ecs_field_id(&it, 0));
                 e2_found = true;
@@ -3789,7 +3562,6 @@ void DontFragment_this_wildcard_wildcard_pair(void) {
 
             if (it.entities[i] == e3) {
                 test_assert(!e3_found);
-                test_int(1, it.count);
                 test_uint(0, ecs_field_src(&it, 0));
                 test_uint(ecs_pair(RelY, TgtA), ecs_field_id(&it, 0));
                 e3_found = true;
@@ -4444,3 +4216,111 @@ void DontFragment_add_to_self_while_iterate(void) {
 
     ecs_fini(world);
 }
+
+void DontFragment_1_this_sparse_written_dense(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    ecs_add_id(world, ecs_id(Position), EcsDontFragment);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Foo, Position",
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_entity_t e[100];
+    for (int i = 0; i < 100; i ++) {
+        e[i] = ecs_new_w(world, Foo);
+    }
+
+    /* Sparse set is much smaller than table, entities are found by iterating
+     * the sparse set in the order in which the component was added. */
+    ecs_set(world, e[50], Position, {50, 51});
+    ecs_set(world, e[10], Position, {10, 11});
+    ecs_set(world, e[11], Position, {11, 12});
+    ecs_set(world, e[12], Position, {12, 13});
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e[50], it.entities[0]);
+    {
+        Position *p = ecs_field_at(&it, Position, 1, 0);
+        test_assert(p != NULL);
+        test_int(p->x, 50); test_int(p->y, 51);
+    }
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(3, it.count);
+    test_uint(e[10], it.entities[0]);
+    test_uint(e[11], it.entities[1]);
+    test_uint(e[12], it.entities[2]);
+    {
+        Position *p = ecs_field_at(&it, Position, 1, 0);
+        test_assert(p != NULL);
+        test_int(p->x, 10); test_int(p->y, 11);
+    }
+    {
+        Position *p = ecs_field_at(&it, Position, 1, 1);
+        test_assert(p != NULL);
+        test_int(p->x, 11); test_int(p->y, 12);
+    }
+    {
+        Position *p = ecs_field_at(&it, Position, 1, 2);
+        test_assert(p != NULL);
+        test_int(p->x, 12); test_int(p->y, 13);
+    }
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void DontFragment_1_this_sparse_written_not_batched(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    ecs_add_id(world, ecs_id(Position), EcsDontFragment);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Foo, !Position",
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_entity_t e[10];
+    for (int i = 0; i < 10; i ++) {
+        e[i] = ecs_new_w(world, Foo);
+    }
+
+    ecs_set(world, e[0], Position, {10, 20});
+    ecs_set(world, e[4], Position, {30, 40});
+    ecs_set(world, e[5], Position, {50, 60});
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(3, it.count);
+    test_uint(e[1], it.entities[0]);
+    test_uint(e[2], it.entities[1]);
+    test_uint(e[3], it.entities[2]);
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(4, it.count);
+    test_uint(e[6], it.entities[0]);
+    test_uint(e[7], it.entities[1]);
+    test_uint(e[8], it.entities[2]);
+    test_uint(e[9], it.entities[3]);
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
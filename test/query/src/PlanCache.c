@@ -0,0 +1,306 @@
+#include <query.h>
+
+void PlanCache_get(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_entity_t e1 = ecs_new_w(world, Position);
+    ecs_add(world, e1, Velocity);
+
+    ecs_query_t *q = ecs_query_plan_cache_get(world, "Position, Velocity");
+    test_assert(q != NULL);
+    test_int(q->term_count, 2);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(it.count, 1);
+    test_uint(it.entities[0], e1);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_fini(world);
+}
+
+void PlanCache_get_twice(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_query_t *q_1 = ecs_query_plan_cache_get(world, "Position, Velocity");
+    test_assert(q_1 != NULL);
+
+    ecs_query_t *q_2 = ecs_query_plan_cache_get(world, "Position, Velocity");
+    test_assert(q_1 == q_2);
+
+    ecs_fini(world);
+}
+
+void PlanCache_get_different_expr(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_query_t *q_1 = ecs_query_plan_cache_get(world, "Position");
+    test_assert(q_1 != NULL);
+
+    ecs_query_t *q_2 = ecs_query_plan_cache_get(world, "Velocity");
+    test_assert(q_2 != NULL);
+    test_assert(q_1 != q_2);
+
+    test_uint(q_1->terms[0].id, ecs_id(Position));
+    test_uint(q_2->terms[0].id, ecs_id(Velocity));
+
+    test_assert(q_1 == ecs_query_plan_cache_get(world, "Position"));
+    test_assert(q_2 == ecs_query_plan_cache_get(world, "Velocity"));
+
+    ecs_fini(world);
+}
+
+void PlanCache_get_whitespace(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_query_t *q = ecs_query_plan_cache_get(world, "Position, Velocity");
+    test_assert(q != NULL);
+
+    test_assert(q == ecs_query_plan_cache_get(world, "Position,Velocity"));
+    test_assert(q == ecs_query_plan_cache_get(world, "  Position ,  Velocity "));
+    test_assert(q == ecs_query_plan_cache_get(world, "Position,\n Velocity\n"));
+
+    ecs_fini(world);
+}
+
+void PlanCache_get_invalid(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_log_set_level(-4);
+    test_assert(NULL == ecs_query_plan_cache_get(world, "Foo"));
+    test_assert(NULL == ecs_query_plan_cache_get(world, "Foo"));
+
+    ECS_TAG(world, Foo);
+    test_assert(NULL != ecs_query_plan_cache_get(world, "Foo"));
+
+    ecs_fini(world);
+}
+
+void PlanCache_get_w_scope(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t p1 = ecs_entity(world, { .name = "p1" });
+    ecs_entity_t p2 = ecs_entity(world, { .name = "p2" });
+    ecs_entity_t foo_1 = ecs_entity(world, { .name = "p1.Foo" });
+    ecs_entity_t foo_2 = ecs_entity(world, { .name = "p2.Foo" });
+
+    ecs_set_scope(world, p1);
+    ecs_query_t *q_1 = ecs_query_plan_cache_get(world, "Foo");
+    test_assert(q_1 != NULL);
+    test_uint(q_1->terms[0].id, foo_1);
+
+    ecs_set_scope(world, p2);
+    ecs_query_t *q_2 = ecs_query_plan_cache_get(world, "Foo");
+    test_assert(q_2 != NULL);
+    test_assert(q_1 != q_2);
+    test_uint(q_2->terms[0].id, foo_2);
+
+    ecs_set_scope(world, p1);
+    test_assert(q_1 == ecs_query_plan_cache_get(world, "Foo"));
+
+    ecs_set_scope(world, 0);
+
+    ecs_fini(world);
+}
+
+void PlanCache_delete_component(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+    ECS_TAG(world, Bar);
+
+    ecs_new_w(world, Foo);
+
+    ecs_query_t *q = ecs_query_plan_cache_get(world, "Foo");
+    test_assert(q != NULL);
+    test_assert(ecs_query_plan_cache_get(world, "Bar") != NULL);
+
+    /* Cached query must not prevent deleting the id */
+    ecs_delete(world, Foo);
+    test_assert(!ecs_is_alive(world, Foo));
+
+    ecs_log_set_level(-4);
+    test_assert(NULL == ecs_query_plan_cache_get(world, "Foo"));
+
+    ecs_entity_t e = ecs_new_w(world, Bar);
+    q = ecs_query_plan_cache_get(world, "Bar");
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(it.count, 1);
+    test_uint(it.entities[0], e);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_fini(world);
+}
+
+void PlanCache_delete_target(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Rel);
+    ECS_TAG(world, Tgt);
+
+    ecs_new_w_pair(world, Rel, Tgt);
+
+    ecs_query_t *q = ecs_query_plan_cache_get(world, "(Rel, Tgt)");
+    test_assert(q != NULL);
+
+    ecs_delete(world, Tgt);
+    test_assert(!ecs_is_alive(world, Tgt));
+
+    ecs_log_set_level(-4);
+    test_assert(NULL == ecs_query_plan_cache_get(world, "(Rel, Tgt)"));
+
+    ecs_fini(world);
+}
+
+void PlanCache_delete_source(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_entity_t e = ecs_entity(world, { .name = "e" });
+    ecs_set(world, e, Position, {10, 20});
+
+    ecs_query_t *q = ecs_query_plan_cache_get(world, "Position(e)");
+    test_assert(q != NULL);
+
+    ecs_delete(world, e);
+
+    ecs_entity_t e2 = ecs_entity(world, { .name = "e" });
+    ecs_set(world, e2, Position, {30, 40});
+
+    q = ecs_query_plan_cache_get(world, "Position(e)");
+    test_assert(q != NULL);
+    test_uint(ECS_TERM_REF_ID(&q->terms[0].src), e2);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_uint(it.sources[0], e2);
+    const Position *p = ecs_field(&it, Position, 0);
+    test_int(p->x, 30);
+    test_int(p->y, 40);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_fini(world);
+}
+
+void PlanCache_evict(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t tags[FLECS_QUERY_PLAN_CACHE_SIZE + 1];
+    char *exprs[FLECS_QUERY_PLAN_CACHE_SIZE + 1];
+    int i;
+    for (i = 0; i < FLECS_QUERY_PLAN_CACHE_SIZE + 1; i ++) {
+        tags[i] = ecs_new(world);
+        exprs[i] = flecs_asprintf("Foo, #%u", (uint32_t)tags[i]);
+    }
+
+    for (i = 0; i < FLECS_QUERY_PLAN_CACHE_SIZE; i ++) {
+        ecs_query_t *q = ecs_query_plan_cache_get(world, exprs[i]);
+        test_assert(q != NULL);
+        test_uint(q->terms[1].id, tags[i]);
+    }
+
+    /* Use first query so it's most recently used */
+    ecs_query_t *q_0 = ecs_query_plan_cache_get(world, exprs[0]);
+    test_assert(q_0 != NULL);
+
+    /* Evicts second query */
+    ecs_query_t *q_last = ecs_query_plan_cache_get(
+        world, exprs[FLECS_QUERY_PLAN_CACHE_SIZE]);
+    test_assert(q_last != NULL);
+    test_uint(q_last->terms[1].id, tags[FLECS_QUERY_PLAN_CACHE_SIZE]);
+
+    test_assert(q_0 == ecs_query_plan_cache_get(world, exprs[0]));
+
+    ecs_query_t *q_1 = ecs_query_plan_cache_get(world, exprs[1]);
+    test_assert(q_1 != NULL);
+    test_uint(q_1->terms[1].id, tags[1]);
+
+    for (i = 0; i < FLECS_QUERY_PLAN_CACHE_SIZE + 1; i ++) {
+        ecs_os_free(exprs[i]);
+    }
+
+    ecs_fini(world);
+}
+
+void PlanCache_clear(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Foo);
+
+    ecs_entity_t e = ecs_new_w(world, Foo);
+
+    ecs_query_t *q = ecs_query_plan_cache_get(world, "Foo");
+    test_assert(q != NULL);
+
+    ecs_query_plan_cache_clear(world);
+
+    /* Query no longer keeps id alive */
+    ecs_delete(world, Foo);
+    test_assert(!ecs_is_alive(world, Foo));
+    test_assert(ecs_is_alive(world, e));
+
+    ecs_fini(world);
+}
+
+void PlanCache_delete_component_w_parent(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ecs_entity_t parent = ecs_entity(world, { .name = "parent" });
+    ecs_entity_t foo = ecs_entity(world, { .name = "parent.Foo" });
+    ecs_entity_t e = ecs_new_w_id(world, foo);
+
+    ecs_query_t *q = ecs_query_plan_cache_get(world, "parent.Foo");
+    test_assert(q != NULL);
+    test_uint(q->terms[0].id, foo);
+
+    /* Deleting the parent also deletes the component, which must not be kept
+     * alive by the cached query */
+    ecs_delete(world, parent);
+    test_assert(!ecs_is_alive(world, parent));
+    test_assert(!ecs_is_alive(world, foo));
+    test_assert(ecs_is_alive(world, e));
+
+    ecs_log_set_level(-4);
+    test_assert(NULL == ecs_query_plan_cache_get(world, "parent.Foo"));
+
+    ecs_fini(world);
+}
+
+void PlanCache_delete_target_w_parent(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_TAG(world, Rel);
+
+    ecs_entity_t parent = ecs_entity(world, { .name = "parent" });
+    ecs_entity_t tgt = ecs_entity(world, { .name = "parent.Tgt" });
+    ecs_new_w_pair(world, Rel, tgt);
+
+    ecs_query_t *q = ecs_query_plan_cache_get(world, "(Rel, parent.Tgt)");
+    test_assert(q != NULL);
+
+    ecs_delete(world, parent);
+    test_assert(!ecs_is_alive(world, tgt));
+
+    ecs_log_set_level(-4);
+    test_assert(NULL == ecs_query_plan_cache_get(world, "(Rel, parent.Tgt)"));
+
+    ecs_fini(world);
+}
@@ -6165,3 +6165,437 @@ void Toggle_toggle_0_src(void) {
 
     ecs_fini(world);
 }
+
+void Toggle_this_range_across_blocks(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_add_id(world, ecs_id(Position), EcsCanToggle);
+
+    ecs_entity_t e[200];
+    for (int i = 0; i < 200; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+        ecs_enable_component(world, e[i], Position, i >= 10 && i < 190);
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position",
+        .cache_kind = cache_kind
+    });
+
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(180, it.count);
+    test_uint(e[10], it.entities[0]);
+    test_uint(e[189], it.entities[179]);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+static
+int32_t toggle_mask_collect(
+    ecs_iter_t *it,
+    ecs_entity_t *result)
+{
+    int32_t count = 0;
+    while (ecs_query_next(it)) {
+        ecs_flags64_t mask = ecs_iter_get_row_mask(it);
+        test_assert(it->count <= 64);
+        test_assert(mask & 1);
+        for (int32_t i = 0; i < it->count; i ++) {
+            if (mask & (1llu << i)) {
+                result[count ++] = it->entities[i];
+            }
+        }
+    }
+    return count;
+}
+
+void Toggle_this_toggle_mask(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_add_id(world, ecs_id(Position), EcsCanToggle);
+
+    ecs_entity_t e[200];
+    for (int i = 0; i < 200; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+        ecs_enable_component(world, e[i], Position, !(i % 3));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position",
+        .cache_kind = cache_kind,
+        .flags = EcsQueryToggleMask
+    });
+
+    test_assert(q != NULL);
+
+    ecs_entity_t result[200];
+    ecs_iter_t it = ecs_query_iter(world, q);
+    int32_t i, count = toggle_mask_collect(&it, result);
+    test_int(count, 67);
+    for (i = 0; i < count; i ++) {
+        test_uint(e[i * 3], result[i]);
+    }
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Toggle_this_toggle_mask_result_per_block(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_add_id(world, ecs_id(Position), EcsCanToggle);
+
+    ecs_entity_t e[200];
+    for (int i = 0; i < 200; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+        ecs_enable_component(world, e[i], Position, !(i % 2));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position",
+        .cache_kind = cache_kind,
+        .flags = EcsQueryToggleMask
+    });
+
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(64, it.count);
+    test_uint(e[0], it.entities[0]);
+    test_uint(0x5555555555555555, ecs_iter_get_row_mask(&it));
+    Position *p = ecs_field(&it, Position, 0);
+    test_int(p[0].x, 0);
+    test_int(p[2].x, 2);
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(64, it.count);
+    test_uint(e[64], it.entities[0]);
+    test_uint(0x5555555555555555, ecs_iter_get_row_mask(&it));
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(64, it.count);
+    test_uint(e[128], it.entities[0]);
+    test_uint(0x5555555555555555, ecs_iter_get_row_mask(&it));
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(8, it.count);
+    test_uint(e[192], it.entities[0]);
+    test_uint(0x55, ecs_iter_get_row_mask(&it));
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Toggle_this_toggle_mask_skip_disabled_rows(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_add_id(world, ecs_id(Position), EcsCanToggle);
+
+    ecs_entity_t e[100];
+    for (int i = 0; i < 100; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+        ecs_enable_component(world, e[i], Position, 
+            !(i < 10 || (i >= 60 && i < 80)));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position",
+        .cache_kind = cache_kind,
+        .flags = EcsQueryToggleMask
+    });
+
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(54, it.count);
+    test_uint(e[10], it.entities[0]);
+    test_uint(0x3FFFFFFFFFFFF, ecs_iter_get_row_mask(&it));
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(20, it.count);
+    test_uint(e[80], it.entities[0]);
+    test_uint(0xFFFFF, ecs_iter_get_row_mask(&it));
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Toggle_this_toggle_mask_2_fields(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_add_id(world, ecs_id(Position), EcsCanToggle);
+    ecs_add_id(world, ecs_id(Velocity), EcsCanToggle);
+
+    ecs_entity_t e[200];
+    for (int i = 0; i < 200; i ++) {
+        e[i] = ecs_insert(world, 
+            ecs_value(Position, {i, 0}), ecs_value(Velocity, {i, 0}));
+        ecs_enable_component(world, e[i], Position, !(i % 2));
+        ecs_enable_component(world, e[i], Velocity, !(i % 3));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position, Velocity",
+        .cache_kind = cache_kind,
+        .flags = EcsQueryToggleMask
+    });
+
+    test_assert(q != NULL);
+
+    ecs_entity_t result[200];
+    ecs_iter_t it = ecs_query_iter(world, q);
+    int32_t i, count = toggle_mask_collect(&it, result);
+    test_int(count, 34);
+    for (i = 0; i < count; i ++) {
+        test_uint(e[i * 6], result[i]);
+    }
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Toggle_this_toggle_mask_not_field(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_add_id(world, ecs_id(Position), EcsCanToggle);
+    ecs_add_id(world, ecs_id(Velocity), EcsCanToggle);
+
+    ecs_entity_t e[200];
+    for (int i = 0; i < 200; i ++) {
+        e[i] = ecs_insert(world, 
+            ecs_value(Position, {i, 0}), ecs_value(Velocity, {i, 0}));
+        ecs_enable_component(world, e[i], Velocity, !(i % 2));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position, !Velocity",
+        .cache_kind = cache_kind,
+        .flags = EcsQueryToggleMask
+    });
+
+    test_assert(q != NULL);
+
+    ecs_entity_t result[200];
+    ecs_iter_t it = ecs_query_iter(world, q);
+    int32_t i, count = toggle_mask_collect(&it, result);
+    test_int(count, 100);
+    for (i = 0; i < count; i ++) {
+        test_uint(e[i * 2 + 1], result[i]);
+    }
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Toggle_this_toggle_mask_no_bitset(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_TAG(world, Foo);
+
+    ecs_add_id(world, ecs_id(Position), EcsCanToggle);
+
+    ecs_entity_t e1 = ecs_insert(world, ecs_value(Position, {10, 20}));
+    ecs_entity_t e2 = ecs_insert(world, ecs_value(Position, {20, 30}));
+    ecs_entity_t e3 = ecs_insert(world, ecs_value(Position, {30, 40}));
+    ecs_add(world, e3, Foo);
+    ecs_enable_component(world, e3, Position, false);
+    ecs_entity_t e4 = ecs_insert(world, ecs_value(Position, {40, 50}));
+    ecs_add(world, e4, Foo);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position",
+        .cache_kind = cache_kind,
+        .flags = EcsQueryToggleMask
+    });
+
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(2, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
+    test_uint(0x3, ecs_iter_get_row_mask(&it));
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e4, it.entities[0]);
+    test_uint(0x1, ecs_iter_get_row_mask(&it));
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Toggle_this_toggle_mask_no_flag(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+
+    ecs_add_id(world, ecs_id(Position), EcsCanToggle);
+
+    ecs_entity_t e[10];
+    for (int i = 0; i < 10; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+        ecs_enable_component(world, e[i], Position, !(i % 2));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position",
+        .cache_kind = cache_kind
+    });
+
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    for (int i = 0; i < 5; i ++) {
+        test_bool(true, ecs_query_next(&it));
+        test_int(1, it.count);
+        test_uint(e[i * 2], it.entities[0]);
+        test_uint(0x1, ecs_iter_get_row_mask(&it));
+    }
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Toggle_this_toggle_mask_no_bitset_large_table(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ecs_add_id(world, ecs_id(Velocity), EcsCanToggle);
+
+    ecs_entity_t e[200];
+    for (int i = 0; i < 200; i ++) {
+        e[i] = ecs_insert(world, ecs_value(Position, {i, 0}));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position, !Velocity",
+        .cache_kind = cache_kind,
+        .flags = EcsQueryToggleMask
+    });
+
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(64, it.count);
+    test_uint(e[0], it.entities[0]);
+    test_uint(UINT64_MAX, ecs_iter_get_row_mask(&it));
+    Position *p = ecs_field(&it, Position, 0);
+    test_int(p[0].x, 0);
+    test_int(p[63].x, 63);
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(64, it.count);
+    test_uint(e[64], it.entities[0]);
+    test_uint(UINT64_MAX, ecs_iter_get_row_mask(&it));
+    p = ecs_field(&it, Position, 0);
+    test_int(p[0].x, 64);
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(64, it.count);
+    test_uint(e[128], it.entities[0]);
+    test_uint(UINT64_MAX, ecs_iter_get_row_mask(&it));
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(8, it.count);
+    test_uint(e[192], it.entities[0]);
+    test_uint(0xFF, ecs_iter_get_row_mask(&it));
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Toggle_this_toggle_mask_no_bitset_large_table_w_toggle(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_COMPONENT(world, Position);
+    ECS_COMPONENT(world, Velocity);
+
+    ECS_COMPONENT(world, Mass);
+
+    ecs_add_id(world, ecs_id(Velocity), EcsCanToggle);
+    ecs_add_id(world, ecs_id(Mass), EcsCanToggle);
+
+    /* Table has a toggle column, but not for a component in the query */
+    ecs_entity_t e[200];
+    for (int i = 0; i < 200; i ++) {
+        e[i] = ecs_insert(world, 
+            ecs_value(Position, {i, 0}), ecs_value(Mass, {i}));
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "Position, !Velocity",
+        .cache_kind = cache_kind,
+        .flags = EcsQueryToggleMask
+    });
+
+    test_assert(q != NULL);
+
+    ecs_entity_t result[200];
+    ecs_iter_t it = ecs_query_iter(world, q);
+    int32_t i, count = 0;
+    while (ecs_query_next(&it)) {
+        test_assert(it.count <= 64);
+        ecs_flags64_t mask = ecs_iter_get_row_mask(&it);
+        for (i = 0; i < it.count; i ++) {
+            if (mask & (1llu << i)) {
+                test_assert(count < 200);
+                result[count ++] = it.entities[i];
+            }
+        }
+    }
+
+    test_int(count, 200);
+    for (i = 0; i < count; i ++) {
+        test_uint(e[i], result[i]);
+    }
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
@@ -308,11 +308,6 @@ void Union_1_this_union_wildcard(void) {
     test_assert(q != NULL);
 
     ecs_iter_t it = ecs_query_iter(world, q);
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e6, it.entities[0]);
-    test_uint(ecs_pair(Movement, Sitting), ecs_field_id(&it, 0));
-
     test_bool(true, ecs_query_next(&it));
     test_int(1, it.count);
     test_uint(e5, it.entities[0]);
@@ -338,6 +333,11 @@ void Union_1_this_union_wildcard(void) {
     test_uint(e1, it.entities[0]);
     test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
 
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e6, it.entities[0]);
+    test_uint(ecs_pair(Movement, Sitting), ecs_field_id(&it, 0));
+
     test_bool(false, ecs_query_next(&it));
 
     ecs_query_fini(q);
@@ -490,12 +490,6 @@ void Union_1_this_union_tgt_var(void) {
     test_assert(x_var != -1);
 
     ecs_iter_t it = ecs_query_iter(world, q);
-    test_bool(true, ecs_query_next(&it));
-    test_int(1, it.count);
-    test_uint(e6, it.entities[0]);
-    test_uint(ecs_pair(Movement, Sitting), ecs_field_id(&it, 0));
-    test_uint(Sitting, ecs_iter_get_var(&it, x_var));
-
     test_bool(true, ecs_query_next(&it));
     test_int(1, it.count);
     test_uint(e5, it.entities[0]);
@@ -526,6 +520,12 @@ void Union_1_this_union_tgt_var(void) {
     test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
     test_uint(Walking, ecs_iter_get_var(&it, x_var));
 
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e6, it.entities[0]);
+    test_uint(ecs_pair(Movement, Sitting), ecs_field_id(&it, 0));
+    test_uint(Sitting, ecs_iter_get_var(&it, x_var));
+
     test_bool(false, ecs_query_next(&it));
 
     ecs_query_fini(q);
@@ -724,12 +724,6 @@ void Union_1_var_union_wildcard(void) {
     test_assert(y_var != -1);
 
     ecs_iter_t it = ecs_query_iter(world, q);
-    test_bool(true, ecs_query_next(&it));
-    test_int(0, it.count);
-    test_uint(ecs_pair(Movement, Sitting), ecs_field_id(&it, 0));
-    test_uint(e6, ecs_field_src(&it, 0));
-    test_uint(e6, ecs_iter_get_var(&it, y_var));
-
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
     test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 0));
@@ -760,6 +754,12 @@ void Union_1_var_union_wildcard(void) {
     test_uint(e1, ecs_field_src(&it, 0));
     test_uint(e1, ecs_iter_get_var(&it, y_var));
 
+    test_bool(true, ecs_query_next(&it));
+    test_int(0, it.count);
+    test_uint(ecs_pair(Movement, Sitting), ecs_field_id(&it, 0));
+    test_uint(e6, ecs_field_src(&it, 0));
+    test_uint(e6, ecs_iter_get_var(&it, y_var));
+
     test_bool(false, ecs_query_next(&it));
 
     ecs_query_fini(q);
@@ -930,13 +930,6 @@ void Union_1_var_union_tgt_var(void) {
     test_assert(y_var != -1);
 
     ecs_iter_t it = ecs_query_iter(world, q);
-    test_bool(true, ecs_query_next(&it));
-    test_int(0, it.count);
-    test_uint(ecs_pair(Movement, Sitting), ecs_field_id(&it, 0));
-    test_uint(e6, ecs_field_src(&it, 0));
-    test_uint(Sitting, ecs_iter_get_var(&it, x_var));
-    test_uint(e6, ecs_iter_get_var(&it, y_var));
-
     test_bool(true, ecs_query_next(&it));
     test_int(0, it.count);
     test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 0));
@@ -972,6 +965,13 @@ void Union_1_var_union_tgt_var(void) {
     test_uint(Walking, ecs_iter_get_var(&it, x_var));
     test_uint(e1, ecs_iter_get_var(&it, y_var));
 
+    test_bool(true, ecs_query_next(&it));
+    test_int(0, it.count);
+    test_uint(ecs_pair(Movement, Sitting), ecs_field_id(&it, 0));
+    test_uint(e6, ecs_field_src(&it, 0));
+    test_uint(Sitting, ecs_iter_get_var(&it, x_var));
+    test_uint(e6, ecs_iter_get_var(&it, y_var));
+
     test_bool(false, ecs_query_next(&it));
 
     ecs_query_fini(q);
@@ -2830,11 +2830,6 @@ void Union_query_switch(void) {
     ECS_ENTITY(world, e3, (Movement, Running));
 
     ecs_iter_t it = ecs_query_iter(world, q);
-    test_bool(true, ecs_query_next(&it));
-    test_int(it.count, 1);
-    test_uint(it.entities[0], e2);
-    test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
-
     test_bool(true, ecs_query_next(&it));
     test_int(it.count, 1);
     test_uint(it.entities[0], e3);
@@ -2844,6 +2839,11 @@ void Union_query_switch(void) {
     test_int(it.count, 1);
     test_uint(it.entities[0], e1);
     test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 0));
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(it.count, 1);
+    test_uint(it.entities[0], e2);
+    test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
     test_bool(false, ecs_query_next(&it));
 
     ecs_query_fini(q);
@@ -4133,11 +4133,6 @@ void Union_self_up(void) {
 
     ecs_iter_t it = ecs_query_iter(world, q);
 
-    test_bool(ecs_query_next(&it), true);
-    test_int(it.entities[0], e4);
-    test_int(it.count, 1);
-    test_uint(it.ids[0], ecs_pair(SwX, TagC));
-
     test_bool(ecs_query_next(&it), true);
     test_int(it.entities[0], b2);
     test_int(it.count, 1);
@@ -4159,6 +4154,11 @@ void Union_self_up(void) {
     test_int(it.count, 2);
     test_uint(it.ids[0], ecs_pair(SwX, TagA));
 
+    test_bool(ecs_query_next(&it), true);
+    test_int(it.entities[0], e4);
+    test_int(it.count, 1);
+    test_uint(it.ids[0], ecs_pair(SwX, TagC));
+
     test_bool(ecs_query_next(&it), false);
 
     ecs_query_fini(q);
@@ -4464,13 +4464,13 @@ void Union_tgt_w_generation(void) {
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
     test_int(it.count, 1);
-    test_uint(it.entities[0], e2);
-    test_uint(ecs_field_id(&it, 0), ecs_pair(Rel, tgt_2));
+    test_uint(it.entities[0], e1);
+    test_uint(ecs_field_id(&it, 0), ecs_pair(Rel, tgt_1));
 
     test_bool(true, ecs_query_next(&it));
     test_int(it.count, 1);
-    test_uint(it.entities[0], e1);
-    test_uint(ecs_field_id(&it, 0), ecs_pair(Rel, tgt_1));
+    test_uint(it.entities[0], e2);
+    test_uint(ecs_field_id(&it, 0), ecs_pair(Rel, tgt_2));
 
     test_bool(false, ecs_query_next(&it));
 
@@ -4509,13 +4509,13 @@ void Union_tgt_w_not_alive(void) {
     ecs_iter_t it = ecs_query_iter(world, q);
     test_bool(true, ecs_query_next(&it));
     test_int(it.count, 1);
-    test_uint(it.entities[0], e2);
-    test_uint(ecs_field_id(&it, 0), ecs_pair(Rel, tgt_2));
+    test_uint(it.entities[0], e1);
+    test_uint(ecs_field_id(&it, 0), ecs_pair(Rel, tgt_1));
 
     test_bool(true, ecs_query_next(&it));
     test_int(it.count, 1);
-    test_uint(it.entities[0], e1);
-    test_uint(ecs_field_id(&it, 0), ecs_pair(Rel, tgt_1));
+    test_uint(it.entities[0], e2);
+    test_uint(ecs_field_id(&it, 0), ecs_pair(Rel, tgt_2));
 
     test_bool(false, ecs_query_next(&it));
 
@@ -4658,3 +4658,410 @@ void Union_tgt_inherited(void) {
 
     ecs_fini(world);
 }
+
+void Union_union_index_tgt(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_ENTITY(world, Movement, Union);
+    ECS_TAG(world, Walking);
+    ECS_TAG(world, Running);
+
+    ecs_enable_union_index(world, true);
+
+    ecs_entity_t e1 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e2 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e3 = ecs_new_w_pair(world, Movement, Running);
+    ecs_entity_t e4 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e5 = ecs_new_w_pair(world, Movement, Walking);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement, Walking)",
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(2, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
+    test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(2, it.count);
+    test_uint(e4, it.entities[0]);
+    test_uint(e5, it.entities[1]);
+    test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    q = ecs_query(world, {
+        .expr = "(Movement, Running)",
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e3, it.entities[0]);
+    test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 0));
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Union_union_index_tgt_after_set(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_ENTITY(world, Movement, Union);
+    ECS_TAG(world, Walking);
+    ECS_TAG(world, Running);
+
+    ecs_enable_union_index(world, true);
+
+    ecs_entity_t e1 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e2 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e3 = ecs_new_w_pair(world, Movement, Walking);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement, Walking)",
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(3, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
+    test_uint(e3, it.entities[2]);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_add_pair(world, e2, Movement, Running);
+
+    it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e1, it.entities[0]);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e3, it.entities[0]);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_add_pair(world, e2, Movement, Walking);
+
+    it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(3, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
+    test_uint(e3, it.entities[2]);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Union_union_index_tgt_after_delete(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_ENTITY(world, Movement, Union);
+    ECS_TAG(world, Walking);
+    ECS_TAG(world, Running);
+
+    ecs_enable_union_index(world, true);
+
+    ecs_entity_t e1 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e2 = ecs_new_w_pair(world, Movement, Running);
+    ecs_entity_t e3 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e4 = ecs_new_w_pair(world, Movement, Walking);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement, Walking)",
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e1, it.entities[0]);
+    test_bool(true, ecs_query_next(&it));
+    test_int(2, it.count);
+    test_uint(e3, it.entities[0]);
+    test_uint(e4, it.entities[1]);
+    test_bool(false, ecs_query_next(&it));
+
+    /* Moves e4 to the row of e2 */
+    ecs_delete(world, e2);
+
+    it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(3, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(e4, it.entities[1]);
+    test_uint(e3, it.entities[2]);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Union_union_index_wildcard(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_ENTITY(world, Movement, Union);
+    ECS_TAG(world, Walking);
+    ECS_TAG(world, Running);
+
+    ecs_enable_union_index(world, true);
+
+    ecs_entity_t e1 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e2 = ecs_new_w_pair(world, Movement, Running);
+    ecs_entity_t e3 = ecs_new_w_pair(world, Movement, Running);
+    ecs_entity_t e4 = ecs_new_w_pair(world, Movement, Walking);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement, $x)",
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    int x_var = ecs_query_find_var(q, "x");
+    test_assert(x_var != -1);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
+    test_uint(Walking, ecs_iter_get_var(&it, x_var));
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e4, it.entities[0]);
+    test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
+    test_uint(Walking, ecs_iter_get_var(&it, x_var));
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(2, it.count);
+    test_uint(e2, it.entities[0]);
+    test_uint(e3, it.entities[1]);
+    test_uint(ecs_pair(Movement, Running), ecs_field_id(&it, 0));
+    test_uint(Running, ecs_iter_get_var(&it, x_var));
+
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Union_union_index_w_other_term(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_ENTITY(world, Movement, Union);
+    ECS_TAG(world, Walking);
+    ECS_TAG(world, Running);
+    ECS_TAG(world, Foo);
+
+    ecs_enable_union_index(world, true);
+
+    ecs_entity_t e1 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e2 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e3 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e4 = ecs_new_w_pair(world, Movement, Running);
+    ecs_add(world, e2, Foo);
+    ecs_add(world, e3, Foo);
+    ecs_add(world, e4, Foo);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement, Walking), Foo",
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(2, it.count);
+    test_uint(e2, it.entities[0]);
+    test_uint(e3, it.entities[1]);
+    test_uint(ecs_pair(Movement, Walking), ecs_field_id(&it, 0));
+    test_uint(Foo, ecs_field_id(&it, 1));
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    test_assert(e1 != 0);
+
+    ecs_fini(world);
+}
+
+void Union_union_index_many_rows(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_ENTITY(world, Movement, Union);
+    ECS_TAG(world, Walking);
+    ECS_TAG(world, Running);
+
+    ecs_enable_union_index(world, true);
+
+    /* Rows [60, 200) are Walking and span multiple bitmap words, row 130 is 
+     * Running, which splits the Walking rows in two ranges. */
+    ecs_entity_t entities[256];
+    int i;
+    for (i = 0; i < 256; i ++) {
+        ecs_entity_t tgt = (i >= 60 && i < 200 && i != 130) ? Walking : Running;
+        entities[i] = ecs_new_w_pair(world, Movement, tgt);
+    }
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement, Walking)",
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(70, it.count);
+    test_uint(entities[60], it.entities[0]);
+    test_uint(entities[129], it.entities[69]);
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(69, it.count);
+    test_uint(entities[131], it.entities[0]);
+    test_uint(entities[199], it.entities[68]);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    q = ecs_query(world, {
+        .expr = "(Movement, Running)",
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(60, it.count);
+    test_uint(entities[0], it.entities[0]);
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(entities[130], it.entities[0]);
+
+    test_bool(true, ecs_query_next(&it));
+    test_int(56, it.count);
+    test_uint(entities[200], it.entities[0]);
+    test_uint(entities[255], it.entities[55]);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
+
+void Union_union_index_multiple_tables(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_ENTITY(world, Movement, Union);
+    ECS_TAG(world, Walking);
+    ECS_TAG(world, Running);
+    ECS_TAG(world, Foo);
+
+    ecs_enable_union_index(world, true);
+
+    ecs_entity_t e1 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e2 = ecs_new_w_pair(world, Movement, Running);
+    ecs_entity_t e3 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_add(world, e3, Foo);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement, Walking)",
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e1, it.entities[0]);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e3, it.entities[0]);
+    test_bool(false, ecs_query_next(&it));
+
+    /* Delete the table with Foo */
+    ecs_delete(world, e3);
+    ecs_delete_empty_tables(world, &(ecs_delete_empty_tables_desc_t){
+        .delete_generation = 1
+    });
+    test_assert(ecs_delete_empty_tables(world, 
+        &(ecs_delete_empty_tables_desc_t){
+            .delete_generation = 1
+        }) != 0);
+
+    ecs_entity_t e4 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_add(world, e4, Foo);
+
+    it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e1, it.entities[0]);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e4, it.entities[0]);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    test_assert(e2 != 0);
+
+    ecs_fini(world);
+}
+
+void Union_union_index_disable(void) {
+    ecs_world_t *world = ecs_mini();
+
+    ECS_ENTITY(world, Movement, Union);
+    ECS_TAG(world, Walking);
+
+    ecs_enable_union_index(world, true);
+
+    ecs_entity_t e1 = ecs_new_w_pair(world, Movement, Walking);
+    ecs_entity_t e2 = ecs_new_w_pair(world, Movement, Walking);
+
+    ecs_query_t *q = ecs_query(world, {
+        .expr = "(Movement, Walking)",
+        .cache_kind = cache_kind
+    });
+    test_assert(q != NULL);
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(2, it.count);
+    test_uint(e1, it.entities[0]);
+    test_uint(e2, it.entities[1]);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_enable_union_index(world, false);
+
+    it = ecs_query_iter(world, q);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e2, it.entities[0]);
+    test_bool(true, ecs_query_next(&it));
+    test_int(1, it.count);
+    test_uint(e1, it.entities[0]);
+    test_bool(false, ecs_query_next(&it));
+
+    ecs_query_fini(q);
+
+    ecs_fini(world);
+}
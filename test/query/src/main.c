@@ -1773,6 +1773,13 @@ void ChangeDetection_detect_w_wildcard_test(void);
 void ChangeDetection_detect_w_group_by(void);
 void ChangeDetection_detect_w_cascade(void);
 void ChangeDetection_detect_w_cascade_desc(void);
+void ChangeDetection_changed_rows_after_set(void);
+void ChangeDetection_changed_rows_after_query_write(void);
+void ChangeDetection_changed_rows_after_delete(void);
+void ChangeDetection_changed_rows_after_new(void);
+void ChangeDetection_changed_rows_many(void);
+void ChangeDetection_changed_rows_no_trait(void);
+void ChangeDetection_changed_rows_shared(void);
 
 // Testsuite 'GroupBy'
 void GroupBy_group_by(void);
@@ -2027,6 +2034,16 @@ void Toggle_this_sort(void);
 void Toggle_this_table_move_2_from_3(void);
 void Toggle_toggle_0_src_only_term(void);
 void Toggle_toggle_0_src(void);
+void Toggle_this_range_across_blocks(void);
+void Toggle_this_toggle_mask(void);
+void Toggle_this_toggle_mask_result_per_block(void);
+void Toggle_this_toggle_mask_skip_disabled_rows(void);
+void Toggle_this_toggle_mask_2_fields(void);
+void Toggle_this_toggle_mask_not_field(void);
+void Toggle_this_toggle_mask_no_bitset(void);
+void Toggle_this_toggle_mask_no_flag(void);
+void Toggle_this_toggle_mask_no_bitset_large_table(void);
+void Toggle_this_toggle_mask_no_bitset_large_table_w_toggle(void);
 
 // Testsuite 'Sparse'
 void Sparse_setup(void);
@@ -2149,6 +2166,8 @@ void DontFragment_this_written_wc_tgt_var_w_component(void);
 void DontFragment_this_written_rel_var_w_component(void);
 void DontFragment_this_written_tgt_var_w_component(void);
 void DontFragment_add_to_self_while_iterate(void);
+void DontFragment_1_this_sparse_written_dense(void);
+void DontFragment_1_this_sparse_written_not_batched(void);
 
 // Testsuite 'Union'
 void Union_setup(void);
@@ -2223,6 +2242,14 @@ void Union_for_switch_filter_term(void);
 void Union_union_from_nothing(void);
 void Union_union_tgt_from_nothing(void);
 void Union_tgt_inherited(void);
+void Union_union_index_tgt(void);
+void Union_union_index_tgt_after_set(void);
+void Union_union_index_tgt_after_delete(void);
+void Union_union_index_wildcard(void);
+void Union_union_index_w_other_term(void);
+void Union_union_index_many_rows(void);
+void Union_union_index_multiple_tables(void);
+void Union_union_index_disable(void);
 
 // Testsuite 'OrderBy'
 void OrderBy_sort_by_component(void);
@@ -2367,6 +2394,21 @@ void QueryStr_pred_neq_m(void);
 void QueryStr_not_childof_any(void);
 void QueryStr_childof_0(void);
 
+// Testsuite 'PlanCache'
+void PlanCache_get(void);
+void PlanCache_get_twice(void);
+void PlanCache_get_different_expr(void);
+void PlanCache_get_whitespace(void);
+void PlanCache_get_invalid(void);
+void PlanCache_get_w_scope(void);
+void PlanCache_delete_component(void);
+void PlanCache_delete_target(void);
+void PlanCache_delete_source(void);
+void PlanCache_evict(void);
+void PlanCache_clear(void);
+void PlanCache_delete_component_w_parent(void);
+void PlanCache_delete_target_w_parent(void);
+
 bake_test_case Validator_testcases[] = {
     {
         "validate_1_term",
@@ -9307,6 +9349,34 @@ bake_test_case ChangeDetection_testcases[] = {
     {
         "detect_w_cascade_desc",
         ChangeDetection_detect_w_cascade_desc
+    },
+    {
+        "changed_rows_after_set",
+        ChangeDetection_changed_rows_after_set
+    },
+    {
+        "changed_rows_after_query_write",
+        ChangeDetection_changed_rows_after_query_write
+    },
+    {
+        "changed_rows_after_delete",
+        ChangeDetection_changed_rows_after_delete
+    },
+    {
+        "changed_rows_after_new",
+        ChangeDetection_changed_rows_after_new
+    },
+    {
+        "changed_rows_many",
+        ChangeDetection_changed_rows_many
+    },
+    {
+        "changed_rows_no_trait",
+        ChangeDetection_changed_rows_no_trait
+    },
+    {
+        "changed_rows_shared",
+        ChangeDetection_changed_rows_shared
     }
 };
 
@@ -10300,6 +10370,46 @@ bake_test_case Toggle_testcases[] = {
     {
         "toggle_0_src",
         Toggle_toggle_0_src
+    },
+    {
+        "this_range_across_blocks",
+        Toggle_this_range_across_blocks
+    },
+    {
+        "this_toggle_mask",
+        Toggle_this_toggle_mask
+    },
+    {
+        "this_toggle_mask_result_per_block",
+        Toggle_this_toggle_mask_result_per_block
+    },
+    {
+        "this_toggle_mask_skip_disabled_rows",
+        Toggle_this_toggle_mask_skip_disabled_rows
+    },
+    {
+        "this_toggle_mask_2_fields",
+        Toggle_this_toggle_mask_2_fields
+    },
+    {
+        "this_toggle_mask_not_field",
+        Toggle_this_toggle_mask_not_field
+    },
+    {
+        "this_toggle_mask_no_bitset",
+        Toggle_this_toggle_mask_no_bitset
+    },
+    {
+        "this_toggle_mask_no_flag",
+        Toggle_this_toggle_mask_no_flag
+    },
+    {
+        "this_toggle_mask_no_bitset_large_table",
+        Toggle_this_toggle_mask_no_bitset_large_table
+    },
+    {
+        "this_toggle_mask_no_bitset_large_table_w_toggle",
+        Toggle_this_toggle_mask_no_bitset_large_table_w_toggle
     }
 };
 
@@ -10770,6 +10880,14 @@ bake_test_case DontFragment_testcases[] = {
     {
         "add_to_self_while_iterate",
         DontFragment_add_to_self_while_iterate
+    },
+    {
+        "1_this_sparse_written_dense",
+        DontFragment_1_this_sparse_written_dense
+    },
+    {
+        "1_this_sparse_written_not_batched",
+        DontFragment_1_this_sparse_written_not_batched
     }
 };
 
@@ -11057,6 +11175,38 @@ bake_test_case Union_testcases[] = {
     {
         "tgt_inherited",
         Union_tgt_inherited
+    },
+    {
+        "union_index_tgt",
+        Union_union_index_tgt
+    },
+    {
+        "union_index_tgt_after_set",
+        Union_union_index_tgt_after_set
+    },
+    {
+        "union_index_tgt_after_delete",
+        Union_union_index_tgt_after_delete
+    },
+    {
+        "union_index_wildcard",
+        Union_union_index_wildcard
+    },
+    {
+        "union_index_w_other_term",
+        Union_union_index_w_other_term
+    },
+    {
+        "union_index_many_rows",
+        Union_union_index_many_rows
+    },
+    {
+        "union_index_multiple_tables",
+        Union_union_index_multiple_tables
+    },
+    {
+        "union_index_disable",
+        Union_union_index_disable
     }
 };
 
@@ -11612,6 +11762,61 @@ bake_test_case QueryStr_testcases[] = {
     }
 };
 
+bake_test_case PlanCache_testcases[] = {
+    {
+        "get",
+        PlanCache_get
+    },
+    {
+        "get_twice",
+        PlanCache_get_twice
+    },
+    {
+        "get_different_expr",
+        PlanCache_get_different_expr
+    },
+    {
+        "get_whitespace",
+        PlanCache_get_whitespace
+    },
+    {
+        "get_invalid",
+        PlanCache_get_invalid
+    },
+    {
+        "get_w_scope",
+        PlanCache_get_w_scope
+    },
+    {
+        "delete_component",
+        PlanCache_delete_component
+    },
+    {
+        "delete_target",
+        PlanCache_delete_target
+    },
+    {
+        "delete_source",
+        PlanCache_delete_source
+    },
+    {
+        "evict",
+        PlanCache_evict
+    },
+    {
+        "clear",
+        PlanCache_clear
+    },
+    {
+        "delete_component_w_parent",
+        PlanCache_delete_component_w_parent
+    },
+    {
+        "delete_target_w_parent",
+        PlanCache_delete_target_w_parent
+    }
+};
+
 const char* Fuzzing_cache_kind_param[] = {"default", "auto"};
 bake_test_param Fuzzing_params[] = {
     {"cache_kind", (char**)Fuzzing_cache_kind_param, 2}
@@ -11808,7 +12013,7 @@ static bake_test_suite suites[] = {
         "ChangeDetection",
         NULL,
         NULL,
-        67,
+        74,
         ChangeDetection_testcases
     },
     {
@@ -11831,7 +12036,7 @@ static bake_test_suite suites[] = {
         "Toggle",
         Toggle_setup,
         NULL,
-        163,
+        173,
         Toggle_testcases,
         1,
         Toggle_params
@@ -11849,7 +12054,7 @@ static bake_test_suite suites[] = {
         "DontFragment",
         DontFragment_setup,
         NULL,
-        85,
+        87,
         DontFragment_testcases,
         1,
         DontFragment_params
@@ -11858,7 +12063,7 @@ static bake_test_suite suites[] = {
         "Union",
         Union_setup,
         NULL,
-        71,
+        79,
         Union_testcases,
         1,
         Union_params
@@ -11890,9 +12095,16 @@ static bake_test_suite suites[] = {
         NULL,
         35,
         QueryStr_testcases
+    },
+    {
+        "PlanCache",
+        NULL,
+        NULL,
+        13,
+        PlanCache_testcases
     }
 };
 
 int main(int argc, char *argv[]) {
-    return bake_test_run("query", argc, argv, suites, 27);
+    return bake_test_run("query", argc, argv, suites, 28);
 }